@@ -0,0 +1,186 @@
+/*
+ *  LALInferenceLocalMPI.c:  In-process stand-in for the MPI calls of lalinference_mcmc
+ *
+ *  Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include "LALInferenceLocalMPI.h"
+
+#ifdef __GNUC__
+#define UNUSED __attribute__ ((unused))
+#else
+#define UNUSED
+#endif
+
+/* Messages a rank has sent to itself, oldest first */
+typedef struct tagLocalMPIMessage {
+    int tag;
+    size_t size;
+    void *data;
+    struct tagLocalMPIMessage *next;
+} LocalMPIMessage;
+
+static LocalMPIMessage *local_mpi_queue = NULL;
+
+static size_t LocalMPITypeSize(MPI_Datatype datatype)
+{
+    return datatype == MPI_DOUBLE ? sizeof(double) : sizeof(int);
+}
+
+static LocalMPIMessage *LocalMPIFind(int source, int tag, LocalMPIMessage ***link)
+{
+    LocalMPIMessage **ptr = &local_mpi_queue;
+    if (source != 0)
+        return NULL;
+    while (*ptr && (*ptr)->tag != tag)
+        ptr = &(*ptr)->next;
+    if (link)
+        *link = ptr;
+    return *ptr;
+}
+
+int MPI_Init(int UNUSED *argc, char UNUSED ***argv)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Finalize(void)
+{
+    while (local_mpi_queue) {
+        LocalMPIMessage *next = local_mpi_queue->next;
+        XLALFree(local_mpi_queue->data);
+        XLALFree(local_mpi_queue);
+        local_mpi_queue = next;
+    }
+    return MPI_SUCCESS;
+}
+
+int MPI_Comm_rank(MPI_Comm UNUSED comm, int *rank)
+{
+    *rank = 0;
+    return MPI_SUCCESS;
+}
+
+int MPI_Comm_size(MPI_Comm UNUSED comm, int *size)
+{
+    *size = 1;
+    return MPI_SUCCESS;
+}
+
+int MPI_Barrier(MPI_Comm UNUSED comm)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Bcast(void UNUSED *buffer, int UNUSED count, MPI_Datatype UNUSED datatype, int UNUSED root, MPI_Comm UNUSED comm)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Gather(const void *sendbuf, int sendcount, MPI_Datatype sendtype,
+               void *recvbuf, int UNUSED recvcount, MPI_Datatype UNUSED recvtype, int UNUSED root, MPI_Comm UNUSED comm)
+{
+    if (sendbuf != recvbuf)
+        memcpy(recvbuf, sendbuf, sendcount * LocalMPITypeSize(sendtype));
+    return MPI_SUCCESS;
+}
+
+int MPI_Scatter(const void *sendbuf, int sendcount, MPI_Datatype sendtype,
+                void *recvbuf, int UNUSED recvcount, MPI_Datatype UNUSED recvtype, int UNUSED root, MPI_Comm UNUSED comm)
+{
+    if (sendbuf != recvbuf)
+        memcpy(recvbuf, sendbuf, sendcount * LocalMPITypeSize(sendtype));
+    return MPI_SUCCESS;
+}
+
+int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm UNUSED comm)
+{
+    LocalMPIMessage **ptr = &local_mpi_queue;
+    LocalMPIMessage *message;
+
+    XLAL_CHECK(dest == 0, XLAL_EINVAL, "Rank %d does not exist in a single-process run", dest);
+
+    message = XLALCalloc(1, sizeof(LocalMPIMessage));
+    XLAL_CHECK(message, XLAL_ENOMEM);
+    message->tag = tag;
+    message->size = count * LocalMPITypeSize(datatype);
+    message->data = XLALMalloc(message->size);
+    XLAL_CHECK(message->data || message->size == 0, XLAL_ENOMEM);
+    memcpy(message->data, buf, message->size);
+
+    while (*ptr)
+        ptr = &(*ptr)->next;
+    *ptr = message;
+    return MPI_SUCCESS;
+}
+
+int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm,
+              MPI_Request *request)
+{
+    /* The message is copied, so the send is complete at once */
+    *request = MPI_REQUEST_NULL;
+    return MPI_Send(buf, count, datatype, dest, tag, comm);
+}
+
+int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm UNUSED comm,
+             MPI_Status *status)
+{
+    LocalMPIMessage **link = NULL;
+    LocalMPIMessage *message = LocalMPIFind(source, tag, &link);
+
+    XLAL_CHECK(message, XLAL_EFAILED, "Receiving a message from rank %d with tag %d that was never sent", source, tag);
+    XLAL_CHECK(message->size <= count * LocalMPITypeSize(datatype), XLAL_EBADLEN, "Message with tag %d is longer than the receive buffer", tag);
+
+    memcpy(buf, message->data, message->size);
+    if (status) {
+        status->MPI_SOURCE = source;
+        status->MPI_TAG = tag;
+        status->MPI_ERROR = MPI_SUCCESS;
+    }
+
+    *link = message->next;
+    XLALFree(message->data);
+    XLALFree(message);
+    return MPI_SUCCESS;
+}
+
+int MPI_Iprobe(int source, int tag, MPI_Comm UNUSED comm, int *flag, MPI_Status *status)
+{
+    *flag = LocalMPIFind(source, tag, NULL) != NULL;
+    if (*flag && status) {
+        status->MPI_SOURCE = source;
+        status->MPI_TAG = tag;
+        status->MPI_ERROR = MPI_SUCCESS;
+    }
+    return MPI_SUCCESS;
+}
+
+int MPI_Wait(MPI_Request *request, MPI_Status UNUSED *status)
+{
+    *request = MPI_REQUEST_NULL;
+    return MPI_SUCCESS;
+}
+
+int MPI_Waitall(int count, MPI_Request *requests, MPI_Status UNUSED *statuses)
+{
+    for (int i = 0; i < count; i++)
+        requests[i] = MPI_REQUEST_NULL;
+    return MPI_SUCCESS;
+}
@@ -39,7 +39,11 @@
 #include <lal/LALInferenceInit.h>
 #include <lal/LALInferenceCalibrationErrors.h>
 
+#ifdef LALINFERENCE_LOCAL_MPI
+#include "LALInferenceLocalMPI.h"
+#else
 #include <mpi.h>
+#endif
 
 
 void init_mpi_randomstate(LALInferenceRunState *run_state);
@@ -99,6 +103,7 @@ INT4 init_ptmcmc(LALInferenceRunState *runState) {
     ----------------------------------------------\n\
     (--adapt-temps)     Adapt the spacing between temperatures for uniform swap acceptance\n\
     (--temp-skip N)     Number of steps between temperature swap proposals (100)\n\
+    (--async-swaps)     Propose swaps across MPI ranks without blocking the ladder\n\
     (--tempKill N)      Iteration number to stop temperature swapping (Niter)\n\
     (--ntemps N)         Number of temperature chains in ladder (as many as needed)\n\
     (--temp-min T)      Lowest temperature for parallel tempering (1.0)\n\
@@ -132,6 +137,8 @@ INT4 init_ptmcmc(LALInferenceRunState *runState) {
 	(--resume)                 Allow jobs to resume partially completed run\n\
 	(--checkpoint-exit-code N) Exit with code N when checkpoint is complete.\n\
 	                           For use with condor's +SuccessCheckpointExitCode option\n\
+	(--checkpoint-increments N) Between full checkpoints, write up to N smaller files\n\
+	                           holding only what changed since the last checkpoint (0)\n\
     \n";
     INT4 mpi_rank, mpi_size;
     INT4 ntemps_per_thread;
@@ -164,6 +171,9 @@ INT4 init_ptmcmc(LALInferenceRunState *runState) {
         //runState->parallelSwap = &LALInferenceMCMCMCswap;
         fprintf(stderr, "ERROR: MCMCMC sampling hasn't been brought up-to-date since restructuring.\n");
         return XLAL_FAILURE;
+    } else if (LALInferenceGetProcParamVal(command_line, "--async-swaps")) {
+        /* Parallel tempering swap, asynchronous between MPI ranks */
+        runState->parallelSwap = &LALInferencePTswapAsync;
     } else {
         /* Standard parallel tempering swap. */
         runState->parallelSwap = &LALInferencePTswap;
@@ -239,6 +249,17 @@ INT4 init_ptmcmc(LALInferenceRunState *runState) {
     if (ppt)
         adapt_temps = 1;
 
+    /* Swap between MPI ranks without collective communication */
+    INT4 async_swaps = 0;
+    if (LALInferenceGetProcParamVal(command_line, "--async-swaps"))
+        async_swaps = 1;
+
+    /* Incremental checkpoints between full ones */
+    INT4 checkpoint_increments = 0;
+    ppt = LALInferenceGetProcParamVal(command_line, "--checkpoint-increments");
+    if (ppt)
+        checkpoint_increments = atoi(ppt->value);
+
     /* Starting temperature of the ladder */
     REAL8 tempMin = 1.0;
     ppt = LALInferenceGetProcParamVal(command_line, "--temp-min");
@@ -295,6 +316,8 @@ INT4 init_ptmcmc(LALInferenceRunState *runState) {
     LALInferenceAddINT4Variable(algorithm_params, "mpisize", mpi_size, LALINFERENCE_PARAM_OUTPUT);
     LALInferenceAddINT4Variable(algorithm_params, "ntemps", ntemps, LALINFERENCE_PARAM_OUTPUT);
     LALInferenceAddINT4Variable(algorithm_params, "adapt_temps", adapt_temps, LALINFERENCE_PARAM_OUTPUT);
+    LALInferenceAddINT4Variable(algorithm_params, "async_swaps", async_swaps, LALINFERENCE_PARAM_OUTPUT);
+    LALInferenceAddINT4Variable(algorithm_params, "checkpoint_increments", checkpoint_increments, LALINFERENCE_PARAM_OUTPUT);
     LALInferenceAddREAL8Variable(algorithm_params, "temp_min", tempMin, LALINFERENCE_PARAM_OUTPUT);
     LALInferenceAddREAL8Variable(algorithm_params, "temp_max", tempMax, LALINFERENCE_PARAM_OUTPUT);
     LALInferenceAddINT4Variable(algorithm_params, "de_buffer_limit", de_buffer_limit, LALINFERENCE_PARAM_OUTPUT);
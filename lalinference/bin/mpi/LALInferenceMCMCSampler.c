@@ -25,6 +25,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <signal.h>
 #include <sys/times.h>
 #ifdef HAVE_UNISTD_H
@@ -38,7 +39,11 @@
 #include <lal/TimeFreqFFT.h>
 #include <lal/GenerateInspiral.h>
 #include <lal/TimeDelay.h>
+#ifdef LALINFERENCE_LOCAL_MPI
+#include "LALInferenceLocalMPI.h"
+#else
 #include <mpi.h>
+#endif
 #include <lal/LALInference.h>
 #include "LALInferenceMCMCSampler.h"
 #include <lal/LALInferencePrior.h>
@@ -66,6 +71,50 @@
 #define UNUSED
 #endif
 
+/**
+ * State of the asynchronous swaps at the two ends of this rank's part of the
+ * ladder.  threads[0] offers its state to the last chain of the rank below,
+ * and is left unchanged until the answer arrives so that an accepted swap
+ * exchanges exactly the states the decision was made on.  The last thread
+ * answers the offers of the rank above.
+ */
+typedef struct tagPTAsyncSwapState {
+    INT4 initialised;
+    INT4 length;                /* temperature or decision, likelihood, prior and parameters */
+    INT4 pending;               /* threads[0] is waiting for an answer */
+    INT4 offers;                /* offers made to the rank below */
+    INT4 answers;               /* offers answered for the rank above */
+    REAL8 *offerOut, *offerIn, *replyOut, *replyIn;
+    MPI_Request offerRequest, replyRequest;
+    INT4 control[3];            /* checkpoint, exit and run complete */
+    MPI_Request *controlRequests;
+} PTAsyncSwapState;
+
+static PTAsyncSwapState ptAsync;
+
+static void PTswapAsyncInit(LALInferenceRunState *runState);
+static void PTswapAsyncControl(INT4 MPIrank, INT4 MPIsize, INT4 *saveStateFlag, INT4 *exitFlag, INT4 *runComplete);
+static void PTswapAsyncSettle(LALInferenceRunState *runState);
+
+/**
+ * Bookkeeping for incremental checkpoints.  A full checkpoint rewrites the
+ * resume and samples files and starts a new generation.  The checkpoints that
+ * follow it each go to their own increment file, holding only the
+ * differential evolution points and chain samples collected since the
+ * previous checkpoint along with the current state of every chain.
+ */
+typedef struct tagMCMCCheckpointState {
+    INT4 generation;            /* generation of the last full checkpoint, 0 before the first */
+    UINT4 increments;           /* increments written in this generation */
+    UINT4 deRewrites;           /* times a differential evolution buffer was thinned or reset */
+    UINT4 deRewritesMark;       /* value of deRewrites at the last checkpoint */
+    INT4 nthreads;
+    UINT4 *deMark;              /* differential points already checkpointed, per chain */
+    UINT4 *sampleMark;          /* chain samples already checkpointed, per chain */
+} MCMCCheckpointState;
+
+static MCMCCheckpointState mcmcCheckpoint;
+
 static void
 thinDifferentialEvolutionPoints(LALInferenceThreadState *thread) {
     size_t i;
@@ -91,6 +140,10 @@ thinDifferentialEvolutionPoints(LALInferenceThreadState *thread) {
     thread->differentialPointsSize = 2*newSize;
     thread->differentialPointsLength = newSize;
     thread->differentialPointsSkip *= 2;
+
+    /* The checkpointed buffer can no longer be extended */
+    #pragma omp atomic
+    mcmcCheckpoint.deRewrites++;
 }
 
 static void
@@ -128,6 +181,9 @@ resetDifferentialEvolutionBuffer(LALInferenceThreadState *thread) {
     thread->differentialPointsLength = 0;
     thread->differentialPointsSize = 1;
     thread->differentialPointsSkip = LALInferenceGetINT4Variable(thread->proposalArgs, "de_skip");
+
+    #pragma omp atomic
+    mcmcCheckpoint.deRewrites++;
 }
 
 /* This is checked by the main loop to determine when to checkpoint */
@@ -229,6 +285,8 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
     INT4 Nskip = LALInferenceGetINT4Variable(algorithm_params, "skip");
     INT4 temp_skip = LALInferenceGetINT4Variable(algorithm_params, "tskip");
     INT4 adapt_temps = LALInferenceGetINT4Variable(algorithm_params, "adapt_temps");
+    INT4 async_swaps = LALInferenceGetINT4Variable(algorithm_params, "async_swaps");
+    INT4 checkpoint_increments = LALInferenceGetINT4Variable(algorithm_params, "checkpoint_increments");
     INT4 de_buffer_limit = LALInferenceGetINT4Variable(algorithm_params, "de_buffer_limit");
     INT4 randomseed = LALInferenceGetINT4Variable(algorithm_params, "random_seed");
 
@@ -250,6 +308,13 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
     if (runState->threads[0].differentialPoints == NULL)
         diffEvo = 0;
 
+    /* Ladder adaptation gathers the whole ladder on the root every swap */
+    if (async_swaps && adapt_temps && MPIsize > 1) {
+        if (MPIrank == 0)
+            fprintf(stderr, "WARNING: --adapt-temps needs collective communication, not adapting the ladder with --async-swaps.\n");
+        adapt_temps = 0;
+    }
+
     /* Adaptation settings */
     INT4 no_adapt = LALInferenceGetINT4Variable(runState->algorithmParams, "no_adapt");
     INT4 adaptTau = LALInferenceGetINT4Variable(runState->algorithmParams, "adaptTau");
@@ -330,6 +395,11 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
     }
     LALInferenceNameOutputs(runState);
     LALInferenceResumeMCMC(runState);
+
+    /* The parameter set is fixed from here on; compile it so that the copies
+     * made by every proposal and acceptance are flat memcpys */
+    for (t = 0; t < n_local_threads; t++)
+        LALInferenceCompileVariables(runState->threads[t].currentParams);
     
     if (benchmark) {
         struct timeval start_tv;
@@ -367,6 +437,9 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
         install_resume_handler(CondorExitCode);
     }
 
+    if (async_swaps)
+        PTswapAsyncInit(runState);
+
     fflush(stdout);
     MPI_Barrier(MPI_COMM_WORLD);
 
@@ -383,6 +456,10 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
 
             thread = &runState->threads[t];
 
+            /* Leave a chain offered for an asynchronous swap untouched */
+            if (t == 0 && ptAsync.pending)
+                continue;
+
             for (i=0; i<temp_skip; i++) {
                 /* Increment iteration counter */
                 thread->step += 1;
@@ -459,8 +536,12 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
                     local_saveStateFlag=__master_saveStateFlag;
                     local_exitFlag=__master_exitFlag;
 		}
-		MPI_Bcast(&local_saveStateFlag, 1, MPI_INT, 0, MPI_COMM_WORLD);
-		MPI_Bcast(&local_exitFlag, 1, MPI_INT, 0, MPI_COMM_WORLD);
+		if (async_swaps)
+		    PTswapAsyncControl(MPIrank, MPIsize, &local_saveStateFlag, &local_exitFlag, &runComplete);
+		else {
+		    MPI_Bcast(&local_saveStateFlag, 1, MPI_INT, 0, MPI_COMM_WORLD);
+		    MPI_Bcast(&local_exitFlag, 1, MPI_INT, 0, MPI_COMM_WORLD);
+		}
         INT4 saveattempts=0;
         INT4 retrydelay=5; /* 5 seconds before initial retry */
         INT4 retcode=XLAL_SUCCESS;
@@ -469,6 +550,11 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
          */
 		if(local_saveStateFlag!=0)
 		{
+            /* A state on offer to the rank below may already have been
+             * swapped into it: settle the offers so that every state is
+             * written to exactly one checkpoint */
+            if (async_swaps)
+                PTswapAsyncSettle(runState);
             do
             {
                 XLAL_TRY(LALInferenceCheckpointMCMC(runState), retcode);
@@ -482,18 +568,22 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
             } while (retcode!=XLAL_SUCCESS && saveattempts<10);
             if(retcode!=XLAL_SUCCESS) {fprintf(stderr,"Process %i failed to checkpoint\n", MPIrank);}
             saveattempts=0;
-            do
+            /* Incremental checkpoints carry the new samples themselves */
+            if (!checkpoint_increments)
             {
-                XLAL_TRY(LALInferenceWriteMCMCSamples(runState), retcode);
-                if(retcode!=XLAL_SUCCESS) 
+                do
                 {
-                    saveattempts+=1;
-                    fprintf(stderr,"Process %i failed to write samples file %s \
-                    at attempt %i, waiting to retry\n",MPIrank, runState->outFileName, saveattempts);
-                    sleep(retrydelay*saveattempts); /* In case of IO failure wait progressively longer */
-                }
-            } while (retcode!=XLAL_SUCCESS && saveattempts<10);
-            if(retcode!=XLAL_SUCCESS) {fprintf(stderr,"Process %i failed to checkpoint\n", MPIrank);}
+                    XLAL_TRY(LALInferenceWriteMCMCSamples(runState), retcode);
+                    if(retcode!=XLAL_SUCCESS) 
+                    {
+                        saveattempts+=1;
+                        fprintf(stderr,"Process %i failed to write samples file %s \
+                        at attempt %i, waiting to retry\n",MPIrank, runState->outFileName, saveattempts);
+                        sleep(retrydelay*saveattempts); /* In case of IO failure wait progressively longer */
+                    }
+                } while (retcode!=XLAL_SUCCESS && saveattempts<10);
+                if(retcode!=XLAL_SUCCESS) {fprintf(stderr,"Process %i failed to checkpoint\n", MPIrank);}
+            }
             /* Wait for all processes to save */
 			MPI_Barrier(MPI_COMM_WORLD);
 			__master_saveStateFlag=0;
@@ -523,7 +613,7 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
             fclose(verbose_file);
 
         /* Check if run should end */
-        if (runState->threads[0].step > Niter)
+        if (runState->threads[0].step > Niter && (!async_swaps || MPIrank == 0))
             runComplete=1;
 
         /* Have the cold chain decide when to compute ACLs, and calculate for all chains.  This is done
@@ -560,8 +650,13 @@ void PTMCMCAlgorithm(struct tagLALInferenceRunState *runState) {
         }
 
         /* Broadcast the root's decision on run completion */
-        MPI_Bcast(&runComplete, 1, MPI_INT, 0, MPI_COMM_WORLD);
+        if (async_swaps)
+            PTswapAsyncControl(MPIrank, MPIsize, &local_saveStateFlag, &local_exitFlag, &runComplete);
+        else
+            MPI_Bcast(&runComplete, 1, MPI_INT, 0, MPI_COMM_WORLD);
     }// while (!runComplete)
+    if (async_swaps)
+        LALInferenceFlushPTswap(runState);
     LALInferenceWriteMCMCSamples(runState);
     MPI_Barrier(MPI_COMM_WORLD);
 }
@@ -764,6 +859,57 @@ void LALInferenceAdaptLadder(LALInferenceRunState *runState) {
 //-----------------------------------------
 // Swap routines:
 //-----------------------------------------
+
+/* Propose a swap between two neighbouring chains held by this rank */
+static void PTswapLocal(LALInferenceRunState *runState, INT4 cold_ind, INT4 hot_ind, FILE *swapfile) {
+    INT4 n_local_threads = runState->nthreads;
+    INT4 swapAccepted;
+    REAL8 logThreadSwap, temp_prior, temp_like;
+    LALInferenceThreadState *cold_thread, *hot_thread;
+    LALInferenceVariables *temp_params;
+
+    cold_thread = &runState->threads[cold_ind % n_local_threads];
+    hot_thread = &runState->threads[hot_ind % n_local_threads];
+
+    /* Determine if swap is accepted and tell the other chain */
+    logThreadSwap = 1.0/cold_thread->temperature - 1.0/hot_thread->temperature;
+    logThreadSwap *= hot_thread->currentLikelihood - cold_thread->currentLikelihood;
+
+    if ((logThreadSwap > 0) || (log(gsl_rng_uniform(runState->GSLrandom)) < logThreadSwap ))
+        swapAccepted = 1;
+    else
+        swapAccepted = 0;
+    cold_thread->temp_swap_accepts[cold_thread->temp_swap_counter] = swapAccepted;
+    cold_thread->temp_swap_counter = (cold_thread->temp_swap_counter + 1) % cold_thread->temp_swap_window;
+
+    /* Print to file if verbose is chosen */
+    if (swapfile != NULL) {
+        REAL8 acc_frac = 0.0;
+        for (INT4 i=0; i<cold_thread->temp_swap_window; i++)
+            acc_frac += (REAL8)cold_thread->temp_swap_accepts[i] / cold_thread->temp_swap_window;
+        cold_thread->temp_swap_accepts[cold_thread->temp_swap_counter % cold_thread->temp_swap_window] = swapAccepted;
+        fprintf(swapfile, "%d\t%d\t%f\t%d\t%f\t%f\t%f\t%f\t%i\t%f\n",
+                cold_thread->step, cold_ind, cold_thread->temperature,
+                hot_ind, hot_thread->temperature,
+                logThreadSwap, cold_thread->currentLikelihood,
+                hot_thread->currentLikelihood, swapAccepted, acc_frac);
+    }
+
+    if (swapAccepted) {
+        temp_params = hot_thread->currentParams;
+        temp_prior = hot_thread->currentPrior;
+        temp_like = hot_thread->currentLikelihood;
+
+        hot_thread->currentParams = cold_thread->currentParams;
+        hot_thread->currentPrior = cold_thread->currentPrior;
+        hot_thread->currentLikelihood = cold_thread->currentLikelihood;
+
+        cold_thread->currentParams = temp_params;
+        cold_thread->currentPrior = temp_prior;
+        cold_thread->currentLikelihood = temp_like;
+    }
+}
+
 void LALInferencePTswap(LALInferenceRunState *runState, FILE *swapfile) {
     INT4 MPIrank, MPIsize;
     MPI_Status MPIstatus;
@@ -774,10 +920,9 @@ void LALInferencePTswap(LALInferenceRunState *runState, FILE *swapfile) {
     INT4 swapAccepted;
     INT4 *cold_inds;
     REAL8 adjCurrentLikelihood, adjCurrentPrior;
-    REAL8 logThreadSwap, temp_prior, temp_like, cold_temp;
+    REAL8 logThreadSwap, cold_temp;
     LALInferenceThreadState *cold_thread = &runState->threads[0];
     LALInferenceThreadState *hot_thread;
-    LALInferenceVariables *temp_params;
 
     MPI_Comm_rank(MPI_COMM_WORLD, &MPIrank);
     MPI_Comm_size(MPI_COMM_WORLD, &MPIsize);
@@ -810,49 +955,8 @@ void LALInferencePTswap(LALInferenceRunState *runState, FILE *swapfile) {
         hot_rank = hot_ind/n_local_threads;
 
         if (cold_rank == hot_rank) {
-            if (MPIrank == cold_rank) {
-                cold_thread = &runState->threads[cold_ind % n_local_threads];
-                hot_thread = &runState->threads[hot_ind % n_local_threads];
-
-                /* Determine if swap is accepted and tell the other chain */
-                logThreadSwap = 1.0/cold_thread->temperature - 1.0/hot_thread->temperature;
-                logThreadSwap *= hot_thread->currentLikelihood - cold_thread->currentLikelihood;
-
-                if ((logThreadSwap > 0) || (log(gsl_rng_uniform(runState->GSLrandom)) < logThreadSwap ))
-                    swapAccepted = 1;
-                else
-                    swapAccepted = 0;
-                cold_thread->temp_swap_accepts[cold_thread->temp_swap_counter] = swapAccepted;
-                cold_thread->temp_swap_counter = (cold_thread->temp_swap_counter + 1) % cold_thread->temp_swap_window;
-
-                /* Print to file if verbose is chosen */
-                if (swapfile != NULL) {
-                    REAL8 acc_frac = 0.0;
-                    for (INT4 i=0; i<cold_thread->temp_swap_window; i++)
-                        acc_frac += (REAL8)cold_thread->temp_swap_accepts[i] / cold_thread->temp_swap_window;
-                    cold_thread->temp_swap_accepts[cold_thread->temp_swap_counter % cold_thread->temp_swap_window] = swapAccepted;
-                    fprintf(swapfile, "%d\t%d\t%f\t%d\t%f\t%f\t%f\t%f\t%i\t%f\n",
-                            cold_thread->step, cold_ind, cold_thread->temperature,
-                            hot_ind, hot_thread->temperature,
-                            logThreadSwap, cold_thread->currentLikelihood,
-                            hot_thread->currentLikelihood, swapAccepted, acc_frac);
-                }
-
-                if (swapAccepted) {
-                    temp_params = hot_thread->currentParams;
-                    temp_prior = hot_thread->currentPrior;
-                    temp_like = hot_thread->currentLikelihood;
-
-                    hot_thread->currentParams = cold_thread->currentParams;
-                    hot_thread->currentPrior = cold_thread->currentPrior;
-                    hot_thread->currentLikelihood = cold_thread->currentLikelihood;
-
-                    cold_thread->currentParams = temp_params;
-                    cold_thread->currentPrior = temp_prior;
-                    cold_thread->currentLikelihood = temp_like;
-                }
-
-            }
+            if (MPIrank == cold_rank)
+                PTswapLocal(runState, cold_ind, hot_ind, swapfile);
         } else {
             if (MPIrank == cold_rank) {
                 cold_thread = &runState->threads[cold_ind % n_local_threads];
@@ -960,6 +1064,245 @@ void LALInferencePTswap(LALInferenceRunState *runState, FILE *swapfile) {
     return;
 }
 
+/* Pack a decision or temperature, likelihood, prior and parameters of a chain */
+static void PTswapAsyncPack(REAL8 *buffer, REAL8 head, LALInferenceThreadState *thread) {
+    buffer[0] = head;
+    buffer[1] = thread->currentLikelihood;
+    buffer[2] = thread->currentPrior;
+    LALInferenceCopyVariablesToArray(thread->currentParams, &buffer[3]);
+}
+
+static void PTswapAsyncUnpack(REAL8 *buffer, LALInferenceThreadState *thread) {
+    thread->currentLikelihood = buffer[1];
+    thread->currentPrior = buffer[2];
+    LALInferenceCopyArrayToVariables(&buffer[3], thread->currentParams);
+}
+
+static void PTswapAsyncInit(LALInferenceRunState *runState) {
+    INT4 MPIsize, r;
+
+    if (ptAsync.initialised)
+        return;
+
+    MPI_Comm_size(MPI_COMM_WORLD, &MPIsize);
+
+    ptAsync.length = LALInferenceGetVariableDimensionNonFixed(runState->threads[0].currentParams) + 3;
+    ptAsync.offerOut = XLALCalloc(ptAsync.length, sizeof(REAL8));
+    ptAsync.offerIn = XLALCalloc(ptAsync.length, sizeof(REAL8));
+    ptAsync.replyOut = XLALCalloc(ptAsync.length, sizeof(REAL8));
+    ptAsync.replyIn = XLALCalloc(ptAsync.length, sizeof(REAL8));
+    ptAsync.offerRequest = MPI_REQUEST_NULL;
+    ptAsync.replyRequest = MPI_REQUEST_NULL;
+    ptAsync.controlRequests = XLALCalloc(MPIsize, sizeof(MPI_Request));
+    for (r = 0; r < MPIsize; r++)
+        ptAsync.controlRequests[r] = MPI_REQUEST_NULL;
+    ptAsync.pending = ptAsync.offers = ptAsync.answers = 0;
+    ptAsync.initialised = 1;
+}
+
+/* Receive an offer from the rank above and answer it with the state of our
+ * last chain.  When flushing at the end of the run every offer is refused. */
+static void PTswapAsyncAnswer(LALInferenceRunState *runState, INT4 flush, FILE *swapfile) {
+    INT4 MPIrank, n_local_threads = runState->nthreads;
+    INT4 cold_ind, swapAccepted = 0;
+    REAL8 logThreadSwap;
+    LALInferenceThreadState *cold_thread = &runState->threads[n_local_threads-1];
+    MPI_Status MPIstatus;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &MPIrank);
+    cold_ind = MPIrank*n_local_threads + n_local_threads-1;
+
+    MPI_Recv(ptAsync.offerIn, ptAsync.length, MPI_DOUBLE, MPIrank+1, PT_ASYNC_OFFER_COM, MPI_COMM_WORLD, &MPIstatus);
+
+    logThreadSwap = 1.0/cold_thread->temperature - 1.0/ptAsync.offerIn[0];
+    logThreadSwap *= ptAsync.offerIn[1] - cold_thread->currentLikelihood;
+    if (!flush) {
+        if ((logThreadSwap > 0) || (log(gsl_rng_uniform(runState->GSLrandom)) < logThreadSwap ))
+            swapAccepted = 1;
+        cold_thread->temp_swap_accepts[cold_thread->temp_swap_counter] = swapAccepted;
+        cold_thread->temp_swap_counter = (cold_thread->temp_swap_counter + 1) % cold_thread->temp_swap_window;
+
+        if (swapfile != NULL) {
+            REAL8 acc_frac = 0.0;
+            for (INT4 i=0; i<cold_thread->temp_swap_window; i++)
+                acc_frac += (REAL8)cold_thread->temp_swap_accepts[i] / cold_thread->temp_swap_window;
+            fprintf(swapfile, "%d\t%d\t%f\t%d\t%f\t%f\t%f\t%f\t%i\t%f\n",
+                    cold_thread->step, cold_ind, cold_thread->temperature,
+                    cold_ind+1, ptAsync.offerIn[0],
+                    logThreadSwap, cold_thread->currentLikelihood,
+                    ptAsync.offerIn[1], swapAccepted, acc_frac);
+        }
+    }
+
+    /* The rank above has collected our previous answer before making this offer */
+    MPI_Wait(&ptAsync.replyRequest, MPI_STATUS_IGNORE);
+    PTswapAsyncPack(ptAsync.replyOut, (REAL8)swapAccepted, cold_thread);
+    MPI_Isend(ptAsync.replyOut, ptAsync.length, MPI_DOUBLE, MPIrank+1, PT_ASYNC_REPLY_COM, MPI_COMM_WORLD, &ptAsync.replyRequest);
+
+    if (swapAccepted)
+        PTswapAsyncUnpack(ptAsync.offerIn, cold_thread);
+    ptAsync.answers++;
+}
+
+/* Receive the answer to the offer made by threads[0] and release the chain */
+static void PTswapAsyncCollect(LALInferenceRunState *runState) {
+    INT4 MPIrank;
+    MPI_Status MPIstatus;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &MPIrank);
+
+    MPI_Recv(ptAsync.replyIn, ptAsync.length, MPI_DOUBLE, MPIrank-1, PT_ASYNC_REPLY_COM, MPI_COMM_WORLD, &MPIstatus);
+    MPI_Wait(&ptAsync.offerRequest, MPI_STATUS_IGNORE);
+
+    if (ptAsync.replyIn[0] != 0.0)
+        PTswapAsyncUnpack(ptAsync.replyIn, &runState->threads[0]);
+    ptAsync.pending = 0;
+}
+
+/**
+ * Parallel tempering swaps that never wait for another rank.  Neighbouring
+ * chains on this rank are swapped as in LALInferencePTswap().  Across the
+ * boundary between two ranks the hotter chain sends its state to the rank
+ * below, which answers at its next swap interval by polling for offers; the
+ * offering chain is not evolved until the answer has been collected.  Only
+ * point-to-point, non-blocking messages are used, so a slow rank delays its
+ * two boundary chains and nothing else.
+ */
+void LALInferencePTswapAsync(LALInferenceRunState *runState, FILE *swapfile) {
+    INT4 MPIrank, MPIsize;
+    INT4 n_local_threads = runState->nthreads;
+    INT4 t, flag;
+    MPI_Status MPIstatus;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &MPIrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &MPIsize);
+
+    PTswapAsyncInit(runState);
+
+    /* Swaps between the chains of this rank, in random order */
+    if (n_local_threads > 1) {
+        INT4 *cold_inds = XLALCalloc(n_local_threads-1, sizeof(INT4));
+        for (t = 0; t < n_local_threads-1; t++)
+            cold_inds[t] = t;
+        gsl_ran_shuffle(runState->GSLrandom, cold_inds, n_local_threads-1, sizeof(INT4));
+
+        for (t = 0; t < n_local_threads-1; t++) {
+            /* A chain offered to the rank below must keep its state */
+            if (cold_inds[t] == 0 && ptAsync.pending)
+                continue;
+            PTswapLocal(runState, MPIrank*n_local_threads + cold_inds[t],
+                        MPIrank*n_local_threads + cold_inds[t]+1, swapfile);
+        }
+        XLALFree(cold_inds);
+    }
+
+    /* Answer an offer from the rank above, unless our coldest chain is itself on offer */
+    if (MPIrank < MPIsize-1 && !(n_local_threads == 1 && ptAsync.pending)) {
+        MPI_Iprobe(MPIrank+1, PT_ASYNC_OFFER_COM, MPI_COMM_WORLD, &flag, &MPIstatus);
+        if (flag)
+            PTswapAsyncAnswer(runState, 0, swapfile);
+    }
+
+    /* Collect the answer to our offer, or offer threads[0] to the rank below */
+    if (MPIrank > 0) {
+        if (ptAsync.pending) {
+            MPI_Iprobe(MPIrank-1, PT_ASYNC_REPLY_COM, MPI_COMM_WORLD, &flag, &MPIstatus);
+            if (flag)
+                PTswapAsyncCollect(runState);
+        } else {
+            LALInferenceThreadState *hot_thread = &runState->threads[0];
+            PTswapAsyncPack(ptAsync.offerOut, hot_thread->temperature, hot_thread);
+            MPI_Isend(ptAsync.offerOut, ptAsync.length, MPI_DOUBLE, MPIrank-1, PT_ASYNC_OFFER_COM, MPI_COMM_WORLD, &ptAsync.offerRequest);
+            ptAsync.offers++;
+            ptAsync.pending = 1;
+        }
+    }
+
+    return;
+}
+
+/* Exchange checkpoint, exit and completion requests without collective calls:
+ * the root sends them to every rank, the other ranks poll for them. */
+static void PTswapAsyncControl(INT4 MPIrank, INT4 MPIsize, INT4 *saveStateFlag, INT4 *exitFlag, INT4 *runComplete) {
+    INT4 r, flag;
+    MPI_Status MPIstatus;
+
+    if (MPIsize == 1)
+        return;
+
+    if (MPIrank == 0) {
+        if (!*saveStateFlag && !*exitFlag && !*runComplete)
+            return;
+        MPI_Waitall(MPIsize-1, &ptAsync.controlRequests[1], MPI_STATUSES_IGNORE);
+        ptAsync.control[0] = *saveStateFlag;
+        ptAsync.control[1] = *exitFlag;
+        ptAsync.control[2] = *runComplete;
+        for (r = 1; r < MPIsize; r++)
+            MPI_Isend(ptAsync.control, 3, MPI_INT, r, PT_ASYNC_CONTROL_COM, MPI_COMM_WORLD, &ptAsync.controlRequests[r]);
+    } else {
+        MPI_Iprobe(0, PT_ASYNC_CONTROL_COM, MPI_COMM_WORLD, &flag, &MPIstatus);
+        if (flag) {
+            MPI_Recv(ptAsync.control, 3, MPI_INT, 0, PT_ASYNC_CONTROL_COM, MPI_COMM_WORLD, &MPIstatus);
+            *saveStateFlag |= ptAsync.control[0];
+            *exitFlag |= ptAsync.control[1];
+            *runComplete |= ptAsync.control[2];
+        }
+    }
+}
+
+/**
+ * Settle the asynchronous swaps still in flight, before a checkpoint and at
+ * the end of the run.  Each rank tells the rank below how many offers it has
+ * made, collects the answer to any outstanding one, and then refuses the
+ * offers of the rank above that it has not answered yet.  Ranks finish in
+ * order from the root upwards.
+ */
+static void PTswapAsyncSettle(LALInferenceRunState *runState) {
+    INT4 MPIrank, MPIsize, offers;
+    MPI_Status MPIstatus;
+
+    if (!ptAsync.initialised)
+        return;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &MPIrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &MPIsize);
+
+    if (MPIrank > 0) {
+        MPI_Send(&ptAsync.offers, 1, MPI_INT, MPIrank-1, PT_ASYNC_FLUSH_COM, MPI_COMM_WORLD);
+        if (ptAsync.pending)
+            PTswapAsyncCollect(runState);
+    }
+
+    if (MPIrank < MPIsize-1) {
+        MPI_Recv(&offers, 1, MPI_INT, MPIrank+1, PT_ASYNC_FLUSH_COM, MPI_COMM_WORLD, &MPIstatus);
+        while (ptAsync.answers < offers)
+            PTswapAsyncAnswer(runState, 1, NULL);
+        MPI_Wait(&ptAsync.replyRequest, MPI_STATUS_IGNORE);
+    }
+}
+
+/* Settle the asynchronous swaps at the end of the run and free their buffers */
+void LALInferenceFlushPTswap(LALInferenceRunState *runState) {
+    INT4 MPIrank, MPIsize;
+
+    if (!ptAsync.initialised)
+        return;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &MPIrank);
+    MPI_Comm_size(MPI_COMM_WORLD, &MPIsize);
+    PTswapAsyncSettle(runState);
+
+    if (MPIrank == 0)
+        MPI_Waitall(MPIsize-1, &ptAsync.controlRequests[1], MPI_STATUSES_IGNORE);
+
+    XLALFree(ptAsync.offerOut);
+    XLALFree(ptAsync.offerIn);
+    XLALFree(ptAsync.replyOut);
+    XLALFree(ptAsync.replyIn);
+    XLALFree(ptAsync.controlRequests);
+    memset(&ptAsync, 0, sizeof(ptAsync));
+}
+
 
 // UINT4 LALInferenceMCMCMCswap(LALInferenceRunState *runState, REAL8 *ladder, INT4 i, FILE *swapfile) {
 //     INT4 MPIrank;
@@ -1301,16 +1644,245 @@ void LALInferenceResumeMCMC(LALInferenceRunState *runState) {
     return;
 }
 
-/* Store the MCMC run state to HDF5 for use by --resume */
+/* Number of samples in the output array of a chain */
+static UINT4 MCMCChainSampleCount(LALInferenceThreadState *thread) {
+    if (LALInferenceCheckVariable(thread->algorithmParams, "N_outputarray"))
+        return *(UINT4 *)LALInferenceGetVariable(thread->algorithmParams, "N_outputarray");
+    return 0;
+}
+
+/* Record everything currently held by the chains as checkpointed */
+static void MCMCCheckpointMark(LALInferenceRunState *runState) {
+    INT4 t;
+
+    if (mcmcCheckpoint.nthreads != runState->nthreads) {
+        mcmcCheckpoint.nthreads = runState->nthreads;
+        mcmcCheckpoint.deMark = XLALRealloc(mcmcCheckpoint.deMark, runState->nthreads * sizeof(UINT4));
+        mcmcCheckpoint.sampleMark = XLALRealloc(mcmcCheckpoint.sampleMark, runState->nthreads * sizeof(UINT4));
+    }
+
+    for (t = 0; t < runState->nthreads; t++) {
+        mcmcCheckpoint.deMark[t] = runState->threads[t].differentialPointsLength;
+        mcmcCheckpoint.sampleMark[t] = MCMCChainSampleCount(&runState->threads[t]);
+    }
+    mcmcCheckpoint.deRewritesMark = mcmcCheckpoint.deRewrites;
+}
+
+/* Write the parts of a chain's state that are stored in full at every checkpoint */
+static void writeMCMCChainState(LALH5File *chain_group, LALInferenceThreadState *thread) {
+    INT4 i;
+
+    LALInferenceH5VariablesArrayToDataset(chain_group, &(thread->proposalArgs), 1, "proposal_arguments");
+    LALInferenceH5VariablesArrayToDataset(chain_group, &(thread->currentParams), 1, "current_parameters");
+    XLALH5FileAddScalarAttribute(chain_group, "temperature", &(thread->temperature), LAL_D_TYPE_CODE);
+    XLALH5FileAddScalarAttribute(chain_group, "last_step", &(thread->step), LAL_I4_TYPE_CODE);
+    XLALH5FileAddScalarAttribute(chain_group, "effective_sample_size", &(thread->effective_sample_size), LAL_I4_TYPE_CODE);
+    XLALH5FileAddScalarAttribute(chain_group, "differential_point_skip", &(thread->differentialPointsSkip), LAL_I4_TYPE_CODE);
+
+    /* Store the total number of temperature swaps accepted over the stored window */
+    REAL8 temp_acc_rate = 0;
+    for (i=0; i<thread->temp_swap_window; i++)
+        temp_acc_rate += thread->temp_swap_accepts[i];
+    temp_acc_rate /= thread->temp_swap_window;
+    XLALH5FileAddScalarAttribute(chain_group, "temperature_swap_acceptance_rate", &(temp_acc_rate), LAL_D_TYPE_CODE);
+}
+
+/* Restore the state written by writeMCMCChainState, returning the temperature swap acceptance rate */
+static REAL8 readMCMCChainState(LALH5File *chain_group, LALInferenceThreadState *thread) {
+    UINT4 n, k;
+
+    /* Restore proposal arguments, most importantly adaptation settings */
+    LALInferenceVariables **propArgs;
+    LALH5Dataset *prop_arg_group = XLALH5DatasetRead(chain_group, "proposal_arguments");
+    LALInferenceH5DatasetToVariablesArray(prop_arg_group, &propArgs, &n);
+    LALInferenceCopyVariables(propArgs[0], thread->proposalArgs);
+    for (k=0;k<n;k++)
+        LALInferenceClearVariables(propArgs[k]);
+    XLALFree(propArgs);
+
+    /* We don't save strings, so we can't tell which parameter was last updated with adaptation.
+     * So we'll treat the last step as non-adaptable */
+    INT4 adaptable_step = 0;
+    LALInferenceSetVariable(thread->proposalArgs, "adaptableStep", &adaptable_step);
+
+    /* Restore the parameters of the last sample */
+    LALInferenceVariables **currentParams;
+    LALH5Dataset *current_param_group = XLALH5DatasetRead(chain_group, "current_parameters");
+    LALInferenceH5DatasetToVariablesArray(current_param_group, &currentParams, &n);
+    LALInferenceCopyVariables(currentParams[0], thread->currentParams);
+    for (k=0;k<n;k++)
+        LALInferenceClearVariables(currentParams[k]);
+    XLALFree(currentParams);
+
+    /* Recover the estimated effective sample size, iteration number, and DE buffer thinning multiplier */
+    XLALH5FileQueryScalarAttributeValue(&(thread->effective_sample_size), chain_group, "effective_sample_size");
+    XLALH5FileQueryScalarAttributeValue(&(thread->temperature), chain_group, "temperature");
+    XLALH5FileQueryScalarAttributeValue(&(thread->step), chain_group, "last_step");
+    XLALH5FileQueryScalarAttributeValue(&(thread->differentialPointsSkip), chain_group, "differential_point_skip");
+
+    REAL8 temp_acc_rate;
+    XLALH5FileQueryScalarAttributeValue(&(temp_acc_rate), chain_group, "temperature_swap_acceptance_rate");
+
+    XLALH5DatasetFree(current_param_group);
+    XLALH5DatasetFree(prop_arg_group);
+
+    return temp_acc_rate;
+}
+
+/* Write the changes since the last checkpoint to the next increment file */
+static void writeMCMCCheckpointIncrement(LALInferenceRunState *runState) {
+    INT4 t;
+    UINT4 n = mcmcCheckpoint.increments + 1;
+    char filename[FILENAME_MAX];
+    LALH5File *increment_file = NULL;
+    LALInferenceThreadState *thread;
+
+    if (LALInferenceCheckpointIncrementName(filename, sizeof(filename), runState->resumeOutFileName, n) != XLAL_SUCCESS)
+        XLAL_ERROR_VOID(XLAL_EFUNC);
+
+    increment_file = XLALH5FileOpen(filename, "w");
+    if (increment_file == NULL)
+        XLAL_ERROR_VOID(XLAL_EIO, "Unable to open checkpoint increment %s", filename);
+
+    LALH5File *group = LALInferenceH5CreateGroupStructure(increment_file, "lalinference", runState->runID);
+    XLALH5FileAddScalarAttribute(group, "checkpoint_generation", &(mcmcCheckpoint.generation), LAL_I4_TYPE_CODE);
+
+    for (t = 0; t < runState->nthreads; t++) {
+        thread = &runState->threads[t];
+
+        char chain_group_name[1024];
+        snprintf(chain_group_name, sizeof(chain_group_name), "%s-checkpoint", thread->name);
+        LALH5File *chain_group = XLALH5GroupOpen(group, chain_group_name);
+
+        LALInferenceH5CheckpointIncrementToDataset(chain_group, thread->differentialPoints, mcmcCheckpoint.deMark[t], thread->differentialPointsLength, "differential_points");
+
+        UINT4 N_output_array = MCMCChainSampleCount(thread);
+        if (N_output_array > 0) {
+            LALInferenceVariables **output_array = *(LALInferenceVariables ***)LALInferenceGetVariable(thread->algorithmParams, "outputarray");
+            LALInferenceH5CheckpointIncrementToDataset(chain_group, output_array, mcmcCheckpoint.sampleMark[t], N_output_array, "chain_samples");
+        }
+
+        writeMCMCChainState(chain_group, thread);
+        XLALH5FileClose(chain_group);
+    }
+    XLALH5FileClose(group);
+
+    XLALH5FileClose(increment_file);
+    LALInferencePrintCheckpointFileInfo(filename);
+
+    mcmcCheckpoint.increments = n;
+    MCMCCheckpointMark(runState);
+}
+
+/* Apply the increments written after the full checkpoint of the given
+ * generation.  Increments that are stale or do not follow on are removed. */
+static void readMCMCCheckpointIncrements(LALInferenceRunState *runState, INT4 generation, REAL8 *temp_acc_rates) {
+    INT4 t, retcode = XLAL_SUCCESS;
+    UINT4 n, k, N;
+    char filename[FILENAME_MAX];
+    LALInferenceVariables **array;
+    LALInferenceThreadState *thread;
+
+    for (n = 1; ; n++) {
+        LALH5File *increment_file = NULL;
+        INT4 file_generation = -1;
+        INT4 gap = 0;
+
+        if (LALInferenceCheckpointIncrementName(filename, sizeof(filename), runState->resumeOutFileName, n) != XLAL_SUCCESS)
+            break;
+        if (access(filename, R_OK) != 0)
+            break;
+        XLAL_TRY(increment_file = XLALH5FileOpen(filename, "r"), retcode);
+        if (retcode != XLAL_SUCCESS || increment_file == NULL) {
+            fprintf(stderr, "Checkpoint increment %s is not valid HDF5, ignoring it\n", filename);
+            break;
+        }
+
+        LALH5File *li_group = XLALH5GroupOpen(increment_file, "lalinference");
+        LALH5File *group = XLALH5GroupOpen(li_group, runState->runID);
+        XLAL_TRY(XLALH5FileQueryScalarAttributeValue(&file_generation, group, "checkpoint_generation"), retcode);
+
+        for (t = 0; t < runState->nthreads && file_generation == generation && !gap; t++) {
+            thread = &runState->threads[t];
+
+            char chain_group_name[1024];
+            snprintf(chain_group_name, sizeof(chain_group_name), "%s-checkpoint", thread->name);
+            LALH5File *chain_group = XLALH5GroupOpen(group, chain_group_name);
+
+            /* Extend the differential evolution buffer */
+            XLAL_TRY(gap = LALInferenceH5CheckpointIncrementToVariablesArray(chain_group, "differential_points", thread->differentialPointsLength, &array, &N), retcode);
+            if (!gap && N > 0) {
+                thread->differentialPoints = XLALRealloc(thread->differentialPoints, (thread->differentialPointsLength + N) * sizeof(LALInferenceVariables *));
+                memcpy(thread->differentialPoints + thread->differentialPointsLength, array, N * sizeof(LALInferenceVariables *));
+                thread->differentialPointsLength += N;
+                thread->differentialPointsSize = thread->differentialPointsLength;
+            }
+            XLALFree(array);
+
+            /* Extend the chain */
+            if (!gap) {
+                XLAL_TRY(gap = LALInferenceH5CheckpointIncrementToVariablesArray(chain_group, "chain_samples", MCMCChainSampleCount(thread), &array, &N), retcode);
+                for (k = 0; k < N; k++) {
+                    LALInferenceLogSampleToArray(thread->algorithmParams, array[k]);
+                    LALInferenceClearVariables(array[k]);
+                    XLALFree(array[k]);
+                }
+                XLALFree(array);
+            }
+
+            if (!gap)
+                temp_acc_rates[t] = readMCMCChainState(chain_group, thread);
+            XLALH5FileClose(chain_group);
+        }
+
+        XLALH5FileClose(group);
+        XLALH5FileClose(li_group);
+        XLALH5FileClose(increment_file);
+
+        if (file_generation != generation || gap) {
+            fprintf(stderr, "Checkpoint increment %s does not follow on from %s, ignoring it\n", filename, runState->resumeOutFileName);
+            break;
+        }
+        fprintf(stderr, "Resuming from increment %s\n", filename);
+    }
+
+    LALInferenceRemoveCheckpointIncrements(runState->resumeOutFileName, n);
+    mcmcCheckpoint.generation = generation;
+    mcmcCheckpoint.increments = n - 1;
+}
+
+/* Store the MCMC run state to HDF5 for use by --resume.  With
+ * checkpoint_increments set, only the changes since the last checkpoint are
+ * written until that many increments exist, or a differential evolution
+ * buffer has been thinned, after which the state is compacted into a full
+ * checkpoint again. */
 void LALInferenceCheckpointMCMC(LALInferenceRunState *runState) {
     //ProcessParamsTable *ppt;
-    INT4 i, t, n_local_threads;
+    INT4 t, n_local_threads;
     INT4 MPIrank;
+    INT4 max_increments = 0;
     LALH5File *resume_file = NULL;
     LALInferenceThreadState *thread;
 
     MPI_Comm_rank(MPI_COMM_WORLD, &MPIrank);
 
+    if (LALInferenceCheckVariable(runState->algorithmParams, "checkpoint_increments"))
+        max_increments = LALInferenceGetINT4Variable(runState->algorithmParams, "checkpoint_increments");
+
+    if (max_increments > 0 && mcmcCheckpoint.generation > 0 &&
+            mcmcCheckpoint.increments < (UINT4) max_increments &&
+            mcmcCheckpoint.deRewrites == mcmcCheckpoint.deRewritesMark) {
+        writeMCMCCheckpointIncrement(runState);
+        return;
+    }
+
+    /* The samples are only rewritten here when checkpointing incrementally;
+     * they go first so a crash cannot leave the resume file ahead of them */
+    if (max_increments > 0)
+        LALInferenceWriteMCMCSamples(runState);
+
+    INT4 generation = mcmcCheckpoint.generation + 1;
+
     resume_file = XLALH5FileOpen(runState->resumeOutFileName, "w");
     if(resume_file == NULL){
         XLALErrorHandler = XLALExitErrorHandler;
@@ -1319,6 +1891,7 @@ void LALInferenceCheckpointMCMC(LALInferenceRunState *runState) {
     }
 
     LALH5File *group = LALInferenceH5CreateGroupStructure(resume_file, "lalinference", runState->runID);
+    XLALH5FileAddScalarAttribute(group, "checkpoint_generation", &generation, LAL_I4_TYPE_CODE);
 
     n_local_threads = runState->nthreads;
     for (t = 0; t < n_local_threads; t++) {
@@ -1339,19 +1912,7 @@ void LALInferenceCheckpointMCMC(LALInferenceRunState *runState) {
 
         /* Create run identifier group */
         LALInferenceH5VariablesArrayToDataset(chain_group, thread->differentialPoints, thread->differentialPointsLength, "differential_points");
-        LALInferenceH5VariablesArrayToDataset(chain_group, &(thread->proposalArgs), 1, "proposal_arguments");
-        LALInferenceH5VariablesArrayToDataset(chain_group, &(thread->currentParams), 1, "current_parameters");
-        XLALH5FileAddScalarAttribute(chain_group, "temperature", &(thread->temperature), LAL_D_TYPE_CODE);
-        XLALH5FileAddScalarAttribute(chain_group, "last_step", &(thread->step), LAL_I4_TYPE_CODE);
-        XLALH5FileAddScalarAttribute(chain_group, "effective_sample_size", &(thread->effective_sample_size), LAL_I4_TYPE_CODE);
-        XLALH5FileAddScalarAttribute(chain_group, "differential_point_skip", &(thread->differentialPointsSkip), LAL_I4_TYPE_CODE);
-
-        /* Store the total number of temperature swaps accepted over the stored window */
-        REAL8 temp_acc_rate = 0;
-        for (i=0; i<thread->temp_swap_window; i++)
-            temp_acc_rate += thread->temp_swap_accepts[i];
-        temp_acc_rate /= thread->temp_swap_window;
-        XLALH5FileAddScalarAttribute(chain_group, "temperature_swap_acceptance_rate", &(temp_acc_rate), LAL_D_TYPE_CODE);
+        writeMCMCChainState(chain_group, thread);
 
         /* TODO: Write metadata */
         XLALH5FileClose(chain_group);
@@ -1361,6 +1922,12 @@ void LALInferenceCheckpointMCMC(LALInferenceRunState *runState) {
     XLALH5FileClose(resume_file);
     LALInferencePrintCheckpointFileInfo(runState->resumeOutFileName);
 
+    /* Increments of the previous generation are superseded */
+    LALInferenceRemoveCheckpointIncrements(runState->resumeOutFileName, 1);
+    mcmcCheckpoint.generation = generation;
+    mcmcCheckpoint.increments = 0;
+    MCMCCheckpointMark(runState);
+
     return;
 }
 
@@ -1368,11 +1935,12 @@ void LALInferenceCheckpointMCMC(LALInferenceRunState *runState) {
 void LALInferenceReadMCMCCheckpoint(LALInferenceRunState *runState) {
     //ProcessParamsTable *ppt;
     INT4 i, t, n_local_threads;
+    INT4 generation = 0;
     int retcode=0;
-    UINT4 n,k;
     LALH5File *resume_file = NULL;
     LALH5File *output = NULL;
     LALInferenceThreadState *thread;
+    REAL8 *temp_acc_rates;
     if(! (LALInferenceCheckNonEmptyFile(runState->resumeOutFileName) &&
           LALInferenceCheckNonEmptyFile(runState->outFileName) ) )
     {
@@ -1413,7 +1981,13 @@ void LALInferenceReadMCMCCheckpoint(LALInferenceRunState *runState) {
     LALH5File *li_group = XLALH5GroupOpen(resume_file, "lalinference");
     LALH5File *group = XLALH5GroupOpen(li_group, runState->runID);
 
+    /* Resume files written before incremental checkpointing have no generation */
+    XLAL_TRY(XLALH5FileQueryScalarAttributeValue(&generation, group, "checkpoint_generation"), retcode);
+    if (retcode != XLAL_SUCCESS)
+        generation = 0;
+
     n_local_threads = runState->nthreads;
+    temp_acc_rates = XLALCalloc(n_local_threads, sizeof(REAL8));
     for (t = 0; t < n_local_threads; t++) {
         thread = &runState->threads[t];
 
@@ -1430,55 +2004,9 @@ void LALInferenceReadMCMCCheckpoint(LALInferenceRunState *runState) {
             thread->differentialPointsSize = thread->differentialPointsLength;
         }
 
-        /* Restore proposal arguments, most importantly adaptation settings */
-        LALInferenceVariables **propArgs;
-        LALH5Dataset *prop_arg_group = XLALH5DatasetRead(chain_group, "proposal_arguments");
-        LALInferenceH5DatasetToVariablesArray(prop_arg_group, &propArgs, &n);
-        LALInferenceCopyVariables(propArgs[0], thread->proposalArgs);
-        for (k=0;k<n;k++)
-            LALInferenceClearVariables(propArgs[k]);
-        XLALFree(propArgs);
-
-        /* We don't save strings, so we can't tell which parameter was last updated with adaptation.
-         * So we'll treat the last step as non-adaptable */
-        INT4 adaptable_step = 0;
-        LALInferenceSetVariable(thread->proposalArgs, "adaptableStep", &adaptable_step);
-
-
-        /* Restore the parameters of the last sample */
-        LALInferenceVariables **currentParams;
-        LALH5Dataset *current_param_group = XLALH5DatasetRead(chain_group, "current_parameters");
-        LALInferenceH5DatasetToVariablesArray(current_param_group, &currentParams, &n);
-        LALInferenceCopyVariables(currentParams[0], thread->currentParams);
-        for (k=0;k<n;k++)
-            LALInferenceClearVariables(currentParams[k]);
-        XLALFree(currentParams);
-
-        /* Recalculate the likelihood and prior for the restored parameters */
-        thread->currentPrior = runState->prior(runState,
-                                               thread->currentParams,
-                                               thread->model);
-
-        thread->currentLikelihood = runState ->likelihood(thread->currentParams,
-                                                          runState->data,
-                                                          thread->model);
-
-        /* Recover the estimated effective sample size, iteration number, and DE buffer thinning multiplier */
-        XLALH5FileQueryScalarAttributeValue(&(thread->effective_sample_size), chain_group, "effective_sample_size");
-        XLALH5FileQueryScalarAttributeValue(&(thread->temperature), chain_group, "temperature");
-        XLALH5FileQueryScalarAttributeValue(&(thread->step), chain_group, "last_step");
-        XLALH5FileQueryScalarAttributeValue(&(thread->differentialPointsSkip), chain_group, "differential_point_skip");
-
-        /* Spread the count of accepted temp swaps at checkpoint evenly across the window */
-        REAL8 temp_acc_rate;
-        XLALH5FileQueryScalarAttributeValue(&(temp_acc_rate), chain_group, "temperature_swap_acceptance_rate");
-
-        for (i=0; i<thread->temp_swap_window; i++)
-            thread->temp_swap_accepts[i] = gsl_rng_uniform(thread->GSLrandom) < temp_acc_rate ? 1 : 0;
+        temp_acc_rates[t] = readMCMCChainState(chain_group, thread);
 
         /* TODO: Write metadata */
-        XLALH5DatasetFree(current_param_group);
-        XLALH5DatasetFree(prop_arg_group);
         XLALH5DatasetFree(de_group);
         XLALH5FileClose(chain_group);
     }
@@ -1515,6 +2043,28 @@ void LALInferenceReadMCMCCheckpoint(LALInferenceRunState *runState) {
     XLALH5FileClose(li_group);
     XLALH5FileClose(output);
 
+    /* Bring the chains up to the latest checkpoint */
+    readMCMCCheckpointIncrements(runState, generation, temp_acc_rates);
+    MCMCCheckpointMark(runState);
+
+    for (t = 0; t < n_local_threads; t++) {
+        thread = &runState->threads[t];
+
+        /* Recalculate the likelihood and prior for the restored parameters */
+        thread->currentPrior = runState->prior(runState,
+                                               thread->currentParams,
+                                               thread->model);
+
+        thread->currentLikelihood = runState ->likelihood(thread->currentParams,
+                                                          runState->data,
+                                                          thread->model);
+
+        /* Spread the count of accepted temp swaps at checkpoint evenly across the window */
+        for (i=0; i<thread->temp_swap_window; i++)
+            thread->temp_swap_accepts[i] = gsl_rng_uniform(thread->GSLrandom) < temp_acc_rates[t] ? 1 : 0;
+    }
+    XLALFree(temp_acc_rates);
+
     return;
 }
 
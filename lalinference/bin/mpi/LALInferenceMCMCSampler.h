@@ -54,7 +54,11 @@ typedef enum {
     PT_COM,          /** Parallel tempering communications */
     LADDER_UPDATE_COM,    /** Update positions across the ladder */
     RUN_PHASE_COM,   /** runPhase passing */
-    RUN_COMPLETE       /** Run complete */
+    RUN_COMPLETE,       /** Run complete */
+    PT_ASYNC_OFFER_COM,   /** Asynchronous swap offer to the rank below */
+    PT_ASYNC_REPLY_COM,   /** Answer to an asynchronous swap offer */
+    PT_ASYNC_FLUSH_COM,   /** Number of offers made, before a checkpoint and at the end of the run */
+    PT_ASYNC_CONTROL_COM  /** Checkpoint, exit and completion requests from the root */
 } LALInferenceMPIcomm;
 
 /* Temperature ladder adaptation */
@@ -63,6 +67,9 @@ void LALInferenceAdaptLadder(LALInferenceRunState *runState);
 /* Standard parallel temperature swap proposal function */
 void LALInferencePTswap(LALInferenceRunState *runState, FILE *swapfile);
 
+/* Parallel temperature swap proposal that does not wait for other MPI ranks */
+void LALInferencePTswapAsync(LALInferenceRunState *runState, FILE *swapfile);
+
 /* Metropolis-coupled MCMC swap proposal, when the likelihood is not identical between chains */
 //UINT4 LALInferenceMCMCMCswap(LALInferenceRunState *runState, REAL8 *ladder, INT4 i, FILE *swapfile);
 
@@ -72,7 +79,7 @@ void LALInferenceAdaptation(LALInferenceThreadState *thread);
 void LALInferenceAdaptationRestart(LALInferenceThreadState *thread);
 REAL8 LALInferenceAdaptationEnvelope(INT4 step, INT4 tau, INT4 length, INT4 fix_adapt_len);
 void LALInferenceShutdownLadder(void);
-void LALInferenceFlushPTswap(void);
+void LALInferenceFlushPTswap(LALInferenceRunState *runState);
 void LALInferenceLadderUpdate(LALInferenceRunState *runState, INT4 sourceChainFlag, INT4 cycle);
 
 /* Data IO routines */
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <lal/LALInference.h>
+#include <lal/LALInferenceLikelihood.h>
 #include <lal/Units.h>
 #include <lal/FrequencySeries.h>
 #include <lal/Sequence.h>
@@ -47,6 +48,10 @@
 #define UNUSED
 #endif
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 #define COL_MAX 128
 #define STR_MAX 2048
 
@@ -82,6 +87,37 @@ static int LALInferenceElemCmp(const void *elem1, const void *elem2)
   return(strncmp(((const hash_elem *)elem1)->name,((const hash_elem *)elem2)->name,VARNAME_MAX));
 }
 
+/* Flat storage of compiled LALInferenceVariables (see LALInferenceCompileVariables()) */
+struct tagLALInferenceVariablesLayout
+{
+  INT4 refcount;                      /* number of structures using this layout */
+  UINT4 nitems;                       /* number of variables */
+  UINT4 nslots;                       /* number of REAL8 slots */
+  UINT4 *offset;                      /* first slot of each variable */
+  UINT4 *slotItem;                    /* variable stored in each slot */
+  LALInferenceVariableType *type;     /* type of each variable */
+  char (*name)[VARNAME_MAX];          /* name of each variable */
+  UINT4 nowned;                       /* number of matrix and vector variables */
+  UINT4 *owned;                       /* indices of matrix and vector variables, by increasing slot */
+};
+
+struct tagLALInferenceCompiledVariables
+{
+  LALInferenceVariablesLayout *layout; /* NULL if the structure has changed since it was compiled */
+  REAL8 *block;                        /* values of all variables */
+  LALInferenceVariableItem **items;    /* list node of each variable of the layout */
+};
+
+static UINT4 LALInferenceTypeSlots(LALInferenceVariableType type);
+static int LALInferenceTypeIsOwned(LALInferenceVariableType type);
+static void LALInferenceReleaseLayout(LALInferenceVariablesLayout *layout);
+static int LALInferenceBindLayout(LALInferenceVariables *vars, LALInferenceVariablesLayout *layout);
+static void LALInferenceDecompileVariables(LALInferenceVariables *vars);
+static void LALInferenceFreeCompiledVariables(LALInferenceVariables *vars);
+static int LALInferenceCopyOwnedValue(LALInferenceVariableType type, void *target, const void *origin);
+static void LALInferenceCopyCompiledVariables(const LALInferenceVariables *origin, LALInferenceVariables *target);
+static LALInferenceVariableItem *LALInferenceUnlinkVariableItem(LALInferenceVariables *vars, const char *name);
+
 
 size_t LALInferenceTypeSize[] = {sizeof(INT4),
                                    sizeof(INT8),
@@ -146,6 +182,36 @@ LALInferenceThreadState *LALInferenceInitThreads(INT4 nthreads) {
     return threads;
 }
 
+void LALInferenceDestroyModel(LALInferenceModel *model) {
+    if (!model) return;
+
+    if (model->params) {
+        LALInferenceClearVariables(model->params);
+        XLALFree(model->params);
+    }
+    XLALFree(model->ifo_loglikelihoods);
+    XLALFree(model->ifo_SNRs);
+    XLALDestroyREAL8TimeSeries(model->timehPlus);
+    XLALDestroyREAL8TimeSeries(model->timehCross);
+    XLALDestroyCOMPLEX16FrequencySeries(model->freqhPlus);
+    XLALDestroyCOMPLEX16FrequencySeries(model->freqhCross);
+    if (model->freqhs) {
+        /* NULL-terminated, see LALInferenceInitCBCModel() */
+        for (UINT4 i = 0; model->freqhs[i]; i++)
+            XLALDestroyCOMPLEX16FrequencySeries(model->freqhs[i]);
+        XLALFree(model->freqhs);
+    }
+    XLALDestroyDict(model->LALpars);
+    XLALDestroySimInspiralWaveformCache(model->waveformCache);
+    XLALDestroySimBurstWaveformCache(model->burstWaveformCache);
+    XLALDestroySimNeutronStarFamily(model->eos_fam);
+    LALInferenceResetFusedBins(model);
+    LALInferenceResetSplineCalibration(model);
+    LALInferenceDestroyRelativeBinningModel(model->relbin);
+
+    XLALFree(model);
+}
+
 
 /* ============ Accessor functions for the Variable structure: ========== */
 
@@ -204,7 +270,7 @@ LALInferenceVariableItem *LALInferenceGetItemSlow(const LALInferenceVariables *v
 }
 
 
-LALInferenceVariableItem *LALInferenceGetItemNr(LALInferenceVariables *vars, int idx)
+LALInferenceVariableItem *LALInferenceGetItemNr(const LALInferenceVariables *vars, int idx)
 /* (this function is only to be used internally)  */
 /* Returns pointer to item for given item number. */
 {
@@ -247,7 +313,7 @@ void *LALInferenceGetVariable(const LALInferenceVariables * vars,const char * na
 }
 
 
-INT4 LALInferenceGetVariableDimension(LALInferenceVariables *vars)
+INT4 LALInferenceGetVariableDimension(const LALInferenceVariables *vars)
 {
   return(vars->dimension);
 }
@@ -422,6 +488,9 @@ void LALInferenceAddVariable(LALInferenceVariables * vars, const char * name, co
    // XLAL_ERROR_VOID(XLAL_EFAULT, "Unable to access value through null pointer; trying to add \"%s\".", name);
   //}
 
+  /* A new variable does not fit in the compiled layout */
+  LALInferenceDecompileVariables(vars);
+
   LALInferenceVariableItem *new=XLALMalloc(sizeof(LALInferenceVariableItem));
 
   memset(new,0,sizeof(LALInferenceVariableItem));
@@ -462,6 +531,7 @@ void LALInferenceRemoveVariable(LALInferenceVariables *vars,const char *name)
     XLAL_PRINT_WARNING("Entry \"%s\" not found.", name);
     return;
   }
+  LALInferenceDecompileVariables(vars);
   if(!parent) vars->head=this->next;
   else parent->next=this->next;
   /* Remove from hash table */
@@ -542,7 +612,8 @@ void LALInferenceClearVariables(LALInferenceVariables *vars)
     if(this->type==LALINFERENCE_UINT4Vector_t) XLALDestroyUINT4Vector(*(UINT4Vector **)this->value);
     if(this->type==LALINFERENCE_REAL8Vector_t) XLALDestroyREAL8Vector(*(REAL8Vector **)this->value);
     if(this->type==LALINFERENCE_COMPLEX16Vector_t) XLALDestroyCOMPLEX16Vector(*(COMPLEX16Vector **)this->value);
-    XLALFree(this->value);
+    /* Compiled values live in the shared block, freed below */
+    if(!LALInferenceVariablesIsCompiled(vars)) XLALFree(this->value);
     XLALFree(this);
     this=next;
     if(this) next=this->next;
@@ -551,11 +622,12 @@ void LALInferenceClearVariables(LALInferenceVariables *vars)
   vars->dimension=0;
   if(vars->hash_table) XLALHashTblDestroy(vars->hash_table);
   vars->hash_table=NULL;
+  LALInferenceFreeCompiledVariables(vars);
   
   return;
 }
 
-void LALInferenceCopyVariables(LALInferenceVariables *origin, LALInferenceVariables *target)
+void LALInferenceCopyVariables(const LALInferenceVariables *origin, LALInferenceVariables *target)
 /*  copy contents of "origin" over to "target"  */
 {
   int dims = 0, i = 0;
@@ -572,6 +644,14 @@ void LALInferenceCopyVariables(LALInferenceVariables *origin, LALInferenceVariab
   /* Make sure the structure is initialised */
   if(!target) XLAL_ERROR_VOID(XLAL_EFAULT, "Unable to copy to uninitialised LALInferenceVariables structure.");
 
+  /* Structures sharing a layout are copied slot by slot */
+  if(LALInferenceVariablesIsCompiled(origin) && LALInferenceVariablesIsCompiled(target)
+     && origin->compiled->layout == target->compiled->layout)
+  {
+    LALInferenceCopyCompiledVariables(origin, target);
+    return;
+  }
+
   /* First clear the target */
   LALInferenceClearVariables(target);
 
@@ -652,10 +732,340 @@ void LALInferenceCopyVariables(LALInferenceVariables *origin, LALInferenceVariab
     }
   }
 
+  /* The copy adopts the layout of the origin, so that later copies are fast;
+   * the origin is never modified, so that several threads may copy from it
+   * at once: if its parameter set has changed since it was compiled only
+   * the target is compiled, with a new layout */
+  if(LALInferenceVariablesIsCompiled(origin))
+    LALInferenceBindLayout(target, origin->compiled->layout);
+  else if(origin->compiled)
+    LALInferenceCompileVariables(target);
+
   return;
 }
 
 
+/* ============ Compiled (flat) variables: ========== */
+
+static UINT4 LALInferenceTypeSlots(LALInferenceVariableType type)
+{
+  return (LALInferenceTypeSize[type] + sizeof(REAL8) - 1) / sizeof(REAL8);
+}
+
+/* Types whose value is a pointer to an object owned by the variables */
+static int LALInferenceTypeIsOwned(LALInferenceVariableType type)
+{
+  switch (type) {
+  case LALINFERENCE_gslMatrix_t:
+  case LALINFERENCE_REAL8Vector_t:
+  case LALINFERENCE_INT4Vector_t:
+  case LALINFERENCE_UINT4Vector_t:
+  case LALINFERENCE_COMPLEX16Vector_t:
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+static void LALInferenceReleaseLayout(LALInferenceVariablesLayout *layout)
+{
+  INT4 refcount;
+  if(!layout) return;
+  #pragma omp atomic capture
+  refcount = --layout->refcount;
+  if(refcount > 0) return;
+  XLALFree(layout->offset);
+  XLALFree(layout->slotItem);
+  XLALFree(layout->type);
+  XLALFree(layout->name);
+  XLALFree(layout->owned);
+  XLALFree(layout);
+}
+
+/* Move the values of vars, which must be stored item by item, into a block
+ * with the given layout. vars must contain exactly the variables of the layout. */
+static int LALInferenceBindLayout(LALInferenceVariables *vars, LALInferenceVariablesLayout *layout)
+{
+  UINT4 i;
+  XLAL_CHECK(!LALInferenceVariablesIsCompiled(vars), XLAL_EINVAL, "Variables are already compiled");
+  XLAL_CHECK((UINT4)vars->dimension == layout->nitems, XLAL_EINVAL, "Variables do not match the layout");
+
+  LALInferenceVariableItem **items = XLALMalloc(layout->nitems * sizeof(*items));
+  XLAL_CHECK(items, XLAL_ENOMEM);
+  for(i=0; i<layout->nitems; i++)
+  {
+    items[i] = LALInferenceGetItem(vars, layout->name[i]);
+    if(!items[i] || items[i]->type != layout->type[i])
+    {
+      XLALFree(items);
+      XLAL_ERROR(XLAL_EINVAL, "Variable \"%s\" does not match the layout", layout->name[i]);
+    }
+  }
+  REAL8 *block = XLALCalloc(layout->nslots, sizeof(REAL8));
+  if(!block)
+  {
+    XLALFree(items);
+    XLAL_ERROR(XLAL_ENOMEM);
+  }
+  if(!vars->compiled)
+  {
+    vars->compiled = XLALCalloc(1, sizeof(*vars->compiled));
+    if(!vars->compiled)
+    {
+      XLALFree(items);
+      XLALFree(block);
+      XLAL_ERROR(XLAL_ENOMEM);
+    }
+  }
+
+  for(i=0; i<layout->nitems; i++)
+  {
+    void *value = block + layout->offset[i];
+    memcpy(value, items[i]->value, LALInferenceTypeSize[layout->type[i]]);
+    XLALFree(items[i]->value);
+    items[i]->value = value;
+  }
+  #pragma omp atomic
+  layout->refcount++;
+  vars->compiled->layout = layout;
+  vars->compiled->block = block;
+  vars->compiled->items = items;
+  return XLAL_SUCCESS;
+}
+
+/* Give every item its own storage again, e.g. before the parameter set
+ * changes. vars stays marked for compilation. */
+static void LALInferenceDecompileVariables(LALInferenceVariables *vars)
+{
+  UINT4 i;
+  if(!LALInferenceVariablesIsCompiled(vars)) return;
+  LALInferenceCompiledVariables *compiled = vars->compiled;
+  LALInferenceVariablesLayout *layout = compiled->layout;
+  for(i=0; i<layout->nitems; i++)
+  {
+    LALInferenceVariableItem *item = compiled->items[i];
+    void *value = XLALMalloc(LALInferenceTypeSize[item->type]);
+    if(!value) XLAL_ERROR_VOID(XLAL_ENOMEM);
+    memcpy(value, item->value, LALInferenceTypeSize[item->type]);
+    item->value = value;
+  }
+  XLALFree(compiled->block);
+  XLALFree(compiled->items);
+  compiled->block = NULL;
+  compiled->items = NULL;
+  compiled->layout = NULL;
+  LALInferenceReleaseLayout(layout);
+}
+
+/* Release the compiled storage; the items must already have been freed */
+static void LALInferenceFreeCompiledVariables(LALInferenceVariables *vars)
+{
+  if(!vars->compiled) return;
+  LALInferenceReleaseLayout(vars->compiled->layout);
+  XLALFree(vars->compiled->block);
+  XLALFree(vars->compiled->items);
+  XLALFree(vars->compiled);
+  vars->compiled = NULL;
+}
+
+/* Deep copy a matrix or vector into *target, reusing the object already
+ * there if it has the right size */
+static int LALInferenceCopyOwnedValue(LALInferenceVariableType type, void *target, const void *origin)
+{
+  switch (type) {
+  case LALINFERENCE_gslMatrix_t:
+  {
+    gsl_matrix *old = *(gsl_matrix **)target;
+    const gsl_matrix *src = *(gsl_matrix * const *)origin;
+    if(!old || old->size1 != src->size1 || old->size2 != src->size2)
+    {
+      if(old) gsl_matrix_free(old);
+      old = gsl_matrix_alloc(src->size1, src->size2);
+      XLAL_CHECK(old, XLAL_ENOMEM, "Unable to create %zux%zu matrix", src->size1, src->size2);
+      *(gsl_matrix **)target = old;
+    }
+    gsl_matrix_memcpy(old, src);
+    break;
+  }
+#define COPY_VECTOR(VTYPE) \
+  { \
+    VTYPE##Vector *old = *(VTYPE##Vector **)target; \
+    const VTYPE##Vector *src = *(VTYPE##Vector * const *)origin; \
+    if(!old || old->length != src->length) \
+    { \
+      XLALDestroy##VTYPE##Vector(old); \
+      old = XLALCreate##VTYPE##Vector(src->length); \
+      XLAL_CHECK(old, XLAL_ENOMEM, "Unable to copy vector"); \
+      *(VTYPE##Vector **)target = old; \
+    } \
+    memcpy(old->data, src->data, src->length * sizeof(src->data[0])); \
+    break; \
+  }
+  case LALINFERENCE_REAL8Vector_t:
+    COPY_VECTOR(REAL8)
+  case LALINFERENCE_INT4Vector_t:
+    COPY_VECTOR(INT4)
+  case LALINFERENCE_UINT4Vector_t:
+    COPY_VECTOR(UINT4)
+  case LALINFERENCE_COMPLEX16Vector_t:
+    COPY_VECTOR(COMPLEX16)
+#undef COPY_VECTOR
+  default:
+    XLAL_ERROR(XLAL_EINVAL, "Not a matrix or vector type");
+  }
+  return XLAL_SUCCESS;
+}
+
+/* Copy between two structures sharing the same layout */
+static void LALInferenceCopyCompiledVariables(const LALInferenceVariables *origin, LALInferenceVariables *target)
+{
+  const LALInferenceVariablesLayout *layout = origin->compiled->layout;
+  const REAL8 *src = origin->compiled->block;
+  REAL8 *dst = target->compiled->block;
+  UINT4 i, start = 0;
+
+  /* Copy the slots between matrix and vector variables, which are deep copied */
+  for(i=0; i<layout->nowned; i++)
+  {
+    UINT4 k = layout->owned[i];
+    UINT4 slot = layout->offset[k];
+    memcpy(dst + start, src + start, (slot - start) * sizeof(REAL8));
+    if(LALInferenceCopyOwnedValue(layout->type[k], dst + slot, src + slot) != XLAL_SUCCESS)
+      XLAL_ERROR_VOID(XLAL_EFUNC);
+    start = slot + LALInferenceTypeSlots(layout->type[k]);
+  }
+  memcpy(dst + start, src + start, (layout->nslots - start) * sizeof(REAL8));
+
+  /* Vary types, and the order of the list, follow the origin */
+  LALInferenceVariableItem **link = &(target->head);
+  for(const LALInferenceVariableItem *ptr = origin->head; ptr; ptr = ptr->next)
+  {
+    LALInferenceVariableItem *item = target->compiled->items[layout->slotItem[(const REAL8 *)ptr->value - src]];
+    item->vary = ptr->vary;
+    *link = item;
+    link = &(item->next);
+  }
+  *link = NULL;
+}
+
+int LALInferenceCompileVariables(LALInferenceVariables *vars)
+{
+  UINT4 i, nslots = 0, nowned = 0;
+  LALInferenceVariableItem *ptr;
+
+  XLAL_CHECK(vars, XLAL_EFAULT, "Unable to access variables");
+  if(LALInferenceVariablesIsCompiled(vars) || vars->dimension == 0) return XLAL_SUCCESS;
+
+  LALInferenceVariablesLayout *layout = XLALCalloc(1, sizeof(*layout));
+  XLAL_CHECK(layout, XLAL_ENOMEM);
+  layout->nitems = vars->dimension;
+  for(ptr=vars->head; ptr; ptr=ptr->next)
+  {
+    nslots += LALInferenceTypeSlots(ptr->type);
+    nowned += LALInferenceTypeIsOwned(ptr->type);
+  }
+  layout->nslots = nslots;
+  layout->nowned = nowned;
+  layout->offset = XLALMalloc(layout->nitems * sizeof(*layout->offset));
+  layout->slotItem = XLALMalloc(nslots * sizeof(*layout->slotItem));
+  layout->type = XLALMalloc(layout->nitems * sizeof(*layout->type));
+  layout->name = XLALMalloc(layout->nitems * sizeof(*layout->name));
+  layout->owned = XLALMalloc((nowned ? nowned : 1) * sizeof(*layout->owned));
+  if(!layout->offset || !layout->slotItem || !layout->type || !layout->name || !layout->owned)
+  {
+    LALInferenceReleaseLayout(layout);
+    XLAL_ERROR(XLAL_ENOMEM);
+  }
+
+  /* Slots are assigned in list order */
+  nslots = nowned = 0;
+  for(i=0, ptr=vars->head; ptr; i++, ptr=ptr->next)
+  {
+    UINT4 j, n = LALInferenceTypeSlots(ptr->type);
+    layout->offset[i] = nslots;
+    layout->type[i] = ptr->type;
+    memcpy(layout->name[i], ptr->name, VARNAME_MAX);
+    for(j=0; j<n; j++) layout->slotItem[nslots++] = i;
+    if(LALInferenceTypeIsOwned(ptr->type)) layout->owned[nowned++] = i;
+  }
+
+  /* Drop the storage left from an earlier compilation */
+  if(vars->compiled) LALInferenceFreeCompiledVariables(vars);
+  if(LALInferenceBindLayout(vars, layout) != XLAL_SUCCESS)
+  {
+    LALInferenceReleaseLayout(layout);
+    XLAL_ERROR(XLAL_EFUNC);
+  }
+  return XLAL_SUCCESS;
+}
+
+int LALInferenceCompileVariablesLike(LALInferenceVariables *vars, const LALInferenceVariables *reference)
+{
+  XLAL_CHECK(vars, XLAL_EFAULT, "Unable to access variables");
+  XLAL_CHECK(LALInferenceVariablesIsCompiled(reference), XLAL_EINVAL, "Reference variables are not compiled");
+  if(vars == reference || (LALInferenceVariablesIsCompiled(vars) && vars->compiled->layout == reference->compiled->layout))
+    return XLAL_SUCCESS;
+  LALInferenceDecompileVariables(vars);
+  XLAL_CHECK(LALInferenceBindLayout(vars, reference->compiled->layout) == XLAL_SUCCESS, XLAL_EFUNC);
+  return XLAL_SUCCESS;
+}
+
+int LALInferenceVariablesIsCompiled(const LALInferenceVariables *vars)
+{
+  return vars && vars->compiled && vars->compiled->layout;
+}
+
+LALInferenceVariableHandle LALInferenceGetVariableHandle(const LALInferenceVariables *vars, const char *name)
+{
+  LALInferenceVariableHandle handle = {NULL, 0, 0};
+  if(!LALInferenceVariablesIsCompiled(vars))
+    XLAL_ERROR_VAL(handle, XLAL_EINVAL, "Variables are not compiled");
+  LALInferenceVariableItem *item = LALInferenceGetItem(vars, name);
+  if(!item)
+    XLAL_ERROR_VAL(handle, XLAL_EINVAL, "Entry \"%s\" not found.", name);
+  const LALInferenceVariablesLayout *layout = vars->compiled->layout;
+  handle.layout = layout;
+  handle.item = layout->slotItem[(const REAL8 *)item->value - vars->compiled->block];
+  handle.slot = layout->offset[handle.item];
+  return handle;
+}
+
+int LALInferenceCheckVariableHandle(const LALInferenceVariables *vars, LALInferenceVariableHandle handle)
+{
+  return handle.layout && LALInferenceVariablesIsCompiled(vars) && vars->compiled->layout == handle.layout;
+}
+
+void *LALInferenceGetVariableByHandle(const LALInferenceVariables *vars, LALInferenceVariableHandle handle)
+{
+  if(!LALInferenceCheckVariableHandle(vars, handle))
+    XLAL_ERROR_NULL(XLAL_EINVAL, "Handle does not belong to the layout of the variables");
+  return vars->compiled->block + handle.slot;
+}
+
+REAL8 LALInferenceGetREAL8VariableByHandle(const LALInferenceVariables *vars, LALInferenceVariableHandle handle)
+{
+  if(!LALInferenceCheckVariableHandle(vars, handle))
+    XLAL_ERROR_REAL8(XLAL_EINVAL, "Handle does not belong to the layout of the variables");
+  if(handle.layout->type[handle.item] != LALINFERENCE_REAL8_t)
+    XLAL_ERROR_REAL8(XLAL_ETYPE, "Entry \"%s\" is not a REAL8", handle.layout->name[handle.item]);
+  return vars->compiled->block[handle.slot];
+}
+
+void LALInferenceSetREAL8VariableByHandle(LALInferenceVariables *vars, LALInferenceVariableHandle handle, REAL8 value)
+{
+  if(!LALInferenceCheckVariableHandle(vars, handle))
+    XLAL_ERROR_VOID(XLAL_EINVAL, "Handle does not belong to the layout of the variables");
+  if(handle.layout->type[handle.item] != LALINFERENCE_REAL8_t)
+    XLAL_ERROR_VOID(XLAL_ETYPE, "Entry \"%s\" is not a REAL8", handle.layout->name[handle.item]);
+  if(vars->compiled->items[handle.item]->vary == LALINFERENCE_PARAM_FIXED)
+  {
+    XLALPrintWarning("Warning! Attempting to set variable %s which is fixed\n", handle.layout->name[handle.item]);
+    return;
+  }
+  vars->compiled->block[handle.slot] = value;
+}
+
+
 void LALInferenceCopyUnsetREAL8Variables(LALInferenceVariables *origin, LALInferenceVariables *target, ProcessParamsTable *commandLine) {
 /*  Copy REAL8s from "origin" to "target" if they weren't set on the command line */
     LALInferenceVariableItem *ptr;
@@ -2185,6 +2595,14 @@ char *colNameToParamName(const char *colName) {
 }
 
 LALInferenceVariableItem *LALInferencePopVariableItem(LALInferenceVariables *vars, const char *name)
+{
+  /* The caller takes ownership of the item, so it must not point into the compiled block */
+  LALInferenceDecompileVariables(vars);
+  return LALInferenceUnlinkVariableItem(vars, name);
+}
+
+/* Remove an item from the list without touching its storage */
+static LALInferenceVariableItem *LALInferenceUnlinkVariableItem(LALInferenceVariables *vars, const char *name)
 {
   LALInferenceVariableItem **prevPtr=&(vars->head);
   LALInferenceVariableItem *thisPtr=vars->head;
@@ -2204,6 +2622,11 @@ LALInferenceVariableItem *LALInferencePopVariableItem(LALInferenceVariables *var
 
 void LALInferenceSortVariablesByName(LALInferenceVariables *vars)
 {
+  /* Nothing to do if the list is already sorted */
+  LALInferenceVariableItem *check=vars->head;
+  while(check && check->next && strcmp(check->name,check->next->name)<0)
+    check=check->next;
+  if(!check || !check->next) return;
 
   /* Start a new list */
   LALInferenceVariableItem *newHead=NULL;
@@ -2217,7 +2640,7 @@ void LALInferenceSortVariablesByName(LALInferenceVariables *vars)
       if(strcmp(match->name,this->name)<0)
         match = this;
     /* Remove it from the old list and link it into the new one */
-    LALInferenceVariableItem *item=LALInferencePopVariableItem(vars,match->name);
+    LALInferenceVariableItem *item=LALInferenceUnlinkVariableItem(vars,match->name);
     item->next=newHead;
     newHead=item;
 	vars->dimension++; /* Increase the dimension which was decreased by PopVariableItem */
@@ -4428,6 +4851,162 @@ int LALInferenceSplineCalibrationFactorROQ(REAL8Vector *logfreqs,
   }
 }
 
+LALInferenceSplineCalibrationBasis *LALInferenceCreateSplineCalibrationBasis(const REAL8Vector *logfreqs, const REAL8 *freqs, UINT4 npoints)
+{
+  XLAL_CHECK_NULL(logfreqs && logfreqs->length >= 2, XLAL_EINVAL, "need at least two spline nodes");
+  XLAL_CHECK_NULL(freqs || npoints == 0, XLAL_EFAULT);
+
+  const UINT4 n = logfreqs->length;
+  const REAL8 *x = logfreqs->data;
+  for (UINT4 k = 0; k + 1 < n; k++)
+    XLAL_CHECK_NULL(x[k + 1] > x[k], XLAL_EINVAL, "spline nodes must be increasing");
+
+  LALInferenceSplineCalibrationBasis *basis = XLALCalloc(1, sizeof(*basis));
+  XLAL_CHECK_NULL(basis, XLAL_ENOMEM);
+  basis->nnodes = n;
+  basis->npoints = npoints;
+  basis->logfreqs = XLALMalloc(n * sizeof(REAL8));
+  basis->curvature = XLALCalloc(n * n, sizeof(REAL8));
+  basis->interval = XLALCalloc(npoints ? npoints : 1, sizeof(UINT4));
+  basis->weights = XLALCalloc(4 * (npoints ? npoints : 1), sizeof(REAL8));
+  basis->amps = XLALCalloc(n, sizeof(REAL8));
+  basis->phases = XLALCalloc(n, sizeof(REAL8));
+  basis->factors = XLALCreateCOMPLEX16Sequence(npoints);
+  if (!(basis->logfreqs && basis->curvature && basis->interval && basis->weights && basis->amps && basis->phases && basis->factors)) {
+    LALInferenceDestroySplineCalibrationBasis(basis);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+  memcpy(basis->logfreqs, x, n * sizeof(REAL8));
+
+  /* Natural spline: the second derivatives M vanish at the ends and satisfy
+   *   h[k-1] M[k-1] + 2 (h[k-1] + h[k]) M[k] + h[k] M[k+1]
+   *     = 6 ((y[k+1] - y[k]) / h[k] - (y[k] - y[k-1]) / h[k-1])
+   * inside.  Solve for each node value in turn to get the columns of M(y). */
+  if (n > 2) {
+    const UINT4 m = n - 2;
+    REAL8 diag[m], upper[m], rhs[m];
+    for (UINT4 j = 0; j < n; j++) {
+      for (UINT4 k = 1; k + 1 < n; k++) {
+        REAL8 hl = x[k] - x[k - 1], hr = x[k + 1] - x[k];
+        diag[k - 1] = 2.0 * (hl + hr);
+        upper[k - 1] = hr;
+        rhs[k - 1] = 6.0 * (((k + 1 == j) - (k == j)) / hr - ((k == j) - (k - 1 == j)) / hl);
+      }
+      /* Forward elimination of the symmetric tridiagonal system */
+      for (UINT4 k = 1; k < m; k++) {
+        REAL8 lower = x[k + 1] - x[k];
+        REAL8 r = lower / diag[k - 1];
+        diag[k] -= r * upper[k - 1];
+        rhs[k] -= r * rhs[k - 1];
+      }
+      basis->curvature[m * n + j] = rhs[m - 1] / diag[m - 1];
+      for (UINT4 k = m - 1; k > 0; k--)
+        basis->curvature[k * n + j] = (rhs[k - 1] - upper[k - 1] * basis->curvature[(k + 1) * n + j]) / diag[k - 1];
+    }
+  }
+
+  /* Interval and weights of each frequency; frequencies outside the nodes
+   * keep zero weights, giving a factor of one */
+  REAL8 lowf = exp(x[0]);
+  REAL8 highf = exp(x[n - 1]);
+  UINT4 k = 0;
+  for (UINT4 i = 0; i < npoints; i++) {
+    REAL8 f = freqs[i];
+    if (f < lowf || f > highf)
+      continue;
+    REAL8 logf = log(f);
+    /* The frequencies are usually sorted, so start from the last interval */
+    if (logf < x[k]) k = 0;
+    while (k + 2 < n && logf > x[k + 1]) k++;
+    REAL8 h = x[k + 1] - x[k];
+    REAL8 t = (logf - x[k]) / h;
+    REAL8 *w = basis->weights + 4 * i;
+    basis->interval[i] = k;
+    w[0] = 1.0 - t;
+    w[1] = t;
+    w[2] = h * h / 6.0 * ((1.0 - t) * (1.0 - t) * (1.0 - t) - (1.0 - t));
+    w[3] = h * h / 6.0 * (t * t * t - t);
+  }
+
+  return basis;
+}
+
+void LALInferenceDestroySplineCalibrationBasis(LALInferenceSplineCalibrationBasis *basis)
+{
+  if (!basis) return;
+  XLALFree(basis->logfreqs);
+  XLALFree(basis->curvature);
+  XLALFree(basis->interval);
+  XLALFree(basis->weights);
+  XLALFree(basis->amps);
+  XLALFree(basis->phases);
+  if (basis->factors) XLALDestroyCOMPLEX16Sequence(basis->factors);
+  XLALFree(basis);
+}
+
+int LALInferenceSplineCalibrationBasisMatches(const LALInferenceSplineCalibrationBasis *basis, const REAL8Vector *logfreqs, UINT4 npoints)
+{
+  if (!basis || !logfreqs || basis->nnodes != logfreqs->length || basis->npoints != npoints)
+    return 0;
+  return memcmp(basis->logfreqs, logfreqs->data, basis->nnodes * sizeof(REAL8)) == 0;
+}
+
+int LALInferenceSplineCalibrationEvaluate(LALInferenceSplineCalibrationBasis **bases,
+					REAL8Vector **deltaAmps,
+					REAL8Vector **deltaPhases,
+					UINT4 nbases)
+{
+  XLAL_CHECK(bases && deltaAmps && deltaPhases, XLAL_EFAULT);
+
+  for (UINT4 b = 0; b < nbases; b++) {
+    LALInferenceSplineCalibrationBasis *basis = bases[b];
+    XLAL_CHECK(basis && deltaAmps[b] && deltaPhases[b], XLAL_EFAULT);
+    const UINT4 n = basis->nnodes;
+    XLAL_CHECK(deltaAmps[b]->length == n && deltaPhases[b]->length == n, XLAL_EINVAL, "input lengths differ");
+
+    /* Nothing to do if only other parameters have changed */
+    if (basis->generation
+        && memcmp(basis->amps, deltaAmps[b]->data, n * sizeof(REAL8)) == 0
+        && memcmp(basis->phases, deltaPhases[b]->data, n * sizeof(REAL8)) == 0)
+      continue;
+    memcpy(basis->amps, deltaAmps[b]->data, n * sizeof(REAL8));
+    memcpy(basis->phases, deltaPhases[b]->data, n * sizeof(REAL8));
+
+    /* Node values followed by second derivatives */
+    REAL8 ampCoeffs[2 * n], phaseCoeffs[2 * n];
+    for (UINT4 j = 0; j < n; j++) {
+      REAL8 mA = 0.0, mPhi = 0.0;
+      for (UINT4 l = 0; l < n; l++) {
+        mA += basis->curvature[j * n + l] * basis->amps[l];
+        mPhi += basis->curvature[j * n + l] * basis->phases[l];
+      }
+      ampCoeffs[j] = basis->amps[j];
+      phaseCoeffs[j] = basis->phases[j];
+      ampCoeffs[n + j] = mA;
+      phaseCoeffs[n + j] = mPhi;
+    }
+
+    const UINT4 *interval = basis->interval;
+    const REAL8 *weights = basis->weights;
+    REAL8 *factors = (REAL8 *)basis->factors->data;
+    const UINT4 npoints = basis->npoints;
+    #pragma omp simd
+    for (UINT4 i = 0; i < npoints; i++) {
+      const UINT4 k = interval[i];
+      const REAL8 *w = weights + 4 * i;
+      REAL8 dA = w[0] * ampCoeffs[k] + w[1] * ampCoeffs[k + 1] + w[2] * ampCoeffs[n + k] + w[3] * ampCoeffs[n + k + 1];
+      REAL8 dPhi = w[0] * phaseCoeffs[k] + w[1] * phaseCoeffs[k + 1] + w[2] * phaseCoeffs[n + k] + w[3] * phaseCoeffs[n + k + 1];
+      /* (1 + dA) (2 + i dPhi) / (2 - i dPhi) */
+      REAL8 scale = (1.0 + dA) / (4.0 + dPhi * dPhi);
+      factors[2 * i] = scale * (4.0 - dPhi * dPhi);
+      factors[2 * i + 1] = scale * 4.0 * dPhi;
+    }
+    basis->generation++;
+  }
+
+  return XLAL_SUCCESS;
+}
+
 void LALInferenceFprintSplineCalibrationHeader(FILE *output, LALInferenceThreadState *thread) {
     INT4 i, nifo;
     char **ifo_names = NULL;
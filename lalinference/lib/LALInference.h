@@ -63,6 +63,7 @@
 #include <lal/StringVector.h>
 #include <lal/LALSimInspiral.h>
 #include <lal/LALSimInspiralWaveformCache.h>
+#include <lal/LALSimInspiralRelativeBinning.h>
 #include <lal/LALSimNeutronStar.h>
 #include <lal/LALHashTbl.h>
 #include <lal/RealFFT.h>
@@ -94,6 +95,8 @@ struct tagLALInferenceRunState;
 struct tagLALInferenceThreadState;
 struct tagLALInferenceIFOData;
 struct tagLALInferenceModel;
+struct tagLALInferenceFusedBins;
+struct tagLALInferenceSplineCalibrationCache;
 
 /*Data storage type definitions*/
 
@@ -160,6 +163,16 @@ tagVariableItem
 } LALInferenceVariableItem;
 
 
+/**
+ * Slot layout of a compiled LALInferenceVariables structure, shared by
+ * all structures compiled with the same names and types.
+ * See LALInferenceCompileVariables().
+ */
+typedef struct tagLALInferenceVariablesLayout LALInferenceVariablesLayout;
+
+/** Storage of a compiled LALInferenceVariables structure (internal) */
+typedef struct tagLALInferenceCompiledVariables LALInferenceCompiledVariables;
+
 /**
  * The LALInferenceVariables structure to contain a set of parameters
  * Implemented as a linked list of LALInferenceVariableItems.
@@ -171,8 +184,21 @@ tagLALInferenceVariables
   LALInferenceVariableItem	*head;
   INT4 				dimension;
   LALHashTbl        *hash_table;
+  LALInferenceCompiledVariables *compiled; /** Flat storage, NULL unless LALInferenceCompileVariables() was called */
 } LALInferenceVariables;
 
+/**
+ * Handle to a variable in a compiled LALInferenceVariables structure,
+ * valid for every structure that shares the same layout
+ */
+typedef struct
+tagLALInferenceVariableHandle
+{
+  const LALInferenceVariablesLayout *layout;
+  UINT4 item;
+  UINT4 slot;
+} LALInferenceVariableHandle;
+
 /**
  * Phase of MCMC run (depending on burn-in status, different actions
  * are performed during the run, and this tag controls the activity).
@@ -228,7 +254,7 @@ UINT4 LALInferencePrintNVariableItem(char *out, UINT4 N, const LALInferenceVaria
 void *LALInferenceGetVariable(const LALInferenceVariables * vars, const char * name);
 
 /** Get number of dimensions in variable \c vars */
-INT4 LALInferenceGetVariableDimension(LALInferenceVariables *vars);
+INT4 LALInferenceGetVariableDimension(const LALInferenceVariables *vars);
 
 /** Get number of dimensions in \c vars which are not fixed to a certain value */
 INT4 LALInferenceGetVariableDimensionNonFixed(LALInferenceVariables *vars);
@@ -309,7 +335,7 @@ int LALInferenceCheckVariableToPrint(LALInferenceVariables *vars, const char *na
 void LALInferenceClearVariables(LALInferenceVariables *vars);
 
 /** Deep copy the variables from one to another LALInferenceVariables structure */
-void LALInferenceCopyVariables(LALInferenceVariables *origin, LALInferenceVariables *target);
+void LALInferenceCopyVariables(const LALInferenceVariables *origin, LALInferenceVariables *target);
 
 /*  Copy REAL8s from "origin" to "target" if they weren't set on the command line */
 void LALInferenceCopyUnsetREAL8Variables(LALInferenceVariables *origin, LALInferenceVariables *target, ProcessParamsTable *commandLine);
@@ -320,6 +346,63 @@ void LALInferencePrintVariables(LALInferenceVariables *var);
 /** Check for equality in two variables */
 int LALInferenceCompareVariables(LALInferenceVariables *var1, LALInferenceVariables *var2);
 
+/**
+ * Compile \c vars into a flat layout.
+ *
+ * Once the set of parameters no longer changes, the values of all
+ * variables are moved into one contiguous array of REAL8 slots (a
+ * variable occupies as many slots as its type needs) and a slot is
+ * assigned to each name.  The name-based accessors keep working; in
+ * addition
+ * - LALInferenceCopyVariables() between two structures sharing the same
+ *   layout is a single memcpy of the slot array, plus a deep copy of any
+ *   matrix or vector variables, and does not allocate;
+ * - a structure copied from a compiled one adopts its layout;
+ * - variables can be accessed in O(1) through a LALInferenceVariableHandle.
+ *
+ * Adding or removing a variable, or changing its type, turns \c vars back
+ * into an ordinary list, keeping all values, and invalidates all handles
+ * into it.  LALInferenceCopyVariables() does not modify its origin: the
+ * target of a copy from such a structure is compiled, with a new layout,
+ * and the structure itself adopts that layout the next time it is the
+ * target of a copy from a compiled one.  To invalidate a REAL8 output
+ * without changing the layout, set it to NaN instead of removing it, as
+ * LALInferenceNestedSamplingSloppySample() does; code reading such an
+ * output must then treat NaN as missing.
+ */
+int LALInferenceCompileVariables(LALInferenceVariables *vars);
+
+/**
+ * Compile \c vars with the layout of the compiled structure \c reference,
+ * which must contain the same variables, so that the two can be copied
+ * into each other slot by slot
+ */
+int LALInferenceCompileVariablesLike(LALInferenceVariables *vars, const LALInferenceVariables *reference);
+
+/** Returns 1 if \c vars has a valid compiled layout, 0 otherwise */
+int LALInferenceVariablesIsCompiled(const LALInferenceVariables *vars);
+
+/**
+ * Return a handle to the variable \c name of the compiled structure \c vars.
+ * On failure the handle has a NULL layout and an XLAL error is raised.
+ */
+LALInferenceVariableHandle LALInferenceGetVariableHandle(const LALInferenceVariables *vars, const char *name);
+
+/** Returns 1 if \c handle can be used with \c vars, 0 otherwise */
+int LALInferenceCheckVariableHandle(const LALInferenceVariables *vars, LALInferenceVariableHandle handle);
+
+/** Return a pointer to the value of the variable referred to by \c handle */
+void *LALInferenceGetVariableByHandle(const LALInferenceVariables *vars, LALInferenceVariableHandle handle);
+
+/** Return the value of the REAL8 variable referred to by \c handle */
+REAL8 LALInferenceGetREAL8VariableByHandle(const LALInferenceVariables *vars, LALInferenceVariableHandle handle);
+
+/**
+ * Set the REAL8 variable referred to by \c handle.
+ * As for LALInferenceSetVariable(), fixed variables are not changed.
+ */
+void LALInferenceSetREAL8VariableByHandle(LALInferenceVariables *vars, LALInferenceVariableHandle handle, REAL8 value);
+
 /** Computes the factor relating the physical waveform to a measured
     waveform for a spline-fit calibration model in amplitude and
     phase.  The spline points can be arbitrary frequencies, and the
@@ -366,6 +449,53 @@ int LALInferenceSplineCalibrationFactorROQ(REAL8Vector *logfreqs,
 					REAL8Sequence *freqNodesQuad,
 					COMPLEX16Sequence **calFactorROQQuad);
 
+/**
+ * Spline calibration envelope for repeated evaluation at a fixed set of
+ * frequencies.
+ *
+ * The natural cubic spline through the node values is linear in those
+ * values, so the interval containing each frequency and its weights on the
+ * values and second derivatives at the ends of that interval are computed
+ * once, together with the matrix giving the second derivatives from the node
+ * values.  Each evaluation then costs one small matrix-vector product per
+ * node set and four multiply-adds per frequency, and is skipped altogether
+ * when the node values have not changed since the last one.  The factors
+ * agree with LALInferenceSplineCalibrationFactor() to rounding.
+ */
+typedef struct tagLALInferenceSplineCalibrationBasis
+{
+  UINT4 nnodes;               /**< Number of spline nodes */
+  UINT4 npoints;              /**< Number of frequencies the envelope is evaluated at */
+  REAL8 *logfreqs;            /**< Node log-frequencies the basis was built for */
+  REAL8 *curvature;           /**< nnodes x nnodes matrix giving the second derivatives of the spline from the node values */
+  UINT4 *interval;            /**< Spline interval containing each frequency */
+  REAL8 *weights;             /**< Four weights per frequency, all zero outside the nodes */
+  REAL8 *amps;                /**< Node amplitudes \c factors was computed for */
+  REAL8 *phases;              /**< Node phases \c factors was computed for */
+  COMPLEX16Sequence *factors; /**< Calibration factor at each frequency */
+  UINT4 generation;           /**< Incremented each time \c factors changes */
+} LALInferenceSplineCalibrationBasis;
+
+/** Build the spline basis for nodes at \c logfreqs evaluated at the \c npoints frequencies \c freqs */
+LALInferenceSplineCalibrationBasis *LALInferenceCreateSplineCalibrationBasis(const REAL8Vector *logfreqs, const REAL8 *freqs, UINT4 npoints);
+
+/** Free a spline calibration basis */
+void LALInferenceDestroySplineCalibrationBasis(LALInferenceSplineCalibrationBasis *basis);
+
+/** Returns 1 if \c basis was built for nodes at \c logfreqs and \c npoints frequencies, 0 otherwise */
+int LALInferenceSplineCalibrationBasisMatches(const LALInferenceSplineCalibrationBasis *basis, const REAL8Vector *logfreqs, UINT4 npoints);
+
+/**
+ * Evaluate the calibration factors of \c nbases detectors in one call, as in
+ * LALInferenceSplineCalibrationFactor().  The factors of detector \c i are
+ * left in <tt>bases[i]->factors</tt>, and are only recomputed if
+ * \c deltaAmps[i] or \c deltaPhases[i] differ from the previous call.
+ */
+int LALInferenceSplineCalibrationEvaluate(LALInferenceSplineCalibrationBasis **bases,
+					REAL8Vector **deltaAmps,
+					REAL8Vector **deltaPhases,
+					UINT4 nbases);
+
 
 //Wrapper for template computation
 //(relies on LAL libraries for implementation) <- could be a #DEFINE ?
@@ -463,6 +593,9 @@ typedef struct tagLALInferenceModel
   struct tagLALInferenceROQModel *roq; /** ROQ data */
   int roq_flag;               /** Is ROQ enabled */
   LALSimNeutronStarFamily     *eos_fam; /** Neutron Star equation of state family */
+  struct tagLALInferenceFusedBins *fusedBins; /** Interleaved data, noise weights and calibration used by the fused likelihood kernel */
+  struct tagLALInferenceSplineCalibrationCache *splineCalibration; /** Spline calibration bases and factors of each detector */
+  struct tagLALInferenceRelativeBinningModel *relbin; /** Relative binning buffers, NULL unless the relative binning likelihood is used */
 
 } LALInferenceModel;
 
@@ -655,6 +788,7 @@ tagLALInferenceIFOData
   UINT4                     likeli_counter; /** counts how many time the likelihood has been calculated */
   UINT4                     templa_counter; /** counts how many time the template has been calculated */
   struct tagLALInferenceROQData *roq; /** ROQ data */
+  struct tagLALInferenceRelativeBinningData *relbin; /** Relative binning summary data */
 
   struct tagLALInferenceIFOData      *next;     /** A pointer to the next set of data for linked list */
 } LALInferenceIFOData;
@@ -730,6 +864,33 @@ tagLALInferenceROQModel
 
 } LALInferenceROQModel;
 
+/**
+ * Structure to contain model-related relative binning quantities
+ */
+typedef struct
+tagLALInferenceRelativeBinningModel
+{
+  REAL8Sequence *binEdges; /** Bin edge frequencies, shared by all detectors */
+  REAL8Sequence *frequencies; /** Frequencies at which the template function evaluates the waveform, normally binEdges */
+  COMPLEX16FrequencySeries *hptilde; /** h+ at the frequencies */
+  COMPLEX16FrequencySeries *hctilde; /** hx at the frequencies */
+  COMPLEX16Sequence *hEdges; /** Projected, time-shifted waveform at the bin edges */
+  COMPLEX16Sequence *r0; /** Ratio to the fiducial waveform at the bin centres */
+  COMPLEX16Sequence *r1; /** Slope of the ratio in each bin */
+  COMPLEX16Sequence *calFactor; /** Spline calibration factors at the bin edges */
+} LALInferenceRelativeBinningModel;
+
+/**
+ * Structure to contain data-related relative binning quantities
+ */
+typedef struct
+tagLALInferenceRelativeBinningData
+{
+  LALSimInspiralRelativeBinningSummary *summary; /** Summary data of the fiducial waveform against the data */
+  COMPLEX16Sequence *h0Edges; /** Projected, time-shifted fiducial waveform at the bin edges */
+  REAL8 dd; /** Half the noise-weighted power <d|d>/2 of the data over the detector band */
+} LALInferenceRelativeBinningData;
+
 /**
  * Structure to contain data-related Reduced Order Quadrature quantities
  */
@@ -739,6 +900,13 @@ LALInferenceThreadState *LALInferenceInitThread(LALInferenceThreadState *thread)
 /* Initialize a bunch of threads using LALInferenceInitThread */
 LALInferenceThreadState *LALInferenceInitThreads(INT4 nthreads);
 
+/**
+ * Free \c model and the buffers it owns, including the workspaces the
+ * likelihood functions attach to it.  The window and FFT plans, which are
+ * those of the data, are not freed.
+ */
+void LALInferenceDestroyModel(LALInferenceModel *model);
+
 /** Returns the element of the process params table with "name" */
 ProcessParamsTable *LALInferenceGetProcParamVal(ProcessParamsTable *procparams,const char *name);
 
@@ -779,7 +947,7 @@ LALInferenceVariableItem *LALInferenceGetItem(const LALInferenceVariables *vars,
  * Return the list node for the idx-th item - do not rely on this
  * Indexing starts at 1
  */
-LALInferenceVariableItem *LALInferenceGetItemNr(LALInferenceVariables *vars, int idx);
+LALInferenceVariableItem *LALInferenceGetItemNr(const LALInferenceVariables *vars, int idx);
 
 /**
  * Pop the list node for "name". Returns a pointer to the node, which is removed from vars
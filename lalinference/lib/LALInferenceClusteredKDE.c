@@ -703,6 +703,12 @@ void LALInferenceKmeansRandomPartitionInitialize(LALInferenceKmeans *kmeans) {
         kmeans->assignments[i] = cluster_id;
     }
 
+    /* Distance bounds refer to the previous assignments */
+    if (kmeans->bound_centroids) {
+        gsl_matrix_free(kmeans->bound_centroids);
+        kmeans->bound_centroids = NULL;
+    }
+
     LALInferenceKmeansUpdate(kmeans);
 }
 
@@ -713,10 +719,68 @@ void LALInferenceKmeansRandomPartitionInitialize(LALInferenceKmeans *kmeans) {
  * Assign all data to the closest centroid and calculate the error, defined
  * as the cumulative sum of the distance between all points and their closest
  * centroid.
+ *
+ * For the default Euclidean distance, a lower bound on the distance from each
+ * point to its second-closest centroid is carried between iterations and
+ * loosened by how far the centroids have moved since (Hamerly's algorithm).
+ * A point whose distance to its current centroid is below that bound, or below
+ * half the distance from its centroid to any other, cannot change cluster, so
+ * only one distance is computed for it.  Assignments and error are identical
+ * to a full search.
  * @param kmeans The kmeans to perform the assignment step on.
  */
 void LALInferenceKmeansAssignment(LALInferenceKmeans *kmeans) {
     INT4 i, j;
+    INT4 use_bounds = (kmeans->dist == &euclidean_dist_squared);
+
+    REAL8 *shifts = NULL;
+    REAL8 *half_seps = NULL;
+    REAL8 max_shift = 0., second_shift = 0.;
+    INT4 max_shift_cluster = -1;
+
+    /* Bounds can only be carried over if the clusters are the ones they were computed for */
+    INT4 have_bounds = use_bounds && kmeans->bound_centroids && kmeans->lower_dists &&
+                        (INT4)kmeans->bound_centroids->size1 == kmeans->k;
+
+    if (use_bounds) {
+        shifts = XLALCalloc(kmeans->k, sizeof(REAL8));
+        half_seps = XLALCalloc(kmeans->k, sizeof(REAL8));
+
+        /* How far each centroid has moved since the bounds were computed */
+        if (have_bounds) {
+            for (j = 0; j < kmeans->k; j++) {
+                gsl_vector_view c = gsl_matrix_row(kmeans->centroids, j);
+                gsl_vector_view c_old = gsl_matrix_row(kmeans->bound_centroids, j);
+                shifts[j] = sqrt(euclidean_dist_squared(&c.vector, &c_old.vector));
+
+                if (shifts[j] > max_shift) {
+                    second_shift = max_shift;
+                    max_shift = shifts[j];
+                    max_shift_cluster = j;
+                } else if (shifts[j] > second_shift) {
+                    second_shift = shifts[j];
+                }
+            }
+        }
+
+        /* Half the distance from each centroid to its closest neighbour */
+        for (j = 0; j < kmeans->k; j++)
+            half_seps[j] = INFINITY;
+
+        for (j = 0; j < kmeans->k; j++) {
+            gsl_vector_view c = gsl_matrix_row(kmeans->centroids, j);
+            for (INT4 l = j+1; l < kmeans->k; l++) {
+                gsl_vector_view c_other = gsl_matrix_row(kmeans->centroids, l);
+                REAL8 half_sep = 0.5 * sqrt(euclidean_dist_squared(&c.vector, &c_other.vector));
+
+                if (half_sep < half_seps[j]) half_seps[j] = half_sep;
+                if (half_sep < half_seps[l]) half_seps[l] = half_sep;
+            }
+        }
+
+        if (!kmeans->lower_dists)
+            kmeans->lower_dists = XLALCalloc(kmeans->npts, sizeof(REAL8));
+    }
 
     kmeans->error = 0.;
 
@@ -724,23 +788,46 @@ void LALInferenceKmeansAssignment(LALInferenceKmeans *kmeans) {
         gsl_vector_view x = gsl_matrix_row(kmeans->data, i);
         gsl_vector_view c;
 
+        INT4 current_cluster = kmeans->assignments[i];
         INT4 best_cluster = 0;
         REAL8 best_dist = INFINITY;
+        REAL8 second_dist = INFINITY;
         REAL8 dist;
 
+        if (have_bounds) {
+            /* Loosen the lower bound by the largest shift of any other centroid */
+            REAL8 other_shift = current_cluster == max_shift_cluster ? second_shift : max_shift;
+            kmeans->lower_dists[i] -= other_shift;
+
+            c = gsl_matrix_row(kmeans->centroids, current_cluster);
+            best_dist = kmeans->dist(&x.vector, &c.vector);
+            REAL8 upper = sqrt(best_dist);
+
+            if (upper < half_seps[current_cluster] || upper < kmeans->lower_dists[i]) {
+                kmeans->error += best_dist;
+                continue;
+            }
+            best_dist = INFINITY;
+        }
+
         /* Find the closest centroid */
         for (j = 0; j < kmeans->k; j++) {
             c = gsl_matrix_row(kmeans->centroids, j);
             dist = kmeans->dist(&x.vector, &c.vector);
 
             if (dist < best_dist) {
+                second_dist = best_dist;
                 best_cluster = j;
                 best_dist = dist;
+            } else if (dist < second_dist) {
+                second_dist = dist;
             }
         }
 
+        if (use_bounds)
+            kmeans->lower_dists[i] = sqrt(second_dist);
+
         /* Check if the point's assignment has changed */
-        INT4 current_cluster = kmeans->assignments[i];
         if (best_cluster != current_cluster) {
             kmeans->has_changed = 1;
             kmeans->assignments[i] = best_cluster;
@@ -748,6 +835,19 @@ void LALInferenceKmeansAssignment(LALInferenceKmeans *kmeans) {
         kmeans->error += best_dist;
     }
 
+    /* Remember which centroids the bounds refer to */
+    if (use_bounds) {
+        if (!have_bounds) {
+            if (kmeans->bound_centroids)
+                gsl_matrix_free(kmeans->bound_centroids);
+            kmeans->bound_centroids = gsl_matrix_alloc(kmeans->k, kmeans->dim);
+        }
+        gsl_matrix_memcpy(kmeans->bound_centroids, kmeans->centroids);
+
+        XLALFree(shifts);
+        XLALFree(half_seps);
+    }
+
     /* Recalculate cluster sizes */
     for (i = 0; i < kmeans->k; i++)
         kmeans->sizes[i] = 0;
@@ -1305,7 +1405,12 @@ REAL8 LALInferenceKmeansBIC(LALInferenceKmeans *kmeans) {
     REAL8 N = (REAL8) kmeans->npts;
     REAL8 d = (REAL8) kmeans->dim;
 
+    /* Build the cluster KDEs up front so the points can be evaluated in parallel */
+    if (kmeans->KDEs == NULL)
+        LALInferenceKmeansBuildKDE(kmeans);
+
     log_l = 0.;
+    #pragma omp parallel for reduction(+:log_l)
     for (i = 0; i < kmeans->npts; i++) {
         gsl_vector_view pt = gsl_matrix_row(kmeans->data, i);
         log_l += LALInferenceWhitenedKmeansPDF(kmeans, (&pt.vector)->data);
@@ -1341,12 +1446,15 @@ void LALInferenceKmeansDestroy(LALInferenceKmeans *kmeans) {
         if (kmeans->data) gsl_matrix_free(kmeans->data);
         if (kmeans->recursive_centroids)
             gsl_matrix_free(kmeans->recursive_centroids);
+        if (kmeans->bound_centroids)
+            gsl_matrix_free(kmeans->bound_centroids);
 
         /* Free non-GSL arrays */
         XLALFree(kmeans->assignments);
         XLALFree(kmeans->mask);
         XLALFree(kmeans->weights);
         XLALFree(kmeans->sizes);
+        XLALFree(kmeans->lower_dists);
 
         /* If KDEs are defined, free all of them */
         if (kmeans->KDEs != NULL) {
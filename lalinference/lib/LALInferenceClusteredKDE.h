@@ -58,6 +58,9 @@ tagkmeans
 
     REAL8 error;                         /**< Error of current clustering */
 
+    REAL8 *lower_dists;                  /**< Lower bounds on the distance from each point to its second-closest centroid */
+    gsl_matrix *bound_centroids;         /**< Centroids at the time \c lower_dists was computed */
+
     LALInferenceKDE **KDEs;              /**< Array of KDEs, one for each cluster */
 } LALInferenceKmeans;
 
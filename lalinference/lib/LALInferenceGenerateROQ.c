@@ -21,6 +21,14 @@
 
 #include <lal/LALInferenceGenerateROQ.h>
 #include <lal/XLALGSL.h>
+#include <lal/LogPrintf.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #ifndef _OPENMP
 #define omp ignore
@@ -1134,6 +1142,522 @@ REAL8 LALInferenceGenerateCOMPLEX16OrthonormalBasis(COMPLEX16Array **RBin,
 }
 
 
+/* ============ Blocked greedy basis construction ========== */
+
+/* The training set is kept unnormalised (it may be a read-only mapped
+   file), so each row carries the inverse of its norm, and the basis is also
+   held premultiplied by the weights and conjugated, so that projecting a
+   block of rows onto it is a single BLAS product.  Real and complex sets
+   share the code, with ncomp = 1 or 2 doubles per sample. */
+
+#define ROQ_CHECKPOINT_MAGIC "LALROQRB"
+#define ROQ_CHECKPOINT_VERSION 1
+#define ROQ_DEFAULT_BLOCK_ROWS 256
+#define ROQ_MAX_REORTHOGONALISATIONS 8
+
+typedef struct tagROQGreedyState {
+  const LALInferenceROQTrainingSet *TS;
+  UINT4 ncomp, rowlen;  /* doubles per sample and per row */
+  UINT4 blockRows;
+  REAL8 *w;             /* weights expanded to one per sample */
+  REAL8 *invnorm;       /* inverse norm of each row (0 for a null row) */
+  REAL8 *projnorm2;     /* squared norm of the projection of each normalised row */
+  REAL8 *proj;          /* projections onto the newest basis vector */
+  REAL8 *RB, *WRB;      /* basis, and conj(weight * basis) */
+  UINT4 dim, capacity;
+  UINT4 *gpts;
+  REAL8 worst_err;
+  INT4 complete;
+} ROQGreedyState;
+
+static const REAL8 *roq_row(const ROQGreedyState *s, size_t i)
+{
+  return s->TS->data + i * s->rowlen;
+}
+
+/* Squared weighted norm of one row */
+static REAL8 roq_norm2(const ROQGreedyState *s, const REAL8 *x)
+{
+  REAL8 n2 = 0.;
+  for (UINT4 j = 0; j < s->TS->cols; j++)
+    for (UINT4 c = 0; c < s->ncomp; c++)
+      n2 += s->w[j] * x[j*s->ncomp + c] * x[j*s->ncomp + c];
+  return n2;
+}
+
+/* proj = rows * v for one block of rows, v being a row of WRB */
+static void roq_gemv_block(const ROQGreedyState *s, size_t start, size_t n, const REAL8 *v, REAL8 *proj)
+{
+  if (s->ncomp == 1) {
+    cblas_dgemv(CblasRowMajor, CblasNoTrans, n, s->TS->cols, 1., roq_row(s, start), s->TS->cols, v, 1, 0., proj, 1);
+  } else {
+    const REAL8 one[2] = {1., 0.}, zero[2] = {0., 0.};
+    cblas_zgemv(CblasRowMajor, CblasNoTrans, n, s->TS->cols, one, roq_row(s, start), s->TS->cols, v, 1, zero, proj, 1);
+  }
+}
+
+/* Add the projections of every row onto the newest basis vector */
+static void roq_project_newest(ROQGreedyState *s)
+{
+  const size_t rows = s->TS->rows, nblocks = (rows + s->blockRows - 1) / s->blockRows;
+  const REAL8 *v = s->WRB + (size_t)(s->dim - 1) * s->rowlen;
+
+  #pragma omp parallel for schedule(dynamic)
+  for (size_t b = 0; b < nblocks; b++) {
+    size_t start = b * s->blockRows, n = start + s->blockRows > rows ? rows - start : s->blockRows;
+    REAL8 *p = s->proj + start * s->ncomp;
+    roq_gemv_block(s, start, n, v, p);
+    for (size_t i = 0; i < n; i++) {
+      REAL8 p2 = p[i*s->ncomp] * p[i*s->ncomp];
+      if (s->ncomp == 2) p2 += p[i*2 + 1] * p[i*2 + 1];
+      s->projnorm2[start + i] += p2 * s->invnorm[start + i] * s->invnorm[start + i];
+    }
+  }
+}
+
+/* Projections onto a whole (resumed) basis, a matrix product per block */
+static int roq_project_all(ROQGreedyState *s)
+{
+  const size_t rows = s->TS->rows, nblocks = (rows + s->blockRows - 1) / s->blockRows;
+  INT4 failed = 0;
+
+  #pragma omp parallel for schedule(dynamic)
+  for (size_t b = 0; b < nblocks; b++) {
+    size_t start = b * s->blockRows, n = start + s->blockRows > rows ? rows - start : s->blockRows;
+    REAL8 *P = XLALMalloc(n * s->dim * s->ncomp * sizeof(REAL8));
+    if (!P) {
+      #pragma omp atomic write
+      failed = 1;
+      continue;
+    }
+    if (s->ncomp == 1) {
+      cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasTrans, n, s->dim, s->TS->cols, 1., roq_row(s, start), s->TS->cols,
+                  s->WRB, s->TS->cols, 0., P, s->dim);
+    } else {
+      const REAL8 one[2] = {1., 0.}, zero[2] = {0., 0.};
+      cblas_zgemm(CblasRowMajor, CblasNoTrans, CblasTrans, n, s->dim, s->TS->cols, one, roq_row(s, start), s->TS->cols,
+                  s->WRB, s->TS->cols, zero, P, s->dim);
+    }
+    for (size_t i = 0; i < n; i++) {
+      REAL8 p2 = 0.;
+      for (size_t k = 0; k < s->dim * s->ncomp; k++)
+        p2 += P[i * s->dim * s->ncomp + k] * P[i * s->dim * s->ncomp + k];
+      s->projnorm2[start + i] = p2 * s->invnorm[start + i] * s->invnorm[start + i];
+    }
+    XLALFree(P);
+  }
+  XLAL_CHECK(!failed, XLAL_ENOMEM);
+  return XLAL_SUCCESS;
+}
+
+/* Append a normalised vector to the basis */
+static int roq_append(ROQGreedyState *s, const REAL8 *v)
+{
+  if (s->dim == s->capacity) {
+    UINT4 capacity = s->capacity ? 2 * s->capacity : 16;
+    REAL8 *RB = XLALRealloc(s->RB, (size_t)capacity * s->rowlen * sizeof(REAL8));
+    XLAL_CHECK(RB, XLAL_ENOMEM);
+    s->RB = RB;
+    REAL8 *WRB = XLALRealloc(s->WRB, (size_t)capacity * s->rowlen * sizeof(REAL8));
+    XLAL_CHECK(WRB, XLAL_ENOMEM);
+    s->WRB = WRB;
+    s->capacity = capacity;
+  }
+  REAL8 *rb = s->RB + (size_t)s->dim * s->rowlen, *wrb = s->WRB + (size_t)s->dim * s->rowlen;
+  memcpy(rb, v, s->rowlen * sizeof(REAL8));
+  for (UINT4 j = 0; j < s->TS->cols; j++) {
+    wrb[j*s->ncomp] = s->w[j] * v[j*s->ncomp];
+    if (s->ncomp == 2) wrb[j*2 + 1] = -s->w[j] * v[j*2 + 1];
+  }
+  s->dim++;
+  return XLAL_SUCCESS;
+}
+
+/* Orthonormalise v against the basis by classical Gram-Schmidt, repeated
+   while a pass removes more than half of the norm as in the iterated
+   modified Gram-Schmidt of iterated_modified_gm(); returns the final norm */
+static REAL8 roq_orthonormalise(const ROQGreedyState *s, REAL8 *v, REAL8 *c)
+{
+  REAL8 nrm = 1.;
+  for (UINT4 it = 0; it < ROQ_MAX_REORTHOGONALISATIONS; it++) {
+    if (s->ncomp == 1) {
+      cblas_dgemv(CblasRowMajor, CblasNoTrans, s->dim, s->TS->cols, 1., s->WRB, s->TS->cols, v, 1, 0., c, 1);
+      cblas_dgemv(CblasRowMajor, CblasTrans, s->dim, s->TS->cols, -1., s->RB, s->TS->cols, c, 1, 1., v, 1);
+    } else {
+      const REAL8 one[2] = {1., 0.}, mone[2] = {-1., 0.}, zero[2] = {0., 0.};
+      cblas_zgemv(CblasRowMajor, CblasNoTrans, s->dim, s->TS->cols, one, s->WRB, s->TS->cols, v, 1, zero, c, 1);
+      cblas_zgemv(CblasRowMajor, CblasTrans, s->dim, s->TS->cols, mone, s->RB, s->TS->cols, c, 1, one, v, 1);
+    }
+    nrm = sqrt(roq_norm2(s, v));
+    if (!(nrm > 0.)) return nrm;
+    for (UINT4 j = 0; j < s->rowlen; j++) v[j] /= nrm;
+    if (nrm > 0.5) break;
+  }
+  return nrm;
+}
+
+static int roq_write_checkpoint(const ROQGreedyState *s, const CHAR *filename)
+{
+  CHAR tmpname[FILENAME_MAX];
+  UINT4 header[6] = {ROQ_CHECKPOINT_VERSION, s->ncomp == 2, s->TS->rows, s->TS->cols, s->dim, s->complete};
+  XLAL_CHECK(snprintf(tmpname, sizeof(tmpname), "%s.tmp", filename) < (int)sizeof(tmpname), XLAL_EINVAL, "Checkpoint file name too long");
+  FILE *fp = fopen(tmpname, "wb");
+  XLAL_CHECK(fp, XLAL_EIO, "Could not open '%s' for writing", tmpname);
+  int ok = fwrite(ROQ_CHECKPOINT_MAGIC, 1, 8, fp) == 8
+        && fwrite(header, sizeof(UINT4), 6, fp) == 6
+        && fwrite(&s->worst_err, sizeof(REAL8), 1, fp) == 1
+        && fwrite(s->gpts, sizeof(UINT4), s->dim, fp) == s->dim
+        && fwrite(s->RB, sizeof(REAL8) * s->rowlen, s->dim, fp) == s->dim;
+  ok = (fclose(fp) == 0) && ok;
+  XLAL_CHECK(ok, XLAL_EIO, "Could not write checkpoint '%s'", tmpname);
+  /* Replace the previous checkpoint only once the new one is complete */
+  XLAL_CHECK(rename(tmpname, filename) == 0, XLAL_EIO, "Could not rename '%s' to '%s'", tmpname, filename);
+  return XLAL_SUCCESS;
+}
+
+/* Returns 1 if a checkpoint was read, 0 if there is none */
+static int roq_read_checkpoint(ROQGreedyState *s, const CHAR *filename)
+{
+  CHAR magic[8];
+  UINT4 header[6];
+  FILE *fp = fopen(filename, "rb");
+  if (!fp) return 0;
+  int ok = fread(magic, 1, 8, fp) == 8 && memcmp(magic, ROQ_CHECKPOINT_MAGIC, 8) == 0
+        && fread(header, sizeof(UINT4), 6, fp) == 6 && fread(&s->worst_err, sizeof(REAL8), 1, fp) == 1;
+  if (ok && (header[0] != ROQ_CHECKPOINT_VERSION || header[1] != (s->ncomp == 2) || header[2] != s->TS->rows
+             || header[3] != s->TS->cols || header[4] == 0 || header[4] > s->TS->rows)) {
+    fclose(fp);
+    XLAL_ERROR(XLAL_EINVAL, "Checkpoint '%s' does not belong to this training set", filename);
+  }
+  REAL8 *v = ok ? XLALMalloc(s->rowlen * sizeof(REAL8)) : NULL;
+  ok = ok && v && fread(s->gpts, sizeof(UINT4), header[4], fp) == header[4];
+  for (UINT4 k = 0; ok && k < header[4]; k++)
+    if (s->gpts[k] >= s->TS->rows) {
+      XLALFree(v);
+      fclose(fp);
+      XLAL_ERROR(XLAL_EINVAL, "Checkpoint '%s' refers to training set element %u of %u", filename, s->gpts[k], s->TS->rows);
+    }
+  for (UINT4 k = 0; ok && k < header[4]; k++)
+    ok = fread(v, sizeof(REAL8), s->rowlen, fp) == s->rowlen && roq_append(s, v) == XLAL_SUCCESS;
+  XLALFree(v);
+  fclose(fp);
+  XLAL_CHECK(ok, XLAL_EIO, "Could not read checkpoint '%s'", filename);
+  s->complete = header[5];
+  return 1;
+}
+
+/* The buffers of the state are freed by roq_greedy_state_free(), also on
+   error; the work buffers are freed here */
+static REAL8 roq_greedy_blocked(ROQGreedyState *s, const REAL8Vector *delta, REAL8 tolerance,
+                                const LALInferenceROQGreedySettings *settings)
+{
+  const LALInferenceROQTrainingSet *TS = s->TS;
+  const size_t rows = TS->rows, cols = TS->cols;
+  const CHAR *checkpoint = settings ? settings->checkpointFile : NULL;
+  const UINT4 every = settings ? settings->checkpointEvery : 0;
+  const INT4 verbose = settings ? settings->verbose : 0;
+  REAL8 *v = NULL, *c = NULL;
+  UCHAR *used = NULL;
+
+  XLAL_CHECK_REAL8(delta != NULL && (delta->length == 1 || delta->length == cols), XLAL_EINVAL,
+                   "Vector of weights must either contain a single value, or be the same length as the training set rows.");
+  XLAL_CHECK_REAL8(rows > 0 && cols > 0, XLAL_EINVAL, "Empty training set");
+
+  s->blockRows = settings && settings->blockRows ? settings->blockRows : ROQ_DEFAULT_BLOCK_ROWS;
+  s->w = XLALMalloc(cols * sizeof(REAL8));
+  s->invnorm = XLALMalloc(rows * sizeof(REAL8));
+  s->projnorm2 = XLALCalloc(rows, sizeof(REAL8));
+  s->proj = XLALMalloc(rows * s->ncomp * sizeof(REAL8));
+  s->gpts = XLALMalloc(rows * sizeof(UINT4));
+  v = XLALMalloc(s->rowlen * sizeof(REAL8));
+  c = XLALMalloc(rows * s->ncomp * sizeof(REAL8));
+  used = XLALCalloc(rows, sizeof(UCHAR));
+  XLAL_CHECK_FAIL(s->w && s->invnorm && s->projnorm2 && s->proj && s->gpts && v && c && used, XLAL_ENOMEM);
+
+  for (size_t j = 0; j < cols; j++)
+    s->w[j] = delta->data[delta->length == 1 ? 0 : j];
+
+  #pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < rows; i++) {
+    REAL8 n2 = roq_norm2(s, roq_row(s, i));
+    s->invnorm[i] = n2 > 0. ? 1. / sqrt(n2) : 0.;
+  }
+
+  REAL8 t0 = XLALGetTimeOfDay();
+  int resumed = checkpoint ? roq_read_checkpoint(s, checkpoint) : 0;
+  XLAL_CHECK_FAIL(resumed >= 0, XLAL_EFUNC);
+  if (resumed) {
+    if (!s->complete)
+      XLAL_CHECK_FAIL(roq_project_all(s) == XLAL_SUCCESS, XLAL_EFUNC);
+    if (verbose)
+      fprintf(stderr, "Resumed reduced basis with %u bases from '%s' (%.3f s)\n", s->dim, checkpoint, XLALGetTimeOfDay() - t0);
+  } else {
+    /* initialise with the first training set element */
+    XLAL_CHECK_FAIL(s->invnorm[0] > 0., XLAL_EINVAL, "First training set element is zero");
+    for (UINT4 j = 0; j < s->rowlen; j++) v[j] = roq_row(s, 0)[j] * s->invnorm[0];
+    XLAL_CHECK_FAIL(roq_append(s, v) == XLAL_SUCCESS, XLAL_EFUNC);
+    s->gpts[0] = 0;
+    s->worst_err = 1.;
+    s->complete = (rows == 1);
+    if (!s->complete) roq_project_newest(s);
+  }
+  for (UINT4 k = 0; k < s->dim; k++) used[s->gpts[k]] = 1;
+
+  UINT4 iteration = 0;
+  while (!s->complete) {
+    REAL8 tstart = XLALGetTimeOfDay();
+    UINT4 worst_app = 0;
+
+    /* find worst represented training set element */
+    s->worst_err = 0.;
+    for (size_t i = 0; i < rows; i++) {
+      REAL8 err = s->invnorm[i] > 0. ? 1. - s->projnorm2[i] : 0.;
+      if (s->worst_err < err) {
+        s->worst_err = err;
+        worst_app = i;
+      }
+    }
+
+    /* during enrichment every new element is added, even if represented well */
+    if (tolerance == 0. && used[worst_app]) {
+      for (size_t i = 0; i < rows; i++)
+        if (!used[i]) { worst_app = i; break; }
+    }
+
+    for (UINT4 j = 0; j < s->rowlen; j++) v[j] = roq_row(s, worst_app)[j] * s->invnorm[worst_app];
+    REAL8 nrm = roq_orthonormalise(s, v, c);
+    REAL8 tortho = XLALGetTimeOfDay();
+
+    /* a zero residual with the current basis means nothing can be added */
+    if (!(nrm > 0.) || isnan(nrm)) {
+      s->complete = 1;
+    } else {
+      XLAL_CHECK_FAIL(roq_append(s, v) == XLAL_SUCCESS, XLAL_EFUNC);
+      s->gpts[s->dim - 1] = worst_app;
+      used[worst_app] = 1;
+      if (s->dim == rows || s->worst_err < tolerance)
+        s->complete = 1;
+      else
+        roq_project_newest(s);
+    }
+    iteration++;
+
+    if (verbose) {
+      REAL8 tend = XLALGetTimeOfDay();
+      fprintf(stderr, "Greedy iteration %u: %u bases, max. projection err. = %le, %.3f s (orthogonalisation %.3f s, projection %.3f s)\n",
+              iteration, s->dim, s->worst_err, tend - tstart, tortho - tstart, tend - tortho);
+    }
+    if (checkpoint && (s->complete || (every && iteration % every == 0)))
+      XLAL_CHECK_FAIL(roq_write_checkpoint(s, checkpoint) == XLAL_SUCCESS, XLAL_EFUNC);
+  }
+
+  XLALFree(v);
+  XLALFree(c);
+  XLALFree(used);
+  return s->worst_err;
+
+XLAL_FAIL:
+  XLALFree(v);
+  XLALFree(c);
+  XLALFree(used);
+  return XLAL_REAL8_FAIL_NAN;
+}
+
+static void roq_greedy_state_free(ROQGreedyState *s)
+{
+  XLALFree(s->w);
+  XLALFree(s->invnorm);
+  XLALFree(s->projnorm2);
+  XLALFree(s->proj);
+  XLALFree(s->RB);
+  XLALFree(s->WRB);
+  XLALFree(s->gpts);
+}
+
+/**
+ * \brief Wrap a training set held in a \c REAL8Array, without copying it
+ *
+ * The array must outlive the returned training set, which should be freed
+ * with \c LALInferenceDestroyROQTrainingSet.
+ */
+LALInferenceROQTrainingSet *LALInferenceROQTrainingSetFromREAL8Array(REAL8Array *TS){
+  XLAL_CHECK_NULL( TS != NULL && TS->dimLength->length == 2, XLAL_EINVAL, "Training set must be a two dimensional array" );
+  LALInferenceROQTrainingSet *set = XLALCalloc(1, sizeof(*set));
+  XLAL_CHECK_NULL( set != NULL, XLAL_ENOMEM );
+  set->rows = TS->dimLength->data[0];
+  set->cols = TS->dimLength->data[1];
+  set->data = TS->data;
+  return set;
+}
+
+/**
+ * \brief Wrap a training set held in a \c COMPLEX16Array, without copying it
+ *
+ * The array must outlive the returned training set, which should be freed
+ * with \c LALInferenceDestroyROQTrainingSet.
+ */
+LALInferenceROQTrainingSet *LALInferenceROQTrainingSetFromCOMPLEX16Array(COMPLEX16Array *TS){
+  XLAL_CHECK_NULL( TS != NULL && TS->dimLength->length == 2, XLAL_EINVAL, "Training set must be a two dimensional array" );
+  LALInferenceROQTrainingSet *set = XLALCalloc(1, sizeof(*set));
+  XLAL_CHECK_NULL( set != NULL, XLAL_ENOMEM );
+  set->rows = TS->dimLength->data[0];
+  set->cols = TS->dimLength->data[1];
+  set->complexData = 1;
+  set->data = (REAL8 *)TS->data;
+  return set;
+}
+
+/**
+ * \brief Memory-map a training set stored in a file
+ *
+ * The file holds the training set waveforms one after the other as native
+ * double precision numbers, with the real and imaginary parts of each
+ * sample adjacent for a complex training set, i.e. the memory layout of a
+ * \c REAL8Array or \c COMPLEX16Array written out with \c fwrite.  The
+ * number of waveforms is given by the size of the file.  The file is
+ * mapped read-only, so training sets larger than the available memory are
+ * paged in from disk as the greedy algorithm sweeps through them.
+ *
+ * @param[in] filename The training set file
+ * @param[in] cols The number of points in each waveform
+ * @param[in] complexData Non-zero if the waveforms are complex
+ *
+ * @return The training set, to be freed with \c LALInferenceDestroyROQTrainingSet
+ */
+LALInferenceROQTrainingSet *LALInferenceMapROQTrainingSet(const CHAR *filename, UINT4 cols, INT4 complexData){
+  struct stat st;
+  size_t rowbytes = (size_t)cols * (complexData ? 2 : 1) * sizeof(REAL8);
+
+  XLAL_CHECK_NULL( filename != NULL && cols > 0, XLAL_EINVAL );
+  int fd = open(filename, O_RDONLY);
+  XLAL_CHECK_NULL( fd >= 0, XLAL_EIO, "Could not open training set '%s': %s", filename, strerror(errno) );
+  if ( fstat(fd, &st) != 0 || st.st_size == 0 || (size_t)st.st_size % rowbytes != 0 ){
+    close(fd);
+    XLAL_ERROR_NULL( XLAL_EIO, "Size of training set '%s' is not a multiple of %zu bytes", filename, rowbytes );
+  }
+  void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  XLAL_CHECK_NULL( map != MAP_FAILED, XLAL_EIO, "Could not map training set '%s': %s", filename, strerror(errno) );
+
+  LALInferenceROQTrainingSet *set = XLALCalloc(1, sizeof(*set));
+  if ( set == NULL ){
+    munmap(map, st.st_size);
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+  set->rows = st.st_size / rowbytes;
+  set->cols = cols;
+  set->complexData = complexData ? 1 : 0;
+  set->data = map;
+  set->mapLength = st.st_size;
+  return set;
+}
+
+/** \brief Free a training set, unmapping it if it was mapped from a file */
+void LALInferenceDestroyROQTrainingSet(LALInferenceROQTrainingSet *TS){
+  if ( !TS ) return;
+  if ( TS->mapLength ) munmap(TS->data, TS->mapLength);
+  XLALFree(TS);
+}
+
+/**
+ * \brief Create a real orthonormal basis set with blocked, multi-threaded projections
+ *
+ * This produces the same reduced basis as \c LALInferenceGenerateREAL8OrthonormalBasis,
+ * but at each greedy iteration the whole training set is projected onto the new basis
+ * vector with BLAS products on blocks of \c blockRows waveforms, spread over the
+ * OpenMP threads, and the new basis vector is orthogonalised against the basis with
+ * BLAS matrix-vector products.  The training set is not modified, so it can be a
+ * read-only file mapped with \c LALInferenceMapROQTrainingSet.
+ *
+ * If \c settings->checkpointFile is given the basis is saved to it every
+ * \c settings->checkpointEvery iterations and when it is complete, and the
+ * construction resumes from it if it already exists, after projecting the training
+ * set onto the saved basis with BLAS matrix-matrix products.  With
+ * \c settings->verbose the time taken by each greedy iteration is reported on stderr.
+ *
+ * @param[out] RB A \c REAL8Array to return the reduced basis.
+ * @param[in] delta The time/frequency step(s) in the training set used to normalise the models.
+ * This can be a vector containing just one value.
+ * @param[in] tolerance The tolerance used as a stopping criteria for the basis generation.
+ * @param[in] TS The real training set.
+ * @param[out] greedypoints A \c UINT4Vector to return the indices of the training set rows that
+ * have been used to form the reduced basis.
+ * @param[in] settings Block size, checkpointing and reporting (can be \c NULL for the defaults).
+ *
+ * @return A \c REAL8 with the maximum projection error for the final reduced basis.
+ */
+REAL8 LALInferenceGenerateREAL8OrthonormalBasisBlocked(REAL8Array **RB,
+                                                       const REAL8Vector *delta,
+                                                       REAL8 tolerance,
+                                                       const LALInferenceROQTrainingSet *TS,
+                                                       UINT4Vector **greedypoints,
+                                                       const LALInferenceROQGreedySettings *settings){
+  XLAL_CHECK_REAL8( TS != NULL && !TS->complexData, XLAL_EINVAL, "Training set must be real" );
+  ROQGreedyState s = {.TS = TS, .ncomp = 1, .rowlen = TS->cols};
+  REAL8 worst_err = roq_greedy_blocked(&s, delta, tolerance, settings);
+  if ( XLAL_IS_REAL8_FAIL_NAN(worst_err) ){
+    roq_greedy_state_free(&s);
+    XLAL_ERROR_REAL8( XLAL_EFUNC );
+  }
+
+  UINT4Vector *dims = XLALCreateUINT4Vector( 2 );
+  dims->data[0] = s.dim;
+  dims->data[1] = TS->cols;
+  *RB = XLALCreateREAL8Array( dims );
+  XLALDestroyUINT4Vector( dims );
+  memcpy((*RB)->data, s.RB, (size_t)s.dim * s.rowlen * sizeof(REAL8));
+  *greedypoints = XLALCreateUINT4Vector( s.dim );
+  memcpy((*greedypoints)->data, s.gpts, s.dim * sizeof(UINT4));
+
+  roq_greedy_state_free(&s);
+  return worst_err;
+}
+
+/**
+ * \brief Create a complex orthonormal basis set with blocked, multi-threaded projections
+ *
+ * The complex counterpart of \c LALInferenceGenerateREAL8OrthonormalBasisBlocked, producing
+ * the same reduced basis as \c LALInferenceGenerateCOMPLEX16OrthonormalBasis.
+ *
+ * @param[out] RB A \c COMPLEX16Array to return the reduced basis.
+ * @param[in] delta The time/frequency step(s) in the training set used to normalise the models.
+ * This can be a vector containing just one value.
+ * @param[in] tolerance The tolerance used as a stopping criteria for the basis generation.
+ * @param[in] TS The complex training set.
+ * @param[out] greedypoints A \c UINT4Vector to return the indices of the training set rows that
+ * have been used to form the reduced basis.
+ * @param[in] settings Block size, checkpointing and reporting (can be \c NULL for the defaults).
+ *
+ * @return A \c REAL8 with the maximum projection error for the final reduced basis.
+ */
+REAL8 LALInferenceGenerateCOMPLEX16OrthonormalBasisBlocked(COMPLEX16Array **RB,
+                                                           const REAL8Vector *delta,
+                                                           REAL8 tolerance,
+                                                           const LALInferenceROQTrainingSet *TS,
+                                                           UINT4Vector **greedypoints,
+                                                           const LALInferenceROQGreedySettings *settings){
+  XLAL_CHECK_REAL8( TS != NULL && TS->complexData, XLAL_EINVAL, "Training set must be complex" );
+  ROQGreedyState s = {.TS = TS, .ncomp = 2, .rowlen = 2 * TS->cols};
+  REAL8 worst_err = roq_greedy_blocked(&s, delta, tolerance, settings);
+  if ( XLAL_IS_REAL8_FAIL_NAN(worst_err) ){
+    roq_greedy_state_free(&s);
+    XLAL_ERROR_REAL8( XLAL_EFUNC );
+  }
+
+  UINT4Vector *dims = XLALCreateUINT4Vector( 2 );
+  dims->data[0] = s.dim;
+  dims->data[1] = TS->cols;
+  *RB = XLALCreateCOMPLEX16Array( dims );
+  XLALDestroyUINT4Vector( dims );
+  memcpy((*RB)->data, s.RB, (size_t)s.dim * s.rowlen * sizeof(REAL8));
+  *greedypoints = XLALCreateUINT4Vector( s.dim );
+  memcpy((*greedypoints)->data, s.gpts, s.dim * sizeof(UINT4));
+
+  roq_greedy_state_free(&s);
+  return worst_err;
+}
+
+
 /**
  * \brief Validate the real reduced basis against another set of waveforms
  *
@@ -52,6 +52,23 @@ typedef struct tagLALInferenceCOMPLEXROQInterpolant{
   UINT4 *nodes;           /**< The nodes (indices) for the interpolation */
 }LALInferenceCOMPLEXROQInterpolant;
 
+/** A training set of real or complex waveforms, held in memory or mapped from a file */
+typedef struct tagLALInferenceROQTrainingSet{
+  UINT4 rows;        /**< The number of waveforms */
+  UINT4 cols;        /**< The number of points in each waveform */
+  INT4 complexData;  /**< Non-zero if the waveforms are complex */
+  REAL8 *data;       /**< The waveforms, row after row (real and imaginary parts adjacent for complex data) */
+  size_t mapLength;  /**< The length of the mapping if \c data is a mapped file, or zero */
+}LALInferenceROQTrainingSet;
+
+/** Settings for the blocked greedy reduced basis construction */
+typedef struct tagLALInferenceROQGreedySettings{
+  UINT4 blockRows;            /**< The number of waveforms projected in each BLAS product (0 for the default of 256) */
+  const CHAR *checkpointFile; /**< A file the basis is saved to and resumed from, or \c NULL */
+  UINT4 checkpointEvery;      /**< The number of greedy iterations between checkpoints (0 to save only the final basis) */
+  INT4 verbose;               /**< Report the time taken by each greedy iteration */
+}LALInferenceROQGreedySettings;
+
 /* function to create or enrich a real orthonormal basis set from a training set of models */
 REAL8 LALInferenceGenerateREAL8OrthonormalBasis(REAL8Array **RB,
                                                 const REAL8Vector *delta,
@@ -65,6 +82,26 @@ REAL8 LALInferenceGenerateCOMPLEX16OrthonormalBasis(COMPLEX16Array **RB,
                                                     COMPLEX16Array **TS,
                                                     UINT4Vector **greedypoints);
 
+/* blocked, multi-threaded and checkpointed versions of the above */
+LALInferenceROQTrainingSet *LALInferenceROQTrainingSetFromREAL8Array(REAL8Array *TS);
+LALInferenceROQTrainingSet *LALInferenceROQTrainingSetFromCOMPLEX16Array(COMPLEX16Array *TS);
+LALInferenceROQTrainingSet *LALInferenceMapROQTrainingSet(const CHAR *filename, UINT4 cols, INT4 complexData);
+void LALInferenceDestroyROQTrainingSet(LALInferenceROQTrainingSet *TS);
+
+REAL8 LALInferenceGenerateREAL8OrthonormalBasisBlocked(REAL8Array **RB,
+                                                       const REAL8Vector *delta,
+                                                       REAL8 tolerance,
+                                                       const LALInferenceROQTrainingSet *TS,
+                                                       UINT4Vector **greedypoints,
+                                                       const LALInferenceROQGreedySettings *settings);
+
+REAL8 LALInferenceGenerateCOMPLEX16OrthonormalBasisBlocked(COMPLEX16Array **RB,
+                                                           const REAL8Vector *delta,
+                                                           REAL8 tolerance,
+                                                           const LALInferenceROQTrainingSet *TS,
+                                                           UINT4Vector **greedypoints,
+                                                           const LALInferenceROQGreedySettings *settings);
+
 /* functions to test the basis */
 void LALInferenceValidateREAL8OrthonormalBasis(REAL8Vector **projerr,
                                                const REAL8Vector *delta,
@@ -17,13 +17,19 @@
  *  MA  02110-1301  USA
  */
 
+#include <config.h>
 #include <lal/LALInference.h>
 #include <lal/LALInferenceVCSInfo.h>
 #include <lal/H5FileIO.h>
 #include <lal/LALVCSInfoType.h>
 #include <lal/LALInferenceHDF5.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/stat.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
 
 const char LALInferenceHDF5PosteriorSamplesDatasetName[] = "posterior_samples";
 const char LALInferenceHDF5NestedSamplesDatasetName[] = "nested_samples";
@@ -49,6 +55,31 @@ int LALInferenceCheckNonEmptyFile(char *filename)
     return(0);
 }
 
+int LALInferenceCheckpointIncrementName(char *name, size_t size, const char *filename, UINT4 n)
+{
+    int len = snprintf(name, size, "%s.%u", filename, n);
+    if (len < 0 || (size_t) len >= size)
+        XLAL_ERROR(XLAL_EBADLEN, "Checkpoint file name %s is too long", filename);
+    return(XLAL_SUCCESS);
+}
+
+int LALInferenceRemoveCheckpointIncrements(const char *filename, UINT4 first)
+{
+    char name[FILENAME_MAX];
+    int removed = 0;
+    /* Increments are always written in sequence, so stop at the first gap */
+    for (UINT4 n = first; ; n++) {
+        if (LALInferenceCheckpointIncrementName(name, sizeof(name), filename, n) != XLAL_SUCCESS)
+            XLAL_ERROR(XLAL_EFUNC);
+        if (access(name, F_OK) == -1)
+            break;
+        if (unlink(name) != 0)
+            XLAL_ERROR(XLAL_EIO, "Unable to remove checkpoint increment %s", name);
+        removed++;
+    }
+    return(removed);
+}
+
 static void LALInferenceH5VariableToAttribute(
     LALH5Generic gdataset, LALInferenceVariables *vars, char *name);
 
@@ -317,6 +348,69 @@ int LALInferenceH5VariablesArrayToDataset(
 }
 
 
+int LALInferenceH5CheckpointIncrementToDataset(
+    LALH5File *h5file, LALInferenceVariables *const *const varsArray,
+    UINT4 offset, UINT4 N, const char *TableName)
+{
+    char offset_name[VARNAME_MAX];
+
+    if (N <= offset)
+        return(XLAL_SUCCESS);
+
+    snprintf(offset_name, sizeof(offset_name), "%s_offset", TableName);
+    if (LALInferenceH5VariablesArrayToDataset(h5file, varsArray + offset, N - offset, TableName) != XLAL_SUCCESS)
+        XLAL_ERROR(XLAL_EFUNC);
+    if (XLALH5FileAddScalarAttribute(h5file, offset_name, &offset, LAL_U4_TYPE_CODE) != XLAL_SUCCESS)
+        XLAL_ERROR(XLAL_EFUNC);
+    return(XLAL_SUCCESS);
+}
+
+
+int LALInferenceH5CheckpointIncrementToVariablesArray(
+    LALH5File *h5file, const char *TableName, UINT4 length,
+    LALInferenceVariables ***varsArray, UINT4 *N)
+{
+    char offset_name[VARNAME_MAX];
+    UINT4 offset, skip;
+    LALH5Dataset *dataset;
+
+    *varsArray = NULL;
+    *N = 0;
+    if (!XLALH5FileCheckDatasetExists(h5file, TableName))
+        return(0);
+
+    snprintf(offset_name, sizeof(offset_name), "%s_offset", TableName);
+    if (XLALH5FileQueryScalarAttributeValue(&offset, h5file, offset_name) != XLAL_SUCCESS)
+        XLAL_ERROR(XLAL_EFUNC, "Dataset %s has no attribute %s", TableName, offset_name);
+    if (offset > length)
+        return(1);
+
+    dataset = XLALH5DatasetRead(h5file, TableName);
+    if (!dataset)
+        XLAL_ERROR(XLAL_EFUNC);
+    if (LALInferenceH5DatasetToVariablesArray(dataset, varsArray, N) != XLAL_SUCCESS)
+    {
+        XLALH5DatasetFree(dataset);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+    XLALH5DatasetFree(dataset);
+
+    /* Drop the entries written before the array was last restored */
+    skip = length - offset < *N ? length - offset : *N;
+    if (skip > 0)
+    {
+        for (UINT4 i = 0; i < skip; i++)
+        {
+            LALInferenceClearVariables((*varsArray)[i]);
+            XLALFree((*varsArray)[i]);
+        }
+        memmove(*varsArray, *varsArray + skip, (*N - skip) * sizeof(LALInferenceVariables *));
+        *N -= skip;
+    }
+    return(0);
+}
+
+
 static void LALInferenceH5VariableToAttribute(
     LALH5Generic gdataset, LALInferenceVariables *vars, char *name)
 {
@@ -33,6 +33,19 @@ int LALInferenceCheckNonEmptyFile(char *filename);
  */
 int LALInferencePrintCheckpointFileInfo(char *filename);
 
+/**
+ * Writes the name of the n-th incremental checkpoint following the full
+ * checkpoint in filename, which is <filename>.<n>, to name
+ */
+int LALInferenceCheckpointIncrementName(char *name, size_t size, const char *filename, UINT4 n);
+
+/**
+ * Deletes the incremental checkpoints of filename from number first onwards,
+ * stopping at the first one that does not exist.
+ * Returns the number of files removed
+ */
+int LALInferenceRemoveCheckpointIncrements(const char *filename, UINT4 first);
+
 int LALInferenceH5VariablesArrayToDataset(
     LALH5File *h5file, LALInferenceVariables *const *const varsArray, UINT4 N,
     const char *TableName);
@@ -40,6 +53,26 @@ int LALInferenceH5VariablesArrayToDataset(
 int LALInferenceH5DatasetToVariablesArray(
     LALH5Dataset *dataset, LALInferenceVariables ***varsArray, UINT4 *N);
 
+/**
+ * Writes the entries of varsArray from index offset up to N as the dataset
+ * TableName, recording offset in the attribute <TableName>_offset of h5file.
+ * Nothing is written if there are no such entries
+ */
+int LALInferenceH5CheckpointIncrementToDataset(
+    LALH5File *h5file, LALInferenceVariables *const *const varsArray,
+    UINT4 offset, UINT4 N, const char *TableName);
+
+/**
+ * Reads the entries the dataset TableName written by
+ * LALInferenceH5CheckpointIncrementToDataset adds to an array that already
+ * holds length entries, dropping any that are already present.
+ * Returns 1 if the dataset starts beyond the end of the array, 0 otherwise,
+ * and XLAL_FAILURE if the increment cannot be read
+ */
+int LALInferenceH5CheckpointIncrementToVariablesArray(
+    LALH5File *h5file, const char *TableName, UINT4 length,
+    LALInferenceVariables ***varsArray, UINT4 *N);
+
 /**
  * Create a HDF5 heirarchy in the given LALH5File reference
  * /codename/runID/
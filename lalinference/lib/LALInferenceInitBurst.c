@@ -236,10 +236,13 @@ LALInferenceModel * LALInferenceInitBurstModel(LALInferenceRunState *state)
   BurstApproximant approx = (BurstApproximant) 0;
   char *pinned_params=NULL;
   
-  LALInferenceModel *model = XLALMalloc(sizeof(LALInferenceModel));
+  LALInferenceModel *model = XLALCalloc(1, sizeof(LALInferenceModel));
   model->params = XLALCalloc(1, sizeof(LALInferenceVariables));
   memset(model->params, 0, sizeof(LALInferenceVariables));
   LALInferenceVariables *currentParams=model->params;
+  model->fusedBins = NULL;
+  model->splineCalibration = NULL;
+  model->relbin = NULL;
 
   UINT4 signal_flag=1;
   ppt = LALInferenceGetProcParamVal(commandLine, "--noiseonly");
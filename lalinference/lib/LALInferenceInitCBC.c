@@ -947,10 +947,13 @@ LALInferenceModel *LALInferenceInitCBCModel(LALInferenceRunState *state) {
     return(LALInferenceInitModelReviewEvidence(state)); /* CHECKME: Use the default prior for unimodal */
   }
 
-  LALInferenceModel *model = XLALMalloc(sizeof(LALInferenceModel));
+  LALInferenceModel *model = XLALCalloc(1, sizeof(LALInferenceModel));
   model->params = XLALCalloc(1, sizeof(LALInferenceVariables));
   memset(model->params, 0, sizeof(LALInferenceVariables));
   model->eos_fam = NULL;
+  model->fusedBins = NULL;
+  model->splineCalibration = NULL;
+  model->relbin = NULL;
 
   UINT4 signal_flag=1;
   ppt = LALInferenceGetProcParamVal(commandLine, "--noiseonly");
@@ -1656,7 +1659,7 @@ LALInferenceModel *LALInferenceInitCBCModel(LALInferenceRunState *state) {
                                                 &lalDimensionlessUnit,
                                                 state->data->freqData->data->length);
 
-  model->freqhs = XLALCalloc(nifo, sizeof(COMPLEX16FrequencySeries *));
+  model->freqhs = XLALCalloc(nifo+1, sizeof(COMPLEX16FrequencySeries *));
   for (i=0; i<nifo; i++)
       model->freqhs[i] = XLALCreateCOMPLEX16FrequencySeries("freqh",
                                                             &(state->data->freqData->epoch),
@@ -42,6 +42,245 @@
 #endif
 
 
+/* Maximum number of points in a leaf of a KDE tree */
+#define KDE_TREE_LEAF_SIZE 16
+
+/* Kernels whose exponent exceeds the largest one by more than this, scaled
+ * by the number of kernels, contribute below double precision and are
+ * skipped when evaluating a KDE */
+#define KDE_TREE_TOLERANCE 37.0
+
+/**
+ * Node of a KDE tree, covering the points \a start to \a end - 1 in tree
+ * order.  Leaves have no children.
+ */
+typedef struct tagLALInferenceKDETreeNode {
+    INT4 start, end;
+    INT4 left, right;
+} LALInferenceKDETreeNode;
+
+/**
+ * Bounding-box (kd) tree over the Cholesky-transformed points of a KDE.  The
+ * points are stored contiguously in tree order, and each node holds the
+ * bounding box of its points, so whole groups of kernels can be bounded
+ * without visiting them.
+ */
+typedef struct tagLALInferenceKDETree {
+    INT4 dim;
+    INT4 npts;
+    INT4 nnodes;
+    INT4 size;
+    REAL8 *points;                      /* npts x dim, in tree order */
+    REAL8 *lower;                       /* nnodes x dim lower corners of the bounding boxes */
+    REAL8 *upper;                       /* nnodes x dim upper corners of the bounding boxes */
+    LALInferenceKDETreeNode *nodes;
+} LALInferenceKDETree;
+
+/* Partially order idx[start..end) so that idx[nth] holds the point with the
+ * nth smallest coordinate p, with no larger ones before it */
+static void KDETreeSelect(const gsl_matrix *data, INT4 *idx, INT4 start, INT4 end, INT4 nth, INT4 p) {
+    INT4 lo = start, hi = end - 1;
+
+    while (lo < hi) {
+        REAL8 pivot = gsl_matrix_get(data, idx[(lo + hi)/2], p);
+        INT4 i = lo, j = hi;
+
+        while (i <= j) {
+            while (gsl_matrix_get(data, idx[i], p) < pivot) i++;
+            while (gsl_matrix_get(data, idx[j], p) > pivot) j--;
+            if (i <= j) {
+                INT4 tmp = idx[i];
+                idx[i] = idx[j];
+                idx[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+
+        if (nth <= j)
+            hi = j;
+        else if (nth >= i)
+            lo = i;
+        else
+            break;
+    }
+}
+
+/* Recursively build the node covering idx[start..end), returning its index */
+static INT4 KDETreeBuildNode(LALInferenceKDETree *tree, const gsl_matrix *data, INT4 *idx, INT4 start, INT4 end) {
+    INT4 dim = tree->dim;
+    INT4 i, p, node = tree->nnodes;
+
+    if (tree->nnodes == tree->size) {
+        tree->size *= 2;
+        tree->nodes = XLALRealloc(tree->nodes, tree->size * sizeof(LALInferenceKDETreeNode));
+        tree->lower = XLALRealloc(tree->lower, tree->size * dim * sizeof(REAL8));
+        tree->upper = XLALRealloc(tree->upper, tree->size * dim * sizeof(REAL8));
+    }
+    tree->nnodes++;
+
+    REAL8 *lower = &tree->lower[node*dim];
+    REAL8 *upper = &tree->upper[node*dim];
+    for (p = 0; p < dim; p++) {
+        lower[p] = INFINITY;
+        upper[p] = -INFINITY;
+    }
+    for (i = start; i < end; i++) {
+        for (p = 0; p < dim; p++) {
+            REAL8 val = gsl_matrix_get(data, idx[i], p);
+            if (val < lower[p]) lower[p] = val;
+            if (val > upper[p]) upper[p] = val;
+        }
+    }
+
+    tree->nodes[node].start = start;
+    tree->nodes[node].end = end;
+    tree->nodes[node].left = -1;
+    tree->nodes[node].right = -1;
+
+    if (end - start > KDE_TREE_LEAF_SIZE) {
+        /* Split at the median of the widest side of the box */
+        INT4 split_dim = 0;
+        for (p = 1; p < dim; p++)
+            if (upper[p] - lower[p] > upper[split_dim] - lower[split_dim])
+                split_dim = p;
+
+        if (upper[split_dim] > lower[split_dim]) {
+            INT4 mid = start + (end - start)/2;
+            KDETreeSelect(data, idx, start, end, mid, split_dim);
+
+            INT4 left = KDETreeBuildNode(tree, data, idx, start, mid);
+            INT4 right = KDETreeBuildNode(tree, data, idx, mid, end);
+            tree->nodes[node].left = left;
+            tree->nodes[node].right = right;
+        }
+    }
+
+    return node;
+}
+
+/* Build a tree over the rows of data */
+static LALInferenceKDETree *KDETreeCreate(const gsl_matrix *data) {
+    INT4 i, p;
+    LALInferenceKDETree *tree = XLALCalloc(1, sizeof(LALInferenceKDETree));
+
+    tree->dim = data->size2;
+    tree->npts = data->size1;
+    tree->size = 2 * (tree->npts / KDE_TREE_LEAF_SIZE) + 1;
+    tree->nodes = XLALMalloc(tree->size * sizeof(LALInferenceKDETreeNode));
+    tree->lower = XLALMalloc(tree->size * tree->dim * sizeof(REAL8));
+    tree->upper = XLALMalloc(tree->size * tree->dim * sizeof(REAL8));
+
+    INT4 *idx = XLALMalloc(tree->npts * sizeof(INT4));
+    for (i = 0; i < tree->npts; i++)
+        idx[i] = i;
+
+    KDETreeBuildNode(tree, data, idx, 0, tree->npts);
+
+    tree->points = XLALMalloc(tree->npts * tree->dim * sizeof(REAL8));
+    for (i = 0; i < tree->npts; i++)
+        for (p = 0; p < tree->dim; p++)
+            tree->points[i*tree->dim + p] = gsl_matrix_get(data, idx[i], p);
+
+    XLALFree(idx);
+    return tree;
+}
+
+static void KDETreeDestroy(LALInferenceKDETree *tree) {
+    if (tree) {
+        XLALFree(tree->points);
+        XLALFree(tree->lower);
+        XLALFree(tree->upper);
+        XLALFree(tree->nodes);
+        XLALFree(tree);
+    }
+}
+
+/* Squared distance from y to the bounding box of a node */
+static REAL8 KDETreeBoxDist2(const LALInferenceKDETree *tree, INT4 node, const REAL8 *y) {
+    const REAL8 *lower = &tree->lower[node*tree->dim];
+    const REAL8 *upper = &tree->upper[node*tree->dim];
+    REAL8 dist2 = 0.;
+
+    for (INT4 p = 0; p < tree->dim; p++) {
+        REAL8 d = 0.;
+        if (y[p] < lower[p])
+            d = lower[p] - y[p];
+        else if (y[p] > upper[p])
+            d = y[p] - upper[p];
+        dist2 += d*d;
+    }
+    return dist2;
+}
+
+static REAL8 KDETreePointDist2(const LALInferenceKDETree *tree, INT4 i, const REAL8 *y) {
+    const REAL8 *x = &tree->points[i*tree->dim];
+    REAL8 dist2 = 0.;
+
+    for (INT4 p = 0; p < tree->dim; p++) {
+        REAL8 d = x[p] - y[p];
+        dist2 += d*d;
+    }
+    return dist2;
+}
+
+/* Find the smallest squared distance from y to a point below node */
+static void KDETreeNearest(const LALInferenceKDETree *tree, INT4 node, const REAL8 *y, REAL8 *best) {
+    const LALInferenceKDETreeNode *n = &tree->nodes[node];
+
+    if (n->left < 0) {
+        for (INT4 i = n->start; i < n->end; i++) {
+            REAL8 dist2 = KDETreePointDist2(tree, i, y);
+            if (dist2 < *best)
+                *best = dist2;
+        }
+        return;
+    }
+
+    /* Descend into the closer child first to tighten the bound early */
+    REAL8 dleft = KDETreeBoxDist2(tree, n->left, y);
+    REAL8 dright = KDETreeBoxDist2(tree, n->right, y);
+    INT4 first = dleft <= dright ? n->left : n->right;
+    INT4 second = dleft <= dright ? n->right : n->left;
+    REAL8 dsecond = dleft <= dright ? dright : dleft;
+
+    KDETreeNearest(tree, first, y, best);
+    if (dsecond < *best)
+        KDETreeNearest(tree, second, y, best);
+}
+
+/* Sum exp(-(dist2 - offset)/2) over the points below node closer than max_dist2 */
+static REAL8 KDETreeSum(const LALInferenceKDETree *tree, INT4 node, const REAL8 *y, REAL8 offset, REAL8 max_dist2) {
+    const LALInferenceKDETreeNode *n = &tree->nodes[node];
+    REAL8 sum = 0.;
+
+    if (KDETreeBoxDist2(tree, node, y) > max_dist2)
+        return 0.;
+
+    if (n->left < 0) {
+        for (INT4 i = n->start; i < n->end; i++) {
+            REAL8 dist2 = KDETreePointDist2(tree, i, y);
+            if (dist2 <= max_dist2)
+                sum += exp(-(dist2 - offset)/2.);
+        }
+        return sum;
+    }
+
+    return KDETreeSum(tree, n->left, y, offset, max_dist2) +
+            KDETreeSum(tree, n->right, y, offset, max_dist2);
+}
+
+/* Log of the sum of the (unnormalised) kernels at a Cholesky-transformed point */
+static REAL8 KDETreeLogSum(const LALInferenceKDETree *tree, const REAL8 *y) {
+    REAL8 nearest = INFINITY;
+
+    KDETreeNearest(tree, 0, y, &nearest);
+
+    REAL8 max_dist2 = nearest + 2.*(KDE_TREE_TOLERANCE + log((REAL8)tree->npts));
+    return -nearest/2. + log(KDETreeSum(tree, 0, y, nearest, max_dist2));
+}
+
+
 
 /**
  * Allocate, fill, and tune a Gaussian kernel density estimate from
@@ -161,6 +400,8 @@ LALInferenceKDE *LALInferenceInitKDE(INT4 npts, INT4 dim) {
     kde->cholesky_decomp_cov = gsl_matrix_calloc(dim, dim);
     kde->cholesky_decomp_cov_lower = gsl_matrix_calloc(dim, dim);
     kde->cov = gsl_matrix_calloc(dim, dim);
+    kde->cholesky_data = NULL;
+    kde->tree = NULL;
 
     kde->lower_bound_types = XLALCalloc(dim, sizeof(LALInferenceParamVaryType));
     kde->upper_bound_types = XLALCalloc(dim, sizeof(LALInferenceParamVaryType));
@@ -194,6 +435,8 @@ void LALInferenceDestroyKDE(LALInferenceKDE *kde) {
         gsl_matrix_free(kde->cov);
 
         if (kde->npts > 0) gsl_matrix_free(kde->data);
+        if (kde->cholesky_data) gsl_matrix_free(kde->cholesky_data);
+        KDETreeDestroy(kde->tree);
 
         XLALFree(kde->lower_bound_types);
         XLALFree(kde->upper_bound_types);
@@ -284,6 +527,17 @@ void LALInferenceSetKDEBandwidth(LALInferenceKDE *kde) {
     kde->log_norm_factor =
         log(kde->npts * sqrt(pow(2*LAL_PI, kde->dim) * det_cov));
 
+    /* Transform all points at once so the kernel exponents become squared
+     * distances, and index them for evaluation */
+    if (kde->cholesky_data) gsl_matrix_free(kde->cholesky_data);
+    kde->cholesky_data = gsl_matrix_alloc(kde->npts, kde->dim);
+    gsl_matrix_memcpy(kde->cholesky_data, kde->data);
+    gsl_blas_dtrsm(CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0,
+                    kde->cholesky_decomp_cov_lower, kde->cholesky_data);
+
+    KDETreeDestroy(kde->tree);
+    kde->tree = KDETreeCreate(kde->cholesky_data);
+
     return;
 }
 
@@ -299,8 +553,7 @@ void LALInferenceSetKDEBandwidth(LALInferenceKDE *kde) {
  */
 REAL8 LALInferenceKDEEvaluatePoint(LALInferenceKDE *kde, REAL8 *point) {
     INT4 dim = kde->dim;
-    INT4 npts = kde->npts;
-    INT4 i, j, p;
+    INT4 i, p;
     INT4 n_evals = 1;  // Number of evaluations to be done
     REAL8 min, max, width, val;
 
@@ -368,50 +621,29 @@ REAL8 LALInferenceKDEEvaluatePoint(LALInferenceKDE *kde, REAL8 *point) {
         }
     }
 
-    /* Loop over list of reflected and cycled points */
-    REAL8* results = XLALMalloc(npts * sizeof(REAL8));
     REAL8* eval_results = XLALMalloc(n_evals * sizeof(REAL8));
+    gsl_vector *y = gsl_vector_alloc(dim);
 
     /* Loop over reflected and cycled set of points */
     for (i = 0; i < n_evals; i++) {
         gsl_vector_view pt = gsl_matrix_row(points, i);
 
-        /* Loop over points in KDE dataset, using the Cholesky decomposition
-         * of the covariance to avoid ever inverting the covariance matrix */
-        #pragma omp parallel
-        {
-            /* Vectors that will hold the difference and transformed distance */
-            gsl_vector *diff = gsl_vector_alloc(dim);
-            gsl_vector *tdiff = gsl_vector_alloc(dim);
-
-            #pragma omp for schedule(static)
-            for (j = 0; j < npts; j++) {
-                gsl_vector_view d = gsl_matrix_row(kde->data, j);
-                gsl_vector_memcpy(diff, &d.vector);
-
-                gsl_vector_sub(diff, &pt.vector);
-                gsl_linalg_cholesky_solve(kde->cholesky_decomp_cov, diff, tdiff);
-                gsl_vector_mul(diff, tdiff);
-
-                REAL8 energy = 0.;
-                for (INT4 k=0; k<dim; k++)
-                    energy += gsl_vector_get(diff, k);
-                results[j] = -energy/2.;
-            }
-
-            gsl_vector_free(diff);
-            gsl_vector_free(tdiff);
-        }
+        /* Transform the point like the KDE dataset, using the Cholesky
+         * decomposition of the covariance to avoid ever inverting it, then
+         * sum the kernels that contribute at double precision */
+        gsl_vector_memcpy(y, &pt.vector);
+        gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit,
+                        kde->cholesky_decomp_cov_lower, y);
 
         /* Normalize the result */
-        eval_results[i] = log_add_exps(results, npts) - kde->log_norm_factor;
+        eval_results[i] = KDETreeLogSum(kde->tree, y->data) - kde->log_norm_factor;
     }
 
     /* Accumulate probability after accounting for all boundaries */
     REAL8 result = log_add_exps(eval_results, n_evals);
 
     gsl_matrix_free(points);
-    XLALFree(results);
+    gsl_vector_free(y);
     XLALFree(eval_results);
 
     return result;
@@ -601,12 +833,17 @@ void LALInferenceComputeCovariance(gsl_matrix *cov, gsl_matrix *data) {
 REAL8 log_add_exps(REAL8 *vals, INT4 size) {
     INT4 i;
 
-    REAL8 max_comp = 0.;
+    /* Scale by the largest element, so that sums of very small
+     * probabilities don't underflow to zero */
+    REAL8 max_comp = -INFINITY;
     for (i = 0; i < size; i++) {
         if (max_comp < vals[i])
             max_comp = vals[i];
     }
 
+    if (isinf(max_comp))
+        return max_comp;
+
     REAL8 result = 0.;
     for (i = 0; i < size; i++)
         result += exp(vals[i]-max_comp);
@@ -28,6 +28,7 @@
 #include <lal/LALInference.h>
 
 struct tagkmeans;
+struct tagLALInferenceKDETree;
 
 /**
  * Structure containing the Guassian kernel density of a set of samples.
@@ -46,6 +47,10 @@ tagKDE
                                                   covariance matrix, containing both terms
                                                   as returned by gsl_linalg_cholesky_decomp(). */
     gsl_matrix * cholesky_decomp_cov_lower; /**< Just the lower portion of \a cholesky_decomp_cov. */
+    gsl_matrix * cholesky_data;             /**< \a data transformed by the inverse of
+                                                  \a cholesky_decomp_cov_lower, in which the kernel
+                                                  exponents are squared Euclidean distances. */
+    struct tagLALInferenceKDETree * tree;   /**< Bounding-box tree over \a cholesky_data. */
 
     LALInferenceParamVaryType * lower_bound_types; /**< Array of param boundary types */
     LALInferenceParamVaryType * upper_bound_types; /**< Array of param boundary types */
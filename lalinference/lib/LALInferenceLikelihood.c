@@ -38,6 +38,7 @@
 #include <gsl/gsl_sf_dawson.h>
 #include <gsl/gsl_sf_erf.h>
 #include <gsl/gsl_complex_math.h>
+#include <gsl/gsl_randist.h>
 #include <lal/LALInferenceTemplate.h>
 
 #include "logaddexp.h"
@@ -116,6 +117,10 @@ void LALInferenceInitLikelihood(LALInferenceRunState *runState)
     (--margtimephi)                  Using marginalised in time and phase likelihood\n\
     (--margdist)                     Using marginalisation in distance with d^2 prior (compatible with --margphi and --margtimephi)\n\
     (--margdist-comoving)            Using marginalisation in distance with uniform-in-comoving-volume prior (compatible with --margphi and --margtimephi)\n\
+    (--relative-binning)             Evaluate the likelihood by relative binning around the starting point (compatible with --margphi and --margdist)\n\
+    (--relative-binning-epsilon E)   Phase change allowed across a bin (default 0.025 rad)\n\
+    (--relative-binning-test N)      Number of points near the fiducial at which the accuracy is checked (default 8)\n\
+    (--relative-binning-test-scale S) Spread of these points as a fraction of the prior widths (default 1e-4)\n\
     \n";
 
     /* Print command line arguments if help requested */
@@ -184,6 +189,19 @@ void LALInferenceInitLikelihood(LALInferenceRunState *runState)
       runState->likelihood=&LALInferenceUndecomposedFreqDomainLogLikelihood;
    }
 
+   if (LALInferenceGetProcParamVal(commandLine, "--relative-binning")) {
+     if (runState->likelihood != &LALInferenceUndecomposedFreqDomainLogLikelihood &&
+         runState->likelihood != &LALInferenceMarginalisedPhaseLogLikelihood) {
+       fprintf(stderr, "Error: --relative-binning can only be used with the Gaussian or marginalised phase likelihood.\n");
+       exit(1);
+     }
+     fprintf(stderr, "Using relative binning in likelihood.\n");
+     if (LALInferenceSetupRelativeBinning(runState) != XLAL_SUCCESS) {
+       fprintf(stderr, "Error: could not set up relative binning.\n");
+       exit(1);
+     }
+   }
+
    /* Try to determine a model-less likelihood, if such a thing makes sense */
    if (runState->likelihood==&LALInferenceUndecomposedFreqDomainLogLikelihood || runState->likelihood==&LALInferenceMarginalisedPhaseLogLikelihood ){
 
@@ -244,8 +262,7 @@ LALInferenceVariables LALInferenceGetInstrinsicParams(LALInferenceVariables *cur
     LALInferenceVariables intrinsicParams;
     const char **non_intrinsic_param = non_intrinsic_params;
 
-    intrinsicParams.head      = NULL;
-    intrinsicParams.dimension = 0;
+    memset(&intrinsicParams, 0, sizeof(intrinsicParams));
     LALInferenceCopyVariables(currentParams, &intrinsicParams);
 
     while (*non_intrinsic_param) {
@@ -273,6 +290,705 @@ static int checkItemAndAdd(void *item, void **array)
   return 0;
 }
 
+/* ============ Fused frequency-domain kernel: ========== */
+
+/* The data, noise weights and calibration factors of all detectors are
+   interleaved bin by bin in blocks of FUSED_LANES bins, so that a single
+   pass over frequency serves the whole network and each field of a block
+   is a contiguous vector of lanes.  The frequency range is cut into chunks
+   of FUSED_CHUNK bins whose partial sums are added in chunk order, so the
+   result does not depend on the number of OpenMP threads. */
+#define FUSED_LANES 8
+#define FUSED_CHUNK 4096
+
+enum {FUSED_DRE, FUSED_DIM, FUSED_W, FUSED_CALRE, FUSED_CALIM, FUSED_NFIELDS};
+
+typedef struct tagLALInferenceFusedBins
+{
+  const LALInferenceIFOData *data; /* Network the workspace was filled from */
+  const COMPLEX16FrequencySeries **freqData; /* Per-detector data ... */
+  const REAL8FrequencySeries **psd; /* ... and PSD, to detect a changed network */
+  REAL8 *fLow, *fHigh;
+  UINT4 nifo;
+  UINT4 lower, nbins, nchunks; /* Bins lower ... lower+nbins-1 are covered */
+  REAL8 deltaT, deltaF;
+  REAL8 *bins; /* [block][ifo][field][lane] */
+  REAL8 *D; /* <d|d> of each detector */
+  REAL8 *partial; /* [chunk][ifo][S, Re R, Im R] */
+  UINT4 *calVersion; /* Version of the calibration factors held for each detector, 0 for unity */
+} LALInferenceFusedBins;
+
+static void LALInferenceDestroyFusedBins(LALInferenceFusedBins *fused)
+{
+  if (!fused) return;
+  XLALFree(fused->freqData);
+  XLALFree(fused->psd);
+  XLALFree(fused->fLow);
+  XLALFree(fused->fHigh);
+  XLALFree(fused->bins);
+  XLALFree(fused->D);
+  XLALFree(fused->partial);
+  XLALFree(fused->calVersion);
+  XLALFree(fused);
+}
+
+/* Frequency bins of one detector, as used by the scalar likelihood loop */
+static void LALInferenceIFOBinRange(const LALInferenceIFOData *dataPtr, UINT4 *lower, UINT4 *upper)
+{
+  REAL8 deltaF = 1.0 / (((double)dataPtr->timeData->data->length) * dataPtr->timeData->deltaT);
+  *lower = (UINT4)ceil(dataPtr->fLow / deltaF);
+  *upper = (UINT4)floor(dataPtr->fHigh / deltaF);
+}
+
+static int LALInferenceFusedBinsMatch(const LALInferenceFusedBins *fused, const LALInferenceIFOData *data)
+{
+  const LALInferenceIFOData *dataPtr;
+  UINT4 ifo;
+  if (fused->data != data) return 0;
+  for (dataPtr = data, ifo = 0; dataPtr; dataPtr = dataPtr->next, ifo++)
+    if (ifo >= fused->nifo || fused->freqData[ifo] != dataPtr->freqData || fused->psd[ifo] != dataPtr->oneSidedNoisePowerSpectrum
+        || fused->fLow[ifo] != dataPtr->fLow || fused->fHigh[ifo] != dataPtr->fHigh)
+      return 0;
+  return ifo == fused->nifo;
+}
+
+void LALInferenceResetFusedBins(LALInferenceModel *model)
+{
+  if (!model) return;
+  LALInferenceDestroyFusedBins(model->fusedBins);
+  model->fusedBins = NULL;
+}
+
+/**
+ * Return the fused-kernel workspace of \c model for the network \c data,
+ * filling it on first use or when the network changes.  Changes to the
+ * samples of the data or PSD are not detected: see
+ * LALInferenceResetFusedBins().  Returns NULL when the detectors do not
+ * share one frequency grid, in which case the scalar loop is used.
+ */
+static LALInferenceFusedBins *LALInferenceGetFusedBins(LALInferenceModel *model, const LALInferenceIFOData *data)
+{
+  const LALInferenceIFOData *dataPtr;
+  UINT4 ifo, nifo = 0, lower = UINT32_MAX, upper = 0;
+
+  if (!model->freqhPlus || !model->freqhCross) return NULL;
+  for (dataPtr = data; dataPtr; dataPtr = dataPtr->next, nifo++) {
+    UINT4 l, u;
+    if (dataPtr->timeData->deltaT != data->timeData->deltaT
+        || dataPtr->timeData->data->length != data->timeData->data->length)
+      return NULL;
+    LALInferenceIFOBinRange(dataPtr, &l, &u);
+    if (u >= dataPtr->freqData->data->length || u >= dataPtr->oneSidedNoisePowerSpectrum->data->length
+        || u >= model->freqhPlus->data->length || u >= model->freqhCross->data->length)
+      return NULL;
+    if (l < lower) lower = l;
+    if (u > upper) upper = u;
+  }
+  if (nifo == 0 || lower > upper) return NULL;
+
+  if (model->fusedBins && LALInferenceFusedBinsMatch(model->fusedBins, data))
+    return model->fusedBins;
+  LALInferenceResetFusedBins(model);
+
+  LALInferenceFusedBins *fused = XLALCalloc(1, sizeof(*fused));
+  if (!fused) return NULL;
+  fused->data = data;
+  fused->nifo = nifo;
+  fused->lower = lower;
+  fused->nbins = upper - lower + 1;
+  fused->nchunks = (fused->nbins + FUSED_CHUNK - 1) / FUSED_CHUNK;
+  fused->deltaT = data->timeData->deltaT;
+  fused->deltaF = 1.0 / (((double)data->timeData->data->length) * fused->deltaT);
+  UINT4 nblocks = (fused->nbins + FUSED_LANES - 1) / FUSED_LANES;
+  fused->freqData = XLALCalloc(nifo, sizeof(*fused->freqData));
+  fused->psd = XLALCalloc(nifo, sizeof(*fused->psd));
+  fused->fLow = XLALCalloc(nifo, sizeof(REAL8));
+  fused->fHigh = XLALCalloc(nifo, sizeof(REAL8));
+  fused->bins = XLALCalloc((size_t)nblocks * nifo * FUSED_NFIELDS * FUSED_LANES, sizeof(REAL8));
+  fused->D = XLALCalloc(nifo, sizeof(REAL8));
+  fused->partial = XLALCalloc((size_t)fused->nchunks * nifo * 3, sizeof(REAL8));
+  fused->calVersion = XLALCalloc(nifo, sizeof(UINT4));
+  if (!fused->freqData || !fused->psd || !fused->fLow || !fused->fHigh || !fused->bins || !fused->D || !fused->partial || !fused->calVersion) {
+    LALInferenceDestroyFusedBins(fused);
+    return NULL;
+  }
+
+  /* Same normalisation as the scalar loop: TwoDeltaToverN / (PSD deltaT^2).
+     Bins outside the band of a detector get zero weight. */
+  REAL8 TwoDeltaToverN = 2.0 * fused->deltaT / ((double) data->timeData->data->length);
+  for (dataPtr = data, ifo = 0; dataPtr; dataPtr = dataPtr->next, ifo++) {
+    UINT4 l, u;
+    fused->freqData[ifo] = dataPtr->freqData;
+    fused->psd[ifo] = dataPtr->oneSidedNoisePowerSpectrum;
+    fused->fLow[ifo] = dataPtr->fLow;
+    fused->fHigh[ifo] = dataPtr->fHigh;
+    LALInferenceIFOBinRange(dataPtr, &l, &u);
+    for (UINT4 k = 0; k < nblocks * FUSED_LANES; k++) {
+      REAL8 *f = fused->bins + ((size_t)(k / FUSED_LANES) * nifo + ifo) * FUSED_NFIELDS * FUSED_LANES + k % FUSED_LANES;
+      UINT4 i = lower + k;
+      f[FUSED_CALRE * FUSED_LANES] = 1.0;
+      if (k >= fused->nbins || i < l || i > u) continue;
+      COMPLEX16 d = dataPtr->freqData->data->data[i];
+      REAL8 w = TwoDeltaToverN / (dataPtr->oneSidedNoisePowerSpectrum->data->data[i] * fused->deltaT * fused->deltaT);
+      f[FUSED_DRE * FUSED_LANES] = creal(d);
+      f[FUSED_DIM * FUSED_LANES] = cimag(d);
+      f[FUSED_W * FUSED_LANES] = w;
+      fused->D[ifo] += w * (creal(d) * creal(d) + cimag(d) * cimag(d));
+    }
+  }
+
+  model->fusedBins = fused;
+  return fused;
+}
+
+/* Copy the calibration factors of detector ifo into the workspace, or reset
+   them to unity when calFactor is NULL.  Factors with the version already
+   held are not copied again. */
+static void LALInferenceFusedBinsSetCalibration(LALInferenceFusedBins *fused, UINT4 ifo, const COMPLEX16 *calFactor, UINT4 version)
+{
+  if (!calFactor) version = 0;
+  if (fused->calVersion[ifo] == version) return;
+  for (UINT4 k = 0; k < fused->nbins; k++) {
+    REAL8 *f = fused->bins + ((size_t)(k / FUSED_LANES) * fused->nifo + ifo) * FUSED_NFIELDS * FUSED_LANES + k % FUSED_LANES;
+    COMPLEX16 c = calFactor ? calFactor[fused->lower + k] : 1.0;
+    f[FUSED_CALRE * FUSED_LANES] = creal(c);
+    f[FUSED_CALIM * FUSED_LANES] = cimag(c);
+  }
+  fused->calVersion[ifo] = version;
+}
+
+/* Spline calibration of each detector at the frequencies the likelihood
+   uses: every bin, the ROQ linear nodes or the relative-binning edges
+   (linear), and the ROQ quadratic nodes (quadratic) */
+typedef struct tagLALInferenceSplineCalibrationCache
+{
+  UINT4 nifo;
+  LALInferenceSplineCalibrationBasis **linear;
+  LALInferenceSplineCalibrationBasis **quadratic;
+  REAL8Vector **logfreqs, **amps, **phases; /* Node parameters of the current sample */
+  UINT4 *seen; /* Generation of each linear basis when last compared */
+  UINT4 *version; /* Incremented whenever the linear factors of a detector change */
+} LALInferenceSplineCalibrationCache;
+
+static void LALInferenceDestroySplineCalibrationCache(LALInferenceSplineCalibrationCache *cache)
+{
+  if (!cache) return;
+  for (UINT4 ifo = 0; ifo < cache->nifo; ifo++) {
+    if (cache->linear) LALInferenceDestroySplineCalibrationBasis(cache->linear[ifo]);
+    if (cache->quadratic) LALInferenceDestroySplineCalibrationBasis(cache->quadratic[ifo]);
+    if (cache->logfreqs && cache->logfreqs[ifo]) XLALDestroyREAL8Vector(cache->logfreqs[ifo]);
+    if (cache->amps && cache->amps[ifo]) XLALDestroyREAL8Vector(cache->amps[ifo]);
+    if (cache->phases && cache->phases[ifo]) XLALDestroyREAL8Vector(cache->phases[ifo]);
+  }
+  XLALFree(cache->linear);
+  XLALFree(cache->quadratic);
+  XLALFree(cache->logfreqs);
+  XLALFree(cache->amps);
+  XLALFree(cache->phases);
+  XLALFree(cache->seen);
+  XLALFree(cache->version);
+  XLALFree(cache);
+}
+
+void LALInferenceResetSplineCalibration(LALInferenceModel *model)
+{
+  if (!model) return;
+  LALInferenceDestroySplineCalibrationCache(model->splineCalibration);
+  model->splineCalibration = NULL;
+}
+
+/* Make sure basis is built for the nodes at logfreqs and the npoints
+   frequencies freqs, or every bin of freqData if freqs is NULL */
+static int LALInferenceSplineCalibrationCacheBasis(LALInferenceSplineCalibrationBasis **basis, const REAL8Vector *logfreqs,
+                                                   const REAL8 *freqs, UINT4 npoints, const COMPLEX16FrequencySeries *freqData)
+{
+  if (LALInferenceSplineCalibrationBasisMatches(*basis, logfreqs, npoints))
+    return XLAL_SUCCESS;
+  LALInferenceDestroySplineCalibrationBasis(*basis);
+  if (freqs) {
+    *basis = LALInferenceCreateSplineCalibrationBasis(logfreqs, freqs, npoints);
+  } else {
+    REAL8 *binFreqs = XLALMalloc((npoints ? npoints : 1) * sizeof(REAL8));
+    XLAL_CHECK(binFreqs, XLAL_ENOMEM);
+    for (UINT4 i = 0; i < npoints; i++)
+      binFreqs[i] = freqData->deltaF * i;
+    *basis = LALInferenceCreateSplineCalibrationBasis(logfreqs, binFreqs, npoints);
+    XLALFree(binFreqs);
+  }
+  XLAL_CHECK(*basis, XLAL_EFUNC);
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Evaluate the spline calibration of every detector for the parameters in
+ * \c currentParams, before the loop over detectors.  The bases are built on
+ * the first call for the frequencies used by \c model, and detectors whose
+ * calibration parameters have not changed keep their factors.
+ */
+static LALInferenceSplineCalibrationCache *LALInferenceUpdateSplineCalibration(LALInferenceModel *model, const LALInferenceIFOData *data,
+                                                                               LALInferenceVariables *currentParams)
+{
+  const LALInferenceIFOData *dataPtr;
+  UINT4 ifo, nifo = 0;
+  for (dataPtr = data; dataPtr; dataPtr = dataPtr->next) nifo++;
+
+  LALInferenceSplineCalibrationCache *cache = model->splineCalibration;
+  if (!cache || cache->nifo != nifo) {
+    LALInferenceDestroySplineCalibrationCache(cache);
+    model->splineCalibration = cache = XLALCalloc(1, sizeof(*cache));
+    XLAL_CHECK_NULL(cache, XLAL_ENOMEM);
+    cache->nifo = nifo;
+    cache->linear = XLALCalloc(nifo, sizeof(*cache->linear));
+    cache->quadratic = XLALCalloc(nifo, sizeof(*cache->quadratic));
+    cache->logfreqs = XLALCalloc(nifo, sizeof(*cache->logfreqs));
+    cache->amps = XLALCalloc(nifo, sizeof(*cache->amps));
+    cache->phases = XLALCalloc(nifo, sizeof(*cache->phases));
+    cache->seen = XLALCalloc(nifo, sizeof(*cache->seen));
+    cache->version = XLALCalloc(nifo, sizeof(*cache->version));
+    XLAL_CHECK_NULL(cache->linear && cache->quadratic && cache->logfreqs && cache->amps && cache->phases && cache->seen && cache->version, XLAL_ENOMEM);
+  }
+
+  for (dataPtr = data, ifo = 0; dataPtr; dataPtr = dataPtr->next, ifo++) {
+    get_calib_spline(currentParams, dataPtr->name, &cache->logfreqs[ifo], &cache->amps[ifo], &cache->phases[ifo]);
+    const LALInferenceSplineCalibrationBasis *old = cache->linear[ifo];
+    int status;
+    if (model->roq_flag) {
+      status = LALInferenceSplineCalibrationCacheBasis(&cache->linear[ifo], cache->logfreqs[ifo],
+                 model->roq->frequencyNodesLinear->data, model->roq->frequencyNodesLinear->length, NULL);
+      if (status == XLAL_SUCCESS)
+        status = LALInferenceSplineCalibrationCacheBasis(&cache->quadratic[ifo], cache->logfreqs[ifo],
+                   model->roq->frequencyNodesQuadratic->data, model->roq->frequencyNodesQuadratic->length, NULL);
+    } else if (model->relbin) {
+      status = LALInferenceSplineCalibrationCacheBasis(&cache->linear[ifo], cache->logfreqs[ifo],
+                 model->relbin->binEdges->data, model->relbin->binEdges->length, NULL);
+    } else {
+      status = LALInferenceSplineCalibrationCacheBasis(&cache->linear[ifo], cache->logfreqs[ifo],
+                 NULL, dataPtr->freqData->data->length, dataPtr->freqData);
+    }
+    XLAL_CHECK_NULL(status == XLAL_SUCCESS, XLAL_EFUNC);
+    if (cache->linear[ifo] != old) cache->seen[ifo] = 0;
+  }
+
+  /* All detectors in one pass */
+  XLAL_CHECK_NULL(LALInferenceSplineCalibrationEvaluate(cache->linear, cache->amps, cache->phases, nifo) == XLAL_SUCCESS, XLAL_EFUNC);
+  if (model->roq_flag)
+    XLAL_CHECK_NULL(LALInferenceSplineCalibrationEvaluate(cache->quadratic, cache->amps, cache->phases, nifo) == XLAL_SUCCESS, XLAL_EFUNC);
+
+  for (ifo = 0; ifo < nifo; ifo++)
+    if (cache->linear[ifo]->generation != cache->seen[ifo]) {
+      cache->seen[ifo] = cache->linear[ifo]->generation;
+      cache->version[ifo]++;
+    }
+
+  return cache;
+}
+
+/**
+ * Inner products of the projected, time-shifted and calibrated template
+ * with itself (\c S) and with the data (\c R = <d|h>) for every detector,
+ * in one pass over frequency.  Each lane carries its own time-shift phasor,
+ * started from an exact value at the beginning of a chunk and advanced
+ * FUSED_LANES bins at a time, and its own partial sums, so the lanes are
+ * independent and vectorise.
+ */
+static void LALInferenceFusedBinsInnerProducts(LALInferenceFusedBins *fused, const COMPLEX16 *hptilde, const COMPLEX16 *hctilde,
+                                               const REAL8 *Fplus, const REAL8 *Fcross, const REAL8 *twopit,
+                                               REAL8 *S, COMPLEX16 *R)
+{
+  const UINT4 nifo = fused->nifo;
+  REAL8 stepRe[nifo], stepIm[nifo];
+
+  for (UINT4 ifo = 0; ifo < nifo; ifo++) {
+    stepRe[ifo] = cos(twopit[ifo] * fused->deltaF * FUSED_LANES);
+    stepIm[ifo] = -sin(twopit[ifo] * fused->deltaF * FUSED_LANES);
+  }
+
+  #pragma omp parallel for schedule(static) if(fused->nchunks > 1)
+  for (UINT4 c = 0; c < fused->nchunks; c++) {
+    UINT4 k0 = c * FUSED_CHUNK;
+    UINT4 k1 = k0 + FUSED_CHUNK < fused->nbins ? k0 + FUSED_CHUNK : fused->nbins;
+    REAL8 phRe[nifo * FUSED_LANES], phIm[nifo * FUSED_LANES];
+    REAL8 accS[nifo * FUSED_LANES], accRe[nifo * FUSED_LANES], accIm[nifo * FUSED_LANES];
+    REAL8 tail[4 * FUSED_LANES];
+
+    for (UINT4 ifo = 0; ifo < nifo; ifo++)
+      for (UINT4 l = 0; l < FUSED_LANES; l++) {
+        REAL8 phi = twopit[ifo] * fused->deltaF * (fused->lower + k0 + l);
+        phRe[ifo * FUSED_LANES + l] = cos(phi);
+        phIm[ifo * FUSED_LANES + l] = -sin(phi);
+        accS[ifo * FUSED_LANES + l] = accRe[ifo * FUSED_LANES + l] = accIm[ifo * FUSED_LANES + l] = 0.0;
+      }
+
+    for (UINT4 k = k0; k < k1; k += FUSED_LANES) {
+      const REAL8 *hp = (const REAL8 *)(hptilde + fused->lower + k);
+      const REAL8 *hc = (const REAL8 *)(hctilde + fused->lower + k);
+      if (k + FUSED_LANES > k1) {
+        /* Zero-pad the last block, whose padding bins have zero weight */
+        UINT4 n = k1 - k;
+        for (UINT4 l = 0; l < 2 * FUSED_LANES; l++) {
+          tail[l] = l < 2 * n ? hp[l] : 0.0;
+          tail[2 * FUSED_LANES + l] = l < 2 * n ? hc[l] : 0.0;
+        }
+        hp = tail;
+        hc = tail + 2 * FUSED_LANES;
+      }
+      const REAL8 *blk = fused->bins + (size_t)(k / FUSED_LANES) * nifo * FUSED_NFIELDS * FUSED_LANES;
+      for (UINT4 ifo = 0; ifo < nifo; ifo++) {
+        const REAL8 *f = blk + ifo * FUSED_NFIELDS * FUSED_LANES;
+        REAL8 *pr = phRe + ifo * FUSED_LANES, *pi = phIm + ifo * FUSED_LANES;
+        REAL8 *as = accS + ifo * FUSED_LANES, *ar = accRe + ifo * FUSED_LANES, *ai = accIm + ifo * FUSED_LANES;
+        const REAL8 fp = Fplus[ifo], fc = Fcross[ifo], sr = stepRe[ifo], si = stepIm[ifo];
+        #pragma omp simd
+        for (UINT4 l = 0; l < FUSED_LANES; l++) {
+          /* Projection onto the detector */
+          REAL8 hre = fp * hp[2 * l] + fc * hc[2 * l];
+          REAL8 him = fp * hp[2 * l + 1] + fc * hc[2 * l + 1];
+          /* Time shift times calibration */
+          REAL8 cre = f[FUSED_CALRE * FUSED_LANES + l] * pr[l] - f[FUSED_CALIM * FUSED_LANES + l] * pi[l];
+          REAL8 cim = f[FUSED_CALRE * FUSED_LANES + l] * pi[l] + f[FUSED_CALIM * FUSED_LANES + l] * pr[l];
+          REAL8 tre = hre * cre - him * cim;
+          REAL8 tim = hre * cim + him * cre;
+          REAL8 w = f[FUSED_W * FUSED_LANES + l];
+          REAL8 dre = f[FUSED_DRE * FUSED_LANES + l], dim = f[FUSED_DIM * FUSED_LANES + l];
+          as[l] += w * (tre * tre + tim * tim);
+          ar[l] += w * (dre * tre + dim * tim);
+          ai[l] += w * (dim * tre - dre * tim);
+          /* Advance the phasor to the same lane of the next block */
+          REAL8 newRe = pr[l] * sr - pi[l] * si;
+          pi[l] = pr[l] * si + pi[l] * sr;
+          pr[l] = newRe;
+        }
+      }
+    }
+
+    REAL8 *acc = fused->partial + (size_t)c * nifo * 3;
+    for (UINT4 ifo = 0; ifo < nifo; ifo++) {
+      acc[3 * ifo] = acc[3 * ifo + 1] = acc[3 * ifo + 2] = 0.0;
+      for (UINT4 l = 0; l < FUSED_LANES; l++) {
+        acc[3 * ifo] += accS[ifo * FUSED_LANES + l];
+        acc[3 * ifo + 1] += accRe[ifo * FUSED_LANES + l];
+        acc[3 * ifo + 2] += accIm[ifo * FUSED_LANES + l];
+      }
+    }
+  }
+
+  for (UINT4 ifo = 0; ifo < nifo; ifo++) {
+    S[ifo] = 0.0;
+    R[ifo] = 0.0;
+  }
+  for (UINT4 c = 0; c < fused->nchunks; c++)
+    for (UINT4 ifo = 0; ifo < nifo; ifo++) {
+      const REAL8 *acc = fused->partial + ((size_t)c * nifo + ifo) * 3;
+      S[ifo] += acc[0];
+      R[ifo] += crect(acc[1], acc[2]);
+    }
+}
+
+/* Bookkeeping for one detector once its terms are known: accumulate the
+   network likelihood and <h|h>, record the detector SNRs and, with distance
+   marginalisation, the detector's marginal likelihood.  Returns XLAL_ERANGE
+   when the SNR falls outside the distance interpolation range. */
+static int LALInferenceStoreIFOInnerProducts(LALInferenceVariables *currentParams, LALInferenceIFOData *dataPtr,
+                                             LALInferenceModel *model, int ifo, LALInferenceLikelihoodFlags marginalisationflags,
+                                             REAL8 this_ifo_S, COMPLEX16 this_ifo_Rcplx, REAL8 *loglikelihood, REAL8 *S,
+                                             UINT4 margdist, double dist_min, double dist_max, int cosmology, int margphi)
+{
+    INT4 errnum=0;
+    switch(marginalisationflags)
+    {
+    case GAUSSIAN:
+    case STUDENTT:
+      *loglikelihood += model->ifo_loglikelihoods[ifo];
+      break;
+    case MARGTIME:
+    case MARGPHI:
+    case MARGTIMEPHI:
+      /* These are non-separable likelihoods, so single IFO log(L)
+	 doesn't make sense. */
+      model->ifo_loglikelihoods[ifo] = 0.0;
+      break;
+    default:
+      break;
+    }
+    *S+=this_ifo_S;
+    char varname[VARNAME_MAX];
+    if((VARNAME_MAX <= snprintf(varname,VARNAME_MAX,"%s_optimal_snr",dataPtr->name)))
+    {
+        fprintf(stderr,"variable name too long\n"); exit(1);
+    }
+    LALInferenceAddREAL8Variable(currentParams,varname,sqrt(2.0*this_ifo_S),LALINFERENCE_PARAM_OUTPUT);
+
+    if((VARNAME_MAX <= snprintf(varname,VARNAME_MAX,"%s_cplx_snr_amp",dataPtr->name)))
+    {
+        fprintf(stderr,"variable name too long\n"); exit(1);
+    }
+    REAL8 cplx_snr_amp=0.0;
+    REAL8 cplx_snr_phase=carg(this_ifo_Rcplx);
+    if(this_ifo_S > 0) cplx_snr_amp=2.0*cabs(this_ifo_Rcplx)/sqrt(2.0*this_ifo_S);
+
+    LALInferenceAddREAL8Variable(currentParams,varname,cplx_snr_amp,LALINFERENCE_PARAM_OUTPUT);
+
+    if((VARNAME_MAX <= snprintf(varname,VARNAME_MAX,"%s_cplx_snr_arg",dataPtr->name)))
+    {
+        fprintf(stderr,"variable name too long\n"); exit(1);
+    }
+    LALInferenceAddREAL8Variable(currentParams,varname,cplx_snr_phase,LALINFERENCE_PARAM_OUTPUT);
+    if(margdist )
+      {
+          if (margphi)
+          {
+            XLAL_TRY(model->ifo_loglikelihoods[ifo] = LALInferenceMarginalDistanceLogLikelihood(dist_min, dist_max, sqrt(this_ifo_S), 2.0*cabs(this_ifo_Rcplx), cosmology, margphi), errnum);
+          }
+          else
+          {
+            XLAL_TRY(model->ifo_loglikelihoods[ifo] = LALInferenceMarginalDistanceLogLikelihood(dist_min, dist_max, sqrt(this_ifo_S), 2.0*creal(this_ifo_Rcplx), cosmology, margphi), errnum);
+          }
+          errnum&=~XLAL_EFUNC;
+          if(errnum!=XLAL_SUCCESS)
+          {
+            switch(errnum)
+            {
+              case XLAL_ERANGE: /* The SNR input was outside the interpolation range */
+                return XLAL_ERANGE;
+              default: /* Panic! */
+                fprintf(stderr,"Unhandled error in marginal distance likelihood - exiting!\n");
+                fprintf(stderr,"XLALError: %d, %s\n",errnum,XLALErrorString(errnum));
+                exit(1);
+                break;
+            }
+          }
+      }
+    return XLAL_SUCCESS;
+}
+
+/* ============ Relative binning: ========== */
+
+/* Bound on the phase difference between any two waveforms in the prior,
+   2 pi sum_a sgn(g_a) (f/f_a)^g_a with the PN powers g_a of arXiv:1806.08792,
+   referred to fmin for negative and to fmax for positive powers */
+static REAL8 RelativeBinningPhaseBound(REAL8 f, REAL8 fmin, REAL8 fmax)
+{
+  static const REAL8 gammas[] = {-5.0/3.0, -2.0/3.0, 1.0, 5.0/3.0, 7.0/3.0};
+  REAL8 psi = 0.0;
+  for (UINT4 a = 0; a < sizeof(gammas)/sizeof(gammas[0]); a++)
+    psi += gammas[a] < 0 ? -pow(f/fmin, gammas[a]) : pow(f/fmax, gammas[a]);
+  return LAL_TWOPI*psi;
+}
+
+/* Bin edges on the frequency samples lower ... upper, placed where the
+   phase bound crosses a multiple of epsilon, so that the bins are narrow
+   where the phase of the waveform changes quickly */
+static REAL8Sequence *RelativeBinningEdges(REAL8 f0, REAL8 deltaF, UINT4 lower, UINT4 upper, REAL8 epsilon)
+{
+  REAL8 fmin = f0 + lower*deltaF, fmax = f0 + upper*deltaF;
+  XLAL_CHECK_NULL(fmin > 0 && upper > lower, XLAL_EINVAL, "Invalid frequency range for relative binning");
+  REAL8 psimin = RelativeBinningPhaseBound(fmin, fmin, fmax);
+  REAL8 psimax = RelativeBinningPhaseBound(fmax, fmin, fmax);
+  UINT4 maxedges = (UINT4)ceil((psimax - psimin)/epsilon) + 2;
+  if (maxedges > upper - lower + 1) maxedges = upper - lower + 1;
+
+  REAL8Sequence *edges = XLALCreateREAL8Sequence(maxedges);
+  XLAL_CHECK_NULL(edges, XLAL_EFUNC);
+  UINT4 n = 0;
+  REAL8 level = psimin + epsilon;
+  edges->data[n++] = fmin;
+  for (UINT4 k = lower + 1; k < upper && n < maxedges - 1; k++) {
+    REAL8 psi = RelativeBinningPhaseBound(f0 + k*deltaF, fmin, fmax);
+    if (psi < level) continue;
+    edges->data[n++] = f0 + k*deltaF;
+    while (level <= psi) level += epsilon;
+  }
+  edges->data[n++] = fmax;
+  return XLALResizeREAL8Sequence(edges, 0, n);
+}
+
+static LALInferenceRelativeBinningModel *RelativeBinningModelCreate(REAL8Sequence *binEdges)
+{
+  LALInferenceRelativeBinningModel *relbin = XLALCalloc(1, sizeof(*relbin));
+  XLAL_CHECK_NULL(relbin, XLAL_ENOMEM);
+  relbin->binEdges = relbin->frequencies = XLALCutREAL8Sequence(binEdges, 0, binEdges->length);
+  relbin->hEdges = XLALCreateCOMPLEX16Sequence(binEdges->length);
+  relbin->r0 = XLALCreateCOMPLEX16Sequence(binEdges->length - 1);
+  relbin->r1 = XLALCreateCOMPLEX16Sequence(binEdges->length - 1);
+  relbin->calFactor = XLALCreateCOMPLEX16Sequence(binEdges->length);
+  if (!relbin->binEdges || !relbin->hEdges || !relbin->r0 || !relbin->r1 || !relbin->calFactor) {
+    LALInferenceDestroyRelativeBinningModel(relbin);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+  return relbin;
+}
+
+void LALInferenceDestroyRelativeBinningModel(LALInferenceRelativeBinningModel *relbin)
+{
+  if (!relbin) return;
+  XLALDestroyREAL8Sequence(relbin->binEdges);
+  XLALDestroyCOMPLEX16FrequencySeries(relbin->hptilde);
+  XLALDestroyCOMPLEX16FrequencySeries(relbin->hctilde);
+  XLALDestroyCOMPLEX16Sequence(relbin->hEdges);
+  XLALDestroyCOMPLEX16Sequence(relbin->r0);
+  XLALDestroyCOMPLEX16Sequence(relbin->r1);
+  XLALDestroyCOMPLEX16Sequence(relbin->calFactor);
+  XLALFree(relbin);
+}
+
+int LALInferenceSetupRelativeBinning(LALInferenceRunState *runState)
+{
+  ProcessParamsTable *ppt;
+  LALInferenceIFOData *data = runState->data, *dataPtr;
+  LALInferenceThreadState *thread = &(runState->threads[0]);
+  LALInferenceModel *model = thread->model;
+  LALInferenceTemplateFunction fullTemplate = model->templt;
+  REAL8 epsilon = 0.025;
+  REAL8 scale = 1e-4;
+  UINT4 ntest = 8;
+  UINT4 lower = UINT32_MAX, upper = 0;
+  INT4 errnum = 0;
+
+  if ((ppt = LALInferenceGetProcParamVal(runState->commandLine, "--relative-binning-epsilon")))
+    epsilon = atof(ppt->value);
+  if ((ppt = LALInferenceGetProcParamVal(runState->commandLine, "--relative-binning-test")))
+    ntest = atoi(ppt->value);
+  if ((ppt = LALInferenceGetProcParamVal(runState->commandLine, "--relative-binning-test-scale")))
+    scale = atof(ppt->value);
+  XLAL_CHECK(epsilon > 0, XLAL_EINVAL, "--relative-binning-epsilon must be positive");
+  XLAL_CHECK(model->domain == LAL_SIM_DOMAIN_FREQUENCY, XLAL_EINVAL, "Relative binning requires a frequency-domain approximant");
+  XLAL_CHECK(!model->roq_flag, XLAL_EINVAL, "Relative binning and ROQ cannot be used together");
+  const char *unsupported[] = {"psdScaleFlag", "glitchFitFlag", "constantcal_active", NULL};
+  for (UINT4 i = 0; unsupported[i]; i++)
+    XLAL_CHECK(!LALInferenceCheckVariable(thread->currentParams, unsupported[i]) || !*(INT4 *)LALInferenceGetVariable(thread->currentParams, unsupported[i]),
+               XLAL_EINVAL, "Relative binning does not support %s", unsupported[i]);
+
+  /* The detectors share the frequency grid of the first one */
+  const REAL8 f0 = data->freqData->f0, deltaF = data->freqData->deltaF;
+  XLAL_CHECK(f0 == 0.0, XLAL_EINVAL, "Relative binning requires frequency data starting at 0 Hz");
+  for (dataPtr = data; dataPtr; dataPtr = dataPtr->next) {
+    UINT4 l, u;
+    XLAL_CHECK(dataPtr->freqData->f0 == f0 && dataPtr->freqData->deltaF == deltaF && dataPtr->freqData->data->length == data->freqData->data->length,
+               XLAL_EINVAL, "Relative binning requires the same frequency sampling in all detectors");
+    XLAL_CHECK(fabs(deltaF * dataPtr->timeData->data->length * dataPtr->timeData->deltaT - 1.0) < 1e-9, XLAL_EINVAL, "Frequency spacing of %s does not match its time series", dataPtr->name);
+    LALInferenceIFOBinRange(dataPtr, &l, &u);
+    XLAL_CHECK(u < dataPtr->freqData->data->length, XLAL_EINVAL, "Upper frequency of %s beyond the data", dataPtr->name);
+    if (l < lower) lower = l;
+    if (u > upper) upper = u;
+  }
+
+  REAL8Sequence *binEdges = RelativeBinningEdges(f0, deltaF, lower, upper, epsilon);
+  XLAL_CHECK(binEdges, XLAL_EFUNC);
+
+  /* The full likelihood at the starting point, which is the fiducial
+     waveform, also leaves the antenna patterns and time shifts of the
+     fiducial in each detector */
+  REAL8 logLFull = runState->likelihood(thread->currentParams, data, model);
+  XLAL_CHECK(!isinf(logLFull) && !isnan(logLFull), XLAL_EFUNC, "Likelihood of the fiducial waveform is %g", logLFull);
+
+  /* Fiducial h+ and hx on the full grid, then at the bin edges, with the
+     parameters the likelihood left in model->params */
+  REAL8Sequence *grid = XLALCreateREAL8Sequence(upper - lower + 1);
+  XLAL_CHECK(grid, XLAL_EFUNC);
+  for (UINT4 k = lower; k <= upper; k++)
+    grid->data[k - lower] = f0 + k*deltaF;
+  model->relbin = RelativeBinningModelCreate(binEdges);
+  XLAL_CHECK(model->relbin, XLAL_EFUNC);
+  model->relbin->frequencies = grid;
+  XLAL_TRY(LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence(model), errnum);
+  XLAL_CHECK(errnum == XLAL_SUCCESS, XLAL_EFUNC, "Could not generate the fiducial waveform");
+  COMPLEX16FrequencySeries *hpGrid = model->relbin->hptilde, *hcGrid = model->relbin->hctilde;
+  model->relbin->hptilde = model->relbin->hctilde = NULL;
+  model->relbin->frequencies = model->relbin->binEdges;
+  XLAL_TRY(LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence(model), errnum);
+  XLAL_CHECK(errnum == XLAL_SUCCESS, XLAL_EFUNC, "Could not generate the fiducial waveform at the bin edges");
+
+  const REAL8 deltaT = data->timeData->deltaT;
+  const REAL8 TwoDeltaToverN = 2.0 * deltaT / ((double) data->timeData->data->length);
+  for (dataPtr = data; dataPtr; dataPtr = dataPtr->next) {
+    UINT4 l, u;
+    LALInferenceIFOBinRange(dataPtr, &l, &u);
+    COMPLEX16FrequencySeries *h0 = XLALCreateCOMPLEX16FrequencySeries("fiducial", &(dataPtr->freqData->epoch), f0, deltaF, &lalDimensionlessUnit, dataPtr->freqData->data->length);
+    REAL8FrequencySeries *psd = XLALCreateREAL8FrequencySeries("band-limited PSD", &(dataPtr->freqData->epoch), f0, deltaF, &lalDimensionlessUnit, dataPtr->freqData->data->length);
+    dataPtr->relbin = XLALCalloc(1, sizeof(LALInferenceRelativeBinningData));
+    XLAL_CHECK(h0 && psd && dataPtr->relbin, XLAL_ENOMEM);
+    dataPtr->relbin->h0Edges = XLALCreateCOMPLEX16Sequence(binEdges->length);
+    XLAL_CHECK(dataPtr->relbin->h0Edges, XLAL_EFUNC);
+
+    /* Projected and time-shifted as in the likelihood; samples outside the
+       band of the detector get zero PSD, which the summary data ignore */
+    memset(h0->data->data, 0, h0->data->length * sizeof(COMPLEX16));
+    memset(psd->data->data, 0, psd->data->length * sizeof(REAL8));
+    dataPtr->relbin->dd = 0.0;
+    for (UINT4 k = l; k <= u; k++) {
+      REAL8 f = f0 + k*deltaF;
+      REAL8 S = dataPtr->oneSidedNoisePowerSpectrum->data->data[k];
+      COMPLEX16 d = dataPtr->freqData->data->data[k];
+      h0->data->data[k] = (dataPtr->fPlus*hpGrid->data->data[k - lower] + dataPtr->fCross*hcGrid->data->data[k - lower]) * cexp(-I*LAL_TWOPI*dataPtr->timeshift*f);
+      psd->data->data[k] = S;
+      dataPtr->relbin->dd += TwoDeltaToverN*(creal(d)*creal(d) + cimag(d)*cimag(d))/(S*deltaT*deltaT);
+    }
+    for (UINT4 e = 0; e < binEdges->length; e++)
+      dataPtr->relbin->h0Edges->data[e] = (dataPtr->fPlus*model->relbin->hptilde->data->data[e] + dataPtr->fCross*model->relbin->hctilde->data->data[e])
+                                          * cexp(-I*LAL_TWOPI*dataPtr->timeshift*binEdges->data[e]);
+    dataPtr->relbin->summary = XLALSimInspiralRelativeBinningSummaryCreate(binEdges, dataPtr->freqData, h0, psd);
+    XLALDestroyCOMPLEX16FrequencySeries(h0);
+    XLALDestroyREAL8FrequencySeries(psd);
+    XLAL_CHECK(dataPtr->relbin->summary, XLAL_EFUNC);
+  }
+  XLALDestroyCOMPLEX16FrequencySeries(hpGrid);
+  XLALDestroyCOMPLEX16FrequencySeries(hcGrid);
+  XLALDestroyREAL8Sequence(grid);
+
+  /* Every thread evaluates its templates at the bin edges only */
+  model->templt = &LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence;
+  for (INT4 t = 1; t < runState->nthreads; t++) {
+    runState->threads[t].model->relbin = RelativeBinningModelCreate(binEdges);
+    XLAL_CHECK(runState->threads[t].model->relbin, XLAL_EFUNC);
+    runState->threads[t].model->templt = &LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence;
+  }
+
+  /* Accuracy with respect to the full likelihood, at the fiducial point
+     and at points scattered around it by a fraction of the prior widths */
+  REAL8 logLRelbin = runState->likelihood(thread->currentParams, data, model);
+  REAL8 maxDeltaLogL = fabs(logLRelbin - logLFull), meanDeltaLogL = 0.0;
+  UINT4 ngood = 0;
+  LALInferenceVariables test;
+  memset(&test, 0, sizeof(test));
+  for (UINT4 i = 0; i < ntest && thread->GSLrandom; i++) {
+    LALInferenceCopyVariables(thread->currentParams, &test);
+    for (LALInferenceVariableItem *item = test.head; item; item = item->next) {
+      REAL8 min, max;
+      if (item->type != LALINFERENCE_REAL8_t || !LALInferenceCheckVariableNonFixed(&test, item->name)
+          || !LALInferenceCheckMinMaxPrior(runState->priorArgs, item->name))
+        continue;
+      LALInferenceGetMinMaxPrior(runState->priorArgs, item->name, &min, &max);
+      REAL8 x = *(REAL8 *)item->value + gsl_ran_gaussian(thread->GSLrandom, scale*(max - min));
+      if (item->vary == LALINFERENCE_PARAM_CIRCULAR)
+        x = min + fmod(fmod(x - min, max - min) + (max - min), max - min);
+      else
+        x = x < min ? min : (x > max ? max : x);
+      *(REAL8 *)item->value = x;
+    }
+    REAL8 logLTest = runState->likelihood(&test, data, model);
+    LALInferenceRelativeBinningModel *relbin = model->relbin;
+    model->relbin = NULL;
+    model->templt = fullTemplate;
+    REAL8 logLTestFull = runState->likelihood(&test, data, model);
+    model->relbin = relbin;
+    model->templt = &LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence;
+    LALInferenceClearVariables(&test);
+    if (isinf(logLTest) || isinf(logLTestFull)) continue;
+    meanDeltaLogL += fabs(logLTest - logLTestFull);
+    if (fabs(logLTest - logLTestFull) > maxDeltaLogL) maxDeltaLogL = fabs(logLTest - logLTestFull);
+    ngood++;
+  }
+
+  fprintf(stdout, "Relative binning: %u bins between %g and %g Hz (epsilon = %g)\n", binEdges->length - 1, binEdges->data[0], binEdges->data[binEdges->length - 1], epsilon);
+  fprintf(stdout, "Relative binning: log(L) at fiducial point %.6f, full likelihood %.6f\n", logLRelbin, logLFull);
+  if (ngood)
+    fprintf(stdout, "Relative binning: |delta log(L)| over %u nearby points: mean %g, max %g\n", ngood, meanDeltaLogL/ngood, maxDeltaLogL);
+  LALInferenceAddVariable(runState->algorithmParams, "relativeBinningMaxDeltaLogL", &maxDeltaLogL, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_FIXED);
+  XLALDestroyREAL8Sequence(binEdges);
+
+  return XLAL_SUCCESS;
+}
+
 /* ============ Likelihood computations: ========== */
 
 /**
@@ -356,12 +1072,10 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
   /* Burst templates are generated at hrss=1, thus need to rescale amplitude */
   double amp_prefactor=1.0;
 
-  COMPLEX16FrequencySeries *calFactor = NULL;
+  const COMPLEX16 *calFactor = NULL;
+  UINT4 calVersion = 0;
   COMPLEX16 calF = 0.0;
-
-  REAL8Vector *logfreqs = NULL;
-  REAL8Vector *amps = NULL;
-  REAL8Vector *phases = NULL;
+  LALInferenceSplineCalibrationCache *spcal = NULL;
 
   UINT4 spcal_active = 0;
   REAL8 calamp=0.0;
@@ -417,6 +1131,8 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
     margtime=1;
 
   if(model->roq_flag && margtime) XLAL_ERROR_REAL8(XLAL_EINVAL,"ROQ does not support time marginalisation");
+  if(model->relbin && margtime) XLAL_ERROR_REAL8(XLAL_EINVAL,"Relative binning does not support time marginalisation");
+  if(model->relbin && constantcal_active) XLAL_ERROR_REAL8(XLAL_EINVAL,"Relative binning does not support constant calibration error marginalisation");
 
   
   LALStatus status;
@@ -587,6 +1303,21 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
   /* Reset SNR */
   model->SNR = 0.0;
 
+  /* The Gaussian and phase-marginalised likelihoods go through the fused
+     kernel; noise and glitch fitting, constant calibration, time
+     marginalisation and ROQ keep the loop over bins below. */
+  LALInferenceFusedBins *fused = NULL;
+  if (signalFlag && !model->roq_flag && !model->relbin && !psdFlag && !glitchFlag && !constantcal_active
+      && (marginalisationflags==GAUSSIAN || marginalisationflags==MARGPHI))
+    fused = LALInferenceGetFusedBins(model, data);
+  REAL8 fusedFplus[Nifos], fusedFcross[Nifos], fusedTwopit[Nifos];
+
+  /* Spline calibration factors of all detectors */
+  if (signalFlag && spcal_active) {
+    spcal = LALInferenceUpdateSplineCalibration(model, data, currentParams);
+    if (!spcal) XLAL_ERROR_REAL8(XLAL_EFUNC, "Unable to evaluate spline calibration");
+  }
+
   /* loop over data (different interferometers): */
   for(dataPtr=data,ifo=0; dataPtr; dataPtr=dataPtr->next,ifo++) {
     /* The parameters the Likelihood function can handle by itself   */
@@ -681,34 +1412,20 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
         /* Calibration stuff if necessary */
         /*spline*/
         if (spcal_active) {
-          logfreqs = NULL;
-          amps = NULL;
-          phases = NULL;
-	  /* get_calib_spline creates and fills the logfreqs, amps, phases arrays */
-	  get_calib_spline(currentParams, dataPtr->name, &logfreqs, &amps, &phases);
 	  if (model->roq_flag) {
-
-             LALInferenceSplineCalibrationFactorROQ(logfreqs, amps, phases,
-						model->roq->frequencyNodesLinear,
-						&(model->roq->calFactorLinear),
-						model->roq->frequencyNodesQuadratic,
-						&(model->roq->calFactorQuadratic));
+	    memcpy(model->roq->calFactorLinear->data, spcal->linear[ifo]->factors->data,
+	           model->roq->calFactorLinear->length * sizeof(COMPLEX16));
+	    memcpy(model->roq->calFactorQuadratic->data, spcal->quadratic[ifo]->factors->data,
+	           model->roq->calFactorQuadratic->length * sizeof(COMPLEX16));
+	  }
+	  else if (model->relbin) {
+	    memcpy(model->relbin->calFactor->data, spcal->linear[ifo]->factors->data,
+	           model->relbin->calFactor->length * sizeof(COMPLEX16));
+	  }
+	  else {
+	    calFactor = spcal->linear[ifo]->factors->data;
+	    calVersion = spcal->version[ifo];
 	  }
-
-	  else{
-	    if (calFactor == NULL) {
-	      calFactor = XLALCreateCOMPLEX16FrequencySeries("calibration factors",
-                       &(dataPtr->freqData->epoch),
-                       0, dataPtr->freqData->deltaF,
-                       &lalDimensionlessUnit,
-                       dataPtr->freqData->data->length);
-	    }
-          LALInferenceSplineCalibrationFactor(logfreqs, amps, phases, calFactor);
-	}
-	if(logfreqs) XLALDestroyREAL8Vector(logfreqs);
-	if(amps) XLALDestroyREAL8Vector(amps);
-	if(phases) XLALDestroyREAL8Vector(phases);
-
         }
         /*constant*/
         if (constantcal_active){
@@ -752,6 +1469,16 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
         dataPtr->timeshift = timeshift;
     }//end signalFlag condition
 
+    if (fused) {
+      /* Only record the detector here, all bins are summed after the loop */
+      LALInferenceFusedBinsSetCalibration(fused, ifo, calFactor, calVersion);
+      calFactor = NULL;
+      fusedFplus[ifo] = Fplus;
+      fusedFcross[ifo] = Fcross;
+      fusedTwopit[ifo] = twopit;
+      continue;
+    }
+
     /* determine frequency range & loop over frequency bins: */
     deltaT = dataPtr->timeData->deltaT;
     deltaF = 1.0 / (((double)dataPtr->timeData->data->length) * deltaT);
@@ -885,6 +1612,32 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
     REAL8 cplx_snr_phase = carg(this_ifo_d_inner_h);
     LALInferenceAddREAL8Variable(currentParams,varname,cplx_snr_phase,LALINFERENCE_PARAM_OUTPUT);
 
+    }
+    else if (model->relbin) {
+      /* Projected, time-shifted and calibrated template at the bin edges only */
+      LALInferenceRelativeBinningModel *relbin = model->relbin;
+      for (UINT4 e = 0; e < relbin->binEdges->length; e++) {
+        COMPLEX16 h = Fplus*relbin->hptilde->data->data[e] + Fcross*relbin->hctilde->data->data[e];
+        h *= cexp(-I*twopit*relbin->binEdges->data[e]);
+        if (spcal_active) h *= relbin->calFactor->data[e];
+        relbin->hEdges->data[e] = h;
+      }
+      COMPLEX16 dh=0.0;
+      REAL8 hh=0.0;
+      if (XLALSimInspiralRelativeBinningRatio(relbin->r0, relbin->r1, relbin->hEdges, dataPtr->relbin->h0Edges, relbin->binEdges) != XLAL_SUCCESS
+          || XLALSimInspiralRelativeBinningInnerProducts(&dh, &hh, dataPtr->relbin->summary, relbin->r0, relbin->r1) != XLAL_SUCCESS)
+        XLAL_ERROR_REAL8(XLAL_EFUNC, "Relative binning inner products failed");
+
+      /* The summary data give <d|h> = sum conj(d) h; the scalar loop accumulates half of the conjugate */
+      REAL8 this_ifo_S = 0.5*hh;
+      COMPLEX16 this_ifo_Rcplx = 0.5*conj(dh);
+      model->ifo_loglikelihoods[ifo] = -(dataPtr->relbin->dd + this_ifo_S - 2.0*creal(this_ifo_Rcplx));
+      D += dataPtr->relbin->dd;
+      Rcplx += this_ifo_Rcplx;
+      errnum = LALInferenceStoreIFOInnerProducts(currentParams, dataPtr, model, ifo, marginalisationflags,
+                                                 this_ifo_S, this_ifo_Rcplx, &loglikelihood, &S,
+                                                 margdist, dist_min, dist_max, cosmology, margphi);
+      if(errnum==XLAL_ERANGE) return (-INFINITY);
     }
     else{
     REAL8 *psd=&(dataPtr->oneSidedNoisePowerSpectrum->data->data[lower]);
@@ -947,7 +1700,7 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
       template = plainTemplate * (re + I*im);
 
       if (spcal_active) {
-          calF = calFactor->data->data[i];
+          calF = calFactor[i];
           template = template*calF;
       }
 
@@ -1023,79 +1776,32 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
 
 
     } /* End loop over freq bins */
-    switch(marginalisationflags)
+    errnum = LALInferenceStoreIFOInnerProducts(currentParams, dataPtr, model, ifo, marginalisationflags,
+                                               this_ifo_S, this_ifo_Rcplx, &loglikelihood, &S,
+                                               margdist, dist_min, dist_max, cosmology, margphi);
+    if(errnum==XLAL_ERANGE) /* The SNR input was outside the interpolation range */
     {
-    case GAUSSIAN:
-    case STUDENTT:
-      loglikelihood += model->ifo_loglikelihoods[ifo];
-      break;
-    case MARGTIME:
-    case MARGPHI:
-    case MARGTIMEPHI:
-      /* These are non-separable likelihoods, so single IFO log(L)
-	 doesn't make sense. */
-      model->ifo_loglikelihoods[ifo] = 0.0;
-      break;
-    default:
-      break;
-    }
-    S+=this_ifo_S;
-    char varname[VARNAME_MAX];
-    if((VARNAME_MAX <= snprintf(varname,VARNAME_MAX,"%s_optimal_snr",dataPtr->name)))
-    {
-        fprintf(stderr,"variable name too long\n"); exit(1);
-    }
-    LALInferenceAddREAL8Variable(currentParams,varname,sqrt(2.0*this_ifo_S),LALINFERENCE_PARAM_OUTPUT);
-
-    if((VARNAME_MAX <= snprintf(varname,VARNAME_MAX,"%s_cplx_snr_amp",dataPtr->name)))
-    {
-        fprintf(stderr,"variable name too long\n"); exit(1);
-    }
-    REAL8 cplx_snr_amp=0.0;
-    REAL8 cplx_snr_phase=carg(this_ifo_Rcplx);
-    if(this_ifo_S > 0) cplx_snr_amp=2.0*cabs(this_ifo_Rcplx)/sqrt(2.0*this_ifo_S);
-
-    LALInferenceAddREAL8Variable(currentParams,varname,cplx_snr_amp,LALINFERENCE_PARAM_OUTPUT);
-
-    if((VARNAME_MAX <= snprintf(varname,VARNAME_MAX,"%s_cplx_snr_arg",dataPtr->name)))
-    {
-        fprintf(stderr,"variable name too long\n"); exit(1);
-    }
-    LALInferenceAddREAL8Variable(currentParams,varname,cplx_snr_phase,LALINFERENCE_PARAM_OUTPUT);
-    if(margdist )
-      {
-          if (margphi)
-          {
-            XLAL_TRY(model->ifo_loglikelihoods[ifo] = LALInferenceMarginalDistanceLogLikelihood(dist_min, dist_max, sqrt(this_ifo_S), 2.0*cabs(this_ifo_Rcplx), cosmology, margphi), errnum);
-          }
-          else
-          {
-            XLAL_TRY(model->ifo_loglikelihoods[ifo] = LALInferenceMarginalDistanceLogLikelihood(dist_min, dist_max, sqrt(this_ifo_S), 2.0*creal(this_ifo_Rcplx), cosmology, margphi), errnum);
-          } 
-          errnum&=~XLAL_EFUNC;
-          if(errnum!=XLAL_SUCCESS)
-          {
-            switch(errnum)
-            {
-              case XLAL_ERANGE: /* The SNR input was outside the interpolation range */
-		if(calFactor) {XLALDestroyCOMPLEX16FrequencySeries(calFactor); calFactor=NULL;}
-                return (-INFINITY);
-                break;
-              default: /* Panic! */
-                fprintf(stderr,"Unhandled error in marginal distance likelihood - exiting!\n");
-                fprintf(stderr,"XLALError: %d, %s\n",errnum,XLALErrorString(errnum));
-                exit(1);
-                break;
-            }
-          }
-      }
-   /* Clean up calibration if necessary */
-    if (!(calFactor == NULL)) {
-      XLALDestroyCOMPLEX16FrequencySeries(calFactor);
-      calFactor = NULL;
+      return (-INFINITY);
     }
+    calFactor = NULL;
   } /* end loop over detectors */
 
+  }
+  if (fused) {
+    REAL8 fusedS[Nifos];
+    COMPLEX16 fusedR[Nifos];
+    LALInferenceFusedBinsInnerProducts(fused, model->freqhPlus->data->data, model->freqhCross->data->data,
+                                       fusedFplus, fusedFcross, fusedTwopit, fusedS, fusedR);
+    for(dataPtr=data,ifo=0; dataPtr; dataPtr=dataPtr->next,ifo++) {
+      /* Sum of |d-h|^2 over bins, expanded as <d|d> + <h|h> - 2 Re <d|h> */
+      model->ifo_loglikelihoods[ifo] = -(fused->D[ifo] + fusedS[ifo] - 2.0*creal(fusedR[ifo]));
+      D += fused->D[ifo];
+      Rcplx += fusedR[ifo];
+      errnum = LALInferenceStoreIFOInnerProducts(currentParams, dataPtr, model, ifo, marginalisationflags,
+                                                 fusedS[ifo], fusedR[ifo], &loglikelihood, &S,
+                                                 margdist, dist_min, dist_max, cosmology, margphi);
+      if(errnum==XLAL_ERANGE) return (-INFINITY);
+    }
   }
   if (model->roq_flag){
 
@@ -1405,44 +2111,96 @@ static REAL8 LALInferenceFusedFreqDomainLogLikelihood(LALInferenceVariables *cur
   return(loglikelihood);
 }
 
+/* Distance-marginalisation lookup table for one distance prior */
+typedef struct tagDistanceMargTable {
+    double dist_min, dist_max;
+    int cosmology, margphi;
+    double log_norm;
+    log_radial_integrator *integrator;
+    struct tagDistanceMargTable *next;
+} DistanceMargTable;
+
+/* Tables built so far.  Entries are never modified or freed once published,
+ * so they are looked up without locking: the head of the list is read and
+ * written atomically, and a table is filled in before it is published. */
+static DistanceMargTable *distance_marg_tables = NULL;
+
+static DistanceMargTable *LoadDistanceMargTables(void)
+{
+    DistanceMargTable *tables;
+    #pragma omp atomic read seq_cst
+    tables = distance_marg_tables;
+    return tables;
+}
+
+static const DistanceMargTable *FindDistanceMargTable(const DistanceMargTable *table, double dist_min, double dist_max, int cosmology, int margphi)
+{
+    for (; table; table = table->next)
+        if (table->dist_min == dist_min && table->dist_max == dist_max &&
+                table->cosmology == cosmology && table->margphi == margphi)
+            return table;
+    return NULL;
+}
+
 double LALInferenceMarginalDistanceLogLikelihood(double dist_min, double dist_max, double OptimalSNR, double d_inner_h, int cosmology, int margphi)
 {
         static const size_t default_log_radial_integrator_size = 400;
         double loglikelihood=0;
-        static double log_norm = 0;
-        static log_radial_integrator *integrator;
+        const DistanceMargTable *table;
 
-        double pmax = 100000; /* CHECKME: Max SNR allowed ? */
-        #pragma omp critical
+        double pmax = 100000; /* Extent of the table in optimal SNR; quadrature is used above it */
+        table = FindDistanceMargTable(LoadDistanceMargTables(), dist_min, dist_max, cosmology, margphi);
+        if (!table)
         {
-            if (integrator == NULL)
+            #pragma omp critical(distance_marg_tables)
             {
-                printf("Initialising distance integration lookup table\n");
-                /* Initialise the integrator for the first time */
-                integrator = log_radial_integrator_init(
-                                dist_min,
-                                dist_max,
-                                2, /* Power of distance in prior */
-                                cosmology,
-                                pmax,
-                                default_log_radial_integrator_size * 5, /* CHECKME: fudge factor of 5 compared to bayestar */
-                                !margphi);
-                /* distance prior normalisation */
-                log_norm = log_radial_integrator_eval(integrator, 0, 0, -INFINITY, -INFINITY);
+                table = FindDistanceMargTable(LoadDistanceMargTables(), dist_min, dist_max, cosmology, margphi);
+                if (!table)
+                {
+                    printf("Initialising distance integration lookup table\n");
+                    /* Tabulate the integral for this prior */
+                    log_radial_integrator *integrator = log_radial_integrator_init(
+                                    dist_min,
+                                    dist_max,
+                                    2, /* Power of distance in prior */
+                                    cosmology,
+                                    pmax,
+                                    default_log_radial_integrator_size * 5, /* CHECKME: fudge factor of 5 compared to bayestar */
+                                    !margphi);
+                    DistanceMargTable *new_table = integrator ? calloc(1, sizeof(*new_table)) : NULL;
+                    if (new_table)
+                    {
+                        new_table->dist_min = dist_min;
+                        new_table->dist_max = dist_max;
+                        new_table->cosmology = cosmology;
+                        new_table->margphi = margphi;
+                        new_table->integrator = integrator;
+                        /* distance prior normalisation */
+                        new_table->log_norm = log_radial_integrator_eval(integrator, 0, 0, -INFINITY, -INFINITY);
+                        new_table->next = distance_marg_tables;
+                        printf("Distance integration lookup table error < %g in log likelihood\n", integrator->max_error);
+
+                        /* Publish the filled-in table */
+                        #pragma omp atomic write seq_cst
+                        distance_marg_tables = new_table;
+                        table = new_table;
+                    }
+                }
             }
         }
-        #pragma omp barrier
-        if (!integrator) XLAL_ERROR(XLAL_EFUNC, "Unable to initialise distance marginalisation integrator");
-        
-        if (isnan(OptimalSNR) || isnan(d_inner_h) || pmax<OptimalSNR)
+        if (!table) XLAL_ERROR(XLAL_EFUNC, "Unable to initialise distance marginalisation integrator");
+
+        if (isnan(OptimalSNR) || isnan(d_inner_h))
         {
             loglikelihood=-INFINITY;
-            XLAL_ERROR(XLAL_ERANGE,"warning: Optimal SNR %lf exceeded pmax %lf\n",OptimalSNR, pmax);
+            XLAL_ERROR(XLAL_ERANGE,"warning: Optimal SNR %lf or <d|h> %lf is not a number\n",OptimalSNR, d_inner_h);
         }
         else
         {
-            double marg_l = log_radial_integrator_eval(integrator, OptimalSNR , d_inner_h, log(OptimalSNR), log(d_inner_h));
-            loglikelihood = marg_l - log_norm; /* Normalise prior */
+            double marg_l = log_radial_integrator_eval(table->integrator, OptimalSNR , d_inner_h, log(OptimalSNR), log(d_inner_h));
+            if (XLAL_IS_REAL8_FAIL_NAN(marg_l))
+                XLAL_ERROR_REAL8(XLAL_EFUNC, "Distance integral failed for optimal SNR %lf and <d|h> %lf", OptimalSNR, d_inner_h);
+            loglikelihood = marg_l - table->log_norm; /* Normalise prior */
         }
         return (loglikelihood);
 }
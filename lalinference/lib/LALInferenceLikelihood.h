@@ -181,7 +181,10 @@ REAL8 LALInferenceMarginalisedTimePhaseLogLikelihood(LALInferenceVariables *curr
 
 /** Compute delta-log-likelihood for given distance min, max and OptimalSNR and d_inner_h when evaluated at 1Mpc
   * cosmology: 0 = Euclidean distance prior , 1 = uniform in comoving volume
-    margphi: 0 = use gaussian likelihood, 1 = phase-marginalised bessel likelihood */
+    margphi: 0 = use gaussian likelihood, 1 = phase-marginalised bessel likelihood
+  * The integral is interpolated from a lookup table built on the first call for each prior,
+  * falling back to quadrature outside the table.  Fails with XLAL_ERANGE for NaN inputs,
+  * or if the quadrature does not converge */
 double LALInferenceMarginalDistanceLogLikelihood(double dist_min, double dist_max, double OptimalSNR, double d_inner_h, int cosmology, int margphi);
 
 
@@ -199,6 +202,37 @@ REAL8 LALInferenceMarginalisedTimeLogLikelihood(LALInferenceVariables *currentPa
  */
 void LALInferenceInitLikelihood(LALInferenceRunState *runState);
 
+/**
+ * Set up relative binning (arXiv:1806.08792) of the frequency-domain
+ * likelihood around the starting point of thread 0, which is taken as the
+ * fiducial waveform.  Bins are placed where the post-Newtonian bound on the
+ * phase difference to the fiducial grows by --relative-binning-epsilon, the
+ * summary data of each detector are computed, and the template of every
+ * thread is replaced by LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence().
+ * The accuracy against the full likelihood is reported at the fiducial and
+ * at --relative-binning-test nearby points.
+ */
+int LALInferenceSetupRelativeBinning(LALInferenceRunState *runState);
+
+/** Free the relative binning buffers of a model, see LALInferenceSetupRelativeBinning() */
+void LALInferenceDestroyRelativeBinningModel(LALInferenceRelativeBinningModel *relbin);
+
+/**
+ * Discard the data and noise weights that the frequency-domain likelihood
+ * keeps in \c model for its fused multi-detector kernel.  They are copied
+ * again from the network at the next likelihood call.  The copy is only
+ * redone by itself when the network, the data or PSD series or the band of
+ * a detector are replaced, so this must be called after the samples of the
+ * data or PSD of a detector are modified in place.
+ */
+void LALInferenceResetFusedBins(LALInferenceModel *model);
+
+/**
+ * Discard the spline calibration bases and factors that the likelihood keeps
+ * in \c model.  They are built again at the next likelihood call.
+ */
+void LALInferenceResetSplineCalibration(LALInferenceModel *model);
+
 /** Get the intrinsic parameters from currentParams */
 LALInferenceVariables LALInferenceGetInstrinsicParams(LALInferenceVariables *currentParams);
 
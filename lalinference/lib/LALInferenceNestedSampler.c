@@ -6,6 +6,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <float.h>
 #include <signal.h>
 #include <time.h>
@@ -27,6 +28,10 @@
 
 #include "logaddexp.h"
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 #define PROGRAM_NAME "LALInferenceNestedSampler.c"
 #define CVS_ID_STRING "$Id$"
 #define CVS_REVISION "$Revision$"
@@ -95,13 +100,45 @@ static int _loadNSintegralStateH5(LALH5File *group, NSintegralState *s)
 static int ReadNSCheckPointH5(char *filename, LALInferenceRunState *runState, NSintegralState *s);
 static int WriteNSCheckPointH5(char *filename, LALInferenceRunState *runState, NSintegralState *s);
 
+/**
+ * Bookkeeping for incremental checkpoints.  With checkpoint_increments set,
+ * a full checkpoint in the output file is followed by up to that many
+ * increment files, each holding the live points and integral state but only
+ * the past iterations added since the previous checkpoint.
+ */
+typedef struct tagNSCheckpointState
+{
+  INT4 generation; /* Generation of the last full checkpoint, 0 before the first */
+  UINT4 increments; /* Increments written in this generation */
+  UINT4 sampleMark; /* Past iterations already checkpointed */
+} NSCheckpointState;
+
+static NSCheckpointState nsCheckpoint;
+
 static int WriteNSCheckPointH5(char *filename, LALInferenceRunState *runState, NSintegralState *s)
 {
-  LALH5File *h5file = XLALH5FileOpen(filename,"w");
+  INT4 N_output_array=0;
+  INT4 max_increments=0;
+  INT4 generation=nsCheckpoint.generation+1;
+  UINT4 offset=0;
+  char incrementname[FILENAME_MAX];
+  char *path=filename;
+  if(LALInferenceCheckVariable(runState->algorithmParams,"N_outputarray")) N_output_array=LALInferenceGetINT4Variable(runState->algorithmParams,"N_outputarray");
+  if(LALInferenceCheckVariable(runState->algorithmParams,"checkpoint_increments")) max_increments=LALInferenceGetINT4Variable(runState->algorithmParams,"checkpoint_increments");
+  /* Write only the new past iterations until max_increments increments exist */
+  if(max_increments>0 && nsCheckpoint.generation>0 && nsCheckpoint.increments<(UINT4)max_increments)
+  {
+    if(LALInferenceCheckpointIncrementName(incrementname,sizeof(incrementname),filename,nsCheckpoint.increments+1)!=XLAL_SUCCESS)
+      return(1);
+    path=incrementname;
+    generation=nsCheckpoint.generation;
+    offset=nsCheckpoint.sampleMark;
+  }
+  LALH5File *h5file = XLALH5FileOpen(path,"w");
   int retcode;
   if(!h5file)
   {
-    fprintf(stderr,"Unable to save resume file %s!\n",filename);
+    fprintf(stderr,"Unable to save resume file %s!\n",path);
     return(1);
   }
   UINT4 Nlive=*(UINT4 *)LALInferenceGetVariable(runState->algorithmParams,"Nlive");
@@ -110,17 +147,21 @@ static int WriteNSCheckPointH5(char *filename, LALInferenceRunState *runState, N
   if(retcode!=XLAL_SUCCESS) return(retcode);
   XLAL_TRY(group = XLALH5GroupOpen(group,"lalinferencenest_checkpoint"),retcode);
   if(retcode!=XLAL_SUCCESS) return(retcode);
+  XLALH5FileAddScalarAttribute(group, "checkpoint_generation", &generation, LAL_I4_TYPE_CODE);
   retcode = _saveNSintegralStateH5(group,s);
   if(retcode) XLAL_ERROR(XLAL_EFAILED,"Unable to save integral state\n");
   LALInferenceH5VariablesArrayToDataset(group, runState->livePoints, Nlive, "live_points");
-  INT4 N_output_array=0;
-  if(LALInferenceCheckVariable(runState->algorithmParams,"N_outputarray")) N_output_array=LALInferenceGetINT4Variable(runState->algorithmParams,"N_outputarray");
   if(N_output_array>0)
   {
     LALInferenceVariables **output_array=NULL;
     output_array=*(LALInferenceVariables ***)LALInferenceGetVariable(runState->algorithmParams,"outputarray");
-    LALInferenceH5VariablesArrayToDataset(group, output_array, N_output_array, "past_chain");
-    XLALH5FileAddScalarAttribute(group, "N_outputarray", &N_output_array, LAL_I4_TYPE_CODE);
+    if(path==filename)
+    {
+      LALInferenceH5VariablesArrayToDataset(group, output_array, N_output_array, "past_chain");
+      XLALH5FileAddScalarAttribute(group, "N_outputarray", &N_output_array, LAL_I4_TYPE_CODE);
+    }
+    else
+      LALInferenceH5CheckpointIncrementToDataset(group, output_array, offset, N_output_array, "past_chain");
   }
   struct tms tms_buffer;
   if(times(&tms_buffer))
@@ -132,7 +173,16 @@ static int WriteNSCheckPointH5(char *filename, LALInferenceRunState *runState, N
   }
   XLALH5FileClose(group);
   XLALH5FileClose(h5file);
-  LALInferencePrintCheckpointFileInfo(filename);
+  LALInferencePrintCheckpointFileInfo(path);
+  if(path==filename)
+  {
+    /* Increments of the previous generation are superseded */
+    LALInferenceRemoveCheckpointIncrements(filename,1);
+    nsCheckpoint.generation=generation;
+    nsCheckpoint.increments=0;
+  }
+  else nsCheckpoint.increments++;
+  nsCheckpoint.sampleMark=N_output_array;
   return(retcode);
 }
 
@@ -161,11 +211,96 @@ static int CheckOutputFileContents(char *filename)
   return(result);
 }
 
+/* Apply the increments written after the full checkpoint of the given
+ * generation in filename.  Increments that are stale or do not follow on
+ * from the restored state are removed. */
+static void ReadNSCheckPointIncrementsH5(char *filename, LALInferenceRunState *runState, NSintegralState *s, INT4 generation)
+{
+  int retcode,gap=0;
+  UINT4 n,i,Nlive,N_new;
+  char incrementname[FILENAME_MAX];
+  LALInferenceVariables **new_array=NULL;
+  for(n=1;;n++)
+  {
+    LALH5File *h5file=NULL;
+    INT4 file_generation=-1;
+    UINT4 N_outputarray=0;
+    if(LALInferenceCheckpointIncrementName(incrementname,sizeof(incrementname),filename,n)!=XLAL_SUCCESS) break;
+    if(access(incrementname,R_OK)!=0) break;
+    XLAL_TRY(h5file = XLALH5FileOpen(incrementname,"r"),retcode);
+    if(retcode!=XLAL_SUCCESS || !h5file) break;
+    LALH5File *li_group = XLALH5GroupOpen(h5file,"lalinference");
+    LALH5File *group = XLALH5GroupOpen(li_group,"lalinferencenest_checkpoint");
+    XLAL_TRY(XLALH5FileQueryScalarAttributeValue(&file_generation, group, "checkpoint_generation"),retcode);
+    if(LALInferenceCheckVariable(runState->algorithmParams,"N_outputarray"))
+      N_outputarray=LALInferenceGetINT4Variable(runState->algorithmParams,"N_outputarray");
+    if(file_generation==generation)
+      XLAL_TRY(gap=LALInferenceH5CheckpointIncrementToVariablesArray(group,"past_chain",N_outputarray,&new_array,&N_new),retcode);
+    if(file_generation!=generation || gap)
+    {
+      fprintf(stderr,"Checkpoint increment %s does not follow on from %s, ignoring it\n",incrementname,filename);
+      XLALH5FileClose(group);
+      XLALH5FileClose(li_group);
+      XLALH5FileClose(h5file);
+      break;
+    }
+    printf("restoring increment %s\n",incrementname);
+
+    /* The integral state and live points are stored in full */
+    XLALDestroyREAL8Vector(s->logZarray);
+    XLALDestroyREAL8Vector(s->oldZarray);
+    XLALDestroyREAL8Vector(s->Harray);
+    XLALDestroyREAL8Vector(s->logwarray);
+    XLALDestroyREAL8Vector(s->logtarray);
+    XLALDestroyREAL8Vector(s->logt2array);
+    _loadNSintegralStateH5(group,s);
+    Nlive=*(UINT4 *)LALInferenceGetVariable(runState->algorithmParams,"Nlive");
+    for(i=0;i<Nlive;i++)
+    {
+      LALInferenceClearVariables(runState->livePoints[i]);
+      XLALFree(runState->livePoints[i]);
+    }
+    XLALFree(runState->livePoints);
+    LALH5Dataset *liveGroup = XLALH5DatasetRead(group,"live_points");
+    LALInferenceH5DatasetToVariablesArray(liveGroup, &(runState->livePoints), &Nlive);
+    XLALH5DatasetFree(liveGroup);
+
+    /* Append the new past iterations */
+    if(N_new>0)
+    {
+      LALInferenceVariables **outputarray=NULL;
+      if(LALInferenceCheckVariable(runState->algorithmParams,"outputarray"))
+        outputarray=*(LALInferenceVariables ***)LALInferenceGetVariable(runState->algorithmParams,"outputarray");
+      outputarray=XLALRealloc(outputarray,(N_outputarray+N_new)*sizeof(LALInferenceVariables *));
+      memcpy(outputarray+N_outputarray,new_array,N_new*sizeof(LALInferenceVariables *));
+      N_outputarray+=N_new;
+      LALInferenceAddVariable(runState->algorithmParams,"N_outputarray",&N_outputarray,LALINFERENCE_INT4_t,LALINFERENCE_PARAM_OUTPUT);
+      LALInferenceAddVariable(runState->algorithmParams,"outputarray",&outputarray,LALINFERENCE_void_ptr_t,LALINFERENCE_PARAM_OUTPUT);
+    }
+    XLALFree(new_array);
+
+    double execution_time = 0.0;
+    XLAL_TRY(XLALH5FileQueryScalarAttributeValue(&execution_time, group, "cpu_time"),retcode);
+    if(retcode==XLAL_SUCCESS)
+      LALInferenceAddVariable(runState->algorithmParams, "cpu_time", &execution_time, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_OUTPUT);
+
+    XLALH5FileClose(group);
+    XLALH5FileClose(li_group);
+    XLALH5FileClose(h5file);
+  }
+  LALInferenceRemoveCheckpointIncrements(filename,n);
+  nsCheckpoint.generation=generation;
+  nsCheckpoint.increments=n-1;
+  if(LALInferenceCheckVariable(runState->algorithmParams,"N_outputarray"))
+    nsCheckpoint.sampleMark=LALInferenceGetINT4Variable(runState->algorithmParams,"N_outputarray");
+}
+
 static int ReadNSCheckPointH5(char *filename, LALInferenceRunState *runState, NSintegralState *s)
 {
   int retcode;
   LALH5File *h5file;
   UINT4 Nlive;
+  INT4 generation=0;
   if( access( filename, F_OK ) == -1 ) return(1);
   LALInferencePrintCheckpointFileInfo(filename);
   XLAL_TRY(h5file = XLALH5FileOpen(filename,"r"),retcode);
@@ -208,9 +343,14 @@ static int ReadNSCheckPointH5(char *filename, LALInferenceRunState *runState, NS
   {
       LALInferenceAddVariable(runState->algorithmParams, "cpu_time", &execution_time, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_OUTPUT);
   }
+  /* Checkpoints written before incremental checkpointing have no generation */
+  int genretcode;
+  XLAL_TRY(XLALH5FileQueryScalarAttributeValue(&generation, group, "checkpoint_generation"),genretcode);
+  if(genretcode!=XLAL_SUCCESS) generation=0;
   
   XLALH5FileClose(group);
   XLALH5FileClose(h5file);
+  if(retcode==0) ReadNSCheckPointIncrementsH5(filename,runState,s,generation);
   printf("done restoring\n");
   return(retcode);
   
@@ -296,6 +436,27 @@ static REAL8 mean(REAL8 *array,int N);
 /** Calculate covariance matrix from a collection of live points */
 static void LALInferenceNScalcCVM(gsl_matrix **cvm, LALInferenceVariables **Live, UINT4 Nlive);
 
+/* Handle to an output variable of a compiled structure, or an invalid handle */
+static LALInferenceVariableHandle lookupOutputHandle(LALInferenceVariables *vars, const char *name);
+static LALInferenceVariableHandle lookupOutputHandle(LALInferenceVariables *vars, const char *name)
+{
+  LALInferenceVariableHandle handle={NULL,0,0};
+  if(LALInferenceVariablesIsCompiled(vars) && LALInferenceCheckVariable(vars,name)
+     && LALInferenceGetVariableType(vars,name)==LALINFERENCE_REAL8_t)
+    handle=LALInferenceGetVariableHandle(vars,name);
+  return handle;
+}
+
+/* Set an output variable through its handle if still valid, by name otherwise */
+static void setOutputVariable(LALInferenceVariables *vars, LALInferenceVariableHandle handle, const char *name, REAL8 value);
+static void setOutputVariable(LALInferenceVariables *vars, LALInferenceVariableHandle handle, const char *name, REAL8 value)
+{
+  if(LALInferenceCheckVariableHandle(vars,handle))
+    LALInferenceSetREAL8VariableByHandle(vars,handle,value);
+  else
+    LALInferenceAddVariable(vars,name,&value,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+}
+
 /* log( exp(a) - exp(b) ) */
 static double logsubexp(double a, double b);
 static double logsubexp(double a, double b)
@@ -312,6 +473,8 @@ static double logsubexp(double a, double b)
 }
 
 static void SetupEigenProposals(LALInferenceRunState *runState);
+static INT4 NestedSamplingSloppySampleThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState,
+                                             LALInferenceVariables *algorithmParams, gsl_rng *GSLrandom);
 
 /**
  * Update the internal state of the integrator after receiving the lowest logL
@@ -435,9 +598,9 @@ static UINT4 UpdateNMCMC(LALInferenceRunState *runState){
         }
         LALInferenceSetVariable(runState->algorithmParams,"Nmcmc",&max);
     }
-    /* Single threaded here */
     if (LALInferenceGetProcParamVal(runState->commandLine,"--proposal-kde"))
-        LALInferenceSetupClusteredKDEProposalFromDEBuffer(&runState->threads[0]);
+        for(INT4 t=0;t<runState->nthreads;t++)
+            LALInferenceSetupClusteredKDEProposalFromDEBuffer(&runState->threads[t]);
     return(max);
 }
 
@@ -586,6 +749,8 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
     (--sloppyratio S)                Number of sub-samples of the prior for every sample from the\n\
                                      limited prior\n\
     (--Nruns R)                      Number of parallel samples from logt to use(1)\n\
+    (--Nparallel K)                  Replace the K lowest-likelihood live points at each iteration,\n\
+                                     evolving the replacements concurrently on K threads (1)\n\
     (--tolerance dZ)                 Tolerance of nested sampling algorithm (0.1)\n\
     (--randomseed seed)              Random seed of sampling distribution\n\
     (--prior )                       Set the prior to use (InspiralNormalised,SkyLoc,malmquist)\n\
@@ -598,6 +763,8 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
                                      or OUTFILE_resume and continue if possible\n\
     (--checkpoint-exit-code N)       Exit with code N when checkpoint is complete.\n\
                                      For use with condor's +SuccessCheckpointExitCode option\n\
+    (--checkpoint-increments N)      Between full checkpoints, write up to N smaller files holding\n\
+                                     only the iterations since the last checkpoint (0)\n\
     \n";
 
   ProcessParamsTable *ppt=NULL;
@@ -640,15 +807,13 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
   INT4 tmpi=0;
   REAL8 tmp=0;
 
-  /* Single thread only */
-  LALInferenceThreadState *threadState = &runState->threads[0];
-
   /* Set up the appropriate functions for the nested sampling algorithm */
   runState->algorithm=&LALInferenceNestedSamplingAlgorithm;
   runState->evolve=&LALInferenceNestedSamplingOneStep;
 
   /* use the ptmcmc proposal to sample prior */
-  threadState->proposal=&LALInferenceCyclicProposal;
+  for(INT4 t=0;t<runState->nthreads;t++)
+    runState->threads[t].proposal=&LALInferenceCyclicProposal;
   REAL8 temp=1.0;
   LALInferenceAddVariable(runState->proposalArgs,"temperature",&temp,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_FIXED);
 
@@ -665,6 +830,28 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
   }
   LALInferenceAddVariable(runState->algorithmParams,"Nlive",&tmpi, LALINFERENCE_INT4_t,LALINFERENCE_PARAM_FIXED);
 
+  /* Number of live points replaced concurrently, one per thread */
+  INT4 Nlive=tmpi;
+  tmpi=1;
+  ppt=LALInferenceGetProcParamVal(commandLine,"--Nparallel");
+  if(ppt) tmpi=atoi(ppt->value);
+  if(tmpi<1) tmpi=1;
+  if(tmpi>runState->nthreads){
+    fprintf(stderr,"Warning: only %i threads set up, replacing %i live points per iteration\n",runState->nthreads,runState->nthreads);
+    tmpi=runState->nthreads;
+  }
+  if(tmpi>1 && tmpi>Nlive/10){
+    tmpi=Nlive/10>1?Nlive/10:1;
+    fprintf(stderr,"Warning: --Nparallel must be small compared to --Nlive, replacing %i live points per iteration\n",tmpi);
+  }
+  LALInferenceAddVariable(runState->algorithmParams,"Nparallel",&tmpi, LALINFERENCE_INT4_t,LALINFERENCE_PARAM_FIXED);
+
+  /* Incremental checkpoints between full ones */
+  tmpi=0;
+  ppt=LALInferenceGetProcParamVal(commandLine,"--checkpoint-increments");
+  if(ppt) tmpi=atoi(ppt->value);
+  LALInferenceAddVariable(runState->algorithmParams,"checkpoint_increments",&tmpi, LALINFERENCE_INT4_t,LALINFERENCE_PARAM_FIXED);
+
   /* Number of points in MCMC chain */
   ppt=LALInferenceGetProcParamVal(commandLine,"--Nmcmc");
   if(!ppt) ppt=LALInferenceGetProcParamVal(commandLine,"--nmcmc");
@@ -713,6 +900,125 @@ void LALInferenceNestedSamplingAlgorithmInit(LALInferenceRunState *runState)
 }
 
 
+/* Compile the live points that are not compiled, with the layout of a
+   compiled one if they have the same variables */
+static void compileLivePoints(LALInferenceVariables **livePoints, UINT4 Nlive);
+static void compileLivePoints(LALInferenceVariables **livePoints, UINT4 Nlive)
+{
+  LALInferenceVariables *reference=NULL;
+  UINT4 i;
+  for(i=0;i<Nlive && !reference;i++)
+    if(LALInferenceVariablesIsCompiled(livePoints[i])) reference=livePoints[i];
+  if(!reference){
+    LALInferenceCompileVariables(livePoints[0]);
+    reference=livePoints[0];
+  }
+  for(i=0;i<Nlive;i++)
+    if(!LALInferenceVariablesIsCompiled(livePoints[i])
+       && LALInferenceCompileVariablesLike(livePoints[i],reference)!=XLAL_SUCCESS)
+    {
+      XLALClearErrno();
+      LALInferenceCompileVariables(livePoints[i]);
+    }
+}
+
+/**
+ * Remove the Nparallel lowest-likelihood live points in one go and replace
+ * them with points evolved concurrently, one on each of runState->threads.
+ *
+ * The removed points are passed to the integrator in increasing order of
+ * likelihood. Taking them out one after the other without replacement leaves
+ * Nlive-1, ..., Nlive-Nparallel+1 live points, so the shrinkage of the prior
+ * volume at each of those removals is drawn with the reduced number of points,
+ * as in the final corrections of the run. Once the batch is refilled the next
+ * shrinkage is drawn with Nlive points again. All replacements are drawn from
+ * the prior above the highest removed likelihood, which is returned in logLmin.
+ * Returns the new evidence.
+ */
+static REAL8 replaceLivePointsConcurrently(LALInferenceRunState *runState, NSintegralState *s, UINT4 Nparallel,
+                                           REAL8 *logLikelihoods, REAL8 *logLmin);
+static REAL8 replaceLivePointsConcurrently(LALInferenceRunState *runState, NSintegralState *s, UINT4 Nparallel,
+                                           REAL8 *logLikelihoods, REAL8 *logLmin)
+{
+  UINT4 Nlive=*(UINT4 *)LALInferenceGetVariable(runState->algorithmParams,"Nlive");
+  UINT4 minpos[Nparallel],start[Nparallel];
+  UCHAR *removed=XLALCalloc(Nlive,sizeof(UCHAR));
+  REAL8 logZ=-INFINITY,logw;
+  UINT4 i,k;
+
+  /* Find the points to replace, lowest first */
+  for(k=0;k<Nparallel;k++){
+    UINT4 m=0;
+    while(removed[m]) m++;
+    for(i=m+1;i<Nlive;i++)
+      if(!removed[i] && logLikelihoods[i]<logLikelihoods[m]) m=i;
+    removed[m]=1;
+    minpos[k]=m;
+  }
+  *logLmin=logLikelihoods[minpos[Nparallel-1]];
+
+  for(k=0;k<Nparallel;k++){
+    logZ=incrementEvidenceSamples(runState->GSLrandom, k+1<Nparallel ? Nlive-k-1 : Nlive, logLikelihoods[minpos[k]], s);
+    if(runState->logsample) runState->logsample(runState->algorithmParams,runState->livePoints[minpos[k]]);
+  }
+
+  /* Choose the starting points here so that they do not depend on the thread schedule */
+  for(k=0;k<Nparallel;k++)
+    while(removed[start[k]=gsl_rng_uniform_int(runState->GSLrandom,Nlive)]){};
+
+  /* Each chain keeps its own sloppy fraction and acceptance rates */
+  for(k=0;k<Nparallel;k++){
+    LALInferenceVariables *threadParams=runState->threads[k].algorithmParams;
+    LALInferenceAddVariable(threadParams,"logLmin",logLmin,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+    LALInferenceAddVariable(threadParams,"Nmcmc",LALInferenceGetVariable(runState->algorithmParams,"Nmcmc"),LALINFERENCE_INT4_t,LALINFERENCE_PARAM_OUTPUT);
+    if(LALInferenceCheckVariable(runState->algorithmParams,"logZnoise"))
+      LALInferenceAddVariable(threadParams,"logZnoise",LALInferenceGetVariable(runState->algorithmParams,"logZnoise"),LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_FIXED);
+    if(!LALInferenceCheckVariable(threadParams,"sloppyfraction")){
+      LALInferenceAddVariable(threadParams,"sloppyfraction",LALInferenceGetVariable(runState->algorithmParams,"sloppyfraction"),LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+      LALInferenceAddVariable(threadParams,"accept_rate",LALInferenceGetVariable(runState->algorithmParams,"accept_rate"),LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+      LALInferenceAddVariable(threadParams,"sub_accept_rate",LALInferenceGetVariable(runState->algorithmParams,"sub_accept_rate"),LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+    }
+  }
+
+  /* The chains read the live points concurrently: a point that lost its
+     layout since the last batch is compiled again here, so that no copy
+     out of it has to compile its target inside the parallel region */
+  compileLivePoints(runState->livePoints,Nlive);
+
+  /* Clone a surviving live point and evolve it, on every thread at once */
+  #pragma omp parallel for schedule(dynamic,1)
+  for(k=0;k<Nparallel;k++){
+    LALInferenceThreadState *thread=&runState->threads[k];
+    UINT4 j=start[k];
+    do{ /* This loop is here in case it is necessary to find a different sample */
+      LALInferenceCopyVariables(runState->livePoints[j],thread->currentParams);
+      thread->currentLikelihood=logLikelihoods[j];
+      NestedSamplingSloppySampleThread(runState,thread,thread->algorithmParams,thread->GSLrandom);
+      while(removed[j=gsl_rng_uniform_int(thread->GSLrandom,Nlive)]){};
+    }while(thread->currentLikelihood<=*logLmin || *(REAL8 *)LALInferenceGetVariable(thread->algorithmParams,"accept_rate")==0.0);
+  }
+
+  /* Put the new points in place and report the mean rates of the chains */
+  REAL8 accept_rate=0,sub_accept_rate=0,sloppyfraction=0;
+  logw=mean(s->logwarray->data,s->size);
+  for(k=0;k<Nparallel;k++){
+    LALInferenceThreadState *thread=&runState->threads[k];
+    LALInferenceCopyVariables(thread->currentParams,runState->livePoints[minpos[k]]);
+    logLikelihoods[minpos[k]]=thread->currentLikelihood;
+    LALInferenceAddVariable(runState->livePoints[minpos[k]],"logw",&logw,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+    accept_rate+=LALInferenceGetREAL8Variable(thread->algorithmParams,"accept_rate")/Nparallel;
+    sub_accept_rate+=LALInferenceGetREAL8Variable(thread->algorithmParams,"sub_accept_rate")/Nparallel;
+    sloppyfraction+=LALInferenceGetREAL8Variable(thread->algorithmParams,"sloppyfraction")/Nparallel;
+  }
+  LALInferenceSetVariable(runState->algorithmParams,"logLmin",logLmin);
+  LALInferenceSetVariable(runState->algorithmParams,"accept_rate",&accept_rate);
+  LALInferenceSetVariable(runState->algorithmParams,"sub_accept_rate",&sub_accept_rate);
+  LALInferenceSetVariable(runState->algorithmParams,"sloppyfraction",&sloppyfraction);
+
+  XLALFree(removed);
+  return(logZ);
+}
+
 /* NestedSamplingAlgorithm implements the nested sampling algorithm,
  see e.g. Sivia & Skilling "Data Analysis: A Bayesian Tutorial, 2nd edition.
  REQUIREMENTS:
@@ -744,6 +1050,7 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   UINT4 displayprogress=0;
   LALInferenceVariables *currentVars=XLALCalloc(1,sizeof(LALInferenceVariables));
   UINT4 samplePrior=0; //If this flag is set to a positive integer, code will just draw this many samples from the prior
+  UINT4 Nparallel=1;
   ProcessParamsTable *ppt=NULL;
   int CondorExitCode=0;
 
@@ -773,6 +1080,10 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   verbose=LALInferenceCheckVariable(runState->algorithmParams,"verbose");
   displayprogress=verbose;
 
+  /* Replace several live points per iteration if requested */
+  if(LALInferenceCheckVariable(runState->algorithmParams,"Nparallel") && !samplePrior)
+    Nparallel = *(UINT4 *) LALInferenceGetVariable(runState->algorithmParams,"Nparallel");
+
   /* Operate on parallel runs if requested */
   if(LALInferenceCheckVariable(runState->algorithmParams,"Nruns"))
     Nruns = *(UINT4 *) LALInferenceGetVariable(runState->algorithmParams,"Nruns");
@@ -834,9 +1145,10 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   SetupEigenProposals(runState);
 
   /* Use the live points as differential evolution points */
-  /* Single thread here */
-  syncLivePointsDifferentialPoints(runState,threadState);
-  threadState->differentialPointsSkip=1;
+  for(INT4 t=0;t<runState->nthreads;t++){
+    syncLivePointsDifferentialPoints(runState,&runState->threads[t]);
+    runState->threads[t].differentialPointsSkip=1;
+  }
 
   if(!LALInferenceCheckVariable(runState->algorithmParams,"Nmcmc")){
     INT4 tmp=MAX_MCMC;
@@ -910,6 +1222,10 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   for(i=0;i<Nlive;i++)
     LALInferenceSortVariablesByName(runState->livePoints[i]);
 
+  /* The parameter set is fixed from here on; give all live points one
+   * compiled layout so that cloning and replacing them are flat memcpys */
+  compileLivePoints(runState->livePoints,Nlive);
+
   /* Update the covariance matrix for proposal distribution */
   SetupEigenProposals(runState);
 
@@ -945,6 +1261,61 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
   }
   /* Iterate until termination condition is met */
   do {
+    if(Nparallel>1){
+      /* Replace a batch of points, then do the same bookkeeping as below */
+      logZ=replaceLivePointsConcurrently(runState, s, Nparallel, logLikelihoods, &logLmin);
+      H=mean(Harray,Nruns);
+      REAL8 logLnew=-INFINITY;
+      for(i=0;i<Nparallel;i++)
+        if(runState->threads[i].currentLikelihood>logLnew) logLnew=runState->threads[i].currentLikelihood;
+      if(logLnew>logLmax) logLmax=logLnew;
+      dZ=logaddexp(logZ,logLmax-((double) iter)/((double)Nlive))-logZ;
+      if(displayprogress) fprintf(stderr,"%i: accpt: %1.3f Nmcmc: %i sub_accpt: %1.3f slpy: %2.1f%% H: %3.2lf nats logL:%.3lf ->%.3lf logZ: %.3lf deltalogLmax: %.2lf dZ: %.3lf Zratio: %.3lf \n",\
+        iter,\
+        *(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"accept_rate"),\
+        *(INT4 *)LALInferenceGetVariable(runState->algorithmParams,"Nmcmc"),\
+        *(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"sub_accept_rate"),\
+        100.0*(*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"sloppyfraction")),\
+        H,\
+        logLmin,\
+        logLnew,\
+        logZ,\
+        (logLmax - LALInferenceGetREAL8Variable(runState->algorithmParams,"logZnoise")), \
+        dZ,\
+        ( logZ - LALInferenceGetREAL8Variable(runState->algorithmParams,"logZnoise"))\
+      );
+      iter+=Nparallel;
+
+      /* Save progress */
+      if(__ns_saveStateFlag!=0)
+      {
+        if(__ns_exitFlag) fprintf(stdout,"Saving state to %s.\n",outfile);
+        WriteNSCheckPointH5(outfile,runState,s);
+        __ns_saveStateFlag=0;
+      }
+      /* Have we been told to quit? */
+      if(__ns_exitFlag) {
+        exit(CondorExitCode);
+      }
+
+      /* Update the proposals each time another Nlive/10 points have been replaced */
+      if(iter/(Nlive/10)!=(iter-Nparallel)/(Nlive/10)) {
+        if ( LALInferenceCheckVariable( threadState->proposalArgs,"covarianceMatrix" ) ){
+          SetupEigenProposals(runState);
+        }
+        UpdateNMCMC(runState);
+        for(INT4 t=0;t<runState->nthreads;t++)
+          syncLivePointsDifferentialPoints(runState,&runState->threads[t]);
+        if(verbose){
+          LALInferencePrintProposalStatsHeader(stdout,threadState->cycle);
+          LALInferencePrintProposalStats(stdout,threadState->cycle);
+          LALInferenceZeroProposalStats(threadState->cycle);
+          printAdaptiveJumpSizes(stdout, threadState);
+        }
+      }
+      continue;
+    }
+
     /* Find minimum likelihood sample to replace */
     minpos=0;
     for(i=1;i<Nlive;i++){
@@ -1022,7 +1393,8 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
     UpdateNMCMC(runState);
 
     /* Sync the live points to differential points */
-    syncLivePointsDifferentialPoints(runState,threadState);
+    for(INT4 t=0;t<runState->nthreads;t++)
+      syncLivePointsDifferentialPoints(runState,&runState->threads[t]);
 
     /* Output some information */
     if(verbose){
@@ -1053,6 +1425,9 @@ void LALInferenceNestedSamplingAlgorithm(LALInferenceRunState *runState)
     logLikelihoods[minpos]=logLikelihoods[i];
     logLikelihoods[i]=logLmin;
   }
+  /* The output file replaces the checkpoint once the run is complete */
+  LALInferenceRemoveCheckpointIncrements(outfile,1);
+
   /* final corrections */
   for(i=0;i<Nlive;i++){
     logZ=incrementEvidenceSamples(runState->GSLrandom, Nlive-i, logLikelihoods[i], s);
@@ -1334,19 +1709,21 @@ LALInferenceVariables *LALInferenceComputeAutoCorrelation(LALInferenceRunState *
   return(acls);
 }
 
-/* Perform one MCMC iteration on runState->currentParams. Return 1 if accepted or 0 if not */
-UINT4 LALInferenceMCMCSamplePrior(LALInferenceRunState *runState)
+/* Perform one MCMC iteration on threadState->currentParams, reading the
+   likelihood bound from algorithmParams. Return 1 if accepted or 0 if not */
+static UINT4 MCMCSamplePriorThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState,
+                                   LALInferenceVariables *algorithmParams, gsl_rng *GSLrandom);
+static UINT4 MCMCSamplePriorThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState,
+                                   LALInferenceVariables *algorithmParams, gsl_rng *GSLrandom)
 {
-    /* Single threaded here */
-    LALInferenceThreadState * threadState=&runState->threads[0];
     UINT4 outOfBounds=0;
     UINT4 adaptProp=0;
     //LALInferenceVariables tempParams;
     REAL8 logProposalRatio=0.0;
     //LALInferenceVariables *oldParams=&tempParams;
-    LALInferenceVariables proposedParams;
-    memset(&proposedParams,0,sizeof(proposedParams));
-    REAL8 logLmin=*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"logLmin");
+    /* Kept between calls, so that it shares the compiled layout of currentParams */
+    LALInferenceVariables *proposedParams=threadState->proposedParams;
+    REAL8 logLmin=*(REAL8 *)LALInferenceGetVariable(algorithmParams,"logLmin");
     REAL8 thislogL=-INFINITY;
     UINT4 accepted=0;
 
@@ -1356,11 +1733,11 @@ UINT4 LALInferenceMCMCSamplePrior(LALInferenceRunState *runState)
           thislogL=runState->likelihood(threadState->currentParams,runState->data,threadState->model);
           if (logLmin<thislogL) outOfBounds=0;
     }
-    LALInferenceCopyVariables(threadState->currentParams,&proposedParams);
+    LALInferenceCopyVariables(threadState->currentParams,proposedParams);
 
-    logProposalRatio = threadState->proposal(threadState,threadState->currentParams,&proposedParams);
-    REAL8 logPriorNew=runState->prior(runState, &proposedParams, threadState->model);
-    if(isinf(logPriorNew) || isnan(logPriorNew) || log(gsl_rng_uniform(runState->GSLrandom)) > (logPriorNew-logPriorOld) + logProposalRatio)
+    logProposalRatio = threadState->proposal(threadState,threadState->currentParams,proposedParams);
+    REAL8 logPriorNew=runState->prior(runState, proposedParams, threadState->model);
+    if(isinf(logPriorNew) || isnan(logPriorNew) || log(gsl_rng_uniform(GSLrandom)) > (logPriorNew-logPriorOld) + logProposalRatio)
     {
 	/* Reject - don't need to copy new params back to currentParams */
         /*LALInferenceCopyVariables(oldParams,runState->currentParams); */
@@ -1368,10 +1745,9 @@ UINT4 LALInferenceMCMCSamplePrior(LALInferenceRunState *runState)
     else {
         accepted=1;
         //printf("Accepted line %i\n",__LINE__);
-        LALInferenceCopyVariables(&proposedParams,threadState->currentParams);
+        LALInferenceCopyVariables(proposedParams,threadState->currentParams);
         LALInferenceSetVariable(threadState->currentParams,"logPrior",&logPriorNew);
     }
-    LALInferenceClearVariables(&proposedParams);
 
     if((!outOfBounds) && adaptProp)
     {
@@ -1387,6 +1763,13 @@ UINT4 LALInferenceMCMCSamplePrior(LALInferenceRunState *runState)
     return(accepted);
 }
 
+/* Perform one MCMC iteration on runState->currentParams. Return 1 if accepted or 0 if not */
+UINT4 LALInferenceMCMCSamplePrior(LALInferenceRunState *runState)
+{
+    /* Single threaded here */
+    return MCMCSamplePriorThread(runState,&runState->threads[0],runState->algorithmParams,runState->GSLrandom);
+}
+
 /* Sample the prior N times, returns number of acceptances */
 UINT4 LALInferenceMCMCSamplePriorNTimes(LALInferenceRunState *runState, UINT4 N)
 {
@@ -1482,26 +1865,27 @@ INT4 LALInferenceNestedSamplingCachedSampler(LALInferenceRunState *runState)
    x=LALInferenceGetVariable(runState->algorithmParams,"sloppyfraction")
    */
 
-INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
+static INT4 NestedSamplingSloppySampleThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState,
+                                             LALInferenceVariables *algorithmParams, gsl_rng *GSLrandom);
+static INT4 NestedSamplingSloppySampleThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState,
+                                             LALInferenceVariables *algorithmParams, gsl_rng *GSLrandom)
 {
-    LALInferenceVariables oldParams;
-    /* Single thread here */
-    LALInferenceThreadState *threadState = &runState->threads[0];
+    /* Kept between calls, so that it shares the compiled layout of currentParams */
+    LALInferenceVariables *oldParams = threadState->preProposalParams;
     LALInferenceIFOData *data=runState->data;
     REAL8 tmp;
     REAL8 Target=0.3;
     char tmpName[320];
     REAL8 logLold=*(REAL8 *)LALInferenceGetVariable(threadState->currentParams,"logL");
-    memset(&oldParams,0,sizeof(oldParams));
-    LALInferenceCopyVariables(threadState->currentParams,&oldParams);
-    REAL8 logLmin=*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"logLmin");
-    UINT4 Nmcmc=*(UINT4 *)LALInferenceGetVariable(runState->algorithmParams,"Nmcmc");
+    LALInferenceCopyVariables(threadState->currentParams,oldParams);
+    REAL8 logLmin=*(REAL8 *)LALInferenceGetVariable(algorithmParams,"logLmin");
+    UINT4 Nmcmc=*(UINT4 *)LALInferenceGetVariable(algorithmParams,"Nmcmc");
     REAL8 maxsloppyfraction=((REAL8)Nmcmc-1)/(REAL8)Nmcmc ;
     REAL8 sloppyfraction=maxsloppyfraction/2.0;
     REAL8 minsloppyfraction=0.;
     if(Nmcmc==1) maxsloppyfraction=minsloppyfraction=0.0;
-    if (LALInferenceCheckVariable(runState->algorithmParams,"sloppyfraction"))
-      sloppyfraction=*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"sloppyfraction");
+    if (LALInferenceCheckVariable(algorithmParams,"sloppyfraction"))
+      sloppyfraction=*(REAL8 *)LALInferenceGetVariable(algorithmParams,"sloppyfraction");
     UINT4 mcmc_iter=0,Naccepted=0,sub_accepted=0;
     UINT4 sloppynumber=(UINT4) (sloppyfraction*(REAL8)Nmcmc);
     UINT4 testnumber=Nmcmc-sloppynumber;
@@ -1512,21 +1896,26 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
     UINT4 ifo=0;
     REAL8 counter=1.;
     UINT4 BAILOUT=100*testnumber; /* If no acceptance after 100 tries, will exit and the sampler will try a different starting point */
-    const char *extra_names[]={"logL","optimal_snr","matched_filter_snr","deltalogL"}; /* Names for parameters to be stripped when sampling prior */
+    const char *extra_names[]={"logL","optimal_snr","matched_filter_snr","deltalogL"}; /* Names for parameters invalidated when sampling prior */
     UINT4 Nnames = 4;
+    LALInferenceVariableHandle extra_handles[4];
+    for(UINT4 i=0;i<Nnames;i++) extra_handles[i]=lookupOutputHandle(threadState->currentParams,extra_names[i]);
     if ( Nmcmc ){
       do{
         counter=counter-1.;
         subchain_length=0;
+        /* Mark as unknown rather than remove, which would change the layout of currentParams */
         for(UINT4 i=0;i<Nnames;i++)
         {
-          if(LALInferenceCheckVariable(threadState->currentParams,extra_names[i]))
+          if(LALInferenceCheckVariableHandle(threadState->currentParams,extra_handles[i]))
+            LALInferenceSetREAL8VariableByHandle(threadState->currentParams,extra_handles[i],NAN);
+          else if(LALInferenceCheckVariable(threadState->currentParams,extra_names[i]))
             LALInferenceRemoveVariable(threadState->currentParams,extra_names[i]);
         }
         /* Draw an independent sample from the prior */
         do{
 
-            sub_accepted+=LALInferenceMCMCSamplePrior(runState);
+            sub_accepted+=MCMCSamplePriorThread(runState,threadState,algorithmParams,GSLrandom);
             subchain_length++;
             counter+=(1.-sloppyfraction);
         }while(counter<1);
@@ -1534,7 +1923,7 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
         if(sub_accepted==0) {
           sub_iter+=subchain_length;
           mcmc_iter++;
-          LALInferenceCopyVariables(&oldParams,threadState->currentParams);
+          LALInferenceCopyVariables(oldParams,threadState->currentParams);
           threadState->currentLikelihood=logLold;
           continue;
         }
@@ -1545,10 +1934,10 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
         {
             Naccepted++;
             /* Update information to pass back out */
-            LALInferenceAddVariable(threadState->currentParams,"logL",(void *)&logLnew,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
-            if(LALInferenceCheckVariable(runState->algorithmParams,"logZnoise")){
-               tmp=logLnew-*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"logZnoise");
-               LALInferenceAddVariable(threadState->currentParams,"deltalogL",(void *)&tmp,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
+            setOutputVariable(threadState->currentParams,extra_handles[0],"logL",logLnew);
+            if(LALInferenceCheckVariable(algorithmParams,"logZnoise")){
+               tmp=logLnew-*(REAL8 *)LALInferenceGetVariable(algorithmParams,"logZnoise");
+               setOutputVariable(threadState->currentParams,extra_handles[3],"deltalogL",tmp);
             }
             ifo=0;
             data=runState->data;
@@ -1561,13 +1950,13 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
                ifo++;
                data=data->next;
             }
-            LALInferenceCopyVariables(threadState->currentParams,&oldParams);
+            LALInferenceCopyVariables(threadState->currentParams,oldParams);
             logLold=logLnew;
             threadState->currentLikelihood=logLnew;
         }
         else /* reject */
         {
-            LALInferenceCopyVariables(&oldParams,threadState->currentParams);
+            LALInferenceCopyVariables(oldParams,threadState->currentParams);
             threadState->currentLikelihood=logLold;
         }
       }while((mcmc_iter<testnumber||threadState->currentLikelihood<=logLmin||Naccepted==0)&&(mcmc_iter<BAILOUT));
@@ -1577,8 +1966,8 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
             logLnew=runState->likelihood(threadState->currentParams,runState->data,threadState->model);
             threadState->currentLikelihood=logLnew;
             LALInferenceAddVariable(threadState->currentParams,"logL",(void *)&logLnew,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
-            if(LALInferenceCheckVariable(runState->algorithmParams,"logZnoise")){
-               tmp=logLnew-*(REAL8 *)LALInferenceGetVariable(runState->algorithmParams,"logZnoise");
+            if(LALInferenceCheckVariable(algorithmParams,"logZnoise")){
+               tmp=logLnew-*(REAL8 *)LALInferenceGetVariable(algorithmParams,"logZnoise");
                LALInferenceAddVariable(threadState->currentParams,"deltalogL",(void *)&tmp,LALINFERENCE_REAL8_t,LALINFERENCE_PARAM_OUTPUT);
             }
             ifo=0;
@@ -1596,8 +1985,8 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
     /* Compute some statistics for information */
     REAL8 sub_accept_rate=(REAL8)sub_accepted/(REAL8)sub_iter;
     REAL8 accept_rate=(REAL8)Naccepted/(REAL8)testnumber;
-    LALInferenceSetVariable(runState->algorithmParams,"accept_rate",&accept_rate);
-    LALInferenceSetVariable(runState->algorithmParams,"sub_accept_rate",&sub_accept_rate);
+    LALInferenceSetVariable(algorithmParams,"accept_rate",&accept_rate);
+    LALInferenceSetVariable(algorithmParams,"sub_accept_rate",&sub_accept_rate);
     /* Adapt the sloppy fraction toward target acceptance of outer chain */
     if(isfinite(logLmin)){
         if((REAL8)accept_rate>Target) { sloppyfraction+=5.0/(REAL8)Nmcmc;}
@@ -1605,15 +1994,18 @@ INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
         if(sloppyfraction>maxsloppyfraction) sloppyfraction=maxsloppyfraction;
 	if(sloppyfraction<minsloppyfraction) sloppyfraction=minsloppyfraction;
 
-	LALInferenceSetVariable(runState->algorithmParams,"sloppyfraction",&sloppyfraction);
+	LALInferenceSetVariable(algorithmParams,"sloppyfraction",&sloppyfraction);
     }
-    /* Cleanup */
-    LALInferenceClearVariables(&oldParams);
-
     return Naccepted;
 }
 
 
+INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState)
+{
+    /* Single thread here */
+    return NestedSamplingSloppySampleThread(runState,&runState->threads[0],runState->algorithmParams,runState->GSLrandom);
+}
+
 /* Evolve nested sampling algorithm by one step, i.e.
  evolve runState->currentParams to a new point with higher
  likelihood than currentLikelihood. Uses the MCMC method with sloppy sampling.
@@ -1673,10 +2065,15 @@ void LALInferenceSetupLivePointsArray(LALInferenceRunState *runState){
 }
 
 
+static void SetupEigenProposalsThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState);
 static void SetupEigenProposals(LALInferenceRunState *runState)
 {
-  /* Single thread here */
-  LALInferenceThreadState *threadState = &runState->threads[0];
+  for(INT4 t=0;t<runState->nthreads;t++)
+    SetupEigenProposalsThread(runState,&runState->threads[t]);
+}
+
+static void SetupEigenProposalsThread(LALInferenceRunState *runState, LALInferenceThreadState *threadState)
+{
   gsl_matrix *eVectors=NULL;
   gsl_vector *eValues =NULL;
   REAL8Vector *eigenValues=NULL;
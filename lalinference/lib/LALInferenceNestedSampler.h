@@ -81,6 +81,12 @@ UINT4 LALInferenceMCMCSamplePriorNTimes(LALInferenceRunState *runState, UINT4 N)
  * Sample the limited prior distribution using the MCMC method as usual, but
  * run a sub-chain of x iterations which doesn't check the likelihood bound.
  * x=LALInferenceGetVariable(runState->algorithmParams,"sloppyratio")
+ *
+ * While the sub-chain moves the point without computing the likelihood, the
+ * outputs logL, deltalogL, optimal_snr and matched_filter_snr of a compiled
+ * runState->threads[0].currentParams are set to NaN rather than removed, so
+ * that its layout is kept; they are removed from an uncompiled one.  They
+ * are set again when a point is accepted.
  */
 INT4 LALInferenceNestedSamplingSloppySample(LALInferenceRunState *runState);
 
@@ -468,7 +468,7 @@ LALInferenceVariables *LALInferenceParseProposalArgs(LALInferenceRunState *runSt
     if (singleadapt){
       LALInferenceModel *model = LALInferenceInitCBCModel(runState);
       LALInferenceSetupAdaptiveProposals(propArgs, model->params);
-      XLALFree(model);
+      LALInferenceDestroyModel(model);
     }
 
     /* Setup now since we need access to the data */
@@ -783,15 +783,17 @@ REAL8 LALInferenceCovarianceEigenvectorJump(LALInferenceThreadState *thread,
         exit(1);
     }
 
+    /* Update the values through the list items rather than by name */
     do {
-        if (LALInferenceCheckVariableNonFixed(proposedParams, proposeIterator->name) &&
+        if ((proposeIterator->vary == LALINFERENCE_PARAM_LINEAR ||
+             proposeIterator->vary == LALINFERENCE_PARAM_CIRCULAR) &&
             proposeIterator->type==LALINFERENCE_REAL8_t) {
-            tmp = LALInferenceGetREAL8Variable(proposedParams, proposeIterator->name);
+            tmp = *(REAL8 *)proposeIterator->value;
             inc = jumpSize * gsl_matrix_get(eigenvectors, j, i);
 
             tmp += inc;
 
-            LALInferenceSetVariable(proposedParams, proposeIterator->name, &tmp);
+            *(REAL8 *)proposeIterator->value = tmp;
 
             j++;
         }
@@ -1125,7 +1127,25 @@ REAL8 LALInferenceDifferentialEvolutionNames(LALInferenceThreadState *thread,
         scale = 2.38/sqrt(Ndim) * exp(log(0.1) + log(100.0) * gsl_rng_uniform(rng));
     }
 
+    /* Points of the buffer copied from the chain share its compiled layout,
+     * so that one lookup by name gives the variable in all four */
+    const int compiled = LALInferenceVariablesIsCompiled(currentParams)
+        && LALInferenceVariablesIsCompiled(proposedParams);
+
     for (i = 0; names[i] != NULL; i++) {
+        if (compiled && LALInferenceCheckVariableNonFixed(currentParams, names[i])) {
+            LALInferenceVariableHandle h = LALInferenceGetVariableHandle(currentParams, names[i]);
+            if (LALInferenceCheckVariableHandle(proposedParams, h) &&
+                LALInferenceCheckVariableHandle(ptJ, h) &&
+                LALInferenceCheckVariableHandle(ptI, h)) {
+                x = LALInferenceGetREAL8VariableByHandle(currentParams, h);
+                x += scale * LALInferenceGetREAL8VariableByHandle(ptJ, h);
+                x -= scale * LALInferenceGetREAL8VariableByHandle(ptI, h);
+                LALInferenceSetREAL8VariableByHandle(proposedParams, h, x);
+                continue;
+            }
+        }
+
         if (!LALInferenceCheckVariableNonFixed(currentParams, names[i]) ||
             !LALInferenceCheckVariable(ptJ, names[i]) ||
             !LALInferenceCheckVariable(ptI, names[i])) {
@@ -2554,10 +2574,13 @@ REAL8 LALInferenceDistanceLikelihoodProposal(LALInferenceThreadState *thread,
   } else {
     XLAL_ERROR_REAL8(XLAL_FAILURE, "could not find 'distance' or 'logdistance' in current params");
   }
-  if(!LALInferenceCheckVariable(currentParams,"optimal_snr") || !LALInferenceCheckVariable(currentParams,"matched_filter_snr"))
+  /* The SNRs may be missing, or set to NaN by a sampler that moved the point without computing the likelihood */
+  if(!LALInferenceCheckVariable(currentParams,"optimal_snr") || !LALInferenceCheckVariable(currentParams,"matched_filter_snr")
+     || isnan(LALInferenceGetREAL8Variable(currentParams,"optimal_snr")) || isnan(LALInferenceGetREAL8Variable(currentParams,"matched_filter_snr")))
     /* Force a likelihood calculation to generate the parameters */
     thread->parent->likelihood(currentParams,thread->parent->data,thread->model);
-  if(!LALInferenceCheckVariable(currentParams,"optimal_snr") || !LALInferenceCheckVariable(currentParams,"matched_filter_snr"))
+  if(!LALInferenceCheckVariable(currentParams,"optimal_snr") || !LALInferenceCheckVariable(currentParams,"matched_filter_snr")
+     || isnan(LALInferenceGetREAL8Variable(currentParams,"optimal_snr")) || isnan(LALInferenceGetREAL8Variable(currentParams,"matched_filter_snr")))
   {
 		  /* If still can't find the required parameters, reject this jump */
 		  LALInferenceCopyVariables(currentParams,proposedParams);
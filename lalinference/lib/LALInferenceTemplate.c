@@ -231,15 +231,18 @@ static void q2masses(double mc, double q, double *m1, double *m2)
   return;
 }
 
-void LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model){
-/*************************************************************************************************************************/
+/* Evaluate the waveform at model->params on one or two arbitrary frequency
+   sequences with XLALSimInspiralChooseFDWaveformSequence().  The second
+   sequence is skipped when frequencies2 is NULL. */
+static void LALInferenceFDWaveformSequence(LALInferenceModel *model,
+                                           COMPLEX16FrequencySeries **hptilde1, COMPLEX16FrequencySeries **hctilde1, REAL8Sequence *frequencies1,
+                                           COMPLEX16FrequencySeries **hptilde2, COMPLEX16FrequencySeries **hctilde2, REAL8Sequence *frequencies2)
+{
   Approximant approximant = (Approximant) 0;
 
   int ret=0;
   INT4 errnum=0;
 
-  model->roq->hptildeLinear=NULL, model->roq->hctildeLinear=NULL;
-  model->roq->hptildeQuadratic=NULL, model->roq->hctildeQuadratic=NULL;
   REAL8 mc;
   REAL8 phi0, m1, m2, distance, inclination;
 
@@ -476,11 +479,12 @@ void LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferen
   /* ==== Call the waveform generator ==== */
     /* Correct distance to account for renormalisation of data due to window RMS */
     double corrected_distance = distance * sqrt(model->window->sumofsquares/model->window->data->length);
-    XLAL_TRY(ret=XLALSimInspiralChooseFDWaveformSequence (&(model->roq->hptildeLinear), &(model->roq->hctildeLinear), phi0, m1*LAL_MSUN_SI, m2*LAL_MSUN_SI,
-                spin1x, spin1y, spin1z, spin2x, spin2y, spin2z, f_ref, corrected_distance, inclination, model->LALpars, approximant, (model->roq->frequencyNodesLinear)), errnum);
+    XLAL_TRY(ret=XLALSimInspiralChooseFDWaveformSequence (hptilde1, hctilde1, phi0, m1*LAL_MSUN_SI, m2*LAL_MSUN_SI,
+                spin1x, spin1y, spin1z, spin2x, spin2y, spin2z, f_ref, corrected_distance, inclination, model->LALpars, approximant, frequencies1), errnum);
 
-    XLAL_TRY(ret=XLALSimInspiralChooseFDWaveformSequence (&(model->roq->hptildeQuadratic), &(model->roq->hctildeQuadratic), phi0, m1*LAL_MSUN_SI, m2*LAL_MSUN_SI,
-							spin1x, spin1y, spin1z, spin2x, spin2y, spin2z, f_ref, corrected_distance, inclination, model->LALpars, approximant, (model->roq->frequencyNodesQuadratic)), errnum);
+    if (frequencies2)
+      XLAL_TRY(ret=XLALSimInspiralChooseFDWaveformSequence (hptilde2, hctilde2, phi0, m1*LAL_MSUN_SI, m2*LAL_MSUN_SI,
+							spin1x, spin1y, spin1z, spin2x, spin2y, spin2z, f_ref, corrected_distance, inclination, model->LALpars, approximant, frequencies2), errnum);
 
     REAL8 instant = model->freqhPlus->epoch.gpsSeconds + 1e-9*model->freqhPlus->epoch.gpsNanoSeconds;
     LALInferenceSetVariable(model->params, "time", &instant);
@@ -488,6 +492,32 @@ void LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferen
         return;
 }
 
+void LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model){
+/*************************************************************************************************************************/
+  model->roq->hptildeLinear=NULL, model->roq->hctildeLinear=NULL;
+  model->roq->hptildeQuadratic=NULL, model->roq->hctildeQuadratic=NULL;
+
+  LALInferenceFDWaveformSequence(model, &(model->roq->hptildeLinear), &(model->roq->hctildeLinear), model->roq->frequencyNodesLinear,
+                                 &(model->roq->hptildeQuadratic), &(model->roq->hctildeQuadratic), model->roq->frequencyNodesQuadratic);
+}
+
+void LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model)
+{
+  LALInferenceRelativeBinningModel *relbin = model->relbin;
+
+  if (relbin->hptilde) XLALDestroyCOMPLEX16FrequencySeries(relbin->hptilde);
+  if (relbin->hctilde) XLALDestroyCOMPLEX16FrequencySeries(relbin->hctilde);
+  relbin->hptilde = relbin->hctilde = NULL;
+
+  LALInferenceFDWaveformSequence(model, &(relbin->hptilde), &(relbin->hctilde), relbin->frequencies, NULL, NULL, NULL);
+
+  /* A waveform that could not be generated gets -inf likelihood */
+  if (!relbin->hptilde || !relbin->hctilde)
+    XLAL_ERROR_VOID(XLAL_EUSR0, "Waveform generation failed at the relative binning frequencies");
+  if (relbin->hptilde->data->length < relbin->frequencies->length || relbin->hctilde->data->length < relbin->frequencies->length)
+    XLAL_ERROR_VOID(XLAL_EBADLEN, "Model returned fewer samples than requested frequencies");
+}
+
 void LALInferenceTemplateSineGaussian(LALInferenceModel *model)
 /*****************************************************/
 /* Sine-Gaussian (burst) template.                   */
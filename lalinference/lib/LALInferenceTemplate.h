@@ -123,6 +123,15 @@ void LALInferenceTemplateNullTimedomain(LALInferenceModel *model);
 void LALInferenceTemplateSineGaussian(LALInferenceModel *model);
 
 void LALInferenceROQWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model);
+
+/**
+ * Template function for the relative binning likelihood: evaluates h+ and
+ * hx at \c model->relbin->frequencies (normally the bin edges) with
+ * XLALSimInspiralChooseFDWaveformSequence(), storing them in
+ * \c model->relbin->hptilde and \c model->relbin->hctilde.
+ * See LALInferenceSetupRelativeBinning().
+ */
+void LALInferenceRelativeBinningWrapperForXLALSimInspiralChooseFDWaveformSequence(LALInferenceModel *model);
 /**
  * Damped Sinusoid template.
  *
@@ -251,8 +251,7 @@ double log_radial_integral(double r1, double r2, double p, double b, int k,
 		case GSL_SUCCESS:
 			break;
 		default:
-			fprintf(stderr,"%s unable to handle GSL error: %s\n",__func__,gsl_strerror(ret));
-			exit(1);
+			XLAL_ERROR_REAL8(XLAL_ERANGE,"unable to integrate for p=%lf, b=%lf: GSL error %s",p,b,gsl_strerror(ret));
 			break;
         }
     }
@@ -297,6 +296,7 @@ log_radial_integrator *log_radial_integrator_init(double r1, double r2, int k, i
     if(cosmology) dVC_dVL_init();
     
     int interrupted=0;
+    double max_error = 0;
     OMP_BEGIN_INTERRUPTIBLE
     integrator = malloc(sizeof(*integrator));
     /* Temporarily turn off gsl_error handler which isn't thread safe. */
@@ -334,6 +334,54 @@ log_radial_integrator *log_radial_integrator_init(double r1, double r2, int k, i
         z2[i] = z0[i*size + (size - 1 - i)];
     region2 = cubic_interp_init(z2, size, umin, d);
 
+    if (!(region0 && region1 && region2))
+        goto done;
+
+    /* Estimate the interpolation error by comparing against quadrature
+     * half-way between the nodes, on a coarser grid of cells */
+    const size_t stride = size > 32 ? (size - 1) / 32 : 1;
+    const size_t ncheck = (size - 1) / stride;
+    double *errors = calloc(ncheck * (ncheck + 2), sizeof(*errors));
+    XLAL_CHECK_ABORT(errors);
+    old_handler = gsl_set_error_handler_off();
+
+    #pragma omp parallel for
+    for (size_t i = 0; i < ncheck * (ncheck + 2); i ++)
+    {
+        if (OMP_WAS_INTERRUPTED)
+            OMP_EXIT_LOOP_EARLY;
+
+        const size_t ix = i / (ncheck + 2);
+        const size_t iy = i % (ncheck + 2);
+        const double x = xmin + (ix * stride + 0.5) * d;
+        double y, interp;
+        if (iy < ncheck) {
+            /* Bicubic table */
+            y = ymin + (iy * stride + 0.5) * d;
+            interp = bicubic_interp_eval(region0, x, y);
+        } else if (iy == ncheck) {
+            /* Large-distance edge */
+            y = ymax;
+            interp = cubic_interp_eval(region1, x);
+        } else {
+            /* Diagonal table */
+            const double u = umin + (ix * stride + 0.5) * d;
+            y = ymin + (size - 1) * d - (ix * stride + 0.5) * d;
+            interp = cubic_interp_eval(region2, u);
+        }
+        const double p = exp(x);
+        const double b = 2 * gsl_pow_2(p) / exp(y);
+        const double exact = log_radial_integral(r1, r2, p, b, k, cosmology, gaussian);
+        if (isfinite(exact) && isfinite(interp))
+            errors[i] = fabs(exact - interp);
+    }
+    gsl_set_error_handler(old_handler);
+
+    for (size_t i = 0; i < ncheck * (ncheck + 2); i ++)
+        if (errors[i] > max_error)
+            max_error = errors[i];
+    free(errors);
+
 done:
     interrupted = OMP_WAS_INTERRUPTED;
     OMP_END_INTERRUPTIBLE
@@ -357,6 +405,13 @@ done:
     integrator->r1 = r1;
     integrator->r2 = r2;
     integrator->k = k;
+    integrator->xmin = xmin;
+    integrator->ymin = ymin;
+    integrator->umin = umin;
+    integrator->umax = umin + (size - 1) * d;
+    integrator->cosmology = cosmology;
+    integrator->gaussian = gaussian;
+    integrator->max_error = max_error;
     return integrator;
 }
 
@@ -376,12 +431,25 @@ void log_radial_integrator_free(log_radial_integrator *integrator)
 }
 
 
+/* Quadrature outside the tables.  As when the tables are built, the GSL
+ * error handler is switched off, and a failed integral is an XLAL error. */
+static double log_radial_integrator_fallback(const log_radial_integrator *integrator, double p, double b)
+{
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off();
+    const double result = log_radial_integral(integrator->r1, integrator->r2, p, b,
+        integrator->k, integrator->cosmology, integrator->gaussian);
+    gsl_set_error_handler(old_handler);
+    if (XLAL_IS_REAL8_FAIL_NAN(result))
+        XLAL_ERROR_REAL8(XLAL_EFUNC);
+    return result;
+}
+
+
 double log_radial_integrator_eval(const log_radial_integrator *integrator, double p, double b, double log_p, double log_b)
 {
     const double x = log_p;
     const double y = M_LN2 + 2 * log_p - log_b;
     double result;
-    XLAL_CHECK_ABORT(x <= integrator->xmax);
 
     if (p == 0) {
         /* note: p2 == 0 implies b == 0 */
@@ -395,18 +463,25 @@ double log_radial_integrator_eval(const log_radial_integrator *integrator, doubl
             result = log((gsl_pow_int(integrator->r2, k1) - gsl_pow_int(integrator->r1, k1)) / k1);
         }
     } else {
-        if (y >= integrator->ymax) {
+        const double v = 0.5 * (x + y);
+        const double u = 0.5 * (x - y);
+        if (!(x >= integrator->xmin && x <= integrator->xmax)) {
+            result = log_radial_integrator_fallback(integrator, p, b);
+        } else if (y >= integrator->ymax) {
             result = cubic_interp_eval(integrator->region1, x);
-        } else {
-            const double v = 0.5 * (x + y);
-            if (v <= integrator->vmax)
-            {
-                const double u = 0.5 * (x - y);
+        } else if (v <= integrator->vmax) {
+            if (u >= integrator->umin && u <= integrator->umax)
                 result = cubic_interp_eval(integrator->region2, u);
-            } else {
-                result = bicubic_interp_eval(integrator->region0, x, y);
-            }
+            else
+                result = log_radial_integrator_fallback(integrator, p, b);
+        } else if (y >= integrator->ymin) {
+            result = bicubic_interp_eval(integrator->region0, x, y);
+        } else {
+            /* Also catches b <= 0, for which y is undefined */
+            result = log_radial_integrator_fallback(integrator, p, b);
         }
+        if (XLAL_IS_REAL8_FAIL_NAN(result))
+            XLAL_ERROR_REAL8(XLAL_EFUNC);
         result += gsl_pow_2(0.5 * b / p);
     }
 
@@ -14,6 +14,9 @@ typedef struct taglog_radial_integrator {
 		cubic_interp *region2;
 		double xmax, ymax, vmax, r1, r2;
 		int k;
+		double xmin, ymin, umin, umax; /* Extent of the tables; quadrature is used outside */
+		int cosmology, gaussian;
+		double max_error; /* Largest interpolation error of the log integral found at init */
 } log_radial_integrator;
 
 typedef struct tagradial_integrand_params {
@@ -52,6 +55,8 @@ void log_radial_integrator_free(log_radial_integrator *integrator);
  * Evaluate the log distance integrator for given SNRs.
  * With a template at reference distance (1Mpc), compute the marginal likelihood
  * over distance. Uses the two SNRs \f$ p=sqrt(<h|h>) \f$ and \f$ b=<d|h> \f$.
+ * Points outside the lookup tables fall back to direct quadrature, which
+ * fails with XLAL_ERANGE if the integral does not converge.
  * @param integrator a log_radial_integrator
  * @param p The optimal SNR \f$ p = sqrt(<h|h>) \f$
  * @param b match between template and data \f$ b = <h|d> \f$
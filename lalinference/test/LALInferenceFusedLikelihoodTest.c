@@ -0,0 +1,204 @@
+/*
+ *  LALInferenceFusedLikelihoodTest.c:  Compare the fused and scalar frequency-domain likelihoods
+ *
+ *  Copyright (C) 2026 The LALSuite developers
+ *
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <lal/LALInference.h>
+#include <lal/LALInferenceInit.h>
+#include <lal/LALInferenceReadData.h>
+#include <lal/LALInferencePrior.h>
+#include <lal/LALInferenceTemplate.h>
+#include <lal/LALInferenceLikelihood.h>
+#include <lal/LIGOLwXMLRead.h>
+#include <lal/LIGOMetadataUtils.h>
+
+const char HELPSTR[]=\
+"LALInferenceFusedLikelihoodTest: Unit test for the fused multi-detector kernel against the scalar loop of the likelihood.\n\
+ The likelihood is evaluated at the injection given with --inj and at points around it.\n\
+ Example (see test_fused_likelihood.sh): \n\
+ $ ./LALInferenceFusedLikelihoodTest --inj injection_standard.xml --trigtime 441417609 --seglen 8 --srate 2048 --psdlength 1000 --psdstart 1 --ifo [H1,L1] --H1-cache LALSimAdLIGO --L1-cache LALSimAdLIGO --H1-channel LALSimAdLIGO --L1-channel LALSimAdLIGO --approximant IMRPhenomPv2 --dataseed 1324\n\n\n\
+";
+
+/* Number of points near the injection, and their spread as a fraction of
+   the prior widths */
+#define NTEST 20
+#define SCALE 1e-2
+/* The two paths sum the same terms in a different order */
+#define TOLERANCE 1e-9
+#define SEED 1729
+
+/* Start thread 0 at the injection */
+static int start_at_injection(LALInferenceRunState *runState)
+{
+  ProcessParamsTable *ppt = LALInferenceGetProcParamVal(runState->commandLine, "--inj");
+  XLAL_CHECK(ppt, XLAL_EINVAL, "--inj is required");
+  SimInspiralTable *injTable = XLALSimInspiralTableFromLIGOLw(ppt->value);
+  XLAL_CHECK(injTable, XLAL_EFUNC, "Unable to read %s", ppt->value);
+
+  LALInferenceVariables injParams;
+  memset(&injParams, 0, sizeof(injParams));
+  LALInferenceInjectionToVariables(injTable, &injParams);
+  LALInferenceVariables *currentParams = runState->threads[0].currentParams;
+  for (LALInferenceVariableItem *item = currentParams->head; item; item = item->next)
+    if (item->type == LALINFERENCE_REAL8_t && LALInferenceCheckVariableNonFixed(currentParams, item->name)
+        && LALInferenceCheckVariable(&injParams, item->name))
+      *(REAL8 *)item->value = LALInferenceGetREAL8Variable(&injParams, item->name);
+  LALInferenceClearVariables(&injParams);
+  XLALDestroySimInspiralTable(injTable);
+  return XLAL_SUCCESS;
+}
+
+/* The fused kernel is not used with PSD fitting: unit PSD scales over the
+   whole band leave the likelihood unchanged but select the scalar loop */
+static void add_unit_psd_scales(LALInferenceVariables *params, UINT4 nifo, UINT4 nbins)
+{
+  gsl_matrix *scale = gsl_matrix_alloc(nifo, 1);
+  gsl_matrix *bandsMin = gsl_matrix_alloc(nifo, 1);
+  gsl_matrix *bandsMax = gsl_matrix_alloc(nifo, 1);
+  gsl_matrix_set_all(scale, 1.0);
+  gsl_matrix_set_all(bandsMin, 0.0);
+  gsl_matrix_set_all(bandsMax, nbins);
+  UINT4 psdFlag = 1;
+  LALInferenceAddVariable(params, "psdScaleFlag", &psdFlag, LALINFERENCE_UINT4_t, LALINFERENCE_PARAM_FIXED);
+  LALInferenceAddgslMatrixVariable(params, "psdscale", scale, LALINFERENCE_PARAM_FIXED);
+  LALInferenceAddgslMatrixVariable(params, "psdBandsMin", bandsMin, LALINFERENCE_PARAM_FIXED);
+  LALInferenceAddgslMatrixVariable(params, "psdBandsMax", bandsMax, LALINFERENCE_PARAM_FIXED);
+}
+
+/* log(L) with the fused kernel and with the scalar loop, and the largest
+   relative difference of log(L) and of the per-detector log-likelihoods */
+static REAL8 compare_likelihoods(LALInferenceRunState *runState, LALInferenceVariables *params, UINT4 nifo, REAL8 *logL, REAL8 *logLScalar)
+{
+  LALInferenceModel *model = runState->threads[0].model;
+  LALInferenceVariables scalarParams;
+  REAL8 ifoLogL[nifo], err;
+
+  *logL = runState->likelihood(params, runState->data, model);
+  memcpy(ifoLogL, model->ifo_loglikelihoods, sizeof(ifoLogL));
+
+  memset(&scalarParams, 0, sizeof(scalarParams));
+  LALInferenceCopyVariables(params, &scalarParams);
+  add_unit_psd_scales(&scalarParams, nifo, runState->data->freqData->data->length);
+  *logLScalar = runState->likelihood(&scalarParams, runState->data, model);
+  LALInferenceClearVariables(&scalarParams);
+
+  err = fabs(*logL - *logLScalar) / fmax(1.0, fabs(*logLScalar));
+  for (UINT4 i = 0; i < nifo; i++) {
+    REAL8 e = fabs(ifoLogL[i] - model->ifo_loglikelihoods[i]) / fmax(1.0, fabs(model->ifo_loglikelihoods[i]));
+    if (e > err || isnan(e)) err = e;
+  }
+  return err;
+}
+
+int main(int argc, char *argv[]){
+  ProcessParamsTable *procParams = NULL;
+  LALInferenceRunState *runState = NULL;
+  LALInferenceIFOData *dataPtr;
+  LALInferenceVariables test;
+  REAL8 logL, logLScalar, err, maxErr = 0.0;
+  UINT4 nifo = 0, ngood = 0;
+  int failures = 0;
+
+  procParams = LALInferenceParseCommandLine(argc, argv);
+  runState = LALInferenceInitRunState(procParams);
+  XLAL_CHECK_MAIN(runState, XLAL_EFUNC);
+  LALInferenceInjectInspiralSignal(runState->data, runState->commandLine);
+  for (dataPtr = runState->data; dataPtr; dataPtr = dataPtr->next)
+    nifo++;
+
+  LALInferenceInitCBCThreads(runState, 1);
+  XLAL_CHECK_MAIN(start_at_injection(runState) == XLAL_SUCCESS, XLAL_EFUNC);
+  LALInferenceInitLikelihood(runState);
+  LALInferenceModel *model = runState->threads[0].model;
+  XLAL_CHECK_MAIN(!model->relbin && !model->roq_flag, XLAL_EINVAL, "Relative binning and ROQ do not use the fused kernel");
+
+  /* At the injection */
+  err = compare_likelihoods(runState, runState->threads[0].currentParams, nifo, &logL, &logLScalar);
+  XLAL_CHECK_MAIN(model->fusedBins, XLAL_EFAILED, "The fused kernel was not used");
+  fprintf(stdout, "Injection: log(L) = %.10f, scalar %.10f\n", logL, logLScalar);
+  if (!(err < TOLERANCE)) {
+    fprintf(stderr, "FAIL: relative difference %g at the injection exceeds %g\n", err, TOLERANCE);
+    failures++;
+  }
+
+  /* At seeded points around the injection, within the prior */
+  gsl_rng *rng = gsl_rng_alloc(gsl_rng_mt19937);
+  XLAL_CHECK_MAIN(rng, XLAL_ENOMEM);
+  gsl_rng_set(rng, SEED);
+  memset(&test, 0, sizeof(test));
+  for (UINT4 i = 0; i < NTEST; i++) {
+    LALInferenceCopyVariables(runState->threads[0].currentParams, &test);
+    for (LALInferenceVariableItem *item = test.head; item; item = item->next) {
+      REAL8 min, max;
+      if (item->type != LALINFERENCE_REAL8_t || !LALInferenceCheckVariableNonFixed(&test, item->name)
+          || !LALInferenceCheckMinMaxPrior(runState->priorArgs, item->name))
+        continue;
+      LALInferenceGetMinMaxPrior(runState->priorArgs, item->name, &min, &max);
+      REAL8 x = *(REAL8 *)item->value + gsl_ran_gaussian(rng, SCALE*(max - min));
+      if (item->vary == LALINFERENCE_PARAM_CIRCULAR)
+        x = min + fmod(fmod(x - min, max - min) + (max - min), max - min);
+      else
+        x = x < min ? min : (x > max ? max : x);
+      *(REAL8 *)item->value = x;
+    }
+    err = compare_likelihoods(runState, &test, nifo, &logL, &logLScalar);
+    LALInferenceClearVariables(&test);
+    if (isinf(logL) && isinf(logLScalar)) continue;
+    if (err > maxErr || isnan(err)) maxErr = err;
+    ngood++;
+  }
+  gsl_rng_free(rng);
+  fprintf(stdout, "Near the injection: max relative difference %g over %u points\n", maxErr, ngood);
+  if (ngood < NTEST / 2 || !(maxErr < TOLERANCE)) {
+    fprintf(stderr, "FAIL: max relative difference %g over %u points\n", maxErr, ngood);
+    failures++;
+  }
+
+  /* Data and PSD modified in place: the scalar loop sees the change at
+     once, the fused kernel after LALInferenceResetFusedBins() */
+  for (dataPtr = runState->data; dataPtr; dataPtr = dataPtr->next) {
+    for (UINT4 k = 0; k < dataPtr->freqData->data->length; k++)
+      dataPtr->freqData->data->data[k] *= 0.5;
+    for (UINT4 k = 0; k < dataPtr->oneSidedNoisePowerSpectrum->data->length; k++)
+      dataPtr->oneSidedNoisePowerSpectrum->data->data[k] *= 2.0;
+  }
+  LALInferenceResetFusedBins(model);
+  XLAL_CHECK_MAIN(!model->fusedBins, XLAL_EFAILED, "The fused workspace was not released");
+  err = compare_likelihoods(runState, runState->threads[0].currentParams, nifo, &logL, &logLScalar);
+  fprintf(stdout, "Modified data: log(L) = %.10f, scalar %.10f\n", logL, logLScalar);
+  if (!model->fusedBins || !(err < TOLERANCE)) {
+    fprintf(stderr, "FAIL: relative difference %g after the data were modified\n", err);
+    failures++;
+  }
+
+  LALInferenceDestroyModel(model);
+  runState->threads[0].model = NULL;
+
+  fprintf(stdout, "Tolerance = %g\n", TOLERANCE);
+  fprintf(stdout, "Test result: %s\n", failures ? "failed" : "passed");
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
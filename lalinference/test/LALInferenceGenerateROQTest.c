@@ -4,6 +4,7 @@
 #include <gsl/gsl_randist.h>
 
 #include <time.h>
+#include <string.h>
 #include <math.h>
 
 /* check whether to include omp.h for use of multiple cores */
@@ -19,6 +20,9 @@
 
 #define TOLERANCE 10e-12
 
+/* tolerance on the difference of bases produced by the blocked and classical algorithms */
+#define BTOL 1e-8
+
 /* tolerance allow for fractional percentage log likelihood difference */
 #define LTOL 0.1
 
@@ -43,6 +47,117 @@ COMPLEX16 imag_model(double frequency, double Mchirp, double modperiod){
   return ( pow(frequency, -7./6.) * pow(Mchirp*LAL_MTSUN_SI,5./6.) * cexp(I*calc_phase(frequency,Mchirp)) )*sin(LAL_TWOPI*frequency/modperiod);
 }
 
+/* files written by the checkpoint and memory-mapping tests */
+#define CHECKPOINT_FILE "roq_checkpoint.dat"
+#define MAPPED_FILE "roq_training_set.dat"
+
+/* offsets in the checkpoint file of the completion flag and of the first greedy point */
+#define CHECKPOINT_COMPLETE_OFFSET (8 + 5*sizeof(UINT4))
+#define CHECKPOINT_GPTS_OFFSET (8 + 6*sizeof(UINT4) + sizeof(REAL8))
+
+/* largest absolute difference between two bases of the same shape */
+double basis_difference(const REAL8 *a, const REAL8 *b, size_t n);
+
+/* overwrite a UINT4 in a file */
+int patch_file(const char *filename, long offset, UINT4 value);
+
+/* check checkpointing, resuming and memory-mapping of the blocked greedy algorithm against a reference basis */
+int test_blocked_greedy(const REAL8 *RBref, const UINT4Vector *gdptsref, const REAL8 *TSdata, size_t TSsize, size_t wl, INT4 complexData, const REAL8Vector *fweights, double tolerance);
+
+double basis_difference(const REAL8 *a, const REAL8 *b, size_t n){
+  double maxdiff = 0.;
+  for ( size_t i = 0; i < n; i++ ){
+    if ( fabs(a[i] - b[i]) > maxdiff ) { maxdiff = fabs(a[i] - b[i]); }
+  }
+  return maxdiff;
+}
+
+int patch_file(const char *filename, long offset, UINT4 value){
+  FILE *fp = fopen(filename, "r+b");
+  if ( !fp ) { return 1; }
+  int ok = fseek(fp, offset, SEEK_SET) == 0 && fwrite(&value, sizeof(UINT4), 1, fp) == 1;
+  return ( fclose(fp) == 0 && ok ) ? 0 : 1;
+}
+
+int test_blocked_greedy(const REAL8 *RBref, const UINT4Vector *gdptsref, const REAL8 *TSdata, size_t TSsize, size_t wl, INT4 complexData, const REAL8Vector *fweights, double tolerance){
+  const size_t rowlen = (complexData ? 2 : 1) * wl, nbasis = gdptsref->length;
+  const char *kind = complexData ? "complex" : "real";
+  LALInferenceROQGreedySettings settings = { 64, CHECKPOINT_FILE, 3, 0 };
+  REAL8Array *RB = NULL;
+  COMPLEX16Array *cRB = NULL;
+  UINT4Vector *gdpts = NULL;
+  const REAL8 *RBdata;
+  int failed = 0, errnum;
+  REAL8 err;
+
+  /* write the training set to a file and map it */
+  FILE *fp = fopen(MAPPED_FILE, "wb");
+  if ( !fp || fwrite(TSdata, sizeof(REAL8)*rowlen, TSsize, fp) != TSsize || fclose(fp) != 0 ){
+    fprintf(stderr, "Could not write the %s training set to '%s'\n", kind, MAPPED_FILE);
+    return 1;
+  }
+  LALInferenceROQTrainingSet *TSset = LALInferenceMapROQTrainingSet(MAPPED_FILE, wl, complexData);
+  if ( !TSset || TSset->rows != TSsize || TSset->cols != wl ){
+    fprintf(stderr, "Could not map the %s training set\n", kind);
+    return 1;
+  }
+
+  /* a basis to a looser tolerance, checkpointed every 3 iterations and when complete */
+  remove(CHECKPOINT_FILE);
+  if ( complexData ) { err = LALInferenceGenerateCOMPLEX16OrthonormalBasisBlocked(&cRB, fweights, 1e6*tolerance, TSset, &gdpts, &settings); }
+  else { err = LALInferenceGenerateREAL8OrthonormalBasisBlocked(&RB, fweights, 1e6*tolerance, TSset, &gdpts, &settings); }
+  if ( XLAL_IS_REAL8_FAIL_NAN(err) || gdpts->length >= nbasis || memcmp(gdpts->data, gdptsref->data, gdpts->length*sizeof(UINT4)) ){
+    fprintf(stderr, "Checkpointed %s basis is not the start of the full basis\n", kind);
+    failed = 1;
+  }
+  fprintf(stderr, "Checkpointed %s basis: %u of %zu elements\n", kind, gdpts ? gdpts->length : 0, nbasis);
+  XLALDestroyUINT4Vector( gdpts );
+  XLALDestroyREAL8Array( RB );
+  XLALDestroyCOMPLEX16Array( cRB );
+  gdpts = NULL; RB = NULL; cRB = NULL;
+
+  /* resume from the checkpoint as if it had been interrupted, with the full tolerance */
+  if ( patch_file(CHECKPOINT_FILE, CHECKPOINT_COMPLETE_OFFSET, 0) ){
+    fprintf(stderr, "Could not modify checkpoint '%s'\n", CHECKPOINT_FILE);
+    return 1;
+  }
+  if ( complexData ) { err = LALInferenceGenerateCOMPLEX16OrthonormalBasisBlocked(&cRB, fweights, tolerance, TSset, &gdpts, &settings); }
+  else { err = LALInferenceGenerateREAL8OrthonormalBasisBlocked(&RB, fweights, tolerance, TSset, &gdpts, &settings); }
+  RBdata = complexData ? (cRB ? (const REAL8 *)cRB->data : NULL) : (RB ? RB->data : NULL);
+  if ( XLAL_IS_REAL8_FAIL_NAN(err) || gdpts->length != nbasis || memcmp(gdpts->data, gdptsref->data, nbasis*sizeof(UINT4)) ){
+    fprintf(stderr, "Resumed %s basis chose different basis elements\n", kind);
+    failed = 1;
+  } else {
+    double diff = basis_difference(RBdata, RBref, nbasis*rowlen);
+    fprintf(stderr, "Resumed %s basis: max. difference from the reference basis = %le\n", kind, diff);
+    if ( diff > BTOL ) { failed = 1; }
+  }
+  XLALDestroyUINT4Vector( gdpts );
+  XLALDestroyREAL8Array( RB );
+  XLALDestroyCOMPLEX16Array( cRB );
+  gdpts = NULL; RB = NULL; cRB = NULL;
+
+  /* a checkpoint referring to an element beyond the training set is refused */
+  if ( patch_file(CHECKPOINT_FILE, CHECKPOINT_GPTS_OFFSET, TSsize + 5) ){
+    fprintf(stderr, "Could not modify checkpoint '%s'\n", CHECKPOINT_FILE);
+    return 1;
+  }
+  if ( complexData ) { XLAL_TRY( err = LALInferenceGenerateCOMPLEX16OrthonormalBasisBlocked(&cRB, fweights, tolerance, TSset, &gdpts, &settings), errnum ); }
+  else { XLAL_TRY( err = LALInferenceGenerateREAL8OrthonormalBasisBlocked(&RB, fweights, tolerance, TSset, &gdpts, &settings), errnum ); }
+  if ( !XLAL_IS_REAL8_FAIL_NAN(err) || errnum == XLAL_SUCCESS ){
+    fprintf(stderr, "Invalid %s checkpoint was not refused\n", kind);
+    XLALDestroyUINT4Vector( gdpts );
+    XLALDestroyREAL8Array( RB );
+    XLALDestroyCOMPLEX16Array( cRB );
+    failed = 1;
+  }
+  remove(CHECKPOINT_FILE);
+
+  LALInferenceDestroyROQTrainingSet( TSset );
+  remove(MAPPED_FILE);
+  return failed;
+}
+
 int main(void) {
   REAL8Array *TS = NULL, *TSquad = NULL, *cTSquad = NULL;  /* the training set of real waveforms (and quadratic model) */
   COMPLEX16Array *cTS = NULL;              /* the training set of complex waveforms */
@@ -120,13 +235,49 @@ int main(void) {
     }
   }
 
+  /* create the linear bases with the blocked greedy algorithm first, as it leaves the training sets unchanged */
+  REAL8Array *RBblocked = NULL;
+  COMPLEX16Array *cRBblocked = NULL;
+  UINT4Vector *gdptsblocked = NULL, *cgdptsblocked = NULL;
+  LALInferenceROQTrainingSet *TSset = LALInferenceROQTrainingSetFromREAL8Array( TS );
+  LALInferenceROQTrainingSet *cTSset = LALInferenceROQTrainingSetFromCOMPLEX16Array( cTS );
+  LALInferenceROQGreedySettings greedysettings = { 64, NULL, 0, 0 };
+  LALInferenceGenerateREAL8OrthonormalBasisBlocked(&RBblocked, fweights, tolerance, TSset, &gdptsblocked, &greedysettings);
+  LALInferenceGenerateCOMPLEX16OrthonormalBasisBlocked(&cRBblocked, fweights, tolerance, cTSset, &cgdptsblocked, &greedysettings);
+  LALInferenceDestroyROQTrainingSet( TSset );
+  LALInferenceDestroyROQTrainingSet( cTSset );
+
+  /* the same bases from memory-mapped training sets, through a checkpoint */
+  if ( test_blocked_greedy(RBblocked->data, gdptsblocked, TS->data, TSsize, wl, 0, fweights, tolerance) ) { return 1; }
+  if ( test_blocked_greedy((REAL8 *)cRBblocked->data, cgdptsblocked, (REAL8 *)cTS->data, TSsize, wl, 1, fweights, tolerance) ) { return 1; }
+
   /* create reduced orthonormal basis from training set for linear part */
   REAL8 maxprojerr = 0.;
   maxprojerr = LALInferenceGenerateREAL8OrthonormalBasis(&RBlinear, fweights, tolerance, &TS, &gdpts);
+  if ( gdpts->length != gdptsblocked->length || memcmp(gdpts->data, gdptsblocked->data, gdpts->length*sizeof(UINT4)) ){
+    fprintf(stderr, "Blocked greedy algorithm chose different real basis elements\n");
+    return 1;
+  }
   XLALDestroyUINT4Vector( gdpts );
+  if ( basis_difference(RBlinear->data, RBblocked->data, RBlinear->dimLength->data[0]*wl) > BTOL ){
+    fprintf(stderr, "Blocked greedy algorithm produced a different real basis\n");
+    return 1;
+  }
   fprintf(stderr, "No. linear nodes (real) = %d, %d x %d; Maximum projection err. = %le\n", RBlinear->dimLength->data[0], RBlinear->dimLength->data[0], RBlinear->dimLength->data[1], maxprojerr);
   maxprojerr = LALInferenceGenerateCOMPLEX16OrthonormalBasis(&cRBlinear, fweights, tolerance, &cTS, &gdpts);
+  if ( gdpts->length != cgdptsblocked->length || memcmp(gdpts->data, cgdptsblocked->data, gdpts->length*sizeof(UINT4)) ){
+    fprintf(stderr, "Blocked greedy algorithm chose different complex basis elements\n");
+    return 1;
+  }
   XLALDestroyUINT4Vector( gdpts );
+  if ( basis_difference((REAL8 *)cRBlinear->data, (REAL8 *)cRBblocked->data, 2*cRBlinear->dimLength->data[0]*wl) > BTOL ){
+    fprintf(stderr, "Blocked greedy algorithm produced a different complex basis\n");
+    return 1;
+  }
+  XLALDestroyUINT4Vector( gdptsblocked );
+  XLALDestroyUINT4Vector( cgdptsblocked );
+  XLALDestroyREAL8Array( RBblocked );
+  XLALDestroyCOMPLEX16Array( cRBblocked );
   fprintf(stderr, "No. linear nodes (complex) = %d, %d x %d; Maximum projection err. = %le\n", cRBlinear->dimLength->data[0], cRBlinear->dimLength->data[0], cRBlinear->dimLength->data[1], maxprojerr);
   maxprojerr = LALInferenceGenerateREAL8OrthonormalBasis(&RBquad, fweights, tolerance, &TSquad, &gdpts);
   XLALDestroyUINT4Vector( gdpts );
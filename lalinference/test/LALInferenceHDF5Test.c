@@ -1,6 +1,52 @@
 #include <lal/XLALError.h>
 #include <lal/LALInferenceHDF5.h>
 #include <gsl/gsl_test.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define CHECKPOINT "test_checkpoint.hdf5"
+
+/* Write entries offset to N of vars_array as the n-th checkpoint increment. */
+static void write_increment(
+  LALInferenceVariables **vars_array, UINT4 n, UINT4 offset, UINT4 N)
+{
+  char name[FILENAME_MAX];
+  LALInferenceCheckpointIncrementName(name, sizeof(name), CHECKPOINT, n);
+  LALH5File *file = XLALH5FileOpen(name, "w");
+  LALH5File *group = LALInferenceH5CreateGroupStructure(
+    file, "lalinference", "lalinference_mcmc");
+  LALInferenceH5CheckpointIncrementToDataset(
+    group, vars_array, offset, N, "chain_samples");
+  XLALH5FileClose(group);
+  XLALH5FileClose(file);
+}
+
+/* Append the entries of the n-th checkpoint increment to an array holding
+ * *N entries, as a resumed run does.  Returns 1 if they do not follow on. */
+static int read_increment(
+  LALInferenceVariables ***vars_array, UINT4 *N, UINT4 n)
+{
+  char name[FILENAME_MAX];
+  LALInferenceVariables **new_array = NULL;
+  UINT4 N_new = 0;
+  LALInferenceCheckpointIncrementName(name, sizeof(name), CHECKPOINT, n);
+  LALH5File *file = XLALH5FileOpen(name, "r");
+  LALH5File *group = XLALH5GroupOpen(file, "lalinference/lalinference_mcmc");
+  int gap = LALInferenceH5CheckpointIncrementToVariablesArray(
+    group, "chain_samples", *N, &new_array, &N_new);
+  XLALH5FileClose(group);
+  XLALH5FileClose(file);
+  if (N_new > 0)
+  {
+    *vars_array = XLALRealloc(
+      *vars_array, (*N + N_new) * sizeof(LALInferenceVariables *));
+    memcpy(*vars_array + *N, new_array, N_new * sizeof(LALInferenceVariables *));
+    *N += N_new;
+  }
+  XLALFree(new_array);
+  return gap;
+}
 
 int main(int argc, char **argv)
 {
@@ -113,6 +159,88 @@ int main(int argc, char **argv)
   /* Close file. */
   XLALH5FileClose(file);
 
+  /* A full checkpoint of the first entries of a chain, followed by
+   * increments holding the rest, restores the uninterrupted chain. */
+  N = 64;
+  vars_array = XLALCalloc(N, sizeof(LALInferenceVariables *));
+  for (UINT4 i = 0; i < N; i ++)
+  {
+    LALInferenceVariables *vars = XLALCalloc(1, sizeof(LALInferenceVariables));
+    vars_array[i] = vars;
+    LALInferenceAddREAL8Variable(vars, "abc", i, LALINFERENCE_PARAM_LINEAR);
+    LALInferenceAddINT4Variable (vars, "lmn", i, LALINFERENCE_PARAM_LINEAR);
+  }
+  file = XLALH5FileOpen(CHECKPOINT, "w");
+  LALH5File *checkpoint_group = LALInferenceH5CreateGroupStructure(
+    file, "lalinference", "lalinference_mcmc");
+  LALInferenceH5VariablesArrayToDataset(
+    checkpoint_group, vars_array, 16, "chain_samples");
+  XLALH5FileClose(checkpoint_group);
+  XLALH5FileClose(file);
+  write_increment(vars_array, 1, 16, 40);
+  write_increment(vars_array, 2, 40, 64);
+  /* Written again after the run was restored from the first increment */
+  write_increment(vars_array, 3, 32, 64);
+  /* Nothing new since the previous checkpoint */
+  write_increment(vars_array, 4, 64, 64);
+  for (UINT4 i = 0; i < N; i ++)
+  {
+    LALInferenceClearVariables(vars_array[i]);
+    XLALFree(vars_array[i]);
+  }
+  XLALFree(vars_array);
+
+  file = XLALH5FileOpen(CHECKPOINT, "r");
+  dataset = XLALH5DatasetRead(
+    file, "lalinference/lalinference_mcmc/chain_samples");
+  N = 0;
+  vars_array = NULL;
+  LALInferenceH5DatasetToVariablesArray(dataset, &vars_array, &N);
+  XLALH5DatasetFree(dataset);
+  XLALH5FileClose(file);
+  gsl_test_int(N, 16, "number of rows in the full checkpoint");
+  for (UINT4 n = 1; n <= 4; n ++)
+    gsl_test_int(read_increment(&vars_array, &N, n), 0,
+      "increment %u follows on", n);
+  gsl_test_int(N, 64, "number of rows restored from the increments");
+  for (UINT4 i = 0; i < N; i ++)
+  {
+    gsl_test_abs(LALInferenceGetREAL8Variable(vars_array[i], "abc"), i, 0,
+      "restored value of column abc");
+    gsl_test_int(LALInferenceGetINT4Variable (vars_array[i], "lmn"), i,
+      "restored value of column lmn");
+  }
+  for (UINT4 i = 0; i < N; i ++)
+  {
+    LALInferenceClearVariables(vars_array[i]);
+    XLALFree(vars_array[i]);
+  }
+  XLALFree(vars_array);
+
+  /* An increment starting beyond the restored entries is rejected */
+  N = 8;
+  vars_array = NULL;
+  gsl_test_int(read_increment(&vars_array, &N, 2), 1,
+    "increment with a gap is rejected");
+  gsl_test_int(N, 8, "no rows added from an increment with a gap");
+
+  /* The full checkpoint has no offset, so it cannot be read as an increment */
+  int gap, errnum;
+  file = XLALH5FileOpen(CHECKPOINT, "r");
+  checkpoint_group = XLALH5GroupOpen(file, "lalinference/lalinference_mcmc");
+  XLAL_TRY(gap = LALInferenceH5CheckpointIncrementToVariablesArray(
+    checkpoint_group, "chain_samples", 0, &vars_array, &N), errnum);
+  XLALH5FileClose(checkpoint_group);
+  XLALH5FileClose(file);
+  gsl_test_int(gap, XLAL_FAILURE, "increment without an offset is rejected");
+  gsl_test_int(errnum != XLAL_SUCCESS, 1, "error set for an increment without an offset");
+  gsl_test_int(N, 0, "no rows read from an increment without an offset");
+
+  gsl_test_int(LALInferenceRemoveCheckpointIncrements(CHECKPOINT, 1), 4,
+    "number of increments removed");
+  gsl_test_int(access(CHECKPOINT ".1", F_OK), -1, "increments removed");
+  gsl_test_int(access(CHECKPOINT, F_OK), 0, "full checkpoint kept");
+
   /* Check for memory leaks. */
   LALCheckMemoryLeaks();
 
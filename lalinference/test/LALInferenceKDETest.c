@@ -0,0 +1,176 @@
+#include <math.h>
+#include <string.h>
+#include <sys/time.h>
+#include <lal/XLALError.h>
+#include <lal/LALInferenceKDE.h>
+#include <lal/LALInferenceClusteredKDE.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_test.h>
+
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
+/* Three well-separated, correlated clusters in 3 dimensions */
+static gsl_matrix *clustered_data(gsl_rng *rng, INT4 npts)
+{
+  const INT4 dim = 3;
+  const INT4 nclusters = 3;
+  gsl_matrix *data = gsl_matrix_alloc(npts, dim);
+  for (INT4 i = 0; i < npts; i++)
+  {
+    INT4 c = i % nclusters;
+    REAL8 common = gsl_ran_gaussian(rng, 1.0);
+    for (INT4 p = 0; p < dim; p++)
+      gsl_matrix_set(data, i, p,
+        10.0 * c * (p + 1) + common + gsl_ran_gaussian(rng, 0.5));
+  }
+  return data;
+}
+
+/* The BIC of a clustering of npts points, evaluated over the points on all
+ * threads and on one thread; the two differ only by the order of the sum */
+static void time_bic(gsl_rng *rng, INT4 npts)
+{
+  struct timeval t1, t2;
+  double dt;
+
+  gsl_matrix *data = clustered_data(rng, npts);
+  LALInferenceKmeans *kmeans = LALInferenceKmeansRunBestOf(3, data, 1, rng);
+  LALInferenceKmeansBuildKDE(kmeans);
+
+  gettimeofday(&t1, NULL);
+  REAL8 bic = LALInferenceKmeansBIC(kmeans);
+  gettimeofday(&t2, NULL);
+  dt = (double)((t2.tv_sec + t2.tv_usec*1.e-6) - (t1.tv_sec + t1.tv_usec*1.e-6));
+  gsl_test(!isfinite(bic), "kmeans BIC of %d points is finite", npts);
+
+#ifdef HAVE_OPENMP
+  INT4 nthreads = omp_get_max_threads();
+  double dt1;
+  omp_set_num_threads(1);
+  gettimeofday(&t1, NULL);
+  REAL8 bic1 = LALInferenceKmeansBIC(kmeans);
+  gettimeofday(&t2, NULL);
+  omp_set_num_threads(nthreads);
+  dt1 = (double)((t2.tv_sec + t2.tv_usec*1.e-6) - (t1.tv_sec + t1.tv_usec*1.e-6));
+  gsl_test_rel(bic, bic1, 1e-12, "kmeans BIC of %d points on one thread", npts);
+  fprintf(stderr, "BIC of %d points: %.3lf s on %d threads, %.3lf s on one thread, speed-up = %.2lf\n",
+    npts, dt, nthreads, dt1, dt1/dt);
+#else
+  fprintf(stderr, "BIC of %d points: %.3lf s\n", npts, dt);
+#endif
+
+  LALInferenceKmeansDestroy(kmeans);
+  gsl_matrix_free(data);
+}
+
+/* Sum every kernel of a KDE directly, for comparison with the tree */
+static REAL8 brute_force_kde(LALInferenceKDE *kde, REAL8 *point)
+{
+  gsl_vector *y = gsl_vector_alloc(kde->dim);
+  REAL8 *exponents = XLALMalloc(kde->npts * sizeof(REAL8));
+
+  for (INT4 i = 0; i < kde->npts; i++)
+  {
+    for (INT4 p = 0; p < kde->dim; p++)
+      gsl_vector_set(y, p, point[p] - gsl_matrix_get(kde->data, i, p));
+    gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit,
+      kde->cholesky_decomp_cov_lower, y);
+
+    REAL8 dist2;
+    gsl_blas_ddot(y, y, &dist2);
+    exponents[i] = -dist2/2.;
+  }
+
+  REAL8 result = log_add_exps(exponents, kde->npts) - kde->log_norm_factor;
+
+  XLALFree(exponents);
+  gsl_vector_free(y);
+  return result;
+}
+
+/* With --timing, the BIC is also timed on 1e5 points, which takes a while */
+int main(int argc, char **argv)
+{
+  XLALSetErrorHandler(XLALExitErrorHandler);
+
+  gsl_rng *rng = gsl_rng_alloc(gsl_rng_mt19937);
+  gsl_rng_set(rng, 1234);
+
+  const INT4 npts = 3000;
+  const INT4 dim = 3;
+  const INT4 nclusters = 3;
+  gsl_matrix *data = clustered_data(rng, npts);
+
+  /* Tree evaluation of the KDE agrees with summing every kernel, both near
+   * the data and far out in the tails */
+  LALInferenceKDE *kde = LALInferenceNewKDEfromMat(data, NULL);
+  REAL8 point[3];
+  for (INT4 n = 0; n < 200; n++)
+  {
+    REAL8 scale = n < 100 ? 15.0 : 150.0;
+    for (INT4 p = 0; p < dim; p++)
+      point[p] = gsl_ran_flat(rng, -scale, 2.*scale);
+
+    REAL8 expected = brute_force_kde(kde, point);
+    REAL8 result = LALInferenceKDEEvaluatePoint(kde, point);
+    gsl_test_rel(result, expected, 1e-10, "tree KDE at point %d", n);
+  }
+
+  /* Rebuilding the bandwidth rebuilds the tree */
+  LALInferenceSetKDEBandwidth(kde);
+  for (INT4 p = 0; p < dim; p++)
+    point[p] = gsl_matrix_get(data, 0, p);
+  gsl_test_rel(LALInferenceKDEEvaluatePoint(kde, point),
+    brute_force_kde(kde, point), 1e-10, "tree KDE after rebuild");
+
+  LALInferenceDestroyKDE(kde);
+
+  /* The bounded assignment step converges to the nearest centroids */
+  LALInferenceKmeans *kmeans = LALInferenceCreateKmeans(nclusters, data, rng);
+  LALInferenceKmeansSeededInitialize(kmeans);
+  LALInferenceKmeansRun(kmeans);
+
+  REAL8 error = 0.;
+  for (INT4 i = 0; i < kmeans->npts; i++)
+  {
+    gsl_vector_view x = gsl_matrix_row(kmeans->data, i);
+    INT4 best_cluster = 0;
+    REAL8 best_dist = INFINITY;
+    for (INT4 j = 0; j < kmeans->k; j++)
+    {
+      gsl_vector_view c = gsl_matrix_row(kmeans->centroids, j);
+      REAL8 dist = euclidean_dist_squared(&x.vector, &c.vector);
+      if (dist < best_dist)
+      {
+        best_cluster = j;
+        best_dist = dist;
+      }
+    }
+    gsl_test_int(kmeans->assignments[i], best_cluster,
+      "assignment of point %d", i);
+    error += best_dist;
+  }
+  gsl_test_rel(kmeans->error, error, 1e-10, "kmeans error");
+
+  /* Evaluating the BIC in parallel gives a finite result */
+  REAL8 bic = LALInferenceKmeansBIC(kmeans);
+  gsl_test(!isfinite(bic), "kmeans BIC is finite");
+
+  LALInferenceKmeansDestroy(kmeans);
+  gsl_matrix_free(data);
+
+  time_bic(rng, npts);
+  if (argc > 1 && strcmp(argv[1], "--timing") == 0)
+    time_bic(rng, 100000);
+  gsl_rng_free(rng);
+
+  /* Check for memory leaks. */
+  LALCheckMemoryLeaks();
+
+  /* Done! */
+  return gsl_test_summary();
+}
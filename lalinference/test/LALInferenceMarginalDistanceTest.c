@@ -0,0 +1,113 @@
+/*
+ *  LALInferenceMarginalDistanceTest.c:  Lookup tables of the distance-marginalised likelihood
+ *
+ *  Copyright (C) 2026 The LALSuite developers
+ *
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <lal/XLALError.h>
+#include <lal/LALInferenceLikelihood.h>
+#include <lal/distance_integrator.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_test.h>
+
+/* Difference in log(L) allowed between a table and quadrature */
+#define TOLERANCE 1e-2
+
+/* <d|h> of a template at distance r, for optimal SNR p at 1 Mpc */
+#define DH(p, r) (2 * (p) * (p) / (r))
+
+/* Quadrature of the distance integral, plus the term the tables leave out */
+static double quadrature(const log_radial_integrator *integrator, double p, double b)
+{
+  return log_radial_integral(integrator->r1, integrator->r2, p, b,
+    integrator->k, integrator->cosmology, integrator->gaussian) + gsl_pow_2(0.5 * b / p);
+}
+
+/* The marginal likelihood by quadrature, with a d^2 prior normalised over
+ * [r1, r2] as in LALInferenceMarginalDistanceLogLikelihood */
+static double marginal_quadrature(double r1, double r2, double p, double b, int margphi)
+{
+  return log_radial_integral(r1, r2, p, b, 2, 0, !margphi) + gsl_pow_2(0.5 * b / p)
+    - log((gsl_pow_3(r2) - gsl_pow_3(r1)) / 3);
+}
+
+int main(int argc, char **argv)
+{
+  /* Not used */
+  (void)argc;
+  (void)argv;
+  int errnum;
+  double result;
+
+  /* A small table: inside it the interpolant agrees with quadrature, and
+   * outside it quadrature is used */
+  const double pmax = 100;
+  log_radial_integrator *integrator = log_radial_integrator_init(10, 1000, 2, 0, pmax, 400, 0);
+  XLAL_CHECK_EXIT(integrator);
+  gsl_test(!(integrator->max_error < TOLERANCE), "table error %g is below %g", integrator->max_error, TOLERANCE);
+
+  static const double table_points[][2] = {{5, 50}, {20, 400}, {0.9 * 100, 800}};
+  for (size_t i = 0; i < XLAL_NUM_ELEM(table_points); i++)
+  {
+    const double p = table_points[i][0], b = DH(p, table_points[i][1]);
+    gsl_test_abs(log_radial_integrator_eval(integrator, p, b, log(p), log(b)),
+      quadrature(integrator, p, b), TOLERANCE, "table at p=%g, b=%g", p, b);
+  }
+
+  /* Beyond pmax, and for <d|h> <= 0, where y = log(2 p^2 / b) is undefined */
+  static const double fallback_points[][2] = {{2 * 100, DH(200, 300)}, {1e4, DH(1e4, 50)}, {5, 0}, {5, -3}};
+  for (size_t i = 0; i < XLAL_NUM_ELEM(fallback_points); i++)
+  {
+    const double p = fallback_points[i][0], b = fallback_points[i][1];
+    XLAL_TRY(result = log_radial_integrator_eval(integrator, p, b, log(p), log(b)), errnum);
+    gsl_test_int(errnum, XLAL_SUCCESS, "no error outside the table at p=%g, b=%g", p, b);
+    gsl_test_abs(result, quadrature(integrator, p, b), 0, "quadrature outside the table at p=%g, b=%g", p, b);
+  }
+
+  /* Continuous across the edge of the table */
+  const double p_in = pmax * (1 - 1e-9), p_out = pmax * (1 + 1e-9);
+  gsl_test_abs(log_radial_integrator_eval(integrator, p_in, DH(p_in, 500), log(p_in), log(DH(p_in, 500))),
+    log_radial_integrator_eval(integrator, p_out, DH(p_out, 500), log(p_out), log(DH(p_out, 500))),
+    TOLERANCE, "continuous at the edge of the table");
+  log_radial_integrator_free(integrator);
+
+  /* Optimal SNRs beyond the table of LALInferenceMarginalDistanceLogLikelihood
+   * (1e5) give a likelihood; only NaN inputs are out of range */
+  const double p_big = 2e5;
+  XLAL_TRY(result = LALInferenceMarginalDistanceLogLikelihood(10, 1000, p_big, DH(p_big, 500), 0, 1), errnum);
+  gsl_test_int(errnum, XLAL_SUCCESS, "no XLAL_ERANGE for optimal SNR %g", p_big);
+  gsl_test_abs(result, marginal_quadrature(10, 1000, p_big, DH(p_big, 500), 1), 0,
+    "marginal likelihood for optimal SNR %g", p_big);
+  XLAL_TRY(result = LALInferenceMarginalDistanceLogLikelihood(10, 1000, NAN, 1, 0, 1), errnum);
+  gsl_test_int(errnum, XLAL_ERANGE, "XLAL_ERANGE for a NaN optimal SNR");
+
+  /* Each prior gets its own table, and later calls reuse it */
+  const double p = 20, b = DH(20, 400);
+  const double first = LALInferenceMarginalDistanceLogLikelihood(10, 1000, p, b, 0, 1);
+  gsl_test_abs(first, marginal_quadrature(10, 1000, p, b, 1), TOLERANCE,
+    "marginal likelihood for the first prior");
+  const double second = LALInferenceMarginalDistanceLogLikelihood(10, 2000, p, b, 0, 0);
+  gsl_test_abs(second, marginal_quadrature(10, 2000, p, b, 0), TOLERANCE,
+    "marginal likelihood for the second prior");
+  gsl_test_abs(LALInferenceMarginalDistanceLogLikelihood(10, 1000, p, b, 0, 1), first, 0,
+    "marginal likelihood for the first prior again");
+
+  return gsl_test_summary();
+}
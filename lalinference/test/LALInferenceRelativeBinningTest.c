@@ -0,0 +1,170 @@
+/*
+ *  LALInferenceRelativeBinningTest.c:  Compare the relative-binning and full likelihoods
+ *
+ *  Copyright (C) 2026 The LALSuite developers
+ *
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <lal/LALInference.h>
+#include <lal/LALInferenceInit.h>
+#include <lal/LALInferenceReadData.h>
+#include <lal/LALInferencePrior.h>
+#include <lal/LALInferenceTemplate.h>
+#include <lal/LALInferenceLikelihood.h>
+#include <lal/LIGOLwXMLRead.h>
+#include <lal/LIGOMetadataUtils.h>
+
+const char HELPSTR[]=\
+"LALInferenceRelativeBinningTest: Unit test for the relative-binning likelihood against the full likelihood.\n\
+ The fiducial waveform is the injection given with --inj; --relative-binning must be given.\n\
+ Example (see test_relative_binning.sh): \n\
+ $ ./LALInferenceRelativeBinningTest --inj injection_standard.xml --trigtime 441417609 --seglen 8 --srate 2048 --psdlength 1000 --psdstart 1 --ifo [H1,L1] --H1-cache LALSimAdLIGO --L1-cache LALSimAdLIGO --H1-channel LALSimAdLIGO --L1-channel LALSimAdLIGO --approximant IMRPhenomPv2 --0noise --relative-binning\n\n\n\
+";
+
+/* Number of points near the fiducial, and their spread as a fraction of
+   the prior widths */
+#define NTEST 20
+#define SCALE 1e-3
+/* At the fiducial the summary data reproduce the full sums up to round-off
+   and the difference between the uniform and sequence waveforms */
+#define FIDUCIAL_TOLERANCE 1e-4
+/* Error of the linear interpolation of the waveform ratio over the bins */
+#define TOLERANCE 0.05
+#define SEED 1729
+
+/* Start thread 0 at the injection, so that it is the fiducial waveform */
+static int start_at_injection(LALInferenceRunState *runState)
+{
+  ProcessParamsTable *ppt = LALInferenceGetProcParamVal(runState->commandLine, "--inj");
+  XLAL_CHECK(ppt, XLAL_EINVAL, "--inj is required");
+  SimInspiralTable *injTable = XLALSimInspiralTableFromLIGOLw(ppt->value);
+  XLAL_CHECK(injTable, XLAL_EFUNC, "Unable to read %s", ppt->value);
+
+  LALInferenceVariables injParams;
+  memset(&injParams, 0, sizeof(injParams));
+  LALInferenceInjectionToVariables(injTable, &injParams);
+  LALInferenceVariables *currentParams = runState->threads[0].currentParams;
+  for (LALInferenceVariableItem *item = currentParams->head; item; item = item->next)
+    if (item->type == LALINFERENCE_REAL8_t && LALInferenceCheckVariableNonFixed(currentParams, item->name)
+        && LALInferenceCheckVariable(&injParams, item->name))
+      *(REAL8 *)item->value = LALInferenceGetREAL8Variable(&injParams, item->name);
+  LALInferenceClearVariables(&injParams);
+  XLALDestroySimInspiralTable(injTable);
+  return XLAL_SUCCESS;
+}
+
+/* log(L) with relative binning and with the full template */
+static void compare_likelihoods(LALInferenceRunState *runState, LALInferenceVariables *params, LALInferenceTemplateFunction fullTemplate, REAL8 *logL, REAL8 *logLFull)
+{
+  LALInferenceModel *model = runState->threads[0].model;
+  LALInferenceTemplateFunction relbinTemplate = model->templt;
+  LALInferenceRelativeBinningModel *relbin = model->relbin;
+
+  *logL = runState->likelihood(params, runState->data, model);
+  model->relbin = NULL;
+  model->templt = fullTemplate;
+  *logLFull = runState->likelihood(params, runState->data, model);
+  model->relbin = relbin;
+  model->templt = relbinTemplate;
+}
+
+int main(int argc, char *argv[]){
+  ProcessParamsTable *procParams = NULL;
+  LALInferenceRunState *runState = NULL;
+  LALInferenceVariables test;
+  REAL8 logL, logLFull, maxDeltaLogL = 0.0;
+  UINT4 ngood = 0;
+  int failures = 0;
+
+  procParams = LALInferenceParseCommandLine(argc, argv);
+  XLAL_CHECK_MAIN(LALInferenceGetProcParamVal(procParams, "--relative-binning"), XLAL_EINVAL, "--relative-binning is required");
+
+  runState = LALInferenceInitRunState(procParams);
+  XLAL_CHECK_MAIN(runState, XLAL_EFUNC);
+  LALInferenceInjectInspiralSignal(runState->data, runState->commandLine);
+
+  /* Set up the template, then the likelihood with the injection as the
+     fiducial waveform */
+  LALInferenceInitCBCThreads(runState, 1);
+  XLAL_CHECK_MAIN(start_at_injection(runState) == XLAL_SUCCESS, XLAL_EFUNC);
+  LALInferenceModel *model = runState->threads[0].model;
+  LALInferenceTemplateFunction fullTemplate = model->templt;
+  LALInferenceInitLikelihood(runState);
+  XLAL_CHECK_MAIN(model->relbin, XLAL_EFAILED, "Relative binning was not set up");
+
+  /* At the fiducial */
+  compare_likelihoods(runState, runState->threads[0].currentParams, fullTemplate, &logL, &logLFull);
+  fprintf(stdout, "Fiducial: log(L) = %.6f, full %.6f\n", logL, logLFull);
+  if (!(fabs(logL - logLFull) < FIDUCIAL_TOLERANCE)) {
+    fprintf(stderr, "FAIL: |delta log(L)| = %g at the fiducial exceeds %g\n", fabs(logL - logLFull), FIDUCIAL_TOLERANCE);
+    failures++;
+  }
+
+  /* The check made by the setup itself */
+  REAL8 setupDeltaLogL = LALInferenceGetREAL8Variable(runState->algorithmParams, "relativeBinningMaxDeltaLogL");
+  if (!(setupDeltaLogL < TOLERANCE)) {
+    fprintf(stderr, "FAIL: setup reported |delta log(L)| = %g\n", setupDeltaLogL);
+    failures++;
+  }
+
+  /* At seeded points around the fiducial, within the prior */
+  gsl_rng *rng = gsl_rng_alloc(gsl_rng_mt19937);
+  XLAL_CHECK_MAIN(rng, XLAL_ENOMEM);
+  gsl_rng_set(rng, SEED);
+  memset(&test, 0, sizeof(test));
+  for (UINT4 i = 0; i < NTEST; i++) {
+    LALInferenceCopyVariables(runState->threads[0].currentParams, &test);
+    for (LALInferenceVariableItem *item = test.head; item; item = item->next) {
+      REAL8 min, max;
+      if (item->type != LALINFERENCE_REAL8_t || !LALInferenceCheckVariableNonFixed(&test, item->name)
+          || !LALInferenceCheckMinMaxPrior(runState->priorArgs, item->name))
+        continue;
+      LALInferenceGetMinMaxPrior(runState->priorArgs, item->name, &min, &max);
+      REAL8 x = *(REAL8 *)item->value + gsl_ran_gaussian(rng, SCALE*(max - min));
+      if (item->vary == LALINFERENCE_PARAM_CIRCULAR)
+        x = min + fmod(fmod(x - min, max - min) + (max - min), max - min);
+      else
+        x = x < min ? min : (x > max ? max : x);
+      *(REAL8 *)item->value = x;
+    }
+    compare_likelihoods(runState, &test, fullTemplate, &logL, &logLFull);
+    LALInferenceClearVariables(&test);
+    if (isinf(logL) && isinf(logLFull)) continue;
+    if (fabs(logL - logLFull) > maxDeltaLogL || isnan(logL - logLFull)) maxDeltaLogL = fabs(logL - logLFull);
+    ngood++;
+  }
+  gsl_rng_free(rng);
+  LALInferenceDestroyModel(model);
+  runState->threads[0].model = NULL;
+
+  fprintf(stdout, "Near the fiducial: max |delta log(L)| = %g over %u points\n", maxDeltaLogL, ngood);
+  fprintf(stdout, "Tolerance = %g (fiducial %g)\n", TOLERANCE, FIDUCIAL_TOLERANCE);
+  if (ngood < NTEST / 2 || !(maxDeltaLogL < TOLERANCE)) {
+    fprintf(stderr, "FAIL: max |delta log(L)| = %g over %u points\n", maxDeltaLogL, ngood);
+    failures++;
+  }
+
+  fprintf(stdout, "Test result: %s\n", failures ? "failed" : "passed");
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -59,6 +59,12 @@ int LALInferenceProcessParamLine_TEST_CHARFILE(void);
 /*  LALInferenceExecuteFT tests */
 int LALInferenceExecuteFTTEST_NULLPLAN(void);
 
+/*  LALInferenceSplineCalibrationBasis tests */
+int LALInferenceSplineCalibrationBasisTEST(void);
+
+/*  LALInferenceCompileVariables tests */
+int LALInferenceCompiledVariablesTEST(void);
+
 int main(void){
     
 	int failureCount = 0;
@@ -77,6 +83,10 @@ int main(void){
 	printf("\n");
 	failureCount += LALInferenceExecuteFTTEST_NULLPLAN();
 	printf("\n");
+	failureCount += LALInferenceSplineCalibrationBasisTEST();
+	printf("\n");
+	failureCount += LALInferenceCompiledVariablesTEST();
+	printf("\n");
 	printf("Test results: %i failure(s).\n", failureCount);
 
 	return failureCount;
@@ -357,6 +367,172 @@ int LALInferenceExecuteFTTEST_NULLPLAN(void){
 }
 
 
+/*****************     TEST CODE for LALInferenceSplineCalibrationBasis     *****************/
+/* Test that the precomputed spline basis reproduces LALInferenceSplineCalibrationFactor,
+   and only recomputes the factors when the node values change. Expect pass. */
+
+int LALInferenceSplineCalibrationBasisTEST(void){
+
+    TEST_HEADER();
+
+    const UINT4 nnodes = 10;
+    const UINT4 length = 8192;
+    LIGOTimeGPS epoch={0,0};
+    UINT4 i, n;
+
+    REAL8Vector *logfreqs = XLALCreateREAL8Vector(nnodes);
+    REAL8Vector *amps = XLALCreateREAL8Vector(nnodes);
+    REAL8Vector *phases = XLALCreateREAL8Vector(nnodes);
+    for (n = 0; n < nnodes; n++) {
+        logfreqs->data[n] = log(20.0) + n * (log(1500.0) - log(20.0)) / (nnodes - 1);
+        amps->data[n] = 0.1 * sin(1.3 * n);
+        phases->data[n] = 0.05 * cos(0.7 * n + 0.2);
+    }
+
+    COMPLEX16FrequencySeries *calFactor = XLALCreateCOMPLEX16FrequencySeries("calibration factors",
+        &epoch, 0, 0.25, &lalDimensionlessUnit, length);
+    REAL8 *freqs = XLALMalloc(length * sizeof(REAL8));
+    for (i = 0; i < length; i++)
+        freqs[i] = calFactor->deltaF * i;
+
+    LALInferenceSplineCalibrationBasis *basis = LALInferenceCreateSplineCalibrationBasis(logfreqs, freqs, length);
+    if (!basis || !LALInferenceSplineCalibrationBasisMatches(basis, logfreqs, length)) {
+        TEST_FAIL("Could not build spline calibration basis");
+    } else {
+        LALInferenceSplineCalibrationFactor(logfreqs, amps, phases, calFactor);
+        LALInferenceSplineCalibrationEvaluate(&basis, &amps, &phases, 1);
+        for (i = 0; i < length; i++)
+            if (!compareFloats(creal(basis->factors->data[i]), creal(calFactor->data->data[i]), 1e-12)
+                || !compareFloats(cimag(basis->factors->data[i]), cimag(calFactor->data->data[i]), 1e-12)) {
+                TEST_FAIL("Calibration factor differs at %g Hz", freqs[i]);
+                break;
+            }
+
+        UINT4 generation = basis->generation;
+        LALInferenceSplineCalibrationEvaluate(&basis, &amps, &phases, 1);
+        if (basis->generation != generation)
+            TEST_FAIL("Factors recomputed for unchanged node values");
+
+        amps->data[3] += 0.01;
+        LALInferenceSplineCalibrationEvaluate(&basis, &amps, &phases, 1);
+        if (basis->generation == generation)
+            TEST_FAIL("Factors not recomputed for changed node values");
+    }
+
+    LALInferenceDestroySplineCalibrationBasis(basis);
+    XLALFree(freqs);
+    XLALDestroyCOMPLEX16FrequencySeries(calFactor);
+    XLALDestroyREAL8Vector(logfreqs);
+    XLALDestroyREAL8Vector(amps);
+    XLALDestroyREAL8Vector(phases);
+
+    TEST_FOOTER();
+
+}
+
+
+/*****************     TEST CODE for LALInferenceCompileVariables     *****************/
+/* Test that values written through handles and by name in a compiled structure
+   are read back both ways, survive copies between structures sharing the
+   layout, and survive the decompilation caused by adding or removing a
+   variable. Expect pass. */
+
+int LALInferenceCompiledVariablesTEST(void){
+
+    TEST_HEADER();
+
+    LALInferenceVariables *vars = XLALCalloc(1, sizeof(LALInferenceVariables));
+    LALInferenceVariables *copy = XLALCalloc(1, sizeof(LALInferenceVariables));
+    REAL8Vector *vec = XLALCreateREAL8Vector(3);
+    REAL8Vector *copyvec;
+    LALInferenceVariableHandle ha, hlogL;
+    UINT4 n;
+
+    for (n = 0; n < vec->length; n++)
+        vec->data[n] = n + 1.0;
+    LALInferenceAddREAL8Variable(vars, "a", 1.0, LALINFERENCE_PARAM_LINEAR);
+    LALInferenceAddINT4Variable(vars, "n", 3, LALINFERENCE_PARAM_FIXED);
+    LALInferenceAddREAL8VectorVariable(vars, "v", vec, LALINFERENCE_PARAM_OUTPUT);
+    LALInferenceAddCOMPLEX16Variable(vars, "c", crect(0.5, -0.25), LALINFERENCE_PARAM_OUTPUT);
+    LALInferenceAddREAL8Variable(vars, "logL", -5.0, LALINFERENCE_PARAM_OUTPUT);
+
+    /* reads and writes through handles and by name */
+    if (LALInferenceCompileVariables(vars) != XLAL_SUCCESS || !LALInferenceVariablesIsCompiled(vars))
+        TEST_FAIL("Could not compile variables");
+    ha = LALInferenceGetVariableHandle(vars, "a");
+    hlogL = LALInferenceGetVariableHandle(vars, "logL");
+    LALInferenceSetREAL8VariableByHandle(vars, ha, 2.5);
+    if (LALInferenceGetREAL8Variable(vars, "a") != 2.5)
+        TEST_FAIL("Value set through handle not read back by name");
+    LALInferenceSetREAL8Variable(vars, "logL", -7.0);
+    if (LALInferenceGetREAL8VariableByHandle(vars, hlogL) != -7.0)
+        TEST_FAIL("Value set by name not read back through handle");
+
+    /* a copy adopts the layout, and later copies reuse its vector */
+    LALInferenceCopyVariables(vars, copy);
+    if (!LALInferenceCheckVariableHandle(copy, ha))
+        TEST_FAIL("Copy does not share the layout of its origin");
+    if (LALInferenceCompareVariables(vars, copy))
+        TEST_FAIL("Copy differs from its origin");
+    copyvec = LALInferenceGetREAL8VectorVariable(copy, "v");
+    if (copyvec == vec)
+        TEST_FAIL("Vector variable not deep copied");
+    vec->data[1] = 20.0;
+    LALInferenceSetREAL8VariableByHandle(vars, ha, 3.5);
+    LALInferenceCopyVariables(vars, copy);
+    if (LALInferenceGetREAL8VectorVariable(copy, "v") != copyvec || copyvec->data[1] != 20.0)
+        TEST_FAIL("Vector variable not copied in place");
+    if (LALInferenceGetREAL8VariableByHandle(copy, ha) != 3.5)
+        TEST_FAIL("Slot not copied between structures sharing a layout");
+
+    /* adding a variable decompiles, keeping all values */
+    LALInferenceAddREAL8Variable(vars, "extra", 9.0, LALINFERENCE_PARAM_OUTPUT);
+    if (LALInferenceVariablesIsCompiled(vars) || LALInferenceCheckVariableHandle(vars, ha))
+        TEST_FAIL("Variables still compiled after adding a variable");
+    if (LALInferenceGetREAL8Variable(vars, "a") != 3.5 || LALInferenceGetINT4Variable(vars, "n") != 3
+        || LALInferenceGetREAL8Variable(vars, "logL") != -7.0 || LALInferenceGetREAL8Variable(vars, "extra") != 9.0
+        || LALInferenceGetCOMPLEX16Variable(vars, "c") != crect(0.5, -0.25)
+        || LALInferenceGetREAL8VectorVariable(vars, "v") != vec || vec->data[1] != 20.0)
+        TEST_FAIL("Values changed by decompilation");
+    LALInferenceSetREAL8Variable(vars, "a", 4.5);
+    if (LALInferenceGetREAL8Variable(vars, "a") != 4.5)
+        TEST_FAIL("Value set by name after decompilation not read back");
+
+    /* copying from it leaves it alone and compiles the copy with a new layout */
+    LALInferenceCopyVariables(vars, copy);
+    if (LALInferenceVariablesIsCompiled(vars))
+        TEST_FAIL("Origin of a copy modified");
+    if (!LALInferenceVariablesIsCompiled(copy) || LALInferenceCheckVariableHandle(copy, ha))
+        TEST_FAIL("Copy not compiled with a new layout");
+    ha = LALInferenceGetVariableHandle(copy, "a");
+    if (LALInferenceGetREAL8VariableByHandle(copy, ha) != 4.5
+        || LALInferenceGetREAL8Variable(copy, "extra") != 9.0 || LALInferenceGetREAL8VectorVariable(copy, "v")->data[1] != 20.0)
+        TEST_FAIL("Copy of the decompiled variables differs");
+
+    /* and copying back makes it adopt the new layout */
+    LALInferenceCopyVariables(copy, vars);
+    if (!LALInferenceCheckVariableHandle(vars, ha) || LALInferenceGetREAL8VariableByHandle(vars, ha) != 4.5
+        || LALInferenceGetREAL8VectorVariable(vars, "v")->data[1] != 20.0)
+        TEST_FAIL("Variables did not adopt the layout of the copy");
+
+    /* removing a variable decompiles, keeping the other values */
+    LALInferenceRemoveVariable(copy, "logL");
+    if (LALInferenceVariablesIsCompiled(copy) || LALInferenceCheckVariable(copy, "logL"))
+        TEST_FAIL("Variable not removed from compiled variables");
+    if (LALInferenceGetREAL8Variable(copy, "a") != 4.5 || LALInferenceGetINT4Variable(copy, "n") != 3
+        || LALInferenceGetCOMPLEX16Variable(copy, "c") != crect(0.5, -0.25) || LALInferenceGetREAL8VectorVariable(copy, "v")->data[1] != 20.0)
+        TEST_FAIL("Values changed by removing a variable");
+
+    LALInferenceClearVariables(vars);
+    LALInferenceClearVariables(copy);
+    XLALFree(vars);
+    XLALFree(copy);
+
+    TEST_FOOTER();
+
+}
+
+
 /******************************************
  * 
  * Old tests
@@ -502,8 +678,7 @@ void BasicMCMCOneStep(LALInferenceRunState *runState)
   logLikelihoodCurrent = thread->currentLikelihood;
 
   // generate proposal:
-  proposedParams.head = NULL;
-  proposedParams.dimension = 0;
+  memset(&proposedParams,0,sizeof(proposedParams));
   logProposalRatio = thread->proposal(thread, thread->currentParams, &proposedParams);
 
   // compute prior & likelihood:
@@ -630,13 +805,11 @@ void NelderMeadAlgorithm(struct tagLALInferenceRunState *runState, LALInferenceV
 
   printf(" NelderMeadAlgorithm(); current parameter values:\n");
   LALInferencePrintVariables(thread->currentParams);
-  startval.head=NULL;
-  startval.dimension=0;
+  memset(&startval,0,sizeof(startval));
   LALInferenceCopyVariables(thread->currentParams, &startval);
 
   // initialize "param":
-  param.head=NULL;
-  param.dimension=0;
+  memset(&param,0,sizeof(param));
   // "subset" specified? If not, simply gather all REAL8 elements of "currentParams" to optimize over:
   if (subset==NULL) {
     if (thread->currentParams == NULL) {
@@ -816,8 +989,7 @@ void LALVariablesTest(void)
 {
   number = 10.0;
   five=5.0;
-  variables.head=NULL;
-  variables.dimension=0;
+  memset(&variables,0,sizeof(variables));
 	
   memset(&status,0,sizeof(status));
   LALInferenceAddVariable(&variables, "number", &number, LALINFERENCE_REAL4_t,LALINFERENCE_PARAM_FIXED);
@@ -1136,7 +1308,7 @@ void PTMCMCTest(void)
 	//runstate->prior=PTUniformGaussianPrior;
 	//runstate->proposal=PTMCMCLALProposal;
 	//runstate->proposal=PTMCMCGaussianProposal;
-	runstate->proposalArgs = XLALMalloc(sizeof(LALInferenceVariables));
+	runstate->proposalArgs = XLALCalloc(1, sizeof(LALInferenceVariables));
 	runstate->proposalArgs->head=NULL;
 	runstate->proposalArgs->dimension=0;
 	//runstate->likelihood=LALInferenceFreqDomainLogLikelihood;
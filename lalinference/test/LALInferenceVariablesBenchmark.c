@@ -0,0 +1,151 @@
+/*
+ *  LALInferenceVariablesBenchmark.c: Overhead of LALInferenceVariables per sampler iteration
+ *
+ *  Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Time the bookkeeping an MCMC iteration does on LALInferenceVariables,
+ * with ordinary and with compiled variables.
+ *
+ * Usage: LALInferenceVariablesBenchmark [iterations]
+ *
+ * Each iteration copies the current point to the proposed one, moves one
+ * parameter, reads every sampled parameter as a prior would, accepts the
+ * point and records the likelihood outputs, as PTMCMCAlgorithm() does.  No
+ * waveform or likelihood is computed, so the times are the pure overhead of
+ * the parameter container.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <lal/LALStdlib.h>
+#include <lal/LogPrintf.h>
+#include <lal/LALInference.h>
+
+static const char *sampled[] = {"chirpmass", "q", "a_spin1", "a_spin2", "tilt_spin1", "tilt_spin2",
+  "phi12", "phi_jl", "logdistance", "costheta_jn", "polarisation", "phase", "time",
+  "rightascension", "declination", NULL};
+static const char *fixed[] = {"fRef", "LAL_APPROXIMANT", "LAL_PNORDER", NULL};
+static const char *outputs[] = {"logl", "logprior", "logpost", "deltalogl", "nullLogL", "temperature",
+  "optimal_snr", "matched_filter_snr", "loglH1", "loglL1", "loglV1", NULL};
+
+static void setup(LALInferenceVariables *vars)
+{
+  REAL8 x = 0.5;
+  INT4 n = 1;
+  for (UINT4 i = 0; sampled[i]; i++)
+    LALInferenceAddVariable(vars, sampled[i], &x, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_LINEAR);
+  LALInferenceAddVariable(vars, fixed[0], &x, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_FIXED);
+  for (UINT4 i = 1; fixed[i]; i++)
+    LALInferenceAddVariable(vars, fixed[i], &n, LALINFERENCE_INT4_t, LALINFERENCE_PARAM_FIXED);
+  for (UINT4 i = 0; outputs[i]; i++)
+    LALInferenceAddVariable(vars, outputs[i], &x, LALINFERENCE_REAL8_t, LALINFERENCE_PARAM_OUTPUT);
+  LALInferenceSortVariablesByName(vars);
+}
+
+/* Iterations using name lookups only */
+static REAL8 run_by_name(LALInferenceVariables *current, LALInferenceVariables *proposed, UINT4 iterations)
+{
+  REAL8 sum = 0.;
+  for (UINT4 it = 0; it < iterations; it++) {
+    LALInferenceCopyVariables(current, proposed);
+    REAL8 x = LALInferenceGetREAL8Variable(proposed, sampled[it % 15]) + 1e-3;
+    LALInferenceSetREAL8Variable(proposed, sampled[it % 15], x);
+    for (UINT4 i = 0; sampled[i]; i++)
+      sum += LALInferenceGetREAL8Variable(proposed, sampled[i]);
+    LALInferenceCopyVariables(proposed, current);
+    for (UINT4 i = 0; outputs[i]; i++)
+      LALInferenceSetREAL8Variable(current, outputs[i], sum);
+    LALInferenceSortVariablesByName(current);
+  }
+  return sum;
+}
+
+/* The same iterations on compiled variables, through handles */
+static REAL8 run_by_handle(LALInferenceVariables *current, LALInferenceVariables *proposed, UINT4 iterations)
+{
+  REAL8 sum = 0.;
+  LALInferenceVariableHandle hsampled[15], houtputs[11];
+  for (UINT4 i = 0; sampled[i]; i++)
+    hsampled[i] = LALInferenceGetVariableHandle(current, sampled[i]);
+  for (UINT4 i = 0; outputs[i]; i++)
+    houtputs[i] = LALInferenceGetVariableHandle(current, outputs[i]);
+  for (UINT4 it = 0; it < iterations; it++) {
+    LALInferenceCopyVariables(current, proposed);
+    REAL8 x = LALInferenceGetREAL8VariableByHandle(proposed, hsampled[it % 15]) + 1e-3;
+    LALInferenceSetREAL8VariableByHandle(proposed, hsampled[it % 15], x);
+    for (UINT4 i = 0; sampled[i]; i++)
+      sum += LALInferenceGetREAL8VariableByHandle(proposed, hsampled[i]);
+    LALInferenceCopyVariables(proposed, current);
+    for (UINT4 i = 0; outputs[i]; i++)
+      LALInferenceSetREAL8VariableByHandle(current, houtputs[i], sum);
+    LALInferenceSortVariablesByName(current);
+  }
+  return sum;
+}
+
+int main(int argc, char *argv[])
+{
+  UINT4 iterations = argc > 1 ? (UINT4)atoi(argv[1]) : 100000;
+  LALInferenceVariables *current = XLALCalloc(1, sizeof(LALInferenceVariables));
+  LALInferenceVariables *proposed = XLALCalloc(1, sizeof(LALInferenceVariables));
+  REAL8 t0, elapsedName, elapsedCompiled, elapsedHandle, sumName, sumHandle;
+
+  /* Ordinary variables */
+  setup(current);
+  t0 = XLALGetTimeOfDay();
+  sumName = run_by_name(current, proposed, iterations);
+  elapsedName = XLALGetTimeOfDay() - t0;
+
+  /* Compiled variables, name lookups */
+  LALInferenceClearVariables(current);
+  LALInferenceClearVariables(proposed);
+  setup(current);
+  XLAL_CHECK_MAIN(LALInferenceCompileVariables(current) == XLAL_SUCCESS, XLAL_EFUNC);
+  t0 = XLALGetTimeOfDay();
+  run_by_name(current, proposed, iterations);
+  elapsedCompiled = XLALGetTimeOfDay() - t0;
+
+  /* Compiled variables, handles */
+  LALInferenceClearVariables(current);
+  LALInferenceClearVariables(proposed);
+  setup(current);
+  XLAL_CHECK_MAIN(LALInferenceCompileVariables(current) == XLAL_SUCCESS, XLAL_EFUNC);
+  t0 = XLALGetTimeOfDay();
+  sumHandle = run_by_handle(current, proposed, iterations);
+  elapsedHandle = XLALGetTimeOfDay() - t0;
+  XLAL_CHECK_MAIN(sumName == sumHandle, XLAL_EFAILED, "Compiled variables gave a different result");
+
+  printf("%u iterations, %d variables\n", iterations, current->dimension);
+  printf("ordinary variables:          %8.1f ns/iteration\n", 1e9 * elapsedName / iterations);
+  printf("compiled, name lookups:      %8.1f ns/iteration\n", 1e9 * elapsedCompiled / iterations);
+  printf("compiled, handles:           %8.1f ns/iteration\n", 1e9 * elapsedHandle / iterations);
+  printf("speed-up: %.2f (names), %.2f (handles)\n", elapsedName / elapsedCompiled, elapsedName / elapsedHandle);
+
+  LALInferenceClearVariables(current);
+  LALInferenceClearVariables(proposed);
+  XLALFree(current);
+  XLALFree(proposed);
+  LALCheckMemoryLeaks();
+  return 0;
+}
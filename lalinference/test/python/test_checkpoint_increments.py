@@ -0,0 +1,137 @@
+# Interrupted and resumed runs of lalinference_mcmc and lalinference_nest
+# with incremental checkpoints
+# Copyright (C) 2026 The LALSuite developers
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the
+# Free Software Foundation; either version 2 of the License, or (at your
+# option) any later version.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+# Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+
+"""Run the samplers on the correlated Gaussian test likelihood with
+--checkpoint-increments, ask for two checkpoints with SIGUSR2 and interrupt
+them with SIGINT.  The first checkpoint is full, the next two are
+increments.  The run is then resumed from the increments to the end: no
+sample may be lost or repeated.
+"""
+
+import os
+import shutil
+import signal
+import subprocess
+import sys
+import time
+
+import numpy as np
+
+import pytest
+
+h5py = pytest.importorskip("h5py")
+
+# seconds between the signals; the first leaves time to set up the run
+INTERVAL = 10
+SKIP = 20
+NLIVE = 1024
+
+ARGS = [
+    "--ifo", "H1",
+    "--H1-cache", "LALSimAdLIGO",
+    "--H1-channel", "LALSimAdLIGO",
+    "--psdstart", "1",
+    "--psdlength", "32",
+    "--seglen", "4",
+    "--srate", "512",
+    "--trigtime", "0",
+    "--dataseed", "1324",
+    "--approx", "SpinTaylorT4",
+    "--correlatedGaussianLikelihood",
+    "--randomseed", "1234",
+    "--resume",
+    "--checkpoint-increments", "4",
+]
+
+
+def find_program(name):
+    """The samplers are built in bin and bin/mpi, which are not on the test
+    PATH"""
+    path = [os.environ.get("PATH", "")]
+    builddir = os.environ.get("LAL_TEST_BUILDDIR")
+    if builddir:
+        bindir = os.path.join(builddir, os.pardir, os.pardir, "bin")
+        path[:0] = [bindir, os.path.join(bindir, "mpi")]
+    program = shutil.which(name, path=os.pathsep.join(path))
+    if program is None:
+        pytest.skip("{} not found".format(name))
+    return program
+
+
+def interrupted_run(path, cmd):
+    """Run cmd, checkpoint it twice and interrupt it"""
+    with open(str(path / "interrupted.log"), "w") as log:
+        proc = subprocess.Popen(cmd, cwd=str(path), stdout=log, stderr=log)
+        for sig in (signal.SIGUSR2, signal.SIGUSR2, signal.SIGINT):
+            time.sleep(INTERVAL)
+            if proc.poll() is not None:
+                pytest.skip("the run ended before it was interrupted")
+            proc.send_signal(sig)
+        proc.wait(timeout=300)
+
+
+def resumed_run(path, cmd):
+    """Run cmd to the end and return its output"""
+    log = subprocess.run(cmd, cwd=str(path), check=True,
+                         stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                         universal_newlines=True)
+    return log.stdout
+
+
+def test_mcmc_resumes_from_increments(tmp_path):
+    outfile = str(tmp_path / "mcmc.hdf5")
+    cmd = [find_program("lalinference_mcmc"), *ARGS,
+           "--ntemps", "2", "--nsteps", "200000", "--skip", str(SKIP),
+           "--outfile", outfile]
+    interrupted_run(tmp_path, cmd)
+    assert os.path.exists(outfile + ".resume")
+    assert os.path.exists(outfile + ".resume.2")
+
+    log = resumed_run(tmp_path, cmd)
+    assert "Resuming from increment {}.resume.2".format(outfile) in log
+    with h5py.File(outfile, "r") as f:
+        cycles = f["lalinference/lalinference_mcmc/posterior_samples"]["cycle"]
+    # every sample of the chain, once and in order
+    assert len(cycles) > 0
+    assert np.all(np.diff(cycles) == SKIP)
+
+
+def test_nest_resumes_from_increments(tmp_path):
+    outfile = str(tmp_path / "nest.hdf5")
+    cmd = [find_program("lalinference_nest"), *ARGS,
+           "--Nlive", str(NLIVE), "--maxmcmc", "100", "--outfile", outfile]
+    interrupted_run(tmp_path, cmd)
+    assert os.path.exists(outfile + ".2")
+
+    log = resumed_run(tmp_path, cmd)
+    assert "restoring increment {}.2".format(outfile) in log
+    with h5py.File(outfile, "r") as f:
+        logl = f["lalinference/lalinference_nest/nested_samples"]["logL"]
+    # the dead points are in increasing likelihood, none of them repeated;
+    # the final live points follow in increasing likelihood too
+    dead = logl[:-NLIVE]
+    assert len(dead) > 0
+    assert np.all(np.diff(dead) > 0)
+    assert np.all(np.diff(logl[-NLIVE:]) >= 0)
+    assert logl[-NLIVE] >= dead[-1]
+
+
+if __name__ == '__main__':
+    args = sys.argv[1:] or ["-v", "-rs", "--junit-xml=junit-checkpoint-increments.xml"]
+    sys.exit(pytest.main(args=[__file__] + args))
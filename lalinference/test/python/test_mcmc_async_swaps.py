@@ -0,0 +1,144 @@
+# Short seeded runs of lalinference_mcmc with asynchronous swaps
+# Copyright (C) 2026 The LALSuite developers
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the
+# Free Software Foundation; either version 2 of the License, or (at your
+# option) any later version.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+# Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+
+"""Run lalinference_mcmc on the correlated Gaussian test likelihood with a
+ladder of four temperatures in one process.  Within a process
+--async-swaps proposes the same swaps as the blocking exchange, so with the
+same seed the chains must be identical.
+
+When mpiexec is available and lalinference_mcmc is built with MPI, the
+ladder is also split over two ranks and interrupted, so that the swaps
+between the ranks are settled before the checkpoint is written.
+"""
+
+import os
+import shutil
+import signal
+import subprocess
+import sys
+import time
+
+import numpy as np
+
+import pytest
+
+h5py = pytest.importorskip("h5py")
+
+NTEMPS = 4
+NSTEPS = 2000
+SKIP = 20
+SEED = 1234
+
+ARGS = [
+    "--ifo", "H1",
+    "--H1-cache", "LALSimAdLIGO",
+    "--H1-channel", "LALSimAdLIGO",
+    "--psdstart", "1",
+    "--psdlength", "32",
+    "--seglen", "4",
+    "--srate", "512",
+    "--trigtime", "0",
+    "--dataseed", "1324",
+    "--approx", "SpinTaylorT4",
+    "--correlatedGaussianLikelihood",
+    "--ntemps", str(NTEMPS),
+    "--temp-skip", "10",
+    "--nsteps", str(NSTEPS),
+    "--skip", str(SKIP),
+    "--randomseed", str(SEED),
+]
+
+
+def find_mcmc():
+    """lalinference_mcmc is built in bin/mpi, which is not on the test PATH"""
+    path = [os.environ.get("PATH", "")]
+    builddir = os.environ.get("LAL_TEST_BUILDDIR")
+    if builddir:
+        path.insert(0, os.path.join(builddir, os.pardir, os.pardir, "bin", "mpi"))
+    mcmc = shutil.which("lalinference_mcmc", path=os.pathsep.join(path))
+    if mcmc is None:
+        pytest.skip("lalinference_mcmc not found")
+    return mcmc
+
+
+def run_mcmc(path, name, *extra):
+    """Run lalinference_mcmc and return the samples of every chain"""
+    outfile = str(path / "{}.hdf5".format(name))
+    subprocess.check_call([find_mcmc(), *ARGS, *extra, "--outfile", outfile],
+                          cwd=str(path))
+    with h5py.File(outfile, "r") as f:
+        group = f["lalinference/lalinference_mcmc"]
+        return {key: group[key][()] for key in group
+                if isinstance(group[key], h5py.Dataset)}
+
+
+def checkpoint_state(resume, chain):
+    """Current parameters of a chain in a resume file"""
+    with h5py.File(resume, "r") as f:
+        group = f["lalinference/lalinference_mcmc"]
+        return group["{}-checkpoint/current_parameters".format(chain)][0].tolist()
+
+
+def test_async_swaps_match_blocking_swaps(tmp_path):
+    blocking = run_mcmc(tmp_path, "blocking")
+    async_swaps = run_mcmc(tmp_path, "async", "--async-swaps")
+    assert sorted(async_swaps) == sorted(blocking)
+    assert len(blocking) == NTEMPS
+    for name, samples in blocking.items():
+        assert np.array_equal(async_swaps[name], samples), name
+
+
+def test_cold_chain(tmp_path):
+    chains = run_mcmc(tmp_path, "cold", "--async-swaps")
+    samples = chains["posterior_samples"]
+    assert len(samples) >= NSTEPS // SKIP
+    assert np.all(samples["temperature"] == 1)
+    assert np.all(np.isfinite(samples["logl"]))
+    # the chain moves
+    assert np.any(np.diff(samples["logl"]) != 0)
+
+
+def test_cross_rank_checkpoint(tmp_path):
+    mpiexec = shutil.which("mpiexec")
+    if mpiexec is None:
+        pytest.skip("mpiexec not found")
+    outfile = str(tmp_path / "ranks.hdf5")
+    args = [a if a != str(NSTEPS) else str(100 * NSTEPS) for a in ARGS]
+    proc = subprocess.Popen([mpiexec, "-n", "2", find_mcmc(), *args,
+                             "--async-swaps", "--outfile", outfile],
+                            cwd=str(tmp_path))
+    # interrupt the run while the chains swap across the ranks: every rank
+    # writes a checkpoint and exits
+    time.sleep(30)
+    proc.send_signal(signal.SIGINT)
+    proc.wait(timeout=300)
+    if not os.path.exists(outfile + ".01.resume"):
+        pytest.skip("lalinference_mcmc is built without MPI")
+    assert os.path.exists(outfile + ".resume")
+    # the hottest chain of rank 0 and the coldest chain of rank 1 swap
+    # states; an offer accepted but not collected would leave the same state
+    # in both checkpoints
+    per_rank = NTEMPS // 2
+    hot = checkpoint_state(outfile + ".resume", "chain_{:02d}".format(per_rank - 1))
+    cold = checkpoint_state(outfile + ".01.resume", "chain_{:02d}".format(per_rank))
+    assert hot != cold
+
+
+if __name__ == '__main__':
+    args = sys.argv[1:] or ["-v", "-rs", "--junit-xml=junit-mcmc-async-swaps.xml"]
+    sys.exit(pytest.main(args=[__file__] + args))
@@ -0,0 +1,88 @@
+# Short seeded runs of lalinference_nest replacing several live points at once
+# Copyright (C) 2026 The LALSuite developers
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the
+# Free Software Foundation; either version 2 of the License, or (at your
+# option) any later version.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+# Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+
+"""Run lalinference_nest on the correlated Gaussian test likelihood with
+--Nparallel 1 and 2.  The same seed must give the same run, and the
+evidences must agree within their statistical errors.
+"""
+
+import shutil
+import subprocess
+import sys
+
+import numpy as np
+
+import pytest
+
+h5py = pytest.importorskip("h5py")
+
+NLIVE = 128
+SEED = 1234
+
+ARGS = [
+    "--ifo", "H1",
+    "--H1-cache", "LALSimAdLIGO",
+    "--H1-channel", "LALSimAdLIGO",
+    "--psdstart", "1",
+    "--psdlength", "32",
+    "--seglen", "4",
+    "--srate", "512",
+    "--trigtime", "0",
+    "--dataseed", "1324",
+    "--approx", "SpinTaylorT4",
+    "--correlatedGaussianLikelihood",
+    "--Nlive", str(NLIVE),
+    "--maxmcmc", "100",
+    "--randomseed", str(SEED),
+]
+
+
+def run_nest(path, nparallel, name):
+    """Run lalinference_nest and return its log evidence, information and
+    nested samples"""
+    nest = shutil.which("lalinference_nest")
+    if nest is None:
+        pytest.skip("lalinference_nest not found")
+    outfile = str(path / "{}.hdf5".format(name))
+    subprocess.check_call([nest, *ARGS, "--Nparallel", str(nparallel),
+                           "--outfile", outfile])
+    with h5py.File(outfile, "r") as f:
+        group = f["lalinference/lalinference_nest"]
+        return (group.attrs["log_evidence"],
+                group.attrs["information_nats"],
+                group["nested_samples"][()])
+
+
+def test_seeded_run_is_reproducible(tmp_path):
+    logz1, _, samples1 = run_nest(tmp_path, 2, "first")
+    logz2, _, samples2 = run_nest(tmp_path, 2, "second")
+    assert logz1 == logz2
+    assert np.array_equal(samples1, samples2)
+
+
+def test_evidence_agrees_with_serial_run(tmp_path):
+    logz1, h1, _ = run_nest(tmp_path, 1, "serial")
+    logz2, h2, _ = run_nest(tmp_path, 2, "parallel")
+    # four times the standard deviation of the difference of two runs
+    tolerance = 4 * np.sqrt((h1 + h2) / NLIVE)
+    assert abs(logz1 - logz2) < tolerance
+
+
+if __name__ == '__main__':
+    args = sys.argv[1:] or ["-v", "-rs", "--junit-xml=junit-nest-parallel.xml"]
+    sys.exit(pytest.main(args=[__file__] + args))
@@ -0,0 +1,14 @@
+#!/usr/bin/env bash
+
+# Exit with failure as soon as a test fails
+set -e
+
+# The 30+30 Msun injection of injection_standard.xml in simulated noise
+inj="${LAL_TEST_SRCDIR:-.}/injection_standard.xml"
+
+echo "Testing BBH: IMRPhenomPv2, Gaussian likelihood"
+./LALInferenceFusedLikelihoodTest --inj "${inj}" --trigtime 441417609 --seglen 8 --srate 2048 --psdlength 1000 --psdstart 1 --ifo [H1,L1,V1] --H1-channel LALSimAdLIGO --L1-channel LALSimAdLIGO --V1-channel LALSimAdVirgo --H1-cache LALSimAdLIGO --L1-cache LALSimAdLIGO --V1-cache LALSimAdVirgo --H1-flow 20 --L1-flow 25 --V1-flow 30 --dataseed 1324 --approximant IMRPhenomPv2 --randomseed 1324
+
+echo "-------------------------------------------"
+echo "Testing BBH: IMRPhenomPv2, marginalised phase"
+./LALInferenceFusedLikelihoodTest --inj "${inj}" --trigtime 441417609 --seglen 8 --srate 2048 --psdlength 1000 --psdstart 1 --ifo [H1,L1,V1] --H1-channel LALSimAdLIGO --L1-channel LALSimAdLIGO --V1-channel LALSimAdVirgo --H1-cache LALSimAdLIGO --L1-cache LALSimAdLIGO --V1-cache LALSimAdVirgo --H1-flow 20 --L1-flow 25 --V1-flow 30 --dataseed 1324 --approximant IMRPhenomPv2 --randomseed 1324 --margphi
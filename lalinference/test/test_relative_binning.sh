@@ -0,0 +1,14 @@
+#!/usr/bin/env bash
+
+# Exit with failure as soon as a test fails
+set -e
+
+# The 30+30 Msun injection of injection_standard.xml is the fiducial waveform
+inj="${LAL_TEST_SRCDIR:-.}/injection_standard.xml"
+
+echo "Testing BBH: IMRPhenomPv2, Gaussian likelihood"
+./LALInferenceRelativeBinningTest --inj "${inj}" --trigtime 441417609 --seglen 8 --srate 2048 --psdlength 1000 --psdstart 1 --ifo [H1,L1] --H1-channel LALSimAdLIGO --L1-channel LALSimAdLIGO --H1-cache LALSimAdLIGO --L1-cache LALSimAdLIGO --H1-flow 20 --L1-flow 20 --dataseed 1324 --approximant IMRPhenomPv2 --0noise --relative-binning --randomseed 1324
+
+echo "-------------------------------------------"
+echo "Testing BBH: IMRPhenomPv2, marginalised phase"
+./LALInferenceRelativeBinningTest --inj "${inj}" --trigtime 441417609 --seglen 8 --srate 2048 --psdlength 1000 --psdstart 1 --ifo [H1,L1] --H1-channel LALSimAdLIGO --L1-channel LALSimAdLIGO --H1-cache LALSimAdLIGO --L1-cache LALSimAdLIGO --H1-flow 20 --L1-flow 20 --dataseed 1324 --approximant IMRPhenomPv2 --0noise --relative-binning --randomseed 1324 --margphi
@@ -24,11 +24,13 @@
 #include <lal/LALConstants.h>
 #include <lal/LALgetopt.h>
 #include <lal/LALStdlib.h>
+#include <lal/LogPrintf.h>
 #include <lal/LALSimNeutronStar.h>
 
 int usage(const char *program);
 int parseargs(int argc, char *argv[]);
 int output(const char *fmt, double c, double m, double r, double w, double z, double k2); 
+int benchmark(void);
 
 /* global variables  */
 
@@ -46,6 +48,10 @@ double global_rho_c, global_e_c = 0;
 const long default_npts = 100;
 long global_npts;
 
+long global_benchmark = 0;
+int global_spectral = 0;
+double global_sdgamma[4];
+
 int main(int argc, char *argv[])
 {
     double logpmin = 75.5;
@@ -59,6 +65,13 @@ int main(int argc, char *argv[])
     global_fmt = default_fmt;
     parseargs(argc, argv);
 
+    if (global_benchmark > 0) {
+        XLAL_CHECK_MAIN(benchmark() == 0, XLAL_EFUNC);
+        XLALDestroySimNeutronStarEOS(global_eos);
+        LALCheckMemoryLeaks();
+        return 0;
+    }
+
     if (global_rho_c == 0 && global_e_c != 0)
     {
         logpmin = log(XLALSimNeutronStarEOSPressureOfEnergyDensity(global_e_c, global_eos));
@@ -119,6 +132,72 @@ int main(int argc, char *argv[])
     return 0;
 }
 
+/* times the construction of spectral decomposition EOS and of their
+ * mass, radius and tidal deformability curves */
+int benchmark(void)
+{
+    LALSimNeutronStarEOSSpectralWorkspace *ws;
+    double *pc, *r, *m, *k2;
+    double logpmin = 75.5;
+    double t0, t1;
+    long i, j;
+    int errnum = 0;
+
+    if (!global_spectral) {
+        fprintf(stderr, "error: benchmark requires a spectral decomposition EOS\n");
+        exit(1);
+    }
+
+    ws = XLALCreateSimNeutronStarEOSSpectralWorkspace();
+    pc = XLALMalloc(global_npts * sizeof(*pc));
+    r = XLALMalloc(global_npts * sizeof(*r));
+    m = XLALMalloc(global_npts * sizeof(*m));
+    k2 = XLALMalloc(global_npts * sizeof(*k2));
+    if (!ws || !pc || !r || !m || !k2) {
+        errnum = XLAL_ENOMEM;
+        goto done;
+    }
+
+    t0 = XLALGetTimeOfDay();
+    for (i = 0; i < global_benchmark; ++i) {
+        LALSimNeutronStarEOS *eos;
+        double logpmax, dlogp;
+        int status;
+        eos = XLALSimNeutronStarEOSSpectralDecompositionWithWorkspace(global_sdgamma, 4, ws);
+        if (!eos) {
+            errnum = XLAL_EFUNC;
+            goto done;
+        }
+        logpmax = log(XLALSimNeutronStarEOSMaxPressure(eos));
+        dlogp = (logpmax - logpmin) / global_npts;
+        for (j = 0; j < global_npts; ++j)
+            pc[j] = exp(logpmin + (0.5 + j) * dlogp);
+        status = XLALSimNeutronStarTOVODEIntegrateMany(r, m, k2, pc, global_npts, eos);
+        XLALDestroySimNeutronStarEOS(eos);
+        if (status != XLAL_SUCCESS) {
+            errnum = XLAL_EFUNC;
+            goto done;
+        }
+        for (j = 0; j < global_npts; ++j) {
+            double c = m[j] * LAL_MRSUN_SI / (LAL_MSUN_SI * r[j]);
+            k2[j] = (2.0 / 3.0) * k2[j] / pow(c, 5);
+        }
+    }
+    t1 = XLALGetTimeOfDay();
+
+    fprintf(stdout, "%ld curves of %ld stars in %g s: %g curves per second\n",
+        global_benchmark, global_npts, t1 - t0, global_benchmark / (t1 - t0));
+
+done:
+    XLALFree(k2);
+    XLALFree(m);
+    XLALFree(r);
+    XLALFree(pc);
+    XLALDestroySimNeutronStarEOSSpectralWorkspace(ws);
+    XLAL_CHECK(errnum == 0, errnum, "benchmark failed");
+    return 0;
+}
+
 int output(const char *fmt, double c, double m, double r, double w, double z, double k2)
 {
     int i;
@@ -229,9 +308,10 @@ int parseargs(int argc, char **argv)
         {"SDgamma1", required_argument, 0, 'x'},
         {"SDgamma2", required_argument, 0, 'y'},
         {"SDgamma3", required_argument, 0, 'z'},
+        {"benchmark", required_argument, 0, 'B'},
         {0, 0, 0, 0}
     };
-    char args[] = "hUE:f:n:d:e:F:N:PG:p:r:Qq:1:2:3:Sw:x:y:z:";
+    char args[] = "hUE:f:n:d:e:F:N:PG:p:r:Qq:1:2:3:Sw:x:y:z:B:";
 
     /* quantities for 1-piece polytrope: */
     int polytropeFlag = 0;
@@ -300,6 +380,13 @@ int parseargs(int argc, char **argv)
         case 'F':      /* format */
             global_fmt = LALoptarg;
             break;
+        case 'B':      /* benchmark */
+            global_benchmark = strtol(LALoptarg, NULL, 0);
+            if (global_benchmark < 1) {
+                fprintf(stderr, "invalid number of benchmark curves\n");
+                exit(1);
+            }
+            break;
         case 'N':      /* npts */
             global_npts = strtol(LALoptarg, NULL, 0);
             if (global_npts < 1) {
@@ -375,10 +462,16 @@ int parseargs(int argc, char **argv)
             gamma1, gamma2, gamma3);
 
     /* set eos to 4-coeff. spectral decomposition */
-    if (spectralFlag == 1)
+    if (spectralFlag == 1) {
         global_eos =
             XLALSimNeutronStarEOS4ParameterSpectralDecomposition(SDgamma0,
             SDgamma1, SDgamma2, SDgamma3);
+        global_spectral = 1;
+        global_sdgamma[0] = SDgamma0;
+        global_sdgamma[1] = SDgamma1;
+        global_sdgamma[2] = SDgamma2;
+        global_sdgamma[3] = SDgamma3;
+    }
 
     if (LALoptind < argc) {
         fprintf(stderr, "extraneous command line arguments:\n");
@@ -455,6 +548,8 @@ int usage(const char *program)
     fprintf(stderr,
         "\t-N NPTS, --npts=NPTS         \toutput NPTS points [%ld]\n",
         default_npts);
+    fprintf(stderr,
+        "\t-B NUM, --benchmark=NUM      \ttime NUM constructions of the spectral decomposition\n\t                             \tEOS and its NPTS-point mass-radius-tidal curve\n");
     fprintf(stderr,
         "\t-F FORMAT, --format=FORMAT   \toutput format FORMAT [\"%s\"]\n",
         default_fmt);
@@ -115,15 +115,30 @@ size_t numDetectors;
 int usage(const char *program);
 int parseargs(int argc, char **argv);
 
-int main(int argc, char *argv[])
+/* prints a chunk of the stream */
+static int output(REAL8TimeSeries **seg, size_t numDet, size_t n, void *data)
 {
 	char tstr[32]; // string to hold GPS time -- 31 characters is enough
+	size_t i, j;
+	(void)data;
+	for (j = 0; j < n; ++j) {
+		LIGOTimeGPS t = seg[0]->epoch;
+		printf("%s", XLALGPSToStr(tstr, XLALGPSAdd(&t, j * seg[0]->deltaT)));
+		for (i = 0; i < numDet; ++i)
+			printf("\t%.18e", seg[i]->data->data[j]);
+		printf("\n");
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
 	const double H0 = 0.72 * LAL_H0FAC_SI; // Hubble's constant in seconds
 	const size_t length = 65536; // number of points in a segment
-	const size_t stride = length / 2; // number of points in a stride
 	size_t i, n;
 	REAL8FrequencySeries *OmegaGW = NULL;
 	REAL8TimeSeries **seg = NULL;
+	LALSimSGWBMixing *mix = NULL;
 	LIGOTimeGPS epoch;
 	gsl_rng *rng;
 
@@ -162,25 +177,12 @@ int main(int argc, char *argv[])
 	}
 	printf("\n");
 
-	XLALSimSGWB(seg, detectors, numDetectors, 0, OmegaGW, H0, rng); // first time to initilize
-
-	while (1) { // infinite loop
-		size_t j;
-		for (j = 0; j < stride; ++j, --n) { // output first stride points
-			LIGOTimeGPS t = seg[0]->epoch;
-			if (n == 0) // check if we're done
-				goto end;
-			printf("%s", XLALGPSToStr(tstr, XLALGPSAdd(&t, j * seg[0]->deltaT)));
-			for (i = 0; i < numDetectors; ++i)
-				printf("\t%.18e", seg[i]->data->data[j]);
-			printf("\n");
-		}
-		XLALSimSGWB(seg, detectors, numDetectors, stride, OmegaGW, H0, rng); // make more data
-	}
+	mix = XLALSimSGWBCreateMixing(detectors, numDetectors, OmegaGW->deltaF, OmegaGW->data->length);
+	XLALSimSGWBStream(seg, mix, n, OmegaGW, H0, rng, output, NULL);
 
-end:
 	for (i = 0; i < numDetectors; ++i)
 		XLALDestroyREAL8TimeSeries(seg[i]);
+	XLALSimSGWBDestroyMixing(mix);
 	XLALFree(seg);
 	XLALDestroyREAL8FrequencySeries(OmegaGW);
 	LALCheckMemoryLeaks();
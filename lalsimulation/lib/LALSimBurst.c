@@ -30,6 +30,7 @@
 #include <math.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
+#include <lal/AVFactories.h>
 #include <lal/LALConstants.h>
 #include <lal/LALDatatypes.h>
 #include <lal/LALError.h>
@@ -1275,6 +1276,481 @@ int XLALSimBurstGaussian(
 }
 
 
+/*
+ * ============================================================================
+ *
+ *                   Frequency-Domain Sine-Gaussian Banks
+ *
+ * ============================================================================
+ */
+
+
+/*
+ * evaluate one template of a bank on its support.  the Fourier transform
+ * of a Gaussian envelope of width sigma_t multiplied by cos(2 pi f0 t -
+ * phase) is A/2 [exp(-i phase) G(f - f0) + exp(i phase) G(f + f0)] with
+ * G(f) = sqrt(2 pi) sigma_t exp(-2 pi^2 sigma_t^2 f^2), and likewise for
+ * the sine-like component;  the "image" at -f0 is kept so that the result
+ * is the exact transform also for low Q.  hplus_amp and hcross_amp include
+ * the factor sqrt(2 pi) sigma_t / 2.  the loop has no branches so that it
+ * vectorizes.
+ */
+
+
+static void fd_bank_fill_template(COMPLEX16 *hp, COMPLEX16 *hc, UINT4 n, UINT4 first_bin, double delta_f, double sigma_t, double centre_frequency, double hplus_amp, double hcross_amp, double phase)
+{
+	const double a = -2.0 * LAL_PI * LAL_PI * sigma_t * sigma_t;
+	const double cp = cos(phase);
+	const double sp = sin(phase);
+	UINT4 j;
+
+#pragma omp simd
+	for(j = 0; j < n; j++) {
+		const double f = (first_bin + j) * delta_f;
+		const double fm = f - centre_frequency;
+		const double fp = f + centre_frequency;
+		const double e1 = exp(a * fm * fm);
+		const double e2 = exp(a * fp * fp);
+		hp[j] = crect(hplus_amp * cp * (e1 + e2), hplus_amp * sp * (e2 - e1));
+		hc[j] = crect(-hcross_amp * sp * (e1 + e2), -hcross_amp * cp * (e1 - e2));
+	}
+}
+
+
+/*
+ * build a bank from the per-template Gaussian widths, centre frequencies,
+ * time-domain peak amplitudes and phases.  the support of each template is
+ * the contiguous range of bins in [0, f_max] where the Gaussian envelope
+ * about the centre frequency is above threshold times its peak value.
+ */
+
+
+static LALSimBurstFDBank *fd_bank_create(UINT4 length, const double *sigma_t, const double *centre_frequency, const double *h0plus, const double *h0cross, const double *phase, double delta_f, double f_max, double threshold)
+{
+	/* half-width of the support in units of the frequency-domain
+	 * standard deviation 1 / (2 pi sigma_t) */
+	const double nsigma = sqrt(-2.0 * log(threshold));
+	const UINT4 max_bin = (UINT4) floor(f_max / delta_f);
+	LALSimBurstFDBank *bank;
+	UINT8 total = 0;
+	UINT4 k;
+
+	bank = XLALCalloc(1, sizeof(*bank));
+	if(!bank)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	bank->deltaF = delta_f;
+	bank->length = length;
+	bank->first_bin = XLALCreateUINT4Vector(length);
+	bank->offset = XLALCreateUINT4Vector(length + 1);
+	if(!bank->first_bin || !bank->offset) {
+		XLALSimBurstDestroyFDBank(bank);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	/* pass 1:  the support of each template, and the offsets of the
+	 * packed rows */
+
+	for(k = 0; k < length; k++) {
+		const double half_width = nsigma / (LAL_TWOPI * sigma_t[k]);
+		const double lo = fmax(ceil((centre_frequency[k] - half_width) / delta_f), 0.0);
+		const double hi = fmin(floor((centre_frequency[k] + half_width) / delta_f), max_bin);
+		bank->offset->data[k] = total;
+		if(hi >= lo) {
+			bank->first_bin->data[k] = (UINT4) lo;
+			total += (UINT8) (hi - lo) + 1;
+		} else
+			bank->first_bin->data[k] = 0;
+		if(total > LAL_UINT4_MAX) {
+			XLALPrintError("%s(): bank too large for 32 bit offsets\n", __func__);
+			XLALSimBurstDestroyFDBank(bank);
+			XLAL_ERROR_NULL(XLAL_EINVAL);
+		}
+	}
+	bank->offset->data[length] = total;
+
+	bank->hplus = XLALCreateCOMPLEX16Vector(total);
+	bank->hcross = XLALCreateCOMPLEX16Vector(total);
+	if(!bank->hplus || !bank->hcross) {
+		XLALSimBurstDestroyFDBank(bank);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	}
+
+	/* pass 2:  populate.  templates are independent, and their
+	 * support lengths vary, so schedule dynamically */
+
+#pragma omp parallel for schedule(dynamic, 64)
+	for(k = 0; k < length; k++) {
+		const UINT4 offset = bank->offset->data[k];
+		const double fac = sqrt(LAL_TWOPI) * sigma_t[k] / 2.0;
+		fd_bank_fill_template(bank->hplus->data + offset, bank->hcross->data + offset, bank->offset->data[k + 1] - offset, bank->first_bin->data[k], delta_f, sigma_t[k], centre_frequency[k], h0plus[k] * fac, h0cross[k] * fac, phase[k]);
+	}
+
+	return bank;
+}
+
+
+/**
+ * @brief Generate a bank of sine-Gaussian waveforms directly in the
+ * frequency domain.
+ *
+ * @details
+ * Template k is the exact Fourier transform of the waveform
+ * XLALSimBurstSineGaussian() generates for Q->data[k],
+ * centre_frequency->data[k], hrss->data[k], eccentricity->data[k] and
+ * phase->data[k], without the time boundaries and the tapering window;
+ * the Gaussian envelope peaks at t = 0.  The Fourier transform convention
+ * is \f$\tilde{h}(f) = \int h(t) \ee^{-2 \pi \aye f t} \diff t\f$.
+ *
+ * Instead of one pair of frequency series per template, only the
+ * frequency bins where the Gaussian envelope exceeds threshold times its
+ * peak are evaluated and stored, packed one template after the other in a
+ * LALSimBurstFDBank.  For \f$Q \gtrsim 3\f$ this is a small fraction of
+ * the band, so that generating and applying banks of \f$10^{5}\f$ or more
+ * sine-Gaussians, e.g. with XLALSimBurstFDBankInnerProducts(), is cheap.
+ * The templates are evaluated in parallel when OpenMP is available.
+ *
+ * @param[in] Q The "Q"s of the templates.
+ *
+ * @param[in] centre_frequency The centre frequencies of the templates in
+ * Hertz.
+ *
+ * @param[in] hrss The \f$h_{\mathrm{rss}}\f$s of the templates.
+ *
+ * @param[in] eccentricity The eccentricities of the polarization ellipses
+ * of the templates; see XLALSimBurstSineGaussian().
+ *
+ * @param[in] phase The phases of the templates; see
+ * XLALSimBurstSineGaussian().
+ *
+ * @param[in] delta_f Frequency resolution of the bank in Hertz.
+ *
+ * @param[in] f_max Frequency above which the templates are not evaluated,
+ * e.g. the Nyquist frequency, in Hertz.
+ *
+ * @param[in] threshold Relative amplitude, in (0, 1), below which
+ * frequency bins are omitted from the templates' support, e.g. 1e-8.
+ *
+ * @returns Pointer to the newly allocated bank, or NULL on failure.
+ *
+ * See also:  XLALSimBurstGaussianFDBank(), XLALSimBurstDestroyFDBank()
+ */
+
+
+LALSimBurstFDBank *XLALSimBurstSineGaussianFDBank(
+	const REAL8Sequence *Q,
+	const REAL8Sequence *centre_frequency,
+	const REAL8Sequence *hrss,
+	const REAL8Sequence *eccentricity,
+	const REAL8Sequence *phase,
+	REAL8 delta_f,
+	REAL8 f_max,
+	REAL8 threshold
+)
+{
+	LALSimBurstFDBank *bank = NULL;
+	double *sigma_t = NULL, *h0plus = NULL, *h0cross = NULL;
+	UINT4 length, k;
+
+	/* check input. */
+
+	XLAL_CHECK_NULL(Q && centre_frequency && hrss && eccentricity && phase, XLAL_EFAULT);
+	length = Q->length;
+	XLAL_CHECK_NULL(centre_frequency->length == length && hrss->length == length && eccentricity->length == length && phase->length == length, XLAL_EBADLEN);
+	XLAL_CHECK_NULL(delta_f > 0 && f_max > 0 && threshold > 0 && threshold < 1, XLAL_EINVAL);
+	for(k = 0; k < length; k++)
+		if(!(Q->data[k] > 0) || !(centre_frequency->data[k] > 0) || hrss->data[k] < 0 || eccentricity->data[k] < 0 || eccentricity->data[k] > 1)
+			XLAL_ERROR_NULL(XLAL_EINVAL, "invalid parameters for template %u", k);
+
+	/* Gaussian widths and peak amplitudes, normalized as in
+	 * XLALSimBurstSineGaussian() */
+
+	sigma_t = XLALMalloc(length * sizeof(*sigma_t));
+	h0plus = XLALMalloc(length * sizeof(*h0plus));
+	h0cross = XLALMalloc(length * sizeof(*h0cross));
+	if(length && (!sigma_t || !h0plus || !h0cross)) {
+		XLALFree(sigma_t);
+		XLALFree(h0plus);
+		XLALFree(h0cross);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+	for(k = 0; k < length; k++) {
+		const double q = Q->data[k];
+		const double f0 = centre_frequency->data[k];
+		const double cgsq = q / (4.0 * f0 * sqrt(LAL_PI)) * (1.0 + exp(-q * q));
+		const double sgsq = q / (4.0 * f0 * sqrt(LAL_PI)) * (1.0 - exp(-q * q));
+		const double cosphase = cos(phase->data[k]);
+		const double sinphase = sin(phase->data[k]);
+		double a, b;
+		semi_major_minor_from_e(eccentricity->data[k], &a, &b);
+		sigma_t[k] = q / (LAL_TWOPI * f0);
+		h0plus[k] = hrss->data[k] * a / sqrt(cgsq * cosphase * cosphase + sgsq * sinphase * sinphase);
+		h0cross[k] = hrss->data[k] * b / sqrt(cgsq * sinphase * sinphase + sgsq * cosphase * cosphase);
+	}
+
+	bank = fd_bank_create(length, sigma_t, centre_frequency->data, h0plus, h0cross, phase->data, delta_f, f_max, threshold);
+
+	XLALFree(sigma_t);
+	XLALFree(h0plus);
+	XLALFree(h0cross);
+	if(!bank)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	return bank;
+}
+
+
+/**
+ * @brief Generate a bank of Gaussian waveforms directly in the frequency
+ * domain.
+ *
+ * @details
+ * Template k is the exact Fourier transform of the waveform
+ * XLALSimBurstGaussian() generates for duration->data[k] and
+ * hrss->data[k], without the time boundaries and the tapering window,
+ * \f{equation}{
+ * \tilde{h}_{+}(f)
+ *    = \frac{h_{\mathrm{rss}}}{\sqrt{\sqrt{\pi} \Delta t}} \sqrt{2 \pi} \Delta t \ee^{-2 \pi^{2} \Delta t^{2} f^{2}},
+ * \f}
+ * and \f$\tilde{h}_{\times} = 0\f$.  The bank is stored as described in
+ * XLALSimBurstSineGaussianFDBank().
+ *
+ * @param[in] duration The widths of the Gaussians in seconds.
+ *
+ * @param[in] hrss The \f$h_{\mathrm{rss}}\f$s of the templates.
+ *
+ * @param[in] delta_f Frequency resolution of the bank in Hertz.
+ *
+ * @param[in] f_max Frequency above which the templates are not evaluated
+ * in Hertz.
+ *
+ * @param[in] threshold Relative amplitude, in (0, 1), below which
+ * frequency bins are omitted from the templates' support.
+ *
+ * @returns Pointer to the newly allocated bank, or NULL on failure.
+ */
+
+
+LALSimBurstFDBank *XLALSimBurstGaussianFDBank(
+	const REAL8Sequence *duration,
+	const REAL8Sequence *hrss,
+	REAL8 delta_f,
+	REAL8 f_max,
+	REAL8 threshold
+)
+{
+	LALSimBurstFDBank *bank = NULL;
+	double *zeros = NULL, *h0plus = NULL;
+	UINT4 length, k;
+
+	/* check input. */
+
+	XLAL_CHECK_NULL(duration && hrss, XLAL_EFAULT);
+	length = duration->length;
+	XLAL_CHECK_NULL(hrss->length == length, XLAL_EBADLEN);
+	XLAL_CHECK_NULL(delta_f > 0 && f_max > 0 && threshold > 0 && threshold < 1, XLAL_EINVAL);
+	for(k = 0; k < length; k++)
+		if(!(duration->data[k] > 0) || hrss->data[k] < 0)
+			XLAL_ERROR_NULL(XLAL_EINVAL, "invalid parameters for template %u", k);
+
+	/* a Gaussian is a sine-Gaussian with 0 centre frequency and phase
+	 * and no cross polarization;  the two terms of the transform then
+	 * coincide */
+
+	zeros = XLALCalloc(length, sizeof(*zeros));
+	h0plus = XLALMalloc(length * sizeof(*h0plus));
+	if(length && (!zeros || !h0plus)) {
+		XLALFree(zeros);
+		XLALFree(h0plus);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+	for(k = 0; k < length; k++)
+		h0plus[k] = hrss->data[k] / sqrt(sqrt(LAL_PI) * duration->data[k]);
+
+	bank = fd_bank_create(length, duration->data, zeros, h0plus, zeros, zeros, delta_f, f_max, threshold);
+
+	XLALFree(zeros);
+	XLALFree(h0plus);
+	if(!bank)
+		XLAL_ERROR_NULL(XLAL_EFUNC);
+	return bank;
+}
+
+
+/**
+ * @brief Free a bank created by XLALSimBurstSineGaussianFDBank() or
+ * XLALSimBurstGaussianFDBank().
+ */
+
+
+void XLALSimBurstDestroyFDBank(LALSimBurstFDBank *bank)
+{
+	if(!bank)
+		return;
+	XLALDestroyUINT4Vector(bank->first_bin);
+	XLALDestroyUINT4Vector(bank->offset);
+	XLALDestroyCOMPLEX16Vector(bank->hplus);
+	XLALDestroyCOMPLEX16Vector(bank->hcross);
+	XLALFree(bank);
+}
+
+
+/**
+ * @brief Expand one template of a frequency-domain bank into frequency
+ * series.
+ *
+ * @details
+ * The frequency series start at 0 Hz, have the bank's resolution and the
+ * given length, and are 0 outside of the template's support.
+ *
+ * @param[out] hplus Address of a COMPLEX16FrequencySeries pointer to be
+ * set to the address of the newly allocated \f$\tilde{h}_{+}\f$.
+ *
+ * @param[out] hcross Address of a COMPLEX16FrequencySeries pointer to be
+ * set to the address of the newly allocated \f$\tilde{h}_{\times}\f$.
+ *
+ * @param[in] bank The bank.
+ *
+ * @param[in] index The index of the template in the bank.
+ *
+ * @param[in] length The number of frequency bins of the output.
+ *
+ * @retval 0 Success
+ * @retval <0 Failure
+ */
+
+
+int XLALSimBurstFDBankTemplate(
+	COMPLEX16FrequencySeries **hplus,
+	COMPLEX16FrequencySeries **hcross,
+	const LALSimBurstFDBank *bank,
+	UINT4 index,
+	UINT4 length
+)
+{
+	LIGOTimeGPS epoch = LIGOTIMEGPSZERO;
+	UINT4 first, n, j;
+
+	XLAL_CHECK(hplus && hcross && bank, XLAL_EFAULT);
+	XLAL_CHECK(index < bank->length, XLAL_EDOM);
+
+	*hplus = XLALCreateCOMPLEX16FrequencySeries("sine-Gaussian +", &epoch, 0.0, bank->deltaF, &lalStrainUnit, length);
+	*hcross = XLALCreateCOMPLEX16FrequencySeries("sine-Gaussian x", &epoch, 0.0, bank->deltaF, &lalStrainUnit, length);
+	if(!*hplus || !*hcross) {
+		XLALDestroyCOMPLEX16FrequencySeries(*hplus);
+		XLALDestroyCOMPLEX16FrequencySeries(*hcross);
+		*hplus = *hcross = NULL;
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+	memset((*hplus)->data->data, 0, length * sizeof(*(*hplus)->data->data));
+	memset((*hcross)->data->data, 0, length * sizeof(*(*hcross)->data->data));
+
+	first = bank->first_bin->data[index];
+	n = bank->offset->data[index + 1] - bank->offset->data[index];
+	for(j = 0; j < n && first + j < length; j++) {
+		(*hplus)->data->data[first + j] = bank->hplus->data[bank->offset->data[index] + j];
+		(*hcross)->data->data[first + j] = bank->hcross->data[bank->offset->data[index] + j];
+	}
+
+	return 0;
+}
+
+
+/**
+ * @brief Compute the inner products of the templates of a frequency-domain
+ * bank with data.
+ *
+ * @details
+ * For each template k computes
+ * \f{equation}{
+ * \langle h_{k} | d \rangle
+ *    = 4 \Delta f \sum_{f} \frac{\conj{\tilde{h}_{k}(f)} \tilde{d}(f)}{S(f)}
+ * \f}
+ * for \f$h_{k} = h_{+}\f$ and \f$h_{\times}\f$, summed over the support
+ * of the template only, so that the cost is proportional to the number of
+ * stored bins rather than to the number of templates times the length of
+ * the data.  Templates are processed in parallel when OpenMP is available.
+ * Bins of a template outside of the frequency range of the data are
+ * ignored.
+ *
+ * @param[out] plus The inner products with \f$\tilde{h}_{+}\f$;  must
+ * have the bank's length.
+ *
+ * @param[out] cross The inner products with \f$\tilde{h}_{\times}\f$;
+ * must have the bank's length.
+ *
+ * @param[in] bank The bank.
+ *
+ * @param[in] data The data, with the bank's frequency resolution.
+ *
+ * @param[in] psd The one-sided noise power spectral density with the
+ * bank's frequency resolution, or NULL for \f$S(f) = 1\f$.
+ *
+ * @retval 0 Success
+ * @retval <0 Failure
+ */
+
+
+int XLALSimBurstFDBankInnerProducts(
+	COMPLEX16Vector *plus,
+	COMPLEX16Vector *cross,
+	const LALSimBurstFDBank *bank,
+	const COMPLEX16FrequencySeries *data,
+	const REAL8FrequencySeries *psd
+)
+{
+	INT8 data_first, psd_first = 0;
+	UINT4 k;
+
+	XLAL_CHECK(plus && cross && bank && data, XLAL_EFAULT);
+	XLAL_CHECK(plus->length == bank->length && cross->length == bank->length, XLAL_EBADLEN);
+	XLAL_CHECK(fabs(data->deltaF - bank->deltaF) <= 1e-9 * bank->deltaF, XLAL_EINVAL, "data frequency resolution differs from the bank's");
+	data_first = llround(data->f0 / bank->deltaF);
+	if(psd) {
+		XLAL_CHECK(fabs(psd->deltaF - bank->deltaF) <= 1e-9 * bank->deltaF, XLAL_EINVAL, "PSD frequency resolution differs from the bank's");
+		psd_first = llround(psd->f0 / bank->deltaF);
+	}
+
+#pragma omp parallel for schedule(dynamic, 64)
+	for(k = 0; k < bank->length; k++) {
+		const COMPLEX16 *hp = bank->hplus->data + bank->offset->data[k];
+		const COMPLEX16 *hc = bank->hcross->data + bank->offset->data[k];
+		const INT8 first = bank->first_bin->data[k];
+		INT8 lo = first;
+		INT8 hi = first + bank->offset->data[k + 1] - bank->offset->data[k];
+		double pr = 0, pi = 0, cr = 0, ci = 0;
+		INT8 i;
+
+		/* restrict to the bins covered by the data and the PSD */
+		if(lo < data_first)
+			lo = data_first;
+		if(hi > data_first + data->data->length)
+			hi = data_first + data->data->length;
+		if(psd) {
+			if(lo < psd_first)
+				lo = psd_first;
+			if(hi > psd_first + psd->data->length)
+				hi = psd_first + psd->data->length;
+		}
+
+#pragma omp simd reduction(+:pr,pi,cr,ci)
+		for(i = lo; i < hi; i++) {
+			const COMPLEX16 d = data->data->data[i - data_first];
+			const double w = psd ? 1.0 / psd->data->data[i - psd_first] : 1.0;
+			const COMPLEX16 x = conj(hp[i - first]) * d * w;
+			const COMPLEX16 y = conj(hc[i - first]) * d * w;
+			pr += creal(x);
+			pi += cimag(x);
+			cr += creal(y);
+			ci += cimag(y);
+		}
+
+		plus->data[k] = crect(4.0 * bank->deltaF * pr, 4.0 * bank->deltaF * pi);
+		cross->data[k] = crect(4.0 * bank->deltaF * cr, 4.0 * bank->deltaF * ci);
+	}
+
+	return 0;
+}
+
+
 /*
  * ============================================================================
  *
@@ -31,7 +31,9 @@
  * Also included are several general-purpose routines to measure the
  * properties of gravitational wave waveforms like the "hrss" and peak
  * strain.  These are useful for imposing normalizations and other
- * diagnostic activities.
+ * diagnostic activities.  Banks of sine-Gaussian and Gaussian waveforms
+ * can also be generated directly in the frequency domain, stored on their
+ * sparse frequency support.
  *
  * \f[
  * \DeclareMathOperator{\order}{O}
@@ -67,16 +69,48 @@ extern "C" {
 } /* so that editors will match preceding brace */
 #endif
 
+/** @{ */
+
+
 /*
  * ============================================================================
  *
- *                            Function Prototypes
+ *                                 Data Types
  *
  * ============================================================================
  */
 
 
-/** @{ */
+/**
+ * @brief A bank of frequency-domain burst waveforms stored on their sparse
+ * frequency support.
+ *
+ * @details
+ * Template k is non-zero only on the contiguous frequency bins
+ * first_bin->data[k], ..., first_bin->data[k] + n_k - 1 with n_k =
+ * offset->data[k + 1] - offset->data[k], and its values on those bins are
+ * hplus->data[offset->data[k]], ..., hplus->data[offset->data[k + 1] - 1]
+ * (likewise for hcross).  This is a compressed sparse row matrix with one
+ * row per template whose column indices are implicit.
+ */
+typedef struct tagLALSimBurstFDBank {
+	REAL8 deltaF;			/**< frequency resolution in Hertz */
+	UINT4 length;			/**< number of templates */
+	UINT4Vector *first_bin;		/**< index of the first stored frequency bin of each template */
+	UINT4Vector *offset;		/**< start of each template in hplus and hcross;  length + 1 entries */
+	COMPLEX16Vector *hplus;		/**< packed \f$\tilde{h}_{+}\f$ of all templates */
+	COMPLEX16Vector *hcross;	/**< packed \f$\tilde{h}_{\times}\f$ of all templates */
+} LALSimBurstFDBank;
+
+
+/*
+ * ============================================================================
+ *
+ *                            Function Prototypes
+ *
+ * ============================================================================
+ */
+
 
 
 int XLALGenerateImpulseBurst(
@@ -173,6 +207,48 @@ int XLALSimBurstGaussian(
 	REAL8 delta_t
 );
 
+
+LALSimBurstFDBank *XLALSimBurstSineGaussianFDBank(
+	const REAL8Sequence *Q,
+	const REAL8Sequence *centre_frequency,
+	const REAL8Sequence *hrss,
+	const REAL8Sequence *eccentricity,
+	const REAL8Sequence *phase,
+	REAL8 delta_f,
+	REAL8 f_max,
+	REAL8 threshold
+);
+
+
+LALSimBurstFDBank *XLALSimBurstGaussianFDBank(
+	const REAL8Sequence *duration,
+	const REAL8Sequence *hrss,
+	REAL8 delta_f,
+	REAL8 f_max,
+	REAL8 threshold
+);
+
+
+void XLALSimBurstDestroyFDBank(LALSimBurstFDBank *bank);
+
+
+int XLALSimBurstFDBankTemplate(
+	COMPLEX16FrequencySeries **hplus,
+	COMPLEX16FrequencySeries **hcross,
+	const LALSimBurstFDBank *bank,
+	UINT4 index,
+	UINT4 length
+);
+
+
+int XLALSimBurstFDBankInnerProducts(
+	COMPLEX16Vector *plus,
+	COMPLEX16Vector *cross,
+	const LALSimBurstFDBank *bank,
+	const COMPLEX16FrequencySeries *data,
+	const REAL8FrequencySeries *psd
+);
+
 int XLALSimBurstImg(
 	REAL8TimeSeries **hplus,
 	REAL8TimeSeries **hcross, 
@@ -58,6 +58,7 @@ extern "C" {
  * @defgroup LALSimPrecessingNRSur_c             LALSimIMRPrecessingNRSur.c
  * @defgroup LALSimIMRNRWaveforms_c              LALSimIMRNRWaveforms.c
  * @defgroup LALSimIMRTEOBResumS_c               LALSimIMRTEOBResumS.c
+ * @defgroup LALSimIMRMultiband_c                LALSimIMRMultiband.c
  * @}
  *
  * @addtogroup LALSimIMR_h
@@ -148,6 +149,7 @@ double XLALSimNSBH_torus_mass_fit(const REAL8 q, const REAL8 a, const REAL8 C);
 
 /* in module LALSimIMRPhenomD.c */
 int XLALSimIMRPhenomDGenerateFD(COMPLEX16FrequencySeries **htilde, const REAL8 phi0, const REAL8 fRef, const REAL8 deltaF, const REAL8 m1_SI, const REAL8 m2_SI, const REAL8 chi1, const REAL8 chi2, const REAL8 f_min, const REAL8 f_max, const REAL8 distance, LALDict *extraParams, NRTidal_version_type NRTidal_version);
+int XLALSimIMRPhenomDGenerateFDCOMPLEX8(COMPLEX8FrequencySeries **hptilde, COMPLEX8FrequencySeries **hctilde, const REAL8 phi0, const REAL8 fRef, const REAL8 deltaF, const REAL8 m1_SI, const REAL8 m2_SI, const REAL8 chi1, const REAL8 chi2, const REAL8 f_min, const REAL8 f_max, const REAL8 distance, const COMPLEX16 plusFactor, const COMPLEX16 crossFactor, LALDict *extraParams, NRTidal_version_type NRTidal_version);
 int XLALSimIMRPhenomDFrequencySequence(COMPLEX16FrequencySeries **htilde, const REAL8Sequence *freqs, const REAL8 phi0, const REAL8 fRef_in, const REAL8 m1_SI, const REAL8 m2_SI, const REAL8 chi1, const REAL8 chi2, const REAL8 distance, LALDict *extraParams, NRTidal_version_type NRTidal_version);
 double XLALIMRPhenomDGetPeakFreq(const REAL8 m1_in, const REAL8 m2_in, const REAL8 chi1_in, const REAL8 chi2_in);
 double XLALSimIMRPhenomDChirpTime(const REAL8 m1_in, const REAL8 m2_in, const REAL8 chi1_in, const REAL8 chi2_in, const REAL8 fHz);
@@ -167,8 +169,14 @@ SphHarmTimeSeries *XLALSimIMREOBNRv2Modes(const REAL8 deltaT, const REAL8 m1, co
 
 /* in module LALSimIMRSpinAlignedEOB.c */
 
+/** Reusable buffers for the spin-aligned EOB models; one per thread */
+typedef struct tagLALSimIMRSpinAlignedEOBWorkspace LALSimIMRSpinAlignedEOBWorkspace;
+
+LALSimIMRSpinAlignedEOBWorkspace *XLALSimIMRSpinAlignedEOBWorkspaceCreate(void);
+void XLALSimIMRSpinAlignedEOBWorkspaceDestroy(LALSimIMRSpinAlignedEOBWorkspace *ws);
 double XLALSimIMRSpinAlignedEOBPeakFrequency(REAL8 m1SI, REAL8 m2SI, const REAL8 spin1z, const REAL8 spin2z, UINT4 SpinAlignedEOBversion);
 int XLALSimIMRSpinAlignedEOBWaveform(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, const REAL8 phiC, REAL8 deltaT, const REAL8 m1SI, const REAL8 m2SI, const REAL8 fMin, const REAL8 r, const REAL8 inc, const REAL8 spin1z, const REAL8 spin2z, UINT4 SpinAlignedEOBversion, LALDict *LALparams);
+int XLALSimIMRSpinAlignedEOBWaveformWithWorkspace(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, const REAL8 phiC, REAL8 deltaT, const REAL8 m1SI, const REAL8 m2SI, const REAL8 fMin, const REAL8 r, const REAL8 inc, const REAL8 spin1z, const REAL8 spin2z, UINT4 SpinAlignedEOBversion, LALDict *LALparams, LALSimIMRSpinAlignedEOBWorkspace *workspace);
 int XLALSimIMRSpinAlignedEOBWaveformAll(
     REAL8TimeSeries **hplus,
     REAL8TimeSeries **hcross,
@@ -197,6 +205,35 @@ int XLALSimIMRSpinAlignedEOBWaveformAll(
     LALValue *ModeArray,
     LALDict *TGRParams
 );
+int XLALSimIMRSpinAlignedEOBWaveformAllWithWorkspace(
+    REAL8TimeSeries **hplus,
+    REAL8TimeSeries **hcross,
+    const REAL8 phiC,
+    REAL8 deltaT,
+    const REAL8 m1SI,
+    const REAL8 m2SI,
+    const REAL8 fMin,
+    const REAL8 r,
+    const REAL8 inc,
+    const REAL8 spin1z,
+    const REAL8 spin2z,
+    UINT4 SpinAlignedEOBversion,
+    const REAL8 lambda2Tidal1,
+    const REAL8 lambda2Tidal2,
+    const REAL8 omega02Tidal1,
+    const REAL8 omega02Tidal2,
+    const REAL8 lambda3Tidal1,
+    const REAL8 lambda3Tidal2,
+    const REAL8 omega03Tidal1,
+    const REAL8 omega03Tidal2,
+    const REAL8 quadparam1,
+    const REAL8 quadparam2,
+    REAL8Vector *nqcCoeffsInput,
+    const INT4 nqcFlag,
+    LALValue *ModeArray,
+    LALDict *TGRParams,
+    LALSimIMRSpinAlignedEOBWorkspace *workspace
+);
 int XLALSimIMRSpinAlignedEOBModes(
     SphHarmTimeSeries ** hlmmode, //SM
     REAL8Vector ** dynamics_out, /**<< OUTPUT, low-sampling dynamics */
@@ -224,6 +261,34 @@ int XLALSimIMRSpinAlignedEOBModes(
     LALDict *PAParams,
     LALDict *TGRParams
 );
+int XLALSimIMRSpinAlignedEOBModesWithWorkspace(
+    SphHarmTimeSeries ** hlmmode, //SM
+    REAL8Vector ** dynamics_out, /**<< OUTPUT, low-sampling dynamics */
+    REAL8Vector ** dynamicsHi_out, /**<< OUTPUT, high-sampling dynamics */ //SM
+    REAL8 deltaT,
+    const REAL8 m1SI,
+    const REAL8 m2SI,
+    const REAL8 fMin,
+    const REAL8 r,
+    const REAL8 spin1z,
+    const REAL8 spin2z,
+    UINT4 SpinAlignedEOBversion,
+    const REAL8 lambda2Tidal1,
+    const REAL8 lambda2Tidal2,
+    const REAL8 omega02Tidal1,
+    const REAL8 omega02Tidal2,
+    const REAL8 lambda3Tidal1,
+    const REAL8 lambda3Tidal2,
+    const REAL8 omega03Tidal1,
+    const REAL8 omega03Tidal2,
+    const REAL8 quadparam1,
+    const REAL8 quadparam2,
+    REAL8Vector *nqcCoeffsInput,
+    const INT4 nqcFlag,
+    LALDict *PAParams,
+    LALDict *TGRParams,
+    LALSimIMRSpinAlignedEOBWorkspace *workspace
+);
 /*int XLALSimIMRSpinEOBWaveform(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, const REAL8 phiC, const REAL8 deltaT, const REAL8 m1SI, const REAL8 m2SI, const REAL8 fMin, const REAL8 r, const REAL8 inc, const REAL8 spin1[], const REAL8 spin2[]);
  */
 
@@ -477,6 +542,24 @@ int XLALSimIMRPhenomXASGenerateFD(COMPLEX16FrequencySeries **htilde22,
   LALDict *lalParams
 );
 
+int XLALSimIMRPhenomXASGenerateFDCOMPLEX8(
+  COMPLEX8FrequencySeries **hptilde,
+  COMPLEX8FrequencySeries **hctilde,
+  REAL8 m1_SI,
+  REAL8 m2_SI,
+  REAL8 chi1L,
+  REAL8 chi2L,
+  REAL8 distance,
+  REAL8 f_min,
+  REAL8 f_max,
+  REAL8 deltaF,
+  REAL8 phiRef,
+  REAL8 fRef_In,
+  COMPLEX16 plusFactor,
+  COMPLEX16 crossFactor,
+  LALDict *lalParams
+);
+
 int XLALSimIMRPhenomXASFrequencySequence(
   COMPLEX16FrequencySeries **htilde22,
   const REAL8Sequence *freqs,
@@ -670,6 +753,23 @@ int XLALSimIMRPhenomXHM(
    LALDict *lalParams                  /**<linked list containing the extra testing GR parameters */
 );
 
+int XLALSimIMRPhenomXHMCOMPLEX8(
+   COMPLEX8FrequencySeries **hptilde,  /**< [out] Frequency-domain waveform h+ */
+   COMPLEX8FrequencySeries **hctilde,  /**< [out] Frequency-domain waveform hx */
+   REAL8 m1_SI,                        /**< mass of companion 1 (kg) */
+   REAL8 m2_SI,                        /**< mass of companion 2 (kg) */
+   REAL8 chi1z,                        /**< z-component of the dimensionless spin of object 1 w.r.t. Lhat = (0,0,1) */
+   REAL8 chi2z,                        /**< z-component of the dimensionless spin of object 2 w.r.t. Lhat = (0,0,1) */
+   REAL8 f_min,                        /**< Starting GW frequency (Hz) */
+   REAL8 f_max,                        /**< End frequency; 0 defaults to Mf = 0.3 */
+   REAL8 deltaF,                       /**< Sampling frequency (Hz) */
+   REAL8 distance,                     /**< distance of source (m) */
+   REAL8 inclination,                  /**< inclination of source (rad) */
+   REAL8 phiRef,                       /**< reference orbital phase (rad) */
+   REAL8 fRef_In,                      /**< Reference frequency */
+   LALDict *lalParams                  /**<linked list containing the extra testing GR parameters */
+);
+
 
 int XLALSimIMRPhenomXHM2(
   COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency domain h+ GW strain */
@@ -1434,6 +1534,27 @@ SphHarmTimeSeries *XLALSimInspiralPrecessingNRSurModes(
         Approximant approximant     /**< approximant (NRSur7dq2 or NRSur7dq4) */
 );
 
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALSimInspiralPrecessingNRSurModesBatch(
+        SphHarmTimeSeries **hlms,       /**< Output: array of n mode sets */
+        UINT4 n,                        /**< number of parameter points */
+        REAL8 deltaT,                   /**< sampling interval (s) */
+        const REAL8 *m1,                /**< masses of companion 1 (kg) */
+        const REAL8 *m2,                /**< masses of companion 2 (kg) */
+        const REAL8 *S1x,               /**< x-components of the dimensionless spin of object 1 */
+        const REAL8 *S1y,               /**< y-components of the dimensionless spin of object 1 */
+        const REAL8 *S1z,               /**< z-components of the dimensionless spin of object 1 */
+        const REAL8 *S2x,               /**< x-components of the dimensionless spin of object 2 */
+        const REAL8 *S2y,               /**< y-components of the dimensionless spin of object 2 */
+        const REAL8 *S2z,               /**< z-components of the dimensionless spin of object 2 */
+        REAL8 fMin,                     /**< start GW frequency (Hz) */
+        REAL8 fRef,                     /**< reference GW frequency (Hz) */
+        REAL8 distance,                 /**< distance of source (m) */
+        LALDict* LALparams,             /**< Dict with extra parameters */
+        Approximant approximant         /**< approximant (NRSur7dq2 or NRSur7dq4) */
+);
+#endif /* SWIG */
+
 int XLALPrecessingNRSurDynamics(
         gsl_vector **t_dynamics, /**< Output: Time array at which the dynamics are returned. */
         gsl_vector **quat0,      /**< Output: Time series of 0th index of coprecessing frame quaternion. */
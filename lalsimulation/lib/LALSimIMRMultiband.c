@@ -0,0 +1,391 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <complex.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/XLALError.h>
+
+#include "LALSimIMRMultiband.h"
+
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
+/* Relative spacing of the geometric grid used to seed the refinement.
+ * It only needs to be fine enough not to step over features of the model;
+ * the refinement then adds nodes wherever the interpolation error is large. */
+#define MBAND_SEED_RATIO 0.01
+
+/* Number of independent phase recurrences advanced together when rotating;
+ * these form the vector lanes of the rotation kernel. */
+#define MBAND_LANES 4
+
+/*
+ * Error estimate for linear interpolation on [a, b] from the model value at
+ * an interior point m: the larger of the absolute phase deviation and the
+ * relative amplitude deviation.  For linear interpolation the deviation at
+ * the midpoint is, to leading order, the largest one on the interval.
+ */
+static REAL8 MultibandLinearError(
+  UINT4 a, UINT4 m, UINT4 b,
+  REAL8 ampa, REAL8 ampm, REAL8 ampb,
+  REAL8 phia, REAL8 phim, REAL8 phib
+)
+{
+  const REAL8 w = (REAL8)(m - a) / (REAL8)(b - a);
+  const REAL8 errphi = fabs(phim - ((1.0 - w) * phia + w * phib));
+  REAL8 amax = fmax(fabs(ampm), fmax(fabs(ampa), fabs(ampb)));
+  REAL8 erramp = 0.0;
+  if (amax > 0.0)
+    erramp = fabs(ampm - ((1.0 - w) * ampa + w * ampb)) / amax;
+  return fmax(errphi, erramp);
+}
+
+/**
+ * @addtogroup LALSimIMRMultiband_c
+ * @brief Model-independent multibanding of frequency-domain waveforms
+ *
+ * @details
+ * These routines let any frequency-domain model that can evaluate its
+ * amplitude and phase at arbitrary frequencies be sampled on a coarse,
+ * error-controlled grid and reconstructed on the uniform output grid,
+ * following the multibanding technique of arXiv:2001.10897.
+ *
+ * The coarse grid is seeded with geometrically spaced nodes on the fine
+ * grid and refined by bisection: each interval is tested at its midpoint,
+ * which is kept as a node, and is split again while the midpoint deviation
+ * from linear interpolation exceeds four times the threshold (the two
+ * halves then carry about a quarter of the measured deviation).  All
+ * midpoints of one refinement pass are evaluated in a single callback, so
+ * models can vectorise or thread their own evaluation.
+ *
+ * The reconstruction interpolates the amplitude linearly or with a natural
+ * cubic spline and advances exp(i phi) between nodes with a complex
+ * recurrence, so that no transcendental functions are evaluated per fine
+ * frequency bin.
+ *
+ * Models enable multibanding through the MultibandThreshold waveform
+ * parameter (0, the default, disables it) and choose the amplitude
+ * interpolation order with MultibandAmpInterpol (1 or 3).  A threshold of
+ * 1e-3 gives mismatches well below 1e-6 for the models that use it.
+ * @{
+ */
+
+/**
+ * Build the coarse grid for a model on the fine grid
+ * f_k = f0 + k deltaF, k = 0, ..., nfine - 1.
+ * The threshold is the tolerated phase error (rad) and relative amplitude
+ * error of linear interpolation between nodes.
+ */
+LALSimIMRMultibandGrid *XLALSimIMRMultibandGridCreate(
+  REAL8 f0,                             /**< first frequency of the fine grid */
+  REAL8 deltaF,                         /**< spacing of the fine grid */
+  UINT4 nfine,                          /**< number of points of the fine grid */
+  REAL8 threshold,                      /**< tolerated interpolation error */
+  LALSimIMRMultibandAmpPhaseFunc func,  /**< model amplitude and phase */
+  void *params                          /**< data passed to func */
+)
+{
+  XLAL_CHECK_NULL(func, XLAL_EFAULT);
+  XLAL_CHECK_NULL(nfine > 0, XLAL_EINVAL, "fine grid is empty");
+  XLAL_CHECK_NULL(deltaF > 0, XLAL_EINVAL, "deltaF must be positive");
+  XLAL_CHECK_NULL(threshold > 0, XLAL_EINVAL, "multibanding threshold must be positive");
+
+  /* seed nodes: geometric in frequency, snapped to the fine grid */
+  UINT4 length = 1;
+  UINT4 *index = XLALMalloc(nfine < 2 ? sizeof(UINT4) : 2 * sizeof(UINT4));
+  XLAL_CHECK_NULL(index, XLAL_ENOMEM);
+  index[0] = 0;
+  if (nfine > 1) {
+    UINT4 capacity = 2;
+    UINT4 k = 0;
+    while (k < nfine - 1) {
+      REAL8 f = fmax(f0 + k * deltaF, deltaF);
+      REAL8 step = floor(f * MBAND_SEED_RATIO / deltaF);
+      UINT4 next = (step < 1.0) ? k + 1 : (step >= (REAL8)(nfine - 1 - k) ? nfine - 1 : k + (UINT4)step);
+      if (length == capacity) {
+        capacity *= 2;
+        UINT4 *tmp = XLALRealloc(index, capacity * sizeof(UINT4));
+        if (!tmp) {
+          XLALFree(index);
+          XLAL_ERROR_NULL(XLAL_ENOMEM);
+        }
+        index = tmp;
+      }
+      index[length++] = k = next;
+    }
+  }
+
+  REAL8 *amp = XLALMalloc(length * sizeof(REAL8));
+  REAL8 *phase = XLALMalloc(length * sizeof(REAL8));
+  REAL8 *freqs = XLALMalloc(length * sizeof(REAL8));
+  UCHAR *open = XLALMalloc(length * sizeof(UCHAR));
+  if (!amp || !phase || !freqs || !open) {
+    XLALFree(index); XLALFree(amp); XLALFree(phase); XLALFree(freqs); XLALFree(open);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+  for (UINT4 i = 0; i < length; ++i) {
+    freqs[i] = f0 + index[i] * deltaF;
+    open[i] = 1;
+  }
+  int status = func(amp, phase, freqs, length, params);
+  XLALFree(freqs);
+  if (status != XLAL_SUCCESS) {
+    XLALFree(index); XLALFree(amp); XLALFree(phase); XLALFree(open);
+    XLAL_ERROR_NULL(XLAL_EFUNC, "model evaluation on the seed grid failed");
+  }
+
+  /* refine by bisection; open[i] flags interval [index[i], index[i+1]] */
+  for (;;) {
+    UINT4 nmid = 0;
+    for (UINT4 i = 0; i + 1 < length; ++i)
+      if (open[i] && index[i + 1] - index[i] > 1)
+        ++nmid;
+    if (nmid == 0)
+      break;
+
+    REAL8 *fmid = XLALMalloc(nmid * sizeof(REAL8));
+    REAL8 *ampmid = XLALMalloc(nmid * sizeof(REAL8));
+    REAL8 *phasemid = XLALMalloc(nmid * sizeof(REAL8));
+    UINT4 *newindex = XLALMalloc((length + nmid) * sizeof(UINT4));
+    REAL8 *newamp = XLALMalloc((length + nmid) * sizeof(REAL8));
+    REAL8 *newphase = XLALMalloc((length + nmid) * sizeof(REAL8));
+    UCHAR *newopen = XLALMalloc((length + nmid) * sizeof(UCHAR));
+    if (!fmid || !ampmid || !phasemid || !newindex || !newamp || !newphase || !newopen) {
+      XLALFree(fmid); XLALFree(ampmid); XLALFree(phasemid);
+      XLALFree(newindex); XLALFree(newamp); XLALFree(newphase); XLALFree(newopen);
+      XLALFree(index); XLALFree(amp); XLALFree(phase); XLALFree(open);
+      XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    for (UINT4 i = 0, j = 0; i + 1 < length; ++i)
+      if (open[i] && index[i + 1] - index[i] > 1)
+        fmid[j++] = f0 + (index[i] + (index[i + 1] - index[i]) / 2) * deltaF;
+    status = func(ampmid, phasemid, fmid, nmid, params);
+    if (status != XLAL_SUCCESS) {
+      XLALFree(fmid); XLALFree(ampmid); XLALFree(phasemid);
+      XLALFree(newindex); XLALFree(newamp); XLALFree(newphase); XLALFree(newopen);
+      XLALFree(index); XLALFree(amp); XLALFree(phase); XLALFree(open);
+      XLAL_ERROR_NULL(XLAL_EFUNC, "model evaluation during grid refinement failed");
+    }
+
+    /* merge the midpoints into the node list */
+    UINT4 n = 0;
+    for (UINT4 i = 0, j = 0; i < length; ++i) {
+      newindex[n] = index[i];
+      newamp[n] = amp[i];
+      newphase[n] = phase[i];
+      newopen[n] = 0;
+      ++n;
+      if (i + 1 < length && open[i] && index[i + 1] - index[i] > 1) {
+        UINT4 m = index[i] + (index[i + 1] - index[i]) / 2;
+        REAL8 err = MultibandLinearError(index[i], m, index[i + 1],
+                                         amp[i], ampmid[j], amp[i + 1],
+                                         phase[i], phasemid[j], phase[i + 1]);
+        /* a non-finite error refines down to the fine grid */
+        UCHAR refine = !(err <= 4.0 * threshold);
+        newopen[n - 1] = refine;
+        newindex[n] = m;
+        newamp[n] = ampmid[j];
+        newphase[n] = phasemid[j];
+        newopen[n] = refine;
+        ++n;
+        ++j;
+      }
+    }
+
+    XLALFree(fmid); XLALFree(ampmid); XLALFree(phasemid);
+    XLALFree(index); XLALFree(amp); XLALFree(phase); XLALFree(open);
+    index = newindex;
+    amp = newamp;
+    phase = newphase;
+    open = newopen;
+    length = n;
+  }
+  XLALFree(open);
+
+  LALSimIMRMultibandGrid *grid = XLALMalloc(sizeof(*grid));
+  if (!grid) {
+    XLALFree(index); XLALFree(amp); XLALFree(phase);
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  }
+  grid->f0 = f0;
+  grid->deltaF = deltaF;
+  grid->nfine = nfine;
+  grid->length = length;
+  grid->index = index;
+  grid->amp = amp;
+  grid->phase = phase;
+  return grid;
+}
+
+/** Destroy a grid created by XLALSimIMRMultibandGridCreate() */
+void XLALSimIMRMultibandGridDestroy(LALSimIMRMultibandGrid *grid)
+{
+  if (grid) {
+    XLALFree(grid->index);
+    XLALFree(grid->amp);
+    XLALFree(grid->phase);
+    XLALFree(grid);
+  }
+  return;
+}
+
+/*
+ * Multiply the real amplitudes stored in h[0..len-1] by exp(i (phi0 + j dphi)).
+ * MBAND_LANES interleaved recurrences are advanced by exp(i MBAND_LANES dphi)
+ * so that the inner loop has no dependency between lanes and vectorises;
+ * each recurrence runs over at most len / MBAND_LANES steps, so the rounding
+ * error stays at the level of a few ulp per step.
+ */
+static void MultibandRotate(COMPLEX16 *h, UINT4 len, REAL8 phi0, REAL8 dphi)
+{
+  REAL8 zr[MBAND_LANES], zi[MBAND_LANES];
+  const REAL8 wr = cos(MBAND_LANES * dphi);
+  const REAL8 wi = sin(MBAND_LANES * dphi);
+  for (UINT4 l = 0; l < MBAND_LANES; ++l) {
+    zr[l] = cos(phi0 + l * dphi);
+    zi[l] = sin(phi0 + l * dphi);
+  }
+  UINT4 j = 0;
+  for (; j + MBAND_LANES <= len; j += MBAND_LANES) {
+    for (UINT4 l = 0; l < MBAND_LANES; ++l) {
+      const REAL8 a = creal(h[j + l]);
+      const REAL8 tr = zr[l] * wr - zi[l] * wi;
+      h[j + l] = crect(a * zr[l], a * zi[l]);
+      zi[l] = zr[l] * wi + zi[l] * wr;
+      zr[l] = tr;
+    }
+  }
+  for (UINT4 l = 0; j < len; ++j, ++l)
+    h[j] = crect(creal(h[j]) * zr[l], creal(h[j]) * zi[l]);
+  return;
+}
+
+/* second derivatives of the natural cubic spline through (x[i], y[i]) */
+static int MultibandSplineSecondDerivs(REAL8 *y2, const UINT4 *x, const REAL8 *y, UINT4 n)
+{
+  y2[0] = y2[n - 1] = 0.0;
+  if (n < 3)
+    return XLAL_SUCCESS;
+  REAL8 *c = XLALMalloc(n * sizeof(REAL8));
+  XLAL_CHECK(c, XLAL_ENOMEM);
+  /* Thomas algorithm for the tridiagonal system of the interior nodes */
+  c[0] = 0.0;
+  for (UINT4 i = 1; i + 1 < n; ++i) {
+    const REAL8 hl = (REAL8)(x[i] - x[i - 1]);
+    const REAL8 hr = (REAL8)(x[i + 1] - x[i]);
+    const REAL8 rhs = 6.0 * ((y[i + 1] - y[i]) / hr - (y[i] - y[i - 1]) / hl);
+    const REAL8 diag = 2.0 * (hl + hr) - hl * c[i - 1];
+    c[i] = hr / diag;
+    y2[i] = (rhs - hl * y2[i - 1]) / diag;
+  }
+  for (UINT4 i = n - 2; i > 0; --i)
+    y2[i] -= c[i] * y2[i + 1];
+  XLALFree(c);
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Reconstruct h(f) = A(f) exp(i phi(f)) on the whole fine grid of a coarse
+ * grid, writing grid->nfine samples to hfine.  The amplitude is interpolated
+ * linearly (ampInterpOrder = 1) or with a natural cubic spline
+ * (ampInterpOrder = 3); the phase is interpolated linearly.
+ */
+int XLALSimIMRMultibandInterpolate(
+  COMPLEX16 *hfine,                     /**< [out] waveform on the fine grid */
+  const LALSimIMRMultibandGrid *grid,   /**< coarse grid */
+  INT4 ampInterpOrder                   /**< amplitude interpolation order: 1 or 3 */
+)
+{
+  XLAL_CHECK(hfine && grid, XLAL_EFAULT);
+  XLAL_CHECK(ampInterpOrder == 1 || ampInterpOrder == 3, XLAL_EINVAL, "amplitude interpolation order must be 1 or 3, got %d", ampInterpOrder);
+
+  const UINT4 n = grid->length;
+  const UINT4 *x = grid->index;
+  const REAL8 *amp = grid->amp;
+  const REAL8 *phase = grid->phase;
+
+  REAL8 *y2 = NULL;
+  if (ampInterpOrder == 3) {
+    y2 = XLALMalloc(n * sizeof(REAL8));
+    XLAL_CHECK(y2, XLAL_ENOMEM);
+    if (MultibandSplineSecondDerivs(y2, x, amp, n) != XLAL_SUCCESS) {
+      XLALFree(y2);
+      XLAL_ERROR(XLAL_EFUNC);
+    }
+  }
+
+  #pragma omp parallel for schedule(dynamic)
+  for (UINT4 i = 0; i < n - 1; ++i) {
+    const UINT4 len = x[i + 1] - x[i];
+    const REAL8 rlen = 1.0 / len;
+    COMPLEX16 *h = hfine + x[i];
+    if (y2) {
+      const REAL8 c0 = len * len / 6.0 * y2[i];
+      const REAL8 c1 = len * len / 6.0 * y2[i + 1];
+      for (UINT4 j = 0; j < len; ++j) {
+        const REAL8 t = j * rlen;
+        const REAL8 s = 1.0 - t;
+        h[j] = s * amp[i] + t * amp[i + 1] + (s * s * s - s) * c0 + (t * t * t - t) * c1;
+      }
+    } else {
+      const REAL8 da = (amp[i + 1] - amp[i]) * rlen;
+      for (UINT4 j = 0; j < len; ++j)
+        h[j] = amp[i] + j * da;
+    }
+    MultibandRotate(h, len, phase[i], (phase[i + 1] - phase[i]) * rlen);
+  }
+
+  hfine[x[n - 1]] = amp[n - 1] * cexp(I * phase[n - 1]);
+
+  XLALFree(y2);
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Evaluate a model on the fine grid f_k = f0 + k deltaF, k = 0, ..., nfine - 1
+ * through multibanding: build the coarse grid for the given threshold and
+ * reconstruct the waveform into hfine.
+ */
+int XLALSimIMRMultibandEvaluate(
+  COMPLEX16 *hfine,                     /**< [out] waveform on the fine grid */
+  REAL8 f0,                             /**< first frequency of the fine grid */
+  REAL8 deltaF,                         /**< spacing of the fine grid */
+  UINT4 nfine,                          /**< number of points of the fine grid */
+  REAL8 threshold,                      /**< tolerated interpolation error */
+  INT4 ampInterpOrder,                  /**< amplitude interpolation order: 1 or 3 */
+  LALSimIMRMultibandAmpPhaseFunc func,  /**< model amplitude and phase */
+  void *params                          /**< data passed to func */
+)
+{
+  if (nfine == 0)
+    return XLAL_SUCCESS;
+  LALSimIMRMultibandGrid *grid = XLALSimIMRMultibandGridCreate(f0, deltaF, nfine, threshold, func, params);
+  XLAL_CHECK(grid, XLAL_EFUNC);
+  int status = XLALSimIMRMultibandInterpolate(hfine, grid, ampInterpOrder);
+  XLALSimIMRMultibandGridDestroy(grid);
+  XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC);
+  return XLAL_SUCCESS;
+}
+
+/** @} */
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/*
+ * Model-independent multibanding for frequency-domain waveforms.
+ *
+ * A model supplies a callback returning amplitude and (unwrapped) phase at
+ * an arbitrary set of frequencies.  The engine builds an error-controlled
+ * coarse grid whose nodes lie on the uniform output grid, evaluates the
+ * model only there, and reconstructs h(f) = A(f) exp(i phi(f)) on the
+ * uniform grid by interpolating the amplitude (linear or cubic) and rotating
+ * the phase with a complex recurrence between nodes.  This generalises the
+ * technique of arXiv:2001.10897 used by IMRPhenomXHM.
+ */
+
+#ifndef _LALSIM_IMR_MULTIBAND_H
+#define _LALSIM_IMR_MULTIBAND_H
+
+#include <lal/LALDatatypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Callback evaluating a frequency-domain model at n frequencies.
+ * On return amp[i] and phase[i] must be such that the waveform is
+ * h(freqs[i]) = amp[i] * exp(I * phase[i]); the phase must be continuous
+ * (unwrapped) in frequency.  Must return XLAL_SUCCESS or an XLAL error code.
+ */
+typedef int (*LALSimIMRMultibandAmpPhaseFunc)(
+  REAL8 *amp,           /**< [out] amplitude at freqs */
+  REAL8 *phase,         /**< [out] phase at freqs */
+  const REAL8 *freqs,   /**< frequencies at which to evaluate the model */
+  UINT4 n,              /**< number of frequencies */
+  void *params          /**< model-specific data */
+);
+
+/** Coarse grid on which a model has been evaluated */
+typedef struct tagLALSimIMRMultibandGrid {
+  REAL8 f0;             /**< frequency of the first fine-grid point */
+  REAL8 deltaF;         /**< spacing of the fine grid */
+  UINT4 nfine;          /**< number of fine-grid points */
+  UINT4 length;         /**< number of coarse nodes */
+  UINT4 *index;         /**< fine-grid index of each node; first is 0, last is nfine - 1 */
+  REAL8 *amp;           /**< model amplitude at each node */
+  REAL8 *phase;         /**< model phase at each node */
+} LALSimIMRMultibandGrid;
+
+LALSimIMRMultibandGrid *XLALSimIMRMultibandGridCreate(
+  REAL8 f0,
+  REAL8 deltaF,
+  UINT4 nfine,
+  REAL8 threshold,
+  LALSimIMRMultibandAmpPhaseFunc func,
+  void *params
+);
+
+void XLALSimIMRMultibandGridDestroy(LALSimIMRMultibandGrid *grid);
+
+int XLALSimIMRMultibandInterpolate(
+  COMPLEX16 *hfine,
+  const LALSimIMRMultibandGrid *grid,
+  INT4 ampInterpOrder
+);
+
+int XLALSimIMRMultibandEvaluate(
+  COMPLEX16 *hfine,
+  REAL8 f0,
+  REAL8 deltaF,
+  UINT4 nfine,
+  REAL8 threshold,
+  INT4 ampInterpOrder,
+  LALSimIMRMultibandAmpPhaseFunc func,
+  void *params
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LALSIM_IMR_MULTIBAND_H */
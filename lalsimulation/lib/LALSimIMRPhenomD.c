@@ -25,6 +25,7 @@
 
 #include "LALSimIMRPhenomInternalUtils.h"
 #include "LALSimIMRPhenomUtils.h"
+#include "LALSimIMRMultiband.h"
 
 UsefulPowers powers_of_pi;	// declared in LALSimIMRPhenomD_internals.c
 
@@ -38,7 +39,11 @@ UsefulPowers powers_of_pi;	// declared in LALSimIMRPhenomD_internals.c
  */
 
 static int IMRPhenomDGenerateFD(
-    COMPLEX16FrequencySeries **htilde, /**< [out] FD waveform */
+    COMPLEX16FrequencySeries **htilde, /**< [out] FD waveform, or NULL to return single-precision polarizations */
+    COMPLEX8FrequencySeries **hptilde8, /**< [out] single-precision plus polarization plusFactor * h */
+    COMPLEX8FrequencySeries **hctilde8, /**< [out] single-precision cross polarization crossFactor * h */
+    const COMPLEX16 plusFactor,        /**< factor multiplying h in hptilde8 */
+    const COMPLEX16 crossFactor,       /**< factor multiplying h in hctilde8 */
     const REAL8Sequence *freqs_in,     /**< Frequency points at which to evaluate the waveform (Hz) */
     double deltaF,                     /**< If deltaF > 0, the frequency points given in freqs are uniformly spaced with
                                         * spacing deltaF. Otherwise, the frequency points are spaced non-uniformly.
@@ -54,56 +59,31 @@ static int IMRPhenomDGenerateFD(
     NRTidal_version_type NRTidal_version /**< NRTidal version; either NRTidal_V or NRTidalv2_V or NoNRT_V in case of BBH baseline */
 );
 
-/**
- * @addtogroup LALSimIMRPhenom_c
- * @{
- *
- * @name Routines for IMR Phenomenological Model "D"
- * @{
- *
- * @author Michael Puerrer, Sebastian Khan, Frank Ohme
- *
- * @brief C code for IMRPhenomD phenomenological waveform model.
- *
- * This is an aligned-spin frequency domain model.
- * See Husa et al \cite Husa:2015iqa, and Khan et al \cite Khan:2015jqa
- * for details. Any studies that use this waveform model should include
- * a reference to both of these papers.
- *
- * @note The model was calibrated to mass-ratios [1:1,1:4,1:8,1:18].
- * * Along the mass-ratio 1:1 line it was calibrated to spins  [-0.95, +0.98].
- * * Along the mass-ratio 1:4 line it was calibrated to spins  [-0.75, +0.75].
- * * Along the mass-ratio 1:8 line it was calibrated to spins  [-0.85, +0.85].
- * * Along the mass-ratio 1:18 line it was calibrated to spins [-0.8, +0.4].
- * The calibration points will be given in forthcoming papers.
- *
- * @attention The model is usable outside this parameter range,
- * and in tests to date gives sensible physical results,
- * but conclusive statements on the physical fidelity of
- * the model for these parameters await comparisons against further
- * numerical-relativity simulations. For more information, see the review wiki
- * under https://www.lsc-group.phys.uwm.edu/ligovirgo/cbcnote/WaveformsReview/IMRPhenomDCodeReview
- */
-
-
-/**
- * Driver routine to compute the spin-aligned, inspiral-merger-ringdown
- * phenomenological waveform IMRPhenomD in the frequency domain.
- *
- * Reference:
- * - Waveform: Eq. 35 and 36 in arXiv:1508.07253
- * - Coefficients: Eq. 31 and Table V in arXiv:1508.07253
- *
- *  All input parameters should be in SI units. Angles should be in radians.
- *
- * Compute waveform in LAL format for the IMRPhenomD model.
- *
- * Returns the plus and cross polarizations as a complex frequency series with
- * equal spacing deltaF and contains zeros from zero frequency to the starting
- * frequency fLow and zeros beyond the cutoff frequency in the ringdown.
- */
-int XLALSimIMRPhenomDGenerateFD(
-    COMPLEX16FrequencySeries **htilde, /**< [out] FD waveform */
+/* Data needed to evaluate amplitude and phase at arbitrary frequencies for multibanding */
+typedef struct tagIMRPhenomDMultibandData {
+  IMRPhenomDAmplitudeCoefficients *pAmp;
+  IMRPhenomDPhaseCoefficients *pPhi;
+  PNPhasingSeries *pn;
+  AmpInsPrefactors *amp_prefactors;
+  PhiInsPrefactors *phi_prefactors;
+  REAL8 M_sec;
+  REAL8 amp0;
+  REAL8 t0;
+  REAL8 MfRef;
+  REAL8 phi_precalc;
+  REAL8 m1, m2, lambda1, lambda2;
+  NRTidal_version_type NRTidal_version;
+} IMRPhenomDMultibandData;
+
+static int IMRPhenomDMultibandAmpPhase(REAL8 *amp, REAL8 *phase, const REAL8 *freqs, UINT4 n, void *params);
+
+/* Shared driver of XLALSimIMRPhenomDGenerateFD() and XLALSimIMRPhenomDGenerateFDCOMPLEX8() */
+static int IMRPhenomDGenerateFDUniform(
+    COMPLEX16FrequencySeries **htilde, /**< [out] FD waveform, or NULL to return single-precision polarizations */
+    COMPLEX8FrequencySeries **hptilde8, /**< [out] single-precision plus polarization plusFactor * h */
+    COMPLEX8FrequencySeries **hctilde8, /**< [out] single-precision cross polarization crossFactor * h */
+    const COMPLEX16 plusFactor,        /**< factor multiplying h in hptilde8 */
+    const COMPLEX16 crossFactor,       /**< factor multiplying h in hctilde8 */
     const REAL8 phi0,                  /**< Orbital phase at fRef (rad) */
     const REAL8 fRef_in,               /**< reference frequency (Hz) */
     const REAL8 deltaF,                /**< Sampling frequency (Hz) */
@@ -122,8 +102,12 @@ int XLALSimIMRPhenomDGenerateFD(
   const REAL8 m2 = m2_SI / LAL_MSUN_SI;
 
   /* check inputs for sanity */
-  XLAL_CHECK(0 != htilde, XLAL_EFAULT, "htilde is null");
-  if (*htilde) XLAL_ERROR(XLAL_EFAULT);
+  if (htilde) {
+    if (*htilde) XLAL_ERROR(XLAL_EFAULT);
+  } else {
+    XLAL_CHECK(hptilde8 && hctilde8, XLAL_EFAULT, "hptilde8 or hctilde8 is null");
+    if (*hptilde8 || *hctilde8) XLAL_ERROR(XLAL_EFAULT);
+  }
   if (fRef_in < 0) XLAL_ERROR(XLAL_EDOM, "fRef_in must be positive (or 0 for 'ignore')\n");
   if (deltaF <= 0) XLAL_ERROR(XLAL_EDOM, "deltaF must be positive\n");
   if (m1 <= 0) XLAL_ERROR(XLAL_EDOM, "m1 must be positive\n");
@@ -163,7 +147,7 @@ int XLALSimIMRPhenomDGenerateFD(
   REAL8Sequence *freqs = XLALCreateREAL8Sequence(2);
   freqs->data[0] = f_min;
   freqs->data[1] = f_max_prime;
-  int status = IMRPhenomDGenerateFD(htilde, freqs, deltaF, phi0, fRef,
+  int status = IMRPhenomDGenerateFD(htilde, hptilde8, hctilde8, plusFactor, crossFactor, freqs, deltaF, phi0, fRef,
                                     m1, m2, chi1, chi2,
                                     distance, extraParams, NRTidal_version);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to generate IMRPhenomD waveform.");
@@ -172,15 +156,124 @@ int XLALSimIMRPhenomDGenerateFD(
   if (f_max_prime < f_max) {
     // The user has requested a higher f_max than Mf=fCut.
     // Resize the frequency series to fill with zeros beyond the cutoff frequency.
-    size_t n = (*htilde)->data->length;
     size_t n_full = NextPow2(f_max / deltaF) + 1; // we actually want to have the length be a power of 2 + 1
-    *htilde = XLALResizeCOMPLEX16FrequencySeries(*htilde, 0, n_full);
-    XLAL_CHECK ( *htilde, XLAL_ENOMEM, "Failed to resize waveform COMPLEX16FrequencySeries of length %zu (for internal fCut=%f) to new length %zu (for user-requested f_max=%f).", n, fCut, n_full, f_max );
+    if (htilde) {
+      size_t n = (*htilde)->data->length;
+      *htilde = XLALResizeCOMPLEX16FrequencySeries(*htilde, 0, n_full);
+      XLAL_CHECK ( *htilde, XLAL_ENOMEM, "Failed to resize waveform COMPLEX16FrequencySeries of length %zu (for internal fCut=%f) to new length %zu (for user-requested f_max=%f).", n, fCut, n_full, f_max );
+    } else {
+      size_t n = (*hptilde8)->data->length;
+      *hptilde8 = XLALResizeCOMPLEX8FrequencySeries(*hptilde8, 0, n_full);
+      *hctilde8 = XLALResizeCOMPLEX8FrequencySeries(*hctilde8, 0, n_full);
+      XLAL_CHECK ( *hptilde8 && *hctilde8, XLAL_ENOMEM, "Failed to resize waveform COMPLEX8FrequencySeries of length %zu (for internal fCut=%f) to new length %zu (for user-requested f_max=%f).", n, fCut, n_full, f_max );
+    }
   }
 
   return XLAL_SUCCESS;
 }
 
+/**
+ * @addtogroup LALSimIMRPhenom_c
+ * @{
+ *
+ * @name Routines for IMR Phenomenological Model "D"
+ * @{
+ *
+ * @author Michael Puerrer, Sebastian Khan, Frank Ohme
+ *
+ * @brief C code for IMRPhenomD phenomenological waveform model.
+ *
+ * This is an aligned-spin frequency domain model.
+ * See Husa et al \cite Husa:2015iqa, and Khan et al \cite Khan:2015jqa
+ * for details. Any studies that use this waveform model should include
+ * a reference to both of these papers.
+ *
+ * @note The model was calibrated to mass-ratios [1:1,1:4,1:8,1:18].
+ * * Along the mass-ratio 1:1 line it was calibrated to spins  [-0.95, +0.98].
+ * * Along the mass-ratio 1:4 line it was calibrated to spins  [-0.75, +0.75].
+ * * Along the mass-ratio 1:8 line it was calibrated to spins  [-0.85, +0.85].
+ * * Along the mass-ratio 1:18 line it was calibrated to spins [-0.8, +0.4].
+ * The calibration points will be given in forthcoming papers.
+ *
+ * @attention The model is usable outside this parameter range,
+ * and in tests to date gives sensible physical results,
+ * but conclusive statements on the physical fidelity of
+ * the model for these parameters await comparisons against further
+ * numerical-relativity simulations. For more information, see the review wiki
+ * under https://www.lsc-group.phys.uwm.edu/ligovirgo/cbcnote/WaveformsReview/IMRPhenomDCodeReview
+ *
+ * Uniformly sampled waveforms can be evaluated through multibanding
+ * (see \ref LALSimIMRMultiband_c) by setting the MultibandThreshold
+ * waveform parameter to a positive value, e.g. 1e-3.
+ */
+
+
+/**
+ * Driver routine to compute the spin-aligned, inspiral-merger-ringdown
+ * phenomenological waveform IMRPhenomD in the frequency domain.
+ *
+ * Reference:
+ * - Waveform: Eq. 35 and 36 in arXiv:1508.07253
+ * - Coefficients: Eq. 31 and Table V in arXiv:1508.07253
+ *
+ *  All input parameters should be in SI units. Angles should be in radians.
+ *
+ * Compute waveform in LAL format for the IMRPhenomD model.
+ *
+ * Returns the plus and cross polarizations as a complex frequency series with
+ * equal spacing deltaF and contains zeros from zero frequency to the starting
+ * frequency fLow and zeros beyond the cutoff frequency in the ringdown.
+ */
+int XLALSimIMRPhenomDGenerateFD(
+    COMPLEX16FrequencySeries **htilde, /**< [out] FD waveform */
+    const REAL8 phi0,                  /**< Orbital phase at fRef (rad) */
+    const REAL8 fRef_in,               /**< reference frequency (Hz) */
+    const REAL8 deltaF,                /**< Sampling frequency (Hz) */
+    const REAL8 m1_SI,                 /**< Mass of companion 1 (kg) */
+    const REAL8 m2_SI,                 /**< Mass of companion 2 (kg) */
+    const REAL8 chi1,                  /**< Aligned-spin parameter of companion 1 */
+    const REAL8 chi2,                  /**< Aligned-spin parameter of companion 2 */
+    const REAL8 f_min,                 /**< Starting GW frequency (Hz) */
+    const REAL8 f_max,                 /**< End frequency; 0 defaults to Mf = \ref f_CUT */
+    const REAL8 distance,               /**< Distance of source (m) */
+    LALDict *extraParams, /**< linked list containing the extra testing GR parameters */
+    NRTidal_version_type NRTidal_version /**< Version of NRTides; can be one of NRTidal versions or NoNRT_V for the BBH baseline */
+) {
+  XLAL_CHECK(0 != htilde, XLAL_EFAULT, "htilde is null");
+  return IMRPhenomDGenerateFDUniform(htilde, NULL, NULL, 0., 0., phi0, fRef_in, deltaF, m1_SI, m2_SI, chi1, chi2,
+                                     f_min, f_max, distance, extraParams, NRTidal_version);
+}
+
+/**
+ * Single-precision variant of XLALSimIMRPhenomDGenerateFD().
+ *
+ * Returns hptilde = plusFactor * h and hctilde = crossFactor * h, where h is
+ * the waveform returned by XLALSimIMRPhenomDGenerateFD(), as COMPLEX8
+ * frequency series.  Amplitude and phase are evaluated in double precision
+ * and each sample is rounded once when it is stored.
+ */
+int XLALSimIMRPhenomDGenerateFDCOMPLEX8(
+    COMPLEX8FrequencySeries **hptilde, /**< [out] FD plus polarization */
+    COMPLEX8FrequencySeries **hctilde, /**< [out] FD cross polarization */
+    const REAL8 phi0,                  /**< Orbital phase at fRef (rad) */
+    const REAL8 fRef_in,               /**< reference frequency (Hz) */
+    const REAL8 deltaF,                /**< Sampling frequency (Hz) */
+    const REAL8 m1_SI,                 /**< Mass of companion 1 (kg) */
+    const REAL8 m2_SI,                 /**< Mass of companion 2 (kg) */
+    const REAL8 chi1,                  /**< Aligned-spin parameter of companion 1 */
+    const REAL8 chi2,                  /**< Aligned-spin parameter of companion 2 */
+    const REAL8 f_min,                 /**< Starting GW frequency (Hz) */
+    const REAL8 f_max,                 /**< End frequency; 0 defaults to Mf = \ref f_CUT */
+    const REAL8 distance,              /**< Distance of source (m) */
+    const COMPLEX16 plusFactor,        /**< factor multiplying h in the plus polarization */
+    const COMPLEX16 crossFactor,       /**< factor multiplying h in the cross polarization */
+    LALDict *extraParams, /**< linked list containing the extra testing GR parameters */
+    NRTidal_version_type NRTidal_version /**< Version of NRTides; can be one of NRTidal versions or NoNRT_V for the BBH baseline */
+) {
+  return IMRPhenomDGenerateFDUniform(NULL, hptilde, hctilde, plusFactor, crossFactor, phi0, fRef_in, deltaF, m1_SI, m2_SI, chi1, chi2,
+                                     f_min, f_max, distance, extraParams, NRTidal_version);
+}
+
 /**
  * Compute waveform in LAL format at specified frequencies for the IMRPhenomD model.
  *
@@ -234,7 +327,7 @@ int XLALSimIMRPhenomDFrequencySequence(
   // if no reference frequency given, set it to the starting GW frequency
   REAL8 fRef = (fRef_in == 0.0) ? freqs->data[0] : fRef_in;
 
-  int status = IMRPhenomDGenerateFD(htilde, freqs, 0, phi0, fRef,
+  int status = IMRPhenomDGenerateFD(htilde, NULL, NULL, 0., 0., freqs, 0, phi0, fRef,
                                     m1, m2, chi1, chi2,
                                     distance, extraParams, NRTidal_version);
   XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to generate IMRPhenomD waveform.");
@@ -247,13 +340,49 @@ int XLALSimIMRPhenomDFrequencySequence(
 
 /** @} */
 
+/* Allocates and zeroes either the double-precision waveform or the single-precision polarizations */
+static int IMRPhenomDAllocateOutput(
+    COMPLEX16FrequencySeries **htilde,
+    COMPLEX8FrequencySeries **hptilde8,
+    COMPLEX8FrequencySeries **hctilde8,
+    const LIGOTimeGPS *epoch,
+    REAL8 f0,
+    REAL8 deltaF,
+    size_t npts
+) {
+  if (htilde) {
+    *htilde = XLALCreateCOMPLEX16FrequencySeries("htilde: FD waveform", epoch, f0, deltaF, &lalStrainUnit, npts);
+    XLAL_CHECK(*htilde, XLAL_ENOMEM);
+    memset((*htilde)->data->data, 0, npts * sizeof(COMPLEX16));
+    XLALUnitMultiply(&((*htilde)->sampleUnits), &((*htilde)->sampleUnits), &lalSecondUnit);
+    return XLAL_SUCCESS;
+  }
+  *hptilde8 = XLALCreateCOMPLEX8FrequencySeries("hptilde: FD waveform", epoch, f0, deltaF, &lalStrainUnit, npts);
+  *hctilde8 = XLALCreateCOMPLEX8FrequencySeries("hctilde: FD waveform", epoch, f0, deltaF, &lalStrainUnit, npts);
+  if (!*hptilde8 || !*hctilde8) {
+    XLALDestroyCOMPLEX8FrequencySeries(*hptilde8);
+    XLALDestroyCOMPLEX8FrequencySeries(*hctilde8);
+    *hptilde8 = *hctilde8 = NULL;
+    XLAL_ERROR(XLAL_ENOMEM);
+  }
+  memset((*hptilde8)->data->data, 0, npts * sizeof(COMPLEX8));
+  memset((*hctilde8)->data->data, 0, npts * sizeof(COMPLEX8));
+  XLALUnitMultiply(&((*hptilde8)->sampleUnits), &((*hptilde8)->sampleUnits), &lalSecondUnit);
+  XLALUnitMultiply(&((*hctilde8)->sampleUnits), &((*hctilde8)->sampleUnits), &lalSecondUnit);
+  return XLAL_SUCCESS;
+}
+
 /* *********************************************************************************/
 /* The following private function generates IMRPhenomD frequency-domain waveforms  */
 /* given coefficients */
 /* *********************************************************************************/
 
 static int IMRPhenomDGenerateFD(
-    COMPLEX16FrequencySeries **htilde, /**< [out] FD waveform */
+    COMPLEX16FrequencySeries **htilde, /**< [out] FD waveform, or NULL to return single-precision polarizations */
+    COMPLEX8FrequencySeries **hptilde8, /**< [out] single-precision plus polarization plusFactor * h */
+    COMPLEX8FrequencySeries **hctilde8, /**< [out] single-precision cross polarization crossFactor * h */
+    const COMPLEX16 plusFactor,        /**< factor multiplying h in hptilde8 */
+    const COMPLEX16 crossFactor,       /**< factor multiplying h in hctilde8 */
     const REAL8Sequence *freqs_in,     /**< Frequency points at which to evaluate the waveform (Hz) */
     double deltaF,                     /* If deltaF > 0, the frequency points given in freqs are uniformly spaced with
                                         * spacing deltaF. Otherwise, the frequency points are spaced non-uniformly.
@@ -340,8 +469,8 @@ static int IMRPhenomDGenerateFD(
     /* Coalesce at t=0 */
     // shift by overall length in time
     XLAL_CHECK ( XLALGPSAdd(&ligotimegps_zero, -1. / deltaF), XLAL_EFUNC, "Failed to shift coalescence time to t=0, tried to apply shift of -1.0/deltaF with deltaF=%g.", deltaF);
-    *htilde = XLALCreateCOMPLEX16FrequencySeries("htilde: FD waveform", &ligotimegps_zero, 0.0, deltaF, &lalStrainUnit, npts);
-    XLAL_CHECK ( *htilde, XLAL_ENOMEM, "Failed to allocated waveform COMPLEX16FrequencySeries of length %zu for f_max=%f, deltaF=%g.", npts, f_max, deltaF);
+    status = IMRPhenomDAllocateOutput(htilde, hptilde8, hctilde8, &ligotimegps_zero, 0.0, deltaF, npts);
+    XLAL_CHECK ( XLAL_SUCCESS == status, XLAL_ENOMEM, "Failed to allocated waveform FrequencySeries of length %zu for f_max=%f, deltaF=%g.", npts, f_max, deltaF);
     // Recreate freqs using only the lower and upper bounds
     size_t iStart = (size_t) (f_min / deltaF);
     size_t iStop = (size_t) (f_max / deltaF);
@@ -354,8 +483,8 @@ static int IMRPhenomDGenerateFD(
     offset = iStart;
   } else { // freqs contains frequencies with non-uniform spacing; we start at lowest given frequency
     npts = freqs_in->length;
-    *htilde = XLALCreateCOMPLEX16FrequencySeries("htilde: FD waveform", &ligotimegps_zero, f_min, deltaF, &lalStrainUnit, npts);
-    XLAL_CHECK ( *htilde, XLAL_ENOMEM, "Failed to allocated waveform COMPLEX16FrequencySeries of length %zu from sequence.", npts);
+    status = IMRPhenomDAllocateOutput(htilde, hptilde8, hctilde8, &ligotimegps_zero, f_min, deltaF, npts);
+    XLAL_CHECK ( XLAL_SUCCESS == status, XLAL_ENOMEM, "Failed to allocated waveform FrequencySeries of length %zu from sequence.", npts);
     offset = 0;
     freqs = XLALCreateREAL8Sequence(freqs_in->length);
     if (!freqs)
@@ -364,8 +493,10 @@ static int IMRPhenomDGenerateFD(
       freqs->data[i] = freqs_in->data[i];
   }
 
-  memset((*htilde)->data->data, 0, npts * sizeof(COMPLEX16));
-  XLALUnitMultiply(&((*htilde)->sampleUnits), &((*htilde)->sampleUnits), &lalSecondUnit);
+  /* Either the double-precision waveform or the single-precision polarizations are written */
+  COMPLEX16 *data = htilde ? (*htilde)->data->data : NULL;
+  COMPLEX8 *datap = htilde ? NULL : (*hptilde8)->data->data;
+  COMPLEX8 *datac = htilde ? NULL : (*hctilde8)->data->data;
 
   // Calculate phenomenological parameters
   const REAL8 finspin = FinalSpin0815(eta, chi1, chi2); //FinalSpin0815 - 0815 is like a version number
@@ -424,8 +555,38 @@ static int IMRPhenomDGenerateFD(
 
   int status_in_for = XLAL_SUCCESS;
   int ret = XLAL_SUCCESS;
+  const REAL8 mband_threshold = XLALSimInspiralWaveformParamsLookupMultibandThreshold(extraParams);
   /* Now generate the waveform */
-  if (NRTidal_version == NRTidalv2_V) {
+  if (deltaF > 0 && mband_threshold > 0) {
+    /* Evaluate on a coarse grid and interpolate onto the uniform grid */
+    IMRPhenomDMultibandData mband_data = {
+      .pAmp = pAmp, .pPhi = pPhi, .pn = pn,
+      .amp_prefactors = &amp_prefactors, .phi_prefactors = &phi_prefactors,
+      .M_sec = M_sec, .amp0 = amp0, .t0 = t0, .MfRef = MfRef, .phi_precalc = phi_precalc,
+      .m1 = m1, .m2 = m2, .lambda1 = lambda1, .lambda2 = lambda2,
+      .NRTidal_version = NRTidal_version
+    };
+    INT4 mband_order = XLALSimInspiralWaveformParamsLookupMultibandAmpInterpol(extraParams);
+    /* The interpolation works in double precision; single-precision output goes through a scratch buffer */
+    COMPLEX16 *hfine = data ? data + offset : XLALMalloc(freqs->length * sizeof(*hfine));
+    if (!hfine) {
+      XLALPrintError("Failed to allocate scratch buffer of length %u for multibanding", freqs->length);
+      status = XLAL_ENOMEM;
+    }
+    else {
+      status = XLALSimIMRMultibandEvaluate(hfine, offset * deltaF, deltaF, freqs->length,
+                                           mband_threshold, mband_order, IMRPhenomDMultibandAmpPhase, &mband_data);
+      if (XLAL_SUCCESS != status)
+        XLALPrintError("XLALSimIMRMultibandEvaluate failed for IMRPhenomD, status=%d", status);
+    }
+    if (hfine && !data) {
+      for (UINT4 i=0; i<freqs->length; i++) {
+        datap[i + offset] = plusFactor * hfine[i];
+        datac[i + offset] = crossFactor * hfine[i];
+      }
+      XLALFree(hfine);
+    }
+  } else if (NRTidal_version == NRTidalv2_V) {
     /* Generate the tidal amplitude (Eq. 24 of arxiv: 1905.06011) to add to BBH baseline; only for IMRPhenomD_NRTidalv2 */
     amp_tidal = XLALCreateREAL8Sequence(freqs->length);
     ret = XLALSimNRTunedTidesFDTidalAmplitudeFrequencySeries(amp_tidal, freqs, m1, m2, lambda1, lambda2);
@@ -449,7 +610,13 @@ static int IMRPhenomDGenerateFD(
         REAL8 phi = IMRPhenDPhase(Mf, pPhi, pn, &powers_of_f, &phi_prefactors, 1.0, 1.0);
 
         phi -= t0*(Mf-MfRef) + phi_precalc;
-        ((*htilde)->data->data)[j] = amp0 * (amp+2*sqrt(LAL_PI/5.)*ampT) * cexp(-I * phi);
+        const COMPLEX16 h = amp0 * (amp+2*sqrt(LAL_PI/5.)*ampT) * cexp(-I * phi);
+        if (data)
+          data[j] = h;
+        else {
+          datap[j] = plusFactor * h;
+          datac[j] = crossFactor * h;
+        }
       }
     }
   } else {
@@ -470,7 +637,13 @@ static int IMRPhenomDGenerateFD(
         REAL8 phi = IMRPhenDPhase(Mf, pPhi, pn, &powers_of_f, &phi_prefactors, 1.0, 1.0);
 
         phi -= t0*(Mf-MfRef) + phi_precalc;
-        ((*htilde)->data->data)[j] = amp0 * amp * cexp(-I * phi);
+        const COMPLEX16 h = amp0 * amp * cexp(-I * phi);
+        if (data)
+          data[j] = h;
+        else {
+          datap[j] = plusFactor * h;
+          datac[j] = crossFactor * h;
+        }
       }
     }
   }
@@ -497,6 +670,46 @@ static int IMRPhenomDGenerateFD(
 // END OF REVIEWED CODE ////////////////////////
 ////////////////////////////////////////////////
 
+/* Multibanding callback: IMRPhenomD amplitude and phase at arbitrary frequencies (Hz) */
+static int IMRPhenomDMultibandAmpPhase(REAL8 *amp, REAL8 *phase, const REAL8 *freqs, UINT4 n, void *params)
+{
+  IMRPhenomDMultibandData *d = (IMRPhenomDMultibandData *) params;
+  REAL8Sequence *amp_tidal = NULL;
+  if (d->NRTidal_version == NRTidalv2_V) {
+    REAL8Sequence fseq = { .length = n, .data = (REAL8 *) freqs };
+    amp_tidal = XLALCreateREAL8Sequence(n);
+    XLAL_CHECK(amp_tidal, XLAL_ENOMEM);
+    int ret = XLALSimNRTunedTidesFDTidalAmplitudeFrequencySeries(amp_tidal, &fseq, d->m1, d->m2, d->lambda1, d->lambda2);
+    if (XLAL_SUCCESS != ret) {
+      XLALDestroyREAL8Sequence(amp_tidal);
+      XLAL_ERROR(ret, "Failed to generate tidal amplitude series for IMRPhenomD_NRTidalv2.");
+    }
+  }
+
+  int status = XLAL_SUCCESS;
+  #pragma omp parallel for
+  for (UINT4 i = 0; i < n; i++) {
+    double Mf = d->M_sec * freqs[i];
+    UsefulPowers powers_of_f;
+    int status_in_for = init_useful_powers(&powers_of_f, Mf);
+    if (XLAL_SUCCESS != status_in_for) {
+      XLALPrintError("init_useful_powers failed for Mf, status_in_for=%d", status_in_for);
+      status = status_in_for;
+    }
+    else {
+      REAL8 a = IMRPhenDAmplitude(Mf, d->pAmp, &powers_of_f, d->amp_prefactors);
+      REAL8 phi = IMRPhenDPhase(Mf, d->pPhi, d->pn, &powers_of_f, d->phi_prefactors, 1.0, 1.0);
+      if (amp_tidal)
+        a += 2*sqrt(LAL_PI/5.)*amp_tidal->data[i];
+      amp[i] = d->amp0 * a;
+      phase[i] = -(phi - d->t0*(Mf - d->MfRef) - d->phi_precalc);
+    }
+  }
+
+  XLALDestroyREAL8Sequence(amp_tidal);
+  return status;
+}
+
 /**
  * Function to return the frequency (in Hz) of the peak of the frequency
  * domain amplitude for the IMRPhenomD model.
@@ -26,6 +26,7 @@
 #include "LALSimIMRPhenomInternalUtils.h"
 #include "LALSimIMRPhenomUtils.h"
 #include "LALSimRingdownCW.h"
+#include "LALSimIMRMultiband.h"
 #include "LALSimIMRPhenomD_internals.c"
 
 /*
@@ -1385,6 +1386,62 @@ tried to apply shift of -1.0/deltaF with deltaF=%g.",
     return XLAL_SUCCESS;
 }
 
+/* Data needed to evaluate one (l,m) mode at arbitrary frequencies for multibanding */
+typedef struct tagPhenomHMMultibandData
+{
+    PhenomHMStorage *pHM;
+    UINT4 ell;
+    INT4 mm;
+    REAL8 phi0;
+    REAL8 t0;
+    LALDict *extraParams;
+} PhenomHMMultibandData;
+
+/* Multibanding callback: amplitude and phase of one hlm mode at geometric frequencies */
+static int IMRPhenomHMMultibandAmpPhase(REAL8 *amp, REAL8 *phase, const REAL8 *freqs, UINT4 n, void *params)
+{
+    PhenomHMMultibandData *d = (PhenomHMMultibandData *)params;
+
+    /* evaluate on all the given points: reuse the model storage with
+     * index bounds that cover the whole coarse sequence */
+    PhenomHMStorage pHM = *(d->pHM);
+    pHM.ind_min = 0;
+    pHM.ind_max = n;
+
+    REAL8Sequence *freqs_geom = XLALCreateREAL8Sequence(n);
+    REAL8Sequence *amps = XLALCreateREAL8Sequence(n);
+    REAL8Sequence *phases = XLALCreateREAL8Sequence(n);
+    if (!freqs_geom || !amps || !phases)
+    {
+        XLALDestroyREAL8Sequence(freqs_geom);
+        XLALDestroyREAL8Sequence(amps);
+        XLALDestroyREAL8Sequence(phases);
+        XLAL_ERROR(XLAL_ENOMEM);
+    }
+    memcpy(freqs_geom->data, freqs, n * sizeof(REAL8));
+
+    int retcode = IMRPhenomHMPhase(phases, freqs_geom, &pHM, d->ell, d->mm, d->extraParams);
+    if (retcode == XLAL_SUCCESS)
+        retcode = IMRPhenomHMAmplitude(amps, freqs_geom, &pHM, d->ell, d->mm, d->extraParams);
+    if (retcode == XLAL_SUCCESS)
+    {
+        for (UINT4 i = 0; i < n; i++)
+        {
+            REAL8 phase_term1 = -d->t0 * (freqs[i] - pHM.Mf_ref);
+            REAL8 phase_term2 = phases->data[i] - (d->mm * d->phi0);
+            amp[i] = amps->data[i];
+            phase[i] = -(phase_term1 + phase_term2);
+        }
+    }
+
+    XLALDestroyREAL8Sequence(freqs_geom);
+    XLALDestroyREAL8Sequence(amps);
+    XLALDestroyREAL8Sequence(phases);
+    XLAL_CHECK(XLAL_SUCCESS == retcode, XLAL_EFUNC, "IMRPhenomHM amplitude or phase evaluation failed");
+
+    return XLAL_SUCCESS;
+}
+
 /**
  * Function to compute the one hlm mode.
  * Note this is not static so that IMRPhenomPv3HM
@@ -1404,6 +1461,30 @@ int IMRPhenomHMEvaluateOnehlmMode(
 {
     int retcode;
 
+    /* uniformly sampled modes can be evaluated through multibanding */
+    REAL8 mband_threshold = XLALSimInspiralWaveformParamsLookupMultibandThreshold(extraParams);
+    if (pHM->freq_is_uniform == 1 && mband_threshold > 0 && pHM->ind_max > pHM->ind_min)
+    {
+        PhenomHMMultibandData mband_data;
+        mband_data.pHM = pHM;
+        mband_data.ell = ell;
+        mband_data.mm = mm;
+        mband_data.phi0 = phi0;
+        mband_data.t0 = IMRPhenomDComputet0(pHM->eta, pHM->chi1z, pHM->chi2z, pHM->finspin, extraParams);
+        mband_data.extraParams = extraParams;
+        REAL8 deltaMf = XLALSimPhenomUtilsHztoMf(pHM->deltaF, pHM->Mtot);
+        retcode = XLALSimIMRMultibandEvaluate(
+            (*hlm)->data->data + pHM->ind_min,
+            freqs_geom->data[pHM->ind_min], deltaMf,
+            pHM->ind_max - pHM->ind_min,
+            mband_threshold,
+            XLALSimInspiralWaveformParamsLookupMultibandAmpInterpol(extraParams),
+            IMRPhenomHMMultibandAmpPhase, &mband_data);
+        XLAL_CHECK(XLAL_SUCCESS == retcode,
+                   XLAL_EFUNC, "XLALSimIMRMultibandEvaluate failed for IMRPhenomHM");
+        return XLAL_SUCCESS;
+    }
+
     /* generate phase */
     retcode = 0;
     retcode = IMRPhenomHMPhase(
@@ -70,6 +70,38 @@ IMRPhenomX_UsefulPowers powers_of_lalpi;
 #define omp ignore
 #endif
 
+/* Core of IMRPhenomXASGenerateFD(); writes either h22 or single-precision polarizations */
+static int IMRPhenomXASGenerateFDOutput(
+  COMPLEX16FrequencySeries **htilde22,
+  COMPLEX8FrequencySeries **hptilde8,
+  COMPLEX8FrequencySeries **hctilde8,
+  COMPLEX16 plusFactor,
+  COMPLEX16 crossFactor,
+  const REAL8Sequence *freqs_In,
+  IMRPhenomXWaveformStruct *pWF,
+  LALDict *lalParams
+);
+
+/* Shared driver of XLALSimIMRPhenomXASGenerateFD() and XLALSimIMRPhenomXASGenerateFDCOMPLEX8() */
+static int IMRPhenomXASGenerateFDUniform(
+  COMPLEX16FrequencySeries **htilde22,
+  COMPLEX8FrequencySeries **hptilde8,
+  COMPLEX8FrequencySeries **hctilde8,
+  COMPLEX16 plusFactor,
+  COMPLEX16 crossFactor,
+  REAL8 m1_SI,
+  REAL8 m2_SI,
+  REAL8 chi1L,
+  REAL8 chi2L,
+  REAL8 distance,
+  REAL8 f_min,
+  REAL8 f_max,
+  REAL8 deltaF,
+  REAL8 phi0,
+  REAL8 fRef_In,
+  LALDict *lalParams
+);
+
 /* ******** ALIGNED SPIN IMR PHENOMENOLOGICAL WAVEFORM: IMRPhenomXAS ********* */
 
 /* EXTERNAL ROUTINES */
@@ -187,123 +219,37 @@ int XLALSimIMRPhenomXASGenerateFD(
   LALDict *lalParams                   /**< LAL Dictionary */
 )
 {
-  UINT4 status;
-
-  /* Set debug status here */
-  UINT4 debug = PHENOMXDEBUG;
-
-  if(debug)
-  {
-    printf("fRef_In : %e\n",fRef_In);
-    printf("m1_SI   : %e\n",m1_SI);
-    printf("m2_SI   : %e\n",m2_SI);
-    printf("chi1L   : %e\n",chi1L);
-    printf("chi2L   : %e\n\n",chi2L);
-    printf("Performing sanity checks...\n");
-  }
-
-  /* Perform initial sanity checks */
-  if(*htilde22)       { XLAL_CHECK(NULL != htilde22, XLAL_EFAULT);                                   }
-  if(fRef_In  <  0.0) { XLAL_ERROR(XLAL_EDOM, "fRef_In must be positive or set to 0 to ignore.\n");  }
-  if(deltaF   <= 0.0) { XLAL_ERROR(XLAL_EDOM, "deltaF must be positive.\n");                         }
-  if(m1_SI    <= 0.0) { XLAL_ERROR(XLAL_EDOM, "m1 must be positive.\n");                             }
-  if(m2_SI    <= 0.0) { XLAL_ERROR(XLAL_EDOM, "m2 must be positive.\n");                             }
-  if(f_min    <= 0.0) { XLAL_ERROR(XLAL_EDOM, "f_min must be positive.\n");                          }
-  if(f_max    <  0.0) { XLAL_ERROR(XLAL_EDOM, "f_max must be non-negative.\n");                      }
-  if(distance <  0.0) { XLAL_ERROR(XLAL_EDOM, "Distance must be positive and greater than 0.\n");    }
-
-  /*
-  	Perform a basic sanity check on the region of the parameter space in which model is evaluated. Behaviour is as follows:
-  		- For mass ratios <= 20.0 and spins <= 0.99: no warning messages.
-  		- For 1000 > mass ratio > 20 and spins <= 0.99: print a warning message that we are extrapolating outside of *NR* calibration domain.
-  		- For mass ratios > 1000: throw a hard error that model is not valid.
-  		- For spins > 0.99: throw a warning that we are extrapolating the model to extremal
-
-  */
-  REAL8 mass_ratio;
-  if(m1_SI > m2_SI)
-  {
-	  mass_ratio = m1_SI / m2_SI;
-  }
-  else
-  {
-	  mass_ratio = m2_SI / m1_SI;
-  }
-  if(mass_ratio > 20.0  ) { XLAL_PRINT_INFO("Warning: Extrapolating outside of Numerical Relativity calibration domain."); }
-  if(mass_ratio > 1000. && fabs(mass_ratio - 1000) > 1e-12) { XLAL_ERROR(XLAL_EDOM, "ERROR: Model not valid at mass ratios beyond 1000."); } // The 1e-12 is to avoid rounding errors
-  if(fabs(chi1L) > 0.99 || fabs(chi2L) > 0.99) { XLAL_PRINT_INFO("Warning: Extrapolating to extremal spins, model is not trusted."); }
-
-  /* If no reference frequency is given, set it to the starting gravitational wave frequency */
-  REAL8 fRef = (fRef_In == 0.0) ? f_min : fRef_In;
-
-
-  if(debug)
-  {
-    printf("\n\n **** Initializing waveform struct... **** \n\n");
-  }
-
-
-  /* Initialize the useful powers of LAL_PI */
-  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
-  XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
-
-  /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
-  IMRPhenomXWaveformStruct *pWF;
-  pWF    = XLALMalloc(sizeof(IMRPhenomXWaveformStruct));
-  status = IMRPhenomXSetWaveformVariables(pWF, m1_SI, m2_SI, chi1L, chi2L, deltaF, fRef, phi0, f_min, f_max, distance, 0.0, lalParams, debug);
-  XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Error: IMRPhenomXSetWaveformVariables failed.\n");
-
-  /*
-      Create a REAL8 frequency series.
-      Use fLow, fHigh, deltaF to compute frequency sequence. Only pass the boundaries (fMin, fMax).
-  */
-  REAL8Sequence *freqs = XLALCreateREAL8Sequence(2);
-  freqs->data[0] = pWF->fMin;
-  freqs->data[1] = pWF->f_max_prime;
-
-
-  if(debug)
-  {
-    printf("\n\n **** Calling IMRPhenomXASGenerateFD... **** \n\n");
-  }
-
-  /* We now call the core IMRPhenomXAS waveform generator */
-  status = IMRPhenomXASGenerateFD(htilde22, freqs, pWF, lalParams);
-  XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXASFDCore failed to generate IMRPhenomX waveform.");
-
-  if(debug)
-  {
-    printf("\n\n **** Call to IMRPhenomXASGenerateFD complete. **** \n\n");
-  }
-
-  /*
-      We now resize htilde22 if our waveform was generated to a cut-off frequency below
-      the desired maximum frequency. Simply fill the remaining frequencies with zeros.
-  */
-  REAL8 lastfreq;
-  if (pWF->f_max_prime < pWF->fMax)
-  {
-    /*
-        As the user has requested an f_max > Mf = fCut,
-        we resize the frequency series to fill with zeros beyond the cutoff frequency.
-    */
-    lastfreq = pWF->fMax;
-  }
-  else{  // We have to look for a power of 2 anyway.
-    lastfreq = pWF->f_max_prime;
-  }
-  /* Enforce length to be a power of 2 + 1 */
-  size_t n_full = NextPow2(lastfreq / pWF->deltaF) + 1;
-  size_t n = (*htilde22)->data->length;
-
-  /* Resize the COMPLEX16 frequency series */
-  *htilde22 = XLALResizeCOMPLEX16FrequencySeries(*htilde22, 0, n_full);
-  XLAL_CHECK (*htilde22, XLAL_ENOMEM, "Failed to resize waveform COMPLEX16FrequencySeries of length %zu (for internal fCut=%f) to new length %zu (for user-requested f_max=%f).", n, pWF->fCut, n_full, pWF->fMax );
-
+  XLAL_CHECK(NULL != htilde22, XLAL_EFAULT);
+  return IMRPhenomXASGenerateFDUniform(htilde22, NULL, NULL, 0., 0., m1_SI, m2_SI, chi1L, chi2L, distance, f_min, f_max, deltaF, phi0, fRef_In, lalParams);
+}
 
-  LALFree(pWF);
-  XLALDestroyREAL8Sequence(freqs);
-  return XLAL_SUCCESS;
+/**
+ * Single-precision variant of XLALSimIMRPhenomXASGenerateFD().
+ *
+ * Returns hptilde = plusFactor * h22 and hctilde = crossFactor * h22 as
+ * COMPLEX8 frequency series, where h22 is the mode returned by
+ * XLALSimIMRPhenomXASGenerateFD().  Amplitude and phase are evaluated in
+ * double precision and each sample is rounded once when it is stored.
+ */
+int XLALSimIMRPhenomXASGenerateFDCOMPLEX8(
+  COMPLEX8FrequencySeries **hptilde,   /**< [out] FD plus polarization */
+  COMPLEX8FrequencySeries **hctilde,   /**< [out] FD cross polarization */
+  REAL8 m1_SI,                         /**< Mass of companion 1 (kg) */
+  REAL8 m2_SI,                         /**< Mass of companion 2 (kg) */
+  REAL8 chi1L,                         /**< Dimensionless aligned spin of companion 1 */
+  REAL8 chi2L,                         /**< Dimensionless aligned spin of companion 2 */
+  REAL8 distance,                      /**< Luminosity distance (m) */
+  REAL8 f_min,                         /**< Starting GW frequency (Hz) */
+  REAL8 f_max,                         /**< End frequency; 0 defaults to Mf = 0.3 */
+  REAL8 deltaF,                        /**< Sampling frequency (Hz) */
+  REAL8 phi0,                          /**< Orbital phase at fRef (rad) */
+  REAL8 fRef_In,                       /**< Reference frequency (Hz) */
+  COMPLEX16 plusFactor,                /**< factor multiplying h22 in the plus polarization */
+  COMPLEX16 crossFactor,               /**< factor multiplying h22 in the cross polarization */
+  LALDict *lalParams                   /**< LAL Dictionary */
+)
+{
+  return IMRPhenomXASGenerateFDUniform(NULL, hptilde, hctilde, plusFactor, crossFactor, m1_SI, m2_SI, chi1L, chi2L, distance, f_min, f_max, deltaF, phi0, fRef_In, lalParams);
 }
 
 
@@ -496,6 +442,165 @@ int XLALSimIMRPhenomXASGenerateFD(
  /** @} */
 
 
+static int IMRPhenomXASGenerateFDUniform(
+  COMPLEX16FrequencySeries **htilde22, /**< [out] FD waveform, or NULL to return single-precision polarizations */
+  COMPLEX8FrequencySeries **hptilde8,  /**< [out] single-precision plus polarization plusFactor * h22 */
+  COMPLEX8FrequencySeries **hctilde8,  /**< [out] single-precision cross polarization crossFactor * h22 */
+  COMPLEX16 plusFactor,                /**< factor multiplying h22 in hptilde8 */
+  COMPLEX16 crossFactor,               /**< factor multiplying h22 in hctilde8 */
+  REAL8 m1_SI,                         /**< Mass of companion 1 (kg) */
+  REAL8 m2_SI,                         /**< Mass of companion 2 (kg) */
+  REAL8 chi1L,                         /**< Dimensionless aligned spin of companion 1 */
+  REAL8 chi2L,                         /**< Dimensionless aligned spin of companion 2 */
+  REAL8 distance,                      /**< Luminosity distance (m) */
+  REAL8 f_min,                         /**< Starting GW frequency (Hz) */
+  REAL8 f_max,                         /**< End frequency; 0 defaults to Mf = 0.3 */
+  REAL8 deltaF,                        /**< Sampling frequency (Hz) */
+  REAL8 phi0,                          /**< Orbital phase at fRef (rad) */
+  REAL8 fRef_In,                       /**< Reference frequency (Hz) */
+  LALDict *lalParams                   /**< LAL Dictionary */
+)
+{
+  UINT4 status;
+
+  /* Set debug status here */
+  UINT4 debug = PHENOMXDEBUG;
+
+  if(debug)
+  {
+    printf("fRef_In : %e\n",fRef_In);
+    printf("m1_SI   : %e\n",m1_SI);
+    printf("m2_SI   : %e\n",m2_SI);
+    printf("chi1L   : %e\n",chi1L);
+    printf("chi2L   : %e\n\n",chi2L);
+    printf("Performing sanity checks...\n");
+  }
+
+  /* Perform initial sanity checks */
+  if(htilde22)
+  {
+    if(*htilde22)     { XLAL_CHECK(NULL != htilde22, XLAL_EFAULT);                                   }
+  }
+  else
+  {
+    XLAL_CHECK(hptilde8 && hctilde8, XLAL_EFAULT);
+    XLAL_CHECK(*hptilde8 == NULL && *hctilde8 == NULL, XLAL_EFAULT);
+  }
+  if(fRef_In  <  0.0) { XLAL_ERROR(XLAL_EDOM, "fRef_In must be positive or set to 0 to ignore.\n");  }
+  if(deltaF   <= 0.0) { XLAL_ERROR(XLAL_EDOM, "deltaF must be positive.\n");                         }
+  if(m1_SI    <= 0.0) { XLAL_ERROR(XLAL_EDOM, "m1 must be positive.\n");                             }
+  if(m2_SI    <= 0.0) { XLAL_ERROR(XLAL_EDOM, "m2 must be positive.\n");                             }
+  if(f_min    <= 0.0) { XLAL_ERROR(XLAL_EDOM, "f_min must be positive.\n");                          }
+  if(f_max    <  0.0) { XLAL_ERROR(XLAL_EDOM, "f_max must be non-negative.\n");                      }
+  if(distance <  0.0) { XLAL_ERROR(XLAL_EDOM, "Distance must be positive and greater than 0.\n");    }
+
+  /*
+  	Perform a basic sanity check on the region of the parameter space in which model is evaluated. Behaviour is as follows:
+  		- For mass ratios <= 20.0 and spins <= 0.99: no warning messages.
+  		- For 1000 > mass ratio > 20 and spins <= 0.99: print a warning message that we are extrapolating outside of *NR* calibration domain.
+  		- For mass ratios > 1000: throw a hard error that model is not valid.
+  		- For spins > 0.99: throw a warning that we are extrapolating the model to extremal
+
+  */
+  REAL8 mass_ratio;
+  if(m1_SI > m2_SI)
+  {
+	  mass_ratio = m1_SI / m2_SI;
+  }
+  else
+  {
+	  mass_ratio = m2_SI / m1_SI;
+  }
+  if(mass_ratio > 20.0  ) { XLAL_PRINT_INFO("Warning: Extrapolating outside of Numerical Relativity calibration domain."); }
+  if(mass_ratio > 1000. && fabs(mass_ratio - 1000) > 1e-12) { XLAL_ERROR(XLAL_EDOM, "ERROR: Model not valid at mass ratios beyond 1000."); } // The 1e-12 is to avoid rounding errors
+  if(fabs(chi1L) > 0.99 || fabs(chi2L) > 0.99) { XLAL_PRINT_INFO("Warning: Extrapolating to extremal spins, model is not trusted."); }
+
+  /* If no reference frequency is given, set it to the starting gravitational wave frequency */
+  REAL8 fRef = (fRef_In == 0.0) ? f_min : fRef_In;
+
+
+  if(debug)
+  {
+    printf("\n\n **** Initializing waveform struct... **** \n\n");
+  }
+
+
+  /* Initialize the useful powers of LAL_PI */
+  status = IMRPhenomX_Initialize_Powers(&powers_of_lalpi, LAL_PI);
+  XLAL_CHECK(XLAL_SUCCESS == status, status, "Failed to initialize useful powers of LAL_PI.");
+
+  /* Initialize IMR PhenomX Waveform struct and check that it initialized correctly */
+  IMRPhenomXWaveformStruct *pWF;
+  pWF    = XLALMalloc(sizeof(IMRPhenomXWaveformStruct));
+  status = IMRPhenomXSetWaveformVariables(pWF, m1_SI, m2_SI, chi1L, chi2L, deltaF, fRef, phi0, f_min, f_max, distance, 0.0, lalParams, debug);
+  XLAL_CHECK(XLAL_SUCCESS == status, XLAL_EFUNC, "Error: IMRPhenomXSetWaveformVariables failed.\n");
+
+  /*
+      Create a REAL8 frequency series.
+      Use fLow, fHigh, deltaF to compute frequency sequence. Only pass the boundaries (fMin, fMax).
+  */
+  REAL8Sequence *freqs = XLALCreateREAL8Sequence(2);
+  freqs->data[0] = pWF->fMin;
+  freqs->data[1] = pWF->f_max_prime;
+
+
+  if(debug)
+  {
+    printf("\n\n **** Calling IMRPhenomXASGenerateFD... **** \n\n");
+  }
+
+  /* We now call the core IMRPhenomXAS waveform generator */
+  status = IMRPhenomXASGenerateFDOutput(htilde22, hptilde8, hctilde8, plusFactor, crossFactor, freqs, pWF, lalParams);
+  XLAL_CHECK(status == XLAL_SUCCESS, XLAL_EFUNC, "IMRPhenomXASFDCore failed to generate IMRPhenomX waveform.");
+
+  if(debug)
+  {
+    printf("\n\n **** Call to IMRPhenomXASGenerateFD complete. **** \n\n");
+  }
+
+  /*
+      We now resize htilde22 if our waveform was generated to a cut-off frequency below
+      the desired maximum frequency. Simply fill the remaining frequencies with zeros.
+  */
+  REAL8 lastfreq;
+  if (pWF->f_max_prime < pWF->fMax)
+  {
+    /*
+        As the user has requested an f_max > Mf = fCut,
+        we resize the frequency series to fill with zeros beyond the cutoff frequency.
+    */
+    lastfreq = pWF->fMax;
+  }
+  else{  // We have to look for a power of 2 anyway.
+    lastfreq = pWF->f_max_prime;
+  }
+  /* Enforce length to be a power of 2 + 1 */
+  size_t n_full = NextPow2(lastfreq / pWF->deltaF) + 1;
+  if(htilde22)
+  {
+    size_t n = (*htilde22)->data->length;
+
+    /* Resize the COMPLEX16 frequency series */
+    *htilde22 = XLALResizeCOMPLEX16FrequencySeries(*htilde22, 0, n_full);
+    XLAL_CHECK (*htilde22, XLAL_ENOMEM, "Failed to resize waveform COMPLEX16FrequencySeries of length %zu (for internal fCut=%f) to new length %zu (for user-requested f_max=%f).", n, pWF->fCut, n_full, pWF->fMax );
+  }
+  else
+  {
+    size_t n = (*hptilde8)->data->length;
+
+    /* Resize the COMPLEX8 frequency series */
+    *hptilde8 = XLALResizeCOMPLEX8FrequencySeries(*hptilde8, 0, n_full);
+    *hctilde8 = XLALResizeCOMPLEX8FrequencySeries(*hctilde8, 0, n_full);
+    XLAL_CHECK (*hptilde8 && *hctilde8, XLAL_ENOMEM, "Failed to resize waveform COMPLEX8FrequencySeries of length %zu (for internal fCut=%f) to new length %zu (for user-requested f_max=%f).", n, pWF->fCut, n_full, pWF->fMax );
+  }
+
+
+  LALFree(pWF);
+  XLALDestroyREAL8Sequence(freqs);
+  return XLAL_SUCCESS;
+}
+
+
  /* *********************************************************************************
   *
   * The following private function generates an IMRPhenomX frequency-domain waveform
@@ -504,12 +609,66 @@ int XLALSimIMRPhenomXASGenerateFD(
   *   - Physical parameters are passed via the waveform struct
   * *********************************************************************************
   */
+/* Allocates and zeroes either h22 or the single-precision polarizations */
+static int IMRPhenomXASAllocateOutput(
+  COMPLEX16FrequencySeries **htilde22,
+  COMPLEX8FrequencySeries **hptilde8,
+  COMPLEX8FrequencySeries **hctilde8,
+  const char *name,
+  const LIGOTimeGPS *epoch,
+  REAL8 f0,
+  REAL8 deltaF,
+  size_t npts
+)
+{
+  if (htilde22)
+  {
+    *htilde22 = XLALCreateCOMPLEX16FrequencySeries(name, epoch, f0, deltaF, &lalStrainUnit, npts);
+    XLAL_CHECK(*htilde22, XLAL_ENOMEM);
+    memset((*htilde22)->data->data, 0, npts * sizeof(COMPLEX16));
+    XLALUnitMultiply(&((*htilde22)->sampleUnits), &((*htilde22)->sampleUnits), &lalSecondUnit);
+    return XLAL_SUCCESS;
+  }
+  *hptilde8 = XLALCreateCOMPLEX8FrequencySeries("hptilde: FD waveform", epoch, f0, deltaF, &lalStrainUnit, npts);
+  *hctilde8 = XLALCreateCOMPLEX8FrequencySeries("hctilde: FD waveform", epoch, f0, deltaF, &lalStrainUnit, npts);
+  if (!*hptilde8 || !*hctilde8)
+  {
+    XLALDestroyCOMPLEX8FrequencySeries(*hptilde8);
+    XLALDestroyCOMPLEX8FrequencySeries(*hctilde8);
+    *hptilde8 = *hctilde8 = NULL;
+    XLAL_ERROR(XLAL_ENOMEM);
+  }
+  memset((*hptilde8)->data->data, 0, npts * sizeof(COMPLEX8));
+  memset((*hctilde8)->data->data, 0, npts * sizeof(COMPLEX8));
+  XLALUnitMultiply(&((*hptilde8)->sampleUnits), &((*hptilde8)->sampleUnits), &lalSecondUnit);
+  XLALUnitMultiply(&((*hctilde8)->sampleUnits), &((*hctilde8)->sampleUnits), &lalSecondUnit);
+  return XLAL_SUCCESS;
+}
+
 int IMRPhenomXASGenerateFD(
   COMPLEX16FrequencySeries **htilde22, /**< [out] FD waveform           */
   const REAL8Sequence *freqs_In,       /**< Input frequency grid        */
   IMRPhenomXWaveformStruct *pWF,       /**< IMRPhenomX Waveform Struct  */
   LALDict *lalParams                   /**< LAL Dictionary Structure    */
 )
+{
+  return IMRPhenomXASGenerateFDOutput(htilde22, NULL, NULL, 0., 0., freqs_In, pWF, lalParams);
+}
+
+/*
+ * If htilde22 is NULL, the polarizations plusFactor * h22 and crossFactor * h22
+ * are written to the single-precision series hptilde8 and hctilde8 instead.
+ */
+static int IMRPhenomXASGenerateFDOutput(
+  COMPLEX16FrequencySeries **htilde22, /**< [out] FD waveform, or NULL */
+  COMPLEX8FrequencySeries **hptilde8,  /**< [out] single-precision plus polarization */
+  COMPLEX8FrequencySeries **hctilde8,  /**< [out] single-precision cross polarization */
+  COMPLEX16 plusFactor,                /**< factor multiplying h22 in hptilde8 */
+  COMPLEX16 crossFactor,               /**< factor multiplying h22 in hctilde8 */
+  const REAL8Sequence *freqs_In,       /**< Input frequency grid        */
+  IMRPhenomXWaveformStruct *pWF,       /**< IMRPhenomX Waveform Struct  */
+  LALDict *lalParams                   /**< LAL Dictionary Structure    */
+)
 {
   /* Inherits debug flag from waveform struct */
   UINT4 debug = PHENOMXDEBUG;
@@ -578,10 +737,10 @@ int IMRPhenomXASGenerateFD(
     XLAL_CHECK(XLALGPSAdd(&ligotimegps_zero, -1. / pWF->deltaF ), XLAL_EFUNC, "Failed to shift the coalescence time to t=0. Tried to apply a shift of -1/df with df = %g.", pWF->deltaF);
 
     /* Initialize the htilde frequency series */
-    *htilde22 = XLALCreateCOMPLEX16FrequencySeries("htilde22: FD waveform",&ligotimegps_zero,0.0,pWF->deltaF,&lalStrainUnit,npts);
+    status = IMRPhenomXASAllocateOutput(htilde22, hptilde8, hctilde8, "htilde22: FD waveform", &ligotimegps_zero, 0.0, pWF->deltaF, npts);
 
     /* Check that frequency series generated okay */
-    XLAL_CHECK(*htilde22,XLAL_ENOMEM,"Failed to allocate COMPLEX16FrequencySeries of length %zu for f_max = %f, deltaF = %g.\n",npts,f_max,pWF->deltaF);
+    XLAL_CHECK(XLAL_SUCCESS == status,XLAL_ENOMEM,"Failed to allocate FrequencySeries of length %zu for f_max = %f, deltaF = %g.\n",npts,f_max,pWF->deltaF);
 
     /* Frequencies will be set using only the lower and upper bounds that we passed */
     size_t iStart = (size_t) (f_min / pWF->deltaF);
@@ -608,9 +767,9 @@ int IMRPhenomXASGenerateFD(
   {
     /* freqs is a frequency grid with non-uniform spacing, so we start at the lowest given frequency */
     npts      = freqs_In->length;
-    *htilde22 = XLALCreateCOMPLEX16FrequencySeries("htilde22: FD waveform, 22 mode", &ligotimegps_zero, f_min, pWF->deltaF, &lalStrainUnit, npts);
+    status = IMRPhenomXASAllocateOutput(htilde22, hptilde8, hctilde8, "htilde22: FD waveform, 22 mode", &ligotimegps_zero, f_min, pWF->deltaF, npts);
 
-    XLAL_CHECK (*htilde22, XLAL_ENOMEM, "Failed to allocated waveform COMPLEX16FrequencySeries of length %zu from sequence.", npts);
+    XLAL_CHECK (XLAL_SUCCESS == status, XLAL_ENOMEM, "Failed to allocated waveform FrequencySeries of length %zu from sequence.", npts);
 
     offset = 0;
     freqs  = XLALCreateREAL8Sequence(freqs_In->length);
@@ -628,8 +787,10 @@ int IMRPhenomXASGenerateFD(
     }
   }
 
-  memset((*htilde22)->data->data, 0, npts * sizeof(COMPLEX16));
-  XLALUnitMultiply(&((*htilde22)->sampleUnits), &((*htilde22)->sampleUnits), &lalSecondUnit);
+  /* Either h22 or the single-precision polarizations are written */
+  COMPLEX16 *data = htilde22 ? (*htilde22)->data->data : NULL;
+  COMPLEX8 *datap = htilde22 ? NULL : (*hptilde8)->data->data;
+  COMPLEX8 *datac = htilde22 ? NULL : (*hctilde8)->data->data;
 
   /* Check if LAL dictionary exists. If not, create a LAL dictionary. */
   INT4 lalParams_In = 0;
@@ -790,6 +951,7 @@ int IMRPhenomXASGenerateFD(
   {
     double Mf    = Msec * freqs->data[idx];   // Mf is declared locally inside the loop
     UINT4 jdx    = idx  + offset;             // jdx is declared locally inside the loop
+    COMPLEX16 h  = 0.0;                       // h22 at this frequency
 
     /* We do not want to generate the waveform at frequencies > f_max (default = 0.3 Mf) */
     if(Mf <= (pWF->f_max_prime * pWF->M_sec))
@@ -851,7 +1013,7 @@ int IMRPhenomXASGenerateFD(
         */
         if ( pWF->PhenomXOnlyReturnPhase ) {
           //
-          ((*htilde22)->data->data)[jdx] = phi;
+          h = phi;
         } else {
         /* Add NRTidal phase, if selected, code adapted from LALSimIMRPhenomP.c */
 
@@ -874,12 +1036,12 @@ int IMRPhenomXASGenerateFD(
               phaseTidal += pfaN * pPhase22->c3p5PN_tidal * powers_of_lalpi.two_thirds * powers_of_Mf.two_thirds;
           }
             /* Reconstruct waveform with NRTidal terms included: h(f) = [A(f) + A_tidal(f)] * Exp{I [phi(f) - phi_tidal(f)]} * window(f) */
-          ((*htilde22)->data->data)[jdx] = pWF->amp0 * (pWF->ampNorm * powers_of_Mf.m_seven_sixths * amp + 2*sqrt(1./5.)*powers_of_lalpi.sqrt * ampTidal) * cexp(I * (phi - phaseTidal))* window;
+          h = pWF->amp0 * (pWF->ampNorm * powers_of_Mf.m_seven_sixths * amp + 2*sqrt(1./5.)*powers_of_lalpi.sqrt * ampTidal) * cexp(I * (phi - phaseTidal))* window;
           
       } 
       else if (NRTidal_version == NoNRT_V) {
 	/* Reconstruct waveform: h(f) = A(f) * Exp[I phi(f)] */
-  	((*htilde22)->data->data)[jdx] = Amp0 * powers_of_Mf.m_seven_sixths * amp * cexp(I * phi);
+  	h = Amp0 * powers_of_Mf.m_seven_sixths * amp * cexp(I * phi);
         }
         else {
 	XLAL_PRINT_INFO("Warning: Only NRTidal, NRTidalv2, and NoNRT NRTidal_version values allowed and NRTidal is not implemented completely in IMRPhenomX*.");
@@ -891,9 +1053,18 @@ int IMRPhenomXASGenerateFD(
 
     {
         /* Mf > Mf_max, so return 0 */
-        ((*htilde22)->data->data)[jdx] = 0.0 + I*0.0;
+        h = 0.0 + I*0.0;
+    }
+
+    if (data)
+    {
+      data[jdx] = h;
+    }
+    else
+    {
+      datap[jdx] = plusFactor * h;
+      datac[jdx] = crossFactor * h;
     }
-    
   }
 
   // Free allocated memory
@@ -87,10 +87,24 @@ static int IMRPhenomXHMFDAddMode(
 );
 
 
+/* Single-precision counterpart of IMRPhenomXHMFDAddMode */
+static int IMRPhenomXHMFDAddModeCOMPLEX8(
+  COMPLEX8FrequencySeries *hptilde,   /**<[out] hp series*/
+  COMPLEX8FrequencySeries *hctilde,   /**<[out] hc series */
+  COMPLEX16FrequencySeries *hlmtilde, /**< hlm mode to add */
+  REAL8 theta,                        /**< Inclination [rad] */
+  REAL8 phi,                          /**< Azimuthal angle [rad]*/
+  INT4 l,                             /**< l index of the lm mode */
+  INT4 m,                             /**< m index of the lm mode */
+  INT4 sym                            /**< Equatorial symmetry */
+);
+
 /* Return hptilde and hctilde from a sum of modes */
 static int IMRPhenomXHM_MultiMode(
-  COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency domain h+ GW strain */
-  COMPLEX16FrequencySeries **hctilde, /**< [out] Frequency domain hx GW strain */
+  COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency domain h+ GW strain, or NULL */
+  COMPLEX16FrequencySeries **hctilde, /**< [out] Frequency domain hx GW strain, or NULL */
+  COMPLEX8FrequencySeries **hptilde8, /**< [out] single-precision h+, used if hptilde is NULL */
+  COMPLEX8FrequencySeries **hctilde8, /**< [out] single-precision hx, used if hctilde is NULL */
   REAL8 m1_SI,                        /**< primary mass [kg] */
   REAL8 m2_SI,                        /**< secondary mass [kg] */
   REAL8 chi1z,                        /**< aligned spin of primary */
@@ -1377,27 +1391,12 @@ int XLALSimIMRPhenomXHM_SpheroidalAmplitude(
 }
 
 
-/*********************************************/
-/*                                           */
-/*          MULTIMODE WAVEFORM               */
-/*                                           */
-/*********************************************/
-
-/** Returns the hptilde and hctilde of the multimode waveform for positive frequencies.
-
-XLALSimIMRPhenomXHM calls the function for a single mode that can be XLALSimIMRPhenomXHMGenerateFDOneMode or XLALSimIMRPhenomXHMMultiBandOneMode,
-depending on if the Multibanding is active or not.
-
-By default XLALSimIMRPhenomXHM is only used when the Multibanding is activated, since each mode has a different coarse frequency array and we can not recycle the array.
-
-This is just a wrapper of the function that actually carry out the calculations: IMRPhenomXHM_MultiMode2.
-
-*/
-
-/* Return hptilde, hctilde */
-int XLALSimIMRPhenomXHM(
-  COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency-domain waveform h+ */
-  COMPLEX16FrequencySeries **hctilde, /**< [out] Frequency-domain waveform hx */
+/* Shared driver of XLALSimIMRPhenomXHM and XLALSimIMRPhenomXHMCOMPLEX8: exactly one of the double or single-precision outputs is used */
+static int IMRPhenomXHMGenerateFD(
+  COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency-domain waveform h+, or NULL */
+  COMPLEX16FrequencySeries **hctilde, /**< [out] Frequency-domain waveform hx, or NULL */
+  COMPLEX8FrequencySeries **hptilde8, /**< [out] single-precision h+, used if hptilde is NULL */
+  COMPLEX8FrequencySeries **hctilde8, /**< [out] single-precision hx, used if hctilde is NULL */
   REAL8 m1_SI,                        /**< mass of companion 1 (kg) */
   REAL8 m2_SI,                        /**< mass of companion 2 (kg) */
   REAL8 chi1L,                        /**< z-component of the dimensionless spin of object 1 w.r.t. Lhat = (0,0,1) */
@@ -1417,10 +1416,6 @@ int XLALSimIMRPhenomXHM(
 
   /* Sanity checks on input parameters: check pointers, etc.
   More checks are done inside XLALSimIMRPhenomXHMGenerateFDOneMode/XLALSimIMRPhenomXHMMultiBandOneMode */
-  XLAL_CHECK(NULL != hptilde, XLAL_EFAULT);
-  XLAL_CHECK(NULL != hctilde, XLAL_EFAULT);
-  XLAL_CHECK(*hptilde == NULL, XLAL_EFAULT);
-  XLAL_CHECK(*hctilde == NULL, XLAL_EFAULT);
   XLAL_CHECK(distance > 0, XLAL_EDOM, "distance must be positive.\n");
   /*
   	Perform a basic sanity check on the region of the parameter space in which model is evaluated. Behaviour is as follows:
@@ -1451,6 +1446,8 @@ int XLALSimIMRPhenomXHM(
   retcode = IMRPhenomXHM_MultiMode(
     hptilde,
     hctilde,
+    hptilde8,
+    hctilde8,
     m1_SI,
     m2_SI,
     chi1L,
@@ -1473,6 +1470,83 @@ int XLALSimIMRPhenomXHM(
   return retcode;
 }
 
+/*********************************************/
+/*                                           */
+/*          MULTIMODE WAVEFORM               */
+/*                                           */
+/*********************************************/
+
+/** Returns the hptilde and hctilde of the multimode waveform for positive frequencies.
+
+XLALSimIMRPhenomXHM calls the function for a single mode that can be XLALSimIMRPhenomXHMGenerateFDOneMode or XLALSimIMRPhenomXHMMultiBandOneMode,
+depending on if the Multibanding is active or not.
+
+By default XLALSimIMRPhenomXHM is only used when the Multibanding is activated, since each mode has a different coarse frequency array and we can not recycle the array.
+
+This is just a wrapper of the function that actually carry out the calculations: IMRPhenomXHM_MultiMode2.
+
+*/
+
+/* Return hptilde, hctilde */
+int XLALSimIMRPhenomXHM(
+  COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency-domain waveform h+ */
+  COMPLEX16FrequencySeries **hctilde, /**< [out] Frequency-domain waveform hx */
+  REAL8 m1_SI,                        /**< mass of companion 1 (kg) */
+  REAL8 m2_SI,                        /**< mass of companion 2 (kg) */
+  REAL8 chi1L,                        /**< z-component of the dimensionless spin of object 1 w.r.t. Lhat = (0,0,1) */
+  REAL8 chi2L,                        /**< z-component of the dimensionless spin of object 2 w.r.t. Lhat = (0,0,1) */
+  REAL8 f_min,                        /**< Starting GW frequency (Hz) */
+  REAL8 f_max,                        /**< End frequency; 0 defaults to Mf = 0.3 */
+  REAL8 deltaF,                       /**< Sampling frequency (Hz) */
+  REAL8 distance,                     /**< distance of source (m) */
+  REAL8 inclination,                  /**< inclination of source (rad) */
+  REAL8 phiRef,                       /**< reference orbital phase (rad) */
+  REAL8 fRef_In,                      /**< Reference frequency */
+  LALDict *lalParams                  /**<linked list containing the extra parameters */
+)
+{
+  /* Sanity checks on input parameters: check pointers, etc.
+  More checks are done inside XLALSimIMRPhenomXHMGenerateFDOneMode/XLALSimIMRPhenomXHMMultiBandOneMode */
+  XLAL_CHECK(NULL != hptilde, XLAL_EFAULT);
+  XLAL_CHECK(NULL != hctilde, XLAL_EFAULT);
+  XLAL_CHECK(*hptilde == NULL, XLAL_EFAULT);
+  XLAL_CHECK(*hctilde == NULL, XLAL_EFAULT);
+
+  return IMRPhenomXHMGenerateFD(hptilde, hctilde, NULL, NULL, m1_SI, m2_SI, chi1L, chi2L, f_min, f_max, deltaF, distance, inclination, phiRef, fRef_In, lalParams);
+}
+
+/**
+ * Single-precision variant of XLALSimIMRPhenomXHM().
+ *
+ * Each mode is generated in double precision as in XLALSimIMRPhenomXHM() and
+ * is summed directly into the single-precision polarizations, so no
+ * double-precision copy of h+ and hx is ever held in memory.
+ */
+int XLALSimIMRPhenomXHMCOMPLEX8(
+  COMPLEX8FrequencySeries **hptilde,  /**< [out] Frequency-domain waveform h+ */
+  COMPLEX8FrequencySeries **hctilde,  /**< [out] Frequency-domain waveform hx */
+  REAL8 m1_SI,                        /**< mass of companion 1 (kg) */
+  REAL8 m2_SI,                        /**< mass of companion 2 (kg) */
+  REAL8 chi1L,                        /**< z-component of the dimensionless spin of object 1 w.r.t. Lhat = (0,0,1) */
+  REAL8 chi2L,                        /**< z-component of the dimensionless spin of object 2 w.r.t. Lhat = (0,0,1) */
+  REAL8 f_min,                        /**< Starting GW frequency (Hz) */
+  REAL8 f_max,                        /**< End frequency; 0 defaults to Mf = 0.3 */
+  REAL8 deltaF,                       /**< Sampling frequency (Hz) */
+  REAL8 distance,                     /**< distance of source (m) */
+  REAL8 inclination,                  /**< inclination of source (rad) */
+  REAL8 phiRef,                       /**< reference orbital phase (rad) */
+  REAL8 fRef_In,                      /**< Reference frequency */
+  LALDict *lalParams                  /**<linked list containing the extra parameters */
+)
+{
+  XLAL_CHECK(NULL != hptilde, XLAL_EFAULT);
+  XLAL_CHECK(NULL != hctilde, XLAL_EFAULT);
+  XLAL_CHECK(*hptilde == NULL, XLAL_EFAULT);
+  XLAL_CHECK(*hctilde == NULL, XLAL_EFAULT);
+
+  return IMRPhenomXHMGenerateFD(NULL, NULL, hptilde, hctilde, m1_SI, m2_SI, chi1L, chi2L, f_min, f_max, deltaF, distance, inclination, phiRef, fRef_In, lalParams);
+}
+
 /** Returns the hptilde and hctilde of the multimode waveform for positive frequencies.
 
 XLALSimIMRPhenomXHM2 builds each mode explicitly in the loop over modes, recycling some common quantities between modes like
@@ -1735,8 +1809,10 @@ int XLALSimIMRPhenomXHM2(
 /* Core function of XLALSimIMRPhenomXHM, returns hptilde, hctilde corresponding to a sum of modes.
 The default modes are 22, 21, 33, 32 and 44. It returns also the contribution of the corresponding negatives modes. */
 static int IMRPhenomXHM_MultiMode(
-  COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency domain h+ GW strain */
-  COMPLEX16FrequencySeries **hctilde, /**< [out] Frequency domain hx GW strain */
+  COMPLEX16FrequencySeries **hptilde, /**< [out] Frequency domain h+ GW strain, or NULL */
+  COMPLEX16FrequencySeries **hctilde, /**< [out] Frequency domain hx GW strain, or NULL */
+  COMPLEX8FrequencySeries **hptilde8, /**< [out] single-precision h+, used if hptilde is NULL */
+  COMPLEX8FrequencySeries **hctilde8, /**< [out] single-precision hx, used if hctilde is NULL */
   REAL8 m1_SI,                        /**< primary mass [kg] */
   REAL8 m2_SI,                        /**< secondary mass [kg] */
   REAL8 chi1z,                        /**< aligned spin of primary */
@@ -1881,14 +1957,27 @@ static int IMRPhenomXHM_MultiMode(
         /* Coalescence time is fixed to t=0, shift by overall length in time. Model is calibrated such that it peaks approx 500M before the end of the waveform, add this time to the epoch. */
         XLAL_CHECK(XLALGPSAdd(&ligotimegps_zero, -1. / deltaF), XLAL_EFUNC, "Failed to shift the coalescence time to t=0. Tried to apply a shift of -1/df with df = %g.", deltaF);
         size_t n = (htildelm)->data->length;
-        *hptilde = XLALCreateCOMPLEX16FrequencySeries("hptilde: FD waveform", &(ligotimegps_zero), 0.0, deltaF, &lalStrainUnit, n);
-        if (!(hptilde)){  XLAL_ERROR(XLAL_EFUNC);}
-        memset((*hptilde)->data->data, 0, n * sizeof(COMPLEX16));
-        XLALUnitMultiply(&(*hptilde)->sampleUnits, &(*hptilde)->sampleUnits, &lalSecondUnit);
-        *hctilde = XLALCreateCOMPLEX16FrequencySeries("hctilde: FD waveform",  &(ligotimegps_zero), 0.0, deltaF, &lalStrainUnit, n);
-        if (!(hctilde)){ XLAL_ERROR(XLAL_EFUNC);}
-        memset((*hctilde)->data->data, 0, n * sizeof(COMPLEX16));
-        XLALUnitMultiply(&(*hctilde)->sampleUnits, &(*hctilde)->sampleUnits, &lalSecondUnit);
+        if (hptilde) {
+          *hptilde = XLALCreateCOMPLEX16FrequencySeries("hptilde: FD waveform", &(ligotimegps_zero), 0.0, deltaF, &lalStrainUnit, n);
+          if (!(hptilde)){  XLAL_ERROR(XLAL_EFUNC);}
+          memset((*hptilde)->data->data, 0, n * sizeof(COMPLEX16));
+          XLALUnitMultiply(&(*hptilde)->sampleUnits, &(*hptilde)->sampleUnits, &lalSecondUnit);
+          *hctilde = XLALCreateCOMPLEX16FrequencySeries("hctilde: FD waveform",  &(ligotimegps_zero), 0.0, deltaF, &lalStrainUnit, n);
+          if (!(hctilde)){ XLAL_ERROR(XLAL_EFUNC);}
+          memset((*hctilde)->data->data, 0, n * sizeof(COMPLEX16));
+          XLALUnitMultiply(&(*hctilde)->sampleUnits, &(*hctilde)->sampleUnits, &lalSecondUnit);
+        }
+        else {
+          /* Modes are still generated in double precision; only the mode sum is stored in single precision */
+          *hptilde8 = XLALCreateCOMPLEX8FrequencySeries("hptilde: FD waveform", &(ligotimegps_zero), 0.0, deltaF, &lalStrainUnit, n);
+          if (!(*hptilde8)){  XLAL_ERROR(XLAL_EFUNC);}
+          memset((*hptilde8)->data->data, 0, n * sizeof(COMPLEX8));
+          XLALUnitMultiply(&(*hptilde8)->sampleUnits, &(*hptilde8)->sampleUnits, &lalSecondUnit);
+          *hctilde8 = XLALCreateCOMPLEX8FrequencySeries("hctilde: FD waveform",  &(ligotimegps_zero), 0.0, deltaF, &lalStrainUnit, n);
+          if (!(*hctilde8)){ XLAL_ERROR(XLAL_EFUNC);}
+          memset((*hctilde8)->data->data, 0, n * sizeof(COMPLEX8));
+          XLALUnitMultiply(&(*hctilde8)->sampleUnits, &(*hctilde8)->sampleUnits, &lalSecondUnit);
+        }
         init = 1;
       }
       /* Skip 22 mode if it was only required for the mixing of the 32 */
@@ -1897,15 +1986,18 @@ static int IMRPhenomXHM_MultiMode(
       }
       /* Add the hl-m mode to hptilde and hctilde. */
       else{     // According to LAL documentation the azimuthal angle phi = pi/2 - phiRef. This is not taken into account in PhenomD and that's why there is an dephasing of Pi/2 between PhenomD and SEOBNRv4
+          INT4 addemm = emm, addsym = sym;
           if(posMode==1 && negMode!=1){
-            status = IMRPhenomXHMFDAddMode(*hptilde, *hctilde, htildelm, inclination, LAL_PI_2 , ell, emm, 0);  // add only the positive mode
+            addsym = 0;  // add only the positive mode
           }
           else if(posMode!=1 && negMode==1){
-            status = IMRPhenomXHMFDAddMode(*hptilde, *hctilde, htildelm, inclination, LAL_PI_2 , ell, -emm, 0);  // add only the negative mode
-          }
-          else{
-            status = IMRPhenomXHMFDAddMode(*hptilde, *hctilde, htildelm, inclination, LAL_PI_2 , ell, emm, sym);    // add both positive and negative modes
+            addemm = -emm; addsym = 0;  // add only the negative mode
           }
+          // otherwise add both positive and negative modes
+          if (hptilde)
+            status = IMRPhenomXHMFDAddMode(*hptilde, *hctilde, htildelm, inclination, LAL_PI_2 , ell, addemm, addsym);
+          else
+            status = IMRPhenomXHMFDAddModeCOMPLEX8(*hptilde8, *hctilde8, htildelm, inclination, LAL_PI_2 , ell, addemm, addsym);
     }
     XLALDestroyCOMPLEX16FrequencySeries(htildelm);
   }//Loop over emm
@@ -2278,11 +2370,10 @@ static int IMRPhenomXHM_MultiMode2(
 }
 
 
-/* Function to sum one mode (htildelm) to hp/c tilde */
-static int IMRPhenomXHMFDAddMode(
-  COMPLEX16FrequencySeries *hptilde,  /**<[out] hp series*/
-  COMPLEX16FrequencySeries *hctilde,  /**<[out] hc series */
-  COMPLEX16FrequencySeries *htildelm, /**< hlm mode to add */
+/* Factors such that hp += factorp * hlm and hc += factorc * hlm when adding one mode */
+static void IMRPhenomXHMFDModeFactors(
+  COMPLEX16 *factorp,                 /**<[out] factor for hp */
+  COMPLEX16 *factorc,                 /**<[out] factor for hc */
   REAL8 theta,                        /**< Inclination [rad] */
   REAL8 phi,                          /**< Azimuthal angle [rad]*/
   INT4 l,                             /**< l index of the lm mode */
@@ -2290,8 +2381,6 @@ static int IMRPhenomXHMFDAddMode(
   INT4 sym                            /**< Equatorial symmetry */
 ){
   COMPLEX16 Ystar, Ym;
-  UINT4 j;
-  COMPLEX16 hlm; /* helper variable that contains a single point of hlmtilde */
 
   INT4 minus1l; /* (-1)^l */
   if (l % 2 !=0)
@@ -2303,50 +2392,87 @@ static int IMRPhenomXHMFDAddMode(
     minus1l = 1;
   }
 
-  Ym = XLALSpinWeightedSphericalHarmonic(theta, phi, -2, l, -m);
-
   if (sym)
   {
 	/* Equatorial symmetry: add in -m and m mode */
+    Ym = XLALSpinWeightedSphericalHarmonic(theta, phi, -2, l, -m);
     Ystar = conj(XLALSpinWeightedSphericalHarmonic(theta, phi, -2, l, m));
-    COMPLEX16 factorp = 0.5 * (Ym + minus1l * Ystar);
-    COMPLEX16 factorc = I * 0.5 * ( Ym - minus1l * Ystar);
-
-	#if DEBUG == 1
-    printf("\nfactorp = %.16e", cabs(factorp));
-    printf("\nfactorc = %.16e",cabs(factorc));
-    printf("\nhtildelm length = %i\n", htildelm->data->length);
-    printf("\nhp/hc tilde length = %i %i\n", hptilde->data->length,hptilde->data->length);
-	#endif
-
-    for (j = 0; j < htildelm->data->length; ++j) {
-      hlm = htildelm->data->data[j];
-      hptilde->data->data[j] += (factorp * hlm);
-      hctilde->data->data[j] += (factorc * hlm);
-    }
+    *factorp = 0.5 * (Ym + minus1l * Ystar);
+    *factorc = I * 0.5 * ( Ym - minus1l * Ystar);
   }
   else  // only positives or negative modes
   {
-     COMPLEX16 Ylm, factorp, factorc;
+     COMPLEX16 Ylm;
      if (m >0){  // only m>0
        Ylm = conj(XLALSpinWeightedSphericalHarmonic(theta, phi, -2, l, m));
-       factorp = 0.5*minus1l*Ylm;
-       factorc = -I*0.5*minus1l*Ylm;
+       *factorp = 0.5*minus1l*Ylm;
+       *factorc = -I*0.5*minus1l*Ylm;
      }
      else{   // only m<0
        Ylm = XLALSpinWeightedSphericalHarmonic(theta, phi, -2, l, m);
-       factorp = 0.5*Ylm;
-       factorc = I*0.5*Ylm;
+       *factorp = 0.5*Ylm;
+       *factorc = I*0.5*Ylm;
      }
+  }
 
-    COMPLEX16* datap = hptilde->data->data;
-    COMPLEX16* datac = hctilde->data->data;
+  #if DEBUG == 1
+  printf("\nfactorp = %.16e", cabs(*factorp));
+  printf("\nfactorc = %.16e",cabs(*factorc));
+  #endif
+}
 
-    for ( j = 0; j < htildelm->data->length; ++j ) {
-      hlm = (htildelm->data->data[j]);
-      datap[j] += factorp*hlm;
-      datac[j] += factorc*hlm;
-    }
+/* Function to sum one mode (htildelm) to hp/c tilde */
+static int IMRPhenomXHMFDAddMode(
+  COMPLEX16FrequencySeries *hptilde,  /**<[out] hp series*/
+  COMPLEX16FrequencySeries *hctilde,  /**<[out] hc series */
+  COMPLEX16FrequencySeries *htildelm, /**< hlm mode to add */
+  REAL8 theta,                        /**< Inclination [rad] */
+  REAL8 phi,                          /**< Azimuthal angle [rad]*/
+  INT4 l,                             /**< l index of the lm mode */
+  INT4 m,                             /**< m index of the lm mode */
+  INT4 sym                            /**< Equatorial symmetry */
+){
+  COMPLEX16 factorp, factorc;
+  UINT4 j;
+  COMPLEX16 hlm; /* helper variable that contains a single point of hlmtilde */
+
+  IMRPhenomXHMFDModeFactors(&factorp, &factorc, theta, phi, l, m, sym);
+
+  COMPLEX16* datap = hptilde->data->data;
+  COMPLEX16* datac = hctilde->data->data;
+
+  for ( j = 0; j < htildelm->data->length; ++j ) {
+    hlm = (htildelm->data->data[j]);
+    datap[j] += factorp*hlm;
+    datac[j] += factorc*hlm;
+  }
+  return XLAL_SUCCESS;
+}
+
+/* Function to sum one mode (htildelm) to single-precision hp/c tilde; the product is formed in double precision */
+static int IMRPhenomXHMFDAddModeCOMPLEX8(
+  COMPLEX8FrequencySeries *hptilde,   /**<[out] hp series*/
+  COMPLEX8FrequencySeries *hctilde,   /**<[out] hc series */
+  COMPLEX16FrequencySeries *htildelm, /**< hlm mode to add */
+  REAL8 theta,                        /**< Inclination [rad] */
+  REAL8 phi,                          /**< Azimuthal angle [rad]*/
+  INT4 l,                             /**< l index of the lm mode */
+  INT4 m,                             /**< m index of the lm mode */
+  INT4 sym                            /**< Equatorial symmetry */
+){
+  COMPLEX16 factorp, factorc;
+  UINT4 j;
+  COMPLEX16 hlm; /* helper variable that contains a single point of hlmtilde */
+
+  IMRPhenomXHMFDModeFactors(&factorp, &factorc, theta, phi, l, m, sym);
+
+  COMPLEX8* datap = hptilde->data->data;
+  COMPLEX8* datac = hctilde->data->data;
+
+  for ( j = 0; j < htildelm->data->length; ++j ) {
+    hlm = (htildelm->data->data[j]);
+    datap[j] = datap[j] + factorp*hlm;
+    datac[j] = datac[j] + factorc*hlm;
   }
   return XLAL_SUCCESS;
 }
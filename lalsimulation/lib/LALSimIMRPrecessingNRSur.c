@@ -66,6 +66,10 @@
 #include <pthread.h>
 #endif
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 
 #ifdef LAL_PTHREAD_LOCK
 static pthread_once_t NRSur7dq2_is_initialized = PTHREAD_ONCE_INIT;
@@ -250,11 +254,13 @@ static int PrecessingNRSur_Init(
         snprintf(sub_name, 20, "ds_node_%d", j);
         sub = XLALH5GroupOpen(file, sub_name);
         PrecessingNRSur_LoadDynamicsNode(ds_node_data, sub, i, PrecessingNRSurVersion);
+        XLAL_CHECK(ds_node_data[i]->packed, XLAL_EFUNC, "Failed to pack the fits of dynamics node %d", j);
 
         if (i < 3) {
             snprintf(sub_name, 20, "ds_node_%d", j+1);
             sub = XLALH5GroupOpen(file, sub_name);
             PrecessingNRSur_LoadDynamicsNode(ds_half_node_data, sub, i, PrecessingNRSurVersion);
+            XLAL_CHECK(ds_half_node_data[i]->packed, XLAL_EFUNC, "Failed to pack the fits of dynamics node %d", j+1);
         }
     }
     XLALFree(sub_name);
@@ -273,6 +279,22 @@ static int PrecessingNRSur_Init(
     }
     data->coorbital_mode_data = coorbital_mode_data;
 
+    // Flag the coorbital times at which any waveform data piece has an empirical node
+    data->coorb_node_used = XLALCalloc(t_coorb->size, sizeof(*data->coorb_node_used));
+    XLAL_CHECK(data->coorb_node_used, XLAL_ENOMEM);
+    for (int ell_idx=0; ell_idx < NRSUR_LMAX-1; ell_idx++) {
+        WaveformFixedEllModeData *ell_data = coorbital_mode_data[ell_idx];
+        int ret = PrecessingNRSur_flag_empirical_nodes(data->coorb_node_used, ell_data->m0_real_data);
+        ret |= PrecessingNRSur_flag_empirical_nodes(data->coorb_node_used, ell_data->m0_imag_data);
+        for (j=0; j < ell_data->ell; j++) {
+            ret |= PrecessingNRSur_flag_empirical_nodes(data->coorb_node_used, ell_data->X_real_plus_data[j]);
+            ret |= PrecessingNRSur_flag_empirical_nodes(data->coorb_node_used, ell_data->X_real_minus_data[j]);
+            ret |= PrecessingNRSur_flag_empirical_nodes(data->coorb_node_used, ell_data->X_imag_plus_data[j]);
+            ret |= PrecessingNRSur_flag_empirical_nodes(data->coorb_node_used, ell_data->X_imag_minus_data[j]);
+        }
+        XLAL_CHECK(ret == XLAL_SUCCESS, XLAL_EFUNC);
+    }
+
     data->LMax = NRSUR_LMAX;
     data->setup = 1;
 
@@ -360,6 +382,7 @@ static void PrecessingNRSur_LoadDynamicsNode(
         omega_copr_data->coefs = NULL;
         omega_copr_data->basisFunctionOrders = NULL;
         omega_copr_data->componentIndices = NULL;
+        omega_copr_data->fit_data = NULL;
         ReadHDF5RealVectorDataset(sub, "omega_orb_coefs", &(omega_copr_data->coefs));
         ReadHDF5LongMatrixDataset(sub, "omega_orb_bfOrders", &(omega_copr_data->basisFunctionOrders));
         ReadHDF5LongVectorDataset(sub, "omega_orb_bVecIndices", &(omega_copr_data->componentIndices));
@@ -372,6 +395,7 @@ static void PrecessingNRSur_LoadDynamicsNode(
         chiA_dot_data->coefs = NULL;
         chiA_dot_data->basisFunctionOrders = NULL;
         chiA_dot_data->componentIndices = NULL;
+        chiA_dot_data->fit_data = NULL;
         ReadHDF5RealVectorDataset(sub, "chiA_coefs", &(chiA_dot_data->coefs));
         ReadHDF5LongMatrixDataset(sub, "chiA_bfOrders", &(chiA_dot_data->basisFunctionOrders));
         ReadHDF5LongVectorDataset(sub, "chiA_bVecIndices", &(chiA_dot_data->componentIndices));
@@ -385,6 +409,7 @@ static void PrecessingNRSur_LoadDynamicsNode(
         chiB_dot_data->coefs = NULL;
         chiB_dot_data->basisFunctionOrders = NULL;
         chiB_dot_data->componentIndices = NULL;
+        chiB_dot_data->fit_data = NULL;
 
         UINT4Vector *dimLength;
         size_t n;
@@ -421,6 +446,12 @@ static void PrecessingNRSur_LoadDynamicsNode(
         NRSur7dq4_LoadVectorFitData(&chiB_dot_data, sub, "chiB", 3);
         ds_node_data[i]->chiB_dot_data = chiB_dot_data;
     }
+
+    // Pack all fits of this node for evaluation in a single pass
+    VectorFitData *vfits[3] = {ds_node_data[i]->omega_copr_data,
+        ds_node_data[i]->chiA_dot_data, ds_node_data[i]->chiB_dot_data};
+    ds_node_data[i]->packed = PrecessingNRSur_PackFits(
+            &(ds_node_data[i]->omega_data), 1, vfits, 3);
 }
 
 
@@ -526,6 +557,115 @@ static void PrecessingNRSur_LoadWaveformDataPiece(
         node_data->n_coefs = node_data->coefs->size;
         (*data)->fit_data[i] = node_data;
     }
+
+    (*data)->packed = PrecessingNRSur_PackFits((*data)->fit_data, n_nodes, NULL, 0);
+}
+
+/**
+ * Marks the coorbital times of the empirical nodes of a waveform data piece.
+ */
+static int PrecessingNRSur_flag_empirical_nodes(
+    UCHAR *used,                    /**< Output: flag for each coorbital time */
+    const WaveformDataPiece *data   /**< The waveform data piece */
+) {
+    XLAL_CHECK(data->packed, XLAL_EFUNC, "Waveform data piece fits were not packed");
+    for (int i=0; i<data->n_nodes; i++)
+        used[gsl_vector_long_get(data->empirical_node_indices, i)] = 1;
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Copies the terms of a single fit into packed, starting at coefficient c.
+ * If componentIndices is not NULL only the terms of the given vector
+ * component are copied.  Returns the index of the next free coefficient.
+ */
+static int PrecessingNRSur_PackFitTerms(
+    PackedFitData *packed,              /**< Output: packed fits with space for the terms */
+    int c,                              /**< Index of the first free coefficient in packed */
+    gsl_matrix_long *bfOrders,          /**< (n_coefs x 7) basis function orders */
+    gsl_vector *coefs,                  /**< Coefficients */
+    gsl_vector_long *componentIndices,  /**< Vector component of each coefficient, or NULL */
+    long component,                     /**< Vector component to copy */
+    int n_coefs                         /**< Number of coefficients of the fit */
+) {
+    for (int i=0; i<n_coefs; i++) {
+        if (componentIndices && gsl_vector_long_get(componentIndices, i) != component)
+            continue;
+        packed->coefs[c] = gsl_vector_get(coefs, i);
+        for (int j=0; j<7; j++) {
+            long idx = 7 * gsl_matrix_long_get(bfOrders, i, j) + j;
+            // x_powers holds 4 powers of the mass ratio and 3 per spin component
+            XLAL_CHECK_ABORT(idx >= 0 && idx < 22);
+            packed->bf_index[7*c + j] = (UCHAR) idx;
+        }
+        c++;
+    }
+    return c;
+}
+
+/**
+ * Packs a list of scalar fits, followed by the components of a list of vector
+ * fits, into a single PackedFitData with one output per scalar fit or vector
+ * component. This is only called during the initialization of the surrogate data.
+ */
+static PackedFitData *PrecessingNRSur_PackFits(
+    FitData **fits,         /**< Scalar fits */
+    int n_fits,             /**< Number of scalar fits */
+    VectorFitData **vfits,  /**< Vector fits; NRSur7dq4 ones are vectors of scalar fits */
+    int n_vfits             /**< Number of vector fits */
+) {
+    PackedFitData *packed = XLALMalloc(sizeof(*packed));
+    XLAL_CHECK_NULL(packed, XLAL_ENOMEM);
+    int i, k, v, c, n_out = n_fits, n_coefs = 0;
+
+    for (i=0; i<n_fits; i++) n_coefs += fits[i]->n_coefs;
+    for (v=0; v<n_vfits; v++) {
+        n_out += vfits[v]->vec_dim;
+        if (vfits[v]->fit_data) {
+            for (k=0; k<vfits[v]->vec_dim; k++) n_coefs += vfits[v]->fit_data[k]->n_coefs;
+        } else {
+            n_coefs += vfits[v]->n_coefs;
+        }
+    }
+
+    packed->n_out = n_out;
+    packed->n_coefs = n_coefs;
+    packed->out_start = XLALMalloc((n_out + 1) * sizeof(*packed->out_start));
+    packed->coefs = XLALMalloc((n_coefs + 1) * sizeof(*packed->coefs));
+    packed->bf_index = XLALMalloc(7 * (n_coefs + 1) * sizeof(*packed->bf_index));
+    if (!packed->out_start || !packed->coefs || !packed->bf_index) {
+        XLALFree(packed->out_start);
+        XLALFree(packed->coefs);
+        XLALFree(packed->bf_index);
+        XLALFree(packed);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+
+    c = 0;
+    k = 0;
+    for (i=0; i<n_fits; i++) {
+        packed->out_start[k++] = c;
+        c = PrecessingNRSur_PackFitTerms(packed, c, fits[i]->basisFunctionOrders,
+                fits[i]->coefs, NULL, 0, fits[i]->n_coefs);
+    }
+    for (v=0; v<n_vfits; v++) {
+        for (i=0; i<vfits[v]->vec_dim; i++) {
+            packed->out_start[k++] = c;
+            if (vfits[v]->fit_data) {
+                FitData *fit = vfits[v]->fit_data[i];
+                c = PrecessingNRSur_PackFitTerms(packed, c, fit->basisFunctionOrders,
+                        fit->coefs, NULL, 0, fit->n_coefs);
+            } else {
+                // terms of NRSur7dq2 vector fits are interleaved; keep their order within each component
+                c = PrecessingNRSur_PackFitTerms(packed, c, vfits[v]->basisFunctionOrders,
+                        vfits[v]->coefs, vfits[v]->componentIndices, i, vfits[v]->n_coefs);
+            }
+        }
+    }
+    packed->out_start[k] = c;
+    XLAL_CHECK_ABORT(c == n_coefs && k == n_out);
+
+    return packed;
 }
 
 
@@ -603,49 +743,6 @@ REAL8 NRSur7dq2_eval_fit(
     return res;
 }
 
-/*
- * This is very similar to NRSur7dq2_eval_fit except that the result is a
- * 2d or 3d vector instead of a scalar. Each fit coefficient now applies to
- * just a single component of the result.
- */
-static void NRSur7dq2_eval_vector_fit(
-    REAL8 *res,            /**< Result */
-    VectorFitData *data,    /**< Data for fit */
-    REAL8 *x               /**< size 7, giving mass ratio q, and dimensionless spin components */
-) {
-    REAL8 x_powers[22]; // 3 per spin component, 4 for mass ratio
-    REAL8 prod;
-    int i, j;
-
-    // Initialize the result
-    for (i=0; i < data->vec_dim; i++) {
-        res[i] = 0.0;
-    }
-
-    // The fits were constructed using this rather than using q directly
-    REAL8 q_fit = NRSUR7DQ2_Q_FIT_OFFSET + NRSUR7DQ2_Q_FIT_SLOPE*x[0];
-
-    // Compute powers of components of x
-    for (i=0; i<22; i++) {
-        if (i%7==0) {
-            x_powers[i] = ipow(q_fit, i/7);
-        } else {
-            x_powers[i] = ipow(x[i%7], i/7);
-        }
-    }
-
-    // Sum up fit terms
-    for (i=0; i < data->n_coefs; i++) {
-        // Initialize with q basis function:
-        prod = x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, 0)];
-        // Multiply with spin basis functions:
-        for (j=1; j<7; j++) {
-            prod *= x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, j) + j];
-        }
-        res[gsl_vector_long_get(data->componentIndices, i)] += gsl_vector_get(data->coefs, i) * prod;
-    }
-}
-
 /*
  * Computes effective spins chiHat and chi_a.
  * chiHat is defined in Eq.(3) of 1508.07253.
@@ -724,23 +821,6 @@ REAL8 NRSur7dq4_eval_fit(
     return res;
 }
 
-/*
- * This is very similar to NRSur7dq4_eval_fit except that the result is a
- * 2d or 3d vector instead of a scalar. Each fit coefficient now applies to
- * just a single component of the result.
- */
-static void NRSur7dq4_eval_vector_fit(
-    REAL8 *res,            /**< Result */
-    VectorFitData *data,    /**< Data for fit */
-    REAL8 *x               /**< size 7, giving mass ratio q, and dimensionless spin components */
-) {
-    // loop over vector indices
-    for (int i=0; i < data->vec_dim; i++) {
-        res[i] = NRSur7dq4_eval_fit((*data).fit_data[i], x);
-    }
-}
-
-
 /*
  * Wrapper for NRSur7dq2_eval_fit and NRSur7dq4_eval_fit
  */
@@ -759,23 +839,69 @@ REAL8 PrecessingNRSur_eval_fit(
 }
 
 /*
- * Wrapper for NRSur7dq2_eval_vector_fit and NRSur7dq4_eval_vector_fit
+ * Computes the table of powers of the fit parameters used by all fits of a
+ * given model at the point x: x_powers[7*k + j] is the k-th power of fit
+ * parameter j, with k <= 3 for the mass ratio and k <= 2 for the spins.
+ * This is the same table built by NRSur7dq2_eval_fit and NRSur7dq4_eval_fit.
  */
-static void PrecessingNRSur_eval_vector_fit(
-    REAL8 *res,            /**< Result */
-    VectorFitData *data,    /**< Data for fit */
-    REAL8 *x,               /**< size 7, giving mass ratio q, and dimensionless spin components */
-    PrecessingNRSurData *__sur_data   /**< Loaded surrogate data */
+static void PrecessingNRSur_fit_powers(
+    REAL8 *x_powers,       /**< Output: 22 powers of the fit parameters */
+    const REAL8 *x,        /**< size 7, giving mass ratio q, and dimensionless spin components */
+    UINT4 PrecessingNRSurVersion   /**< 0 for NRSur7dq2, 1 for NRSur7dq4 */
 ) {
-    if (__sur_data->PrecessingNRSurVersion == 0) {
-        return NRSur7dq2_eval_vector_fit(res, data, x);
-    } else if (__sur_data->PrecessingNRSurVersion == 1) {
-        return NRSur7dq4_eval_vector_fit(res, data, x);
+    REAL8 fit_params[7];
+    REAL8 q_fit;
+    int i;
+
+    if (PrecessingNRSurVersion == 0) {
+        for (i=0; i<7; i++) fit_params[i] = x[i];
+        q_fit = NRSUR7DQ2_Q_FIT_OFFSET + NRSUR7DQ2_Q_FIT_SLOPE*x[0];
     } else {
-        XLAL_ERROR_VOID(XLAL_FAILURE, "Only 0 or 1 are currently allowed for PrecessingNRSurVersion\n");
+        // [log(q), chi1x, chi1y, chiHat, chi2x, chi2y, chi_a]; see NRSur7dq4_eval_fit
+        REAL8 chiHat, chi_a;
+        NRSur7dq4_effective_spins(&chiHat, &chi_a, x[0], x[3], x[6]);
+        fit_params[0] = log(x[0]);
+        fit_params[1] = x[1];
+        fit_params[2] = x[2];
+        fit_params[3] = chiHat;
+        fit_params[4] = x[4];
+        fit_params[5] = x[5];
+        fit_params[6] = chi_a;
+        q_fit = NRSUR7DQ4_Q_FIT_OFFSET + NRSUR7DQ4_Q_FIT_SLOPE*fit_params[0];
+    }
+
+    for (i=0; i<22; i++) {
+        if (i%7==0) {
+            x_powers[i] = ipow(q_fit, i/7);
+        } else {
+            x_powers[i] = ipow(fit_params[i%7], i/7);
+        }
     }
 }
 
+/*
+ * Evaluates output k of a set of packed fits, given the powers of the fit
+ * parameters from PrecessingNRSur_fit_powers. The terms are summed in the
+ * same order as by NRSur7dq2_eval_fit and NRSur7dq4_eval_fit, so the results
+ * are identical.
+ */
+static REAL8 PrecessingNRSur_eval_packed_fit(
+    const PackedFitData *data,  /**< Packed fits */
+    int k,                      /**< Output to evaluate */
+    const REAL8 *x_powers       /**< Powers of the fit parameters */
+) {
+    const REAL8 *coefs = data->coefs;
+    const UCHAR *bf = data->bf_index;
+    REAL8 res = 0.0;
+    for (int i=data->out_start[k]; i < data->out_start[k+1]; i++) {
+        const UCHAR *b = bf + 7*i;
+        REAL8 prod = x_powers[b[0]] * x_powers[b[1]] * x_powers[b[2]]
+            * x_powers[b[3]] * x_powers[b[4]] * x_powers[b[5]] * x_powers[b[6]];
+        res += coefs[i] * prod;
+    }
+    return res;
+}
+
 
 /* During the ODE integration, the norm of the spins will change due to
  * integration errors and fit modeling errors. Keep them normalized.
@@ -1031,10 +1157,12 @@ static REAL8 PrecessingNRSur_get_omega(
     REAL8 *y0,          /**< The value of the ODE state y = [q0, qx, qy, qz, orbphase, chiAx, chiAy, chiAz, chiBx, chiBy, chiBz] */
     PrecessingNRSurData *__sur_data   /**< Loaded surrogate data */
 ){
-    REAL8 x[7];
+    REAL8 x[7], x_powers[22];
     PrecessingNRSur_ds_fit_x(x, q, y0);
-    FitData *data = __sur_data->ds_node_data[node_index]->omega_data;
-    REAL8 omega = PrecessingNRSur_eval_fit(data, x, __sur_data);
+    PrecessingNRSur_fit_powers(x_powers, x, __sur_data->PrecessingNRSurVersion);
+    // omega is the first output of the packed node fits
+    REAL8 omega = PrecessingNRSur_eval_packed_fit(
+            __sur_data->ds_node_data[node_index]->packed, 0, x_powers);
     return omega;
 }
 
@@ -1114,8 +1242,9 @@ static void PrecessingNRSur_get_time_deriv_from_index(
     PrecessingNRSurData *__sur_data    /**< Loaded surrogate data */
 ) {
     // Setup fit variables
-    REAL8 x[7];
+    REAL8 x[7], x_powers[22];
     PrecessingNRSur_ds_fit_x(x, q, y);
+    PrecessingNRSur_fit_powers(x_powers, x, __sur_data->PrecessingNRSurVersion);
 
     // Get fit data
     DynamicsNodeFitData *ds_node;
@@ -1125,16 +1254,13 @@ static void PrecessingNRSur_get_time_deriv_from_index(
         ds_node = __sur_data->ds_half_node_data[-1*i0 - 1];
     }
 
-    // Evaluate fits
-    REAL8 omega, Omega_coorb_xy[2], chiA_dot[3], chiB_dot[3];
-    omega = PrecessingNRSur_eval_fit(ds_node->omega_data, x, __sur_data);
-    PrecessingNRSur_eval_vector_fit(Omega_coorb_xy, ds_node->omega_copr_data,
-            x, __sur_data);
-    PrecessingNRSur_eval_vector_fit(chiA_dot, ds_node->chiA_dot_data,
-            x, __sur_data);
-    PrecessingNRSur_eval_vector_fit(chiB_dot, ds_node->chiB_dot_data,
-            x, __sur_data);
-    PrecessingNRSur_assemble_dydt(dydt, y, Omega_coorb_xy, omega, chiA_dot, chiB_dot);
+    // Evaluate all fits of the node in one pass; the packed outputs are
+    // [omega, Omega_coorb_x, Omega_coorb_y, chiA_dot (3), chiB_dot (3)]
+    REAL8 fits[9];
+    for (int k=0; k<9; k++) {
+        fits[k] = PrecessingNRSur_eval_packed_fit(ds_node->packed, k, x_powers);
+    }
+    PrecessingNRSur_assemble_dydt(dydt, y, fits + 1, fits[0], fits + 3, fits + 6);
 }
 
 /**
@@ -1599,37 +1725,33 @@ static void PrecessingNRSur_integrate_AB4(
 
 /**
  * Evaluates a single NRSur coorbital waveoform data piece.
- * The dynamics ODE must have already been solved, since this requires the
- * spins evaluated at all of the empirical nodes for this waveform data piece.
+ * The dynamics ODE must have already been solved, and the powers of the fit
+ * parameters (q and the coorbital spins) computed with
+ * PrecessingNRSur_fit_powers at all of the empirical node times.
  */
-static void PrecessingNRSur_eval_data_piece(
-    gsl_vector *result, /**< Output: Should have already been assigned space */
-    REAL8 q,           /**< Mass ratio */
-    gsl_vector **chiA,  /**< 3 gsl_vector *s, one for each (coorbital) component */
-    gsl_vector **chiB,  /**< similar to chiA */
-    WaveformDataPiece *data, /**< The data piece to evaluate */
-    PrecessingNRSurData *__sur_data    /**< Loaded surrogate data */
+static int PrecessingNRSur_eval_data_piece(
+    REAL8 *result,          /**< Output: length of t_coorb; should have already been assigned space */
+    const REAL8 *x_powers,  /**< 22 powers of the fit parameters at each coorbital time */
+    const WaveformDataPiece *data /**< The data piece to evaluate */
 ) {
-
-    gsl_vector *nodes = gsl_vector_alloc(data->n_nodes);
-    REAL8 x[7];
-    int i, j, node_index;
+    const size_t n_coorb = data->empirical_interpolant_basis->size2;
+    REAL8 *nodes = XLALMalloc(data->n_nodes * sizeof(*nodes));
+    XLAL_CHECK(nodes, XLAL_ENOMEM);
+    int i;
 
     // Evaluate the fits at the empirical nodes, using the spins at the empirical node times
-    x[0] = q;
     for (i=0; i<data->n_nodes; i++) {
-        node_index = gsl_vector_long_get(data->empirical_node_indices, i);
-        for (j=0; j<3; j++) {
-            x[1+j] = gsl_vector_get(chiA[j], node_index);
-            x[4+j] = gsl_vector_get(chiB[j], node_index);
-        }
-        gsl_vector_set(nodes, i, PrecessingNRSur_eval_fit(data->fit_data[i], x, __sur_data));
+        long node_index = gsl_vector_long_get(data->empirical_node_indices, i);
+        nodes[i] = PrecessingNRSur_eval_packed_fit(data->packed, i, x_powers + 22*node_index);
     }
 
     // Evaluate the empirical interpolant
-    gsl_blas_dgemv(CblasTrans, 1.0, data->empirical_interpolant_basis, nodes, 0.0, result);
+    gsl_vector_view nodes_view = gsl_vector_view_array(nodes, data->n_nodes);
+    gsl_vector_view result_view = gsl_vector_view_array(result, n_coorb);
+    gsl_blas_dgemv(CblasTrans, 1.0, data->empirical_interpolant_basis, &nodes_view.vector, 0.0, &result_view.vector);
 
-    gsl_vector_free(nodes);
+    XLALFree(nodes);
+    return XLAL_SUCCESS;
 }
 
 /************************ Main Waveform Generation Routines ***********/
@@ -1811,6 +1933,24 @@ static PrecessingNRSurData* PrecessingNRSur_LoadData(
 
 
 
+/**
+ * Frees the dynamics interpolated onto the coorbital time grid.
+ */
+static void PrecessingNRSur_free_coorb_dynamics(
+    gsl_vector **quat_coorb,    /**< The 4 quaternion components */
+    gsl_vector *phi_coorb,      /**< The orbital phase */
+    gsl_vector **chiA_coorb,    /**< The 3 components of chiA */
+    gsl_vector **chiB_coorb     /**< The 3 components of chiB */
+) {
+    for (int i=0; i<3; i++) {
+        gsl_vector_free(chiA_coorb[i]);
+        gsl_vector_free(chiB_coorb[i]);
+        gsl_vector_free(quat_coorb[i]);
+    }
+    gsl_vector_free(quat_coorb[3]);
+    gsl_vector_free(phi_coorb);
+}
+
 /* This is the core function of the NRSur7dq2 and NRSur7dq4 models.
  * It evaluates the model, and returns waveform modes in the inertial frame, sampled on t_coorb.
  * When using a custom ModeArray the user must explicitly supply all modes, -ve and +ve m-modes.
@@ -1905,28 +2045,84 @@ static PrecessingNRSurData* PrecessingNRSur_core(
     // Transform spins from coprecessing frame to coorbital frame for use in coorbital waveform surrogate
     PrecessingNRSur_rotate_spins(chiA_coorb, chiB_coorb, phi_coorb);
 
-    // Evaluate the coorbital waveform surrogate
+    // Evaluate the coorbital waveform surrogate.
+    // All data pieces are evaluated in one pass: the powers of the fit
+    // parameters are computed once at each empirical node time, shared by
+    // all data pieces, and the data pieces are then evaluated independently.
+    int n_pieces = 0, max_pieces = 0;
+    for (ell=2; ell<=NRSUR_LMAX; ell++) max_pieces += 2 + 4*ell;
+    REAL8 *x_powers = XLALMalloc(22 * n_coorb * sizeof(*x_powers));
+    WaveformDataPiece **pieces = XLALMalloc(max_pieces * sizeof(*pieces));
+    if (!x_powers || !pieces) {
+        XLALFree(x_powers);
+        XLALFree(pieces);
+        PrecessingNRSur_free_coorb_dynamics(quat_coorb, phi_coorb, chiA_coorb, chiB_coorb);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    REAL8 x[7];
+    x[0] = q;
+    for (i=0; i<n_coorb; i++) {
+        if (!__sur_data->coorb_node_used[i]) continue;
+        for (j=0; j<3; j++) {
+            x[1+j] = gsl_vector_get(chiA_coorb[j], i);
+            x[4+j] = gsl_vector_get(chiB_coorb[j], i);
+        }
+        PrecessingNRSur_fit_powers(x_powers + 22*i, x, __sur_data->PrecessingNRSurVersion);
+    }
+
+    // List the data pieces needed for the requested modes, in the order in
+    // which they are summed below
+    WaveformFixedEllModeData *ell_data;
+    for (ell=2; ell<=NRSUR_LMAX; ell++) {
+        ell_data = __sur_data->coorbital_mode_data[ell - 2];
+        if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, 0) == 1) {
+            pieces[n_pieces++] = ell_data->m0_real_data;
+            pieces[n_pieces++] = ell_data->m0_imag_data;
+        }
+        for (m=1; m<=ell; m++) {
+            if ((XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, m) != 1) &&
+                (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, -m) != 1)) {
+                continue;
+            }
+            pieces[n_pieces++] = ell_data->X_real_plus_data[m-1];
+            pieces[n_pieces++] = ell_data->X_real_minus_data[m-1];
+            pieces[n_pieces++] = ell_data->X_imag_plus_data[m-1];
+            pieces[n_pieces++] = ell_data->X_imag_minus_data[m-1];
+        }
+    }
+
+    REAL8 *piece_eval = XLALMalloc(((size_t) n_pieces * n_coorb + 1) * sizeof(*piece_eval));
+    int n_failed = 0;
+    if (piece_eval) {
+        #pragma omp parallel for schedule(dynamic) reduction(+:n_failed)
+        for (i=0; i<n_pieces; i++) {
+            if (PrecessingNRSur_eval_data_piece(piece_eval + (size_t) i * n_coorb, x_powers, pieces[i]) != XLAL_SUCCESS)
+                n_failed++;
+        }
+    }
+    XLALFree(pieces);
+    XLALFree(x_powers);
+    if (!piece_eval || n_failed) {
+        XLALFree(piece_eval);
+        PrecessingNRSur_free_coorb_dynamics(quat_coorb, phi_coorb, chiA_coorb, chiB_coorb);
+        XLAL_ERROR_NULL(piece_eval ? XLAL_EFUNC : XLAL_ENOMEM, "Failed to evaluate the coorbital waveform data pieces");
+    }
+
     MultiModalWaveform *h_coorb = NULL;
     MultiModalWaveform_Init(&h_coorb, NRSUR_LMAX, n_coorb);
-    gsl_vector *data_piece_eval = gsl_vector_alloc(n_coorb);
-    WaveformDataPiece *data_piece_data;
+    gsl_vector_view data_piece_eval;
     int i0; // for indexing the (ell, m=0) mode, such that the (ell, m) mode is index (i0 + m).
-    WaveformFixedEllModeData *ell_data;
+    int p = 0;
     for (ell=2; ell<=NRSUR_LMAX; ell++) {
-        ell_data = __sur_data->coorbital_mode_data[ell - 2];
         i0 = ell*(ell+1) - 4;
 
         // m=0
-        if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, 0) != 1) {
-        }
-        else {
-            data_piece_data = ell_data->m0_real_data;
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_real_part[i0], data_piece_eval);
-
-            data_piece_data = ell_data->m0_imag_data;
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_imag_part[i0], data_piece_eval);
+        if (XLALSimInspiralModeArrayIsModeActive(ModeArray, ell, 0) == 1) {
+            data_piece_eval = gsl_vector_view_array(piece_eval + (size_t) (p++) * n_coorb, n_coorb);
+            gsl_vector_add(h_coorb->modes_real_part[i0], &data_piece_eval.vector);
+
+            data_piece_eval = gsl_vector_view_array(piece_eval + (size_t) (p++) * n_coorb, n_coorb);
+            gsl_vector_add(h_coorb->modes_imag_part[i0], &data_piece_eval.vector);
         }
 
         // Other modes
@@ -1940,30 +2136,27 @@ static PrecessingNRSurData* PrecessingNRSur_core(
             // h^{ell, -m} = (X_plus - X_minus)* <- complex conjugate
 
             // Re[X_plus] gets added to both Re[h^{ell, m}] and Re[h^{ell, -m}]
-            data_piece_data = ell_data->X_real_plus_data[m-1];
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_real_part[i0+m], data_piece_eval);
-            gsl_vector_add(h_coorb->modes_real_part[i0-m], data_piece_eval);
+            data_piece_eval = gsl_vector_view_array(piece_eval + (size_t) (p++) * n_coorb, n_coorb);
+            gsl_vector_add(h_coorb->modes_real_part[i0+m], &data_piece_eval.vector);
+            gsl_vector_add(h_coorb->modes_real_part[i0-m], &data_piece_eval.vector);
 
             // Re[X_minus] gets added to Re[h^{ell, m}] and subtracted from Re[h^{ell, -m}]
-            data_piece_data = ell_data->X_real_minus_data[m-1];
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_real_part[i0+m], data_piece_eval);
-            gsl_vector_sub(h_coorb->modes_real_part[i0-m], data_piece_eval);
+            data_piece_eval = gsl_vector_view_array(piece_eval + (size_t) (p++) * n_coorb, n_coorb);
+            gsl_vector_add(h_coorb->modes_real_part[i0+m], &data_piece_eval.vector);
+            gsl_vector_sub(h_coorb->modes_real_part[i0-m], &data_piece_eval.vector);
 
             // Im[X_plus] gets added to Re[h^{ell, m}] and subtracted from Re[h^{ell, -m}]
-            data_piece_data = ell_data->X_imag_plus_data[m-1];
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_imag_part[i0+m], data_piece_eval);
-            gsl_vector_sub(h_coorb->modes_imag_part[i0-m], data_piece_eval);
+            data_piece_eval = gsl_vector_view_array(piece_eval + (size_t) (p++) * n_coorb, n_coorb);
+            gsl_vector_add(h_coorb->modes_imag_part[i0+m], &data_piece_eval.vector);
+            gsl_vector_sub(h_coorb->modes_imag_part[i0-m], &data_piece_eval.vector);
 
             // Im[X_minus] gets added to both Re[h^{ell, m}] and Re[h^{ell, -m}]
-            data_piece_data = ell_data->X_imag_minus_data[m-1];
-            PrecessingNRSur_eval_data_piece(data_piece_eval, q, chiA_coorb, chiB_coorb, data_piece_data, __sur_data);
-            gsl_vector_add(h_coorb->modes_imag_part[i0+m], data_piece_eval);
-            gsl_vector_add(h_coorb->modes_imag_part[i0-m], data_piece_eval);
+            data_piece_eval = gsl_vector_view_array(piece_eval + (size_t) (p++) * n_coorb, n_coorb);
+            gsl_vector_add(h_coorb->modes_imag_part[i0+m], &data_piece_eval.vector);
+            gsl_vector_add(h_coorb->modes_imag_part[i0-m], &data_piece_eval.vector);
         }
     }
+    XLALFree(piece_eval);
 
     // Rotate to the inertial frame, write results in h
     MultiModalWaveform_Init(h, NRSUR_LMAX, n_coorb);
@@ -1971,14 +2164,7 @@ static PrecessingNRSurData* PrecessingNRSur_core(
 
     // Cleanup
     MultiModalWaveform_Destroy(h_coorb);
-    for (i=0; i<3; i++) {
-        gsl_vector_free(chiA_coorb[i]);
-        gsl_vector_free(chiB_coorb[i]);
-        gsl_vector_free(quat_coorb[i]);
-    }
-    gsl_vector_free(quat_coorb[3]);
-    gsl_vector_free(phi_coorb);
-    gsl_vector_free(data_piece_eval);
+    PrecessingNRSur_free_coorb_dynamics(quat_coorb, phi_coorb, chiA_coorb, chiB_coorb);
 
     return __sur_data;
 }
@@ -2570,6 +2756,67 @@ SphHarmTimeSeries *XLALSimInspiralPrecessingNRSurModes(
     return hlms;
 }
 
+/**
+ * Evaluates the NRSur7dq2 or NRSur7dq4 modes at many parameter points.
+ *
+ * Equivalent to calling XLALSimInspiralPrecessingNRSurModes() for each of the
+ * n points (m1[i], m2[i], S1x[i], ..., S2z[i]), with the remaining arguments
+ * common to all points, but the surrogate data is loaded once up front and
+ * the points are evaluated in parallel when OpenMP is available. The output
+ * for point i is returned in hlms[i]. If any point fails all outputs are
+ * destroyed, set to NULL, and an error is returned.
+ */
+int XLALSimInspiralPrecessingNRSurModesBatch(
+        SphHarmTimeSeries **hlms,       /**< Output: array of n mode sets */
+        UINT4 n,                        /**< number of parameter points */
+        REAL8 deltaT,                   /**< sampling interval (s) */
+        const REAL8 *m1,                /**< masses of companion 1 (kg) */
+        const REAL8 *m2,                /**< masses of companion 2 (kg) */
+        const REAL8 *S1x,               /**< x-components of the dimensionless spin of object 1 */
+        const REAL8 *S1y,               /**< y-components of the dimensionless spin of object 1 */
+        const REAL8 *S1z,               /**< z-components of the dimensionless spin of object 1 */
+        const REAL8 *S2x,               /**< x-components of the dimensionless spin of object 2 */
+        const REAL8 *S2y,               /**< y-components of the dimensionless spin of object 2 */
+        const REAL8 *S2z,               /**< z-components of the dimensionless spin of object 2 */
+        REAL8 fMin,                     /**< start GW frequency (Hz) */
+        REAL8 fRef,                     /**< reference GW frequency (Hz) */
+        REAL8 distance,                 /**< distance of source (m) */
+        LALDict* LALparams,             /**< Dict with extra parameters */
+        Approximant approximant         /**< approximant (NRSur7dq2 or NRSur7dq4) */
+) {
+    XLAL_CHECK(hlms && m1 && m2 && S1x && S1y && S1z && S2x && S2y && S2z,
+            XLAL_EFAULT);
+
+    // Load the surrogate data before any threads need it
+    PrecessingNRSurData *__sur_data = PrecessingNRSur_LoadData(approximant);
+    if (!__sur_data || !__sur_data->setup) {
+        XLAL_ERROR(XLAL_EFAILED, "Error loading surrogate data.\n");
+    }
+
+    int errnum = 0;
+    INT4 i;
+    #pragma omp parallel for schedule(dynamic)
+    for (i=0; i<(INT4) n; i++) {
+        hlms[i] = XLALSimInspiralPrecessingNRSurModes(deltaT, m1[i], m2[i],
+                S1x[i], S1y[i], S1z[i], S2x[i], S2y[i], S2z[i],
+                fMin, fRef, distance, LALparams, approximant);
+        if (!hlms[i]) {
+            #pragma omp critical
+            errnum = XLAL_EFUNC;
+        }
+    }
+
+    if (errnum) {
+        for (i=0; i<(INT4) n; i++) {
+            XLALDestroySphHarmTimeSeries(hlms[i]);
+            hlms[i] = NULL;
+        }
+        XLAL_ERROR(errnum, "Failed to evaluate the surrogate at one or more points");
+    }
+
+    return XLAL_SUCCESS;
+}
+
 /**
  * This function evaluates the NRSur7dq2 or NRSur7dq4 surrogate model and
  * returns the precessing frame dynamics.
@@ -104,6 +104,23 @@ typedef struct tagVectorFitData {
     FitData **fit_data;            /**< Vector of FitData */
 } VectorFitData;
 
+/**
+ * A set of scalar fits packed into contiguous arrays, built once at
+ * initialization from FitData or VectorFitData.
+ * Output k is the sum over out_start[k] <= i < out_start[k+1] of
+ * coefs[i] * prod_{j=0}^6 x_powers[bf_index[7*i + j]], where x_powers is the
+ * table of the 22 powers of the fit parameters computed by
+ * PrecessingNRSur_fit_powers.  This replaces the per-coefficient lookups of
+ * the basis function orders and the recomputation of the powers for each fit.
+ */
+typedef struct tagPackedFitData {
+    int n_out;          /**< Number of outputs */
+    int n_coefs;        /**< Total number of coefficients */
+    int *out_start;     /**< Offset of the first coefficient of each output, length n_out + 1 */
+    REAL8 *coefs;       /**< Coefficients, length n_coefs */
+    UCHAR *bf_index;    /**< Indices into x_powers, length 7 * n_coefs */
+} PackedFitData;
+
 /**
  * Data for a single dynamics node
  */
@@ -115,6 +132,8 @@ typedef struct tagDynamicsNodeFitData {
                                          time derivative of chiA taken in the coprecessing frame */
     VectorFitData *chiB_dot_data;   /**< A 3d vector fit for the coorbital components of the
                                          time derivative of chiB taken in the coprecessing frame */
+    PackedFitData *packed;          /**< All of the above as 9 outputs: omega, Omega_coorb_xy,
+                                         chiA_dot, chiB_dot */
 } DynamicsNodeFitData;
 
 /**
@@ -127,6 +146,7 @@ typedef struct tagWaveformDataPiece {
     FitData **fit_data;                         /**< FitData at each empirical node */
     gsl_matrix *empirical_interpolant_basis;    /**< The empirical interpolation matrix */
     gsl_vector_long *empirical_node_indices;    /**< The empirical node indices */
+    PackedFitData *packed;                      /**< fit_data packed, one output per empirical node */
 } WaveformDataPiece;
 
 /**
@@ -160,6 +180,9 @@ typedef struct tagPrecessingNRSurData {
     DynamicsNodeFitData **ds_half_node_data; /** A DynamicsNodeFitData for each time in t_ds_half_times. */
     WaveformFixedEllModeData **coorbital_mode_data; /** One for each 2 <= ell <= LMax */
     UINT4 PrecessingNRSurVersion;   /**< 0 for NRSur7dq2, 1 for NRSur7dq4 */
+    UCHAR *coorb_node_used; /**< For each time in t_coorb, 1 if it is an empirical node of any
+                                 waveform data piece; powers of the fit parameters are only
+                                 computed at these times. */
 } PrecessingNRSurData;
 
 
@@ -180,25 +203,17 @@ static double ipow(double base, int exponent); // integer powers
 
 static double NRSur7dq2_eval_fit(FitData *data, double *x);
 
-static void NRSur7dq2_eval_vector_fit(
-    double *res, // Result
-    VectorFitData *data, // Data for fit
-    double *x // size 7, giving mass ratio q, and dimensionless spin components
-);
-
 static int NRSur7dq4_effective_spins(REAL8 *chiHat, REAL8 *chi_a,
         const double q, const double chi1z, const double chi2z);
 static double NRSur7dq4_eval_fit(FitData *data, double *x);
 
-static void NRSur7dq4_eval_vector_fit(
-    double *res, // Result
-    VectorFitData *data, // Data for fit
-    double *x // size 7, giving mass ratio q, and dimensionless spin components
-);
-
 double PrecessingNRSur_eval_fit(FitData *data, double *x, PrecessingNRSurData *__sur_data);
 
-static void PrecessingNRSur_eval_vector_fit(double *res, VectorFitData *data, double *x, PrecessingNRSurData *__sur_data);
+static int PrecessingNRSur_flag_empirical_nodes(UCHAR *used, const WaveformDataPiece *data);
+static int PrecessingNRSur_PackFitTerms(PackedFitData *packed, int c, gsl_matrix_long *bfOrders, gsl_vector *coefs, gsl_vector_long *componentIndices, long component, int n_coefs);
+static PackedFitData *PrecessingNRSur_PackFits(FitData **fits, int n_fits, VectorFitData **vfits, int n_vfits);
+static void PrecessingNRSur_fit_powers(double *x_powers, const double *x, UINT4 PrecessingNRSurVersion);
+static double PrecessingNRSur_eval_packed_fit(const PackedFitData *data, int k, const double *x_powers);
 
 static void PrecessingNRSur_normalize_y(
     double chiANorm,
@@ -329,17 +344,16 @@ static int PrecessingNRSur_IntegrateDynamics(
     UINT4 PrecessingNRSurVersion
 );
 
-static void PrecessingNRSur_eval_data_piece(
-    gsl_vector *result,
-    double q,
-    gsl_vector **chiA,
-    gsl_vector **chiB,
-    WaveformDataPiece *data,
-    PrecessingNRSurData *__sur_data
+static int PrecessingNRSur_eval_data_piece(
+    double *result,
+    const double *x_powers,
+    const WaveformDataPiece *data
 );
 
 static PrecessingNRSurData* PrecessingNRSur_LoadData(Approximant approximant);
 
+static void PrecessingNRSur_free_coorb_dynamics(gsl_vector **quat_coorb, gsl_vector *phi_coorb, gsl_vector **chiA_coorb, gsl_vector **chiB_coorb);
+
 static PrecessingNRSurData* PrecessingNRSur_core(
     MultiModalWaveform **h,
     double q,
@@ -64,6 +64,7 @@ static const INT4 ROMDataHDF5_VERSION_MICRO = 0;
 #include <lal/LALSimIMR.h>
 
 #include "LALSimIMRSEOBNRROMUtilities.c"
+#include "LALSimIMRMultiband.h"
 
 #include <lal/LALConfig.h>
 #ifdef LAL_PTHREAD_LOCK
@@ -735,6 +736,56 @@ static void GluePhasing(
 
 
 
+/* Data needed to evaluate the glued ROM splines for multibanding */
+typedef struct tagSEOBNRv4ROMMultibandData {
+  gsl_spline *spline_amp;
+  gsl_spline *spline_phi;
+  gsl_interp_accel *acc_amp;
+  gsl_interp_accel *acc_phi;
+  double Mf_ROM_max;
+  double fRef_geom;
+  double phase_change;
+  double t_corr;
+  double amp_scale;
+  double m1, m2;                 /* component masses in Msun; only used for NRTidalv2 */
+  double lambda1, lambda2;
+  NRTidal_version_type NRTidal_version;
+} SEOBNRv4ROMMultibandData;
+
+/* Multibanding callback: amplitude and time-shifted phase at geometric frequencies */
+static int SEOBNRv4ROMMultibandAmpPhase(REAL8 *amp, REAL8 *phase, const REAL8 *freqs, UINT4 n, void *params)
+{
+  SEOBNRv4ROMMultibandData *d = (SEOBNRv4ROMMultibandData *)params;
+
+  REAL8Sequence *amp_tidal = NULL;
+  if (d->NRTidal_version == NRTidalv2_V) {
+    REAL8Sequence fseq = {n, (REAL8 *)(uintptr_t)freqs};
+    amp_tidal = XLALCreateREAL8Sequence(n);
+    XLAL_CHECK(amp_tidal, XLAL_ENOMEM);
+    int ret = XLALSimNRTunedTidesFDTidalAmplitudeFrequencySeries(amp_tidal, &fseq, d->m1, d->m2, d->lambda1, d->lambda2);
+    if (ret != XLAL_SUCCESS) {
+      XLALDestroyREAL8Sequence(amp_tidal);
+      XLAL_ERROR(ret, "Failed to generate tidal amplitude series to construct SEOBNRv4_ROM_NRTidalv2 waveform.");
+    }
+  }
+
+  for (UINT4 i=0; i<n; i++) {
+    double f = freqs[i];
+    if (f > d->Mf_ROM_max) { // beyond the ROM; leave zero amplitude as in the direct evaluation
+      amp[i] = 0.0;
+      f = d->Mf_ROM_max;
+    } else {
+      double A = gsl_spline_eval(d->spline_amp, f, d->acc_amp);
+      amp[i] = d->amp_scale * (amp_tidal ? A + amp_tidal->data[i] : A);
+    }
+    phase[i] = gsl_spline_eval(d->spline_phi, f, d->acc_phi) - d->phase_change
+               - 2*LAL_PI * (freqs[i] - d->fRef_geom) * d->t_corr;
+  }
+
+  XLALDestroyREAL8Sequence(amp_tidal);
+  return XLAL_SUCCESS;
+}
+
 /**
  * Core function for computing the ROM waveform.
  * Interpolate projection coefficient data and evaluate coefficients at desired (q, chi1, chi2).
@@ -1011,9 +1062,74 @@ static int SEOBNRv4ROMCore(
   // Evaluate reference phase for setting phiRef correctly
   double phase_change = gsl_spline_eval(spline_phi, fRef_geom, acc_phi) - 2*phiRef;
   
+  /* Phasing correction so we coalesce at t=0 (with the definition of the epoch=-1/deltaF above) */
+
+  // Get SEOBNRv4 ringdown frequency for 22 mode
+  double Mf_final = SEOBNRROM_Ringdown_Mf_From_Mtot_Eta(Mtot_sec, eta, chi1,
+                                                        chi2, SEOBNRv4);
+
+  // prevent gsl interpolation errors
+  // The ringdown frequency Mf_final is only used to evaluate the spline_phi
+  // derivative below and spline_phi has domain [Mf_ROM_min, Mf_ROM_max].
+  // Mf_final should always be inside this interval, but we'll check anyway.
+  if (Mf_final > Mf_ROM_max)
+    Mf_final = Mf_ROM_max;
+  if (Mf_final < Mf_ROM_min) {
+    XLALDestroyREAL8Sequence(freqs);
+    gsl_spline_free(spline_amp);
+    gsl_spline_free(spline_phi);
+    gsl_interp_accel_free(acc_amp);
+    gsl_interp_accel_free(acc_phi);
+    SEOBNRROMdataDS_coeff_Cleanup(romdata_coeff_lo);
+    SEOBNRROMdataDS_coeff_Cleanup(romdata_coeff_hi);
+    XLAL_ERROR(XLAL_EDOM, "f_ringdown < f_min");
+  }
+
+  // Time correction is t(f_final) = 1/(2pi) dphi/df (f_final)
+  // We compute the dimensionless time correction t/M since we use geometric units.
+  REAL8 t_corr = gsl_spline_eval_deriv(spline_phi, Mf_final, acc_phi) / (2*LAL_PI);
+
   int ret = XLAL_SUCCESS;
+  REAL8 mband_threshold = XLALSimInspiralWaveformParamsLookupMultibandThreshold(LALparams);
+  bool multiband = (deltaF > 0 && mband_threshold > 0 && freqs->length > 0);
   // Assemble waveform from aplitude and phase
-  if (NRTidal_version == NRTidalv2_V) {
+  if (multiband) {
+    /* Evaluate the splines on a coarse grid and interpolate onto the uniform one;
+     * the time correction is folded into the phase so it is interpolated too */
+    SEOBNRv4ROMMultibandData mband_data = {
+      .spline_amp = spline_amp, .spline_phi = spline_phi,
+      .acc_amp = acc_amp, .acc_phi = acc_phi,
+      .Mf_ROM_max = Mf_ROM_max, .fRef_geom = fRef_geom,
+      .phase_change = phase_change, .t_corr = t_corr,
+      .amp_scale = s*amp0, .NRTidal_version = NRTidal_version
+    };
+    if (NRTidal_version == NRTidalv2_V) {
+      const REAL8 factor = sqrt(1. - 4.*eta);
+      mband_data.m1 = 0.5*Mtot*(1.+ factor);
+      mband_data.m2 = 0.5*Mtot*(1.- factor);
+      mband_data.lambda1 = XLALSimInspiralWaveformParamsLookupTidalLambda1(LALparams);
+      mband_data.lambda2 = XLALSimInspiralWaveformParamsLookupTidalLambda2(LALparams);
+    }
+    ret = XLALSimIMRMultibandEvaluate(pdata + offset, freqs->data[0], deltaF_geom, freqs->length,
+                                      mband_threshold,
+                                      XLALSimInspiralWaveformParamsLookupMultibandAmpInterpol(LALparams),
+                                      SEOBNRv4ROMMultibandAmpPhase, &mband_data);
+    if (ret != XLAL_SUCCESS) {
+      XLALDestroyREAL8Sequence(freqs);
+      gsl_spline_free(spline_amp);
+      gsl_spline_free(spline_phi);
+      gsl_interp_accel_free(acc_amp);
+      gsl_interp_accel_free(acc_phi);
+      SEOBNRROMdataDS_coeff_Cleanup(romdata_coeff_lo);
+      SEOBNRROMdataDS_coeff_Cleanup(romdata_coeff_hi);
+      XLAL_ERROR(XLAL_EFUNC, "Multiband evaluation of SEOBNRv4ROM failed.");
+    }
+    for (UINT4 j=offset; j<offset+freqs->length; j++) {
+      COMPLEX16 htilde = pdata[j];
+      pdata[j] =      pcoef * htilde;
+      cdata[j] = -I * ccoef * htilde;
+    }
+  } else if (NRTidal_version == NRTidalv2_V) {
     /* get component masses (in solar masses) from mtotal and eta! */
     const REAL8 factor = sqrt(1. - 4.*eta);
     const REAL8 m1 = 0.5*Mtot*(1.+ factor);
@@ -1052,35 +1168,9 @@ static int SEOBNRv4ROMCore(
       }
    }
 
-  /* Correct phasing so we coalesce at t=0 (with the definition of the epoch=-1/deltaF above) */
-
-  // Get SEOBNRv4 ringdown frequency for 22 mode
-  double Mf_final = SEOBNRROM_Ringdown_Mf_From_Mtot_Eta(Mtot_sec, eta, chi1,
-                                                        chi2, SEOBNRv4);
-
-  // prevent gsl interpolation errors
-  // The ringdown frequency Mf_final is only used to evaluate the spline_phi
-  // derivative below and spline_phi has domain [Mf_ROM_min, Mf_ROM_max].
-  // Mf_final should always be inside this interval, but we'll check anyway.
-  if (Mf_final > Mf_ROM_max)
-    Mf_final = Mf_ROM_max;
-  if (Mf_final < Mf_ROM_min) {
-    XLALDestroyREAL8Sequence(freqs);
-    gsl_spline_free(spline_amp);
-    gsl_spline_free(spline_phi);
-    gsl_interp_accel_free(acc_amp);
-    gsl_interp_accel_free(acc_phi);
-    SEOBNRROMdataDS_coeff_Cleanup(romdata_coeff_lo);
-    SEOBNRROMdataDS_coeff_Cleanup(romdata_coeff_hi);
-    XLAL_ERROR(XLAL_EDOM, "f_ringdown < f_min");
-  }
-
-  // Time correction is t(f_final) = 1/(2pi) dphi/df (f_final)
-  // We compute the dimensionless time correction t/M since we use geometric units.
-  REAL8 t_corr = gsl_spline_eval_deriv(spline_phi, Mf_final, acc_phi) / (2*LAL_PI);
 
-  // Now correct phase
-  for (UINT4 i=0; i<freqs->length; i++) { // loop over frequency points in sequence
+  // Now correct phase; the multiband path has already included the time shift
+  for (UINT4 i=0; i<freqs->length && !multiband; i++) { // loop over frequency points in sequence
     double f = freqs->data[i] - fRef_geom;
     int j = i + offset; // shift index for frequency series if needed
     double phase_factor = -2*LAL_PI * f * t_corr;
@@ -458,6 +458,166 @@ XLALSpinAlignedHiSRStopConditionV4 (double UNUSED t, /**< UNUSED */
     return GSL_SUCCESS;
 }
 
+/* Buffers of the workspace handed out as REAL8Vectors by
+ * XLALSimIMRSpinAlignedEOBModesWithWorkspace(); one per vector that is alive
+ * at the same time during the generation */
+typedef enum tagSEOBWorkspaceVectorSlot {
+  SEOB_WS_VALUES,
+  SEOB_WS_SIGMASTAR,
+  SEOB_WS_SIGMAKERR,
+  SEOB_WS_TMPVALUES,
+  SEOB_WS_SIGREHI,
+  SEOB_WS_SIGIMHI,
+  SEOB_WS_OMEGAHI,
+  SEOB_WS_VPHIVECHI,
+  SEOB_WS_AMPNQC,
+  SEOB_WS_PHASENQC,
+  SEOB_WS_HAMVHI,
+  SEOB_WS_HLMALLHI,
+  SEOB_WS_RDMATCHPOINT,
+  SEOB_WS_OMVEC,
+  SEOB_WS_AMPL,
+  SEOB_WS_PHTMP,
+  SEOB_WS_SIGREVEC,
+  SEOB_WS_SIGIMVEC,
+  SEOB_WS_SIGRECOORBVEC,
+  SEOB_WS_SIGIMCOORBVEC,
+  SEOB_WS_HLMALL,
+  SEOB_WS_HAMV,
+  SEOB_WS_OMEGAVEC,
+  SEOB_WS_VPHIVEC,
+  SEOB_WS_TMPRE,
+  SEOB_WS_TMPIM,
+  SEOB_WS_TIMELIST,
+  SEOB_WS_NUM_VECTORS
+} SEOBWorkspaceVectorSlot;
+
+/* Orders of the adaptive integrators kept by the workspace */
+enum { SEOB_WS_RK45, SEOB_WS_RK8PD, SEOB_WS_NUM_INTEGRATORS };
+
+struct tagLALSimIMRSpinAlignedEOBWorkspace {
+  REAL8Vector vectors[SEOB_WS_NUM_VECTORS]; /**< vector headers, length set at every use */
+  UINT4 capacity[SEOB_WS_NUM_VECTORS];      /**< allocated length of vectors[i].data */
+  REAL8 *splineWork;                        /**< cubic spline coefficients and scratch space */
+  size_t splineWorkCapacity;                /**< allocated length of splineWork */
+  LALAdaptiveRungeKuttaIntegrator *integrators[SEOB_WS_NUM_INTEGRATORS];
+};
+
+/**
+ * Return a vector of the given length: a fresh one if ws is NULL, otherwise
+ * the buffer of the given slot of the workspace, grown if needed. As with
+ * XLALCreateREAL8Vector() the contents are not initialised.
+ */
+static REAL8Vector *SEOBWorkspaceCreateREAL8Vector(LALSimIMRSpinAlignedEOBWorkspace *ws, SEOBWorkspaceVectorSlot slot, UINT4 length)
+{
+  if (!ws)
+    return XLALCreateREAL8Vector(length);
+  if (length > ws->capacity[slot]) {
+    REAL8 *data = XLALRealloc(ws->vectors[slot].data, length * sizeof(REAL8));
+    XLAL_CHECK_NULL(data, XLAL_ENOMEM);
+    ws->vectors[slot].data = data;
+    ws->capacity[slot] = length;
+  }
+  ws->vectors[slot].length = length;
+  return &ws->vectors[slot];
+}
+
+/**
+ * Release a vector: vectors owned by the workspace are kept for the next
+ * waveform, any other vector is destroyed.
+ */
+static void SEOBWorkspaceDestroyREAL8Vector(LALSimIMRSpinAlignedEOBWorkspace *ws, REAL8Vector *vector)
+{
+  if (ws)
+    for (UINT4 i = 0; i < SEOB_WS_NUM_VECTORS; i++)
+      if (vector == &ws->vectors[i])
+        return;
+  XLALDestroyREAL8Vector(vector);
+}
+
+/**
+ * Return scratch space of at least length elements for the cubic spline
+ * coefficients, see optimized_cspline_init(); must be released with
+ * SEOBWorkspaceReleaseSplineWork().
+ */
+static REAL8 *SEOBWorkspaceSplineWork(LALSimIMRSpinAlignedEOBWorkspace *ws, size_t length)
+{
+  if (!ws) {
+    REAL8 *work = XLALMalloc(length * sizeof(REAL8));
+    XLAL_CHECK_NULL(work, XLAL_ENOMEM);
+    return work;
+  }
+  if (length > ws->splineWorkCapacity) {
+    REAL8 *work = XLALRealloc(ws->splineWork, length * sizeof(REAL8));
+    XLAL_CHECK_NULL(work, XLAL_ENOMEM);
+    ws->splineWork = work;
+    ws->splineWorkCapacity = length;
+  }
+  return ws->splineWork;
+}
+
+static void SEOBWorkspaceReleaseSplineWork(LALSimIMRSpinAlignedEOBWorkspace *ws, REAL8 *work)
+{
+  if (!ws)
+    XLALFree(work);
+}
+
+/**
+ * Return an adaptive Runge-Kutta integrator as returned by
+ * XLALAdaptiveRungeKutta4Init() (or by
+ * XLALAdaptiveRungeKutta4InitEighthOrderInstead() if eighthOrder is set).
+ * With a workspace the GSL stepper, control and evolution objects of the
+ * previous waveform are reset and reused rather than allocated again.
+ */
+static LALAdaptiveRungeKuttaIntegrator *SEOBWorkspaceIntegratorInit(LALSimIMRSpinAlignedEOBWorkspace *ws, INT4 eighthOrder, int dim,
+    int (*dydt) (double t, const double y[], double dydt[], void *params),
+    int (*stop) (double t, const double y[], double dydt[], void *params),
+    double eps_abs, double eps_rel)
+{
+  LALAdaptiveRungeKuttaIntegrator *integrator = NULL;
+  INT4 order = eighthOrder ? SEOB_WS_RK8PD : SEOB_WS_RK45;
+
+  if (ws)
+    integrator = ws->integrators[order];
+  if (integrator && integrator->sys->dimension != (size_t) dim) {
+    XLALAdaptiveRungeKuttaFree(integrator);
+    integrator = ws->integrators[order] = NULL;
+  }
+
+  if (!integrator) {
+    if (eighthOrder)
+      integrator = XLALAdaptiveRungeKutta4InitEighthOrderInstead(dim, dydt, stop, eps_abs, eps_rel);
+    else
+      integrator = XLALAdaptiveRungeKutta4Init(dim, dydt, stop, eps_abs, eps_rel);
+    XLAL_CHECK_NULL(integrator, XLAL_EFUNC);
+    if (ws)
+      ws->integrators[order] = integrator;
+    return integrator;
+  }
+
+  /* Same state as a freshly initialised integrator */
+  XLAL_CALLGSL(gsl_odeiv_step_reset(integrator->step));
+  XLAL_CALLGSL(gsl_odeiv_evolve_reset(integrator->evolve));
+  XLAL_CALLGSL(gsl_odeiv_control_init(integrator->control, eps_abs, eps_rel, 1.0, 0.0));
+  integrator->dydt = dydt;
+  integrator->stop = stop;
+  integrator->sys->function = dydt;
+  integrator->sys->params = NULL;
+  integrator->retries = 6;
+  integrator->stopontestonly = 0;
+  integrator->returncode = 0;
+  return integrator;
+}
+
+static void SEOBWorkspaceIntegratorFree(LALSimIMRSpinAlignedEOBWorkspace *ws, LALAdaptiveRungeKuttaIntegrator *integrator)
+{
+  if (ws)
+    for (UINT4 i = 0; i < SEOB_WS_NUM_INTEGRATORS; i++)
+      if (integrator == ws->integrators[i])
+        return;
+  XLALAdaptiveRungeKuttaFree(integrator);
+}
+
 /**
  * @addtogroup LALSimIMRSpinAlignedEOB_c
  *
@@ -579,6 +739,40 @@ XLALSimIMRSpinAlignedEOBPeakFrequency (REAL8 m1SI,
 
 
 
+/**
+ * Create a workspace for the spin-aligned EOB models. Passed to
+ * XLALSimIMRSpinAlignedEOBWaveformWithWorkspace() and friends, it keeps the
+ * vectors, the cubic spline coefficients and the adaptive integrators of the
+ * generation alive between calls, so that generating many waveforms, e.g. in
+ * a sampler, does not allocate them again for every waveform and stage.
+ * The buffers grow to the largest waveform generated and are only released
+ * by XLALSimIMRSpinAlignedEOBWorkspaceDestroy(). A workspace must not be
+ * used by more than one thread at a time; use one workspace per thread.
+ */
+LALSimIMRSpinAlignedEOBWorkspace *
+XLALSimIMRSpinAlignedEOBWorkspaceCreate (void)
+{
+  LALSimIMRSpinAlignedEOBWorkspace *ws = XLALCalloc (1, sizeof (*ws));
+  XLAL_CHECK_NULL (ws, XLAL_ENOMEM);
+  return ws;
+}
+
+/**
+ * Destroy a workspace created by XLALSimIMRSpinAlignedEOBWorkspaceCreate().
+ */
+void
+XLALSimIMRSpinAlignedEOBWorkspaceDestroy (LALSimIMRSpinAlignedEOBWorkspace * ws)
+{
+  if (!ws)
+    return;
+  for (UINT4 i = 0; i < SEOB_WS_NUM_VECTORS; i++)
+    XLALFree (ws->vectors[i].data);
+  XLALFree (ws->splineWork);
+  for (UINT4 i = 0; i < SEOB_WS_NUM_INTEGRATORS; i++)
+    XLALAdaptiveRungeKuttaFree (ws->integrators[i]);
+  XLALFree (ws);
+}
+
 int
 XLALSimIMRSpinAlignedEOBWaveform (
     REAL8TimeSeries ** hplus,
@@ -610,6 +804,50 @@ XLALSimIMRSpinAlignedEOBWaveform (
     LALDict *LALParams
     /**<< Dictionary of additional wf parameters, including tidal and nonGR */
 )
+{
+  return XLALSimIMRSpinAlignedEOBWaveformWithWorkspace (hplus, hcross, phiC,
+      deltaT, m1SI, m2SI, fMin, r, inc, spin1z, spin2z, SpinAlignedEOBversion,
+      LALParams, NULL);
+}
+
+/**
+ * As XLALSimIMRSpinAlignedEOBWaveform(), but taking the buffers needed
+ * during the generation from workspace, see
+ * XLALSimIMRSpinAlignedEOBWorkspaceCreate().
+ */
+int
+XLALSimIMRSpinAlignedEOBWaveformWithWorkspace (
+    REAL8TimeSeries ** hplus,
+    /**<< OUTPUT, +-polarization waveform */
+    REAL8TimeSeries ** hcross,
+    /**<< OUTPUT, x-polarization waveform */
+    const REAL8 phiC,
+    /**<< coalescence orbital phase (rad) */
+    REAL8 deltaT,
+    /**<< sampling time step */
+    const REAL8 m1SI,
+    /**<< mass-1 in SI unit */
+    const REAL8 m2SI,
+    /**<< mass-2 in SI unit */
+    const REAL8 fMin,
+    /**<< starting frequency of the 22 mode (Hz) */
+    const REAL8 r,
+    /**<< distance in SI unit */
+    const REAL8 inc,
+    /**<< inclination angle */
+    const REAL8 spin1z,
+    /**<< z-component of spin-1, dimensionless */
+    const REAL8 spin2z,
+    /**<< z-component of spin-2, dimensionless */
+    UINT4 SpinAlignedEOBversion,
+    /**<< 1 for SEOBNRv1, 2 for SEOBNRv2, 4 for SEOBNRv4,
+    201 for SEOBNRv2T,401 for SEOBNRv4T, 41 for SEOBNRv4HM,
+    4111 for SEOBNRv4HM_PA, 4112 for pSEOBNRv4HM_PA */
+    LALDict *LALParams
+    /**<< Dictionary of additional wf parameters, including tidal and nonGR */,
+    LALSimIMRSpinAlignedEOBWorkspace *workspace
+    /**<< workspace to reuse buffers from, or NULL */
+)
 {
   int ret;
 
@@ -724,7 +962,7 @@ XLALSimIMRSpinAlignedEOBWaveform (
 #if debugOutput
       printf("First run SEOBNRv4 to compute NQCs\n");
 #endif
-      ret = XLALSimIMRSpinAlignedEOBWaveformAll (
+      ret = XLALSimIMRSpinAlignedEOBWaveformAllWithWorkspace (
         hplus, hcross,
         phiC,
         1./32768,
@@ -741,7 +979,8 @@ XLALSimIMRSpinAlignedEOBWaveform (
         0, 0,
         nqcCoeffsInput, nqcFlag,
         ModeArray,
-        TGRParams
+        TGRParams,
+        workspace
     );
       if (ret == XLAL_FAILURE){
         if ( nqcCoeffsInput ) XLALDestroyREAL8Vector( nqcCoeffsInput );
@@ -757,7 +996,7 @@ XLALSimIMRSpinAlignedEOBWaveform (
     {
       //REAL8Vector *nqcCoeffsInput = XLALCreateREAL8Vector(10);
       //INT4 nqcFlag = 0;
-      ret = XLALSimIMRSpinAlignedEOBWaveformAll (
+      ret = XLALSimIMRSpinAlignedEOBWaveformAllWithWorkspace (
         hplus, hcross,
         phiC,
         deltaT,
@@ -774,7 +1013,8 @@ XLALSimIMRSpinAlignedEOBWaveform (
         quadparam1, quadparam2,
         nqcCoeffsInput, nqcFlag,
         ModeArray,
-        TGRParams
+        TGRParams,
+        workspace
     );
      if (ret == XLAL_FAILURE){
        if ( nqcCoeffsInput ) XLALDestroyREAL8Vector( nqcCoeffsInput );
@@ -874,6 +1114,77 @@ XLALSimIMRSpinAlignedEOBModes (
   LALDict *TGRParams
   /**<< Dictionary containing parameters for tests of General Relativity */
 )
+{
+  return XLALSimIMRSpinAlignedEOBModesWithWorkspace (hlmmode, dynamics_out,
+      dynamicsHi_out, deltaT, m1SI, m2SI, fMin, r, spin1z, spin2z,
+      SpinAlignedEOBversion, lambda2Tidal1, lambda2Tidal2, omega02Tidal1,
+      omega02Tidal2, lambda3Tidal1, lambda3Tidal2, omega03Tidal1,
+      omega03Tidal2, quadparam1, quadparam2, nqcCoeffsInput, nqcFlag,
+      PAParams, TGRParams, NULL);
+}
+
+/**
+ * As XLALSimIMRSpinAlignedEOBModes(), but taking the buffers needed during
+ * the generation from workspace, see
+ * XLALSimIMRSpinAlignedEOBWorkspaceCreate().
+ */
+int
+XLALSimIMRSpinAlignedEOBModesWithWorkspace (
+  SphHarmTimeSeries ** hlmmode,
+  /**<< OUTPUT, mode hlm */
+  //SM
+  REAL8Vector ** dynamics_out, /**<< OUTPUT, low-sampling dynamics */
+  REAL8Vector ** dynamicsHi_out, /**<< OUTPUT, high-sampling dynamics */
+  //SM
+  REAL8 deltaT,
+  /**<< sampling time step */
+  const REAL8 m1SI,
+  /**<< mass-1 in SI unit */
+  const REAL8 m2SI,
+  /**<< mass-2 in SI unit */
+  const REAL8 fMin,
+  /**<< starting frequency of the 22 mode (Hz) */
+  const REAL8 r,
+  /**<< distance in SI unit */
+  const REAL8 spin1z,
+  /**<< z-component of spin-1, dimensionless */
+  const REAL8 spin2z,
+  /**<< z-component of spin-2, dimensionless */
+  UINT4 SpinAlignedEOBversion,
+  /**<< 1 for SEOBNRv1, 2 for SEOBNRv2, 4 for SEOBNRv4,
+  201 for SEOBNRv2T, 401 for SEOBNRv4T, 41 for SEOBNRv4HM,
+  4111 for SEOBNRv4HM_PA, 4112 for pSEOBNRv4HM_PA */
+  const REAL8 lambda2Tidal1,
+  /**<< dimensionless adiabatic quadrupole tidal deformability for body 1 (2/3 k2/C^5) */
+  const REAL8 lambda2Tidal2,
+  /**<< dimensionless adiabatic quadrupole tidal deformability for body 2 (2/3 k2/C^5) */
+  const REAL8 omega02Tidal1,
+  /**<< quadrupole f-mode angular freq for body 1 m_1*omega_{02,1}*/
+  const REAL8 omega02Tidal2,
+  /**<< quadrupole f-mode angular freq for body 2 m_2*omega_{02,2}*/
+  const REAL8 lambda3Tidal1,
+  /**<< dimensionless adiabatic octupole tidal deformability for body 1 (2/15 k3/C^7) */
+  const REAL8 lambda3Tidal2,
+  /**<< dimensionless adiabatic octupole tidal deformability for body 2 (2/15 k3/C^7) */
+  const REAL8 omega03Tidal1,
+  /**<< octupole f-mode angular freq for body 1 m_1*omega_{03,1}*/
+  const REAL8 omega03Tidal2,
+  /**<< octupole f-mode angular freq for body 2 m_2*omega_{03,2}*/
+  const REAL8 quadparam1,
+  /**<< parameter kappa_1 of the spin-induced quadrupole for body 1, quadrupole is Q_A = -kappa_A m_A^3 chi_A^2 */
+  const REAL8 quadparam2,
+  /**<< parameter kappa_2 of the spin-induced quadrupole for body 2, quadrupole is Q_A = -kappa_A m_A^3 chi_A^2 */
+  REAL8Vector *nqcCoeffsInput,
+  /**<< Input NQC coeffs */
+  const INT4 nqcFlag,
+  /**<< Flag to tell the code to use the NQC coeffs input thorugh nqcCoeffsInput */
+  LALDict *PAParams,
+  /**<< Dictionary containing parameters for the post-adiabatic routine */
+  LALDict *TGRParams,
+  /**<< Dictionary containing parameters for tests of General Relativity */
+  LALSimIMRSpinAlignedEOBWorkspace *workspace
+  /**<< workspace to reuse buffers from, or NULL */
+)
 {
   UNUSED REAL8 STEP_SIZE = STEP_SIZE_CALCOMEGA;
   INT4 use_tidal = 0;
@@ -1225,7 +1536,7 @@ XLALSimIMRSpinAlignedEOBModes (
        After ODE solves EOMs (which involves 4 coupled ODEs & thus 4 solution vectors),
        amp & phase are computed explicitly from sparse EOM solution, then interpolated in v2opt/v4opt. */
     num_elements_in_values_vector = 6;
-  if (!(values = XLALCreateREAL8Vector (num_elements_in_values_vector)))
+  if (!(values = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_VALUES, num_elements_in_values_vector)))
     {
       XLAL_ERROR (XLAL_ENOMEM);
     }
@@ -1257,7 +1568,7 @@ XLALSimIMRSpinAlignedEOBModes (
       (&modefreqVec, m1, m2, spin1, spin2, mode_highest_freqL, mode_highest_freqM, 1,
        SpinAlignedEOBapproximant) == XLAL_FAILURE)
     {
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_EFUNC);
     }
 
@@ -1271,7 +1582,7 @@ XLALSimIMRSpinAlignedEOBModes (
     if ( fMin > fRD ) {
         XLALPrintError
         ("XLAL Error - Starting frequency is above ringdown frequency!\n");
-        XLALDestroyREAL8Vector (values);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, values);
         XLAL_ERROR (XLAL_EINVAL);
     }
 
@@ -1281,20 +1592,20 @@ XLALSimIMRSpinAlignedEOBModes (
       XLALPrintError
 	("XLAL Error - %s: Ringdown frequency > Nyquist frequency!\nAt present this situation is not supported.\n",
 	 __func__);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
      XLAL_ERROR (XLAL_EDOM);
     }
 
-  if (!(sigmaStar = XLALCreateREAL8Vector (3)))
+  if (!(sigmaStar = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGMASTAR, 3)))
     {
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_ENOMEM);
     }
 
-  if (!(sigmaKerr = XLALCreateREAL8Vector (3)))
+  if (!(sigmaKerr = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGMAKERR, 3)))
     {
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_ENOMEM);
     }
 
@@ -1388,18 +1699,18 @@ XLALSimIMRSpinAlignedEOBModes (
   if (XLALSimIMRSpinEOBCalculateSigmaStar (sigmaStar, m1, m2, &s1Vec, &s2Vec)
       == XLAL_FAILURE)
     {
-      XLALDestroyREAL8Vector (sigmaKerr);
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_EFUNC);
     }
 
   if (XLALSimIMRSpinEOBCalculateSigmaKerr (sigmaKerr, m1, m2, &s1Vec, &s2Vec)
       == XLAL_FAILURE)
     {
-      XLALDestroyREAL8Vector (sigmaKerr);
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_EFUNC);
     }
 
@@ -1422,13 +1733,13 @@ XLALSimIMRSpinAlignedEOBModes (
 	("XLAL Error - %s: Unknown SEOBNR version!\nAt present only v1, v2, and v4 are available.\n",
 	 __func__);
       if(sigmaKerr){
-        XLALDestroyREAL8Vector (sigmaKerr);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
       }
       if(sigmaStar){
-        XLALDestroyREAL8Vector (sigmaStar);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
       }
       if(values){
-        XLALDestroyREAL8Vector (values);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       }
       XLAL_ERROR (XLAL_EINVAL);
       break;
@@ -1446,9 +1757,9 @@ XLALSimIMRSpinAlignedEOBModes (
     if (XLALSimIMRCalculateSpinEOBHCoeffs
       (&seobCoeffs, eta, a, SpinAlignedEOBversion) == XLAL_FAILURE)
     {
-      XLALDestroyREAL8Vector (sigmaKerr);
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_EFUNC);
     }
   //RC: SEOBNRv4HM uses the same dynamics of SEOBNRv4, we momentarily put use_hm = 0 such that it uses the SEOBNRv4 coefficients to compute the flux LALSimIMRSpinEOBFactorizedFlux
@@ -1459,9 +1770,9 @@ XLALSimIMRSpinAlignedEOBModes (
       (&hCoeffs, &seobParams, m1, m2, eta, tplspin, chiS, chiA,
        SpinAlignedEOBversion) == XLAL_FAILURE)
     {
-      XLALDestroyREAL8Vector (sigmaKerr);
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_EFUNC);
     }
   if(use_hm == 1){
@@ -1471,9 +1782,9 @@ XLALSimIMRSpinAlignedEOBModes (
   if (XLALSimIMREOBComputeNewtonMultipolePrefixes
       (&prefixes, eobParams.m1, eobParams.m2) == XLAL_FAILURE)
     {
-      XLALDestroyREAL8Vector (sigmaKerr);
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_EFUNC);
     }
 
@@ -1484,13 +1795,13 @@ XLALSimIMRSpinAlignedEOBModes (
 	  XLAL_FAILURE)
 	{
     if(sigmaKerr){
-      XLALDestroyREAL8Vector (sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
     }
     if(sigmaStar){
-      XLALDestroyREAL8Vector (sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
     }
     if(values){
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
     }
 	  XLAL_ERROR (XLAL_EFUNC);
 	}
@@ -1500,13 +1811,13 @@ XLALSimIMRSpinAlignedEOBModes (
 	  (&nqcCoeffs, 2, 2, m1, m2, a, chiA) == XLAL_FAILURE)
 	{
     if(sigmaKerr){
-      XLALDestroyREAL8Vector (sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
     }
     if(sigmaStar){
-      XLALDestroyREAL8Vector (sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
     }
     if(values){
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
     }
 	  XLAL_ERROR (XLAL_EFUNC);
 	}
@@ -1528,13 +1839,13 @@ XLALSimIMRSpinAlignedEOBModes (
 	("XLAL Error - %s: Unknown SEOBNR version!\nAt present only v1, v2, and v4 are available.\n",
 	 __func__);
       if(sigmaKerr){
-        XLALDestroyREAL8Vector (sigmaKerr);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
       }
       if(sigmaStar){
-        XLALDestroyREAL8Vector (sigmaStar);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
       }
       if(values){
-        XLALDestroyREAL8Vector (values);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       }
       XLAL_ERROR (XLAL_EINVAL);
       break;
@@ -1546,12 +1857,12 @@ XLALSimIMRSpinAlignedEOBModes (
 
   /* Set the initial conditions. For now we use the generic case */
   /* Can be simplified if spin-aligned initial conditions solver available. The cost of generic code is negligible though. */
-  REAL8Vector *tmpValues = XLALCreateREAL8Vector (14);
+  REAL8Vector *tmpValues = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_TMPVALUES, 14);
   if (!tmpValues)
     {
-      XLALDestroyREAL8Vector (sigmaKerr);
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_ENOMEM);
     }
 
@@ -1564,10 +1875,10 @@ XLALSimIMRSpinAlignedEOBModes (
       (tmpValues, m1, m2, fStart, 0, s1Data, s2Data, &seobParams,
        use_optimized_v2_or_v4) == XLAL_FAILURE)
     {
-      XLALDestroyREAL8Vector (tmpValues);
-      XLALDestroyREAL8Vector (sigmaKerr);
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       XLAL_ERROR (XLAL_EFUNC);
     }
 
@@ -1666,11 +1977,11 @@ XLALSimIMRSpinAlignedEOBModes (
     if ( use_tidal == 1 ) {
         if (!
             (integrator =
-             XLALAdaptiveRungeKutta4Init (4, XLALSpinAlignedHcapDerivative,
+             SEOBWorkspaceIntegratorInit (workspace, 0, 4, XLALSpinAlignedHcapDerivative,
                                           XLALSpinAlignedNSNSStopCondition,
                                           EPS_ABS, EPS_REL)))
         {
-            XLALDestroyREAL8Vector (values);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, values);
             XLAL_ERROR (XLAL_EFUNC);
         }
     }
@@ -1679,12 +1990,12 @@ XLALSimIMRSpinAlignedEOBModes (
         {
             if (!
                 (integrator =
-                 XLALAdaptiveRungeKutta4InitEighthOrderInstead (4,
+                 SEOBWorkspaceIntegratorInit (workspace, 1, 4,
 							  XLALSpinAlignedHcapDerivativeOptimized,
 							  XLALEOBSpinAlignedStopCondition,
 							  EPS_ABS, EPS_REL)))
             {
-                XLALDestroyREAL8Vector (values);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, values);
                 XLAL_ERROR (XLAL_EFUNC);
             }
         }
@@ -1694,22 +2005,22 @@ XLALSimIMRSpinAlignedEOBModes (
           if(postAdiabaticFlag){
               if (!
                   (integrator =
-                  XLALAdaptiveRungeKutta4Init (4, XLALSpinAlignedHcapDerivativeOptimized,
+                  SEOBWorkspaceIntegratorInit (workspace, 0, 4, XLALSpinAlignedHcapDerivativeOptimized,
             XLALEOBSpinAlignedStopCondition,
             EPS_ABS, EPS_REL)))
               {
-                  XLALDestroyREAL8Vector (values);
+                  SEOBWorkspaceDestroyREAL8Vector (workspace, values);
                   XLAL_ERROR (XLAL_EFUNC);
               }
           }
           else{
             if (!
                   (integrator =
-                  XLALAdaptiveRungeKutta4Init (4, XLALSpinAlignedHcapDerivative,
+                  SEOBWorkspaceIntegratorInit (workspace, 0, 4, XLALSpinAlignedHcapDerivative,
             XLALEOBSpinAlignedStopCondition,
             EPS_ABS, EPS_REL)))
               {
-                  XLALDestroyREAL8Vector (values);
+                  SEOBWorkspaceDestroyREAL8Vector (workspace, values);
                   XLAL_ERROR (XLAL_EFUNC);
               }
           }
@@ -1737,7 +2048,8 @@ XLALSimIMRSpinAlignedEOBModes (
 	SEOBNRv2OptimizedInterpolatorNoAmpPhase (dynamicstmp, 0.,
 						 deltaT / mTScaled,
 						 retLen_fromOptStep2,
-						 &dynamics);
+						 &dynamics,
+						 workspace ? SEOBWorkspaceSplineWork (workspace, 5 * retLen_fromOptStep2) : NULL);
       /* END OPTIMIZED */
     }
   else
@@ -1977,7 +2289,8 @@ XLALSimIMRSpinAlignedEOBModes (
 	SEOBNRv2OptimizedInterpolatorNoAmpPhase (dynamicsHitmp, 0.,
 						 deltaTHigh / mTScaled,
 						 retLen_fromOptStep3,
-						 &dynamicsHi);
+						 &dynamicsHi,
+						 workspace ? SEOBWorkspaceSplineWork (workspace, 5 * retLen_fromOptStep3) : NULL);
       /* END OPTIMIZED */
     }
   else
@@ -1991,16 +2304,16 @@ XLALSimIMRSpinAlignedEOBModes (
   if (retLen == XLAL_FAILURE || dynamicsHi == NULL)
     {
       if(tmpValues){
-        XLALDestroyREAL8Vector (tmpValues);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
       }
       if(sigmaKerr){
-        XLALDestroyREAL8Vector (sigmaKerr);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
       }
       if(sigmaStar){
-        XLALDestroyREAL8Vector (sigmaStar);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
       }
       if(values){
-        XLALDestroyREAL8Vector (values);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       }
       XLAL_ERROR (XLAL_EFUNC);
     }
@@ -2061,62 +2374,62 @@ XLALSimIMRSpinAlignedEOBModes (
     {
       /*If dtau220>0 we need a larger array than in GR case to accomodate the whole ringdown*/
       sigReHi =
-		XLALCreateREAL8Vector (retLen +
+		SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGREHI,retLen +
 			   	   (UINT4) ceil (20 * (1. + dtau220) /
 					 	 (cimag (modeFreq) * deltaTHigh)));
       sigImHi =
-		XLALCreateREAL8Vector (retLen +
+		SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGIMHI,retLen +
 			   	   (UINT4) ceil (20 * (1. + dtau220) /
 					 	 (cimag (modeFreq) * deltaTHigh)));
       omegaHi =
-		XLALCreateREAL8Vector (retLen +
+		SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_OMEGAHI,retLen +
 			   	   (UINT4) ceil (20 * (1. + dtau220) /
 					 	 (cimag (modeFreq) * deltaTHigh)));
       vPhiVecHi =
-		XLALCreateREAL8Vector (retLen +
+		SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_VPHIVECHI,retLen +
 				   (UINT4) ceil (20 * (1. + dtau220) /
 						 (cimag (modeFreq) * deltaTHigh)));
     }
   else { 
     /* Allocate the high sample rate vectors */
       sigReHi =
-        XLALCreateREAL8Vector (retLen +
+        SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGREHI,retLen +
 			       (UINT4) ceil (20 /
 					     (cimag (modeFreq) * deltaTHigh)));
       sigImHi =
-        XLALCreateREAL8Vector (retLen +
+        SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGIMHI,retLen +
 			       (UINT4) ceil (20 /
 					     (cimag (modeFreq) * deltaTHigh)));
       omegaHi =
-        XLALCreateREAL8Vector (retLen +
+        SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_OMEGAHI,retLen +
 			       (UINT4) ceil (20 /
 					     (cimag (modeFreq) * deltaTHigh)));
       vPhiVecHi =
-    	XLALCreateREAL8Vector (retLen +
+    	SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_VPHIVECHI,retLen +
                                (UINT4) ceil (20 /
                                        	     (cimag (modeFreq) * deltaTHigh)));
 
   }
 
-  ampNQC = XLALCreateREAL8Vector (retLen);
-  phaseNQC = XLALCreateREAL8Vector (retLen);
-  hamVHi = XLALCreateREAL8Vector (retLen);
+  ampNQC = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_AMPNQC, retLen);
+  phaseNQC = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_PHASENQC, retLen);
+  hamVHi = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_HAMVHI, retLen);
   //RC: we save the Hamiltonian in a vector such that we can compute it only once
   //and use it for calculate all the modes
 
   if (!sigReHi || !sigImHi || !omegaHi || !ampNQC || !phaseNQC|| !hamVHi)
     {
       if(tmpValues){
-        XLALDestroyREAL8Vector (tmpValues);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
       }
       if(sigmaKerr){
-        XLALDestroyREAL8Vector (sigmaKerr);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
       }
       if(sigmaStar){
-        XLALDestroyREAL8Vector (sigmaStar);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
       }
       if(values){
-        XLALDestroyREAL8Vector (values);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       }
       XLAL_ERROR (XLAL_ENOMEM);
     }
@@ -2319,37 +2632,37 @@ gsl_interp_accel_free( acc );
             ("XLAL Error - %s: Unknown SEOBNR version!\nAt present only v1 and v2 are available.\n",
              __func__);
              if(tmpValues){
-               XLALDestroyREAL8Vector (tmpValues);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
              }
              if(sigmaKerr){
-               XLALDestroyREAL8Vector (sigmaKerr);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
              }
              if(sigmaStar){
-               XLALDestroyREAL8Vector (sigmaStar);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
              }
              if(values){
-               XLALDestroyREAL8Vector (values);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, values);
              }
              if(sigReHi){
-               XLALDestroyREAL8Vector(sigReHi);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
              }
              if(sigImHi){
-               XLALDestroyREAL8Vector(sigImHi);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
              }
              if(omegaHi){
-               XLALDestroyREAL8Vector(omegaHi);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
              }
              if(vPhiVecHi){
-               XLALDestroyREAL8Vector(vPhiVecHi);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
              }
              if(ampNQC){
-               XLALDestroyREAL8Vector(ampNQC);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
              }
              if(phaseNQC){
-               XLALDestroyREAL8Vector(phaseNQC);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
              }
              if(hamVHi){
-               XLALDestroyREAL8Vector(hamVHi);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
              }
             XLAL_ERROR (XLAL_EINVAL);
             break;
@@ -2373,37 +2686,37 @@ gsl_interp_accel_free( acc );
          SpinAlignedEOBversion) == XLAL_FAILURE)
       {
         if(tmpValues){
-          XLALDestroyREAL8Vector (tmpValues);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
         }
         if(sigmaKerr){
-          XLALDestroyREAL8Vector (sigmaKerr);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
         }
         if(sigmaStar){
-          XLALDestroyREAL8Vector (sigmaStar);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
         }
         if(values){
-          XLALDestroyREAL8Vector (values);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, values);
         }
         if(sigReHi){
-          XLALDestroyREAL8Vector(sigReHi);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
         }
         if(sigImHi){
-          XLALDestroyREAL8Vector(sigImHi);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
         }
         if(omegaHi){
-          XLALDestroyREAL8Vector(omegaHi);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
         }
         if(vPhiVecHi){
-               XLALDestroyREAL8Vector(vPhiVecHi);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
              }
         if(ampNQC){
-          XLALDestroyREAL8Vector(ampNQC);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
         }
         if(phaseNQC){
-          XLALDestroyREAL8Vector(phaseNQC);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
         }
         if(hamVHi){
-          XLALDestroyREAL8Vector(hamVHi);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
         }
         XLAL_ERROR (XLAL_EFUNC);
       }
@@ -2425,7 +2738,7 @@ gsl_interp_accel_free( acc );
 
 
 
-    hLMAllHi = XLALCreateREAL8Vector((UINT4)2*sigReHi->length*nModes);
+    hLMAllHi = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_HLMALLHI, (UINT4)2*sigReHi->length*nModes);
     INT4 status = XLAL_SUCCESS;
     memset(hLMAllHi->data, 0, hLMAllHi->length*sizeof (REAL8));
 for ( UINT4 k = 0; k<nModes; k++) {
@@ -2456,40 +2769,40 @@ for ( UINT4 k = 0; k<nModes; k++) {
 	  if (status == XLAL_FAILURE)
         {
             if(tmpValues){
-              XLALDestroyREAL8Vector (tmpValues);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
             }
             if(sigmaKerr){
-              XLALDestroyREAL8Vector (sigmaKerr);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
             }
             if(sigmaStar){
-              XLALDestroyREAL8Vector (sigmaStar);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
             }
             if(values){
-              XLALDestroyREAL8Vector (values);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, values);
             }
             if(sigReHi){
-              XLALDestroyREAL8Vector(sigReHi);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
             }
             if(sigImHi){
-              XLALDestroyREAL8Vector(sigImHi);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
             }
             if(omegaHi){
-              XLALDestroyREAL8Vector(omegaHi);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
             }
             if(vPhiVecHi){
-               XLALDestroyREAL8Vector(vPhiVecHi);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
              }
             if(ampNQC){
-              XLALDestroyREAL8Vector(ampNQC);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
             }
             if(phaseNQC){
-              XLALDestroyREAL8Vector(phaseNQC);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
             }
             if(hamVHi){
-              XLALDestroyREAL8Vector(hamVHi);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
             }
             if(hLMAllHi){
-              XLALDestroyREAL8Vector(hLMAllHi);
+              SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
             }
             XLAL_ERROR (XLAL_EFUNC);
         }
@@ -2550,40 +2863,40 @@ for ( UINT4 k = 0; k<nModes; k++) {
 
             {
               if(tmpValues){
-                XLALDestroyREAL8Vector (tmpValues);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
               }
               if(sigmaKerr){
-                XLALDestroyREAL8Vector (sigmaKerr);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
               }
               if(sigmaStar){
-                XLALDestroyREAL8Vector (sigmaStar);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
               }
               if(values){
-                XLALDestroyREAL8Vector (values);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, values);
               }
               if(sigReHi){
-                XLALDestroyREAL8Vector(sigReHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
               }
               if(sigImHi){
-                XLALDestroyREAL8Vector(sigImHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
               }
               if(omegaHi){
-                XLALDestroyREAL8Vector(omegaHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
               }
               if(vPhiVecHi){
-               XLALDestroyREAL8Vector(vPhiVecHi);
+               SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
              }
               if(ampNQC){
-                XLALDestroyREAL8Vector(ampNQC);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
               }
               if(phaseNQC){
-                XLALDestroyREAL8Vector(phaseNQC);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
               }
               if(hamVHi){
-                XLALDestroyREAL8Vector(hamVHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
               }
               if(hLMAllHi){
-                XLALDestroyREAL8Vector(hLMAllHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
               }
               XLAL_ERROR (XLAL_EFUNC);
             }
@@ -2605,15 +2918,15 @@ for ( UINT4 k = 0; k<nModes; k++) {
 
         // FINISHED COMPUTING NQC. NOW MUST FREE ALLOCATED MEMORY!
 
-        XLALDestroyREAL8Vector (tmpValues);
-        XLALDestroyREAL8Vector (sigmaKerr);
-        XLALDestroyREAL8Vector (sigmaStar);
-        XLALDestroyREAL8Vector (values);
-        XLALDestroyREAL8Vector (ampNQC);
-        XLALDestroyREAL8Vector (phaseNQC);
-        XLALDestroyREAL8Vector (sigReVec);
-        XLALDestroyREAL8Vector (sigImVec);
-        XLALAdaptiveRungeKuttaFree (integrator);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, values);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigReVec);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigImVec);
+        SEOBWorkspaceIntegratorFree (workspace, integrator);
         XLALDestroyREAL8Array (dynamics);
         XLALDestroyREAL8Array (dynamicsHi);
 
@@ -2626,9 +2939,9 @@ for ( UINT4 k = 0; k<nModes; k++) {
             XLALDestroyREAL8Array (dynamicsHitmp);
           }
 
-        XLALDestroyREAL8Vector (sigReHi);
-        XLALDestroyREAL8Vector (sigImHi);
-        XLALDestroyREAL8Vector (omegaHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
 
 #if debugOutput
         printf
@@ -2679,40 +2992,40 @@ for ( UINT4 k = 0; k<nModes; k++) {
 	  (&hNQC, values, omegaHi->data[i], &nqcCoeffs) == XLAL_FAILURE)
 	{
     if(tmpValues){
-      XLALDestroyREAL8Vector (tmpValues);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
     }
     if(sigmaKerr){
-      XLALDestroyREAL8Vector (sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
     }
     if(sigmaStar){
-      XLALDestroyREAL8Vector (sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
     }
     if(values){
-      XLALDestroyREAL8Vector (values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
     }
     if(sigReHi){
-      XLALDestroyREAL8Vector(sigReHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
     }
     if(sigImHi){
-      XLALDestroyREAL8Vector(sigImHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
     }
     if(omegaHi){
-      XLALDestroyREAL8Vector(omegaHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
     }
     if(vPhiVecHi){
-      XLALDestroyREAL8Vector(vPhiVecHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
     }
     if(ampNQC){
-      XLALDestroyREAL8Vector(ampNQC);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
     }
     if(phaseNQC){
-      XLALDestroyREAL8Vector(phaseNQC);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
     }
     if(hamVHi){
-      XLALDestroyREAL8Vector(hamVHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
     }
     if(hLMAllHi){
-      XLALDestroyREAL8Vector(hLMAllHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
     }
 	  XLAL_ERROR (XLAL_EFUNC);
 	}
@@ -2822,44 +3135,44 @@ for ( UINT4 k = 0; k<nModes; k++) {
      printf("YP::timeshiftPeak and combSize: %.16e and %.16e\n",timeshiftPeak,combSize);
      printf("PK::chi and SpinAlignedEOBversion: %.16e and %u\n\n", chi,SpinAlignedEOBversion); */
 
-  REAL8Vector *rdMatchPoint = XLALCreateREAL8Vector (4);
+  REAL8Vector *rdMatchPoint = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_RDMATCHPOINT, 4);
   if (!rdMatchPoint)
     {
       if(tmpValues){
-        XLALDestroyREAL8Vector (tmpValues);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
       }
       if(sigmaKerr){
-        XLALDestroyREAL8Vector (sigmaKerr);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
       }
       if(sigmaStar){
-        XLALDestroyREAL8Vector (sigmaStar);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
       }
       if(values){
-        XLALDestroyREAL8Vector (values);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, values);
       }
       if(sigReHi){
-        XLALDestroyREAL8Vector(sigReHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
       }
       if(sigImHi){
-        XLALDestroyREAL8Vector(sigImHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
       }
       if(omegaHi){
-        XLALDestroyREAL8Vector(omegaHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
       }
       if(vPhiVecHi){
-        XLALDestroyREAL8Vector(vPhiVecHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
       }
       if(ampNQC){
-        XLALDestroyREAL8Vector(ampNQC);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
       }
       if(phaseNQC){
-        XLALDestroyREAL8Vector(phaseNQC);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
       }
       if(hamVHi){
-        XLALDestroyREAL8Vector(hamVHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
       }
       if(hLMAllHi){
-        XLALDestroyREAL8Vector(hLMAllHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
       }
       XLAL_ERROR (XLAL_ENOMEM);
     }
@@ -2926,7 +3239,7 @@ for ( UINT4 k = 0; k<nModes; k++) {
         REAL8 red = ( sigReHi->data[1] - sigReHi->data[0] ) / dt, imd = ( sigImHi->data[1] - sigImHi->data[0] ) / dt;
         REAL8 Onew, Oval = - (imd*re - red*im) / (re*re + im*im);
 
-        OmVec = XLALCreateREAL8Vector (sigReHi->length);
+        OmVec = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_OMVEC, sigReHi->length);
         memset (OmVec->data, 0, OmVec->length * sizeof (REAL8));
 
         for (i = 1; i < (INT4) timeHi.length-1; i++) {
@@ -3000,9 +3313,9 @@ for ( UINT4 k = 0; k<nModes; k++) {
         INT4 kount;
         REAL8 dtGeom = deltaTHigh / mTScaled;
         REAL8Vector *ampl, *phtmp;
-        ampl = XLALCreateREAL8Vector (sigReHi->length);
+        ampl = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_AMPL, sigReHi->length);
         memset (ampl->data, 0, ampl->length * sizeof (REAL8));
-        phtmp = XLALCreateREAL8Vector (sigReHi->length);
+        phtmp = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_PHTMP, sigReHi->length);
         memset (phtmp->data, 0,phtmp->length * sizeof (REAL8));
         INT4 iEnd= (INT4)rdMatchPoint->data[1]/dtGeom;
         UINT4 iM = iEnd - 1000;
@@ -3036,8 +3349,8 @@ for ( UINT4 k = 0; k<nModes; k++) {
             sigReHi->data[kount] = amp0*ampl->data[kount]*cos(phtmp->data[kount]);
             sigImHi->data[kount] = amp0*ampl->data[kount]*sin(phtmp->data[kount]);
         }
-        XLALDestroyREAL8Vector(ampl);
-        XLALDestroyREAL8Vector(phtmp);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, ampl);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, phtmp);
                             /*
         if (XLALSimIMREOBTaper (sigReHi, sigImHi, 2, 2,
                                             deltaTHigh, m1, m2, spin1[0],
@@ -3084,40 +3397,40 @@ for ( UINT4 k = 0; k<nModes; k++) {
                 XLAL_FAILURE)
             {
               if(tmpValues){
-                XLALDestroyREAL8Vector (tmpValues);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
               }
               if(sigmaKerr){
-                XLALDestroyREAL8Vector (sigmaKerr);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
               }
               if(sigmaStar){
-                XLALDestroyREAL8Vector (sigmaStar);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
               }
               if(values){
-                XLALDestroyREAL8Vector (values);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, values);
               }
               if(sigReHi){
-                XLALDestroyREAL8Vector(sigReHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
               }
               if(sigImHi){
-                XLALDestroyREAL8Vector(sigImHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
               }
               if(omegaHi){
-                XLALDestroyREAL8Vector(omegaHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
               }
               if(vPhiVecHi){
-                XLALDestroyREAL8Vector(vPhiVecHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
               }
               if(ampNQC){
-                XLALDestroyREAL8Vector(ampNQC);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
               }
               if(phaseNQC){
-                XLALDestroyREAL8Vector(phaseNQC);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
               }
               if(hamVHi){
-                XLALDestroyREAL8Vector(hamVHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
               }
               if(hLMAllHi){
-                XLALDestroyREAL8Vector(hLMAllHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
               }
               XLAL_ERROR (XLAL_EFUNC);
             }
@@ -3168,7 +3481,8 @@ for ( UINT4 k = 0; k<nModes; k++) {
 	SEOBNRv2OptimizedInterpolatorOnlyAmpPhase (dynamicstmp, 0.,
 						   deltaT / mTScaled,
 						   retLen_fromOptStep2,
-						   &dynamics);
+						   &dynamics,
+						   workspace ? SEOBWorkspaceSplineWork (workspace, 5 * retLen_fromOptStep2) : NULL);
 
       ampVec.length = phaseVec.length = retLen;
       ampVec.data = dynamics->data + 5 * retLen;
@@ -3180,7 +3494,8 @@ for ( UINT4 k = 0; k<nModes; k++) {
 	SEOBNRv2OptimizedInterpolatorOnlyAmpPhase (dynamicsHitmp, 0.,
 						   deltaTHigh / mTScaled,
 						   retLen_fromOptStep3,
-						   &dynamicsHi);
+						   &dynamicsHi,
+						   workspace ? SEOBWorkspaceSplineWork (workspace, 5 * retLen_fromOptStep3) : NULL);
     }
 
 
@@ -3189,27 +3504,27 @@ for ( UINT4 k = 0; k<nModes; k++) {
   /* Now create vectors at the correct sample rate, and compile the complete waveform */
   if(postAdiabaticFlag && postAdiabaticOutcome == XLAL_SUCCESS){
     sigReVec =
-      XLALCreateREAL8Vector (combinedLenForInterp + ceil (sigReHi->length / resampFac));
-    sigImVec = XLALCreateREAL8Vector (sigReVec->length);
+      SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGREVEC, combinedLenForInterp + ceil (sigReHi->length / resampFac));
+    sigImVec = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGIMVEC, sigReVec->length);
   }
   else{
     sigReVec =
-      XLALCreateREAL8Vector (rVec.length + ceil (sigReHi->length / resampFac));
-    sigImVec = XLALCreateREAL8Vector (sigReVec->length);
+      SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGREVEC, rVec.length + ceil (sigReHi->length / resampFac));
+    sigImVec = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGIMVEC, sigReVec->length);
   }
   memset (sigReVec->data, 0, sigReVec->length * sizeof (REAL8));
   memset (sigImVec->data, 0, sigImVec->length * sizeof (REAL8));
 
   REAL8Vector *sigReCoorbVec =
-    XLALCreateREAL8Vector (combinedLenForInterp + ceil (sigReHi->length / resampFac));
-  REAL8Vector *sigImCoorbVec = XLALCreateREAL8Vector (sigReCoorbVec ->length);
+    SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGRECOORBVEC, combinedLenForInterp + ceil (sigReHi->length / resampFac));
+  REAL8Vector *sigImCoorbVec = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_SIGIMCOORBVEC, sigReCoorbVec ->length);
 
   memset (sigReCoorbVec->data, 0, sigReCoorbVec->length * sizeof (REAL8));
   memset (sigImCoorbVec->data, 0, sigImCoorbVec->length * sizeof (REAL8));
   // PA: the spacing is not regular on the dynamics grid, so must be careful
   // to set the correct length with the desired spacing
   
-  hLMAll = XLALCreateREAL8Vector((UINT4)2*sigReVec->length*nModes);
+  hLMAll = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_HLMALL, (UINT4)2*sigReVec->length*nModes);
   memset(hLMAll->data, 0, hLMAll->length*sizeof (REAL8));
 
    UINT4 idx = 0;
@@ -3232,64 +3547,64 @@ for ( UINT4 k = 0; k<nModes; k++) {
 #if debugOutput
         out = fopen ("saDynamics.dat", "w");
 #endif
-        hamV = XLALCreateREAL8Vector(rVec.length);
+        hamV = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_HAMV, rVec.length);
         memset(hamV->data, 0., hamV->length*sizeof(REAL8));
 
-        omegaVec = XLALCreateREAL8Vector(rVec.length);
+        omegaVec = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_OMEGAVEC, rVec.length);
         memset(omegaVec->data, 0., omegaVec->length*sizeof(REAL8));
 
-	      vPhiVec = XLALCreateREAL8Vector(rVec.length);
+	      vPhiVec = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_VPHIVEC, rVec.length);
         memset(vPhiVec->data, 0., vPhiVec->length*sizeof(REAL8));
 
         if (!omegaVec|| !hamV)
         {
           if(tmpValues){
-            XLALDestroyREAL8Vector (tmpValues);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
           }
           if(sigmaKerr){
-            XLALDestroyREAL8Vector (sigmaKerr);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
           }
           if(sigmaStar){
-            XLALDestroyREAL8Vector (sigmaStar);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
           }
           if(values){
-            XLALDestroyREAL8Vector (values);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, values);
           }
           if(sigReHi){
-            XLALDestroyREAL8Vector(sigReHi);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
           }
           if(sigImHi){
-            XLALDestroyREAL8Vector(sigImHi);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
           }
           if(omegaHi){
-            XLALDestroyREAL8Vector(omegaHi);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
           }
           if(vPhiVecHi){
-            XLALDestroyREAL8Vector(vPhiVecHi);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
           }
           if(ampNQC){
-            XLALDestroyREAL8Vector(ampNQC);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
           }
           if(phaseNQC){
-            XLALDestroyREAL8Vector(phaseNQC);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
           }
           if(hamVHi){
-            XLALDestroyREAL8Vector(hamVHi);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
           }
           if(hLMAllHi){
-            XLALDestroyREAL8Vector(hLMAllHi);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
           }
           if(sigReVec){
-            XLALDestroyREAL8Vector(sigReVec);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, sigReVec);
           }
           if(sigImVec){
-            XLALDestroyREAL8Vector(sigImVec);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, sigImVec);
           }
           if(hLMAll){
-            XLALDestroyREAL8Vector(hLMAll);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAll);
           }
           if(vPhiVec)
-            XLALDestroyREAL8Vector(vPhiVec);
+            SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVec);
           
           XLAL_ERROR (XLAL_ENOMEM);
         }
@@ -3337,15 +3652,23 @@ for ( UINT4 k = 0; k<nModes; k++) {
   }
 
     
-    // Interpolants for Re/Im parts of coorb modes
-    UNUSED gsl_interp_accel *acc_re = gsl_interp_accel_alloc();
-	  gsl_spline *spline_re = gsl_spline_alloc(gsl_interp_cspline, rVec.length);
-    UNUSED gsl_interp_accel *acc_im = gsl_interp_accel_alloc();
-	  gsl_spline *spline_im = gsl_spline_alloc(gsl_interp_cspline, rVec.length);
-    // Interpolant for orbital phase
-    UNUSED gsl_interp_accel *acc_orbphase = gsl_interp_accel_alloc();
-	  gsl_spline *spline_orbphase = gsl_spline_alloc(gsl_interp_cspline, rVec.length);
-    gsl_spline_init(spline_orbphase, tVec.data, phiVec.data, rVec.length);
+    // Interpolants for Re/Im parts of coorb modes and for the orbital phase;
+    // the spline coefficients are kept in (workspace) buffers of 3 x rVec.length,
+    // followed by the scratch space of optimized_cspline_init()
+    REAL8 *coorbSplineWork = SEOBWorkspaceSplineWork (workspace, 7 * rVec.length);
+    if (!coorbSplineWork)
+      XLAL_ERROR (XLAL_EFUNC);
+    cspline_state_t spline_re = { coorbSplineWork, NULL, NULL, NULL };
+    cspline_state_t spline_im = { coorbSplineWork + rVec.length, NULL, NULL, NULL };
+    cspline_state_t spline_orbphase = { coorbSplineWork + 2 * rVec.length, NULL, NULL, NULL };
+    gsl_interp_accel acc_re = { 0, 0, 0 };
+    gsl_interp_accel acc_im = { 0, 0, 0 };
+    gsl_interp_accel acc_orbphase = { 0, 0, 0 };
+    if (optimized_cspline_init (spline_orbphase.c, coorbSplineWork + 3 * rVec.length, tVec.data, phiVec.data, rVec.length) != XLAL_SUCCESS)
+      {
+        SEOBWorkspaceReleaseSplineWork (workspace, coorbSplineWork);
+        XLAL_ERROR (XLAL_EFUNC);
+      }
 
 
     for ( UINT4 k = 0; k<nModes; k++) {
@@ -3393,53 +3716,54 @@ for ( UINT4 k = 0; k<nModes; k++) {
         if ( status == XLAL_FAILURE)
             {
               if(tmpValues){
-                XLALDestroyREAL8Vector (tmpValues);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
               }
               if(sigmaKerr){
-                XLALDestroyREAL8Vector (sigmaKerr);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
               }
               if(sigmaStar){
-                XLALDestroyREAL8Vector (sigmaStar);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
               }
               if(values){
-                XLALDestroyREAL8Vector (values);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, values);
               }
               if(sigReHi){
-                XLALDestroyREAL8Vector(sigReHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
               }
               if(sigImHi){
-                XLALDestroyREAL8Vector(sigImHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
               }
               if(omegaHi){
-                XLALDestroyREAL8Vector(omegaHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
               }
               if(vPhiVecHi){
-                XLALDestroyREAL8Vector(vPhiVecHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
               }
               if(ampNQC){
-                XLALDestroyREAL8Vector(ampNQC);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
               }
               if(phaseNQC){
-                XLALDestroyREAL8Vector(phaseNQC);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
               }
               if(hamVHi){
-                XLALDestroyREAL8Vector(hamVHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
               }
               if(hLMAllHi){
-                XLALDestroyREAL8Vector(hLMAllHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
               }
               if(sigReVec){
-                XLALDestroyREAL8Vector(sigReVec);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigReVec);
               }
               if(sigImVec){
-                XLALDestroyREAL8Vector(sigImVec);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigImVec);
               }
               if(hLMAll){
-                XLALDestroyREAL8Vector(hLMAll);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAll);
               }
               if(vPhiVec)
-                XLALDestroyREAL8Vector(vPhiVec);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVec);
               
+              SEOBWorkspaceReleaseSplineWork (workspace, coorbSplineWork);
               XLAL_ERROR (XLAL_EFUNC);
             }
             hT = 0.;
@@ -3448,6 +3772,7 @@ for ( UINT4 k = 0; k<nModes; k++) {
                 (&hT, values, cbrt (omegaVec->data[i]), 2, 2, &seobParams)
                 == XLAL_FAILURE)
                 {
+                    SEOBWorkspaceReleaseSplineWork (workspace, coorbSplineWork);
                     XLAL_ERROR (XLAL_EFUNC);
                 }
             }
@@ -3456,50 +3781,51 @@ for ( UINT4 k = 0; k<nModes; k++) {
                 == XLAL_FAILURE)
             {
               if(tmpValues){
-                XLALDestroyREAL8Vector (tmpValues);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
               }
               if(sigmaKerr){
-                XLALDestroyREAL8Vector (sigmaKerr);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
               }
               if(sigmaStar){
-                XLALDestroyREAL8Vector (sigmaStar);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
               }
               if(values){
-                XLALDestroyREAL8Vector (values);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, values);
               }
               if(sigReHi){
-                XLALDestroyREAL8Vector(sigReHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
               }
               if(sigImHi){
-                XLALDestroyREAL8Vector(sigImHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
               }
               if(omegaHi){
-                XLALDestroyREAL8Vector(omegaHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
               }
               if(vPhiVecHi){
-                XLALDestroyREAL8Vector(vPhiVecHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
               }
               if(ampNQC){
-                XLALDestroyREAL8Vector(ampNQC);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
               }
               if(phaseNQC){
-                XLALDestroyREAL8Vector(phaseNQC);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
               }
               if(hamVHi){
-                XLALDestroyREAL8Vector(hamVHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
               }
               if(hLMAllHi){
-                XLALDestroyREAL8Vector(hLMAllHi);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
               }
               if(sigReVec){
-                XLALDestroyREAL8Vector(sigReVec);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigReVec);
               }
               if(sigImVec){
-                XLALDestroyREAL8Vector(sigImVec);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, sigImVec);
               }
               if(hLMAll){
-                XLALDestroyREAL8Vector(hLMAll);
+                SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAll);
               }
+              SEOBWorkspaceReleaseSplineWork (workspace, coorbSplineWork);
               XLAL_ERROR (XLAL_EFUNC);
             }
 
@@ -3539,10 +3865,12 @@ for ( UINT4 k = 0; k<nModes; k++) {
 	if(postAdiabaticFlag && postAdiabaticOutcome == XLAL_SUCCESS){
 	  
     
-	  gsl_spline_init(spline_re, tVec.data, sigReCoorbVec->data, rVec.length);
-	  
-	 
-	  gsl_spline_init(spline_im, tVec.data, sigImCoorbVec->data, rVec.length);
+	  if (optimized_cspline_init (spline_re.c, coorbSplineWork + 3 * rVec.length, tVec.data, sigReCoorbVec->data, rVec.length) != XLAL_SUCCESS
+	      || optimized_cspline_init (spline_im.c, coorbSplineWork + 3 * rVec.length, tVec.data, sigImCoorbVec->data, rVec.length) != XLAL_SUCCESS)
+	    {
+	      SEOBWorkspaceReleaseSplineWork (workspace, coorbSplineWork);
+	      XLAL_ERROR (XLAL_EFUNC);
+	    }
 
  
 
@@ -3570,14 +3898,14 @@ for ( UINT4 k = 0; k<nModes; k++) {
       //im_temp = gsl_spline_eval(spline_im, t_i, acc_im);
       //phase_temp = gsl_spline_eval(spline_orbphase, t_i, acc_orbphase);
 
-      optimized_gsl_spline_eval_e (spline_re, t_i, acc_re, &re_temp,
+      optimized_cspline_eval (&spline_re, tVec.data, sigReCoorbVec->data, rVec.length, t_i, &acc_re, &re_temp,
                                        &index_old, &x_lo_old, &y_lo_old,
                                        &b_i_old, &c_i_old, &d_i_old);
-      optimized_gsl_spline_eval_e (spline_im, t_i, acc_im, &im_temp,
+      optimized_cspline_eval (&spline_im, tVec.data, sigImCoorbVec->data, rVec.length, t_i, &acc_im, &im_temp,
                                        &index_old2, &x_lo_old2, &y_lo_old2,
                                        &b_i_old2, &c_i_old2, &d_i_old2);
 
-      optimized_gsl_spline_eval_e (spline_orbphase, t_i, acc_orbphase, &phase_temp,
+      optimized_cspline_eval (&spline_orbphase, tVec.data, phiVec.data, rVec.length, t_i, &acc_orbphase, &phase_temp,
                                        &index_old3, &x_lo_old3, &y_lo_old3,
                                        &b_i_old3, &c_i_old3, &d_i_old3);
       cm = cos(modeM * phase_temp);
@@ -3602,18 +3930,13 @@ for ( UINT4 k = 0; k<nModes; k++) {
         fclose(out2);
 #endif
   }
-  gsl_spline_free( spline_orbphase);
-  gsl_interp_accel_free( acc_orbphase );
-  gsl_spline_free( spline_re);
-  gsl_interp_accel_free( acc_re );
-  gsl_spline_free( spline_im);
-  gsl_interp_accel_free( acc_im );
+  SEOBWorkspaceReleaseSplineWork (workspace, coorbSplineWork);
 }
  
     if ( OmVec )
-        XLALDestroyREAL8Vector(OmVec);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, OmVec);
     if ( omegaVec )
-         XLALDestroyREAL8Vector(omegaVec);
+         SEOBWorkspaceDestroyREAL8Vector (workspace, omegaVec);
 
     
     
@@ -3653,7 +3976,7 @@ for ( UINT4 k = 0; k<nModes; k++) {
           sigReVec->data[i] = hLMAll->data[i];
           sigImVec->data[i] = hLMAll->data[sigReVec->length + i];
         }
-        REAL8Vector *tmpRe = XLALCreateREAL8Vector(sigReVec->length), *tmpIm = XLALCreateREAL8Vector(sigReVec->length);
+        REAL8Vector *tmpRe = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_TMPRE, sigReVec->length), *tmpIm = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_TMPIM, sigReVec->length);
         for ( i=0; i < (INT4) sigReVec->length; i++) {
             tmpRe->data[i] = sigReVec->data[i] / amp0;
             tmpIm->data[i] = sigImVec->data[i] / amp0;
@@ -3664,7 +3987,7 @@ for ( UINT4 k = 0; k<nModes; k++) {
         accIm = gsl_interp_accel_alloc ();
         REAL8 dRe, dIm;
         REAL8Vector *timeList;
-        timeList = XLALCreateREAL8Vector (sigReVec->length);
+        timeList = SEOBWorkspaceCreateREAL8Vector (workspace, SEOB_WS_TIMELIST, sigReVec->length);
         for ( i=0; i < (INT4) sigReVec->length; i++) {
             timeList->data[i] = i*deltaT/mTScaled;
         }
@@ -3693,9 +4016,9 @@ for ( UINT4 k = 0; k<nModes; k++) {
         gsl_interp_accel_free( accRe );
         gsl_spline_free( splineIm );
         gsl_interp_accel_free( accIm );
-        XLALDestroyREAL8Vector( tmpRe );
-        XLALDestroyREAL8Vector( tmpIm );
-        XLALDestroyREAL8Vector(timeList);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, tmpRe );
+        SEOBWorkspaceDestroyREAL8Vector (workspace, tmpIm );
+        SEOBWorkspaceDestroyREAL8Vector (workspace, timeList);
     }
 
 #if debugOutput
@@ -3741,18 +4064,18 @@ for ( UINT4 k = 0; k<nModes; k++) {
       (*hlmmode) = hlms;
 
       /* Free memory */
-      XLALDestroyREAL8Vector (tmpValues);
-      XLALDestroyREAL8Vector (sigmaKerr);
-      XLALDestroyREAL8Vector (sigmaStar);
-      XLALDestroyREAL8Vector (values);
-      XLALDestroyREAL8Vector (rdMatchPoint);
-      XLALDestroyREAL8Vector (ampNQC);
-      XLALDestroyREAL8Vector (phaseNQC);
-      XLALDestroyREAL8Vector (sigReVec);
-      XLALDestroyREAL8Vector (sigImVec);
-      XLALDestroyREAL8Vector (sigReCoorbVec);
-      XLALDestroyREAL8Vector (sigImCoorbVec);
-      XLALAdaptiveRungeKuttaFree (integrator);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, tmpValues);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaKerr);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigmaStar);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, values);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, rdMatchPoint);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, ampNQC);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, phaseNQC);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigReVec);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigImVec);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigReCoorbVec);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigImCoorbVec);
+      SEOBWorkspaceIntegratorFree (workspace, integrator);
       //SM
       //XLALDestroyREAL8Array (dynamics);
       //XLALDestroyREAL8Array (dynamicsHi);
@@ -3768,38 +4091,38 @@ for ( UINT4 k = 0; k<nModes; k++) {
           XLALDestroyREAL8Array (dynamicsHitmp);	// DAVIDS: Done with these now
         }
 
-      XLALDestroyREAL8Vector (sigReHi);
-      XLALDestroyREAL8Vector (sigImHi);
-      XLALDestroyREAL8Vector (omegaHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigReHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, sigImHi);
+      SEOBWorkspaceDestroyREAL8Vector (workspace, omegaHi);
       if ( hLMAllHi )
-          XLALDestroyREAL8Vector (hLMAllHi);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAllHi);
       if ( hLMAll )
-          XLALDestroyREAL8Vector (hLMAll);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, hLMAll);
       if ( hamV )
-          XLALDestroyREAL8Vector (hamV);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, hamV);
       if ( hamVHi )
-          XLALDestroyREAL8Vector (hamVHi);
+          SEOBWorkspaceDestroyREAL8Vector (workspace, hamVHi);
 
       if (vPhiVec)
-        XLALDestroyREAL8Vector (vPhiVec);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVec);
 
       if (vPhiVecHi)
-        XLALDestroyREAL8Vector (vPhiVecHi);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, vPhiVecHi);
 
       if (tVecInterp)
-        XLALDestroyREAL8Vector(tVecInterp);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, tVecInterp);
 
       if (phiVecInterp)
-        XLALDestroyREAL8Vector(phiVecInterp);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, phiVecInterp);
 
       if (rVecInterp)
-        XLALDestroyREAL8Vector(rVecInterp);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, rVecInterp);
 
       if (prVecInterp)
-        XLALDestroyREAL8Vector(prVecInterp);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, prVecInterp);
 
       if (pphiVecInterp)
-        XLALDestroyREAL8Vector(pphiVecInterp);
+        SEOBWorkspaceDestroyREAL8Vector (workspace, pphiVecInterp);
 
       //SM
       // Copy dynamics to output in the form of a REAL8Vector (required for SWIG wrapping, REAL8Array does not work)
@@ -3874,6 +4197,77 @@ XLALSimIMRSpinAlignedEOBWaveformAll (
     /**<< Structure containing the modes to use in the waveform */
     LALDict *TGRParams
     /**<< dictionary containing parameters for tests of General Relativity */
+)
+{
+  return XLALSimIMRSpinAlignedEOBWaveformAllWithWorkspace (hplus, hcross,
+      phiC, deltaT, m1SI, m2SI, fMin, r, inc, spin1z, spin2z,
+      SpinAlignedEOBversion, lambda2Tidal1, lambda2Tidal2, omega02Tidal1,
+      omega02Tidal2, lambda3Tidal1, lambda3Tidal2, omega03Tidal1,
+      omega03Tidal2, quadparam1, quadparam2, nqcCoeffsInput, nqcFlag,
+      ModeArray, TGRParams, NULL);
+}
+
+/**
+ * As XLALSimIMRSpinAlignedEOBWaveformAll(), but taking the buffers needed
+ * during the generation from workspace, see
+ * XLALSimIMRSpinAlignedEOBWorkspaceCreate().
+ */
+int
+XLALSimIMRSpinAlignedEOBWaveformAllWithWorkspace (
+    REAL8TimeSeries ** hplus,
+    /**<< OUTPUT, real part of the modes */
+    REAL8TimeSeries ** hcross,
+    /**<< OUTPUT, complex part of the modes */
+    const REAL8 phiC,
+    /**<< coalescence orbital phase (rad) */
+    REAL8 deltaT,
+    /**<< sampling time step */
+    const REAL8 m1SI,
+    /**<< mass-1 in SI unit */
+    const REAL8 m2SI,
+    /**<< mass-2 in SI unit */
+    const REAL8 fMin,
+    /**<< starting frequency of the 22 mode (Hz) */
+    const REAL8 r,
+    /**<< distance in SI unit */
+    const REAL8 inc,
+    /**<< inclination angle */
+    const REAL8 spin1z,
+    /**<< z-component of spin-1, dimensionless */
+    const REAL8 spin2z,
+    /**<< z-component of spin-2, dimensionless */
+    UINT4 SpinAlignedEOBversion,
+    /**<< 1 for SEOBNRv1, 2 for SEOBNRv2, 4 for SEOBNRv4, 201 for SEOBNRv2T, 401 for SEOBNRv4T, 41 for SEOBNRv4HM */
+    const REAL8 lambda2Tidal1,
+    /**<< dimensionless adiabatic quadrupole tidal deformability for body 1 (2/3 k2/C^5) */
+    const REAL8 lambda2Tidal2,
+    /**<< dimensionless adiabatic quadrupole tidal deformability for body 2 (2/3 k2/C^5) */
+    const REAL8 omega02Tidal1,
+    /**<< quadrupole f-mode angular freq for body 1 m_1*omega_{02,1}*/
+    const REAL8 omega02Tidal2,
+    /**<< quadrupole f-mode angular freq for body 2 m_2*omega_{02,2}*/
+    const REAL8 lambda3Tidal1,
+    /**<< dimensionless adiabatic octupole tidal deformability for body 1 (2/15 k3/C^7) */
+    const REAL8 lambda3Tidal2,
+    /**<< dimensionless adiabatic octupole tidal deformability for body 2 (2/15 k3/C^7) */
+    const REAL8 omega03Tidal1,
+    /**<< octupole f-mode angular freq for body 1 m_1*omega_{03,1}*/
+    const REAL8 omega03Tidal2,
+    /**<< octupole f-mode angular freq for body 2 m_2*omega_{03,2}*/
+    const REAL8 quadparam1,
+    /**<< parameter kappa_1 of the spin-induced quadrupole for body 1, quadrupole is Q_A = -kappa_A m_A^3 chi_A^2 */
+    const REAL8 quadparam2,
+    /**<< parameter kappa_2 of the spin-induced quadrupole for body 2, quadrupole is Q_A = -kappa_A m_A^3 chi_A^2 */
+    REAL8Vector *nqcCoeffsInput,
+    /**<< Input NQC coeffs */
+    const INT4 nqcFlag,
+    /**<< Flag to tell the code to use the NQC coeffs input thorugh nqcCoeffsInput */
+    LALValue *ModeArray,
+    /**<< Structure containing the modes to use in the waveform */
+    LALDict *TGRParams,
+    /**<< dictionary containing parameters for tests of General Relativity */
+    LALSimIMRSpinAlignedEOBWorkspace *workspace
+    /**<< workspace to reuse buffers from, or NULL */
 )
   {
 
@@ -3889,7 +4283,7 @@ XLALSimIMRSpinAlignedEOBWaveformAll (
 
     //RC: XLALSimIMRSpinAlignedEOBModes computes the modes and put them into hlm
 
-    if(XLALSimIMRSpinAlignedEOBModes (
+    if(XLALSimIMRSpinAlignedEOBModesWithWorkspace (
         &hlms, //SM
         &dynamics, &dynamicsHi, //SM
         deltaT,
@@ -3905,7 +4299,8 @@ XLALSimIMRSpinAlignedEOBWaveformAll (
         quadparam1, quadparam2,
         nqcCoeffsInput, nqcFlag,
         PAParams,
-        TGRParams) == XLAL_FAILURE
+        TGRParams,
+        workspace) == XLAL_FAILURE
     ){
         if(dynamics) XLALDestroyREAL8Vector(dynamics);
         if(dynamicsHi) XLALDestroyREAL8Vector(dynamicsHi);
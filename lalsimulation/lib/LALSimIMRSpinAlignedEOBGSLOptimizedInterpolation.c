@@ -38,7 +38,9 @@
  * contain data *not* evenly spaced in time
  * and performs cubic spline interpolations to resample
  * the data to uniform time sampling. Interpolations use
- * GSL's built-in routines, which recompute interpolation
+ * GSL's natural cubic spline (with the coefficients
+ * computed by optimized_cspline_init()), since GSL's
+ * own evaluator recomputes interpolation
  * coefficients each time the itnerpolator is called.
  * This can be extremely inefficient; in case of SEOBNRv4,
  * first data points exist at very large dt, and
@@ -51,31 +53,37 @@
  * num_input_times denotes the number of points yin arrays
  *   are sampled in time.
  * yout is the output array.
+ * splineWork, if not NULL, is scratch space of at least
+ *   5 * num_input_times elements for the spline coefficients,
+ *   so that repeated calls do not allocate; if NULL it is
+ *   allocated and freed here.
  */
 UNUSED static int
 SEOBNRv2OptimizedInterpolatorNoAmpPhase (REAL8Array * yin, REAL8 tinit,
 					 REAL8 deltat, UINT4 num_input_times,
-					 REAL8Array ** yout)
+					 REAL8Array ** yout, REAL8 * splineWork)
 {
   int errnum = 0;
 
   /* needed for the final interpolation */
-  gsl_spline *interp = NULL;
-  gsl_interp_accel *accel = NULL;
+  REAL8 *work = splineWork;
+  cspline_state_t state;
+  gsl_interp_accel accel;
   int outputlen = 0;
   REAL8Array *output = NULL;
   REAL8 *times, *vector;	/* aliases */
 
   /* needed for the integration */
   size_t dim = 4;
-  
-  interp = gsl_spline_alloc (gsl_interp_cspline, num_input_times);
-  accel = gsl_interp_accel_alloc ();
+
+  if (!work)
+    work = XLALMalloc (5 * num_input_times * sizeof (REAL8));
+  state.c = work;
 
   outputlen = (int) (yin->data[num_input_times - 1] / deltat) + 1;
   output = XLALCreateREAL8ArrayL (2, dim + 1, outputlen);	/* Only dim + 1 rather than dim + 3 since we're not adding amp & phase */
 
-  if (!interp || !accel || !output)
+  if (!work || !output)
     {
       errnum = XLAL_ENOMEM;	/* ouch again, ran out of memory */
       if (output)
@@ -92,9 +100,18 @@ SEOBNRv2OptimizedInterpolatorNoAmpPhase (REAL8Array * yin, REAL8 tinit,
   /* interpolate! */
   for (unsigned int i = 1; i <= dim; i++)
     {				/* only up to dim (4) because we are not interpolating amplitude and phase */
-      //gsl_spline_init(interp, &yin->data[0], &yin->data[num_input_times * i], num_input_times + 1);
-      gsl_spline_init (interp, &yin->data[0], &yin->data[num_input_times * i],
-		       num_input_times);
+      if (optimized_cspline_init (state.c, work + num_input_times, &yin->data[0],
+				  &yin->data[num_input_times * i],
+				  num_input_times) != XLAL_SUCCESS)
+	{
+	  errnum = XLAL_EFUNC;
+	  XLALDestroyREAL8Array (output);
+	  outputlen = 0;
+	  goto bail_out;
+	}
+      accel.cache = 0;
+      accel.hit_count = 0;
+      accel.miss_count = 0;
 
       vector = output->data + outputlen * i;
       unsigned int index_old = 0;
@@ -102,19 +119,19 @@ SEOBNRv2OptimizedInterpolatorNoAmpPhase (REAL8Array * yin, REAL8 tinit,
 	0;
       for (int j = 0; j < outputlen; j++)
 	{
-	  optimized_gsl_spline_eval_e (interp, times[j], accel, &(vector[j]),
-				       &index_old, &x_lo_old, &y_lo_old,
-				       &b_i_old, &c_i_old, &d_i_old);
+	  optimized_cspline_eval (&state, &yin->data[0],
+				  &yin->data[num_input_times * i],
+				  num_input_times, times[j], &accel,
+				  &(vector[j]), &index_old, &x_lo_old,
+				  &y_lo_old, &b_i_old, &c_i_old, &d_i_old);
 	}
     }
 
   /* deallocate stuff and return */
 bail_out:
 
-  if (interp)
-    XLAL_CALLGSL (gsl_spline_free (interp));
-  if (accel)
-    XLAL_CALLGSL (gsl_interp_accel_free (accel));
+  if (work != splineWork)
+    XLALFree (work);
 
   if (errnum)
     XLAL_ERROR (errnum);
@@ -134,7 +151,7 @@ UNUSED static int
 SEOBNRv2OptimizedInterpolatorOnlyAmpPhase (REAL8Array * yin, REAL8 tinit,
 					   REAL8 deltat,
 					   UINT4 num_input_times,
-					   REAL8Array ** yout)
+					   REAL8Array ** yout, REAL8 * splineWork)
 {
   int errnum = 0;
 
@@ -142,21 +159,21 @@ SEOBNRv2OptimizedInterpolatorOnlyAmpPhase (REAL8Array * yin, REAL8 tinit,
   size_t dim = 4;
 
   /* needed for the final interpolation */
-  gsl_spline *interp = NULL;
-  gsl_interp_accel *accel = NULL;
+  REAL8 *work = splineWork;
+  cspline_state_t state;
+  gsl_interp_accel accel;
   int outputlen = 0;
   REAL8Array *output = NULL;
   REAL8 *times, *vector;	/* aliases */
 
-  /* note: for speed, this replaces the single CALLGSL wrapper applied before each GSL call */
-  interp = gsl_spline_alloc (gsl_interp_cspline, num_input_times);
-  accel = gsl_interp_accel_alloc ();
-
+  if (!work)
+    work = XLALMalloc (5 * num_input_times * sizeof (REAL8));
+  state.c = work;
 
   outputlen = (int) (yin->data[num_input_times - 1] / deltat) + 1;
   output = XLALCreateREAL8ArrayL (2, dim + 3, outputlen);	/* Original (dim+1), Optimized (dim+3), since we're adding amp & phase */
 
-  if (!interp || !accel || !output)
+  if (!work || !output)
     {
       errnum = XLAL_ENOMEM;	/* ouch again, ran out of memory */
       if (output)
@@ -173,27 +190,36 @@ SEOBNRv2OptimizedInterpolatorOnlyAmpPhase (REAL8Array * yin, REAL8 tinit,
   /* interpolate! */
   for (unsigned int i = dim + 1; i <= dim + 2; i++)
     {				/* Original (dim), Optimized (dim+2), since we're also interpolating amp & phase */
-      //gsl_spline_init(interp, &yin->data[0], &yin->data[num_input_times * i], num_input_times + 1);
-      gsl_spline_init (interp, &yin->data[0], &yin->data[num_input_times * i],
-		       num_input_times);
+      if (optimized_cspline_init (state.c, work + num_input_times, &yin->data[0],
+				  &yin->data[num_input_times * i],
+				  num_input_times) != XLAL_SUCCESS)
+	{
+	  errnum = XLAL_EFUNC;
+	  XLALDestroyREAL8Array (output);
+	  outputlen = 0;
+	  goto bail_out;
+	}
+      accel.cache = 0;
+      accel.hit_count = 0;
+      accel.miss_count = 0;
       vector = output->data + outputlen * i;
       unsigned int index_old = 0;
       double x_lo_old = 0, y_lo_old = 0, b_i_old = 0, c_i_old = 0, d_i_old =
 	0;
       for (int j = 0; j < outputlen; j++)
 	{
-	  optimized_gsl_spline_eval_e (interp, times[j], accel, &(vector[j]),
-				       &index_old, &x_lo_old, &y_lo_old,
-				       &b_i_old, &c_i_old, &d_i_old);
+	  optimized_cspline_eval (&state, &yin->data[0],
+				  &yin->data[num_input_times * i],
+				  num_input_times, times[j], &accel,
+				  &(vector[j]), &index_old, &x_lo_old,
+				  &y_lo_old, &b_i_old, &c_i_old, &d_i_old);
 	}
     }
   /* deallocate stuff and return */
 bail_out:
 
-  if (interp)
-    XLAL_CALLGSL (gsl_spline_free (interp));
-  if (accel)
-    XLAL_CALLGSL (gsl_interp_accel_free (accel));
+  if (work != splineWork)
+    XLALFree (work);
 
   if (errnum)
     XLAL_ERROR (errnum);
@@ -78,6 +78,77 @@ static inline size_t optimized_gsl_interp_accel_find(gsl_interp_accel * a, const
   return a->cache;
 }
 
+/**
+ * Compute the coefficients of a natural cubic spline through (x_array,
+ * y_array) exactly as gsl_spline_init() does for gsl_interp_cspline, but
+ * into caller-provided buffers: c must hold size elements and work
+ * 4 * size elements. Unlike gsl_spline_alloc() and gsl_spline_init(), which
+ * allocate the spline state and the tridiagonal solver scratch space on
+ * every call, this allows the buffers to be reused across interpolations.
+ * The coefficients can be evaluated with optimized_cspline_eval() through a
+ * cspline_state_t pointing to c.
+ */
+UNUSED static int optimized_cspline_init(double *c, double *work, const double x_array[], const double y_array[], size_t size)
+{
+  const size_t max_index = size - 1;
+  const size_t sys_size = max_index - 1;
+  double *g = work;
+  double *diag = work + size;
+  double *offdiag = work + 2 * size;
+  double *gamma = work + 3 * size;
+  size_t i;
+
+  if (size < 3)
+    XLAL_ERROR(XLAL_EINVAL, "natural cubic spline needs at least 3 points");
+
+  c[0] = 0.0;
+  c[max_index] = 0.0;
+
+  for (i = 0; i < sys_size; i++) {
+    const double h_i = x_array[i + 1] - x_array[i];
+    const double h_ip1 = x_array[i + 2] - x_array[i + 1];
+    const double ydiff_i = y_array[i + 1] - y_array[i];
+    const double ydiff_ip1 = y_array[i + 2] - y_array[i + 1];
+    const double g_i = (h_i != 0.0) ? 1.0 / h_i : 0.0;
+    const double g_ip1 = (h_ip1 != 0.0) ? 1.0 / h_ip1 : 0.0;
+    offdiag[i] = h_ip1;
+    diag[i] = 2.0 * (h_ip1 + h_i);
+    g[i] = 3.0 * (ydiff_ip1 * g_ip1 - ydiff_i * g_i);
+  }
+
+  if (diag[0] == 0.0)
+    XLAL_ERROR(XLAL_EDOM, "natural cubic spline: zero pivot, repeated abscissae?");
+
+  if (sys_size == 1) {
+    c[1] = g[0] / diag[0];
+    return XLAL_SUCCESS;
+  }
+
+  /* Symmetric tridiagonal solve (L D L^T), as gsl_linalg_solve_symm_tridiag;
+   * diag is overwritten with D and g with the solution before scaling; like
+   * GSL, fail on a zero pivot rather than divide by it */
+  double *x = c + 1;
+  gamma[0] = offdiag[0] / diag[0];
+  for (i = 1; i < sys_size - 1; i++) {
+    diag[i] = diag[i] - offdiag[i - 1] * gamma[i - 1];
+    if (diag[i] == 0.0)
+      XLAL_ERROR(XLAL_EDOM, "natural cubic spline: zero pivot at row %zu", i);
+    gamma[i] = offdiag[i] / diag[i];
+  }
+  diag[sys_size - 1] = diag[sys_size - 1] - offdiag[sys_size - 2] * gamma[sys_size - 2];
+  if (diag[sys_size - 1] == 0.0)
+    XLAL_ERROR(XLAL_EDOM, "natural cubic spline: zero pivot at row %zu", sys_size - 1);
+  for (i = 1; i < sys_size; i++)
+    g[i] = g[i] - gamma[i - 1] * g[i - 1];
+  for (i = 0; i < sys_size; i++)
+    g[i] = g[i] / diag[i];
+  x[sys_size - 1] = g[sys_size - 1];
+  for (i = sys_size - 1; i-- > 0;)
+    x[i] = g[i] - gamma[i] * x[i + 1];
+
+  return XLAL_SUCCESS;
+}
+
 /**
  * Return the coefficients of cubic spline interpolation between points
  * c_array[index] and c_array[index+1].
@@ -134,7 +205,7 @@ static int optimized_cspline_eval (const void * vstate, const double x_array[],
  * Perform cubic spline interpolation to achieve evenly-sampled data from that
  * input data.
  */
-static int optimized_gsl_spline_eval_e(const gsl_spline * spline, double interptime, gsl_interp_accel * accel, double * output,unsigned int *index_old, double *x_lo_old,double *y_lo_old,double *b_i_old,double *c_i_old,double *d_i_old){
+UNUSED static int optimized_gsl_spline_eval_e(const gsl_spline * spline, double interptime, gsl_interp_accel * accel, double * output,unsigned int *index_old, double *x_lo_old,double *y_lo_old,double *b_i_old,double *c_i_old,double *d_i_old){
   return optimized_cspline_eval(spline->interp->state, spline->x, spline->y, spline->interp->size, interptime, accel, output,index_old,x_lo_old,y_lo_old,b_i_old,c_i_old,d_i_old);
 }
 
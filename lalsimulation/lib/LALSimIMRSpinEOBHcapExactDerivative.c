@@ -204,12 +204,14 @@ UNUSED static REAL8 XLALSpinHcapExactDerivWRTParam(
   SpinEOBHCoeffs *coeffs = funcParams->seobCoeffs;
   REAL8Vector *s1Vec = funcParams->s1Vec;
   REAL8Vector *s2Vec = funcParams->s2Vec;
-  REAL8Vector *x=NULL;
-  REAL8Vector *p=NULL;
-  /* Note that this function is called a limited number of times in the initial condition setup,
-   * so no worries about the below memory allocations slowing the code... at this point. */
-  x=XLALCreateREAL8Vector(3);
-  p=XLALCreateREAL8Vector(3);
+  /* Position and momentum are wrapped in stack vectors rather than allocated,
+   * since this is called repeatedly by the initial condition root finder for
+   * every waveform */
+  REAL8 xData[3], pData[3];
+  REAL8Vector xVec = {3, xData};
+  REAL8Vector pVec = {3, pData};
+  REAL8Vector *x = &xVec;
+  REAL8Vector *p = &pVec;
   memcpy(x->data,&values[0],3*sizeof(REAL8));
   memcpy(p->data,&values[3],3*sizeof(REAL8));
 
@@ -252,8 +254,6 @@ UNUSED static REAL8 XLALSpinHcapExactDerivWRTParam(
   } else {
       XLAL_ERROR( XLAL_EFUNC );
   }
-  XLALDestroyREAL8Vector(x);
-  XLALDestroyREAL8Vector(p);
 
   return result;
 }
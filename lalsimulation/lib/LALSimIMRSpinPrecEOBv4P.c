@@ -42,6 +42,7 @@
 #include <lal/SphericalHarmonics.h>
 #include <gsl/gsl_integration.h>
 #include <gsl/gsl_sf_gamma.h>
+#include <gsl/gsl_spline.h>
 #include <lal/Units.h>
 #include <lal/VectorOps.h>
 #include "LALSimIMREOBNRv2.h"
@@ -49,6 +50,7 @@
 #include "LALSimInspiralPrecess.h"
 #include "LALSimBlackHoleRingdownPrec.h"
 #include "LALSimFindAttachTime.h"
+#include "LALSimInspiralEOBPostAdiabatic.h"
 
 // clang-format on
 
@@ -92,6 +94,12 @@
 /* Version flag used in XLALSimIMREOBCalcSpinPrecFacWaveformCoefficients */
 #define v4Pwave 451
 
+/* Post-adiabatic inspiral: default radius (in units of mTotal) at which the
+ * generic-spin integration takes over, and maximal orbital phase step of the
+ * output sampling */
+#define SEOB_PA_RSWITCH_DEFAULT 20.
+#define SEOB_PA_DPHI_MAX (LAL_PI / 8.)
+
 /* Structure containing the approximant name and its number in LALSimInspiral.c
  */
 struct approximant {
@@ -864,6 +872,10 @@ int XLALSimIMRSpinPrecEOBWaveform(
         XLALSimInspiralWaveformParamsLookupEOBEllMaxForNyquistCheck(LALParams);
   }
   XLALDictInsertINT4Value(seobflags,"ellMaxForNyquistCheck",ellMaxForNyquistCheck);
+  /* Optional post-adiabatic evolution of the early inspiral */
+  XLALDictInsertINT4Value(
+      seobflags, "SEOBNRv4P_PostAdiabatic",
+      XLALSimInspiralWaveformParamsLookupEOBPrecPostAdiabatic(LALParams));
   int ret = XLAL_SUCCESS;
   XLAL_TRY(XLALSimIMRSpinPrecEOBWaveformAll(
                hplus, hcross, &hIlm, &hJlm, &dyn_Low, &dyn_Hi, &dyn_all,
@@ -1085,6 +1097,10 @@ SphHarmTimeSeries *XLALSimIMRSpinPrecEOBModes(
         XLALSimInspiralWaveformParamsLookupEOBEllMaxForNyquistCheck(LALParams);
   }
   XLALDictInsertINT4Value(seobflags,"ellMaxForNyquistCheck",ellMaxForNyquistCheck);
+  /* Optional post-adiabatic evolution of the early inspiral */
+  XLALDictInsertINT4Value(
+      seobflags, "SEOBNRv4P_PostAdiabatic",
+      XLALSimInspiralWaveformParamsLookupEOBPrecPostAdiabatic(LALParams));
   int ret = XLAL_SUCCESS;
   XLAL_TRY(XLALSimIMRSpinPrecEOBWaveformAll(
                &hplus, &hcross, &hIlm, &hJlm, &dyn_Low, &dyn_Hi, &dyn_all,
@@ -2260,6 +2276,409 @@ static int SEOBIntegrateDynamics(
   return XLAL_SUCCESS;
 }
 
+/**
+ * Parameters of the orbit-averaged precession equations evolved alongside
+ * the post-adiabatic inspiral. The PN parameter v is obtained from the
+ * orbital frequency of the post-adiabatic solution.
+ */
+typedef struct tagSEOBPostAdiabaticPrecParams {
+  gsl_spline *phi_spline;       /**<< orbital phase against time */
+  gsl_interp_accel *phi_acc;    /**<< accelerator for phi_spline */
+  REAL8 tmin;                   /**<< first time of phi_spline */
+  REAL8 tmax;                   /**<< last time of phi_spline */
+  XLALSimInspiralSpinTaylorTxCoeffs *Tparams; /**<< PN coefficients */
+} SEOBPostAdiabaticPrecParams;
+
+/**
+ * Right-hand side of the orbit-averaged precession equations for LNhat, S1,
+ * S2 and E1, to which the precession phase alpha cos(iota) entering
+ * phiDMod is appended. Spins are in units of mTotal^2 and time in units
+ * of mTotal.
+ */
+static int SEOBPostAdiabaticPrecDerivatives(double t, const double values[],
+                                            double dvalues[], void *mparams) {
+  SEOBPostAdiabaticPrecParams *params = mparams;
+  REAL8 dLNhx, dLNhy, dLNhz, dE1x, dE1y, dE1z;
+  REAL8 dS1x, dS1y, dS1z, dS2x, dS2y, dS2z;
+  const REAL8 *LNh = values, *S1 = values + 3, *S2 = values + 6,
+              *E1 = values + 9;
+
+  /* The integrator may probe slightly beyond the interpolation range */
+  REAL8 tc = t < params->tmin ? params->tmin
+                              : (t > params->tmax ? params->tmax : t);
+  REAL8 omega =
+      gsl_spline_eval_deriv(params->phi_spline, tc, params->phi_acc);
+  REAL8 v = cbrt(omega);
+
+  REAL8 LNhdotS1 = LNh[0] * S1[0] + LNh[1] * S1[1] + LNh[2] * S1[2];
+  REAL8 LNhdotS2 = LNh[0] * S2[0] + LNh[1] * S2[1] + LNh[2] * S2[2];
+  if (XLALSimInspiralSpinDerivativesAvg(
+          &dLNhx, &dLNhy, &dLNhz, &dE1x, &dE1y, &dE1z, &dS1x, &dS1y, &dS1z,
+          &dS2x, &dS2y, &dS2z, v, LNh[0], LNh[1], LNh[2], E1[0], E1[1], E1[2],
+          S1[0], S1[1], S1[2], S2[0], S2[1], S2[2], LNhdotS1, LNhdotS2,
+          params->Tparams) != XLAL_SUCCESS)
+    XLAL_ERROR(XLAL_EFUNC);
+
+  dvalues[0] = dLNhx;
+  dvalues[1] = dLNhy;
+  dvalues[2] = dLNhz;
+  dvalues[3] = dS1x;
+  dvalues[4] = dS1y;
+  dvalues[5] = dS1z;
+  dvalues[6] = dS2x;
+  dvalues[7] = dS2y;
+  dvalues[8] = dS2z;
+  dvalues[9] = dE1x;
+  dvalues[10] = dE1y;
+  dvalues[11] = dE1z;
+  /* Eqs. 19-20 of PRD 89, 084006 (2014), as in the full dynamics */
+  REAL8 rho2 = LNh[0] * LNh[0] + LNh[1] * LNh[1];
+  dvalues[12] =
+      rho2 > 0. ? LNh[2] * (LNh[0] * dLNhy - LNh[1] * dLNhx) / rho2 : 0.;
+
+  return XLAL_SUCCESS;
+}
+
+/**
+ * No stopping condition for the precession equations: they are integrated
+ * over the fixed time span of the post-adiabatic inspiral.
+ */
+static int SEOBPostAdiabaticPrecStop(UNUSED double t,
+                                     UNUSED const double values[],
+                                     UNUSED double dvalues[],
+                                     UNUSED void *mparams) {
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Generic-spin state (x, p, S1, S2, phiMod, phiDMod) at time t of the
+ * post-adiabatic inspiral, from the interpolated spin-aligned PA solution
+ * (r, phi, pr*, pphi) and the interpolated precession variables
+ * (LNhat, S1, S2, E1, alpha cos(iota)). The orbital phase phi is measured
+ * from E1 in the orbital plane.
+ */
+static void SEOBPostAdiabaticState(REAL8 state[14], REAL8 t,
+                                   gsl_spline *splinesPA[4],
+                                   gsl_interp_accel *accPA,
+                                   gsl_spline *splinesPrec[13],
+                                   gsl_interp_accel *accPrec,
+                                   REAL8 tPrecMax) {
+  REAL8 r = gsl_spline_eval(splinesPA[0], t, accPA);
+  REAL8 phi = gsl_spline_eval(splinesPA[1], t, accPA);
+  REAL8 prstar = gsl_spline_eval(splinesPA[2], t, accPA);
+  REAL8 pphi = gsl_spline_eval(splinesPA[3], t, accPA);
+  REAL8 tp = t > tPrecMax ? tPrecMax : t;
+  REAL8 prec[13];
+  for (UINT4 j = 0; j < 13; j++)
+    prec[j] = gsl_spline_eval(splinesPrec[j], tp, accPrec);
+
+  /* Orthonormal frame (E1, E2, LNhat) */
+  REAL8 *LNh = prec, *E1 = prec + 9, E2[3], n[3], lambda[3];
+  REAL8 norm = sqrt(LNh[0] * LNh[0] + LNh[1] * LNh[1] + LNh[2] * LNh[2]);
+  for (UINT4 j = 0; j < 3; j++)
+    LNh[j] /= norm;
+  REAL8 E1dotLNh = E1[0] * LNh[0] + E1[1] * LNh[1] + E1[2] * LNh[2];
+  for (UINT4 j = 0; j < 3; j++)
+    E1[j] -= E1dotLNh * LNh[j];
+  norm = sqrt(E1[0] * E1[0] + E1[1] * E1[1] + E1[2] * E1[2]);
+  for (UINT4 j = 0; j < 3; j++)
+    E1[j] /= norm;
+  cross_product(LNh, E1, E2);
+
+  /* Radial and azimuthal unit vectors */
+  for (UINT4 j = 0; j < 3; j++)
+    n[j] = cos(phi) * E1[j] + sin(phi) * E2[j];
+  cross_product(LNh, n, lambda);
+
+  for (UINT4 j = 0; j < 3; j++) {
+    state[j] = r * n[j];
+    state[3 + j] = prstar * n[j] + pphi / r * lambda[j];
+    state[6 + j] = prec[3 + j];
+    state[9 + j] = prec[6 + j];
+  }
+  state[12] = phi - prec[12];
+  state[13] = prec[12];
+}
+
+/**
+ * This function integrates the SEOBNRv4P dynamics, replacing the early
+ * inspiral by a post-adiabatic (PA) solution. The orbital motion down to the
+ * radius rSwitch is given by the spin-aligned PA solution with the spins
+ * projected on the initial LNhat; the orbital plane and the spins are evolved
+ * along it with the orbit-averaged PN precession equations, driven by the
+ * PA orbital frequency. The generic-spin dynamics is then integrated from
+ * rSwitch with SEOBIntegrateDynamics, as in the standard path.
+ * The output has the same format as SEOBIntegrateDynamics with adaptive
+ * sampling, the PA part being sampled with steps of at most
+ * SEOB_PA_DPHI_MAX in orbital phase.
+ * Fails with XLAL_ERANGE when the initial separation is too small for the PA
+ * approximation to be used, in which case the caller should fall back to
+ * SEOBIntegrateDynamics.
+ */
+static int SEOBIntegrateDynamicsPostAdiabatic(
+    REAL8Array **dynamics, /**<< Output: pointer to array for the dynamics */
+    UINT4 *retLenOut,      /**<< Output: length of the output dynamics */
+    REAL8Vector *ICvalues, /**<< Input: vector with initial conditions */
+    REAL8 EPS_ABS, /**<< Input: absolute accuracy for adaptive Runge-Kutta
+                      integrator */
+    REAL8 EPS_REL, /**<< Input: relative accuracy for adaptive Runge-Kutta
+                      integrator */
+    REAL8 deltaT,  /**<< Input: timesampling step in geometric units, used
+                      internally only to initialize adaptive step */
+    REAL8 deltaT_min, /**<< Input: minimal timesampling step in geometric
+                         units - set to 0 to ignore */
+    REAL8 tend,    /**<< Input: max duration of the generic-spin integration */
+    REAL8 rSwitch, /**<< Input: radius at which the generic-spin integration
+                      takes over, in units of mTotal */
+    REAL8 fMin,    /**<< Input: starting frequency (Hz) */
+    SpinEOBParams *seobParams,  /**<< SEOB params */
+    flagSEOBNRv4P_hamiltonian_derivative
+        flagHamiltonianDerivative /**<< flag to decide wether to use analytical
+                                     or numerical derivatives */
+) {
+  const UINT4 nb_prec_variables = 13;
+  REAL8Array *dynamicsPA = NULL;
+  REAL8Array *dynamicsPrec = NULL;
+  REAL8Array *dynamicsODE = NULL;
+  REAL8Vector *valuesODE = NULL;
+  REAL8Vector *tOut = NULL;
+  LALDict *PAParams = NULL;
+  XLALSimInspiralSpinTaylorTxCoeffs *Tparams = NULL;
+  LALAdaptiveRungeKuttaIntegrator *integrator = NULL;
+  gsl_spline *splinesPA[4] = {NULL, NULL, NULL, NULL};
+  gsl_interp_accel *accPA = NULL;
+  gsl_spline *splinesPrec[13];
+  gsl_interp_accel *accPrec = NULL;
+  UINT4 i, j, k;
+  int ret = XLAL_FAILURE;
+  for (j = 0; j < nb_prec_variables; j++)
+    splinesPrec[j] = NULL;
+
+  XLAL_CHECK(dynamics && *dynamics == NULL, XLAL_EFAULT);
+  XLAL_CHECK(rSwitch > 0., XLAL_EDOM, "rSwitch must be positive.\n");
+
+  REAL8 m1 = seobParams->eobParams->m1;
+  REAL8 m2 = seobParams->eobParams->m2;
+  REAL8 mTotal = m1 + m2;
+  REAL8 eta = seobParams->eobParams->eta;
+  const REAL8 *x0 = ICvalues->data;
+  const REAL8 *p0 = ICvalues->data + 3;
+  const REAL8 *S10 = ICvalues->data + 6;
+  const REAL8 *S20 = ICvalues->data + 9;
+
+  /* Initial orbital frame: LNhat along r x p, E1 along r */
+  REAL8 r0 = sqrt(x0[0] * x0[0] + x0[1] * x0[1] + x0[2] * x0[2]);
+  REAL8 LNh0[3] = {x0[1] * p0[2] - x0[2] * p0[1],
+                   x0[2] * p0[0] - x0[0] * p0[2],
+                   x0[0] * p0[1] - x0[1] * p0[0]};
+  REAL8 L0 = sqrt(LNh0[0] * LNh0[0] + LNh0[1] * LNh0[1] + LNh0[2] * LNh0[2]);
+  if (r0 <= rSwitch)
+    XLAL_ERROR(XLAL_ERANGE);
+  for (j = 0; j < 3; j++)
+    LNh0[j] /= L0;
+
+  /* Spin-aligned problem: spins projected on the initial LNhat */
+  REAL8 chi1L = (S10[0] * LNh0[0] + S10[1] * LNh0[1] + S10[2] * LNh0[2]) *
+                mTotal * mTotal / (m1 * m1);
+  REAL8 chi2L = (S20[0] * LNh0[0] + S20[1] * LNh0[1] + S20[2] * LNh0[2]) *
+                mTotal * mTotal / (m2 * m2);
+  REAL8 s1LData[3] = {0., 0., chi1L * m1 * m1 / (mTotal * mTotal)};
+  REAL8 s2LData[3] = {0., 0., chi2L * m2 * m2 / (mTotal * mTotal)};
+  REAL8 sigmaKerrLData[3], sigmaStarLData[3];
+  REAL8Vector s1L = {3, s1LData}, s2L = {3, s2LData};
+  REAL8Vector sigmaKerrL = {3, sigmaKerrLData};
+  REAL8Vector sigmaStarL = {3, sigmaStarLData};
+  SEOBCalculateSigmaKerr(&sigmaKerrL, &s1L, &s2L);
+  SEOBCalculateSigmaStar(&sigmaStarL, m1, m2, &s1L, &s2L);
+
+  /* Local copies of the parameters, leaving those of the generic-spin
+   * dynamics untouched */
+  SpinEOBParams seobParamsPA = *seobParams;
+  EOBParams eobParamsPA = *seobParams->eobParams;
+  FacWaveformCoeffs hCoeffsPA = *seobParams->eobParams->hCoeffs;
+  SpinEOBHCoeffs seobCoeffsPA;
+  EOBNonQCCoeffs nqcCoeffsPA;
+  memset(&seobCoeffsPA, 0, sizeof(seobCoeffsPA));
+  memset(&nqcCoeffsPA, 0, sizeof(nqcCoeffsPA));
+  eobParamsPA.hCoeffs = &hCoeffsPA;
+  seobParamsPA.eobParams = &eobParamsPA;
+  seobParamsPA.seobCoeffs = &seobCoeffsPA;
+  seobParamsPA.nqcCoeffs = &nqcCoeffsPA;
+  seobParamsPA.s1Vec = &s1L;
+  seobParamsPA.s2Vec = &s2L;
+  seobParamsPA.sigmaKerr = &sigmaKerrL;
+  seobParamsPA.sigmaStar = &sigmaStarL;
+  seobParamsPA.a = sigmaKerrLData[2];
+  seobParamsPA.chi1 = chi1L;
+  seobParamsPA.chi2 = chi2L;
+  seobParamsPA.alignedSpins = 1;
+  /* SEOBNRv4HM uses the dynamics of SEOBNRv4 */
+  seobParamsPA.use_hm = 0;
+  if (XLALSimIMRCalculateSpinEOBHCoeffs(&seobCoeffsPA, eta, seobParamsPA.a,
+                                        4) == XLAL_FAILURE)
+    XLAL_ERROR(XLAL_EFUNC);
+  REAL8 chiS = SEOBCalculateChiS(chi1L, chi2L);
+  REAL8 chiA = SEOBCalculateChiA(chi1L, chi2L);
+  REAL8 tplspin = SEOBCalculatetplspin(m1, m2, eta, chi1L, chi2L, 4);
+  if (XLALSimIMREOBCalcSpinFacWaveformCoefficients(
+          &hCoeffsPA, &seobParamsPA, m1, m2, eta, tplspin, chiS, chiA, 4) ==
+      XLAL_FAILURE)
+    XLAL_ERROR(XLAL_EFUNC);
+
+  /* Post-adiabatic solution, in spherical coordinates r, phi, pr*, pphi */
+  REAL8 initValsData[4] = {r0, 0., 0., L0};
+  REAL8Vector initVals = {4, initValsData};
+  PAParams = XLALCreateDict();
+  XLAL_CHECK_FAIL(PAParams, XLAL_ENOMEM);
+  XLALDictInsertUINT4Value(PAParams, "PAOrder", 8);
+  XLALDictInsertUINT2Value(PAParams, "analyticFlag", 1);
+  int errnum = 0;
+  XLAL_TRY(XLALSimInspiralEOBPostAdiabatic(&dynamicsPA, m1, m2, chi1L, chi2L,
+                                           initVals, 4, &seobParamsPA,
+                                           &nqcCoeffsPA, PAParams),
+           errnum);
+  if (errnum == XLAL_ERANGE)
+    XLAL_ERROR_FAIL(XLAL_ERANGE);
+  XLAL_CHECK_FAIL(errnum == 0, XLAL_EFUNC,
+                  "XLALSimInspiralEOBPostAdiabatic failed.\n");
+  UINT4 lenPA = dynamicsPA->dimLength->data[1];
+  const REAL8 *tPA = dynamicsPA->data;
+  const REAL8 *rPA = dynamicsPA->data + lenPA;
+
+  /* First PA point inside rSwitch, or the last one; at least one full
+   * interval is needed before the switch */
+  UINT4 iSwitch = lenPA - 1;
+  for (i = 0; i < lenPA; i++)
+    if (rPA[i] <= rSwitch) {
+      iSwitch = i;
+      break;
+    }
+  if (iSwitch < 2)
+    XLAL_ERROR_FAIL(XLAL_ERANGE);
+  REAL8 tSwitch = tPA[iSwitch];
+
+  /* Interpolants of r, phi, pr*, pphi against time */
+  accPA = gsl_interp_accel_alloc();
+  XLAL_CHECK_FAIL(accPA, XLAL_ENOMEM);
+  for (k = 0; k < 4; k++) {
+    splinesPA[k] = gsl_spline_alloc(gsl_interp_cspline, lenPA);
+    XLAL_CHECK_FAIL(splinesPA[k], XLAL_ENOMEM);
+    gsl_spline_init(splinesPA[k], tPA, dynamicsPA->data + (k + 1) * lenPA,
+                    lenPA);
+  }
+
+  /* Orbit-averaged precession of LNhat, E1 and the spins along the PA
+   * inspiral, starting in the frame of the initial conditions */
+  XLAL_CHECK_FAIL(XLALSimInspiralSpinTaylorT4Setup(
+                      &Tparams, m1 * LAL_MSUN_SI, m2 * LAL_MSUN_SI, fMin, 0.,
+                      0., 0., 1., 1., LAL_SIM_INSPIRAL_SPIN_ORDER_ALL,
+                      LAL_SIM_INSPIRAL_TIDAL_ORDER_0PN, -1, 0, 0) ==
+                      XLAL_SUCCESS,
+                  XLAL_EFUNC);
+  SEOBPostAdiabaticPrecParams precParams;
+  precParams.phi_spline = splinesPA[1];
+  precParams.phi_acc = accPA;
+  precParams.tmin = tPA[0];
+  precParams.tmax = tPA[lenPA - 1];
+  precParams.Tparams = Tparams;
+  REAL8 precValues[13];
+  for (j = 0; j < 3; j++) {
+    precValues[j] = LNh0[j];
+    precValues[3 + j] = S10[j];
+    precValues[6 + j] = S20[j];
+    precValues[9 + j] = x0[j] / r0;
+  }
+  precValues[12] = 0.;
+  integrator = XLALAdaptiveRungeKutta4Init(
+      nb_prec_variables, SEOBPostAdiabaticPrecDerivatives,
+      SEOBPostAdiabaticPrecStop, EPS_ABS, EPS_REL);
+  XLAL_CHECK_FAIL(integrator, XLAL_EFUNC);
+  integrator->stopontestonly = 0;
+  INT4 lenPrec = XLALAdaptiveRungeKutta4NoInterpolate(
+      integrator, &precParams, precValues, 0., tSwitch, deltaT, 0.,
+      &dynamicsPrec, 2);
+  XLAL_CHECK_FAIL(lenPrec != XLAL_FAILURE && lenPrec >= 2, XLAL_EFUNC,
+                  "Failed to integrate the precession equations.\n");
+  accPrec = gsl_interp_accel_alloc();
+  XLAL_CHECK_FAIL(accPrec, XLAL_ENOMEM);
+  for (j = 0; j < nb_prec_variables; j++) {
+    splinesPrec[j] = gsl_spline_alloc(
+        lenPrec >= 3 ? gsl_interp_cspline : gsl_interp_linear, lenPrec);
+    XLAL_CHECK_FAIL(splinesPrec[j], XLAL_ENOMEM);
+    gsl_spline_init(splinesPrec[j], dynamicsPrec->data,
+                    dynamicsPrec->data + (j + 1) * lenPrec, lenPrec);
+  }
+  REAL8 tPrecMax = dynamicsPrec->data[lenPrec - 1];
+
+  /* Output times: the PA grid refined so that the orbital phase advances
+   * by at most SEOB_PA_DPHI_MAX between samples, up to tSwitch excluded */
+  const REAL8 *phiPA = dynamicsPA->data + 2 * lenPA;
+  UINT4 lenPAOut = 0;
+  for (i = 0; i < iSwitch; i++)
+    lenPAOut += (UINT4)ceil((phiPA[i + 1] - phiPA[i]) / SEOB_PA_DPHI_MAX);
+  tOut = XLALCreateREAL8Vector(lenPAOut);
+  XLAL_CHECK_FAIL(tOut, XLAL_ENOMEM);
+  for (i = 0, k = 0; i < iSwitch; i++) {
+    UINT4 nsub = (UINT4)ceil((phiPA[i + 1] - phiPA[i]) / SEOB_PA_DPHI_MAX);
+    for (j = 0; j < nsub; j++)
+      tOut->data[k++] = tPA[i] + (tPA[i + 1] - tPA[i]) * j / nsub;
+  }
+
+  /* Generic-spin integration from tSwitch to the end of the inspiral */
+  valuesODE = XLALCreateREAL8Vector(14);
+  XLAL_CHECK_FAIL(valuesODE, XLAL_ENOMEM);
+  SEOBPostAdiabaticState(valuesODE->data, tSwitch, splinesPA, accPA,
+                         splinesPrec, accPrec, tPrecMax);
+  UINT4 retLenODE = 0;
+  XLAL_CHECK_FAIL(SEOBIntegrateDynamics(&dynamicsODE, &retLenODE, valuesODE,
+                                        EPS_ABS, EPS_REL, deltaT, deltaT_min,
+                                        tSwitch, tSwitch + tend, seobParams, 0,
+                                        flagHamiltonianDerivative) ==
+                      XLAL_SUCCESS,
+                  XLAL_EFUNC);
+
+  /* Join the PA and generic-spin parts */
+  UINT4 retLen = lenPAOut + retLenODE;
+  *dynamics = XLALCreateREAL8ArrayL(2, 15, retLen);
+  XLAL_CHECK_FAIL(*dynamics, XLAL_ENOMEM);
+  for (k = 0; k < lenPAOut; k++) {
+    REAL8 state[14];
+    SEOBPostAdiabaticState(state, tOut->data[k], splinesPA, accPA,
+                           splinesPrec, accPrec, tPrecMax);
+    (*dynamics)->data[k] = tOut->data[k];
+    for (j = 0; j < 14; j++)
+      (*dynamics)->data[(j + 1) * retLen + k] = state[j];
+  }
+  for (j = 0; j < 15; j++)
+    memcpy((*dynamics)->data + j * retLen + lenPAOut,
+           dynamicsODE->data + j * retLenODE, retLenODE * sizeof(REAL8));
+  *retLenOut = retLen;
+  ret = XLAL_SUCCESS;
+
+XLAL_FAIL:
+  for (k = 0; k < 4; k++)
+    if (splinesPA[k])
+      gsl_spline_free(splinesPA[k]);
+  for (j = 0; j < nb_prec_variables; j++)
+    if (splinesPrec[j])
+      gsl_spline_free(splinesPrec[j]);
+  if (accPA)
+    gsl_interp_accel_free(accPA);
+  if (accPrec)
+    gsl_interp_accel_free(accPrec);
+  if (integrator)
+    XLALAdaptiveRungeKuttaFree(integrator);
+  if (Tparams)
+    LALFree(Tparams);
+  XLALDestroyDict(PAParams);
+  XLALDestroyREAL8Array(dynamicsPA);
+  XLALDestroyREAL8Array(dynamicsPrec);
+  XLALDestroyREAL8Array(dynamicsODE);
+  XLALDestroyREAL8Vector(valuesODE);
+  XLALDestroyREAL8Vector(tOut);
+  return ret;
+}
+
 /**
  * This function generates a waveform mode for a given SEOB dynamics.
  */
@@ -4679,6 +5098,18 @@ int XLALSimIMRSpinPrecEOBWaveformAll(
     debug = 0;
   else
     debug = XLALDictLookupINT4Value(seobflags, "SEOBNRv4P_debug");
+  /* Flag to evolve the early inspiral with the post-adiabatic solution */
+  /* Default False */
+  INT4 flagPostAdiabatic = 0;
+  if (XLALDictContains(seobflags, "SEOBNRv4P_PostAdiabatic"))
+    flagPostAdiabatic =
+        XLALDictLookupINT4Value(seobflags, "SEOBNRv4P_PostAdiabatic");
+  /* Radius at which the post-adiabatic inspiral hands over to the
+   * generic-spin dynamics */
+  REAL8 rSwitchPostAdiabatic = SEOB_PA_RSWITCH_DEFAULT;
+  if (XLALDictContains(seobflags, "SEOBNRv4P_PostAdiabaticRswitch"))
+    rSwitchPostAdiabatic =
+        XLALDictLookupREAL8Value(seobflags, "SEOBNRv4P_PostAdiabaticRswitch");
 
   if (debug) {
     printf("************************************\n");
@@ -4700,6 +5131,7 @@ int XLALSimIMRSpinPrecEOBWaveformAll(
     printf("flagHamiltonianDerivative = %d\n", flagHamiltonianDerivative);
     printf("flagEulerextension = %d\n", flagEulerextension);
     printf("flagZframe = %d\n", flagZframe);
+    printf("flagPostAdiabatic = %d\n", flagPostAdiabatic);
   }
 
   /******************************************************************************************************************/
@@ -5130,9 +5562,35 @@ int XLALSimIMRSpinPrecEOBWaveformAll(
       20. / mTScaled;    /* This is 20s in geometric units, seems it should be
                             ignored anyway because of integrator->stopontestonly */
   REAL8 tstartAdaS = 0.; /* t=0 will set at the starting time */
+  /* Optionally replace the early generic-spin inspiral by the post-adiabatic
+   * solution; falls back to the full integration when the binary starts too
+   * close to rSwitchPostAdiabatic */
+  UINT4 usedPostAdiabatic = 0;
+  if (flagPostAdiabatic && !SpinsAlmostAligned) {
+    INT4 errnumPA = 0;
+    XLAL_TRY(SEOBIntegrateDynamicsPostAdiabatic(
+                 &dynamicsAdaS, &retLenAdaS, ICvalues, EPS_ABS, EPS_REL,
+                 deltaT, deltaT_min, tendAdaS, rSwitchPostAdiabatic, fMin,
+                 &seobParams, flagHamiltonianDerivative),
+             errnumPA);
+    if (errnumPA == 0)
+      usedPostAdiabatic = 1;
+    else if (errnumPA != XLAL_ERANGE) {
+      FREE_ALL
+      XLALPrintError(
+          "XLAL Error - %s: SEOBIntegrateDynamicsPostAdiabatic failed.\n",
+          __func__);
+      PRINT_ALL_PARAMS
+      XLAL_ERROR(XLAL_EFUNC);
+    }
+    if (debug)
+      printf("post-adiabatic inspiral %s\n",
+             usedPostAdiabatic ? "used" : "not applicable");
+  }
   /* Note: the timesampling step deltaT is used internally only to initialize
    * adaptive step */
-  if (SEOBIntegrateDynamics(&dynamicsAdaS, &retLenAdaS, ICvalues, EPS_ABS,
+  if (!usedPostAdiabatic &&
+      SEOBIntegrateDynamics(&dynamicsAdaS, &retLenAdaS, ICvalues, EPS_ABS,
                             EPS_REL, deltaT, deltaT_min, tstartAdaS, tendAdaS,
                             &seobParams, flagConstantSampling,
                             flagHamiltonianDerivative) == XLAL_FAILURE) {
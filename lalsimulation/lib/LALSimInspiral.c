@@ -527,6 +527,49 @@ int XLALSimInspiralGenerateFDWaveform(
     XLAL_ERROR(XLAL_EINVAL, "generator does not provide a method to generate frequency-domain waveforms");
 }
 
+/**
+ * Returns single-precision frequency-domain polarizations for a specific approximant.
+ * Equivalent to XLALSimInspiralGenerateFDWaveform() but the polarizations are returned as COMPLEX8 frequency series.
+ * Generators that support it (currently TaylorF2, IMRPhenomD, IMRPhenomXAS and IMRPhenomXHM without conditioning) accumulate the phase in double precision and store each sample directly in single precision, so that no double-precision copy of the waveform is allocated.
+ * For all other generators the double-precision polarizations are generated and then converted.
+ *
+ * The parameters in the LALDict must be in SI units.
+ */
+int XLALSimInspiralGenerateFDWaveformCOMPLEX8(
+    COMPLEX8FrequencySeries **hplus,
+    COMPLEX8FrequencySeries **hcross,
+    LALDict *params,
+    LALSimInspiralGenerator *generator
+)
+{
+    COMPLEX16FrequencySeries *hptilde = NULL;
+    COMPLEX16FrequencySeries *hctilde = NULL;
+
+    XLAL_CHECK(hplus && hcross && generator, XLAL_EFAULT);
+    XLAL_CHECK(*hplus == NULL && *hcross == NULL, XLAL_EINVAL, "hplus and hcross must be pointers to NULL");
+    if (generator->generate_fd_waveform_single)
+        return generator->generate_fd_waveform_single(hplus, hcross, params, generator);
+
+    XLAL_CHECK(XLALSimInspiralGenerateFDWaveform(&hptilde, &hctilde, params, generator) == XLAL_SUCCESS, XLAL_EFUNC);
+    *hplus = XLALCreateCOMPLEX8FrequencySeries(hptilde->name, &hptilde->epoch, hptilde->f0, hptilde->deltaF, &hptilde->sampleUnits, hptilde->data->length);
+    *hcross = XLALCreateCOMPLEX8FrequencySeries(hctilde->name, &hctilde->epoch, hctilde->f0, hctilde->deltaF, &hctilde->sampleUnits, hctilde->data->length);
+    if (!*hplus || !*hcross) {
+        XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+        XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+        XLALDestroyCOMPLEX8FrequencySeries(*hplus);
+        XLALDestroyCOMPLEX8FrequencySeries(*hcross);
+        *hplus = *hcross = NULL;
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+    for (UINT4 i = 0; i < hptilde->data->length; ++i) {
+        (*hplus)->data->data[i] = hptilde->data->data[i];
+        (*hcross)->data->data[i] = hctilde->data->data[i];
+    }
+    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    return XLAL_SUCCESS;
+}
+
 /**
  * Compute frequency-domain modes for a specific approximant. 
  * Equivalent to XLALSimInspiralChooseFDModes. The only difference is that the SphHarmSeries object needs to be passed as an argument to the function. The actual returned value is an integer which indicates success or error in the waveform evaluation (see https://lscsoft.docs.ligo.org/lalsuite/lal/group___x_l_a_l_error__h.html).
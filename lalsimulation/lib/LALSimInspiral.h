@@ -209,6 +209,7 @@ extern "C" {
  * @defgroup LALSimInspiralWaveformTaper_c         Module LALSimInspiralWaveformTaper.c
  * @defgroup LALSimInspiralNRSur4d2s_c             Module LALSimInspiralNRSur4d2s.c
  * @defgroup LALSimIMRNRHybSur3dq8_c               Module LALSimIMRNRHybSur3dq8.c
+ * @defgroup LALSimInspiralDurationTable_c         Module LALSimInspiralDurationTable.c
  * @}
  *
  * @addtogroup LALSimInspiral_h
@@ -531,6 +532,21 @@ typedef enum tagTestGRaccept {
   LAL_SIM_INSPIRAL_NUM_TESTGR_ACCEPT  /**< Number of elements in enum, useful for checking bounds */
  } TestGRaccept;
 
+/**
+ * Enum that specifies the chirp-time estimate tabulated by a
+ * LALSimInspiralDurationTable.
+ */
+typedef enum tagLALSimInspiralDurationEstimator {
+  LAL_SIM_INSPIRAL_DURATION_CHIRP_TIME_BOUND, /**< XLALSimInspiralChirpTimeBound() with both spins equal to chi */
+  LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH,    /**< XLALSimInspiralTaylorLength() at the highest PN order, to the last stable orbit */
+  LAL_SIM_INSPIRAL_DURATION_SEOBNRv2,         /**< XLALSimIMRSEOBNRv2ChirpTimeSingleSpin() */
+  LAL_SIM_INSPIRAL_NUM_DURATION_ESTIMATORS    /**< Number of elements in enum, useful for checking bounds */
+} LALSimInspiralDurationEstimator;
+
+/** Incomplete type for a tabulated chirp-time estimator */
+struct tagLALSimInspiralDurationTable;
+typedef struct tagLALSimInspiralDurationTable LALSimInspiralDurationTable;
+
 
 /**
  * Structure for passing around PN phasing coefficients.
@@ -612,6 +628,14 @@ double XLALSimInspiralGetFrequency(REAL8 m1, REAL8 m2, const REAL8 S1x, const RE
 double XLALSimInspiralGetFinalFreq(REAL8 m1, REAL8 m2, REAL8 S1x, REAL8 S1y, REAL8 S1z, REAL8 S2x, REAL8 S2y, REAL8 S2z, Approximant approximant);
 REAL8 XLALSimInspiralTaylorLength(REAL8 deltaT, REAL8 m1, REAL8 m2, REAL8 f_min, int O);
 
+/* routines for tabulated waveform durations (LALSimInspiralDurationTable.c) */
+LALSimInspiralDurationTable *XLALSimInspiralDurationTableCreate(LALSimInspiralDurationEstimator estimator, REAL8 etaMin, REAL8 chiMin, REAL8 chiMax, REAL8 MfMin, REAL8 MfMax, UINT4 neta, UINT4 nchi, UINT4 nMf);
+void XLALSimInspiralDurationTableDestroy(LALSimInspiralDurationTable *table);
+REAL8 XLALSimInspiralDurationTableChirpTime(const LALSimInspiralDurationTable *table, REAL8 fstart, REAL8 m1, REAL8 m2, REAL8 chi);
+REAL8 XLALSimInspiralDurationTableStartFrequency(const LALSimInspiralDurationTable *table, REAL8 tchirp, REAL8 m1, REAL8 m2, REAL8 chi);
+int XLALSimInspiralDurationTableChirpTimeBatch(REAL8Sequence *tchirp, const LALSimInspiralDurationTable *table, const REAL8Sequence *fstart, const REAL8Sequence *m1, const REAL8Sequence *m2, const REAL8Sequence *chi);
+int XLALSimInspiralDurationTableStartFrequencyBatch(REAL8Sequence *fstart, const LALSimInspiralDurationTable *table, const REAL8Sequence *tchirp, const REAL8Sequence *m1, const REAL8Sequence *m2, const REAL8Sequence *chi);
+
 /* routines for conditioning waveforms */
 int XLALSimInspiralTDConditionStage1(REAL8TimeSeries *hplus, REAL8TimeSeries *hcross, REAL8 textra, REAL8 f_min);
 int XLALSimInspiralTDConditionStage2(REAL8TimeSeries *hplus, REAL8TimeSeries *hcross, REAL8 f_min, REAL8 f_max);
@@ -729,6 +753,7 @@ int XLALSimInspiralTaylorF2AlignedPhasingArray(REAL8Vector **phasingvals, REAL8V
 int XLALSimInspiralTaylorF2Core(COMPLEX16FrequencySeries **htilde, const REAL8Sequence *freqs, const REAL8 phi_ref, const REAL8 m1_SI, const REAL8 m2_SI, const REAL8 f_ref, const REAL8 shft, const REAL8 r, LALDict *LALparams, PNPhasingSeries *pfaP);
 
 int XLALSimInspiralTaylorF2(COMPLEX16FrequencySeries **htilde, const REAL8 phi_ref, const REAL8 deltaF, const REAL8 m1_SI, const REAL8 m2_SI, const REAL8 S1z, const REAL8 S2z, const REAL8 fStart, const REAL8 fEnd, const REAL8 f_ref, const REAL8 r, LALDict *LALpars);
+int XLALSimInspiralTaylorF2COMPLEX8(COMPLEX8FrequencySeries **hptilde, COMPLEX8FrequencySeries **hctilde, const REAL8 phi_ref, const REAL8 deltaF, const REAL8 m1_SI, const REAL8 m2_SI, const REAL8 S1z, const REAL8 S2z, const REAL8 fStart, const REAL8 fEnd, const REAL8 f_ref, const REAL8 r, const COMPLEX16 plusFactor, const COMPLEX16 crossFactor, LALDict *LALpars);
 
 /* TaylorF2Ecc functions */
 /* in module LALSimInspiralTaylorF2Ecc.c */
@@ -1076,6 +1101,13 @@ int XLALSimInspiralGenerateFDWaveform(
     LALSimInspiralGenerator *generator
 );
 
+int XLALSimInspiralGenerateFDWaveformCOMPLEX8(
+    COMPLEX8FrequencySeries **hplus,
+    COMPLEX8FrequencySeries **hcross,
+    LALDict *params,
+    LALSimInspiralGenerator *generator
+);
+
 int XLALSimInspiralGenerateFDModes(
     SphHarmFrequencySeries **hlm,
     LALDict *params,
@@ -0,0 +1,458 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Sequence.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimIMR.h>
+
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
+/**
+ * @addtogroup LALSimInspiralDurationTable_c
+ * @brief Tabulated chirp times for sizing large numbers of templates.
+ *
+ * @details
+ * Template placement and injection codes call XLALSimInspiralChirpTimeBound(),
+ * XLALSimInspiralTaylorLength() or XLALSimIMRSEOBNRv2ChirpTimeSingleSpin()
+ * once per template to size their buffers; the latter two involve a
+ * numerical integral or a spline interpolant each time.  All three
+ * estimates scale with the total mass M as
+ * \f[
+ * t_\mathrm{chirp}(f; M, \eta, \chi) = M\, \tau(M f; \eta, \chi),
+ * \f]
+ * with M in seconds, so a single table of
+ * \f$\ln\tau\f$ on a regular grid in \f$(\eta, \chi, \ln M f)\f$ covers
+ * every total mass.  The table is filled once by calling the exact
+ * estimator; lookups are then a trilinear interpolation, and the batch
+ * routines evaluate whole arrays of parameters in a single
+ * (OpenMP parallel and SIMD) loop.
+ *
+ * Since the tabulated \f$\ln\tau\f$ is strictly decreasing in
+ * \f$\ln M f\f$, the interpolant can be inverted exactly to obtain the
+ * starting frequency for a given chirp time.
+ *
+ * Points outside the tabulated domain are an error (#XLAL_EDOM); the table
+ * should be created to cover the whole template bank or injection set.
+ * The interpolated values are not guaranteed to bound the exact estimate;
+ * with tens of points in \f$\eta\f$ and \f$\chi\f$ and a few hundred in
+ * \f$\ln M f\f$ the relative error is well below a percent, which is
+ * usually absorbed by rounding buffer lengths up to a power of two.
+ * @{
+ */
+
+/** Reference total mass (solar masses) at which the table is filled */
+#define DURATION_TABLE_MREF 20.0
+
+struct tagLALSimInspiralDurationTable {
+    LALSimInspiralDurationEstimator estimator;
+    UINT4 neta;   /* number of points in eta */
+    UINT4 nchi;   /* number of points in chi */
+    UINT4 nx;     /* number of points in x = ln(M f) */
+    REAL8 eta0;   /* first grid point in eta */
+    REAL8 deta;   /* spacing in eta */
+    REAL8 chi0;   /* first grid point in chi */
+    REAL8 dchi;   /* spacing in chi */
+    REAL8 x0;     /* first grid point in x */
+    REAL8 dx;     /* spacing in x */
+    REAL8 *y;     /* ln(tchirp / M) with index (i * nchi + j) * nx + k */
+};
+
+/* chirp time in units of the total mass from the exact estimator */
+static REAL8 duration_table_exact(LALSimInspiralDurationEstimator estimator, REAL8 Mf, REAL8 eta, REAL8 chi)
+{
+    const REAL8 M = DURATION_TABLE_MREF * LAL_MSUN_SI;
+    const REAL8 Msec = DURATION_TABLE_MREF * LAL_MTSUN_SI;
+    const REAL8 m1 = 0.5 * M * (1.0 + sqrt(1.0 - 4.0 * eta));
+    const REAL8 m2 = M - m1;
+    const REAL8 f = Mf / Msec;
+    REAL8 deltaT;
+    REAL8 t;
+
+    switch (estimator) {
+    case LAL_SIM_INSPIRAL_DURATION_CHIRP_TIME_BOUND:
+        t = XLALSimInspiralChirpTimeBound(f, m1, m2, chi, chi);
+        break;
+    case LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH:
+        /* small enough that the integral always runs to the last stable orbit */
+        deltaT = 1e-3 * Msec;
+        t = XLALSimInspiralTaylorLength(deltaT, m1, m2, f, -1) + deltaT;
+        break;
+    case LAL_SIM_INSPIRAL_DURATION_SEOBNRv2:
+        t = XLALSimIMRSEOBNRv2ChirpTimeSingleSpin(m1, m2, chi, f);
+        break;
+    default:
+        XLAL_ERROR_REAL8(XLAL_EINVAL, "Unknown duration estimator %d", (int) estimator);
+    }
+    if (XLAL_IS_REAL8_FAIL_NAN(t))
+        XLAL_ERROR_REAL8(XLAL_EFUNC);
+    if (!(t > 0.0))
+        XLAL_ERROR_REAL8(XLAL_EDOM, "Non-positive chirp time at M f = %g, eta = %g, chi = %g; frequency above the domain of the estimator?", Mf, eta, chi);
+    return t / Msec;
+}
+
+/* interpolated ln(tchirp / M); NAN outside the table */
+static inline REAL8 duration_table_interp(const LALSimInspiralDurationTable *table, REAL8 eta, REAL8 chi, REAL8 x)
+{
+    const UINT4 nchi = table->nchi;
+    const UINT4 nx = table->nx;
+    const REAL8 *y = table->y;
+    REAL8 u = (eta - table->eta0) / table->deta;
+    REAL8 v = (chi - table->chi0) / table->dchi;
+    REAL8 w = (x - table->x0) / table->dx;
+    UINT4 i, j, k;
+    size_t c00, c01, c10, c11;
+    REAL8 y00, y01, y10, y11;
+
+    /* also rejects NAN */
+    if (!(u >= 0.0 && u <= table->neta - 1 && v >= 0.0 && v <= nchi - 1 && w >= 0.0 && w <= nx - 1))
+        return NAN;
+
+    i = (UINT4) u;
+    j = (UINT4) v;
+    k = (UINT4) w;
+    i = i < table->neta - 2 ? i : table->neta - 2;
+    j = j < nchi - 2 ? j : nchi - 2;
+    k = k < nx - 2 ? k : nx - 2;
+    u -= i;
+    v -= j;
+    w -= k;
+
+    c00 = ((size_t) i * nchi + j) * nx + k;
+    c01 = c00 + nx;
+    c10 = c00 + (size_t) nchi * nx;
+    c11 = c10 + nx;
+    y00 = y[c00] + w * (y[c00 + 1] - y[c00]);
+    y01 = y[c01] + w * (y[c01 + 1] - y[c01]);
+    y10 = y[c10] + w * (y[c10 + 1] - y[c10]);
+    y11 = y[c11] + w * (y[c11 + 1] - y[c11]);
+    y00 += v * (y01 - y00);
+    y10 += v * (y11 - y10);
+    return y00 + u * (y10 - y00);
+}
+
+/* chirp time for masses in kg; NAN outside the table */
+static inline REAL8 duration_table_chirp_time(const LALSimInspiralDurationTable *table, REAL8 fstart, REAL8 m1, REAL8 m2, REAL8 chi)
+{
+    REAL8 M = m1 + m2;
+    REAL8 eta = m1 * m2 / (M * M);
+    REAL8 Msec = M * (LAL_MTSUN_SI / LAL_MSUN_SI);
+    eta = eta < 0.25 ? eta : 0.25;
+    return Msec * exp(duration_table_interp(table, eta, chi, log(Msec * fstart)));
+}
+
+/* starting frequency for masses in kg; NAN outside the table */
+static REAL8 duration_table_start_frequency(const LALSimInspiralDurationTable *table, REAL8 tchirp, REAL8 m1, REAL8 m2, REAL8 chi)
+{
+    const UINT4 nchi = table->nchi;
+    const UINT4 nx = table->nx;
+    const REAL8 *y = table->y;
+    REAL8 M = m1 + m2;
+    REAL8 eta = m1 * m2 / (M * M);
+    REAL8 Msec = M * (LAL_MTSUN_SI / LAL_MSUN_SI);
+    REAL8 yt = log(tchirp / Msec);
+    REAL8 u, v, w00, w01, w10, w11;
+    REAL8 ylo, yhi;
+    UINT4 i, j, lo, hi;
+    size_t c00, c01, c10, c11;
+
+    eta = eta < 0.25 ? eta : 0.25;
+    u = (eta - table->eta0) / table->deta;
+    v = (chi - table->chi0) / table->dchi;
+    if (!(u >= 0.0 && u <= table->neta - 1 && v >= 0.0 && v <= nchi - 1) || isnan(yt))
+        return NAN;
+
+    i = (UINT4) u;
+    j = (UINT4) v;
+    i = i < table->neta - 2 ? i : table->neta - 2;
+    j = j < nchi - 2 ? j : nchi - 2;
+    u -= i;
+    v -= j;
+    w00 = (1.0 - u) * (1.0 - v);
+    w01 = (1.0 - u) * v;
+    w10 = u * (1.0 - v);
+    w11 = u * v;
+    c00 = ((size_t) i * nchi + j) * nx;
+    c01 = c00 + nx;
+    c10 = c00 + (size_t) nchi * nx;
+    c11 = c10 + nx;
+
+#define DURATION_TABLE_COLUMN(k) (w00 * y[c00 + (k)] + w01 * y[c01 + (k)] + w10 * y[c10 + (k)] + w11 * y[c11 + (k)])
+    /* the column is strictly decreasing in k */
+    lo = 0;
+    hi = nx - 1;
+    ylo = DURATION_TABLE_COLUMN(lo);
+    yhi = DURATION_TABLE_COLUMN(hi);
+    if (yt > ylo || yt < yhi)
+        return NAN;
+    while (hi - lo > 1) {
+        UINT4 mid = lo + (hi - lo) / 2;
+        REAL8 ymid = DURATION_TABLE_COLUMN(mid);
+        if (ymid >= yt) {
+            lo = mid;
+            ylo = ymid;
+        } else {
+            hi = mid;
+            yhi = ymid;
+        }
+    }
+#undef DURATION_TABLE_COLUMN
+
+    return exp(table->x0 + table->dx * (lo + (ylo - yt) / (ylo - yhi))) / Msec;
+}
+
+/**
+ * @brief Creates a table of chirp times over a regular grid.
+ * @details
+ * The chosen estimator is evaluated at every point of a grid with @p neta
+ * points uniform in the symmetric mass ratio over [@p etaMin, 1/4], @p nchi
+ * points uniform in the effective aligned spin over [@p chiMin, @p chiMax]
+ * and @p nMf points uniform in \f$\ln M f\f$ over [@p MfMin, @p MfMax],
+ * where M f is the dimensionless product of the total mass (in seconds)
+ * and the starting frequency.  For #LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH,
+ * which does not depend on spin, only one spin column is computed.  The
+ * grid is filled in parallel when compiled with OpenMP.
+ *
+ * The domain must lie within that of the estimator; in particular
+ * @p MfMax must be below the last stable orbit \f$6^{-3/2}/\pi\f$ for
+ * #LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH, and [@p MfMin, @p MfMax] within
+ * the range of the SEOBNRv2 chirp-time data for
+ * #LAL_SIM_INSPIRAL_DURATION_SEOBNRv2.
+ */
+LALSimInspiralDurationTable *XLALSimInspiralDurationTableCreate(
+    LALSimInspiralDurationEstimator estimator, /**< chirp-time estimate to tabulate */
+    REAL8 etaMin,       /**< smallest symmetric mass ratio */
+    REAL8 chiMin,       /**< smallest effective aligned spin */
+    REAL8 chiMax,       /**< largest effective aligned spin */
+    REAL8 MfMin,        /**< smallest dimensionless M f */
+    REAL8 MfMax,        /**< largest dimensionless M f */
+    UINT4 neta,         /**< number of points in symmetric mass ratio */
+    UINT4 nchi,         /**< number of points in spin */
+    UINT4 nMf           /**< number of points in M f */
+)
+{
+    LALSimInspiralDurationTable *table;
+    UINT4 ncol;
+    int errnum = 0;
+
+    XLAL_CHECK_NULL((int) estimator >= 0 && estimator < LAL_SIM_INSPIRAL_NUM_DURATION_ESTIMATORS, XLAL_EINVAL, "Unknown duration estimator %d", (int) estimator);
+    XLAL_CHECK_NULL(etaMin > 0.0 && etaMin < 0.25, XLAL_EDOM, "etaMin = %g must be in (0, 1/4)", etaMin);
+    XLAL_CHECK_NULL(chiMin < chiMax, XLAL_EDOM, "chiMin = %g must be less than chiMax = %g", chiMin, chiMax);
+    XLAL_CHECK_NULL(MfMin > 0.0 && MfMin < MfMax, XLAL_EDOM, "Require 0 < MfMin < MfMax; got MfMin = %g, MfMax = %g", MfMin, MfMax);
+    XLAL_CHECK_NULL(neta >= 2 && nchi >= 2 && nMf >= 2, XLAL_EINVAL, "Require at least two grid points in each dimension");
+
+    table = XLALCalloc(1, sizeof(*table));
+    if (!table)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    table->y = XLALMalloc((size_t) neta * nchi * nMf * sizeof(*table->y));
+    if (!table->y) {
+        XLALFree(table);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    table->estimator = estimator;
+    table->neta = neta;
+    table->nchi = nchi;
+    table->nx = nMf;
+    table->eta0 = etaMin;
+    table->deta = (0.25 - etaMin) / (neta - 1);
+    table->chi0 = chiMin;
+    table->dchi = (chiMax - chiMin) / (nchi - 1);
+    table->x0 = log(MfMin);
+    table->dx = (log(MfMax) - table->x0) / (nMf - 1);
+
+    ncol = estimator == LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH ? 1 : nchi;
+
+    #pragma omp parallel for schedule(dynamic)
+    for (UINT4 ij = 0; ij < neta * ncol; ++ij) {
+        UINT4 i = ij / ncol;
+        UINT4 j = ij % ncol;
+        REAL8 eta = i == neta - 1 ? 0.25 : table->eta0 + i * table->deta;
+        REAL8 chi = table->chi0 + j * table->dchi;
+        REAL8 *y = table->y + ((size_t) i * nchi + j) * nMf;
+        for (UINT4 k = 0; k < nMf; ++k) {
+            REAL8 tau = duration_table_exact(estimator, exp(table->x0 + k * table->dx), eta, chi);
+            if (XLAL_IS_REAL8_FAIL_NAN(tau)) {
+                #pragma omp critical (duration_table_create)
+                errnum = XLAL_EFUNC;
+                break;
+            }
+            y[k] = log(tau);
+            if (k > 0 && !(y[k] < y[k - 1])) {
+                #pragma omp critical (duration_table_create)
+                errnum = XLAL_EFAILED;
+                break;
+            }
+        }
+    }
+    if (errnum) {
+        XLALSimInspiralDurationTableDestroy(table);
+        XLAL_ERROR_NULL(errnum, "Could not tabulate chirp time%s", errnum == XLAL_EFAILED ? ": not decreasing with frequency" : "");
+    }
+
+    /* spin-independent estimator: replicate the single column */
+    if (ncol == 1)
+        for (UINT4 i = 0; i < neta; ++i)
+            for (UINT4 j = 1; j < nchi; ++j)
+                memcpy(table->y + ((size_t) i * nchi + j) * nMf, table->y + (size_t) i * nchi * nMf, nMf * sizeof(*table->y));
+
+    return table;
+}
+
+/**
+ * @brief Destroys a table created by XLALSimInspiralDurationTableCreate().
+ */
+void XLALSimInspiralDurationTableDestroy(LALSimInspiralDurationTable *table)
+{
+    if (table) {
+        XLALFree(table->y);
+        XLALFree(table);
+    }
+}
+
+/**
+ * @brief Interpolated chirp time from a given starting frequency.
+ * @return Chirp time in seconds, or #XLAL_REAL8_FAIL_NAN with #XLAL_EDOM if
+ * the parameters are outside the table.
+ */
+REAL8 XLALSimInspiralDurationTableChirpTime(
+    const LALSimInspiralDurationTable *table, /**< duration table */
+    REAL8 fstart,   /**< starting frequency (Hz) */
+    REAL8 m1,       /**< mass of the first component (kg) */
+    REAL8 m2,       /**< mass of the second component (kg) */
+    REAL8 chi       /**< effective aligned spin */
+)
+{
+    REAL8 tchirp;
+    XLAL_CHECK_REAL8(table, XLAL_EFAULT);
+    tchirp = duration_table_chirp_time(table, fstart, m1, m2, chi);
+    if (isnan(tchirp))
+        XLAL_ERROR_REAL8(XLAL_EDOM, "fstart = %g, m1 = %g, m2 = %g, chi = %g is outside the duration table", fstart, m1, m2, chi);
+    return tchirp;
+}
+
+/**
+ * @brief Interpolated starting frequency for a given chirp time.
+ * @details
+ * This is the exact inverse of XLALSimInspiralDurationTableChirpTime().
+ * @return Starting frequency in Hz, or #XLAL_REAL8_FAIL_NAN with #XLAL_EDOM
+ * if the parameters are outside the table.
+ */
+REAL8 XLALSimInspiralDurationTableStartFrequency(
+    const LALSimInspiralDurationTable *table, /**< duration table */
+    REAL8 tchirp,   /**< chirp time (s) */
+    REAL8 m1,       /**< mass of the first component (kg) */
+    REAL8 m2,       /**< mass of the second component (kg) */
+    REAL8 chi       /**< effective aligned spin */
+)
+{
+    REAL8 fstart;
+    XLAL_CHECK_REAL8(table, XLAL_EFAULT);
+    fstart = duration_table_start_frequency(table, tchirp, m1, m2, chi);
+    if (isnan(fstart))
+        XLAL_ERROR_REAL8(XLAL_EDOM, "tchirp = %g, m1 = %g, m2 = %g, chi = %g is outside the duration table", tchirp, m1, m2, chi);
+    return fstart;
+}
+
+/**
+ * @brief Interpolated chirp times for arrays of parameters.
+ * @details
+ * Element-wise version of XLALSimInspiralDurationTableChirpTime(); all
+ * sequences must have the same length.  If any point lies outside the
+ * table the routine fails with #XLAL_EDOM and the corresponding elements
+ * of @p tchirp are NAN.
+ */
+int XLALSimInspiralDurationTableChirpTimeBatch(
+    REAL8Sequence *tchirp,          /**< [out] chirp times (s) */
+    const LALSimInspiralDurationTable *table, /**< duration table */
+    const REAL8Sequence *fstart,    /**< starting frequencies (Hz) */
+    const REAL8Sequence *m1,        /**< masses of the first component (kg) */
+    const REAL8Sequence *m2,        /**< masses of the second component (kg) */
+    const REAL8Sequence *chi        /**< effective aligned spins */
+)
+{
+    const size_t n = tchirp ? tchirp->length : 0;
+    REAL8 *restrict t;
+    const REAL8 *restrict f, *restrict ma, *restrict mb, *restrict s;
+
+    XLAL_CHECK(tchirp && table && fstart && m1 && m2 && chi, XLAL_EFAULT);
+    XLAL_CHECK(fstart->length == n && m1->length == n && m2->length == n && chi->length == n, XLAL_EBADLEN);
+
+    t = tchirp->data;
+    f = fstart->data;
+    ma = m1->data;
+    mb = m2->data;
+    s = chi->data;
+    #pragma omp parallel for simd
+    for (size_t i = 0; i < n; ++i)
+        t[i] = duration_table_chirp_time(table, f[i], ma[i], mb[i], s[i]);
+
+    for (size_t i = 0; i < n; ++i)
+        if (isnan(t[i]))
+            XLAL_ERROR(XLAL_EDOM, "Element %zu (fstart = %g, m1 = %g, m2 = %g, chi = %g) is outside the duration table", i, f[i], ma[i], mb[i], s[i]);
+
+    return XLAL_SUCCESS;
+}
+
+/**
+ * @brief Interpolated starting frequencies for arrays of parameters.
+ * @details
+ * Element-wise version of XLALSimInspiralDurationTableStartFrequency(); all
+ * sequences must have the same length.  If any point lies outside the
+ * table the routine fails with #XLAL_EDOM and the corresponding elements
+ * of @p fstart are NAN.
+ */
+int XLALSimInspiralDurationTableStartFrequencyBatch(
+    REAL8Sequence *fstart,          /**< [out] starting frequencies (Hz) */
+    const LALSimInspiralDurationTable *table, /**< duration table */
+    const REAL8Sequence *tchirp,    /**< chirp times (s) */
+    const REAL8Sequence *m1,        /**< masses of the first component (kg) */
+    const REAL8Sequence *m2,        /**< masses of the second component (kg) */
+    const REAL8Sequence *chi        /**< effective aligned spins */
+)
+{
+    const size_t n = fstart ? fstart->length : 0;
+    REAL8 *restrict f;
+    const REAL8 *restrict t, *restrict ma, *restrict mb, *restrict s;
+
+    XLAL_CHECK(fstart && table && tchirp && m1 && m2 && chi, XLAL_EFAULT);
+    XLAL_CHECK(tchirp->length == n && m1->length == n && m2->length == n && chi->length == n, XLAL_EBADLEN);
+
+    f = fstart->data;
+    t = tchirp->data;
+    ma = m1->data;
+    mb = m2->data;
+    s = chi->data;
+    #pragma omp parallel for
+    for (size_t i = 0; i < n; ++i)
+        f[i] = duration_table_start_frequency(table, t[i], ma[i], mb[i], s[i]);
+
+    for (size_t i = 0; i < n; ++i)
+        if (isnan(f[i]))
+            XLAL_ERROR(XLAL_EDOM, "Element %zu (tchirp = %g, m1 = %g, m2 = %g, chi = %g) is outside the duration table", i, t[i], ma[i], mb[i], s[i]);
+
+    return XLAL_SUCCESS;
+}
+
+/** @} */
@@ -638,6 +638,9 @@ int XLALSimInspiralGeneratorAddConditioningForApproximant(LALSimInspiralGenerato
     } else if (internal_data->generator->generate_fd_waveform)
         generator->generate_td_waveform = generate_conditioned_td_waveform_from_fd;
 
+    /* conditioning is applied to double-precision waveforms only */
+    generator->generate_fd_waveform_single = NULL;
+
     if (internal_data->generator->generate_fd_waveform)
         generator->generate_fd_waveform = generate_conditioned_fd_waveform_from_fd;
     else if (internal_data->generator->generate_td_waveform)
@@ -170,6 +170,215 @@ static int generate_fd_waveform(
     return XLALSimInspiralChooseFDWaveform_legacy(hplus, hcross, m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, distance, inclination, phiRef, longAscNodes, eccentricity, meanPerAno, deltaF, f_min, f_max, f_ref, params, approximant);
 }
 
+/** Convert double-precision polarizations to single precision, consuming the inputs */
+static int convert_fd_waveform_to_single(
+    COMPLEX8FrequencySeries **hplus,
+    COMPLEX8FrequencySeries **hcross,
+    COMPLEX16FrequencySeries *hp,
+    COMPLEX16FrequencySeries *hc
+)
+{
+    *hplus = XLALCreateCOMPLEX8FrequencySeries(hp->name, &hp->epoch, hp->f0, hp->deltaF, &hp->sampleUnits, hp->data->length);
+    *hcross = XLALCreateCOMPLEX8FrequencySeries(hc->name, &hc->epoch, hc->f0, hc->deltaF, &hc->sampleUnits, hc->data->length);
+    if (!*hplus || !*hcross) {
+        XLALDestroyCOMPLEX8FrequencySeries(*hplus);
+        XLALDestroyCOMPLEX8FrequencySeries(*hcross);
+        *hplus = *hcross = NULL;
+        XLALDestroyCOMPLEX16FrequencySeries(hp);
+        XLALDestroyCOMPLEX16FrequencySeries(hc);
+        XLAL_ERROR(XLAL_EFUNC);
+    }
+    for (UINT4 j = 0; j < hp->data->length; j++)
+        (*hplus)->data->data[j] = hp->data->data[j];
+    for (UINT4 j = 0; j < hc->data->length; j++)
+        (*hcross)->data->data[j] = hc->data->data[j];
+    XLALDestroyCOMPLEX16FrequencySeries(hp);
+    XLALDestroyCOMPLEX16FrequencySeries(hc);
+    return 0;
+}
+
+/**
+ * Sanity checks of the Fourier domain waveform parameters shared by
+ * XLALSimInspiralChooseFDWaveform_legacy() and generate_fd_waveform_single():
+ * fails on testing-GR parameters for approximants that do not take them and
+ * only warns about unusual values of the others.  Messages carry the name
+ * func of the caller.
+ */
+static int check_fd_waveform_params(
+    const char *func,
+    REAL8 m1,
+    REAL8 m2,
+    REAL8 S1x,
+    REAL8 S1y,
+    REAL8 S1z,
+    REAL8 S2x,
+    REAL8 S2y,
+    REAL8 S2z,
+    REAL8 deltaF,
+    REAL8 f_min,
+    LALDict *params,
+    Approximant approximant
+)
+{
+    if (!XLALSimInspiralWaveformParamsNonGRAreDefault(params) && XLALSimInspiralApproximantAcceptTestGRParams(approximant) != LAL_SIM_INSPIRAL_TESTGR_PARAMS) {
+        XLALPrintError("XLAL Error - %s: Passed in non-NULL pointer to LALSimInspiralTestGRParam for an approximant that does not use LALSimInspiralTestGRParam\n", func);
+        XLAL_ERROR(XLAL_EINVAL);
+    }
+
+    /* General sanity check the input parameters - only give warnings! */
+    if (deltaF > 1.)
+        XLALPrintWarning("XLAL Warning - %s: Large value of deltaF = %e requested...This corresponds to a very short TD signal (with padding). Consider a smaller value.\n", func, deltaF);
+    if (deltaF < 1. / 4096.)
+        XLALPrintWarning("XLAL Warning - %s: Small value of deltaF = %e requested...This corresponds to a very long TD signal. Consider a larger value.\n", func, deltaF);
+    if (m1 < 0.09 * LAL_MSUN_SI)
+        XLALPrintWarning("XLAL Warning - %s: Small value of m1 = %e (kg) = %e (Msun) requested...Perhaps you have a unit conversion error?\n", func, m1, m1 / LAL_MSUN_SI);
+    if (m2 < 0.09 * LAL_MSUN_SI)
+        XLALPrintWarning("XLAL Warning - %s: Small value of m2 = %e (kg) = %e (Msun) requested...Perhaps you have a unit conversion error?\n", func, m2, m2 / LAL_MSUN_SI);
+    if (m1 + m2 > 1000. * LAL_MSUN_SI)
+        XLALPrintWarning("XLAL Warning - %s: Large value of total mass m1+m2 = %e (kg) = %e (Msun) requested...Signal not likely to be in band of ground-based detectors.\n", func, m1 + m2, (m1 + m2) / LAL_MSUN_SI);
+    if (S1x * S1x + S1y * S1y + S1z * S1z > 1.000001)
+        XLALPrintWarning("XLAL Warning - %s: S1 = (%e,%e,%e) with norm > 1 requested...Are you sure you want to violate the Kerr bound?\n", func, S1x, S1y, S1z);
+    if (S2x * S2x + S2y * S2y + S2z * S2z > 1.000001)
+        XLALPrintWarning("XLAL Warning - %s: S2 = (%e,%e,%e) with norm > 1 requested...Are you sure you want to violate the Kerr bound?\n", func, S2x, S2y, S2z);
+    if (f_min < 1.)
+        XLALPrintWarning("XLAL Warning - %s: Small value of fmin = %e requested...Check for errors, this could create a very long waveform.\n", func, f_min);
+    if (f_min > 40.000001)
+        XLALPrintWarning("XLAL Warning - %s: Large value of fmin = %e requested...Check for errors, the signal will start in band.\n", func, f_min);
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Fourier domain polarizations in single precision.
+ *
+ * The aligned-spin approximants registered with this method write h+ and hx
+ * straight into single-precision series, folding the inclination and
+ * polarization factors of XLALSimInspiralChooseFDWaveform_legacy() into the
+ * per-sample store.  Configurations that are only implemented in double
+ * precision are generated as usual and converted.
+ */
+static int generate_fd_waveform_single(
+    COMPLEX8FrequencySeries **hplus,
+    COMPLEX8FrequencySeries **hcross,
+    LALDict *params,
+    LALSimInspiralGenerator *myself
+)
+{
+    REAL8 m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, distance, inclination, phiRef, longAscNodes, eccentricity, meanPerAno, deltaF, f_min, f_max, f_ref;
+    REAL8 pfac, cfac;
+    COMPLEX16 plusFactor, crossFactor;
+    Approximant approximant;
+    int ret;
+
+    /* approximant for this generator */
+    approximant = *(Approximant *)myself->internal_data;
+
+    XLALSimInspiralParseDictionaryToChooseFDWaveform(&m1, &m2, &S1x, &S1y, &S1z, &S2x, &S2y, &S2z, &distance, &inclination, &phiRef, &longAscNodes, &eccentricity, &meanPerAno, &deltaF, &f_min, &f_max, &f_ref, params);
+
+    REAL8 lambda1 = XLALSimInspiralWaveformParamsLookupTidalLambda1(params);
+    REAL8 lambda2 = XLALSimInspiralWaveformParamsLookupTidalLambda2(params);
+
+    /* Only the multibanded IMRPhenomXHM sums its modes in single precision */
+    REAL8 resTest = XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(params);
+    if ((m1 + m2) / LAL_MSUN_SI > 500)
+        resTest = 0.;
+
+    /* the Lorentz-violating dispersion is applied to double-precision polarizations only */
+    if (XLALSimInspiralWaveformParamsLookupEnableLIV(params) || (approximant == IMRPhenomXHM && resTest == 0.)) {
+        COMPLEX16FrequencySeries *hp = NULL;
+        COMPLEX16FrequencySeries *hc = NULL;
+        ret = generate_fd_waveform(&hp, &hc, params, myself);
+        if (ret < 0) {
+            XLALDestroyCOMPLEX16FrequencySeries(hp);
+            XLALDestroyCOMPLEX16FrequencySeries(hc);
+            XLAL_ERROR(XLAL_EFUNC);
+        }
+        return convert_fd_waveform_to_single(hplus, hcross, hp, hc);
+    }
+
+    if (check_fd_waveform_params(__func__, m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, deltaF, f_min, params, approximant) < 0)
+        XLAL_ERROR(XLAL_EFUNC);
+
+    FIX_REFERENCE_FREQUENCY(f_ref, f_min, approximant);
+
+    /* hp = plusFactor * h and hc = crossFactor * h, including the rotation by longAscNodes */
+    cfac = cos(inclination);
+    pfac = 0.5 * (1. + cfac * cfac);
+    plusFactor = pfac;
+    crossFactor = -I * cfac;
+    if (approximant == IMRPhenomXAS) {
+        /* see the IMRPhenomXAS case of XLALSimInspiralChooseFDWaveform_legacy() */
+        COMPLEX16 Ylmfactor = 2.0 * sqrt(5.0 / (64.0 * LAL_PI)) * cexp(-I * 2 * (LAL_PI_2));
+        plusFactor *= Ylmfactor;
+        crossFactor *= Ylmfactor;
+    }
+    if (longAscNodes) {
+        COMPLEX16 tmpP = plusFactor;
+        COMPLEX16 tmpC = crossFactor;
+        plusFactor = cos(2. * longAscNodes) * tmpP + sin(2. * longAscNodes) * tmpC;
+        crossFactor = cos(2. * longAscNodes) * tmpC - sin(2. * longAscNodes) * tmpP;
+    }
+
+    switch (approximant) {
+    case TaylorF2:
+        if (!XLALSimInspiralWaveformParamsFrameAxisIsDefault(params))
+            XLAL_ERROR(XLAL_EINVAL, "Non-default LALSimInspiralFrameAxis provided, but this approximant does not use that flag.");
+        if (!XLALSimInspiralWaveformParamsModesChoiceIsDefault(params))
+            XLAL_ERROR(XLAL_EINVAL, "Non-default LALSimInspiralModesChoice provided, but this approximant does not use that flag.");
+        if (!checkTransverseSpinsZero(S1x, S1y, S2x, S2y))
+            XLAL_ERROR(XLAL_EINVAL, "Non-zero transverse spins were given, but this is a non-precessing approximant.");
+        ret = XLALSimInspiralTaylorF2COMPLEX8(hplus, hcross, phiRef, deltaF, m1, m2, S1z, S2z, f_min, f_max, f_ref, distance, plusFactor, crossFactor, params);
+        break;
+
+    case IMRPhenomD:
+        if (!XLALSimInspiralWaveformParamsFlagsAreDefault(params))
+            XLAL_ERROR(XLAL_EINVAL, "Non-default flags given, but this approximant does not support this case.");
+        if (!checkTransverseSpinsZero(S1x, S1y, S2x, S2y))
+            XLAL_ERROR(XLAL_EINVAL, "Non-zero transverse spins were given, but this is a non-precessing approximant.");
+        if (!checkTidesZero(lambda1, lambda2))
+            XLAL_ERROR(XLAL_EINVAL, "Non-zero tidal parameters were given, but this is approximant doe not have tidal corrections.");
+        ret = XLALSimIMRPhenomDGenerateFDCOMPLEX8(hplus, hcross, phiRef, f_ref, deltaF, m1, m2, S1z, S2z, f_min, f_max, distance, plusFactor, crossFactor, params, NoNRT_V);
+        break;
+
+    case IMRPhenomXAS:
+        if (!XLALSimInspiralWaveformParamsFlagsAreDefault(params))
+            XLAL_ERROR(XLAL_EINVAL, "Non-default flags given, but this approximant does not support this case.");
+        if (!checkTransverseSpinsZero(S1x, S1y, S2x, S2y))
+            XLAL_ERROR(XLAL_EINVAL, "Non-zero transverse spins were given, but this is a non-precessing approximant.");
+        if (!checkTidesZero(lambda1, lambda2))
+            XLAL_ERROR(XLAL_EINVAL, "Non-zero tidal parameters were given, but this is approximant doe not have tidal corrections.");
+        ret = XLALSimIMRPhenomXASGenerateFDCOMPLEX8(hplus, hcross, m1, m2, S1z, S2z, distance, f_min, f_max, deltaF, phiRef, f_ref, plusFactor, crossFactor, params);
+        break;
+
+    case IMRPhenomXHM:
+        if (!XLALSimInspiralWaveformParamsFlagsAreDefault(params))
+            XLAL_ERROR(XLAL_EINVAL, "Non-default flags given, but this approximant does not support this case.");
+        if (!checkTransverseSpinsZero(S1x, S1y, S2x, S2y))
+            XLAL_ERROR(XLAL_EINVAL, "Non-zero transverse spins were given, but this is a non-precessing approximant.");
+        if (!checkTidesZero(lambda1, lambda2))
+            XLAL_ERROR(XLAL_EINVAL, "Non-zero tidal parameters were given, but this is approximant doe not have tidal corrections.");
+        /* the inclination enters through the spherical harmonics, so only the polarization rotation is left */
+        ret = XLALSimIMRPhenomXHMCOMPLEX8(hplus, hcross, m1, m2, S1z, S2z, f_min, f_max, deltaF, distance, inclination, phiRef, f_ref, params);
+        if (ret != XLAL_FAILURE && longAscNodes) {
+            for (UINT4 idx = 0; idx < (*hplus)->data->length; idx++) {
+                COMPLEX16 tmpP = (*hplus)->data->data[idx];
+                COMPLEX16 tmpC = (*hcross)->data->data[idx];
+                (*hplus)->data->data[idx] = cos(2. * longAscNodes) * tmpP + sin(2. * longAscNodes) * tmpC;
+                (*hcross)->data->data[idx] = cos(2. * longAscNodes) * tmpC - sin(2. * longAscNodes) * tmpP;
+            }
+        }
+        break;
+
+    default:
+        XLALPrintError("FD version of approximant not implemented in lalsimulation\n");
+        XLAL_ERROR(XLAL_EINVAL);
+    }
+
+    if (ret == XLAL_FAILURE)
+        XLAL_ERROR(XLAL_EFUNC);
+
+    return ret;
+}
+
 /** Time domain modes */
 static int generate_td_modes(
     SphHarmTimeSeries **hlm,
@@ -228,6 +437,21 @@ static int generate_td_waveform(
         .internal_data = &_lal ## approx ## GeneratorInternalData \
     };
 
+/* as above, for approximants that can also write single-precision FD polarizations */
+#define DEFINE_GENERATOR_TEMPLATE_SINGLE(approx, fd_modes, fd_waveform, fd_waveform_single, td_modes, td_waveform) \
+    static Approximant _lal ## approx ## GeneratorInternalData = approx; \
+    const LALSimInspiralGenerator lal ## approx ## GeneratorTemplate = { \
+        .name = #approx,  \
+        .initialize = initialize, \
+        .finalize = NULL, \
+        .generate_fd_modes = fd_modes, \
+        .generate_fd_waveform = fd_waveform, \
+        .generate_td_modes = td_modes, \
+        .generate_td_waveform = td_waveform, \
+        .generate_fd_waveform_single = fd_waveform_single, \
+        .internal_data = &_lal ## approx ## GeneratorInternalData \
+    };
+
 /* TD POLARIZATIONS ONLY */
 DEFINE_GENERATOR_TEMPLATE(EccentricTD, NULL, NULL, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(HGimri, NULL, NULL, NULL, generate_td_waveform)
@@ -292,7 +516,7 @@ DEFINE_GENERATOR_TEMPLATE(SEOBNRv4_ROM_NRTidal, NULL, generate_fd_waveform, NULL
 DEFINE_GENERATOR_TEMPLATE(SpinTaylorF2, NULL, generate_fd_waveform, NULL, NULL)
 DEFINE_GENERATOR_TEMPLATE(SpinTaylorT4Fourier, NULL, generate_fd_waveform, NULL, NULL)
 DEFINE_GENERATOR_TEMPLATE(SpinTaylorT5Fourier, NULL, generate_fd_waveform, NULL, NULL)
-DEFINE_GENERATOR_TEMPLATE(TaylorF2, NULL, generate_fd_waveform, NULL, NULL)
+DEFINE_GENERATOR_TEMPLATE_SINGLE(TaylorF2, NULL, generate_fd_waveform, generate_fd_waveform_single, NULL, NULL)
 DEFINE_GENERATOR_TEMPLATE(TaylorF2Ecc, NULL, generate_fd_waveform, NULL, NULL)
 DEFINE_GENERATOR_TEMPLATE(TaylorF2NLTides, NULL, generate_fd_waveform, NULL, NULL)
 DEFINE_GENERATOR_TEMPLATE(TaylorF2RedSpin, NULL, generate_fd_waveform, NULL, NULL)
@@ -307,7 +531,7 @@ DEFINE_GENERATOR_TEMPLATE(SEOBNRv5_ROM, generate_fd_modes, generate_fd_waveform,
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomA, NULL, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomB, NULL, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomC, NULL, generate_fd_waveform, NULL, generate_td_waveform)
-DEFINE_GENERATOR_TEMPLATE(IMRPhenomD, NULL, generate_fd_waveform, NULL, generate_td_waveform)
+DEFINE_GENERATOR_TEMPLATE_SINGLE(IMRPhenomD, NULL, generate_fd_waveform, generate_fd_waveform_single, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomD_NRTidalv2, NULL, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomNSBH, NULL, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomPv2, NULL, generate_fd_waveform, NULL, generate_td_waveform)
@@ -315,7 +539,7 @@ DEFINE_GENERATOR_TEMPLATE(IMRPhenomPv2_NRTidal, NULL, generate_fd_waveform, NULL
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomPv2_NRTidalv2, NULL, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomPv3, NULL, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomPv3HM, NULL, generate_fd_waveform, NULL, generate_td_waveform)
-DEFINE_GENERATOR_TEMPLATE(IMRPhenomXAS, NULL, generate_fd_waveform, NULL, generate_td_waveform)
+DEFINE_GENERATOR_TEMPLATE_SINGLE(IMRPhenomXAS, NULL, generate_fd_waveform, generate_fd_waveform_single, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomXP, NULL, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomXAS_NRTidalv2, NULL, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomXP_NRTidalv2, NULL, generate_fd_waveform, NULL, generate_td_waveform)
@@ -324,7 +548,7 @@ DEFINE_GENERATOR_TEMPLATE(SEOBNRv4_ROM_NRTidalv2_NSBH, NULL, generate_fd_wavefor
 
 /* TD POLARIZATIONS AND FD POLARIZATIONS AND MODES ONLY */
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomHM, generate_fd_modes, generate_fd_waveform, NULL, generate_td_waveform)
-DEFINE_GENERATOR_TEMPLATE(IMRPhenomXHM, generate_fd_modes, generate_fd_waveform, NULL, generate_td_waveform)
+DEFINE_GENERATOR_TEMPLATE_SINGLE(IMRPhenomXHM, generate_fd_modes, generate_fd_waveform, generate_fd_waveform_single, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomXPHM, generate_fd_modes, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(IMRPhenomXO4a, generate_fd_modes, generate_fd_waveform, NULL, generate_td_waveform)
 DEFINE_GENERATOR_TEMPLATE(SEOBNRv5HM_ROM, generate_fd_modes, generate_fd_waveform, NULL, generate_td_waveform)
@@ -1307,30 +1531,8 @@ static int XLALSimInspiralChooseFDWaveform_legacy(
      * If non-GR approximants are added, include them in
      * XLALSimInspiralApproximantAcceptTestGRParams()
      */
-    if (!XLALSimInspiralWaveformParamsNonGRAreDefault(params) && XLALSimInspiralApproximantAcceptTestGRParams(approximant) != LAL_SIM_INSPIRAL_TESTGR_PARAMS) {
-        XLALPrintError("XLAL Error - %s: Passed in non-NULL pointer to LALSimInspiralTestGRParam for an approximant that does not use LALSimInspiralTestGRParam\n", __func__);
-        XLAL_ERROR(XLAL_EINVAL);
-    }
-
-    /* General sanity check the input parameters - only give warnings! */
-    if (deltaF > 1.)
-        XLALPrintWarning("XLAL Warning - %s: Large value of deltaF = %e requested...This corresponds to a very short TD signal (with padding). Consider a smaller value.\n", __func__, deltaF);
-    if (deltaF < 1. / 4096.)
-        XLALPrintWarning("XLAL Warning - %s: Small value of deltaF = %e requested...This corresponds to a very long TD signal. Consider a larger value.\n", __func__, deltaF);
-    if (m1 < 0.09 * LAL_MSUN_SI)
-        XLALPrintWarning("XLAL Warning - %s: Small value of m1 = %e (kg) = %e (Msun) requested...Perhaps you have a unit conversion error?\n", __func__, m1, m1 / LAL_MSUN_SI);
-    if (m2 < 0.09 * LAL_MSUN_SI)
-        XLALPrintWarning("XLAL Warning - %s: Small value of m2 = %e (kg) = %e (Msun) requested...Perhaps you have a unit conversion error?\n", __func__, m2, m2 / LAL_MSUN_SI);
-    if (m1 + m2 > 1000. * LAL_MSUN_SI)
-        XLALPrintWarning("XLAL Warning - %s: Large value of total mass m1+m2 = %e (kg) = %e (Msun) requested...Signal not likely to be in band of ground-based detectors.\n", __func__, m1 + m2, (m1 + m2) / LAL_MSUN_SI);
-    if (S1x * S1x + S1y * S1y + S1z * S1z > 1.000001)
-        XLALPrintWarning("XLAL Warning - %s: S1 = (%e,%e,%e) with norm > 1 requested...Are you sure you want to violate the Kerr bound?\n", __func__, S1x, S1y, S1z);
-    if (S2x * S2x + S2y * S2y + S2z * S2z > 1.000001)
-        XLALPrintWarning("XLAL Warning - %s: S2 = (%e,%e,%e) with norm > 1 requested...Are you sure you want to violate the Kerr bound?\n", __func__, S2x, S2y, S2z);
-    if (f_min < 1.)
-        XLALPrintWarning("XLAL Warning - %s: Small value of fmin = %e requested...Check for errors, this could create a very long waveform.\n", __func__, f_min);
-    if (f_min > 40.000001)
-        XLALPrintWarning("XLAL Warning - %s: Large value of fmin = %e requested...Check for errors, the signal will start in band.\n", __func__, f_min);
+    if (check_fd_waveform_params(__func__, m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, deltaF, f_min, params, approximant) < 0)
+        XLAL_ERROR(XLAL_EFUNC);
 
     /* adjust the reference frequency for certain precessing approximants:
      * if that approximate interprets f_ref==0 to be f_min, set f_ref=f_min;
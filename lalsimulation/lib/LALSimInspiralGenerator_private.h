@@ -40,6 +40,14 @@ struct tagLALSimInspiralGenerator {
         LALSimInspiralGenerator *myself
     );
 
+    /* optional: single-precision polarizations written directly by the model */
+    int (*generate_fd_waveform_single) (
+        COMPLEX8FrequencySeries **hplus,
+        COMPLEX8FrequencySeries **hcross,
+        LALDict *params,
+        LALSimInspiralGenerator *myself
+    );
+
     /* ... */
     void *internal_data;
 };
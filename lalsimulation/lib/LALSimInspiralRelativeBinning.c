@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <math.h>
+#include <string.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Sequence.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralRelativeBinning.h>
+
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
+/**
+ * @addtogroup LALSimInspiralRelativeBinning_h
+ * @{
+ */
+
+/* check that bin edges are strictly increasing and define at least one bin */
+static int RelativeBinningCheckEdges(const REAL8Sequence *binEdges)
+{
+    XLAL_CHECK(binEdges && binEdges->data, XLAL_EFAULT);
+    XLAL_CHECK(binEdges->length >= 2, XLAL_EINVAL, "At least two bin edges are required");
+    for (UINT4 b = 1; b < binEdges->length; b++)
+        XLAL_CHECK(binEdges->data[b] > binEdges->data[b - 1], XLAL_EINVAL, "Bin edges must be strictly increasing");
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Evaluate a fiducial waveform at the given bin edges with
+ * XLALSimInspiralChooseFDWaveformSequence().  The bin edges are copied.
+ */
+LALSimInspiralRelativeBinningFiducial *XLALSimInspiralRelativeBinningFiducialCreate(
+    const REAL8Sequence *binEdges,      /**< increasing bin edge frequencies (Hz) */
+    REAL8 phiRef,                       /**< reference orbital phase (rad) */
+    REAL8 m1,                           /**< mass of companion 1 (kg) */
+    REAL8 m2,                           /**< mass of companion 2 (kg) */
+    REAL8 S1x,                          /**< x-component of the dimensionless spin of object 1 */
+    REAL8 S1y,                          /**< y-component of the dimensionless spin of object 1 */
+    REAL8 S1z,                          /**< z-component of the dimensionless spin of object 1 */
+    REAL8 S2x,                          /**< x-component of the dimensionless spin of object 2 */
+    REAL8 S2y,                          /**< y-component of the dimensionless spin of object 2 */
+    REAL8 S2z,                          /**< z-component of the dimensionless spin of object 2 */
+    REAL8 f_ref,                        /**< reference frequency (Hz) */
+    REAL8 distance,                     /**< distance of source (m) */
+    REAL8 inclination,                  /**< inclination of source (rad) */
+    LALDict *LALpars,                   /**< LALDictionary containing non-mandatory variables/flags */
+    Approximant approximant             /**< frequency-domain approximant */
+)
+{
+    LALSimInspiralRelativeBinningFiducial *fiducial = NULL;
+    COMPLEX16FrequencySeries *hptilde = NULL;
+    COMPLEX16FrequencySeries *hctilde = NULL;
+
+    XLAL_CHECK_NULL(RelativeBinningCheckEdges(binEdges) == XLAL_SUCCESS, XLAL_EFUNC);
+
+    fiducial = XLALCalloc(1, sizeof(*fiducial));
+    XLAL_CHECK_NULL(fiducial, XLAL_ENOMEM);
+
+    fiducial->binEdges = XLALCreateREAL8Sequence(binEdges->length);
+    if (!fiducial->binEdges)
+        goto fail;
+    memcpy(fiducial->binEdges->data, binEdges->data, binEdges->length * sizeof(*binEdges->data));
+
+    if (XLALSimInspiralChooseFDWaveformSequence(&hptilde, &hctilde, phiRef, m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_ref, distance, inclination, LALpars, approximant, fiducial->binEdges) < 0)
+        goto fail;
+
+    if (hptilde->data->length < binEdges->length || hctilde->data->length < binEdges->length) {
+        XLALPrintError("XLAL Error - %s: model returned fewer samples than bin edges\n", __func__);
+        goto fail;
+    }
+    fiducial->h0plus = XLALCreateCOMPLEX16Sequence(binEdges->length);
+    fiducial->h0cross = XLALCreateCOMPLEX16Sequence(binEdges->length);
+    if (!fiducial->h0plus || !fiducial->h0cross)
+        goto fail;
+    memcpy(fiducial->h0plus->data, hptilde->data->data, binEdges->length * sizeof(COMPLEX16));
+    memcpy(fiducial->h0cross->data, hctilde->data->data, binEdges->length * sizeof(COMPLEX16));
+
+    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    return fiducial;
+
+fail:
+    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    XLALSimInspiralRelativeBinningFiducialDestroy(fiducial);
+    XLAL_ERROR_NULL(XLAL_EFUNC);
+}
+
+/** Destroy a fiducial waveform created by XLALSimInspiralRelativeBinningFiducialCreate() */
+void XLALSimInspiralRelativeBinningFiducialDestroy(LALSimInspiralRelativeBinningFiducial *fiducial)
+{
+    if (!fiducial)
+        return;
+    XLALDestroyREAL8Sequence(fiducial->binEdges);
+    XLALDestroyCOMPLEX16Sequence(fiducial->h0plus);
+    XLALDestroyCOMPLEX16Sequence(fiducial->h0cross);
+    XLALFree(fiducial);
+}
+
+/**
+ * Compute the relative binning summary data of a fiducial waveform h0
+ * against data d with one-sided PSD S.
+ *
+ * The data, fiducial waveform and PSD must share the same frequency
+ * sampling.  Each frequency sample belongs to the bin \f$[f_b, f_{b+1})\f$
+ * containing it, with the last bin closed at \f$f_B\f$; samples outside
+ * the bins and samples with a non-positive PSD are ignored.
+ */
+LALSimInspiralRelativeBinningSummary *XLALSimInspiralRelativeBinningSummaryCreate(
+    const REAL8Sequence *binEdges,          /**< increasing bin edge frequencies (Hz) */
+    const COMPLEX16FrequencySeries *data,   /**< frequency-domain data d */
+    const COMPLEX16FrequencySeries *h0,     /**< fiducial waveform on the same grid as the data */
+    const REAL8FrequencySeries *psd         /**< one-sided noise PSD on the same grid as the data */
+)
+{
+    LALSimInspiralRelativeBinningSummary *summary = NULL;
+
+    XLAL_CHECK_NULL(RelativeBinningCheckEdges(binEdges) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_NULL(data && h0 && psd, XLAL_EFAULT);
+    XLAL_CHECK_NULL(data->deltaF > 0, XLAL_EINVAL, "Non-positive frequency spacing");
+    XLAL_CHECK_NULL(fabs(h0->deltaF - data->deltaF) <= 1e-9 * data->deltaF && fabs(psd->deltaF - data->deltaF) <= 1e-9 * data->deltaF, XLAL_EINVAL, "Frequency spacings of data, fiducial waveform and PSD differ");
+    XLAL_CHECK_NULL(fabs(h0->f0 - data->f0) <= 1e-9 * data->deltaF && fabs(psd->f0 - data->f0) <= 1e-9 * data->deltaF, XLAL_EINVAL, "Start frequencies of data, fiducial waveform and PSD differ");
+
+    const UINT4 nbins = binEdges->length - 1;
+    const REAL8 f0 = data->f0;
+    const REAL8 deltaF = data->deltaF;
+    UINT4 n = data->data->length;
+    if (h0->data->length < n)
+        n = h0->data->length;
+    if (psd->data->length < n)
+        n = psd->data->length;
+
+    summary = XLALCalloc(1, sizeof(*summary));
+    XLAL_CHECK_NULL(summary, XLAL_ENOMEM);
+    summary->binEdges = XLALCreateREAL8Sequence(binEdges->length);
+    summary->A0 = XLALCreateCOMPLEX16Sequence(nbins);
+    summary->A1 = XLALCreateCOMPLEX16Sequence(nbins);
+    summary->B0 = XLALCreateREAL8Sequence(nbins);
+    summary->B1 = XLALCreateREAL8Sequence(nbins);
+    if (!summary->binEdges || !summary->A0 || !summary->A1 || !summary->B0 || !summary->B1) {
+        XLALSimInspiralRelativeBinningSummaryDestroy(summary);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    memcpy(summary->binEdges->data, binEdges->data, binEdges->length * sizeof(*binEdges->data));
+
+    /* bins are independent: each owns the samples k with f_b <= f_k < f_{b+1} */
+    #pragma omp parallel for schedule(dynamic)
+    for (UINT4 b = 0; b < nbins; b++) {
+        const REAL8 fc = 0.5 * (binEdges->data[b] + binEdges->data[b + 1]);
+        REAL8 klo = ceil((binEdges->data[b] - f0) / deltaF);
+        REAL8 khi = (b + 1 == nbins) ? floor((binEdges->data[b + 1] - f0) / deltaF) + 1. : ceil((binEdges->data[b + 1] - f0) / deltaF);
+        COMPLEX16 a0 = 0., a1 = 0.;
+        REAL8 b0 = 0., b1 = 0.;
+
+        if (klo < 0.)
+            klo = 0.;
+        if (khi > n)
+            khi = n;
+        for (UINT4 k = (UINT4) klo; k < khi; k++) {
+            const REAL8 S = psd->data->data[k];
+            if (!(S > 0.))
+                continue;
+            const REAL8 df = f0 + k * deltaF - fc;
+            const COMPLEX16 dh0 = conj(data->data->data[k]) * h0->data->data[k] / S;
+            const REAL8 h0h0 = (creal(h0->data->data[k]) * creal(h0->data->data[k]) + cimag(h0->data->data[k]) * cimag(h0->data->data[k])) / S;
+            a0 += dh0;
+            a1 += dh0 * df;
+            b0 += h0h0;
+            b1 += h0h0 * df;
+        }
+
+        summary->A0->data[b] = 4. * deltaF * a0;
+        summary->A1->data[b] = 4. * deltaF * a1;
+        summary->B0->data[b] = 4. * deltaF * b0;
+        summary->B1->data[b] = 4. * deltaF * b1;
+    }
+
+    return summary;
+}
+
+/** Destroy summary data created by XLALSimInspiralRelativeBinningSummaryCreate() */
+void XLALSimInspiralRelativeBinningSummaryDestroy(LALSimInspiralRelativeBinningSummary *summary)
+{
+    if (!summary)
+        return;
+    XLALDestroyREAL8Sequence(summary->binEdges);
+    XLALDestroyCOMPLEX16Sequence(summary->A0);
+    XLALDestroyCOMPLEX16Sequence(summary->A1);
+    XLALDestroyREAL8Sequence(summary->B0);
+    XLALDestroyREAL8Sequence(summary->B1);
+    XLALFree(summary);
+}
+
+/**
+ * Compute the per-bin linear coefficients of the ratio h/h0 from the two
+ * waveforms at the bin edges: r0 is the ratio at the bin centre and r1
+ * its slope in frequency.  Edges at which h0 vanishes contribute a zero
+ * ratio.  This is the kernel of
+ * XLALSimInspiralRelativeBinningCoefficients(); it can be applied directly
+ * to detector-projected, time-shifted waveforms.
+ */
+int XLALSimInspiralRelativeBinningRatio(
+    COMPLEX16Sequence *r0,              /**< [out] ratio at bin centres, one per bin */
+    COMPLEX16Sequence *r1,              /**< [out] slope of the ratio (1/Hz), one per bin */
+    const COMPLEX16Sequence *h,         /**< waveform at the bin edges */
+    const COMPLEX16Sequence *h0,        /**< fiducial waveform at the bin edges */
+    const REAL8Sequence *binEdges       /**< increasing bin edge frequencies (Hz) */
+)
+{
+    XLAL_CHECK(RelativeBinningCheckEdges(binEdges) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(r0 && r1 && h && h0, XLAL_EFAULT);
+    XLAL_CHECK(h->length == binEdges->length && h0->length == binEdges->length, XLAL_EBADLEN, "Waveforms must be given at every bin edge");
+    XLAL_CHECK(r0->length == binEdges->length - 1 && r1->length == binEdges->length - 1, XLAL_EBADLEN, "Need one coefficient per bin");
+
+    const UINT4 nbins = binEdges->length - 1;
+    COMPLEX16 rlo = h0->data[0] != 0. ? h->data[0] / h0->data[0] : 0.;
+    for (UINT4 b = 0; b < nbins; b++) {
+        const COMPLEX16 rhi = h0->data[b + 1] != 0. ? h->data[b + 1] / h0->data[b + 1] : 0.;
+        r0->data[b] = 0.5 * (rlo + rhi);
+        r1->data[b] = (rhi - rlo) / (binEdges->data[b + 1] - binEdges->data[b]);
+        rlo = rhi;
+    }
+
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Compute the relative binning coefficients of both polarizations of a
+ * waveform with respect to a fiducial waveform.  The waveform is only
+ * evaluated at the bin edges of the fiducial, using
+ * XLALSimInspiralChooseFDWaveformSequence(), so any approximant supported
+ * there can be used.
+ */
+int XLALSimInspiralRelativeBinningCoefficients(
+    COMPLEX16Sequence **r0plus,         /**< [out] h+/h0+ at bin centres */
+    COMPLEX16Sequence **r1plus,         /**< [out] slope of h+/h0+ (1/Hz) */
+    COMPLEX16Sequence **r0cross,        /**< [out] hx/h0x at bin centres */
+    COMPLEX16Sequence **r1cross,        /**< [out] slope of hx/h0x (1/Hz) */
+    const LALSimInspiralRelativeBinningFiducial *fiducial, /**< fiducial waveform at the bin edges */
+    REAL8 phiRef,                       /**< reference orbital phase (rad) */
+    REAL8 m1,                           /**< mass of companion 1 (kg) */
+    REAL8 m2,                           /**< mass of companion 2 (kg) */
+    REAL8 S1x,                          /**< x-component of the dimensionless spin of object 1 */
+    REAL8 S1y,                          /**< y-component of the dimensionless spin of object 1 */
+    REAL8 S1z,                          /**< z-component of the dimensionless spin of object 1 */
+    REAL8 S2x,                          /**< x-component of the dimensionless spin of object 2 */
+    REAL8 S2y,                          /**< y-component of the dimensionless spin of object 2 */
+    REAL8 S2z,                          /**< z-component of the dimensionless spin of object 2 */
+    REAL8 f_ref,                        /**< reference frequency (Hz) */
+    REAL8 distance,                     /**< distance of source (m) */
+    REAL8 inclination,                  /**< inclination of source (rad) */
+    LALDict *LALpars,                   /**< LALDictionary containing non-mandatory variables/flags */
+    Approximant approximant             /**< frequency-domain approximant */
+)
+{
+    COMPLEX16FrequencySeries *hptilde = NULL;
+    COMPLEX16FrequencySeries *hctilde = NULL;
+    COMPLEX16Sequence hp, hc;
+
+    XLAL_CHECK(r0plus && r1plus && r0cross && r1cross, XLAL_EFAULT);
+    XLAL_CHECK(!*r0plus && !*r1plus && !*r0cross && !*r1cross, XLAL_EFAULT);
+    XLAL_CHECK(fiducial && fiducial->binEdges && fiducial->h0plus && fiducial->h0cross, XLAL_EFAULT);
+
+    const UINT4 nedges = fiducial->binEdges->length;
+    XLAL_CHECK(XLALSimInspiralChooseFDWaveformSequence(&hptilde, &hctilde, phiRef, m1, m2, S1x, S1y, S1z, S2x, S2y, S2z, f_ref, distance, inclination, LALpars, approximant, fiducial->binEdges) == XLAL_SUCCESS, XLAL_EFUNC);
+
+    *r0plus = XLALCreateCOMPLEX16Sequence(nedges - 1);
+    *r1plus = XLALCreateCOMPLEX16Sequence(nedges - 1);
+    *r0cross = XLALCreateCOMPLEX16Sequence(nedges - 1);
+    *r1cross = XLALCreateCOMPLEX16Sequence(nedges - 1);
+    if (!*r0plus || !*r1plus || !*r0cross || !*r1cross)
+        goto fail;
+
+    if (hptilde->data->length < nedges || hctilde->data->length < nedges)
+        goto fail;
+
+    /* the sequences are wrapped since the model may pad its output beyond the requested frequencies */
+    hp.length = hc.length = nedges;
+    hp.data = hptilde->data->data;
+    hc.data = hctilde->data->data;
+    if (XLALSimInspiralRelativeBinningRatio(*r0plus, *r1plus, &hp, fiducial->h0plus, fiducial->binEdges) != XLAL_SUCCESS)
+        goto fail;
+    if (XLALSimInspiralRelativeBinningRatio(*r0cross, *r1cross, &hc, fiducial->h0cross, fiducial->binEdges) != XLAL_SUCCESS)
+        goto fail;
+
+    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    return XLAL_SUCCESS;
+
+fail:
+    XLALDestroyCOMPLEX16FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX16FrequencySeries(hctilde);
+    XLALDestroyCOMPLEX16Sequence(*r0plus);
+    XLALDestroyCOMPLEX16Sequence(*r1plus);
+    XLALDestroyCOMPLEX16Sequence(*r0cross);
+    XLALDestroyCOMPLEX16Sequence(*r1cross);
+    *r0plus = *r1plus = *r0cross = *r1cross = NULL;
+    XLAL_ERROR(XLAL_EFUNC);
+}
+
+/**
+ * Evaluate the inner products \f$\langle d|h\rangle\f$ and
+ * \f$\langle h|h\rangle\f$ of a waveform described by its relative binning
+ * coefficients, using the summary data of the fiducial waveform.  The
+ * real part of dh is the usual noise-weighted inner product; the full
+ * complex value is returned for phase marginalisation.
+ */
+int XLALSimInspiralRelativeBinningInnerProducts(
+    COMPLEX16 *dh,                      /**< [out] sum_b A0 r0 + A1 r1 */
+    REAL8 *hh,                          /**< [out] sum_b B0 |r0|^2 + 2 B1 Re(r0 r1^*) */
+    const LALSimInspiralRelativeBinningSummary *summary, /**< fiducial summary data */
+    const COMPLEX16Sequence *r0,        /**< ratio at bin centres */
+    const COMPLEX16Sequence *r1         /**< slope of the ratio (1/Hz) */
+)
+{
+    XLAL_CHECK(dh && hh && summary && r0 && r1, XLAL_EFAULT);
+    XLAL_CHECK(r0->length == summary->A0->length && r1->length == summary->A0->length, XLAL_EBADLEN, "Need one coefficient per bin");
+
+    COMPLEX16 sdh = 0.;
+    REAL8 shh = 0.;
+    for (UINT4 b = 0; b < r0->length; b++) {
+        const COMPLEX16 a = r0->data[b];
+        const COMPLEX16 s = r1->data[b];
+        sdh += summary->A0->data[b] * a + summary->A1->data[b] * s;
+        shh += summary->B0->data[b] * (creal(a) * creal(a) + cimag(a) * cimag(a)) + 2. * summary->B1->data[b] * (creal(a) * creal(s) + cimag(a) * cimag(s));
+    }
+    *dh = sdh;
+    *hh = shh;
+
+    return XLAL_SUCCESS;
+}
+
+/** @} */
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#ifndef _LALSIMINSPIRALRELATIVEBINNING_H
+#define _LALSIMINSPIRALRELATIVEBINNING_H
+
+#include <lal/LALDatatypes.h>
+#include <lal/LALDict.h>
+#include <lal/LALSimInspiral.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#elif 0
+} /* so that editors will match preceding brace */
+#endif
+
+/**
+ * @defgroup LALSimInspiralRelativeBinning_h Header LALSimInspiralRelativeBinning.h
+ * @ingroup lalsimulation_inspiral
+ *
+ * @brief Relative binning (heterodyning) of frequency-domain waveforms.
+ *
+ * @details
+ * A waveform h(f) that is close to a fiducial waveform h0(f) is represented
+ * on a set of bins \f$[f_b, f_{b+1}]\f$ by the linear approximation
+ * \f[
+ * h(f)/h_0(f) \approx r_0^{(b)} + r_1^{(b)} (f - f_c^{(b)}),
+ * \f]
+ * where \f$f_c^{(b)}\f$ is the centre of bin b.  The coefficients only
+ * require the waveform at the bin edges, which any model supporting
+ * XLALSimInspiralChooseFDWaveformSequence() can provide.  Combined with
+ * per-bin summary data of the fiducial waveform against the data, the
+ * inner products \f$\langle d|h\rangle\f$ and \f$\langle h|h\rangle\f$
+ * then cost O(number of bins) rather than O(number of frequency samples);
+ * see arXiv:1806.08792 and arXiv:2109.02728.
+ *
+ * @{
+ */
+
+/**
+ * Fiducial waveform evaluated at the bin edges.
+ */
+typedef struct tagLALSimInspiralRelativeBinningFiducial {
+    REAL8Sequence *binEdges;    /**< increasing bin edge frequencies f_0 < ... < f_B (Hz) */
+    COMPLEX16Sequence *h0plus;  /**< fiducial h+ at the bin edges */
+    COMPLEX16Sequence *h0cross; /**< fiducial hx at the bin edges */
+} LALSimInspiralRelativeBinningFiducial;
+
+/**
+ * Per-bin summary data of a fiducial waveform h0 against data d with
+ * one-sided noise PSD S, such that with the ratio coefficients r0, r1
+ * of a waveform h
+ * \f$\langle d|h\rangle \approx \Re \sum_b (A_0 r_0 + A_1 r_1)\f$ and
+ * \f$\langle h|h\rangle \approx \sum_b (B_0 |r_0|^2 + 2 B_1 \Re(r_0 r_1^*))\f$.
+ */
+typedef struct tagLALSimInspiralRelativeBinningSummary {
+    REAL8Sequence *binEdges;    /**< increasing bin edge frequencies f_0 < ... < f_B (Hz) */
+    COMPLEX16Sequence *A0;      /**< 4 df sum d^* h0 / S over each bin */
+    COMPLEX16Sequence *A1;      /**< 4 df sum d^* h0 (f - f_c) / S over each bin */
+    REAL8Sequence *B0;          /**< 4 df sum |h0|^2 / S over each bin */
+    REAL8Sequence *B1;          /**< 4 df sum |h0|^2 (f - f_c) / S over each bin */
+} LALSimInspiralRelativeBinningSummary;
+
+/** @} */
+
+LALSimInspiralRelativeBinningFiducial *XLALSimInspiralRelativeBinningFiducialCreate(const REAL8Sequence *binEdges, REAL8 phiRef, REAL8 m1, REAL8 m2, REAL8 S1x, REAL8 S1y, REAL8 S1z, REAL8 S2x, REAL8 S2y, REAL8 S2z, REAL8 f_ref, REAL8 distance, REAL8 inclination, LALDict *LALpars, Approximant approximant);
+void XLALSimInspiralRelativeBinningFiducialDestroy(LALSimInspiralRelativeBinningFiducial *fiducial);
+
+LALSimInspiralRelativeBinningSummary *XLALSimInspiralRelativeBinningSummaryCreate(const REAL8Sequence *binEdges, const COMPLEX16FrequencySeries *data, const COMPLEX16FrequencySeries *h0, const REAL8FrequencySeries *psd);
+void XLALSimInspiralRelativeBinningSummaryDestroy(LALSimInspiralRelativeBinningSummary *summary);
+
+int XLALSimInspiralRelativeBinningRatio(COMPLEX16Sequence *r0, COMPLEX16Sequence *r1, const COMPLEX16Sequence *h, const COMPLEX16Sequence *h0, const REAL8Sequence *binEdges);
+int XLALSimInspiralRelativeBinningCoefficients(COMPLEX16Sequence **r0plus, COMPLEX16Sequence **r1plus, COMPLEX16Sequence **r0cross, COMPLEX16Sequence **r1cross, const LALSimInspiralRelativeBinningFiducial *fiducial, REAL8 phiRef, REAL8 m1, REAL8 m2, REAL8 S1x, REAL8 S1y, REAL8 S1z, REAL8 S2x, REAL8 S2y, REAL8 S2z, REAL8 f_ref, REAL8 distance, REAL8 inclination, LALDict *LALpars, Approximant approximant);
+int XLALSimInspiralRelativeBinningInnerProducts(COMPLEX16 *dh, REAL8 *hh, const LALSimInspiralRelativeBinningSummary *summary, const COMPLEX16Sequence *r0, const COMPLEX16Sequence *r1);
+
+#if 0
+{ /* so that editors will match succeeding brace */
+#elif defined(__cplusplus)
+}
+#endif
+
+#endif /* _LALSIMINSPIRALRELATIVEBINNING_H */
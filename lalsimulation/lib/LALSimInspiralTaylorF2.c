@@ -143,22 +143,121 @@ int XLALSimInspiralTaylorF2AlignedPhasingArray(
 }
 
 
-int XLALSimInspiralTaylorF2Core(
-        COMPLEX16FrequencySeries **htilde_out, /**< FD waveform */
-	const REAL8Sequence *freqs,            /**< frequency points at which to evaluate the waveform (Hz) */
+/* Number of frequencies processed together by TaylorF2PhaseAmpBlock() */
+#define TAYLORF2_BLOCK_LENGTH 256
+
+/*
+ * Frequency-independent coefficients of the TaylorF2 phase and SPA
+ * amplitude; the terms that are switched off by the chosen PN orders are
+ * zero, so that the per-frequency evaluation has no branches.
+ */
+typedef struct tagTaylorF2KernelCoeffs {
+    REAL8 piM;
+    REAL8 pfaN, pfa1, pfa2, pfa3, pfa4, pfa5, pfl5, pfa6, pfl6, pfa7;
+    REAL8 pft10, pft12, pft13, pft14, pft15;
+    REAL8 FTaN, FTa2, FTa3, FTa4, FTa5, FTa6, FTl6, FTa7;
+    REAL8 dETaN, dETa1, dETa2, dETa3;
+    REAL8 amp0, shft, phi_ref, ref_phasing;
+} TaylorF2KernelCoeffs;
+
+/*
+ * Evaluates the TaylorF2 phase (including the -pi/4 of the SPA) and
+ * amplitude at n frequencies.  The loop body is free of branches and
+ * function calls other than cbrt, log and sqrt so that it can be
+ * vectorised; the terms are accumulated in the same order as the scalar
+ * implementation it replaces.
+ */
+static void TaylorF2PhaseAmpBlock(
+        REAL8 *phase,                       /**< [out] SPA phase */
+        REAL8 *amp,                         /**< [out] SPA amplitude */
+        const REAL8 *f,                     /**< frequencies (Hz) */
+        const size_t n,                     /**< number of frequencies */
+        const TaylorF2KernelCoeffs *c       /**< coefficients */
+        )
+{
+    #pragma omp simd
+    for (size_t k = 0; k < n; k++) {
+        const REAL8 v = cbrt(c->piM*f[k]);
+        const REAL8 logv = log(v);
+        const REAL8 v2 = v * v;
+        const REAL8 v3 = v * v2;
+        const REAL8 v4 = v * v3;
+        const REAL8 v5 = v * v4;
+        const REAL8 v6 = v * v5;
+        const REAL8 v7 = v * v6;
+        const REAL8 v8 = v * v7;
+        const REAL8 v9 = v * v8;
+        const REAL8 v10 = v * v9;
+        const REAL8 v12 = v2 * v10;
+        const REAL8 v13 = v * v12;
+        const REAL8 v14 = v * v13;
+        const REAL8 v15 = v * v14;
+        REAL8 phasing = 0.;
+        REAL8 dEnergy = 0.;
+        REAL8 flux = 0.;
+
+        phasing += c->pfa7 * v7;
+        phasing += (c->pfa6 + c->pfl6 * logv) * v6;
+        phasing += (c->pfa5 + c->pfl5 * logv) * v5;
+        phasing += c->pfa4 * v4;
+        phasing += c->pfa3 * v3;
+        phasing += c->pfa2 * v2;
+        phasing += c->pfa1 * v;
+        phasing += c->pfaN;
+
+        /* Tidal terms in phasing */
+        phasing += c->pft15 * v15;
+        phasing += c->pft14 * v14;
+        phasing += c->pft13 * v13;
+        phasing += c->pft12 * v12;
+        phasing += c->pft10 * v10;
+
+        /* SPA amplitude corrections; see XLALSimInspiralTaylorF2Core() */
+        flux += c->FTa7 * v7;
+        flux += (c->FTa6 + c->FTl6*logv) * v6;
+        dEnergy += c->dETa3 * v6;
+        flux += c->FTa5 * v5;
+        flux += c->FTa4 * v4;
+        dEnergy += c->dETa2 * v4;
+        flux += c->FTa3 * v3;
+        flux += c->FTa2 * v2;
+        dEnergy += c->dETa1 * v2;
+        flux += 1.;
+        dEnergy += 1.;
+
+        phasing /= v5;
+        flux *= c->FTaN * v10;
+        dEnergy *= c->dETaN * v;
+        // Note the factor of 2 b/c phi_ref is orbital phase
+        phasing += c->shft * f[k] - 2.*c->phi_ref - c->ref_phasing;
+        amp[k] = c->amp0 * sqrt(-dEnergy/flux) * v;
+        phase[k] = phasing - LAL_PI_4;
+    }
+}
+
+/*
+ * Evaluates the TaylorF2 waveform at the frequencies freqs.  If data is
+ * non-NULL the optimally-oriented waveform h is written to data; otherwise
+ * plusFactor * h and crossFactor * h are written in single precision to
+ * datap and datac.  The phase is always accumulated in double precision.
+ */
+static int TaylorF2CoreWrite(
+        COMPLEX16 *data,                       /**< [out] double-precision waveform, or NULL */
+        COMPLEX8 *datap,                       /**< [out] single-precision plus polarization */
+        COMPLEX8 *datac,                       /**< [out] single-precision cross polarization */
+        const COMPLEX16 plusFactor,            /**< factor multiplying h in datap */
+        const COMPLEX16 crossFactor,           /**< factor multiplying h in datac */
+        const REAL8Sequence *freqs,            /**< frequency points at which to evaluate the waveform (Hz) */
         const REAL8 phi_ref,                   /**< reference orbital phase (rad) */
         const REAL8 m1_SI,                     /**< mass of companion 1 (kg) */
         const REAL8 m2_SI,                     /**< mass of companion 2 (kg) */
         const REAL8 f_ref,                     /**< Reference GW frequency (Hz) - if 0 reference point is coalescence */
-	const REAL8 shft,		       /**< time shift to be applied to frequency-domain phase (sec)*/
+        const REAL8 shft,                      /**< time shift to be applied to frequency-domain phase (sec)*/
         const REAL8 r,                         /**< distance of source (m) */
         LALDict *p, /**< Linked list containing the extra testing GR parameters >*/
         PNPhasingSeries *pfaP /**< Phasing coefficients >**/
         )
 {
-
-    if (!htilde_out) XLAL_ERROR(XLAL_EFAULT);
-    if (!freqs) XLAL_ERROR(XLAL_EFAULT);
     /* external: SI; internal: solar masses */
     const REAL8 m1 = m1_SI / LAL_MSUN_SI;
     const REAL8 m2 = m2_SI / LAL_MSUN_SI;
@@ -167,23 +266,6 @@ int XLALSimInspiralTaylorF2Core(
     const REAL8 eta = m1 * m2 / (m * m);
     const REAL8 piM = LAL_PI * m_sec;
     REAL8 amp0;
-    size_t i;
-    COMPLEX16 *data = NULL;
-    LIGOTimeGPS tC = {0, 0};
-    INT4 iStart = 0;
-
-    COMPLEX16FrequencySeries *htilde = NULL;
-
-    if (*htilde_out) { //case when htilde_out has been allocated in XLALSimInspiralTaylorF2
-	    htilde = *htilde_out;
-	    iStart = htilde->data->length - freqs->length; //index shift to fill pre-allocated data
-	    if(iStart < 0) XLAL_ERROR(XLAL_EFAULT);
-    }
-    else { //otherwise allocate memory here
-	    htilde = XLALCreateCOMPLEX16FrequencySeries("htilde: FD waveform", &tC, freqs->data[0], 0., &lalStrainUnit, freqs->length);
-	    if (!htilde) XLAL_ERROR(XLAL_EFUNC);
-	    XLALUnitMultiply(&htilde->sampleUnits, &htilde->sampleUnits, &lalSecondUnit);
-    }
 
     PNPhasingSeries pfa = *pfaP;
 
@@ -337,8 +419,6 @@ int XLALSimInspiralTaylorF2Core(
     /* extrinsic parameters */
     amp0 = -4. * m1 * m2 / r * LAL_MRSUN_SI * LAL_MTSUN_SI * sqrt(LAL_PI/12.L);
 
-    data = htilde->data->data;
-
     /* Compute the SPA phase at the reference point
      * N.B. f_ref == 0 means we define the reference time/phase at "coalescence"
      * when the frequency approaches infinity. In that case,
@@ -382,46 +462,9 @@ int XLALSimInspiralTaylorF2Core(
         ref_phasing /= v5ref;
     } /* End of if(f_ref != 0) block */
 
-    #pragma omp parallel for
-    for (i = 0; i < freqs->length; i++) {
-        const REAL8 f = freqs->data[i];
-        const REAL8 v = cbrt(piM*f);
-        const REAL8 logv = log(v);
-        const REAL8 v2 = v * v;
-        const REAL8 v3 = v * v2;
-        const REAL8 v4 = v * v3;
-        const REAL8 v5 = v * v4;
-        const REAL8 v6 = v * v5;
-        const REAL8 v7 = v * v6;
-        const REAL8 v8 = v * v7;
-        const REAL8 v9 = v * v8;
-        const REAL8 v10 = v * v9;
-        const REAL8 v12 = v2 * v10;
-        const REAL8 v13 = v * v12;
-        const REAL8 v14 = v * v13;
-        const REAL8 v15 = v * v14;
-        REAL8 phasing = 0.;
-        REAL8 dEnergy = 0.;
-        REAL8 flux = 0.;
-        REAL8 amp;
-
-        phasing += pfa7 * v7;
-        phasing += (pfa6 + pfl6 * logv) * v6;
-        phasing += (pfa5 + pfl5 * logv) * v5;
-        phasing += pfa4 * v4;
-        phasing += pfa3 * v3;
-        phasing += pfa2 * v2;
-        phasing += pfa1 * v;
-        phasing += pfaN;
-
-        /* Tidal terms in phasing */
-        phasing += pft15 * v15;
-        phasing += pft14 * v14;
-        phasing += pft13 * v13;
-        phasing += pft12 * v12;
-        phasing += pft10 * v10;
-
-    /* WARNING! Amplitude orders beyond 0 have NOT been reviewed!
+    /* Collect the coefficients, zeroing the SPA amplitude corrections
+     * beyond the requested amplitude order.
+     * WARNING! Amplitude orders beyond 0 have NOT been reviewed!
      * Use at your own risk. The default is to turn them off.
      * These do not currently include spin corrections.
      * Note that these are not higher PN corrections to the amplitude.
@@ -429,61 +472,151 @@ int XLALSimInspiralTaylorF2Core(
      * from the stationary phase approximation. See for instance
      * Eq 6.9 of arXiv:0810.5336
      */
-	switch (amplitudeO)
-        {
-            case 7:
-                flux += FTa7 * v7;
+    TaylorF2KernelCoeffs c = {
+        .piM = piM,
+        .pfaN = pfaN, .pfa1 = pfa1, .pfa2 = pfa2, .pfa3 = pfa3, .pfa4 = pfa4,
+        .pfa5 = pfa5, .pfl5 = pfl5, .pfa6 = pfa6, .pfl6 = pfl6, .pfa7 = pfa7,
+        .pft10 = pft10, .pft12 = pft12, .pft13 = pft13, .pft14 = pft14, .pft15 = pft15,
+        .FTaN = FTaN, .dETaN = dETaN,
+        .amp0 = amp0, .shft = shft, .phi_ref = phi_ref, .ref_phasing = ref_phasing
+    };
+    switch (amplitudeO)
+    {
+        case 7:
+            c.FTa7 = FTa7;
 #if __GNUC__ >= 7 && !defined __INTEL_COMPILER
-                __attribute__ ((fallthrough));
+            __attribute__ ((fallthrough));
 #endif
-            case 6:
-                flux += (FTa6 + FTl6*logv) * v6;
-                dEnergy += dETa3 * v6;
+        case 6:
+            c.FTa6 = FTa6;
+            c.FTl6 = FTl6;
+            c.dETa3 = dETa3;
 #if __GNUC__ >= 7 && !defined __INTEL_COMPILER
-                __attribute__ ((fallthrough));
+            __attribute__ ((fallthrough));
 #endif
-            case 5:
-                flux += FTa5 * v5;
+        case 5:
+            c.FTa5 = FTa5;
 #if __GNUC__ >= 7 && !defined __INTEL_COMPILER
-                __attribute__ ((fallthrough));
+            __attribute__ ((fallthrough));
 #endif
-            case 4:
-                flux += FTa4 * v4;
-                dEnergy += dETa2 * v4;
+        case 4:
+            c.FTa4 = FTa4;
+            c.dETa2 = dETa2;
 #if __GNUC__ >= 7 && !defined __INTEL_COMPILER
-                __attribute__ ((fallthrough));
+            __attribute__ ((fallthrough));
 #endif
-            case 3:
-                flux += FTa3 * v3;
+        case 3:
+            c.FTa3 = FTa3;
 #if __GNUC__ >= 7 && !defined __INTEL_COMPILER
-                __attribute__ ((fallthrough));
+            __attribute__ ((fallthrough));
 #endif
-            case 2:
-                flux += FTa2 * v2;
-                dEnergy += dETa1 * v2;
+        case 2:
+            c.FTa2 = FTa2;
+            c.dETa1 = dETa1;
 #if __GNUC__ >= 7 && !defined __INTEL_COMPILER
-                __attribute__ ((fallthrough));
+            __attribute__ ((fallthrough));
 #endif
-            case -1: /* Default to no SPA amplitude corrections */
-            case 0:
-                flux += 1.;
-                dEnergy += 1.;
+        case -1: /* Default to no SPA amplitude corrections */
+        case 0:
+            break;
+        default:
+            /* the kernel always adds the leading-order term, so an order
+             * without coefficients here must not reach it */
+            XLAL_ERROR(XLAL_EINVAL, "Amplitude PN order %d has no SPA coefficients", amplitudeO);
+    }
+
+    /* Each block of frequencies is evaluated in a vectorisable pass for
+     * the phase and amplitude, followed by the trigonometric pass */
+    const size_t nblocks = (freqs->length + TAYLORF2_BLOCK_LENGTH - 1) / TAYLORF2_BLOCK_LENGTH;
+    #pragma omp parallel for
+    for (size_t b = 0; b < nblocks; b++) {
+        REAL8 phasing[TAYLORF2_BLOCK_LENGTH];
+        REAL8 amp[TAYLORF2_BLOCK_LENGTH];
+        const size_t i0 = b * TAYLORF2_BLOCK_LENGTH;
+        const size_t n = (freqs->length - i0 < TAYLORF2_BLOCK_LENGTH) ? freqs->length - i0 : TAYLORF2_BLOCK_LENGTH;
+
+        TaylorF2PhaseAmpBlock(phasing, amp, freqs->data + i0, n, &c);
+
+        for (size_t k = 0; k < n; k++) {
+            const COMPLEX16 h = amp[k] * cos(phasing[k])
+                    - amp[k] * sin(phasing[k]) * 1.0j;
+            if (data)
+                data[i0 + k] = h;
+            else {
+                datap[i0 + k] = plusFactor * h;
+                datac[i0 + k] = crossFactor * h;
+            }
         }
+    }
 
-        phasing /= v5;
-        flux *= FTaN * v10;
-        dEnergy *= dETaN * v;
-        // Note the factor of 2 b/c phi_ref is orbital phase
-        phasing += shft * f - 2.*phi_ref - ref_phasing;
-        amp = amp0 * sqrt(-dEnergy/flux) * v;
-        data[i+iStart] = amp * cos(phasing - LAL_PI_4)
-                - amp * sin(phasing - LAL_PI_4) * 1.0j;
+    return XLAL_SUCCESS;
+}
+
+int XLALSimInspiralTaylorF2Core(
+        COMPLEX16FrequencySeries **htilde_out, /**< FD waveform */
+	const REAL8Sequence *freqs,            /**< frequency points at which to evaluate the waveform (Hz) */
+        const REAL8 phi_ref,                   /**< reference orbital phase (rad) */
+        const REAL8 m1_SI,                     /**< mass of companion 1 (kg) */
+        const REAL8 m2_SI,                     /**< mass of companion 2 (kg) */
+        const REAL8 f_ref,                     /**< Reference GW frequency (Hz) - if 0 reference point is coalescence */
+	const REAL8 shft,		       /**< time shift to be applied to frequency-domain phase (sec)*/
+        const REAL8 r,                         /**< distance of source (m) */
+        LALDict *p, /**< Linked list containing the extra testing GR parameters >*/
+        PNPhasingSeries *pfaP /**< Phasing coefficients >**/
+        )
+{
+
+    if (!htilde_out) XLAL_ERROR(XLAL_EFAULT);
+    if (!freqs) XLAL_ERROR(XLAL_EFAULT);
+    LIGOTimeGPS tC = {0, 0};
+    INT4 iStart = 0;
+
+    COMPLEX16FrequencySeries *htilde = NULL;
+
+    if (*htilde_out) { //case when htilde_out has been allocated in XLALSimInspiralTaylorF2
+	    htilde = *htilde_out;
+	    iStart = htilde->data->length - freqs->length; //index shift to fill pre-allocated data
+	    if(iStart < 0) XLAL_ERROR(XLAL_EFAULT);
+    }
+    else { //otherwise allocate memory here
+	    htilde = XLALCreateCOMPLEX16FrequencySeries("htilde: FD waveform", &tC, freqs->data[0], 0., &lalStrainUnit, freqs->length);
+	    if (!htilde) XLAL_ERROR(XLAL_EFUNC);
+	    XLALUnitMultiply(&htilde->sampleUnits, &htilde->sampleUnits, &lalSecondUnit);
+    }
+
+    if (TaylorF2CoreWrite(htilde->data->data + iStart, NULL, NULL, 0., 0., freqs, phi_ref, m1_SI, m2_SI, f_ref, shft, r, p, pfaP) < 0) {
+        if (htilde != *htilde_out)
+            XLALDestroyCOMPLEX16FrequencySeries(htilde);
+        XLAL_ERROR(XLAL_EFUNC);
     }
 
     *htilde_out = htilde;
     return XLAL_SUCCESS;
 }
 
+/*
+ * Returns the frequency at which TaylorF2 generation stops: fEnd if it is
+ * non-zero, otherwise the Schwarzschild ISCO or, when tides are enabled, the
+ * smaller of the ISCO and contact frequencies.
+ */
+static REAL8 TaylorF2MaxFrequency(const REAL8 m1, const REAL8 m2, const REAL8 fEnd, LALDict *p)
+{
+    const REAL8 piM = LAL_PI * (m1 + m2) * LAL_MTSUN_SI;
+    const REAL8 vISCO = 1. / sqrt(6.);
+    const REAL8 fISCO = vISCO * vISCO * vISCO / piM;
+    INT4 tideO = XLALSimInspiralWaveformParamsLookupPNTidalOrder(p);
+
+    if (fEnd != 0.) // End at user-specified freq.
+        return fEnd;
+    if (tideO == 0) // End at ISCO
+        return fISCO;
+    /* End at the minimum of the contact and ISCO frequencies only when tides are enabled */
+    REAL8 lambda1 = XLALSimInspiralWaveformParamsLookupTidalLambda1(p);
+    REAL8 lambda2 = XLALSimInspiralWaveformParamsLookupTidalLambda2(p);
+    REAL8 fCONT = XLALSimInspiralContactFrequency(m1, lambda1, m2, lambda2); /* Contact frequency of two compact objects */
+    return (fCONT > fISCO) ? fISCO : fCONT;
+}
+
 /**
  * Computes the stationary phase approximation to the Fourier transform of
  * a chirp waveform. The amplitude is given by expanding \f$1/\sqrt{\dot{F}}\f$.
@@ -518,14 +651,6 @@ int XLALSimInspiralTaylorF2(
     /* external: SI; internal: solar masses */
     const REAL8 m1 = m1_SI / LAL_MSUN_SI;
     const REAL8 m2 = m2_SI / LAL_MSUN_SI;
-    const REAL8 m = m1 + m2;
-    const REAL8 m_sec = m * LAL_MTSUN_SI;  /* total mass in seconds */
-    // const REAL8 eta = m1 * m2 / (m * m);
-    const REAL8 piM = LAL_PI * m_sec;
-    const REAL8 vISCO = 1. / sqrt(6.);
-    const REAL8 fISCO = vISCO * vISCO * vISCO / piM;
-    //const REAL8 m1OverM = m1 / m;
-    // const REAL8 m2OverM = m2 / m;
     REAL8 shft, f_max;
     size_t i, n;
     INT4 iStart;
@@ -533,10 +658,6 @@ int XLALSimInspiralTaylorF2(
     LIGOTimeGPS tC = {0, 0};
     int ret;
     int retcode;
-    REAL8 fCONT;
-    INT4 tideO = XLALSimInspiralWaveformParamsLookupPNTidalOrder(p);
-    REAL8 lambda1 = XLALSimInspiralWaveformParamsLookupTidalLambda1(p);
-    REAL8 lambda2 = XLALSimInspiralWaveformParamsLookupTidalLambda2(p);
     retcode = XLALSimInspiralSetQuadMonParamsFromLambdas(p);
     XLAL_CHECK(retcode == XLAL_SUCCESS, XLAL_EFUNC, "Failed to set quadparams from Universal relation.\n");
 
@@ -552,14 +673,7 @@ int XLALSimInspiralTaylorF2(
     if (r <= 0) XLAL_ERROR(XLAL_EDOM);
 
     /* allocate htilde */
-    if (( fEnd == 0. ) && ( tideO == 0 )) // End at ISCO
-        f_max = fISCO;
-    else if (( fEnd == 0. ) && ( tideO != 0 )) { // End at the minimum of the contact and ISCO frequencies only when tides are enabled
-        fCONT = XLALSimInspiralContactFrequency(m1, lambda1, m2, lambda2); /* Contact frequency of two compact objects */
-        f_max = (fCONT > fISCO) ? fISCO : fCONT;
-    }
-    else // End at user-specified freq.
-        f_max = fEnd;
+    f_max = TaylorF2MaxFrequency(m1, m2, fEnd, p);
     if (f_max <= fStart) XLAL_ERROR(XLAL_EDOM);
 
     n = (size_t) (f_max / deltaF + 1);
@@ -596,6 +710,98 @@ int XLALSimInspiralTaylorF2(
 
     return ret;
 }
+/**
+ * Single-precision variant of XLALSimInspiralTaylorF2().
+ *
+ * Returns the two polarizations hptilde = plusFactor * h and
+ * hctilde = crossFactor * h, where h is the waveform returned by
+ * XLALSimInspiralTaylorF2(), as COMPLEX8 frequency series.  The phase is
+ * accumulated in double precision and each sample is rounded once when it is
+ * stored, so no double-precision copy of the waveform is ever allocated.
+ * For a non-precessing source at inclination i, the usual choice is
+ * plusFactor = (1 + cos^2 i) / 2 and crossFactor = -I cos i.
+ */
+int XLALSimInspiralTaylorF2COMPLEX8(
+        COMPLEX8FrequencySeries **hptilde_out, /**< [out] FD plus polarization */
+        COMPLEX8FrequencySeries **hctilde_out, /**< [out] FD cross polarization */
+        const REAL8 phi_ref,                   /**< reference orbital phase (rad) */
+        const REAL8 deltaF,                    /**< frequency resolution */
+        const REAL8 m1_SI,                     /**< mass of companion 1 (kg) */
+        const REAL8 m2_SI,                     /**< mass of companion 2 (kg) */
+        const REAL8 S1z,                       /**<  z component of the spin of companion 1 */
+        const REAL8 S2z,                       /**<  z component of the spin of companion 2  */
+        const REAL8 fStart,                    /**< start GW frequency (Hz) */
+        const REAL8 fEnd,                      /**< highest GW frequency (Hz) of waveform generation - if 0, end at Schwarzschild ISCO */
+        const REAL8 f_ref,                     /**< Reference GW frequency (Hz) - if 0 reference point is coalescence */
+        const REAL8 r,                         /**< distance of source (m) */
+        const COMPLEX16 plusFactor,            /**< factor multiplying h in the plus polarization */
+        const COMPLEX16 crossFactor,           /**< factor multiplying h in the cross polarization */
+        LALDict *p /**< Linked list containing the extra testing GR parameters >**/
+        )
+{
+    /* external: SI; internal: solar masses */
+    const REAL8 m1 = m1_SI / LAL_MSUN_SI;
+    const REAL8 m2 = m2_SI / LAL_MSUN_SI;
+    COMPLEX8FrequencySeries *hptilde = NULL;
+    COMPLEX8FrequencySeries *hctilde = NULL;
+    REAL8Sequence *freqs = NULL;
+    LIGOTimeGPS tC = {0, 0};
+    REAL8 shft, f_max;
+    size_t i, n;
+    INT4 iStart;
+    int retcode;
+
+    XLAL_CHECK(hptilde_out && hctilde_out, XLAL_EFAULT);
+    XLAL_CHECK(*hptilde_out == NULL && *hctilde_out == NULL, XLAL_EFAULT);
+    XLAL_CHECK(m1_SI > 0 && m2_SI > 0, XLAL_EDOM);
+    XLAL_CHECK(fStart > 0, XLAL_EDOM);
+    XLAL_CHECK(f_ref >= 0, XLAL_EDOM);
+    XLAL_CHECK(r > 0, XLAL_EDOM);
+
+    retcode = XLALSimInspiralSetQuadMonParamsFromLambdas(p);
+    XLAL_CHECK(retcode == XLAL_SUCCESS, XLAL_EFUNC, "Failed to set quadparams from Universal relation.\n");
+
+    f_max = TaylorF2MaxFrequency(m1, m2, fEnd, p);
+    XLAL_CHECK(f_max > fStart, XLAL_EDOM);
+
+    n = (size_t) (f_max / deltaF + 1);
+    XLALGPSAdd(&tC, -1 / deltaF);  /* coalesce at t=0 */
+    iStart = (INT4) ceil(fStart / deltaF);
+
+    hptilde = XLALCreateCOMPLEX8FrequencySeries("hptilde: FD waveform", &tC, 0.0, deltaF, &lalStrainUnit, n);
+    hctilde = XLALCreateCOMPLEX8FrequencySeries("hctilde: FD waveform", &tC, 0.0, deltaF, &lalStrainUnit, n);
+    freqs = XLALCreateREAL8Sequence(n - iStart);
+    if (!hptilde || !hctilde || !freqs)
+        goto fail;
+    XLALUnitMultiply(&hptilde->sampleUnits, &hptilde->sampleUnits, &lalSecondUnit);
+    XLALUnitMultiply(&hctilde->sampleUnits, &hctilde->sampleUnits, &lalSecondUnit);
+    memset(hptilde->data->data, 0, iStart * sizeof(COMPLEX8));
+    memset(hctilde->data->data, 0, iStart * sizeof(COMPLEX8));
+
+    /* extrinsic parameters */
+    shft = LAL_TWOPI * (tC.gpsSeconds + 1e-9 * tC.gpsNanoSeconds);
+
+    for (i = iStart; i < n; i++)
+        freqs->data[i-iStart] = i * deltaF;
+
+    /* phasing coefficients */
+    PNPhasingSeries pfa;
+    XLALSimInspiralPNPhasing_F2(&pfa, m1, m2, S1z, S2z, S1z*S1z, S2z*S2z, S1z*S2z, p);
+
+    if (TaylorF2CoreWrite(NULL, hptilde->data->data + iStart, hctilde->data->data + iStart, plusFactor, crossFactor, freqs, phi_ref, m1_SI, m2_SI, f_ref, shft, r, p, &pfa) < 0)
+        goto fail;
+
+    XLALDestroyREAL8Sequence(freqs);
+    *hptilde_out = hptilde;
+    *hctilde_out = hctilde;
+    return XLAL_SUCCESS;
+
+fail:
+    XLALDestroyREAL8Sequence(freqs);
+    XLALDestroyCOMPLEX8FrequencySeries(hptilde);
+    XLALDestroyCOMPLEX8FrequencySeries(hctilde);
+    XLAL_ERROR(XLAL_EFUNC);
+}
 #include "LALSimInspiralTaylorF2Ecc.c"
 
 /** @} */
@@ -328,6 +328,7 @@ DEFINE_INSERT_FUNC(DTau550, REAL8, "dtau550", 0)
 /* SEOBNRv4P */
 DEFINE_INSERT_FUNC(EOBChooseNumOrAnalHamDer, INT4, "EOBChooseNumOrAnalHamDer", 1)
 DEFINE_INSERT_FUNC(EOBEllMaxForNyquistCheck, INT4, "EOBEllMaxForNyquistCheck", 5)
+DEFINE_INSERT_FUNC(EOBPrecPostAdiabatic, INT4, "EOBPrecPostAdiabatic", 0)
 
 
 /* IMRPhenomX Parameters */
@@ -367,6 +368,10 @@ DEFINE_INSERT_FUNC(PhenomXHMPhaseRef21, REAL8, "PhaseRef21", 0.)
 DEFINE_INSERT_FUNC(PhenomXHMThresholdMband, REAL8, "ThresholdMband", 0.001)
 DEFINE_INSERT_FUNC(PhenomXHMAmpInterpolMB, INT4, "AmpInterpol", 1)
 
+/* Generic multibanding of frequency-domain models (LALSimIMRMultiband.c) */
+DEFINE_INSERT_FUNC(MultibandThreshold, REAL8, "MultibandThreshold", 0)
+DEFINE_INSERT_FUNC(MultibandAmpInterpol, INT4, "MultibandAmpInterpol", 1)
+
 /* IMRPhenomXPHM Parameters */
 DEFINE_INSERT_FUNC(PhenomXPHMMBandVersion, INT4, "MBandPrecVersion", 0)
 DEFINE_INSERT_FUNC(PhenomXPHMThresholdMband, REAL8, "PrecThresholdMband", 0.001)
@@ -1411,6 +1416,7 @@ DEFINE_LOOKUP_FUNC(NLTidesF2, REAL8, "nlTidesF2", 0)
 /* SEOBNRv4P */
 DEFINE_LOOKUP_FUNC(EOBChooseNumOrAnalHamDer, INT4, "EOBChooseNumOrAnalHamDer", 1)
 DEFINE_LOOKUP_FUNC(EOBEllMaxForNyquistCheck, INT4, "EOBEllMaxForNyquistCheck", 5)
+DEFINE_LOOKUP_FUNC(EOBPrecPostAdiabatic, INT4, "EOBPrecPostAdiabatic", 0)
 
 /* IMRPhenomX Parameters */
 DEFINE_LOOKUP_FUNC(PhenomXInspiralPhaseVersion, INT4, "InsPhaseVersion", 104)
@@ -1448,6 +1454,10 @@ DEFINE_LOOKUP_FUNC(PhenomXHMRingdownAmpFreqsVersion, INT4, "RDAmpFreqsVersion",
 DEFINE_LOOKUP_FUNC(PhenomXHMPhaseRef21, REAL8, "PhaseRef21", 0.)
 DEFINE_LOOKUP_FUNC(PhenomXHMThresholdMband, REAL8, "ThresholdMband", 0.001)
 DEFINE_LOOKUP_FUNC(PhenomXHMAmpInterpolMB, INT4, "AmpInterpol", 1)
+
+/* Generic multibanding of frequency-domain models (LALSimIMRMultiband.c) */
+DEFINE_LOOKUP_FUNC(MultibandThreshold, REAL8, "MultibandThreshold", 0)
+DEFINE_LOOKUP_FUNC(MultibandAmpInterpol, INT4, "MultibandAmpInterpol", 1)
 DEFINE_LOOKUP_FUNC(DOmega220, REAL8, "domega220", 0)
 DEFINE_LOOKUP_FUNC(DTau220, REAL8, "dtau220", 0)
 DEFINE_LOOKUP_FUNC(DOmega210, REAL8, "domega210", 0)
@@ -1637,6 +1647,7 @@ DEFINE_ISDEFAULT_FUNC(NonGRParameterization, INT4, "tgr_parameterization", 0)
 /* SEOBNRv4P */
 DEFINE_ISDEFAULT_FUNC(EOBChooseNumOrAnalHamDer, INT4, "EOBChooseNumOrAnalHamDer", 1)
 DEFINE_ISDEFAULT_FUNC(EOBEllMaxForNyquistCheck, INT4, "EOBEllMaxForNyquistCheck", 5)
+DEFINE_ISDEFAULT_FUNC(EOBPrecPostAdiabatic, INT4, "EOBPrecPostAdiabatic", 0)
 
 /* IMRPhenomX Parameters */
 DEFINE_ISDEFAULT_FUNC(PhenomXInspiralPhaseVersion, INT4, "InsPhaseVersion", 104)
@@ -1674,6 +1685,10 @@ DEFINE_ISDEFAULT_FUNC(PhenomXHMRingdownAmpFreqsVersion, INT4, "RDAmpFreqsVersion
 DEFINE_ISDEFAULT_FUNC(PhenomXHMPhaseRef21, REAL8, "PhaseRef21", 0.)
 DEFINE_ISDEFAULT_FUNC(PhenomXHMThresholdMband, REAL8, "ThresholdMband", 0.001)
 DEFINE_ISDEFAULT_FUNC(PhenomXHMAmpInterpolMB, INT4, "AmpInterpol", 1)
+
+/* Generic multibanding of frequency-domain models (LALSimIMRMultiband.c) */
+DEFINE_ISDEFAULT_FUNC(MultibandThreshold, REAL8, "MultibandThreshold", 0)
+DEFINE_ISDEFAULT_FUNC(MultibandAmpInterpol, INT4, "MultibandAmpInterpol", 1)
 DEFINE_ISDEFAULT_FUNC(DOmega220, REAL8, "domega220", 0)
 DEFINE_ISDEFAULT_FUNC(DTau220, REAL8, "dtau220", 0)
 DEFINE_ISDEFAULT_FUNC(DOmega210, REAL8, "domega210", 0)
@@ -119,6 +119,8 @@ int XLALSimInspiralWaveformParamsInsertPhenomXHMRingdownAmpFreqsVersion(LALDict
 int XLALSimInspiralWaveformParamsInsertPhenomXHMPhaseRef21(LALDict *params, REAL8 value);
 int XLALSimInspiralWaveformParamsInsertPhenomXHMThresholdMband(LALDict *params, REAL8 value);
 int XLALSimInspiralWaveformParamsInsertPhenomXHMAmpInterpolMB(LALDict *params, INT4 value);
+int XLALSimInspiralWaveformParamsInsertMultibandThreshold(LALDict *params, REAL8 value);
+int XLALSimInspiralWaveformParamsInsertMultibandAmpInterpol(LALDict *params, INT4 value);
 
 /* IMRPhenomTHM Parameters */
 int XLALSimInspiralWaveformParamsInsertPhenomTHMInspiralVersion(LALDict *params, INT4 value);
@@ -264,6 +266,7 @@ int XLALSimInspiralWaveformParamsInsertNLTidesF2(LALDict *params, REAL8 value);
 /* SEOBNRv4P */
 INT4 XLALSimInspiralWaveformParamsInsertEOBChooseNumOrAnalHamDer(LALDict *params, INT4 value);
 INT4 XLALSimInspiralWaveformParamsInsertEOBEllMaxForNyquistCheck(LALDict *params, INT4 value);
+INT4 XLALSimInspiralWaveformParamsInsertEOBPrecPostAdiabatic(LALDict *params, INT4 value);
 
 
 /* new interface */
@@ -395,6 +398,8 @@ INT4 XLALSimInspiralWaveformParamsLookupPhenomXHMRingdownAmpFreqsVersion(LALDict
 REAL8 XLALSimInspiralWaveformParamsLookupPhenomXHMPhaseRef21(LALDict *params);
 REAL8 XLALSimInspiralWaveformParamsLookupPhenomXHMThresholdMband(LALDict *params);
 INT4 XLALSimInspiralWaveformParamsLookupPhenomXHMAmpInterpolMB(LALDict *params);
+REAL8 XLALSimInspiralWaveformParamsLookupMultibandThreshold(LALDict *params);
+INT4 XLALSimInspiralWaveformParamsLookupMultibandAmpInterpol(LALDict *params);
 
 /* IMRPhenomTHM Parameters */
 INT4 XLALSimInspiralWaveformParamsLookupPhenomTHMInspiralVersion(LALDict *params);
@@ -542,6 +547,7 @@ REAL8 XLALSimInspiralWaveformParamsLookupNLTidesF2(LALDict *params);
 /* SEOBNRv4P */
 INT4 XLALSimInspiralWaveformParamsLookupEOBChooseNumOrAnalHamDer(LALDict *params);
 INT4 XLALSimInspiralWaveformParamsLookupEOBEllMaxForNyquistCheck(LALDict *params);
+INT4 XLALSimInspiralWaveformParamsLookupEOBPrecPostAdiabatic(LALDict *params);
 
 int XLALSimInspiralWaveformParamsLmaxIsDefault(LALDict *params);
 
@@ -621,6 +627,8 @@ int XLALSimInspiralWaveformParamsPhenomXHMRingdownAmpFreqsVersionIsDefault(LALDi
 int XLALSimInspiralWaveformParamsPhenomXHMPhaseRef21IsDefault(LALDict *params);
 int XLALSimInspiralWaveformParamsPhenomXHMThresholdMbandIsDefault(LALDict *params);
 int XLALSimInspiralWaveformParamsPhenomXHMAmpInterpolMBIsDefault(LALDict *params);
+int XLALSimInspiralWaveformParamsMultibandThresholdIsDefault(LALDict *params);
+int XLALSimInspiralWaveformParamsMultibandAmpInterpolIsDefault(LALDict *params);
 
 /* IMRPhenomXPHM Parameters */
 int XLALSimInspiralWaveformParamsPhenomXPHMMBandVersionIsDefault(LALDict *params);
@@ -759,6 +767,7 @@ int XLALSimInspiralWaveformParamsNonGRParameterizationIsDefault(LALDict *params)
 /* SEOBNRv4P */
 INT4 XLALSimInspiralWaveformParamsEOBChooseNumOrAnalHamDerIsDefault(LALDict *params);
 INT4 XLALSimInspiralWaveformParamsEOBEllMaxForNyquistCheckIsDefault(LALDict *params);
+INT4 XLALSimInspiralWaveformParamsEOBPrecPostAdiabaticIsDefault(LALDict *params);
 
 LALDict* XLALSimInspiralParamsDict(const REAL8 m1, const REAL8 m2, const REAL8 S1x, const REAL8 S1y, const REAL8 S1z, const REAL8 S2x, const REAL8 S2y, const REAL8 S2z, const REAL8 distance, const REAL8 inclination, const REAL8 phiRef, const REAL8 longAscNodes, const REAL8 eccentricity, const REAL8 f_ref, LALDict *LALparams);
 
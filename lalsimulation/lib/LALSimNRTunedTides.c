@@ -32,6 +32,10 @@
 #include "LALSimNRTunedTides.h"
 #include "LALSimUniversalRelations.h"
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 #ifdef __GNUC__
 #define UNUSED __attribute__ ((unused))
 #else
@@ -161,57 +165,108 @@ double XLALSimNRTunedTidesMergerFrequency(
   return fHz_merger;
 }
 
+/**
+ * Set the NRTidalv2 phase coefficients in an array for use here and in the IMRPhenomX*_NRTidalv2 implementation
+ */
+int XLALSimNRTunedTidesSetFDTidalPhase_v2_Coeffs(REAL8 *NRTidalv2_coeffs)
+{
+  NRTidalv2_coeffs[0] =   2.4375; // c_Newt
+  NRTidalv2_coeffs[1] = -12.615214237993088; // n_1
+  NRTidalv2_coeffs[2] =  19.0537346970349; // n_3over2
+  NRTidalv2_coeffs[3] = -21.166863146081035; // n_2
+  NRTidalv2_coeffs[4] =  90.55082156324926; // n_5over2
+  NRTidalv2_coeffs[5] = -60.25357801943598; // n_3
+  NRTidalv2_coeffs[6] = -15.111207827736678; // d_1
+  NRTidalv2_coeffs[7] =  22.195327350624694; // d_3over2
+  NRTidalv2_coeffs[8] =   8.064109635305156; // d_2
+
+  return XLAL_SUCCESS;
+}
+
+/**
+ * Coefficients of the NRTidal phase correction; the terms that are absent
+ * from a given version are zero.
+ */
+typedef struct tagNRTunedTidesFDTidalPhaseCoeffs {
+  REAL8 piM;      /**< pi times the total mass in seconds */
+  REAL8 prefac;   /**< - kappa2T * c_Newt / (Xa * Xb) */
+  REAL8 n_1, n_3over2, n_2, n_5over2, n_3;
+  REAL8 d_1, d_3over2, d_2;
+} NRTunedTidesFDTidalPhaseCoeffs;
+
 /**
  * Internal function only.
- * Function to call the frequency domain tidal correction.
- * Equation (7) in arXiv:1706.02969
+ * Set the coefficients of the frequency domain tidal phase:
+ * Equation (7) in arXiv:1706.02969 for NRTidal (v2 = 0), or
+ * Eq 22 of https://arxiv.org/abs/1905.06011 for NRTidalv2 (v2 = 1).
  */
-static double SimNRTunedTidesFDTidalPhase(
-					  const REAL8 fHz, /**< Gravitational wave frequency (Hz) */
+static void SimNRTunedTidesFDTidalPhaseSetCoeffs(
+					  NRTunedTidesFDTidalPhaseCoeffs *c, /**< [out] phase coefficients */
 					  const REAL8 Xa, /**< Mass of companion 1 divided by total mass */
 					  const REAL8 Xb, /**< Mass of companion 2 divided by total mass */
 					  const REAL8 mtot, /**< total mass (Msun) */
-					  const REAL8 kappa2T /**< tidal coupling constant. Eq. 2 in arXiv:1706.02969 */
+					  const REAL8 kappa2T, /**< tidal coupling constant. Eq. 2 in arXiv:1706.02969 */
+					  const int v2 /**< use the NRTidalv2 coefficients */
 					  )
 {
-  /* NRTunedTidesFDTidalPhase is Eq 7 in arXiv:1706.02969
-   * and is a function of x = angular_orb_freq^(2/3)
-   */
-  REAL8 M_omega = LAL_PI * fHz * (mtot * LAL_MTSUN_SI); //dimensionless angular GW frequency
-
-  REAL8 PN_x = pow(M_omega, 2.0/3.0);
-  REAL8 PN_x_2 = PN_x * PN_x;
-  REAL8 PN_x_3over2 = pow(PN_x, 3.0/2.0);
-  REAL8 PN_x_5over2 = pow(PN_x, 5.0/2.0);
-
-  /* model parameters */
-  const REAL8 c_Newt = 2.4375; /* 39.0 / 16.0 */
-
-  const REAL8 n_1 = -17.428;
-  const REAL8 n_3over2 = 31.867;
-  const REAL8 n_2 = -26.414;
-  const REAL8 n_5over2 = 62.362;
-
-  const REAL8 d_1 = n_1 - 2.496; /* 3115.0/1248.0 */
-  const REAL8 d_3over2 = 36.089;
-
-  REAL8 tidal_phase = - kappa2T * c_Newt / (Xa * Xb) * PN_x_5over2;
-
-  REAL8 num = 1.0 + (n_1 * PN_x) + (n_3over2 * PN_x_3over2) + (n_2 * PN_x_2) + (n_5over2 * PN_x_5over2) ;
-  REAL8 den = 1.0 + (d_1 * PN_x) + (d_3over2 * PN_x_3over2) ;
+  REAL8 c_Newt;
+
+  c->piM = LAL_PI * (mtot * LAL_MTSUN_SI);
+  if (v2) {
+    REAL8 NRTidalv2_coeffs[9];
+    XLALSimNRTunedTidesSetFDTidalPhase_v2_Coeffs(NRTidalv2_coeffs);
+    c_Newt      = NRTidalv2_coeffs[0];
+    c->n_1      = NRTidalv2_coeffs[1];
+    c->n_3over2 = NRTidalv2_coeffs[2];
+    c->n_2      = NRTidalv2_coeffs[3];
+    c->n_5over2 = NRTidalv2_coeffs[4];
+    c->n_3      = NRTidalv2_coeffs[5];
+    c->d_1      = NRTidalv2_coeffs[6];
+    c->d_3over2 = NRTidalv2_coeffs[7];
+    c->d_2      = NRTidalv2_coeffs[8];
+  } else {
+    c_Newt      = 2.4375; /* 39.0 / 16.0 */
+    c->n_1      = -17.428;
+    c->n_3over2 = 31.867;
+    c->n_2      = -26.414;
+    c->n_5over2 = 62.362;
+    c->n_3      = 0.;
+    c->d_1      = c->n_1 - 2.496; /* 3115.0/1248.0 */
+    c->d_3over2 = 36.089;
+    c->d_2      = 0.;
+  }
+  c->prefac = - kappa2T * c_Newt / (Xa * Xb);
+}
 
-  REAL8 ratio = num / den;
+/**
+ * Internal function only.
+ * Frequency domain tidal phase at one frequency, written without branches
+ * or pow() so that loops over frequencies can be vectorised.
+ * It is a function of x = angular_orb_freq^(2/3) = v^2 with v = (pi M f)^(1/3).
+ */
+static inline REAL8 SimNRTunedTidesFDTidalPhaseKernel(
+					  const REAL8 fHz, /**< Gravitational wave frequency (Hz) */
+					  const NRTunedTidesFDTidalPhaseCoeffs *c /**< phase coefficients */
+					  )
+{
+  const REAL8 v = cbrt(c->piM * fHz);
+  const REAL8 PN_x = v * v;
+  const REAL8 PN_x_2 = PN_x * PN_x;
+  const REAL8 PN_x_3 = PN_x * PN_x_2;
+  const REAL8 PN_x_3over2 = v * PN_x;
+  const REAL8 PN_x_5over2 = PN_x_3over2 * PN_x;
 
-  tidal_phase *= ratio;
+  REAL8 num = 1.0 + (c->n_1 * PN_x) + (c->n_3over2 * PN_x_3over2) + (c->n_2 * PN_x_2) + (c->n_5over2 * PN_x_5over2) + (c->n_3 * PN_x_3);
+  REAL8 den = 1.0 + (c->d_1 * PN_x) + (c->d_3over2 * PN_x_3over2) + (c->d_2 * PN_x_2) ;
 
-  return tidal_phase;
+  return c->prefac * PN_x_5over2 * (num / den);
 }
 
 /** 
  * Tidal amplitude corrections; only available for NRTidalv2;
  * Eq 24 of arxiv:1905.06011
  */
-static REAL8 SimNRTunedTidesFDTidalAmplitude(
+static inline REAL8 SimNRTunedTidesFDTidalAmplitude(
 					     const REAL8 fHz, /**< Gravitational wave frequency (Hz) */
 					     const REAL8 mtot, /**< Total mass in solar masses */
 					     const REAL8 kappa2T /**< tidal coupling constant. Eq. 2 in arXiv:1706.02969 */
@@ -219,81 +274,18 @@ static REAL8 SimNRTunedTidesFDTidalAmplitude(
 {
   const REAL8 M_sec   = (mtot * LAL_MTSUN_SI);
 
-  REAL8 prefac = 0.0;
-  prefac = 9.0*kappa2T;
+  const REAL8 prefac = 9.0*kappa2T;
 
-  REAL8 x = pow(LAL_PI*M_sec*fHz, 2.0/3.0);
-  REAL8 ampT = 0.0;
-  REAL8 poly = 1.0;
+  /* x = v^2, x^3.25 = v^6 sqrt(v) and x^4 = v^8 */
+  const REAL8 v = cbrt(LAL_PI*M_sec*fHz);
+  const REAL8 x = v * v;
+  const REAL8 x2 = x * x;
   const REAL8 n1   = 4.157407407407407;
   const REAL8 n289 = 2519.111111111111;
   const REAL8 d    = 13477.8073677; 
 
-  poly = (1.0 + n1*x + n289*pow(x, 2.89))/(1+d*pow(x,4.));
-  ampT = - prefac*pow(x,3.25)*poly;
-
-  return ampT;
-}
-
-/**
- * Set the NRTidalv2 phase coefficients in an array for use here and in the IMRPhenomX*_NRTidalv2 implementation
- */
-int XLALSimNRTunedTidesSetFDTidalPhase_v2_Coeffs(REAL8 *NRTidalv2_coeffs)
-{
-  NRTidalv2_coeffs[0] =   2.4375; // c_Newt
-  NRTidalv2_coeffs[1] = -12.615214237993088; // n_1
-  NRTidalv2_coeffs[2] =  19.0537346970349; // n_3over2
-  NRTidalv2_coeffs[3] = -21.166863146081035; // n_2
-  NRTidalv2_coeffs[4] =  90.55082156324926; // n_5over2
-  NRTidalv2_coeffs[5] = -60.25357801943598; // n_3
-  NRTidalv2_coeffs[6] = -15.111207827736678; // d_1
-  NRTidalv2_coeffs[7] =  22.195327350624694; // d_3over2
-  NRTidalv2_coeffs[8] =   8.064109635305156; // d_2
-
-  return XLAL_SUCCESS;
-}
-
-/** 
- * NRTunedTidesFDTidalPhase is Eq 22 of https://arxiv.org/abs/1905.06011 
- * and is a function of x = angular_orb_freq^(2/3)
- */
-static double SimNRTunedTidesFDTidalPhase_v2(
-					     const REAL8 fHz, /**< Gravitational wave frequency (Hz) */
-					     const REAL8 Xa, /**< Mass of companion 1 divided by total mass */
-					     const REAL8 Xb, /**< Mass of companion 2 divided by total mass */
-					     const REAL8 mtot, /**< total mass (Msun) */
-					     const REAL8 kappa2T /**< tidal coupling constant. Eq. 2 in arXiv:1706.02969 */
-					     )
-{
-
-  REAL8 M_omega = LAL_PI * fHz * (mtot * LAL_MTSUN_SI); //dimensionless angular GW frequency
-  REAL8 PN_x = pow(M_omega, 2.0/3.0);
-  REAL8 PN_x_2 = PN_x * PN_x;
-  REAL8 PN_x_3 = PN_x * PN_x_2;
-  REAL8 PN_x_3over2 = pow(PN_x, 3.0/2.0);
-  REAL8 PN_x_5over2 = pow(PN_x, 5.0/2.0);
-  /* model parameters */
-  REAL8 NRTidalv2_coeffs[9];
-
-  int errcode;
-  errcode = XLALSimNRTunedTidesSetFDTidalPhase_v2_Coeffs(NRTidalv2_coeffs);
-  XLAL_CHECK(XLAL_SUCCESS == errcode, errcode, "Setting NRTidalv2 coefficients failed.\n");
-
-  const REAL8 c_Newt   = NRTidalv2_coeffs[0];
-  const REAL8 n_1      = NRTidalv2_coeffs[1];
-  const REAL8 n_3over2 = NRTidalv2_coeffs[2];
-  const REAL8 n_2      = NRTidalv2_coeffs[3];
-  const REAL8 n_5over2 = NRTidalv2_coeffs[4];
-  const REAL8 n_3      = NRTidalv2_coeffs[5];
-  const REAL8 d_1      = NRTidalv2_coeffs[6];
-  const REAL8 d_3over2 = NRTidalv2_coeffs[7];
-  const REAL8 d_2      = NRTidalv2_coeffs[8];
-  REAL8 tidal_phase = - kappa2T * c_Newt / (Xa * Xb) * PN_x_5over2;
-  REAL8 num = 1.0 + (n_1 * PN_x) + (n_3over2 * PN_x_3over2) + (n_2 * PN_x_2) + (n_5over2 * PN_x_5over2) + (n_3 * PN_x_3);
-  REAL8 den = 1.0 + (d_1 * PN_x) + (d_3over2 * PN_x_3over2) + (d_2 * PN_x_2) ;
-  REAL8 ratio = num / den;
-  tidal_phase *= ratio;
-  return tidal_phase;
+  const REAL8 poly = (1.0 + n1*x + n289*pow(x, 2.89))/(1+d*x2*x2);
+  return - prefac*x2*x*sqrt(v)*poly;
 }
 
 /** Function to call amplitude tidal series only; 
@@ -334,6 +326,7 @@ int XLALSimNRTunedTidesFDTidalAmplitudeFrequencySeries(
   /* tidal coupling constant.*/
   const REAL8 kappa2T = XLALSimNRTunedTidesComputeKappa2T(m1_SI, m2_SI, lambda1, lambda2);
 
+  #pragma omp parallel for simd
   for(UINT4 i = 0; i < (*fHz).length; i++)
     (*amp_tidal).data[i] = SimNRTunedTidesFDTidalAmplitude((*fHz).data[i]/f_dim_to_Hz, mtot, kappa2T);
 
@@ -399,30 +392,48 @@ int XLALSimNRTunedTidesFDTidalPhaseFrequencySeries(
   const REAL8 fHz_mrg = XLALSimNRTunedTidesMergerFrequency(mtot, kappa2T, q);
 
   const REAL8 fHz_end_taper = 1.2*fHz_mrg;
+  NRTunedTidesFDTidalPhaseCoeffs coeffs;
+  const REAL8 *f = (*fHz).data;
+  REAL8 *phi = (*phi_tidal).data;
+  REAL8 *taper = (*planck_taper).data;
+  const UINT4 n = (*fHz).length;
+
+  /* The phase, amplitude and taper are filled in separate passes so that
+   * the phase and amplitude loops carry no branches and can be vectorised */
   if (NRTidal_version == NRTidal_V) {
-    for(UINT4 i = 0; i < (*fHz).length; i++){
-      (*phi_tidal).data[i] = SimNRTunedTidesFDTidalPhase((*fHz).data[i], Xa, Xb, mtot, kappa2T);
-      (*planck_taper).data[i] = 1.0 - PlanckTaper((*fHz).data[i], fHz_mrg, fHz_end_taper);
-    }
+    SimNRTunedTidesFDTidalPhaseSetCoeffs(&coeffs, Xa, Xb, mtot, kappa2T, 0);
+    #pragma omp parallel for simd
+    for(UINT4 i = 0; i < n; i++)
+      phi[i] = SimNRTunedTidesFDTidalPhaseKernel(f[i], &coeffs);
+    for(UINT4 i = 0; i < n; i++)
+      taper[i] = 1.0 - PlanckTaper(f[i], fHz_mrg, fHz_end_taper);
   }
   else if (NRTidal_version == NRTidalv2_V) {
-    for(UINT4 i = 0; i < (*fHz).length; i++) {
-      (*phi_tidal).data[i] = SimNRTunedTidesFDTidalPhase_v2((*fHz).data[i], Xa, Xb, mtot, kappa2T);
-      (*amp_tidal).data[i] = SimNRTunedTidesFDTidalAmplitude((*fHz).data[i], mtot, kappa2T);
-      (*planck_taper).data[i] = 1.0 - PlanckTaper((*fHz).data[i], fHz_mrg, fHz_end_taper);
+    REAL8 *amp = (*amp_tidal).data;
+    SimNRTunedTidesFDTidalPhaseSetCoeffs(&coeffs, Xa, Xb, mtot, kappa2T, 1);
+    #pragma omp parallel for simd
+    for(UINT4 i = 0; i < n; i++) {
+      phi[i] = SimNRTunedTidesFDTidalPhaseKernel(f[i], &coeffs);
+      amp[i] = SimNRTunedTidesFDTidalAmplitude(f[i], mtot, kappa2T);
     }
+    for(UINT4 i = 0; i < n; i++)
+      taper[i] = 1.0 - PlanckTaper(f[i], fHz_mrg, fHz_end_taper);
   }
   else if (NRTidal_version == NRTidalv2NSBH_V) {
-    for(UINT4 i = 0; i < (*fHz).length; i++) {
-      (*phi_tidal).data[i] = SimNRTunedTidesFDTidalPhase_v2((*fHz).data[i], Xa, Xb, mtot, kappa2T);
-      (*planck_taper).data[i] = 1.0;
+    SimNRTunedTidesFDTidalPhaseSetCoeffs(&coeffs, Xa, Xb, mtot, kappa2T, 1);
+    #pragma omp parallel for simd
+    for(UINT4 i = 0; i < n; i++) {
+      phi[i] = SimNRTunedTidesFDTidalPhaseKernel(f[i], &coeffs);
+      taper[i] = 1.0;
     }
   }
   else if (NRTidal_version == NRTidalv2NoAmpCorr_V) {
-    for(UINT4 i = 0; i < (*fHz).length; i++) {
-      (*phi_tidal).data[i] = SimNRTunedTidesFDTidalPhase_v2((*fHz).data[i], Xa, Xb, mtot, kappa2T);
-      (*planck_taper).data[i] = 1.0 - PlanckTaper((*fHz).data[i], fHz_mrg, fHz_end_taper);
-    }
+    SimNRTunedTidesFDTidalPhaseSetCoeffs(&coeffs, Xa, Xb, mtot, kappa2T, 1);
+    #pragma omp parallel for simd
+    for(UINT4 i = 0; i < n; i++)
+      phi[i] = SimNRTunedTidesFDTidalPhaseKernel(f[i], &coeffs);
+    for(UINT4 i = 0; i < n; i++)
+      taper[i] = 1.0 - PlanckTaper(f[i], fHz_mrg, fHz_end_taper);
   }
   else if (NRTidal_version == NoNRT_V)
     XLAL_ERROR( XLAL_EINVAL, "Trying to add NRTides to a BBH waveform!" );
@@ -20,14 +20,6 @@
 
 static int EnforcePrimaryMassIsm1(REAL8 *m1, REAL8 *m2, REAL8 *lambda1, REAL8 *lambda2);
 
-static double SimNRTunedTidesFDTidalPhase(
-    const REAL8 fHz, /**< Gravitational wave frequency (Hz) */
-    const REAL8 Xa, /**< Mass of companion 1 divided by total mass */
-    const REAL8 Xb, /**< Mass of companion 2 divided by total mass */
-    const REAL8 mtot, /**< total mass (Msun) */
-    const REAL8 kappa2T /**< tidal coupling constant. Eq. 2 in arXiv:1706.02969 */
-);
-
 static REAL8 PlanckTaper(const REAL8 t, const REAL8 t1, const REAL8 t2);
 
 static REAL8 SimNRTunedTidesFDTidalAmplitude(
@@ -35,11 +27,3 @@ static REAL8 SimNRTunedTidesFDTidalAmplitude(
     const REAL8 mtot, /**< Total mass in solar masses */
     const REAL8 kappa2T /**< tidal coupling constant. Eq. 2 in arXiv:1706.02969 */
     );
-
-static double SimNRTunedTidesFDTidalPhase_v2(
-    const REAL8 fHz, /**< Gravitational wave frequency (Hz) */
-    const REAL8 Xa, /**< Mass of companion 1 divided by total mass */
-    const REAL8 Xb, /**< Mass of companion 2 divided by total mass */
-    const REAL8 mtot, /**< total mass (Msun) */
-    const REAL8 kappa2T /**< tidal coupling constant. Eq. 2 in arXiv:1706.02969 */
-    );
@@ -61,8 +61,15 @@ extern const char * const lalSimNeutronStarEOSNames[111];
 /** Incomplete type for a neutron star family having a particular EOS. */
 typedef struct tagLALSimNeutronStarFamily LALSimNeutronStarFamily;
 
+/** Incomplete type for a workspace reused between constructions of
+ * spectral decomposition equations of state. */
+typedef struct tagLALSimNeutronStarEOSSpectralWorkspace LALSimNeutronStarEOSSpectralWorkspace;
+
 void XLALDestroySimNeutronStarEOS(LALSimNeutronStarEOS * eos);
 char *XLALSimNeutronStarEOSName(LALSimNeutronStarEOS * eos);
+LALSimNeutronStarEOS *XLALSimNeutronStarEOSThreadCopy(LALSimNeutronStarEOS *
+    eos);
+UINT8 XLALSimNeutronStarEOSHash(LALSimNeutronStarEOS * eos);
 
 LALSimNeutronStarEOS *XLALSimNeutronStarEOSByName(const char *name);
 LALSimNeutronStarEOS *XLALSimNeutronStarEOSFromFile(const char *fname);
@@ -74,6 +81,15 @@ LALSimNeutronStarEOS *XLALSimNeutronStarEOSSpectralDecomposition(double
     gamma[], int size);
 LALSimNeutronStarEOS *XLALSimNeutronStarEOS4ParameterSpectralDecomposition(
     double SDgamma0, double SDgamma1, double SDgamma2, double SDgamma3);
+LALSimNeutronStarEOSSpectralWorkspace *XLALCreateSimNeutronStarEOSSpectralWorkspace(void);
+void XLALDestroySimNeutronStarEOSSpectralWorkspace(
+    LALSimNeutronStarEOSSpectralWorkspace *ws);
+LALSimNeutronStarEOS *XLALSimNeutronStarEOSSpectralDecompositionWithWorkspace(
+    double gamma[], int size, LALSimNeutronStarEOSSpectralWorkspace *ws);
+#ifndef SWIG    /* exclude from SWIG interface */
+int XLALSimNeutronStarEOSSpectralDecompositionBatch(LALSimNeutronStarEOS **eos,
+    const double *gamma, int size, size_t n);
+#endif
 LALSimNeutronStarEOS *XLALSimNeutronStarEOSDynamicAnalytic(double parameters[],
     size_t nsec, int causal);
 LALSimNeutronStarEOS *XLALSimNeutronStarEOS3PieceDynamicPolytrope(double g0,
@@ -135,6 +151,12 @@ int XLALSimNeutronStarTOVODEIntegrateWithTolerance(double *radius, double *mass,
     double *love_number_k2, double central_pressure_si,
     LALSimNeutronStarEOS * eos, double epsrel);
 
+#ifndef SWIG    /* exclude from SWIG interface */
+int XLALSimNeutronStarTOVODEIntegrateMany(double *radius, double *mass,
+    double *love_number_k2, const double *central_pressure_si, size_t n,
+    LALSimNeutronStarEOS * eos);
+#endif
+
 int XLALSimNeutronStarVirialODEIntegrate(double *radius, double *mass,
     double *int1, double *int2, double *int3, double *int4, double *int5, double *int6, 
     double *love_number_k2, double central_pressure_si,
@@ -150,6 +172,10 @@ int XLALSimNeutronStarVirialODEIntegrateWithTolerance(double *radius, double *ma
 void XLALDestroySimNeutronStarFamily(LALSimNeutronStarFamily * fam);
 LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamily(
     LALSimNeutronStarEOS * eos);
+LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamilyParallel(
+    LALSimNeutronStarEOS * eos);
+LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamilyCached(
+    LALSimNeutronStarEOS * eos, const char *cachedir);
 
 double XLALSimNeutronStarFamMinimumMass(LALSimNeutronStarFamily * fam);
 double XLALSimNeutronStarMaximumMass(LALSimNeutronStarFamily * fam);
@@ -157,6 +183,11 @@ double XLALSimNeutronStarCentralPressure(double m,
     LALSimNeutronStarFamily * fam);
 double XLALSimNeutronStarRadius(double m, LALSimNeutronStarFamily * fam);
 double XLALSimNeutronStarLoveNumberK2(double m, LALSimNeutronStarFamily * fam);
+#ifndef SWIG    /* exclude from SWIG interface */
+int XLALSimNeutronStarFamilyEvaluate(double *radius, double *k2,
+    double *lambda, const double *mass, size_t n,
+    LALSimNeutronStarFamily * fam);
+#endif
 
 #endif /* _LALSIMNEUTRONSTAR_H */
 
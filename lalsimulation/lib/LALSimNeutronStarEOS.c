@@ -34,6 +34,10 @@
 #include <lal/LALSimNeutronStar.h>
 #include <lal/LALSimReadData.h>
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 /** @cond */
 
 /* Enumeration for type of equation of state data storage. */
@@ -145,6 +149,113 @@ void XLALDestroySimNeutronStarEOS(LALSimNeutronStarEOS * eos)
 /* Dynamic Piecewise-Polytrope Equation of State Code */
 #include "LALSimNeutronStarEOSDynamicPolytrope.c"
 
+/**
+ * @name Routines for concurrent use and identification of an EOS
+ * @{
+ */
+
+/** @cond */
+
+/* the non-tabular representations are never modified by evaluation, so
+ * their thread copies are shallow and free only the top-level structure */
+static void eos_free_shallow_thread_copy(LALSimNeutronStarEOS * eos)
+{
+    LALFree(eos);
+    return;
+}
+
+/* FNV-1a hash of a block of memory */
+static UINT8 eos_hash_fnv1a(UINT8 hash, const void *buf, size_t size)
+{
+    const unsigned char *c = buf;
+    size_t i;
+    for (i = 0; i < size; ++i) {
+        hash ^= c[i];
+        hash *= UINT64_C(0x100000001b3);
+    }
+    return hash;
+}
+
+/** @endcond */
+
+/**
+ * @brief Creates a copy of an EOS structure that can be evaluated
+ * concurrently with the original.
+ * @details
+ * Evaluating a tabulated EOS updates interpolation accelerators stored in
+ * the EOS structure, so a single structure must not be used by several
+ * threads at once.  The copy returned here shares the (read-only) tables
+ * of @a eos but has its own evaluation state.  It must be freed with
+ * XLALDestroySimNeutronStarEOS() before @a eos is freed.
+ * @param eos Pointer to the EOS structure to copy.
+ * @return A pointer to the EOS structure copy.
+ */
+LALSimNeutronStarEOS *XLALSimNeutronStarEOSThreadCopy(LALSimNeutronStarEOS *
+    eos)
+{
+    LALSimNeutronStarEOS *copy;
+
+    XLAL_CHECK_NULL(eos, XLAL_EFAULT);
+
+    if (eos->datatype == LALSIM_NEUTRON_STAR_EOS_DATA_TYPE_TABULAR) {
+        copy = eos_thread_copy_tabular(eos);
+        XLAL_CHECK_NULL(copy, XLAL_EFUNC);
+        return copy;
+    }
+
+    copy = LALMalloc(sizeof(*copy));
+    XLAL_CHECK_NULL(copy, XLAL_ENOMEM);
+    *copy = *eos;
+    copy->free = eos_free_shallow_thread_copy;
+    return copy;
+}
+
+/**
+ * @brief Returns a 64-bit hash identifying the contents of an EOS.
+ * @details
+ * For tabulated equations of state the hash is computed from the pressure
+ * and energy density tables; for piecewise polytropes from the polytrope
+ * parameters.  The name and maximum pressure of the EOS are included in
+ * either case.  Two EOS structures with the same hash can be assumed to
+ * describe the same equation of state, which makes the hash suitable as a
+ * key for caching derived quantities such as neutron star families.
+ * @param eos Pointer to the EOS structure.
+ * @return The hash of the EOS.
+ */
+UINT8 XLALSimNeutronStarEOSHash(LALSimNeutronStarEOS * eos)
+{
+    UINT8 hash = UINT64_C(0xcbf29ce484222325);
+
+    XLAL_CHECK_VAL(0, eos, XLAL_EFAULT);
+
+    hash = eos_hash_fnv1a(hash, eos->name, strlen(eos->name));
+    hash = eos_hash_fnv1a(hash, &eos->pmax, sizeof(eos->pmax));
+    hash = eos_hash_fnv1a(hash, &eos->datatype, sizeof(eos->datatype));
+
+    if (eos->datatype == LALSIM_NEUTRON_STAR_EOS_DATA_TYPE_TABULAR) {
+        LALSimNeutronStarEOSDataTabular *data = eos->data.tabular;
+        hash = eos_hash_fnv1a(hash, &data->ndat, sizeof(data->ndat));
+        hash = eos_hash_fnv1a(hash, data->log_pdat,
+            data->ndat * sizeof(*data->log_pdat));
+        hash = eos_hash_fnv1a(hash, data->log_edat,
+            data->ndat * sizeof(*data->log_edat));
+    } else if (eos->datatype ==
+        LALSIM_NEUTRON_STAR_EOS_DATA_TYPE_PIECEWISE_POLYTROPE) {
+        LALSimNeutronStarEOSDataPiecewisePolytrope *data =
+            eos->data.piecewisePolytrope;
+        size_t n = data->nPoly;
+        hash = eos_hash_fnv1a(hash, &data->nPoly, sizeof(data->nPoly));
+        hash = eos_hash_fnv1a(hash, data->pTab, n * sizeof(*data->pTab));
+        hash = eos_hash_fnv1a(hash, data->kTab, n * sizeof(*data->kTab));
+        hash = eos_hash_fnv1a(hash, data->gammaTab,
+            n * sizeof(*data->gammaTab));
+    }
+
+    return hash;
+}
+
+/** @} */
+
 /**
  * @name Routines to access equation of state variables
  * @{
@@ -31,6 +31,58 @@
 
 /** @cond */
 
+/* Low density EOS values to be stitched (SLy, in geom)
+ * These values agree with LALSimNeutronStarEOS_SLY.dat */
+static const double pdat_low[]={
+     0.00000000e+00,   2.49730009e-31,   1.59235347e-30,
+     1.01533235e-29,   6.47406376e-29,   4.12805731e-28,
+     2.63217321e-27,   1.67835262e-26,   1.07016799e-25,
+     6.82371225e-25,   4.35100369e-24,   1.91523482e-23,
+     8.06001537e-23,   3.23144235e-22,   4.34521997e-22,
+     1.18566090e-21,   3.16699528e-21,   8.31201995e-21,
+     2.15154075e-20,   5.51600847e-20,   7.21972469e-20,
+     1.34595234e-19,   2.50269468e-19,   3.41156366e-19,
+     4.16096744e-19,   5.66803746e-19,   1.05098304e-18,
+     1.94663211e-18,   3.60407863e-18,   4.67819652e-18,
+     6.36373536e-18,   8.65904266e-18,   1.17739845e-17,
+     1.60126190e-17,   2.06809005e-17,   2.81253637e-17,
+     3.82385968e-17,   4.91532870e-17,   6.68349199e-17,
+     9.08868981e-17,   1.19805457e-16,   1.23523557e-16,
+     1.67975513e-16,   2.14575704e-16,   2.38949918e-16,
+     2.71834450e-16,   3.69579177e-16,   4.80543818e-16,
+     6.22823125e-16,   6.44883854e-16,   6.51906933e-16,
+     6.90079430e-16,   7.51717272e-16,   7.84188682e-16,
+     8.12280996e-16,   8.94822824e-16,   1.78030908e-15,
+     2.83170525e-15,   4.35257355e-15,   6.44272433e-15,
+     9.21014776e-15,   1.72635532e-14,   2.96134301e-14,
+     4.76007735e-14,   7.28061891e-14,   1.06973879e-13,
+     1.78634067e-13,   3.17897582e-13,   4.16939514e-13};
+
+static const double edat_low[]={
+     0.00000000e+00,   9.76800363e-24,   3.08891410e-23,
+     9.76800489e-23,   3.08891490e-22,   9.76801000e-22,
+     3.08891816e-21,   9.76803078e-21,   3.08893141e-20,
+     9.76811525e-20,   3.08898527e-19,   7.75906672e-19,
+     1.94909879e-18,   4.89622085e-18,   6.16357861e-18,
+     1.22969164e-17,   2.45420997e-17,   4.89823567e-17,
+     9.77310869e-17,   1.95024387e-16,   2.45531498e-16,
+     3.89264229e-16,   6.16926264e-16,   7.76837038e-16,
+     9.00642353e-16,   1.19237569e-15,   1.89037060e-15,
+     3.09452823e-15,   4.90635934e-15,   5.96458915e-15,
+     7.51061114e-15,   9.79776989e-15,   1.23353809e-14,
+     1.55335650e-14,   1.88188196e-14,   2.46271194e-14,
+     3.10096915e-14,   3.74392368e-14,   4.91814886e-14,
+     6.19454280e-14,   7.62224545e-14,   8.11155415e-14,
+     1.05200677e-13,   1.26436151e-13,   1.37076948e-13,
+     1.55799897e-13,   2.02900352e-13,   2.47139208e-13,
+     3.11281590e-13,   3.19529901e-13,   3.22140999e-13,
+     3.36213572e-13,   3.58537297e-13,   3.70113877e-13,
+     3.80033593e-13,   4.24821517e-13,   1.57119195e-12,
+     2.36083738e-12,   3.33152493e-12,   4.49715211e-12,
+     5.87555551e-12,   9.35905600e-12,   1.39898961e-11,
+     2.00067862e-11,   2.76245081e-11,   3.69196076e-11,
+     5.35224936e-11,   7.81020115e-11,   9.19476188e-11};
+
 /* Maps the abscissae from [-1,1] to [a,b] */
 static void GLBoundConversion(double a, double b, double abscissae[], int nEval)
 {
@@ -166,6 +218,55 @@ static double eos_e_of_p_spectral_decomposition(double x, double gamma[], int si
     return e;
 }
 
+/* Grid, quadrature nodes and evaluation buffers for the spectral
+ * decomposition.  The pressure grid and the nested 10-point Gauss-Legendre
+ * nodes used by eos_e_of_p_spectral_decomposition() do not depend on the
+ * spectral parameters, so they are computed once; a construction then
+ * evaluates the adiabatic index at all nodes in one pass over contiguous
+ * arrays and forms the quadrature sums from those values. */
+#define SPECTRAL_NDAT_LOW (sizeof(pdat_low)/sizeof(*pdat_low))
+#define SPECTRAL_NDAT_HIGH 500
+#define SPECTRAL_NDAT (SPECTRAL_NDAT_LOW + SPECTRAL_NDAT_HIGH)
+#define SPECTRAL_NGL 10
+
+struct tagLALSimNeutronStarEOSSpectralWorkspace {
+    double pdat[SPECTRAL_NDAT];
+    double edat[SPECTRAL_NDAT];
+    double xdat[SPECTRAL_NDAT_HIGH];
+    double outer[SPECTRAL_NDAT_HIGH * SPECTRAL_NGL];
+    double expouter[SPECTRAL_NDAT_HIGH * SPECTRAL_NGL];
+    double inner[SPECTRAL_NDAT_HIGH * SPECTRAL_NGL * SPECTRAL_NGL];
+    double gouter[SPECTRAL_NDAT_HIGH * SPECTRAL_NGL];
+    double ginner[SPECTRAL_NDAT_HIGH * SPECTRAL_NGL * SPECTRAL_NGL];
+};
+
+static const double spectral_gl_weights[SPECTRAL_NGL] = {
+    0.0666713443086881, 0.1494513491505806, 0.2190863625159820,
+    0.2692667193099963, 0.2955242247147529, 0.2955242247147529,
+    0.2692667193099963, 0.2190863625159820, 0.1494513491505806,
+    0.0666713443086881
+};
+
+/* Reference energy density and pressure, and maximum of the dimensionless
+ * pressure x, as in XLALSimNeutronStarEOSSpectralDecomposition() */
+static const double spectral_e0 = 9.54629006e-11;
+static const double spectral_p0 = 4.43784199e-13;
+static const double spectral_xmax = 12.3081;
+
+/* Evaluates 1 / Gamma(x) at n points */
+static void spectral_inverse_adiabatic_index(double *restrict g,
+    const double *restrict x, size_t n, const double gamma[], int size)
+{
+    size_t k;
+    for (k = 0; k < n; ++k) {
+        double logGamma = 0.0;
+        int i;
+        for (i = size - 1; i >= 0; --i)
+            logGamma = logGamma * x[k] + gamma[i];
+        g[k] = exp(-logGamma);
+    }
+}
+
 /** @endcond */
 
 /**
@@ -208,58 +309,6 @@ LALSimNeutronStarEOS *XLALSimNeutronStarEOSSpectralDecomposition(double gamma[],
         XLAL_ERROR_NULL(XLAL_ENOMEM);
     }
 
-    // Low density EOS values to be stitched (SLy, in geom)
-    // These values agree with LALSimNeutronStarEOS_SLY.dat
-    double pdat_low[]={
-         0.00000000e+00,   2.49730009e-31,   1.59235347e-30,
-         1.01533235e-29,   6.47406376e-29,   4.12805731e-28,
-         2.63217321e-27,   1.67835262e-26,   1.07016799e-25,
-         6.82371225e-25,   4.35100369e-24,   1.91523482e-23,
-         8.06001537e-23,   3.23144235e-22,   4.34521997e-22,
-         1.18566090e-21,   3.16699528e-21,   8.31201995e-21,
-         2.15154075e-20,   5.51600847e-20,   7.21972469e-20,
-         1.34595234e-19,   2.50269468e-19,   3.41156366e-19,
-         4.16096744e-19,   5.66803746e-19,   1.05098304e-18,
-         1.94663211e-18,   3.60407863e-18,   4.67819652e-18,
-         6.36373536e-18,   8.65904266e-18,   1.17739845e-17,
-         1.60126190e-17,   2.06809005e-17,   2.81253637e-17,
-         3.82385968e-17,   4.91532870e-17,   6.68349199e-17,
-         9.08868981e-17,   1.19805457e-16,   1.23523557e-16,
-         1.67975513e-16,   2.14575704e-16,   2.38949918e-16,
-         2.71834450e-16,   3.69579177e-16,   4.80543818e-16,
-         6.22823125e-16,   6.44883854e-16,   6.51906933e-16,
-         6.90079430e-16,   7.51717272e-16,   7.84188682e-16,
-         8.12280996e-16,   8.94822824e-16,   1.78030908e-15,
-         2.83170525e-15,   4.35257355e-15,   6.44272433e-15,
-         9.21014776e-15,   1.72635532e-14,   2.96134301e-14,
-         4.76007735e-14,   7.28061891e-14,   1.06973879e-13,
-         1.78634067e-13,   3.17897582e-13,   4.16939514e-13};
-
-    double edat_low[]={
-         0.00000000e+00,   9.76800363e-24,   3.08891410e-23,
-         9.76800489e-23,   3.08891490e-22,   9.76801000e-22,
-         3.08891816e-21,   9.76803078e-21,   3.08893141e-20,
-         9.76811525e-20,   3.08898527e-19,   7.75906672e-19,
-         1.94909879e-18,   4.89622085e-18,   6.16357861e-18,
-         1.22969164e-17,   2.45420997e-17,   4.89823567e-17,
-         9.77310869e-17,   1.95024387e-16,   2.45531498e-16,
-         3.89264229e-16,   6.16926264e-16,   7.76837038e-16,
-         9.00642353e-16,   1.19237569e-15,   1.89037060e-15,
-         3.09452823e-15,   4.90635934e-15,   5.96458915e-15,
-         7.51061114e-15,   9.79776989e-15,   1.23353809e-14,
-         1.55335650e-14,   1.88188196e-14,   2.46271194e-14,
-         3.10096915e-14,   3.74392368e-14,   4.91814886e-14,
-         6.19454280e-14,   7.62224545e-14,   8.11155415e-14,
-         1.05200677e-13,   1.26436151e-13,   1.37076948e-13,
-         1.55799897e-13,   2.02900352e-13,   2.47139208e-13,
-         3.11281590e-13,   3.19529901e-13,   3.22140999e-13,
-         3.36213572e-13,   3.58537297e-13,   3.70113877e-13,
-         3.80033593e-13,   4.24821517e-13,   1.57119195e-12,
-         2.36083738e-12,   3.33152493e-12,   4.49715211e-12,
-         5.87555551e-12,   9.35905600e-12,   1.39898961e-11,
-         2.00067862e-11,   2.76245081e-11,   3.69196076e-11,
-         5.35224936e-11,   7.81020115e-11,   9.19476188e-11};
-
     // Populating first 69 points with low density EOS
     for(i=0;i<ndat_low;i++)
     {
@@ -325,6 +374,193 @@ LALSimNeutronStarEOS *XLALSimNeutronStarEOS4ParameterSpectralDecomposition(doubl
     return eos;
 }
 
+/**
+ * @brief Creates a workspace for repeated construction of spectral
+ * decomposition equations of state.
+ * @details The workspace holds the pressure grid and quadrature nodes used
+ * by XLALSimNeutronStarEOSSpectralDecompositionWithWorkspace(), which do not
+ * depend on the spectral parameters.  A workspace may be used for any
+ * number of constructions but only by one thread at a time.
+ * @return A pointer to the workspace.
+ */
+LALSimNeutronStarEOSSpectralWorkspace *XLALCreateSimNeutronStarEOSSpectralWorkspace(void)
+{
+    LALSimNeutronStarEOSSpectralWorkspace *ws;
+    double abscissae[SPECTRAL_NGL];
+    double logp0 = log(spectral_p0);
+    double dlogp = (log(spectral_p0 * exp(spectral_xmax)) - logp0) / SPECTRAL_NDAT_HIGH;
+    size_t i, j, k;
+
+    ws = XLALMalloc(sizeof(*ws));
+    XLAL_CHECK_NULL(ws, XLAL_ENOMEM);
+
+    for (i = 0; i < SPECTRAL_NDAT_LOW; ++i) {
+        ws->pdat[i] = pdat_low[i];
+        ws->edat[i] = edat_low[i];
+    }
+
+    resetAbscissae(abscissae);
+    for (i = 0; i < SPECTRAL_NDAT_HIGH; ++i) {
+        double x;
+        ws->pdat[i + SPECTRAL_NDAT_LOW] = exp(logp0 + dlogp * i);
+        x = ws->xdat[i] = log(ws->pdat[i + SPECTRAL_NDAT_LOW] / spectral_p0);
+        for (j = 0; j < SPECTRAL_NGL; ++j) {
+            double y = (x / 2.0) * abscissae[j] + x / 2.0;
+            ws->outer[i * SPECTRAL_NGL + j] = y;
+            ws->expouter[i * SPECTRAL_NGL + j] = exp(y);
+            for (k = 0; k < SPECTRAL_NGL; ++k)
+                ws->inner[(i * SPECTRAL_NGL + j) * SPECTRAL_NGL + k] =
+                    (y / 2.0) * abscissae[k] + y / 2.0;
+        }
+    }
+
+    return ws;
+}
+
+/**
+ * @brief Frees a workspace for spectral decomposition equations of state.
+ * @param ws Pointer to the workspace to be freed.
+ */
+void XLALDestroySimNeutronStarEOSSpectralWorkspace(LALSimNeutronStarEOSSpectralWorkspace *ws)
+{
+    XLALFree(ws);
+    return;
+}
+
+/**
+ * @brief Reads spectral decomposition eos parameters to make an eos, using
+ * a workspace that is reused between constructions.
+ * @details Constructs the same equation of state as
+ * XLALSimNeutronStarEOSSpectralDecomposition(), with the same pressure grid
+ * and quadrature rule, but evaluates the adiabatic index at all quadrature
+ * nodes of the grid in a single pass before forming the integrals, and
+ * takes the grid and nodes from the workspace @a ws.
+ * @param[in] gamma[] Array of spectral decomposition eos parameters.
+ * @param[in] size The length of the gamma array.
+ * @param ws Pointer to a workspace created with
+ * XLALCreateSimNeutronStarEOSSpectralWorkspace().
+ * @return A pointer to neutron star equation of state structure.
+ */
+LALSimNeutronStarEOS *XLALSimNeutronStarEOSSpectralDecompositionWithWorkspace(double gamma[], int size, LALSimNeutronStarEOSSpectralWorkspace *ws)
+{
+    LALSimNeutronStarEOS * eos;
+    const double *w = spectral_gl_weights;
+    size_t i, j, k;
+
+    XLAL_CHECK_NULL(gamma && ws, XLAL_EFAULT);
+    XLAL_CHECK_NULL(size > 0, XLAL_EINVAL);
+
+    /* 1 / Gamma at all quadrature nodes */
+    spectral_inverse_adiabatic_index(ws->gouter, ws->outer,
+        SPECTRAL_NDAT_HIGH * SPECTRAL_NGL, gamma, size);
+    spectral_inverse_adiabatic_index(ws->ginner, ws->inner,
+        SPECTRAL_NDAT_HIGH * SPECTRAL_NGL * SPECTRAL_NGL, gamma, size);
+
+    /* Eqs. 7 and 8 of PRD 82 103011 (2010); see
+     * eos_e_of_p_spectral_decomposition() */
+    for (i = 0; i < SPECTRAL_NDAT_HIGH; ++i) {
+        const double x = ws->xdat[i];
+        const double *y = ws->outer + i * SPECTRAL_NGL;
+        const double *expy = ws->expouter + i * SPECTRAL_NGL;
+        const double *g1 = ws->gouter + i * SPECTRAL_NGL;
+        const double *g2 = ws->ginner + i * SPECTRAL_NGL * SPECTRAL_NGL;
+        double Integral = 0.0;
+        double mu;
+
+        for (j = 0; j < SPECTRAL_NGL; ++j)
+            Integral += w[j] * g1[j];
+        mu = exp(-Integral * (x / 2.0));
+
+        Integral = 0.0;
+        for (j = 0; j < SPECTRAL_NGL; ++j) {
+            double IPrime = 0.0;
+            for (k = 0; k < SPECTRAL_NGL; ++k)
+                IPrime += w[k] * g2[j * SPECTRAL_NGL + k];
+            IPrime = exp(-IPrime * (y[j] / 2.0));
+            Integral += w[j] * (expy[j] * IPrime * g1[j]);
+        }
+        Integral *= (x / 2.0);
+
+        ws->edat[i + SPECTRAL_NDAT_LOW] = spectral_e0 / mu + (spectral_p0 / mu) * Integral;
+    }
+
+    eos = eos_alloc_tabular(NULL, ws->edat, ws->pdat, NULL, NULL, NULL, NULL, NULL, SPECTRAL_NDAT, 2);
+    XLAL_CHECK_NULL(eos, XLAL_EFUNC);
+
+    if (size >= 4) {
+        if (snprintf(eos->name, sizeof(eos->name), "4-Param Spec Decomp (g0=%.4g, g1=%.4g, g2=%.4g, g3=%.4g)",
+            gamma[0], gamma[1], gamma[2], gamma[3]) >= (int) sizeof(eos->name))
+            XLAL_PRINT_WARNING("EOS name too long");
+    } else
+        snprintf(eos->name, sizeof(eos->name), "%d-Param Spec Decomp", size);
+
+    return eos;
+}
+
+/**
+ * @brief Makes many spectral decomposition eos at once.
+ * @details Constructs @a n equations of state, the ith of which has the
+ * spectral decomposition parameters gamma[i * size] to
+ * gamma[i * size + size - 1], as with
+ * XLALSimNeutronStarEOSSpectralDecompositionWithWorkspace().  The
+ * constructions are shared between threads when compiled with OpenMP, each
+ * thread using its own workspace.
+ * @param[out] eos Array of @a n pointers to the constructed equations of
+ * state; all are NULL on failure.
+ * @param[in] gamma Array of n * size spectral decomposition eos parameters.
+ * @param[in] size The number of spectral parameters of each eos.
+ * @param[in] n The number of eos to construct.
+ * @return 0 on success, or an XLAL error code on failure.
+ */
+int XLALSimNeutronStarEOSSpectralDecompositionBatch(LALSimNeutronStarEOS **eos, const double *gamma, int size, size_t n)
+{
+    int errnum = 0;
+    size_t i;
+
+    XLAL_CHECK(n == 0 || (eos && gamma), XLAL_EFAULT);
+    XLAL_CHECK(size > 0, XLAL_EINVAL);
+
+    for (i = 0; i < n; ++i)
+        eos[i] = NULL;
+
+    #pragma omp parallel
+    {
+        LALSimNeutronStarEOSSpectralWorkspace *ws = XLALCreateSimNeutronStarEOSSpectralWorkspace();
+        long l;
+
+        if (!ws) {
+            #pragma omp critical (XLALSimNeutronStarEOSSpectralDecompositionBatch)
+            errnum = XLAL_EFUNC;
+        }
+
+        #pragma omp for schedule(dynamic)
+        for (l = 0; l < (long)n; ++l) {
+            if (ws) {
+                double g[size];
+                memcpy(g, gamma + l * size, sizeof(g));
+                eos[l] = XLALSimNeutronStarEOSSpectralDecompositionWithWorkspace(g, size, ws);
+                if (!eos[l]) {
+                    #pragma omp critical (XLALSimNeutronStarEOSSpectralDecompositionBatch)
+                    errnum = XLAL_EFUNC;
+                }
+            }
+        }
+
+        XLALDestroySimNeutronStarEOSSpectralWorkspace(ws);
+    }
+
+    if (errnum) {
+        for (i = 0; i < n; ++i) {
+            if (eos[i])
+                XLALDestroySimNeutronStarEOS(eos[i]);
+            eos[i] = NULL;
+        }
+        XLAL_ERROR(errnum);
+    }
+
+    return 0;
+}
+
 /**
  * @brief Check that EOS has adiabatic index in range (0.6,4.5)
  * @details Reads 4 spectral decomposition eos parameters and checks that the
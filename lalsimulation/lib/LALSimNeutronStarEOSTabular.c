@@ -260,6 +260,58 @@ static void eos_free_tabular(LALSimNeutronStarEOS * eos)
     return;
 }
 
+/* A thread copy shares the tables and interpolants of the original EOS
+ * but owns its accelerators, which are the only state modified during
+ * evaluation; only the accelerators and the structures themselves are
+ * freed here. */
+static void eos_free_tabular_thread_copy(LALSimNeutronStarEOS * eos)
+{
+    if (eos) {
+        LALSimNeutronStarEOSDataTabular *data = eos->data.tabular;
+        gsl_interp_accel_free(data->log_e_of_log_p_acc);
+        gsl_interp_accel_free(data->log_e_of_log_h_acc);
+        gsl_interp_accel_free(data->log_p_of_log_h_acc);
+        gsl_interp_accel_free(data->log_h_of_log_p_acc);
+        gsl_interp_accel_free(data->log_rho_of_log_h_acc);
+        gsl_interp_accel_free(data->log_p_of_log_e_acc);
+        gsl_interp_accel_free(data->log_p_of_log_rho_acc);
+        gsl_interp_accel_free(data->log_cs2_of_log_h_acc);
+        LALFree(data);
+        LALFree(eos);
+    }
+    return;
+}
+
+static LALSimNeutronStarEOS *eos_thread_copy_tabular(LALSimNeutronStarEOS *
+    eos)
+{
+    LALSimNeutronStarEOS *copy;
+    LALSimNeutronStarEOSDataTabular *data;
+
+    copy = LALMalloc(sizeof(*copy));
+    data = LALMalloc(sizeof(*data));
+    if (!copy || !data) {
+        LALFree(data);
+        LALFree(copy);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    *copy = *eos;
+    *data = *eos->data.tabular;
+    copy->data.tabular = data;
+    copy->free = eos_free_tabular_thread_copy;
+
+    data->log_e_of_log_p_acc = gsl_interp_accel_alloc();
+    data->log_h_of_log_p_acc = gsl_interp_accel_alloc();
+    data->log_e_of_log_h_acc = gsl_interp_accel_alloc();
+    data->log_p_of_log_h_acc = gsl_interp_accel_alloc();
+    data->log_rho_of_log_h_acc = gsl_interp_accel_alloc();
+    data->log_p_of_log_e_acc = gsl_interp_accel_alloc();
+    data->log_p_of_log_rho_acc = gsl_interp_accel_alloc();
+    data->log_cs2_of_log_h_acc = gsl_interp_accel_alloc();
+
+    return copy;
+}
+
 /* Finding density where EOS becomes acausal */
 
 /* Evaluate vSound at each tabulated point until vSound>1 or you get to last
@@ -30,7 +30,14 @@
 #include <gsl/gsl_min.h>
 GSL_VAR const gsl_interp_type * lal_gsl_interp_steffen;
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
 #include <lal/LALStdlib.h>
+#include <lal/LALString.h>
+#include <lal/FileIO.h>
 #include <lal/LALSimNeutronStar.h>
 
 /** @cond */
@@ -60,6 +67,136 @@ static double fminimizer_gslfunction(double x, void * params)
     return -m; /* maximum mass is minimum negative mass */
 }
 
+/* allocates a family with room for ndat stars */
+static LALSimNeutronStarFamily *fam_alloc(size_t ndat)
+{
+    LALSimNeutronStarFamily *fam;
+    fam = LALCalloc(1, sizeof(*fam));
+    if (!fam)
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    fam->ndat = ndat;
+    fam->pdat = LALMalloc(ndat * sizeof(*fam->pdat));
+    fam->mdat = LALMalloc(ndat * sizeof(*fam->mdat));
+    fam->rdat = LALMalloc(ndat * sizeof(*fam->rdat));
+    fam->kdat = LALMalloc(ndat * sizeof(*fam->kdat));
+    if (!fam->pdat || !fam->mdat || !fam->rdat || !fam->kdat) {
+        XLALDestroySimNeutronStarFamily(fam);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    return fam;
+}
+
+/* sets up the interpolators of a family whose tables have been filled */
+static void fam_init_interp(LALSimNeutronStarFamily * fam)
+{
+    size_t ndat = fam->ndat;
+
+    fam->p_of_m_acc = gsl_interp_accel_alloc();
+    fam->r_of_m_acc = gsl_interp_accel_alloc();
+    fam->k_of_m_acc = gsl_interp_accel_alloc();
+
+    fam->p_of_m_interp = gsl_interp_alloc(gsl_interp_cspline, ndat);
+    fam->r_of_m_interp = gsl_interp_alloc(lal_gsl_interp_steffen, ndat);
+    fam->k_of_m_interp = gsl_interp_alloc(lal_gsl_interp_steffen, ndat);
+
+    gsl_interp_init(fam->p_of_m_interp, fam->mdat, fam->pdat, ndat);
+    gsl_interp_init(fam->r_of_m_interp, fam->mdat, fam->rdat, ndat);
+    gsl_interp_init(fam->k_of_m_interp, fam->mdat, fam->kdat, ndat);
+
+    return;
+}
+
+/* header of a cached family file */
+#define FAM_CACHE_MAGIC "LALNSFAM"
+#define FAM_CACHE_VERSION 1
+
+struct fam_cache_header {
+    char magic[8];
+    UINT4 version;
+    UINT4 reserved;
+    UINT8 hash;
+    UINT8 ndat;
+};
+
+/* reads a family from a cache file; returns NULL without raising an
+ * error if the file does not exist or does not match the EOS hash */
+static LALSimNeutronStarFamily *fam_cache_read(const char *path, UINT8 hash)
+{
+    LALSimNeutronStarFamily *fam = NULL;
+    struct fam_cache_header hdr;
+    LALFILE *fp;
+    size_t n;
+    int errnum;
+
+    XLAL_TRY(fp = XLALFileOpenRead(path), errnum);
+    if (!fp || errnum)
+        return NULL;
+
+    if (XLALFileRead(&hdr, sizeof(hdr), 1, fp) != 1
+        || memcmp(hdr.magic, FAM_CACHE_MAGIC, sizeof(hdr.magic))
+        || hdr.version != FAM_CACHE_VERSION || hdr.hash != hash
+        || hdr.ndat < 2)
+        goto done;
+
+    n = hdr.ndat;
+    fam = fam_alloc(n);
+    if (!fam)
+        goto done;
+    if (XLALFileRead(fam->pdat, sizeof(*fam->pdat), n, fp) != n
+        || XLALFileRead(fam->mdat, sizeof(*fam->mdat), n, fp) != n
+        || XLALFileRead(fam->rdat, sizeof(*fam->rdat), n, fp) != n
+        || XLALFileRead(fam->kdat, sizeof(*fam->kdat), n, fp) != n) {
+        XLALDestroySimNeutronStarFamily(fam);
+        fam = NULL;
+        goto done;
+    }
+    fam_init_interp(fam);
+
+  done:
+    XLALFileClose(fp);
+    XLALClearErrno();
+    return fam;
+}
+
+/* writes a family to a cache file; the file is written under a temporary
+ * name and renamed so that concurrent readers never see a partial file */
+static int fam_cache_write(const char *path, UINT8 hash,
+    LALSimNeutronStarFamily * fam)
+{
+    struct fam_cache_header hdr;
+    char *tmppath;
+    LALFILE *fp;
+    size_t n = fam->ndat;
+    int ok;
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, FAM_CACHE_MAGIC, sizeof(hdr.magic));
+    hdr.version = FAM_CACHE_VERSION;
+    hdr.hash = hash;
+    hdr.ndat = n;
+
+    tmppath = XLALStringAppendFmt(NULL, "%s.%ld.tmp", path, (long)getpid());
+    XLAL_CHECK(tmppath, XLAL_EFUNC);
+    fp = XLALFileOpenWrite(tmppath, 0);
+    if (!fp) {
+        XLALFree(tmppath);
+        XLAL_ERROR(XLAL_EIO, "Could not open cache file %s", path);
+    }
+    ok = XLALFileWrite(&hdr, sizeof(hdr), 1, fp) == 1
+        && XLALFileWrite(fam->pdat, sizeof(*fam->pdat), n, fp) == n
+        && XLALFileWrite(fam->mdat, sizeof(*fam->mdat), n, fp) == n
+        && XLALFileWrite(fam->rdat, sizeof(*fam->rdat), n, fp) == n
+        && XLALFileWrite(fam->kdat, sizeof(*fam->kdat), n, fp) == n;
+    XLALFileClose(fp);
+    if (!ok || rename(tmppath, path) != 0) {
+        remove(tmppath);
+        XLALFree(tmppath);
+        XLAL_ERROR(XLAL_EIO, "Could not write cache file %s", path);
+    }
+    XLALFree(tmppath);
+    return 0;
+}
+
 /** @endcond */
 
 /**
@@ -174,22 +311,290 @@ LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamily(
     fam->ndat = ndat;
 
     /* setup interpolators */
+    fam_init_interp(fam);
 
-    fam->p_of_m_acc = gsl_interp_accel_alloc();
-    fam->r_of_m_acc = gsl_interp_accel_alloc();
-    fam->k_of_m_acc = gsl_interp_accel_alloc();
+    return fam;
+}
 
-    fam->p_of_m_interp = gsl_interp_alloc(gsl_interp_cspline, ndat);
-    fam->r_of_m_interp = gsl_interp_alloc(lal_gsl_interp_steffen, ndat);
-    fam->k_of_m_interp = gsl_interp_alloc(lal_gsl_interp_steffen, ndat);
+/**
+ * @brief Creates a neutron star family structure for a given equation of
+ * state, integrating the stars concurrently.
+ * @details
+ * This produces the same kind of family as XLALCreateSimNeutronStarFamily()
+ * but integrates the TOV equations for the grid of central pressures in
+ * parallel (when compiled with OpenMP), with each thread evaluating its own
+ * copy of the EOS.  Rather than stopping at the first grid point past the
+ * maximum mass, the whole grid is integrated at once and the bracket
+ * containing the maximum is then refined with additional stars, so the
+ * family is sampled more densely near the maximum mass where the
+ * mass-radius relation turns over.
+ * @param eos Pointer to the Equation of State structure.
+ * @return A pointer to the neutron star family structure.
+ */
+LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamilyParallel(
+    LALSimNeutronStarEOS * eos)
+{
+    enum { NGRID = 100, NREFINE = 8, NSEQ = 2 * NREFINE + 3 };
+    const double logpmin = 75.5;
+    double pgrid[NGRID], rgrid[NGRID], mgrid[NGRID], kgrid[NGRID];
+    double pseq[NSEQ], rseq[NSEQ], mseq[NSEQ], kseq[NSEQ];
+    double logpmax, dlogp;
+    double pmax, rmax, mmax, kmax;
+    LALSimNeutronStarFamily *fam;
+    long src[NSEQ];
+    size_t imax, lo, hi, jmax, nseq;
+    size_t i, j, n;
 
-    gsl_interp_init(fam->p_of_m_interp, fam->mdat, fam->pdat, ndat);
-    gsl_interp_init(fam->r_of_m_interp, fam->mdat, fam->rdat, ndat);
-    gsl_interp_init(fam->k_of_m_interp, fam->mdat, fam->kdat, ndat);
+    XLAL_CHECK_NULL(eos, XLAL_EFAULT);
+
+    /* integrate the whole grid of central pressures */
+    logpmax = log(XLALSimNeutronStarEOSMaxPressure(eos));
+    dlogp = (logpmax - logpmin) / NGRID;
+    for (i = 0; i < NGRID; ++i)
+        pgrid[i] = exp(logpmin + i * dlogp);
+    XLAL_CHECK_NULL(XLALSimNeutronStarTOVODEIntegrateMany(rgrid, mgrid,
+        kgrid, pgrid, NGRID, eos) == 0, XLAL_EFUNC);
+
+    /* find the first grid point past the maximum mass */
+    for (i = 1; i < NGRID; ++i)
+        if (mgrid[i] <= mgrid[i - 1])
+            break;
+
+    if (i == NGRID) {
+        /* mass increases up to the maximum pressure of the EOS */
+        fam = fam_alloc(NGRID);
+        XLAL_CHECK_NULL(fam, XLAL_EFUNC);
+        memcpy(fam->pdat, pgrid, sizeof(pgrid));
+        memcpy(fam->mdat, mgrid, sizeof(mgrid));
+        memcpy(fam->rdat, rgrid, sizeof(rgrid));
+        memcpy(fam->kdat, kgrid, sizeof(kgrid));
+        fam_init_interp(fam);
+        return fam;
+    }
+
+    /* refine the bracket [lo, hi] around the largest grid mass imax with
+     * NREFINE log-spaced stars on either side of imax; src[j] is the grid
+     * index of stars that have already been integrated, or -1 */
+    imax = i - 1;
+    lo = imax > 0 ? imax - 1 : 0;
+    hi = imax + 1;
+    nseq = 0;
+    src[nseq] = lo;
+    pseq[nseq++] = pgrid[lo];
+    if (lo < imax) {
+        double dl = log(pgrid[imax] / pgrid[lo]) / (NREFINE + 1);
+        for (j = 1; j <= NREFINE; ++j) {
+            src[nseq] = -1;
+            pseq[nseq++] = pgrid[lo] * exp(j * dl);
+        }
+        src[nseq] = imax;
+        pseq[nseq++] = pgrid[imax];
+    }
+    {
+        double dl = log(pgrid[hi] / pgrid[imax]) / (NREFINE + 1);
+        for (j = 1; j <= NREFINE; ++j) {
+            src[nseq] = -1;
+            pseq[nseq++] = pgrid[imax] * exp(j * dl);
+        }
+    }
+    src[nseq] = hi;
+    pseq[nseq++] = pgrid[hi];
+    {
+        double pnew[NSEQ], rnew[NSEQ], mnew[NSEQ], knew[NSEQ];
+        size_t nnew = 0;
+        for (j = 0; j < nseq; ++j)
+            if (src[j] < 0)
+                pnew[nnew++] = pseq[j];
+        XLAL_CHECK_NULL(XLALSimNeutronStarTOVODEIntegrateMany(rnew, mnew,
+            knew, pnew, nnew, eos) == 0, XLAL_EFUNC);
+        for (j = 0, n = 0; j < nseq; ++j) {
+            if (src[j] < 0) {
+                rseq[j] = rnew[n];
+                mseq[j] = mnew[n];
+                kseq[j] = knew[n];
+                ++n;
+            } else {
+                rseq[j] = rgrid[src[j]];
+                mseq[j] = mgrid[src[j]];
+                kseq[j] = kgrid[src[j]];
+            }
+        }
+    }
+
+    /* locate the maximum mass in the refined bracket with Brent's method */
+    for (jmax = 1, j = 2; j < nseq - 1; ++j)
+        if (mseq[j] > mseq[jmax])
+            jmax = j;
+    pmax = pseq[jmax];
+    rmax = rseq[jmax];
+    mmax = mseq[jmax];
+    kmax = kseq[jmax];
+    if (mseq[jmax] > mseq[jmax - 1] && mseq[jmax] > mseq[jmax + 1]) {
+        const double epsabs = 0.0, epsrel = 1e-6;
+        double a = pseq[jmax - 1];
+        double x = pseq[jmax];
+        double b = pseq[jmax + 1];
+        int status;
+        gsl_function F;
+        gsl_min_fminimizer * s;
+        F.function = &fminimizer_gslfunction;
+        F.params = eos;
+        s = gsl_min_fminimizer_alloc(gsl_min_fminimizer_brent);
+        gsl_min_fminimizer_set_with_values(s, &F, x, -mseq[jmax], a,
+            -mseq[jmax - 1], b, -mseq[jmax + 1]);
+        do {
+            status = gsl_min_fminimizer_iterate(s);
+            x = gsl_min_fminimizer_x_minimum(s);
+            a = gsl_min_fminimizer_x_lower(s);
+            b = gsl_min_fminimizer_x_upper(s);
+            status = gsl_min_test_interval(a, b, epsabs, epsrel);
+        } while (status == GSL_CONTINUE);
+        gsl_min_fminimizer_free(s);
+        pmax = x;
+        XLALSimNeutronStarTOVODEIntegrate(&rmax, &mmax, &kmax, pmax, eos);
+    }
+
+    /* assemble the family: grid points below the bracket, the refined
+     * points below the maximum, and the maximum mass itself, keeping only
+     * stars of strictly increasing pressure and mass */
+    fam = fam_alloc(lo + jmax + 1);
+    XLAL_CHECK_NULL(fam, XLAL_EFUNC);
+    for (i = 0, n = 0; i < lo + jmax; ++i) {
+        double p = i < lo ? pgrid[i] : pseq[i - lo];
+        double m = i < lo ? mgrid[i] : mseq[i - lo];
+        if (n > 0 && (p <= fam->pdat[n - 1] || m <= fam->mdat[n - 1]))
+            continue;
+        fam->pdat[n] = p;
+        fam->mdat[n] = m;
+        fam->rdat[n] = i < lo ? rgrid[i] : rseq[i - lo];
+        fam->kdat[n] = i < lo ? kgrid[i] : kseq[i - lo];
+        ++n;
+    }
+    /* the maximum mass replaces any star it does not exceed */
+    while (n > 0 && (pmax <= fam->pdat[n - 1] || mmax <= fam->mdat[n - 1]))
+        --n;
+    fam->pdat[n] = pmax;
+    fam->mdat[n] = mmax;
+    fam->rdat[n] = rmax;
+    fam->kdat[n] = kmax;
+    ++n;
+    fam->ndat = n;
+    fam_init_interp(fam);
 
     return fam;
 }
 
+/**
+ * @brief Creates a neutron star family structure for a given equation of
+ * state, using an on-disk cache.
+ * @details
+ * The family is looked up in the directory @a cachedir in a file whose
+ * name is derived from XLALSimNeutronStarEOSHash() of @a eos.  If no valid
+ * cache file exists, the family is created with
+ * XLALCreateSimNeutronStarFamilyParallel() and stored in the cache for
+ * later use.  Failure to write the cache is not an error.  If @a cachedir
+ * is NULL, the directory named by the environment variable
+ * LAL_SIM_NEUTRON_STAR_FAMILY_CACHE is used; if that is not set either,
+ * no cache is used.
+ * @param eos Pointer to the Equation of State structure.
+ * @param cachedir Directory holding the cache files, or NULL.
+ * @return A pointer to the neutron star family structure.
+ */
+LALSimNeutronStarFamily * XLALCreateSimNeutronStarFamilyCached(
+    LALSimNeutronStarEOS * eos, const char *cachedir)
+{
+    LALSimNeutronStarFamily *fam;
+    char *path;
+    UINT8 hash;
+
+    XLAL_CHECK_NULL(eos, XLAL_EFAULT);
+
+    if (!cachedir)
+        cachedir = getenv("LAL_SIM_NEUTRON_STAR_FAMILY_CACHE");
+    if (!cachedir || !*cachedir) {
+        fam = XLALCreateSimNeutronStarFamilyParallel(eos);
+        XLAL_CHECK_NULL(fam, XLAL_EFUNC);
+        return fam;
+    }
+
+    hash = XLALSimNeutronStarEOSHash(eos);
+    path = XLALStringAppendFmt(NULL, "%s/LALSimNeutronStarFamily-%016llx.dat",
+        cachedir, (unsigned long long)hash);
+    XLAL_CHECK_NULL(path, XLAL_EFUNC);
+
+    fam = fam_cache_read(path, hash);
+    if (!fam) {
+        int errnum;
+        fam = XLALCreateSimNeutronStarFamilyParallel(eos);
+        if (!fam) {
+            XLALFree(path);
+            XLAL_ERROR_NULL(XLAL_EFUNC);
+        }
+        XLAL_TRY(fam_cache_write(path, hash, fam), errnum);
+        if (errnum)
+            XLALPrintWarning("XLAL Warning - %s: could not write neutron star family cache file %s\n", __func__, path);
+    }
+
+    XLALFree(path);
+    return fam;
+}
+
+/**
+ * @brief Evaluates the radius, Love number k2 and dimensionless tidal
+ * deformability of neutron stars of many masses.
+ * @details
+ * This is equivalent to calling XLALSimNeutronStarRadius() and
+ * XLALSimNeutronStarLoveNumberK2() for each mass but uses a single
+ * interpolation accelerator local to the call, so it is efficient for
+ * sorted masses and may be called concurrently on the same family.  The
+ * dimensionless tidal deformability is Lambda = (2/3) k2 / C^5 where
+ * C = G m / (c^2 R) is the compactness.  Any of the output arrays may be
+ * NULL if that quantity is not required.
+ * @param[out] radius Radii of the neutron stars (m).
+ * @param[out] k2 Tidal Love numbers k2 of the neutron stars.
+ * @param[out] lambda Dimensionless tidal deformabilities of the stars.
+ * @param[in] mass Masses of the neutron stars (kg).
+ * @param[in] n Number of masses.
+ * @param[in] fam Pointer to the neutron star family structure.
+ * @return 0 on success, or an XLAL error code on failure.
+ */
+int XLALSimNeutronStarFamilyEvaluate(double *radius, double *k2,
+    double *lambda, const double *mass, size_t n,
+    LALSimNeutronStarFamily * fam)
+{
+    gsl_interp_accel *acc;
+    double mmin, mmax;
+    size_t i;
+
+    XLAL_CHECK(fam && (mass || n == 0), XLAL_EFAULT);
+    mmin = fam->mdat[0];
+    mmax = fam->mdat[fam->ndat - 1];
+    for (i = 0; i < n; ++i)
+        XLAL_CHECK(mass[i] >= mmin && mass[i] <= mmax, XLAL_EDOM,
+            "Mass %g kg outside range [%g, %g] kg of neutron star family",
+            mass[i], mmin, mmax);
+
+    acc = gsl_interp_accel_alloc();
+    XLAL_CHECK(acc, XLAL_ENOMEM);
+    for (i = 0; i < n; ++i) {
+        double r = gsl_interp_eval(fam->r_of_m_interp, fam->mdat, fam->rdat,
+            mass[i], acc);
+        double k = gsl_interp_eval(fam->k_of_m_interp, fam->mdat, fam->kdat,
+            mass[i], acc);
+        if (radius)
+            radius[i] = r;
+        if (k2)
+            k2[i] = k;
+        if (lambda) {
+            double c = LAL_MRSUN_SI * (mass[i] / LAL_MSUN_SI) / r;
+            lambda[i] = (2.0 / 3.0) * k / pow(c, 5);
+        }
+    }
+    gsl_interp_accel_free(acc);
+
+    return 0;
+}
+
 /**
  * @brief Returns the minimum mass of a neutron star family.
  * @param fam Pointer to the neutron star family structure.
@@ -31,6 +31,10 @@
 #include <lal/LALConstants.h>
 #include <lal/LALSimNeutronStar.h>
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 /** @cond */
 
 /* Implements Eq. (50) of Damour & Nagar, Phys. Rev. D 80 084035 (2009).
@@ -446,6 +450,62 @@ int XLALSimNeutronStarTOVODEIntegrate(double *radius, double *mass,
     return XLALSimNeutronStarTOVODEIntegrateWithTolerance(radius, mass, love_number_k2, central_pressure_si, eos, epsrel);
 }
 
+/**
+ * @brief Integrates the Tolman-Oppenheimer-Volkov stellar structure equations
+ * for many stars of the same equation of state.
+ * @details
+ * Equivalent to calling XLALSimNeutronStarTOVODEIntegrate() for each of the
+ * @a n central pressures, but the stars are integrated concurrently when
+ * compiled with OpenMP.  Each thread evaluates its own copy of @a eos made
+ * with XLALSimNeutronStarEOSThreadCopy(), so @a eos itself is not modified.
+ * @param[out] radius The radii of the stars in m.
+ * @param[out] mass The masses of the stars in kg.
+ * @param[out] love_number_k2 The k_2 tidal love numbers of the stars.
+ * @param[in] central_pressure_si The central pressures of the stars in Pa.
+ * @param[in] n The number of stars.
+ * @param eos Pointer to the Equation of State structure.
+ * @retval 0 Success.
+ * @retval <0 Failure.
+ */
+int XLALSimNeutronStarTOVODEIntegrateMany(double *radius, double *mass,
+    double *love_number_k2, const double *central_pressure_si, size_t n,
+    LALSimNeutronStarEOS * eos)
+{
+    int errnum = 0;
+
+    XLAL_CHECK(eos, XLAL_EFAULT);
+    XLAL_CHECK(n == 0 || (radius && mass && love_number_k2
+        && central_pressure_si), XLAL_EFAULT);
+
+    #pragma omp parallel
+    {
+        LALSimNeutronStarEOS *myeos = XLALSimNeutronStarEOSThreadCopy(eos);
+        long i;
+
+        if (!myeos) {
+            #pragma omp critical (XLALSimNeutronStarTOVODEIntegrateMany)
+            errnum = XLAL_EFUNC;
+        }
+
+        #pragma omp for schedule(dynamic)
+        for (i = 0; i < (long)n; ++i) {
+            if (myeos && XLALSimNeutronStarTOVODEIntegrate(&radius[i],
+                    &mass[i], &love_number_k2[i], central_pressure_si[i],
+                    myeos) < 0) {
+                #pragma omp critical (XLALSimNeutronStarTOVODEIntegrateMany)
+                errnum = XLAL_EFUNC;
+            }
+        }
+
+        if (myeos)
+            XLALDestroySimNeutronStarEOS(myeos);
+    }
+
+    if (errnum)
+        XLAL_ERROR(errnum);
+    return 0;
+}
+
 int XLALSimNeutronStarVirialODEIntegrate(double *radius, double *mass,
     double *int1, double *int2, double *int3, double *int4, double *int5, double *int6, 
     double *love_number_k2, double central_pressure_si,
@@ -23,6 +23,7 @@
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 
+#include <lal/AVFactories.h>
 #include <lal/Date.h>
 #include <lal/LALConstants.h>
 #include <lal/LALStdlib.h>
@@ -33,6 +34,12 @@
 #include <lal/Units.h>
 #include <lal/LALSimNoise.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#define omp ignore
+#endif
+
 
 /* 
  * This routine generates a single segment of data.  Note that this segment is
@@ -197,6 +204,315 @@ int XLALSimNoise(
 	return 0;
 }
 
+/*
+ * Counter-based random number generator used for the reproducible noise
+ * streams.  Sample k of segment i is obtained by applying the splitmix64
+ * finalizer to the counter (i << 32 | k) offset by a key derived from the
+ * seed, so every segment has its own non-overlapping substream that can be
+ * generated independently of all others.  It is wrapped as a GSL generator
+ * so that the usual GSL Gaussian deviates can be drawn from it.
+ */
+
+typedef struct tagSimNoiseCounterRNGState {
+	UINT8 key;
+	UINT8 counter;
+} SimNoiseCounterRNGState;
+
+static UINT8 splitmix64_mix(UINT8 z)
+{
+	z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+	z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+	return z ^ (z >> 31);
+}
+
+static void counter_rng_set(void *vstate, unsigned long int seed)
+{
+	SimNoiseCounterRNGState *state = vstate;
+	state->key = splitmix64_mix(seed + UINT64_C(0x9e3779b97f4a7c15));
+	state->counter = 0;
+}
+
+static UINT8 counter_rng_next(SimNoiseCounterRNGState *state)
+{
+	return splitmix64_mix(state->key + UINT64_C(0x9e3779b97f4a7c15) * state->counter++);
+}
+
+static unsigned long int counter_rng_get(void *vstate)
+{
+	return counter_rng_next(vstate) >> 32;
+}
+
+static double counter_rng_get_double(void *vstate)
+{
+	return (counter_rng_next(vstate) >> 11) * 0x1.0p-53;
+}
+
+static const gsl_rng_type counter_rng_type = {
+	"lalsim_noise_counter",
+	UINT32_C(0xffffffff),
+	0,
+	sizeof(SimNoiseCounterRNGState),
+	counter_rng_set,
+	counter_rng_get,
+	counter_rng_get_double
+};
+
+/*
+ * Generates the segment with the given index of the noise stream for a seed
+ * into data, using the reverse plan and frequency-domain workspace supplied
+ * by the caller.  As in XLALSimNoiseSegment(), the data is periodic.
+ */
+static int XLALSimNoiseSegmentSeeded(REAL8Vector *data, COMPLEX16Vector *work, const REAL8FrequencySeries *psd, const REAL8FFTPlan *plan, double deltaT, gsl_rng *rng, unsigned long seed, UINT8 index)
+{
+	const double deltaF = 1.0 / (data->length * deltaT);
+	SimNoiseCounterRNGState *state = rng->state;
+	size_t k;
+
+	gsl_rng_set(rng, seed);
+	state->counter = index << 32;
+
+	for (k = 0; k < work->length; ++k) {
+		double sigma = 0.5 * sqrt(psd->data->data[k] / psd->deltaF);
+		work->data[k] = gsl_ran_gaussian_ziggurat(rng, sigma);
+		work->data[k] += I * gsl_ran_gaussian_ziggurat(rng, sigma);
+	}
+
+	if (XLALREAL8ReverseFFT(data, work, plan) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	for (k = 0; k < data->length; ++k)
+		data->data[k] *= deltaF;
+
+	return 0;
+}
+
+/*
+ * Fills s with samples [offset, offset + s->data->length) of the noise
+ * stream for a seed, using a reverse plan for the segment length.
+ */
+static int XLALSimNoiseParallelWithPlan(REAL8TimeSeries *s, UINT8 offset, const REAL8FrequencySeries *psd, unsigned long seed, const REAL8FFTPlan *plan)
+{
+	const size_t seglen = 2 * (psd->data->length - 1);
+	const size_t stride = seglen / 2;
+	const UINT8 first = offset / stride;
+	const UINT8 last = (offset + s->data->length - 1) / stride;
+	size_t nbuf = 4;
+	REAL8 *buf;
+	REAL8 *prev;
+	REAL8 *feather;
+	int errnum = 0;
+	UINT8 b;
+	size_t j;
+
+#ifdef _OPENMP
+	nbuf *= omp_get_max_threads();
+#endif
+	if (nbuf > last - first + 1)
+		nbuf = last - first + 1;
+
+	/* segments needed for the current batch of output blocks, plus the
+	 * last segment of the previous batch */
+	buf = XLALMalloc(nbuf * seglen * sizeof(*buf));
+	prev = XLALMalloc(seglen * sizeof(*prev));
+	feather = XLALMalloc(2 * stride * sizeof(*feather));
+	if (!buf || !prev || !feather) {
+		XLALFree(buf);
+		XLALFree(prev);
+		XLALFree(feather);
+		XLAL_ERROR(XLAL_ENOMEM);
+	}
+	for (j = 0; j < stride; ++j) {
+		feather[2 * j] = cos(LAL_PI*j/(2.0 * stride));
+		feather[2 * j + 1] = sin(LAL_PI*j/(2.0 * stride));
+	}
+
+	/* output block b covers stream samples [b stride, (b + 1) stride) and
+	 * feathers the second half of segment b into the first half of
+	 * segment b + 1, as XLALSimNoise() does with stride = length / 2 */
+
+	for (b = first; b <= last && !errnum; b += nbuf) {
+		const size_t nb = last - b + 1 < nbuf ? last - b + 1 : nbuf;
+		const UINT8 lo = b == first ? b : b + 1;
+		const UINT8 hi = b + nb;
+
+		#pragma omp parallel
+		{
+			COMPLEX16Vector *work = XLALCreateCOMPLEX16Vector(psd->data->length);
+			gsl_rng *rng = gsl_rng_alloc(&counter_rng_type);
+			int failed = 0;	/* only this thread's status is read in the loops */
+			long q;
+			if (!work || !rng)
+				failed = XLAL_ENOMEM;
+
+			/* generate segments lo ... hi */
+			#pragma omp for schedule(dynamic)
+			for (q = 0; q <= (long) (hi - lo); ++q) {
+				const UINT8 i = lo + q;
+				REAL8Vector data;
+				if (failed)
+					continue;
+				data.length = seglen;
+				data.data = i == b ? prev : buf + (i - b - 1) * seglen;
+				if (XLALSimNoiseSegmentSeeded(&data, work, psd, plan, s->deltaT, rng, seed, i) < 0)
+					failed = XLAL_EFUNC;
+			}
+
+			/* feather them into the output blocks */
+			#pragma omp for schedule(static)
+			for (q = 0; q < (long) nb; ++q) {
+				const REAL8 *older = q ? buf + (q - 1) * seglen : prev;
+				const REAL8 *newer = buf + q * seglen;
+				const UINT8 start = (b + q) * stride;
+				size_t jmin = 0, jmax = stride, k;
+				if (failed)
+					continue;
+				if (start < offset)
+					jmin = offset - start;
+				if (start + stride > offset + s->data->length)
+					jmax = offset + s->data->length - start;
+				for (k = jmin; k < jmax; ++k)
+					s->data->data[start + k - offset] = feather[2 * k] * older[stride + k] + feather[2 * k + 1] * newer[k];
+			}
+
+			if (failed) {
+				#pragma omp critical (XLALSimNoiseParallel)
+				errnum = failed;
+			}
+
+			if (rng)
+				gsl_rng_free(rng);
+			XLALDestroyCOMPLEX16Vector(work);
+		}
+
+		/* the last segment of this batch starts the next one */
+		memcpy(prev, buf + (nb - 1) * seglen, seglen * sizeof(*prev));
+	}
+
+	XLALFree(feather);
+	XLALFree(prev);
+	XLALFree(buf);
+	if (errnum)
+		XLAL_ERROR(errnum);
+	return 0;
+}
+
+/* check that the resolution of the frequency series is commensurate with
+ * the segment length it implies and with the sample interval */
+static int XLALSimNoiseCheckPSD(const REAL8TimeSeries *s, const REAL8FrequencySeries *psd)
+{
+	size_t seglen;
+	if (!s || !psd)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (psd->data->length < 2)
+		XLAL_ERROR(XLAL_EBADLEN);
+	seglen = 2 * (psd->data->length - 1);
+	if ((size_t)floor(0.5 + 1.0/(s->deltaT * psd->deltaF)) != seglen)
+		XLAL_ERROR(XLAL_EINVAL, "PSD resolution is not commensurate with the sample interval");
+	return 0;
+}
+
+/**
+ * @brief Fills a time series with part of a reproducible noise stream,
+ * generating it in parallel.
+ *
+ * The stream for a given power spectrum and seed is made of periodic
+ * segments of length 2 (psd->data->length - 1) samples, each feathered
+ * into the next over half a segment exactly as XLALSimNoise() does with a
+ * stride of half the segment length.  Every segment is drawn from its own
+ * substream of a counter-based random number generator determined only by
+ * the seed and the segment index, so any stretch of the stream can be
+ * generated on its own, in any order and with any number of threads, and
+ * is always the same.  Successive calls with consecutive offsets therefore
+ * produce a continuous stream in fixed memory.
+ *
+ * The data of s is overwritten with samples [offset, offset + length) of the
+ * stream; the epoch of s is not used or changed.  Segments are generated
+ * in parallel when OpenMP is enabled, sharing a single FFT plan.  Different
+ * detectors should use different seeds.
+ */
+int XLALSimNoiseParallel(
+	REAL8TimeSeries *s,		/**< [out] noise time series */
+	UINT8 offset,			/**< [in] index in the stream of the first sample */
+	REAL8FrequencySeries *psd,	/**< [in] power spectrum frequency series */
+	unsigned long seed		/**< [in] seed of the noise stream */
+)
+{
+	REAL8FFTPlan *plan;
+	int status;
+
+	if (XLALSimNoiseCheckPSD(s, psd) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	if (s->data->length == 0)
+		return 0;
+
+	plan = XLALCreateReverseREAL8FFTPlan(2 * (psd->data->length - 1), 0);
+	if (!plan)
+		XLAL_ERROR(XLAL_EFUNC);
+	status = XLALSimNoiseParallelWithPlan(s, offset, psd, seed, plan);
+	XLALDestroyREAL8FFTPlan(plan);
+	if (status < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	return 0;
+}
+
+/**
+ * @brief Generates an arbitrarily long noise stream in fixed memory and
+ * passes it in chunks to a callback, e.g. one writing frame files.
+ *
+ * The time series s is used as the chunk buffer: its length sets the chunk
+ * size and its epoch the start time of the stream.  For each chunk s is
+ * filled with the next part of the stream of XLALSimNoiseParallel() and
+ * handed to the callback, after which its epoch is advanced; the last chunk
+ * may be shorter.  A chunk spanning many segments is most efficient.
+ * On return the epoch of s is that of the end of the stream.
+ *
+ * The callback should return a negative value to abort the generation.
+ */
+int XLALSimNoiseStream(
+	REAL8TimeSeries *s,		/**< [in/out] chunk buffer */
+	UINT8 length,			/**< [in] total number of samples to generate */
+	REAL8FrequencySeries *psd,	/**< [in] power spectrum frequency series */
+	unsigned long seed,		/**< [in] seed of the noise stream */
+	LALSimNoiseStreamFunc callback,	/**< [in] function receiving each chunk */
+	void *data			/**< [in] data passed to the callback */
+)
+{
+	const size_t chunklen = s ? s->data->length : 0;
+	REAL8FFTPlan *plan;
+	UINT8 offset;
+	int errnum = 0;
+
+	if (XLALSimNoiseCheckPSD(s, psd) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	if (!callback)
+		XLAL_ERROR(XLAL_EFAULT);
+	if (chunklen == 0)
+		XLAL_ERROR(XLAL_EBADLEN);
+
+	plan = XLALCreateReverseREAL8FFTPlan(2 * (psd->data->length - 1), 0);
+	if (!plan)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	for (offset = 0; offset < length; offset += chunklen) {
+		/* shorten the buffer for the last chunk; it is restored below */
+		s->data->length = length - offset < chunklen ? length - offset : chunklen;
+		if (XLALSimNoiseParallelWithPlan(s, offset, psd, seed, plan) < 0) {
+			errnum = XLAL_EFUNC;
+			break;
+		}
+		if (callback(s, data) < 0) {
+			errnum = XLAL_EFUNC;
+			break;
+		}
+		XLALGPSAdd(&s->epoch, s->data->length * s->deltaT);
+	}
+	s->data->length = chunklen;
+
+	XLALDestroyREAL8FFTPlan(plan);
+	if (errnum)
+		XLAL_ERROR(errnum);
+	return 0;
+}
+
 /** @} */
 
 /*
@@ -69,6 +69,13 @@ SWIGLAL(FUNCTION_POINTER(aLIGOQuantumHighFrequency, XLALSimNoisePSDAdvVirgo,
 
 
 int XLALSimNoise(REAL8TimeSeries *s, size_t stride, REAL8FrequencySeries *psd, gsl_rng *rng);
+int XLALSimNoiseParallel(REAL8TimeSeries *s, UINT8 offset, REAL8FrequencySeries *psd, unsigned long seed);
+
+#ifndef SWIG /* exclude from SWIG interface */
+/** Function receiving successive chunks of a noise stream */
+typedef int (*LALSimNoiseStreamFunc)(const REAL8TimeSeries *s, void *data);
+int XLALSimNoiseStream(REAL8TimeSeries *s, UINT8 length, REAL8FrequencySeries *psd, unsigned long seed, LALSimNoiseStreamFunc callback, void *data);
+#endif
 
 
 /*
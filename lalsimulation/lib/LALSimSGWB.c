@@ -35,6 +35,13 @@
 
 #include <lal/LALSimReadData.h>
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
+/* number of frequency bins mixed together by one thread */
+#define LALSIMSGWB_BLOCK 1024
+
 /* 
  * This routine generates a single segment of data.  Note that this segment is
  * generated in the frequency domain and is inverse Fourier transformed into
@@ -132,6 +139,90 @@ static int XLALSimSGWBSegment(REAL8TimeSeries **h, const LALDetector *detectors,
 #	undef CLEANUP_AND_RETURN
 }
 
+/*
+ * As XLALSimSGWBSegment but using precomputed mixing matrices and a given
+ * plan.  The random numbers are drawn serially in the same order as
+ * XLALSimSGWBSegment, so for a given rng the two routines produce the same
+ * data (to rounding); the mixing and the Fourier transforms are done in
+ * parallel, the mixing in blocks of frequencies with frequency innermost.
+ */
+static int XLALSimSGWBSegmentMixed(REAL8TimeSeries **h, const LALSimSGWBMixing *mix, const REAL8FrequencySeries *OmegaGW, double H0, gsl_rng *rng, const REAL8FFTPlan *plan)
+{
+#	define CLEANUP_AND_RETURN(errnum) do { \
+		if (htilde) for (i = 0; i < numDetectors; ++i) XLALDestroyCOMPLEX16FrequencySeries(htilde[i]); \
+		XLALFree(htilde); XLALFree(z); \
+		if (errnum) XLAL_ERROR(errnum); else return 0; \
+		} while (0)
+	const size_t numDetectors = mix->numDetectors;
+	const size_t nbin = mix->length;
+	COMPLEX16FrequencySeries **htilde = NULL;
+	COMPLEX16 *z = NULL;
+	LIGOTimeGPS epoch;
+	double psdfac;
+	double deltaF;
+	size_t i, j, k;
+	int errnum = 0;
+
+	epoch = h[0]->epoch;
+	deltaF = mix->deltaF;
+	psdfac = 0.3 * pow(H0 / LAL_PI, 2.0);
+
+	/* independent deviates for each detector, frequency running fastest */
+	z = XLALMalloc(numDetectors * nbin * sizeof(*z));
+	if (! z)
+		CLEANUP_AND_RETURN(XLAL_ENOMEM);
+	for (j = 0; j < numDetectors; ++j)
+		z[j * nbin] = z[j * nbin + nbin - 1] = 0.0;
+	for (k = 1; k < nbin - 1; ++k) {
+		double f = k * deltaF;
+		double sigma = 0.5 * sqrt(psdfac * OmegaGW->data->data[k] * pow(f, -3.0) / deltaF);
+		for (j = 0; j < numDetectors; ++j) {
+			double re = gsl_ran_gaussian_ziggurat(rng, sigma);
+			double im = gsl_ran_gaussian_ziggurat(rng, sigma);
+			z[j * nbin + k] = re + I * im;
+		}
+	}
+
+	htilde = XLALCalloc(numDetectors, sizeof(*htilde));
+	if (! htilde)
+		CLEANUP_AND_RETURN(XLAL_ENOMEM);
+	for (i = 0; i < numDetectors; ++i) {
+		htilde[i] = XLALCreateCOMPLEX16FrequencySeries(h[i]->name, &epoch, 0.0, deltaF, &lalSecondUnit, nbin);
+		if (! htilde[i])
+			CLEANUP_AND_RETURN(XLAL_EFUNC);
+		XLALUnitMultiply(&htilde[i]->sampleUnits, &htilde[i]->sampleUnits, &h[i]->sampleUnits);
+	}
+
+	/* correlate the deviates: htilde_i = sum_{j <= i} L_ij z_j */
+	#pragma omp parallel for schedule(static) private(i, j)
+	for (k = 0; k < nbin; k += LALSIMSGWB_BLOCK) {
+		size_t kend = k + LALSIMSGWB_BLOCK < nbin ? k + LALSIMSGWB_BLOCK : nbin;
+		size_t kk;
+		for (i = 0; i < numDetectors; ++i) {
+			COMPLEX16 *out = htilde[i]->data->data;
+			for (kk = k; kk < kend; ++kk)
+				out[kk] = 0.0;
+			for (j = 0; j <= i; ++j) {
+				const double *Lij = mix->L + (i*(i + 1)/2 + j) * nbin;
+				const COMPLEX16 *zj = z + j * nbin;
+				for (kk = k; kk < kend; ++kk)
+					out[kk] += Lij[kk] * zj[kk];
+			}
+		}
+	}
+
+	/* now go back to the time domain */
+	#pragma omp parallel for schedule(static)
+	for (i = 0; i < numDetectors; ++i)
+		if (XLALREAL8FreqTimeFFT(h[i], htilde[i], plan) < 0) {
+			#pragma omp critical
+			errnum = XLAL_EFUNC;
+		}
+
+	CLEANUP_AND_RETURN(errnum);
+#	undef CLEANUP_AND_RETURN
+}
+
 /**
  * @addtogroup LALSimSGWB_c
  * @brief Routines to compute a stochastic gravitational-wave background
@@ -617,6 +708,218 @@ REAL8FrequencySeries *XLALSimSGWBOmegaGWNumericalSpectrumFromFile(
 }
 
 
+/*
+ * Driver for XLALSimSGWBBlocked and XLALSimSGWBStream with a given plan;
+ * the stride logic is the same as XLALSimSGWB.
+ */
+static int XLALSimSGWBBlockedWithPlan(REAL8TimeSeries **h, const LALSimSGWBMixing *mix, size_t stride, const REAL8FrequencySeries *OmegaGW, double H0, gsl_rng *rng, const REAL8FFTPlan *plan)
+{
+#	define CLEANUP_AND_RETURN(errnum) do { \
+		if (overlap) for (i = 0; i < numDetectors; ++i) XLALDestroyREAL8Sequence(overlap[i]); \
+		XLALFree(overlap); XLALFree(window); \
+		if (errnum) XLAL_ERROR(errnum); else return 0; \
+		} while (0)
+	const size_t numDetectors = mix->numDetectors;
+	REAL8Vector **overlap = NULL;
+	double *window = NULL;
+	size_t length;
+	size_t i, j;
+
+	length = h[0]->data->length;
+
+	if (stride == 0) { /* generate segment with no feathering */
+		if (XLALSimSGWBSegmentMixed(h, mix, OmegaGW, H0, rng, plan))
+			XLAL_ERROR(XLAL_EFUNC);
+		return 0;
+	} else if (stride == length) {
+		/* will generate two independent noise realizations
+		 * and feather them together with full overlap */
+		if (XLALSimSGWBSegmentMixed(h, mix, OmegaGW, H0, rng, plan))
+			XLAL_ERROR(XLAL_EFUNC);
+		stride = 0;
+	}
+
+	overlap = XLALCalloc(numDetectors, sizeof(*overlap));
+	window = XLALMalloc(2 * (length - stride) * sizeof(*window));
+	if (! overlap || ! window)
+		CLEANUP_AND_RETURN(XLAL_ENOMEM);
+	for (i = 0; i < numDetectors; ++i) {
+		overlap[i] = XLALCreateREAL8Sequence(length - stride);
+		if (! overlap[i])
+			CLEANUP_AND_RETURN(XLAL_EFUNC);
+		/* copy overlap region between the old and the new data to temporary storage */
+		memcpy(overlap[i]->data, h[i]->data->data + stride, overlap[i]->length*sizeof(*overlap[i]->data));
+	}
+
+	if (XLALSimSGWBSegmentMixed(h, mix, OmegaGW, H0, rng, plan))
+		CLEANUP_AND_RETURN(XLAL_EFUNC);
+
+	/* feather old data in overlap region with new data */
+	for (j = 0; j < length - stride; ++j) {
+		window[2*j] = cos(LAL_PI*j/(2.0 * (length - stride)));
+		window[2*j + 1] = sin(LAL_PI*j/(2.0 * (length - stride)));
+	}
+	#pragma omp parallel for schedule(static) private(j)
+	for (i = 0; i < numDetectors; ++i)
+		for (j = 0; j < length - stride; ++j)
+			h[i]->data->data[j] = window[2*j]*overlap[i]->data[j] + window[2*j + 1]*h[i]->data->data[j];
+
+	/* advance time */
+	for (i = 0; i < numDetectors; ++i)
+		XLALGPSAdd(&h[i]->epoch, stride * h[i]->deltaT);
+
+	/* success */
+	CLEANUP_AND_RETURN(0);
+#	undef CLEANUP_AND_RETURN
+}
+
+/* checks that the time series, mixing matrices and spectrum agree */
+static int XLALSimSGWBCheckMixing(REAL8TimeSeries **h, const LALSimSGWBMixing *mix, const REAL8FrequencySeries *OmegaGW)
+{
+	LIGOTimeGPS epoch;
+	size_t length;
+	double deltaT;
+	size_t i;
+
+	XLAL_CHECK(h && mix && OmegaGW, XLAL_EFAULT);
+	length = h[0]->data->length;
+	deltaT = h[0]->deltaT;
+	epoch = h[0]->epoch;
+
+	/* make sure all the lengths and other metadata are the same */
+	for (i = 1; i < mix->numDetectors; ++i)
+		if (h[i]->data->length != length
+				|| fabs(h[i]->deltaT - deltaT) > LAL_REAL8_EPS
+				|| XLALGPSCmp(&epoch, &h[i]->epoch))
+			XLAL_ERROR(XLAL_EINVAL);
+
+	/* make sure that the resolution of the frequency series and of the
+	 * mixing matrices is commensurate with the requested time series */
+	if (length/2 + 1 != OmegaGW->data->length
+			|| (size_t)floor(0.5 + 1.0/(deltaT * OmegaGW->deltaF)) != length)
+		XLAL_ERROR(XLAL_EINVAL);
+	if (mix->length != OmegaGW->data->length
+			|| fabs(mix->deltaF - OmegaGW->deltaF) > LAL_REAL8_EPS * OmegaGW->deltaF)
+		XLAL_ERROR(XLAL_EINVAL, "Mixing matrices do not match the frequency series");
+
+	return 0;
+}
+
+/**
+ * Routine that may be used to generate sequential segments of stochastic
+ * background gravitational wave signals for a network of detectors with a
+ * specified stride from one segment to the next, using mixing matrices
+ * precomputed by XLALSimSGWBCreateMixing().
+ *
+ * This is equivalent to XLALSimSGWB() (and, for a given rng, gives the same
+ * data to rounding) but the overlap reduction functions and their Cholesky
+ * decompositions are not recomputed for every segment, and the correlation of
+ * the detectors and the inverse Fourier transforms are done in parallel when
+ * OpenMP is available.  This makes long simulations with large networks
+ * practical: the cost per segment is dominated by the random number
+ * generation and the Fourier transforms.
+ *
+ * The calling instructions are the same as for XLALSimSGWB(), with the
+ * network given by the mixing matrices, which must have been computed with
+ * the frequency resolution and length of OmegaGW:
+ *
+ * @code
+ * LALSimSGWBMixing *mix = XLALSimSGWBCreateMixing(detectors, 3, OmegaGW->deltaF, OmegaGW->data->length);
+ * XLALSimSGWBBlocked(h, mix, 0, OmegaGW, H0, rng); // first time to initialize
+ * while (1) {
+ * 	// output first stride points of h[0], h[1], h[2]
+ * 	XLALSimSGWBBlocked(h, mix, stride, OmegaGW, H0, rng); // make more data
+ * }
+ * @endcode
+ *
+ * @warning Only the first stride points are valid.
+ */
+int XLALSimSGWBBlocked(
+	REAL8TimeSeries **h,			/**< [in/out] array of sgwb timeseries for detector network */
+	const LALSimSGWBMixing *mix,		/**< [in] mixing matrices of detector network */
+	size_t stride,				/**< [in] stride (samples) */
+	const REAL8FrequencySeries *OmegaGW,	/**< [in] sgwb spectrum frequeny series */
+	double H0,				/**< [in] Hubble's constant (s) */
+	gsl_rng *rng				/**< [in] GSL random number generator */
+)
+{
+	REAL8FFTPlan *plan;
+
+	if (XLALSimSGWBCheckMixing(h, mix, OmegaGW) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	/* stride cannot be longer than data length */
+	if (stride > h[0]->data->length)
+		XLAL_ERROR(XLAL_EINVAL);
+
+	plan = XLALCreateReverseREAL8FFTPlan(h[0]->data->length, 0);
+	if (! plan)
+		XLAL_ERROR(XLAL_EFUNC);
+	if (XLALSimSGWBBlockedWithPlan(h, mix, stride, OmegaGW, H0, rng, plan) < 0) {
+		XLALDestroyREAL8FFTPlan(plan);
+		XLAL_ERROR(XLAL_EFUNC);
+	}
+	XLALDestroyREAL8FFTPlan(plan);
+	return 0;
+}
+
+/**
+ * Generates length samples of a continuous stochastic background signal for
+ * a network of detectors, delivering it in chunks to a callback.
+ *
+ * The time series h are used as buffers of one segment each; segments are
+ * generated with XLALSimSGWBBlocked() at a stride of half a segment, and
+ * the first stride (valid) samples of each are passed to the callback, as is
+ * done by hand in the example of XLALSimSGWB().  The last chunk may be
+ * shorter.  The epoch of h on entry is the start of the stream.  The
+ * callback must not modify h and should return a negative value to signal
+ * an error, which stops the stream.
+ */
+int XLALSimSGWBStream(
+	REAL8TimeSeries **h,			/**< [in/out] array of segment buffers for detector network */
+	const LALSimSGWBMixing *mix,		/**< [in] mixing matrices of detector network */
+	UINT8 length,				/**< [in] total number of samples to generate */
+	const REAL8FrequencySeries *OmegaGW,	/**< [in] sgwb spectrum frequeny series */
+	double H0,				/**< [in] Hubble's constant (s) */
+	gsl_rng *rng,				/**< [in] GSL random number generator */
+	LALSimSGWBStreamFunc callback,		/**< [in] function receiving each chunk */
+	void *data				/**< [in] data passed to the callback */
+)
+{
+	REAL8FFTPlan *plan;
+	size_t stride;
+	UINT8 offset;
+	int errnum = 0;
+
+	if (XLALSimSGWBCheckMixing(h, mix, OmegaGW) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+	if (! callback)
+		XLAL_ERROR(XLAL_EFAULT);
+	stride = h[0]->data->length / 2;
+	if (stride == 0)
+		XLAL_ERROR(XLAL_EBADLEN);
+
+	plan = XLALCreateReverseREAL8FFTPlan(h[0]->data->length, 0);
+	if (! plan)
+		XLAL_ERROR(XLAL_EFUNC);
+
+	if (XLALSimSGWBBlockedWithPlan(h, mix, 0, OmegaGW, H0, rng, plan) < 0)
+		errnum = XLAL_EFUNC;
+	for (offset = 0; ! errnum && offset < length; offset += stride) {
+		size_t n = length - offset < stride ? length - offset : stride;
+		if (callback(h, mix->numDetectors, n, data) < 0)
+			errnum = XLAL_EFUNC;
+		else if (offset + n < length && XLALSimSGWBBlockedWithPlan(h, mix, stride, OmegaGW, H0, rng, plan) < 0)
+			errnum = XLAL_EFUNC;
+	}
+
+	XLALDestroyREAL8FFTPlan(plan);
+	if (errnum)
+		XLAL_ERROR(errnum);
+	return 0;
+}
+
+
 /** @} */
 
 /*
@@ -49,6 +49,25 @@ extern "C" {
  */
 
 double XLALSimSGWBOverlapReductionFunction(double f, const LALDetector *detector1, const LALDetector *detector2);
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALSimSGWBOverlapReductionFunctionSeries(double *gam, double f0, double deltaF, size_t length, const LALDetector *detector1, const LALDetector *detector2);
+#endif /* SWIG */
+
+/**
+ * Mixing matrices that correlate the strain of a detector network: for each
+ * frequency bin, the lower-triangular Cholesky factor of the matrix of
+ * overlap reduction functions.  Element (i,j), j <= i, of bin k is stored at
+ * L[(i*(i+1)/2 + j)*length + k].  The DC and Nyquist bins are zero.
+ */
+typedef struct tagLALSimSGWBMixing {
+	size_t numDetectors;	/**< number of detectors in network */
+	size_t length;		/**< number of frequency bins */
+	double deltaF;		/**< frequency bin width (Hz) */
+	double *L;		/**< packed Cholesky factors */
+} LALSimSGWBMixing;
+
+LALSimSGWBMixing *XLALSimSGWBCreateMixing(const LALDetector *detectors, size_t numDetectors, double deltaF, size_t length);
+void XLALSimSGWBDestroyMixing(LALSimSGWBMixing *mix);
 
 
 /*
@@ -68,6 +87,12 @@ REAL8FrequencySeries *XLALSimSGWBOmegaGWNumericalSpectrumFromFile(const char *fn
 int XLALSimSGWB(REAL8TimeSeries **h, const LALDetector *detectors, size_t numDetectors, size_t stride, const REAL8FrequencySeries *OmegaGW, double H0, gsl_rng *rng);
 int XLALSimSGWBFlatSpectrum(REAL8TimeSeries **h, const LALDetector *detectors, size_t numDetectors, size_t stride, double Omega0, double flow, double H0, gsl_rng *rng);
 int XLALSimSGWBPowerLawSpectrum(REAL8TimeSeries **h, const LALDetector *detectors, size_t numDetectors, size_t stride, double Omegaref, double alpha, double fref, double flow, double H0, gsl_rng *rng);
+int XLALSimSGWBBlocked(REAL8TimeSeries **h, const LALSimSGWBMixing *mix, size_t stride, const REAL8FrequencySeries *OmegaGW, double H0, gsl_rng *rng);
+#ifndef SWIG /* exclude from SWIG interface */
+/** Receives the first length (valid) samples of each detector's chunk */
+typedef int (*LALSimSGWBStreamFunc)(REAL8TimeSeries **h, size_t numDetectors, size_t length, void *data);
+int XLALSimSGWBStream(REAL8TimeSeries **h, const LALSimSGWBMixing *mix, UINT8 length, const REAL8FrequencySeries *OmegaGW, double H0, gsl_rng *rng, LALSimSGWBStreamFunc callback, void *data);
+#endif /* SWIG */
 
 #if 0
 { /* so that editors will match succeeding brace */
@@ -19,11 +19,19 @@
 
 #include <math.h>
 
+#include <lal/LALStdlib.h>
 #include <lal/LALConstants.h>
 #include <lal/LALDetectors.h>
 #include <lal/Units.h>
 #include <lal/LALSimSGWB.h>
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
+/* number of frequency bins processed together when decomposing */
+#define LALSIMSGWB_BLOCK 1024
+
 /**
  * @addtogroup LALSimSGWBORF_c
  * @brief Routines to compute the Overlap Reduction Function for stochastic
@@ -31,47 +39,67 @@
  * @{
  */
 
-/**
- * Computes the overlap reduction function between two detectors at a specified
- * frequency.
- *
- * Implements the formulae given in Allen & Romano (1999).
+/*
+ * Geometric factors of Eq. (3.43) of Allen and Romano (1999): d1:d2,
+ * (s.d1).(d2.s), and (s.d1.s)(s.d2.s), together with the separation d.
+ * These depend only on the pair of detectors so are computed once per pair.
  */
-double XLALSimSGWBOverlapReductionFunction(
-	double f,			/**< [in] frequency (Hz) */
-	const LALDetector *detector1,	/**< [in] 1st detector */
-	const LALDetector *detector2	/**< [in] 2nd detector */
-)
+static void XLALSimSGWBORFGeometry(double *d, double *dd, double *sdds, double *sds1sds2, const LALDetector *detector1, const LALDetector *detector2)
 {
-	double d;
 	double s[3];
-	double alpha, alphasq, sinalpha, cosalpha;
-	double j_0, j_1, j_2;
-	double rho1, rho2, rho3;
-	double dd, sdds, sds1, sds2;
-	double gam;
+	double sds1, sds2;
 	size_t i, j;
 
 	/* compute vector between detectors */
 	s[0] = detector2->location[0] - detector1->location[0];
 	s[1] = detector2->location[1] - detector1->location[1];
 	s[2] = detector2->location[2] - detector1->location[2];
-	d = sqrt(s[0]*s[0] + s[1]*s[1] + s[2]*s[2]);
+	*d = sqrt(s[0]*s[0] + s[1]*s[1] + s[2]*s[2]);
 
 	/* if d is zero (less than 1 meter), detectors are at the same site */
-	if (d < 1.0) {
-		dd = 0.0;
+	if (*d < 1.0) {
+		*dd = 0.0;
 		for (i = 0; i < 3; ++i)
 			for (j = 0; j < 3; ++j)
-				dd += detector1->response[i][j] * detector2->response[i][j];
-		gam = 2.0*dd;
-		return gam;
+				*dd += detector1->response[i][j] * detector2->response[i][j];
+		*sdds = *sds1sds2 = 0.0;
+		return;
 	}
 
 	/* change s[] into a unit vector */
-	s[0] /= d;
-	s[1] /= d;
-	s[2] /= d;
+	s[0] /= *d;
+	s[1] /= *d;
+	s[2] /= *d;
+
+	/* Compute d1:d2, (s.d1).(d2.s), and (s.d1.s)(s.d2.s) */
+	*dd = *sdds = sds1 = sds2 = 0.0;
+	for (i = 0; i < 3; ++i) {
+		double sd1 = 0.0;
+		double sd2 = 0.0;
+		for (j = 0; j < 3; ++j) {
+			*dd += detector1->response[i][j] * detector2->response[i][j];
+			sd1 += detector1->response[i][j] * s[j];
+			sd2 += detector2->response[i][j] * s[j];
+		}
+		sds1 += sd1 * s[i];
+		sds2 += sd2 * s[i];
+		*sdds += sd1 * sd2;
+	}
+	*sds1sds2 = sds1 * sds2;
+	return;
+}
+
+/* Eqs. (3.32), (3.40), (3.43), and (3.44) of Allen and Romano (1999) */
+static double XLALSimSGWBORFFromGeometry(double f, double d, double dd, double sdds, double sds1sds2)
+{
+	double alpha, alphasq, sinalpha, cosalpha;
+	double j_0, j_1, j_2;
+	double rho1, rho2, rho3;
+
+	/* same site, or the zero-frequency limit where rho1 -> 2 and
+	 * rho2, rho3 -> 0 */
+	if (d < 1.0 || f == 0.0)
+		return 2.0*dd;
 
 	/* Eq. (3.32) of Allen and Romano (1999) */
 	alpha = 2.0*LAL_PI*f*d/LAL_C_SI;
@@ -82,7 +110,7 @@ double XLALSimSGWBOverlapReductionFunction(
 
 	/* Eq. (3.40) of Allen and Romano (1999) */
 	j_0 = sinalpha/alpha;
-	j_1 = sinalpha/alphasq - cos(alpha)/alpha;
+	j_1 = sinalpha/alphasq - cosalpha/alpha;
 	j_2 = 3.0*sinalpha/(alpha*alphasq) - 3.0*cosalpha/alphasq - sinalpha/alpha;
 
 	/* Eq. (3.44) of Allen and Romano (1999) */
@@ -90,25 +118,157 @@ double XLALSimSGWBOverlapReductionFunction(
 	rho2 = 0.5*(-20.0*alphasq*j_0 + 80.0*alpha*j_1 - 100.0*j_2)/alphasq;
 	rho3 = 0.5*(  5.0*alphasq*j_0 - 50.0*alpha*j_1 + 175.0*j_2)/alphasq;
 
-	/* Compute d1:d2, (s.d1).(d2.s), and (s.d1.s)(s.d2.s) */
-	dd = sdds = sds1 = sds2 = 0.0;
-	for (i = 0; i < 3; ++i) {
-		double sd1 = 0.0;
-		double sd2 = 0.0;
-		for (j = 0; j < 3; ++j) {
-			dd  += detector1->response[i][j] * detector2->response[i][j];
-			sd1 += detector1->response[i][j] * s[j];
-			sd2 += detector2->response[i][j] * s[j];
+	/* Eq (3.43) of Allen and Romano (1999) */
+	return rho1*dd + rho2*sdds + rho3*sds1sds2;
+}
+
+/**
+ * Computes the overlap reduction function between two detectors at a specified
+ * frequency.
+ *
+ * Implements the formulae given in Allen & Romano (1999).
+ */
+double XLALSimSGWBOverlapReductionFunction(
+	double f,			/**< [in] frequency (Hz) */
+	const LALDetector *detector1,	/**< [in] 1st detector */
+	const LALDetector *detector2	/**< [in] 2nd detector */
+)
+{
+	double d, dd, sdds, sds1sds2;
+	XLALSimSGWBORFGeometry(&d, &dd, &sdds, &sds1sds2, detector1, detector2);
+	return XLALSimSGWBORFFromGeometry(f, d, dd, sdds, sds1sds2);
+}
+
+/**
+ * Computes the overlap reduction function between two detectors on a uniform
+ * grid of frequencies f0 + k deltaF, k = 0, ..., length - 1.
+ *
+ * The geometry of the detector pair is evaluated only once.  At zero
+ * frequency the (finite) limiting value is returned.
+ */
+int XLALSimSGWBOverlapReductionFunctionSeries(
+	double *gam,			/**< [out] overlap reduction function at each frequency */
+	double f0,			/**< [in] first frequency (Hz) */
+	double deltaF,			/**< [in] frequency spacing (Hz) */
+	size_t length,			/**< [in] number of frequencies */
+	const LALDetector *detector1,	/**< [in] 1st detector */
+	const LALDetector *detector2	/**< [in] 2nd detector */
+)
+{
+	double d, dd, sdds, sds1sds2;
+	size_t k;
+	XLAL_CHECK(gam && detector1 && detector2, XLAL_EFAULT);
+	XLAL_CHECK(f0 >= 0.0 && deltaF > 0.0, XLAL_EINVAL);
+	XLALSimSGWBORFGeometry(&d, &dd, &sdds, &sds1sds2, detector1, detector2);
+	for (k = 0; k < length; ++k)
+		gam[k] = XLALSimSGWBORFFromGeometry(f0 + k*deltaF, d, dd, sdds, sds1sds2);
+	return 0;
+}
+
+/**
+ * Precomputes the matrices used to mix independent Gaussian deviates into
+ * correlated detector strains on the frequency grid k deltaF,
+ * k = 0, ..., length - 1.
+ *
+ * At each frequency the correlation matrix of the network has unit diagonal
+ * and the overlap reduction function off the diagonal; the mixing matrix is
+ * its lower-triangular Cholesky factor.  As in XLALSimSGWB(), correlations
+ * that are unity to single precision (co-located detectors) are reduced by
+ * LAL_REAL4_EPS so that the decomposition exists, and the first (DC) and
+ * last (Nyquist) bins, which carry no signal, are not decomposed: their
+ * mixing matrices are zero.
+ *
+ * Elements are stored with frequency running fastest, so the decomposition
+ * and the subsequent mixing are simple loops over frequency.
+ */
+LALSimSGWBMixing *XLALSimSGWBCreateMixing(
+	const LALDetector *detectors,	/**< [in] array of detectors in network */
+	size_t numDetectors,		/**< [in] number of detectors in network */
+	double deltaF,			/**< [in] frequency bin width (Hz) */
+	size_t length			/**< [in] number of frequency bins */
+)
+{
+	LALSimSGWBMixing *mix;
+	size_t nbad = 0;
+	size_t i, j, k;
+
+	XLAL_CHECK_NULL(detectors, XLAL_EFAULT);
+	XLAL_CHECK_NULL(numDetectors > 0 && length > 0, XLAL_EBADLEN);
+	XLAL_CHECK_NULL(deltaF > 0.0, XLAL_EINVAL);
+
+	mix = XLALCalloc(1, sizeof(*mix));
+	XLAL_CHECK_NULL(mix, XLAL_ENOMEM);
+	mix->numDetectors = numDetectors;
+	mix->length = length;
+	mix->deltaF = deltaF;
+	mix->L = XLALMalloc(numDetectors * (numDetectors + 1) / 2 * length * sizeof(*mix->L));
+	if (!mix->L) {
+		XLALFree(mix);
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	}
+
+	/* correlation matrix, one detector pair at a time */
+	for (i = 0; i < numDetectors; ++i) {
+		double *Rii = mix->L + (i*(i + 1)/2 + i) * length;
+		for (j = 0; j < i; ++j) {
+			double *Rij = mix->L + (i*(i + 1)/2 + j) * length;
+			XLALSimSGWBOverlapReductionFunctionSeries(Rij, 0.0, deltaF, length, &detectors[i], &detectors[j]);
+			for (k = 0; k < length; ++k)
+				if (fabs(Rij[k] - 1.0) < LAL_REAL4_EPS)
+					Rij[k] = 1.0 - LAL_REAL4_EPS;
 		}
-		sds1 += sd1 * s[i];
-		sds2 += sd2 * s[i];
-		sdds += sd1 * sd2;
+		for (k = 0; k < length; ++k)
+			Rii[k] = 1.0;
 	}
 
-	/* Eq (3.43) of Allen and Romano (1999) */
-	gam = rho1*dd + rho2*sdds + rho3*sds1*sds2;
+	/* in-place Cholesky-Banachiewicz decomposition of all frequencies
+	 * except DC and Nyquist at once, in blocks of frequencies */
+	#pragma omp parallel for schedule(static) private(i, j) reduction(+:nbad)
+	for (k = 0; k < length; k += LALSIMSGWB_BLOCK) {
+		size_t kbeg = k > 1 ? k : 1;
+		size_t kend = k + LALSIMSGWB_BLOCK < length - 1 ? k + LALSIMSGWB_BLOCK : length - 1;
+		size_t kk, m;
+		for (i = 0; i < numDetectors; ++i)
+			for (j = 0; j <= i; ++j) {
+				double *Lij = mix->L + (i*(i + 1)/2 + j) * length;
+				const double *Ljj = mix->L + (j*(j + 1)/2 + j) * length;
+				for (m = 0; m < j; ++m) {
+					const double *Lim = mix->L + (i*(i + 1)/2 + m) * length;
+					const double *Ljm = mix->L + (j*(j + 1)/2 + m) * length;
+					for (kk = kbeg; kk < kend; ++kk)
+						Lij[kk] -= Lim[kk] * Ljm[kk];
+				}
+				if (i == j)
+					for (kk = kbeg; kk < kend; ++kk) {
+						nbad += !(Lij[kk] > 0.0);
+						Lij[kk] = sqrt(Lij[kk]);
+					}
+				else
+					for (kk = kbeg; kk < kend; ++kk)
+						Lij[kk] /= Ljj[kk];
+			}
+	}
+	for (i = 0; i < numDetectors * (numDetectors + 1) / 2; ++i) {
+		mix->L[i * length] = 0.0;
+		mix->L[i * length + length - 1] = 0.0;
+	}
 
-	return gam;
+	if (nbad) {
+		XLALSimSGWBDestroyMixing(mix);
+		XLAL_ERROR_NULL(XLAL_EDOM, "Correlation matrix is not positive definite at %zu frequencies", nbad);
+	}
+
+	return mix;
+}
+
+/** Destroys a set of mixing matrices created by XLALSimSGWBCreateMixing(). */
+void XLALSimSGWBDestroyMixing(LALSimSGWBMixing *mix)
+{
+	if (mix) {
+		XLALFree(mix->L);
+		XLALFree(mix);
+	}
+	return;
 }
 
 /** @} */
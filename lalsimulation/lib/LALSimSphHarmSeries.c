@@ -17,6 +17,7 @@
  *  MA  02110-1301  USA
  */
 
+#include <string.h>
 #include <lal/LALSimSphHarmSeries.h>
 #include <lal/LALStdlib.h>
 #include <lal/Sequence.h>
@@ -701,5 +702,353 @@ UINT4 XLALSphHarmFrequencySeriesGetMaxL( SphHarmFrequencySeries* ts ){
     return maxl;
 }
 
+/** @} */
+
+/**
+ * @name SphHarmModeArray Routines
+ * @{
+ */
+
+/* Number of samples summed over all modes before moving on, chosen so that
+ * the output block stays in cache while the modes are streamed through it */
+#define SPHHARM_MODE_BLOCK 1024
+
+/**
+ * Create a SphHarmModeArray holding nmodes modes of length samples each,
+ * with mode k having indices (l[k], m[k]). The mode data is zeroed.
+ */
+SphHarmModeArray *XLALCreateSphHarmModeArray(
+            const UINT4 *l, /**< l index of each mode */
+            const INT4 *m, /**< m index of each mode */
+            UINT4 nmodes, /**< number of modes */
+            UINT4 length /**< number of samples per mode */
+            )
+{
+    SphHarmModeArray *arr;
+    UINT4 k, lmax = 0;
+
+    XLAL_CHECK_NULL( l && m, XLAL_EFAULT );
+    XLAL_CHECK_NULL( nmodes > 0, XLAL_EINVAL, "No modes given" );
+    for( k = 0; k < nmodes; k++ ){
+        XLAL_CHECK_NULL( abs(m[k]) <= (INT4) l[k], XLAL_EINVAL, "Invalid mode (%u,%d)", l[k], m[k] );
+        lmax = l[k] > lmax ? l[k] : lmax;
+    }
+
+    arr = XLALCalloc( 1, sizeof(*arr) );
+    XLAL_CHECK_NULL( arr, XLAL_ENOMEM );
+    arr->nmodes = nmodes;
+    arr->length = length;
+    arr->lmax = lmax;
+    arr->l = XLALMalloc( nmodes * sizeof(*arr->l) );
+    arr->m = XLALMalloc( nmodes * sizeof(*arr->m) );
+    arr->slot = XLALMalloc( (lmax+1) * (lmax+1) * sizeof(*arr->slot) );
+    arr->data = XLALCalloc( (size_t) nmodes * length, sizeof(*arr->data) );
+    if( !arr->l || !arr->m || !arr->slot || (length && !arr->data) ){
+        XLALDestroySphHarmModeArray( arr );
+        XLAL_ERROR_NULL( XLAL_ENOMEM );
+    }
+    arr->sampleUnits = lalDimensionlessUnit;
+
+    for( k = 0; k < (lmax+1) * (lmax+1); k++ )
+        arr->slot[k] = -1;
+    for( k = 0; k < nmodes; k++ ){
+        UINT4 idx = l[k] * l[k] + l[k] + m[k];
+        if( arr->slot[idx] >= 0 ){
+            XLALDestroySphHarmModeArray( arr );
+            XLAL_ERROR_NULL( XLAL_EINVAL, "Mode (%u,%d) given twice", l[k], m[k] );
+        }
+        arr->l[k] = l[k];
+        arr->m[k] = m[k];
+        arr->slot[idx] = k;
+    }
+
+    return arr;
+}
+
+/** Free a SphHarmModeArray and all its data */
+void XLALDestroySphHarmModeArray(
+            SphHarmModeArray *arr /**< SphHarmModeArray to destroy */
+            )
+{
+    if( !arr ) return;
+    XLALFree( arr->l );
+    XLALFree( arr->m );
+    XLALFree( arr->slot );
+    XLALFree( arr->data );
+    XLALFree( arr );
+}
+
+/**
+ * Get a pointer to the data of the (l,m) mode in a SphHarmModeArray,
+ * or NULL if the mode is not present. This is a table lookup.
+ */
+COMPLEX16 *XLALSphHarmModeArrayGetMode(
+            SphHarmModeArray *arr, /**< SphHarmModeArray to extract mode from */
+            UINT4 l, /**< l index of h_lm mode to get */
+            INT4 m /**< m index of h_lm mode to get */
+            )
+{
+    if( !arr || l > arr->lmax || abs(m) > (INT4) l ) return NULL;
+    INT4 k = arr->slot[l * l + l + m];
+    if( k < 0 ) return NULL;
+    return arr->data + (size_t) k * arr->length;
+}
+
+/**
+ * Copy the modes of a SphHarmTimeSeries linked list into a SphHarmModeArray.
+ * All modes must have the same length; slots follow the order of the list.
+ * The tdata member of the list is not carried over.
+ */
+SphHarmModeArray *XLALSphHarmModeArrayFromSphHarmTimeSeries(
+            SphHarmTimeSeries *hlms /**< Head of linked list of modes */
+            )
+{
+    SphHarmTimeSeries *itr;
+    UINT4 nmodes = 0, k;
+
+    XLAL_CHECK_NULL( hlms && hlms->mode, XLAL_EFAULT );
+    for( itr = hlms; itr; itr = itr->next ){
+        XLAL_CHECK_NULL( itr->mode, XLAL_EFAULT, "Mode (%u,%d) has no data", itr->l, itr->m );
+        XLAL_CHECK_NULL( itr->mode->data->length == hlms->mode->data->length, XLAL_EBADLEN, "Modes have different lengths" );
+        nmodes++;
+    }
+
+    UINT4 *l = XLALMalloc( nmodes * sizeof(*l) );
+    INT4 *m = XLALMalloc( nmodes * sizeof(*m) );
+    if( !l || !m ){
+        XLALFree( l );
+        XLALFree( m );
+        XLAL_ERROR_NULL( XLAL_ENOMEM );
+    }
+    for( itr = hlms, k = 0; itr; itr = itr->next, k++ ){
+        l[k] = itr->l;
+        m[k] = itr->m;
+    }
+    SphHarmModeArray *arr = XLALCreateSphHarmModeArray( l, m, nmodes, hlms->mode->data->length );
+    XLALFree( l );
+    XLALFree( m );
+    XLAL_CHECK_NULL( arr, XLAL_EFUNC );
+
+    arr->epoch = hlms->mode->epoch;
+    arr->f0 = hlms->mode->f0;
+    arr->delta = hlms->mode->deltaT;
+    arr->sampleUnits = hlms->mode->sampleUnits;
+    for( itr = hlms, k = 0; itr; itr = itr->next, k++ )
+        memcpy( arr->data + (size_t) k * arr->length, itr->mode->data->data, arr->length * sizeof(COMPLEX16) );
+
+    return arr;
+}
+
+/**
+ * Copy the modes of a SphHarmFrequencySeries linked list into a
+ * SphHarmModeArray. All modes must have the same length; slots follow the
+ * order of the list. The fdata member of the list is not carried over.
+ */
+SphHarmModeArray *XLALSphHarmModeArrayFromSphHarmFrequencySeries(
+            SphHarmFrequencySeries *hlms /**< Head of linked list of modes */
+            )
+{
+    SphHarmFrequencySeries *itr;
+    UINT4 nmodes = 0, k;
+
+    XLAL_CHECK_NULL( hlms && hlms->mode, XLAL_EFAULT );
+    for( itr = hlms; itr; itr = itr->next ){
+        XLAL_CHECK_NULL( itr->mode, XLAL_EFAULT, "Mode (%u,%d) has no data", itr->l, itr->m );
+        XLAL_CHECK_NULL( itr->mode->data->length == hlms->mode->data->length, XLAL_EBADLEN, "Modes have different lengths" );
+        nmodes++;
+    }
+
+    UINT4 *l = XLALMalloc( nmodes * sizeof(*l) );
+    INT4 *m = XLALMalloc( nmodes * sizeof(*m) );
+    if( !l || !m ){
+        XLALFree( l );
+        XLALFree( m );
+        XLAL_ERROR_NULL( XLAL_ENOMEM );
+    }
+    for( itr = hlms, k = 0; itr; itr = itr->next, k++ ){
+        l[k] = itr->l;
+        m[k] = itr->m;
+    }
+    SphHarmModeArray *arr = XLALCreateSphHarmModeArray( l, m, nmodes, hlms->mode->data->length );
+    XLALFree( l );
+    XLALFree( m );
+    XLAL_CHECK_NULL( arr, XLAL_EFUNC );
+
+    arr->epoch = hlms->mode->epoch;
+    arr->f0 = hlms->mode->f0;
+    arr->delta = hlms->mode->deltaF;
+    arr->sampleUnits = hlms->mode->sampleUnits;
+    for( itr = hlms, k = 0; itr; itr = itr->next, k++ )
+        memcpy( arr->data + (size_t) k * arr->length, itr->mode->data->data, arr->length * sizeof(COMPLEX16) );
+
+    return arr;
+}
+
+/**
+ * Create a SphHarmTimeSeries linked list from a SphHarmModeArray, whose
+ * delta member is taken to be the sample spacing in time. The list has the
+ * same order as the slots of the array.
+ */
+SphHarmTimeSeries *XLALSphHarmTimeSeriesFromSphHarmModeArray(
+            const SphHarmModeArray *arr /**< SphHarmModeArray to convert */
+            )
+{
+    SphHarmTimeSeries *hlms = NULL;
+    COMPLEX16TimeSeries *h;
+    UINT4 k;
+
+    XLAL_CHECK_NULL( arr, XLAL_EFAULT );
+    h = XLALCreateCOMPLEX16TimeSeries( "h_lm", &arr->epoch, arr->f0, arr->delta, &arr->sampleUnits, arr->length );
+    XLAL_CHECK_NULL( h, XLAL_EFUNC );
+    /* modes are prepended, so go backwards to preserve the order */
+    for( k = arr->nmodes; k-- > 0; ){
+        memcpy( h->data->data, arr->data + (size_t) k * arr->length, arr->length * sizeof(COMPLEX16) );
+        hlms = XLALSphHarmTimeSeriesAddMode( hlms, h, arr->l[k], arr->m[k] );
+        if( !hlms->mode ){
+            XLALDestroySphHarmTimeSeries( hlms );
+            XLALDestroyCOMPLEX16TimeSeries( h );
+            XLAL_ERROR_NULL( XLAL_EFUNC );
+        }
+    }
+    XLALDestroyCOMPLEX16TimeSeries( h );
+
+    return hlms;
+}
+
+/**
+ * Create a SphHarmFrequencySeries linked list from a SphHarmModeArray, whose
+ * delta member is taken to be the sample spacing in frequency. The list has
+ * the same order as the slots of the array.
+ */
+SphHarmFrequencySeries *XLALSphHarmFrequencySeriesFromSphHarmModeArray(
+            const SphHarmModeArray *arr /**< SphHarmModeArray to convert */
+            )
+{
+    SphHarmFrequencySeries *hlms = NULL;
+    COMPLEX16FrequencySeries *h;
+    UINT4 k;
+
+    XLAL_CHECK_NULL( arr, XLAL_EFAULT );
+    h = XLALCreateCOMPLEX16FrequencySeries( "h_lm", &arr->epoch, arr->f0, arr->delta, &arr->sampleUnits, arr->length );
+    XLAL_CHECK_NULL( h, XLAL_EFUNC );
+    /* modes are prepended, so go backwards to preserve the order */
+    for( k = arr->nmodes; k-- > 0; ){
+        memcpy( h->data->data, arr->data + (size_t) k * arr->length, arr->length * sizeof(COMPLEX16) );
+        hlms = XLALSphHarmFrequencySeriesAddMode( hlms, h, arr->l[k], arr->m[k] );
+        if( !hlms->mode ){
+            XLALDestroySphHarmFrequencySeries( hlms );
+            XLALDestroyCOMPLEX16FrequencySeries( h );
+            XLAL_ERROR_NULL( XLAL_EFUNC );
+        }
+    }
+    XLALDestroyCOMPLEX16FrequencySeries( h );
+
+    return hlms;
+}
+
+/**
+ * Multiply every mode h(l,m) in a SphHarmModeArray by its spin-2 weighted
+ * spherical harmonic and add the sum, hplus - i hcross, to the time series.
+ * This is equivalent to calling XLALSimAddMode() with sym = 0 for each mode,
+ * but streams all modes through one cache-sized block of the output at a
+ * time, with the harmonics computed once.
+ */
+int XLALSphHarmModeArrayAddModesTD(
+            REAL8TimeSeries *hplus, /**< +-polarization waveform */
+            REAL8TimeSeries *hcross, /**< x-polarization waveform */
+            const SphHarmModeArray *arr, /**< complex modes h(l,m) */
+            REAL8 theta, /**< polar angle (rad) */
+            REAL8 phi /**< azimuthal angle (rad) */
+            )
+{
+    XLAL_CHECK( hplus && hcross && arr, XLAL_EFAULT );
+    XLAL_CHECK( hplus->data->length == arr->length && hcross->data->length == arr->length, XLAL_EBADLEN );
+
+    REAL8 *Yre = XLALMalloc( arr->nmodes * sizeof(*Yre) );
+    REAL8 *Yim = XLALMalloc( arr->nmodes * sizeof(*Yim) );
+    if( !Yre || !Yim ){
+        XLALFree( Yre );
+        XLALFree( Yim );
+        XLAL_ERROR( XLAL_ENOMEM );
+    }
+    for( UINT4 k = 0; k < arr->nmodes; k++ ){
+        COMPLEX16 Y = XLALSpinWeightedSphericalHarmonic( theta, phi, -2, arr->l[k], arr->m[k] );
+        Yre[k] = creal(Y);
+        Yim[k] = cimag(Y);
+    }
+
+    REAL8 *hp = hplus->data->data;
+    REAL8 *hc = hcross->data->data;
+    for( UINT4 j0 = 0; j0 < arr->length; j0 += SPHHARM_MODE_BLOCK ){
+        UINT4 j1 = j0 + SPHHARM_MODE_BLOCK < arr->length ? j0 + SPHHARM_MODE_BLOCK : arr->length;
+        for( UINT4 k = 0; k < arr->nmodes; k++ ){
+            /* view the mode as interleaved re/im pairs so the loop vectorizes */
+            const REAL8 *h = (const REAL8 *) (arr->data + (size_t) k * arr->length);
+            const REAL8 yr = Yre[k], yi = Yim[k];
+            for( UINT4 j = j0; j < j1; j++ ){
+                const REAL8 hr = h[2*j], hi = h[2*j+1];
+                hp[j] += yr * hr - yi * hi;
+                hc[j] -= yr * hi + yi * hr;
+            }
+        }
+    }
+
+    XLALFree( Yre );
+    XLALFree( Yim );
+    return XLAL_SUCCESS;
+}
+
+/**
+ * Frequency-domain counterpart of XLALSphHarmModeArrayAddModesTD():
+ * adds 0.5 Y_lm h_lm(f) to hptilde and 0.5 i Y_lm h_lm(f) to hctilde for
+ * every mode, as XLALSimAddModeFD() does with sym = 0.
+ */
+int XLALSphHarmModeArrayAddModesFD(
+            COMPLEX16FrequencySeries *hptilde, /**< +-polarization waveform */
+            COMPLEX16FrequencySeries *hctilde, /**< x-polarization waveform */
+            const SphHarmModeArray *arr, /**< complex modes h(l,m) */
+            REAL8 theta, /**< polar angle (rad) */
+            REAL8 phi /**< azimuthal angle (rad) */
+            )
+{
+    XLAL_CHECK( hptilde && hctilde && arr, XLAL_EFAULT );
+    XLAL_CHECK( hptilde->data->length == arr->length && hctilde->data->length == arr->length, XLAL_EBADLEN );
+
+    REAL8 *Yre = XLALMalloc( arr->nmodes * sizeof(*Yre) );
+    REAL8 *Yim = XLALMalloc( arr->nmodes * sizeof(*Yim) );
+    if( !Yre || !Yim ){
+        XLALFree( Yre );
+        XLALFree( Yim );
+        XLAL_ERROR( XLAL_ENOMEM );
+    }
+    for( UINT4 k = 0; k < arr->nmodes; k++ ){
+        COMPLEX16 Y = 0.5 * XLALSpinWeightedSphericalHarmonic( theta, phi, -2, arr->l[k], arr->m[k] );
+        Yre[k] = creal(Y);
+        Yim[k] = cimag(Y);
+    }
+
+    REAL8 *hp = (REAL8 *) hptilde->data->data;
+    REAL8 *hc = (REAL8 *) hctilde->data->data;
+    for( UINT4 j0 = 0; j0 < arr->length; j0 += SPHHARM_MODE_BLOCK ){
+        UINT4 j1 = j0 + SPHHARM_MODE_BLOCK < arr->length ? j0 + SPHHARM_MODE_BLOCK : arr->length;
+        for( UINT4 k = 0; k < arr->nmodes; k++ ){
+            const REAL8 *h = (const REAL8 *) (arr->data + (size_t) k * arr->length);
+            const REAL8 yr = Yre[k], yi = Yim[k];
+            for( UINT4 j = j0; j < j1; j++ ){
+                const REAL8 hr = h[2*j], hi = h[2*j+1];
+                const REAL8 pr = yr * hr - yi * hi, pi = yr * hi + yi * hr;
+                hp[2*j] += pr;
+                hp[2*j+1] += pi;
+                hc[2*j] -= pi;
+                hc[2*j+1] += pr;
+            }
+        }
+    }
+
+    XLALFree( Yre );
+    XLALFree( Yim );
+    return XLAL_SUCCESS;
+}
+
 /** @} */
 /** @} */
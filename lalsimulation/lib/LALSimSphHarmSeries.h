@@ -72,6 +72,28 @@ typedef struct tagSphHarmFrequencySeries {
     struct tagSphHarmFrequencySeries*    next; /**< next pointer */
 } SphHarmFrequencySeries;
 
+#ifndef SWIG /* exclude from SWIG interface */
+/**
+ * Structure to carry a collection of spherical harmonic modes sharing the
+ * same sampling in a single contiguous allocation. Mode k occupies
+ * data[k*length] ... data[(k+1)*length - 1], and a table indexed by
+ * (l,m) gives constant-time access to the slot of any mode.
+ */
+typedef struct tagSphHarmModeArray {
+    UINT4                           nmodes; /**< Number of modes stored */
+    UINT4                           length; /**< Number of samples per mode */
+    UINT4                           lmax; /**< Largest l index of any mode */
+    UINT4*                          l; /**< l index of each slot */
+    INT4*                           m; /**< m index of each slot */
+    INT4*                           slot; /**< Slot of mode (l,m) at [l*l + l + m], or -1 if absent */
+    COMPLEX16*                      data; /**< Mode data, nmodes x length */
+    LIGOTimeGPS                     epoch; /**< Epoch of the modes */
+    REAL8                           f0; /**< Heterodyning or initial frequency */
+    REAL8                           delta; /**< Sample spacing: deltaT or deltaF */
+    LALUnit                         sampleUnits; /**< Units of the mode data */
+} SphHarmModeArray;
+#endif
+
 /** @} */
 
 SphHarmTimeSeries* XLALSphHarmTimeSeriesAddMode(SphHarmTimeSeries *appended, const COMPLEX16TimeSeries* inmode, UINT4 l, INT4 m);
@@ -121,6 +143,18 @@ SWIGLAL(RETURN_OWNED_BY_1ST_ARG(COMPLEX16FrequencySeries*, XLALSphHarmFrequencyS
 
 COMPLEX16FrequencySeries* XLALSphHarmFrequencySeriesGetMode(SphHarmFrequencySeries *ts, UINT4 l, INT4 m);
 
+#ifndef SWIG /* exclude from SWIG interface */
+SphHarmModeArray *XLALCreateSphHarmModeArray(const UINT4 *l, const INT4 *m, UINT4 nmodes, UINT4 length);
+void XLALDestroySphHarmModeArray(SphHarmModeArray *arr);
+COMPLEX16 *XLALSphHarmModeArrayGetMode(SphHarmModeArray *arr, UINT4 l, INT4 m);
+SphHarmModeArray *XLALSphHarmModeArrayFromSphHarmTimeSeries(SphHarmTimeSeries *hlms);
+SphHarmModeArray *XLALSphHarmModeArrayFromSphHarmFrequencySeries(SphHarmFrequencySeries *hlms);
+SphHarmTimeSeries *XLALSphHarmTimeSeriesFromSphHarmModeArray(const SphHarmModeArray *arr);
+SphHarmFrequencySeries *XLALSphHarmFrequencySeriesFromSphHarmModeArray(const SphHarmModeArray *arr);
+int XLALSphHarmModeArrayAddModesTD(REAL8TimeSeries *hplus, REAL8TimeSeries *hcross, const SphHarmModeArray *arr, REAL8 theta, REAL8 phi);
+int XLALSphHarmModeArrayAddModesFD(COMPLEX16FrequencySeries *hptilde, COMPLEX16FrequencySeries *hctilde, const SphHarmModeArray *arr, REAL8 theta, REAL8 phi);
+#endif
+
 #if 0
 { /* so that editors will match succeeding brace */
 #elif defined(__cplusplus)
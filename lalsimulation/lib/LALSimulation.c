@@ -40,8 +40,13 @@
 #include <lal/FrequencySeries.h>
 #include <lal/TimeFreqFFT.h>
 #include <lal/Window.h>
+#include <lal/LogPrintf.h>
 #include "check_series_macros.h"
 
+#ifndef _OPENMP
+#define omp ignore
+#endif
+
 /*
  * ============================================================================
  *
@@ -941,19 +946,18 @@ int XLALSimAddInjectionREAL4TimeSeries(
 
 
 
-/* Helper routine that computes a segment of strain data with a single
- * time delay and beam pattern applied to the whole segment.  The duration
- * of the segment must therefore be reasonably short or else the movement
- * of the earth will invalidate the use of a single time shift and beam
- * pattern for the entire segment. */
-static int XLALSimComputeStrainSegmentREAL8TimeSeries(
+/* Helper routine that computes the Fourier transform of a segment of
+ * strain data, returned in work1, with a single time delay and beam pattern
+ * applied to the whole segment; the segment is used as workspace and only
+ * its epoch, sample interval and length are significant on input.  The
+ * DC and Nyquist components are not adjusted. */
+static int XLALSimComputeStrainSegmentTildeREAL8(
+	COMPLEX16FrequencySeries *work1,
+	COMPLEX16FrequencySeries *work2,
 	REAL8TimeSeries *segment,
 	const REAL8TimeSeries *hplus,
 	const REAL8TimeSeries *hcross,
-	COMPLEX16FrequencySeries *work1,
-	COMPLEX16FrequencySeries *work2,
 	REAL8FFTPlan *fwdplan,
-	REAL8FFTPlan *revplan,
 	REAL8Window *window,
 	double ra,
 	double dec,
@@ -1067,6 +1071,35 @@ static int XLALSimComputeStrainSegmentREAL8TimeSeries(
 		work1->data->data[k] *= fac;
 	}
 
+	return 0;
+}
+
+/* Helper routine that computes a segment of strain data with a single
+ * time delay and beam pattern applied to the whole segment.  The duration
+ * of the segment must therefore be reasonably short or else the movement
+ * of the earth will invalidate the use of a single time shift and beam
+ * pattern for the entire segment. */
+static int XLALSimComputeStrainSegmentREAL8TimeSeries(
+	REAL8TimeSeries *segment,
+	const REAL8TimeSeries *hplus,
+	const REAL8TimeSeries *hcross,
+	COMPLEX16FrequencySeries *work1,
+	COMPLEX16FrequencySeries *work2,
+	REAL8FFTPlan *fwdplan,
+	REAL8FFTPlan *revplan,
+	REAL8Window *window,
+	double ra,
+	double dec,
+	double psi,
+	LALDetector *detector,
+	const COMPLEX16FrequencySeries *response
+)
+{
+	if (XLALSimComputeStrainSegmentTildeREAL8(work1, work2, segment,
+		hplus, hcross, fwdplan, window, ra, dec, psi, detector,
+		response) < 0)
+		XLAL_ERROR(XLAL_EFUNC);
+
 	/* adjust DC and Nyquist components: the DC component must always be
 	 * real-valued; because the calling routine has made the time series
 	 * have an even length, the Nyquist component must also be real-valued;
@@ -1452,6 +1485,307 @@ freereturn:
 	return 0;
 }
 
+/* start time of an injection relative to the target, used to sort a batch
+ * of injections */
+struct injection_start {
+	double start;
+	size_t index;
+};
+
+static int injection_start_cmp(const void *a, const void *b)
+{
+	const struct injection_start *x = a;
+	const struct injection_start *y = b;
+	if (x->start < y->start)
+		return -1;
+	if (x->start > y->start)
+		return 1;
+	return x->index < y->index ? -1 : x->index > y->index;
+}
+
+/**
+ * @brief Computes strain for a detector and injects many signals into a
+ * target time series.
+ * @details Equivalent to calling XLALSimInjectDetectorStrainREAL8TimeSeries()
+ * once for each signal, but organised for injecting large numbers of
+ * signals into long time series.  The target is divided into overlapping
+ * blocks of the same length as the segments used by that routine, and the
+ * signals are sorted by start time and assigned to the blocks they overlap.
+ * In each block the strain of every overlapping signal is accumulated in
+ * the frequency domain, so that only one response division and one inverse
+ * FFT are needed per block however many signals it contains, and blocks
+ * without signals are skipped.  The result is cross-faded into the target
+ * directly, without a full-length intermediate series for each signal.
+ * FFT plans are created once and shared, and blocks are processed in
+ * parallel when OpenMP is enabled; the number of signals injected per
+ * second is reported at the info verbosity level.
+ *
+ * Unlike the single-signal routine, the strain is not additionally tapered
+ * at the start and end of each signal, so the waveforms should be tapered
+ * (e.g., with XLALSimInspiralREAL8WaveTaper()) before injection.
+ *
+ * @param[in,out] target Time series to inject strain into.
+ * @param[in] hplus Array of time series with plus-polarization waveforms.
+ * @param[in] hcross Array of time series with cross-polarization waveforms.
+ * @param[in] ra Array of right ascensions of the sources (radians).
+ * @param[in] dec Array of declinations of the sources (radians).
+ * @param[in] psi Array of polarization angles of the sources (radians).
+ * @param[in] nsignals Number of signals.
+ * @param[in] detector Detector to use when computing strain.
+ * @param[in] response Response function to use, or NULL if none.  If given,
+ * it must be sampled at the frequencies of the 2 s segments used internally.
+ * @retval 0 Success.
+ * @retval <0 Failure.
+ */
+int XLALSimInjectDetectorStrainBatchREAL8TimeSeries(
+	REAL8TimeSeries *target,
+	REAL8TimeSeries **hplus,
+	REAL8TimeSeries **hcross,
+	const double *ra,
+	const double *dec,
+	const double *psi,
+	size_t nsignals,
+	LALDetector *detector,
+	const COMPLEX16FrequencySeries *response
+)
+{
+	const double nominal_segdur = 2.0; /* nominal segment duration = 2s */
+	const double max_time_delay = 0.1; /* generous allowed time delay */
+	const size_t strides_per_segment = 2; /* 2 strides in one segment */
+	struct injection_start *order = NULL;
+	size_t *first = NULL;	/* first block overlapped by each signal */
+	size_t *last = NULL;	/* last block overlapped by each signal */
+	size_t *count = NULL;	/* start of each block's list of signals */
+	size_t *list = NULL;	/* signals overlapping each block */
+	size_t seglen;		/* length of segment in samples */
+	size_t padlen;		/* padding at beginning and end of segment */
+	size_t ovrlap;		/* overlapping data length */
+	size_t stride;		/* stride of each block */
+	size_t nblocks;		/* number of blocks */
+	size_t i;
+	REAL8FFTPlan *fwdplan = NULL;
+	REAL8FFTPlan *revplan = NULL;
+	REAL8Window *window = NULL;
+	double start_time = XLALGetTimeOfDay();
+	int errnum = 0;
+
+	LAL_CHECK_VALID_SERIES(target, XLAL_FAILURE);
+	if (nsignals == 0)
+		return 0;
+	if (!hplus || !hcross || !ra || !dec || !psi || !detector)
+		XLAL_ERROR(XLAL_EFAULT);
+	for (i = 0; i < nsignals; ++i) {
+		LAL_CHECK_VALID_SERIES(hplus[i], XLAL_FAILURE);
+		LAL_CHECK_VALID_SERIES(hcross[i], XLAL_FAILURE);
+		LAL_CHECK_CONSISTENT_TIME_SERIES(hplus[i], hcross[i], XLAL_FAILURE);
+		if (response == NULL) {
+			LAL_CHECK_COMPATIBLE_TIME_SERIES(target, hplus[i], XLAL_FAILURE);
+		} else {
+			if (fabs(target->deltaT - hplus[i]->deltaT ) > LAL_REAL8_EPS)
+				XLAL_ERROR(XLAL_ETIME);
+			if (fabs(target->f0 - hplus[i]->f0) > LAL_REAL8_EPS)
+				XLAL_ERROR(XLAL_EFREQ);
+		}
+	}
+
+	/* same segmentation as XLALSimInjectDetectorStrainREAL8TimeSeries():
+	 * the usable part of block k, after discarding the padding, covers
+	 * target samples [k stride - ovrlap, (k + 1) stride) and is
+	 * cross-faded with its neighbours over ovrlap samples at each end */
+
+	seglen = round_up_to_power_of_two(nominal_segdur / target->deltaT);
+	stride = seglen / strides_per_segment;
+	padlen = max_time_delay / target->deltaT;
+	ovrlap = seglen;
+	ovrlap -= 2 * padlen;
+	ovrlap -= stride;
+	nblocks = (target->data->length + ovrlap + stride - 1) / stride;
+	if (response && response->data->length != seglen / 2 + 1)
+		XLAL_ERROR(XLAL_EBADLEN, "response must have %zu samples", seglen / 2 + 1);
+
+	/* sort the signals by start time and find the range of blocks each
+	 * one overlaps, allowing for the maximum time delay */
+
+	order = XLALMalloc(nsignals * sizeof(*order));
+	first = XLALMalloc(nsignals * sizeof(*first));
+	last = XLALMalloc(nsignals * sizeof(*last));
+	count = XLALCalloc(nblocks + 1, sizeof(*count));
+	if (!order || !first || !last || !count) {
+		errnum = XLAL_ENOMEM;
+		goto freereturn;
+	}
+	for (i = 0; i < nsignals; ++i) {
+		order[i].start = XLALGPSDiff(&hplus[i]->epoch, &target->epoch) / target->deltaT;
+		order[i].index = i;
+	}
+	qsort(order, nsignals, sizeof(*order), injection_start_cmp);
+	for (i = 0; i < nsignals; ++i) {
+		const double a = order[i].start;
+		const double b = a + hplus[order[i].index]->data->length;
+		double kmin = floor((a - seglen + ovrlap) / stride) + 1;
+		double kmax = ceil((b + 2 * padlen + ovrlap) / stride) - 1;
+		if (kmin < 0)
+			kmin = 0;
+		if (kmax > nblocks - 1.0)
+			kmax = nblocks - 1.0;
+		if (kmax < kmin) {
+			/* disjoint from the target: nothing to do */
+			first[i] = 1;
+			last[i] = 0;
+			continue;
+		}
+		first[i] = kmin;
+		last[i] = kmax;
+		for (size_t k = first[i]; k <= last[i]; ++k)
+			++count[k + 1];
+	}
+
+	/* build the (time ordered) lists of signals overlapping each block */
+
+	for (i = 0; i < nblocks; ++i)
+		count[i + 1] += count[i];
+	list = XLALMalloc((count[nblocks] ? count[nblocks] : 1) * sizeof(*list));
+	if (!list) {
+		errnum = XLAL_ENOMEM;
+		goto freereturn;
+	}
+	{
+		size_t *fill = XLALMalloc(nblocks * sizeof(*fill));
+		if (!fill) {
+			errnum = XLAL_ENOMEM;
+			goto freereturn;
+		}
+		memcpy(fill, count, nblocks * sizeof(*fill));
+		for (i = 0; i < nsignals; ++i)
+			for (size_t k = first[i]; k <= last[i]; ++k)
+				list[fill[k]++] = order[i].index;
+		XLALFree(fill);
+	}
+
+	/* create FFT plans and window shared by all blocks */
+
+	fwdplan = XLALCreateForwardREAL8FFTPlan(seglen, 0);
+	revplan = XLALCreateReverseREAL8FFTPlan(seglen, 0);
+	window = XLALCreateTukeyREAL8Window(seglen, (double)padlen / seglen);
+	if (!fwdplan || !revplan || !window) {
+		errnum = XLAL_EFUNC;
+		goto freereturn;
+	}
+
+	/* process even blocks and then odd blocks so that threads never
+	 * write to the same part of the target at the same time */
+
+	#pragma omp parallel
+	{
+		REAL8TimeSeries *segment;
+		COMPLEX16FrequencySeries *work1;
+		COMPLEX16FrequencySeries *work2;
+		COMPLEX16FrequencySeries *accum;
+		int parity;
+		int failed = 0;	/* only this thread's status is read in the loop */
+
+		segment = XLALCreateREAL8TimeSeries(NULL, &target->epoch, target->f0, target->deltaT, &target->sampleUnits, seglen);
+		work1 = XLALCreateCOMPLEX16FrequencySeries(NULL, &target->epoch, 0, 0, &lalDimensionlessUnit, seglen / 2 + 1);
+		work2 = XLALCreateCOMPLEX16FrequencySeries(NULL, &target->epoch, 0, 0, &lalDimensionlessUnit, seglen / 2 + 1);
+		accum = XLALCreateCOMPLEX16FrequencySeries(NULL, &target->epoch, 0, 0, &lalDimensionlessUnit, seglen / 2 + 1);
+		if (!segment || !work1 || !work2 || !accum)
+			failed = 1;
+
+		for (parity = 0; parity < 2; ++parity) {
+			long kb;
+			#pragma omp for schedule(dynamic)
+			for (kb = parity; kb < (long) nblocks; kb += 2) {
+				const long seg_start = kb * (long) stride - (long) ovrlap - (long) padlen;
+				size_t n, j, k;
+
+				if (failed || count[kb] == count[kb + 1])
+					continue;
+
+				/* accumulate the strain of all signals in this block */
+
+				memset(accum->data->data, 0, accum->data->length * sizeof(*accum->data->data));
+				for (n = count[kb]; n < count[kb + 1]; ++n) {
+					const size_t idx = list[n];
+					segment->epoch = target->epoch;
+					XLALGPSAdd(&segment->epoch, seg_start * target->deltaT);
+					segment->deltaT = target->deltaT;
+					if (XLALSimComputeStrainSegmentTildeREAL8(work1, work2, segment, hplus[idx], hcross[idx], fwdplan, window, ra[idx], dec[idx], psi[idx], detector, NULL) < 0) {
+						failed = 1;
+						break;
+					}
+					for (k = 0; k < accum->data->length; ++k)
+						accum->data->data[k] += work1->data->data[k];
+				}
+				if (failed)
+					continue;
+
+				/* apply the response function once for all
+				 * signals, and adjust the DC and Nyquist
+				 * components as in the single-signal case */
+
+				if (response)
+					for (k = 0; k < accum->data->length; ++k)
+						accum->data->data[k] /= response->data->data[k];
+				accum->data->data[0] = cabs(accum->data->data[0]);
+				accum->data->data[accum->data->length - 1] = creal(accum->data->data[accum->data->length - 1]);
+				accum->epoch = segment->epoch;
+				accum->deltaF = work1->deltaF;
+				accum->sampleUnits = work1->sampleUnits;
+				if (XLALREAL8FreqTimeFFT(segment, accum, revplan) < 0) {
+					failed = 1;
+					continue;
+				}
+
+				/* cross-fade the usable part of the block into the
+				 * target */
+
+				for (j = padlen; j < seglen - padlen; ++j) {
+					const long t = seg_start + (long) j;
+					const size_t r = j - padlen;
+					double w = 1.0;
+					if (t < 0 || t >= (long) target->data->length)
+						continue;
+					if (r < ovrlap)
+						w = (double) r / ovrlap;
+					else if (r >= stride)
+						w = 1.0 - (double) (r - stride) / ovrlap;
+					target->data->data[t] += w * segment->data->data[j];
+				}
+			}
+		}
+
+		if (failed) {
+			#pragma omp critical (XLALSimInjectDetectorStrainBatchREAL8TimeSeries)
+			errnum = XLAL_EFUNC;
+		}
+
+		XLALDestroyCOMPLEX16FrequencySeries(accum);
+		XLALDestroyCOMPLEX16FrequencySeries(work2);
+		XLALDestroyCOMPLEX16FrequencySeries(work1);
+		XLALDestroyREAL8TimeSeries(segment);
+	}
+
+	if (!errnum) {
+		double elapsed = XLALGetTimeOfDay() - start_time;
+		XLALPrintInfo("%s(): injected %zu signals in %g s (%g signals/s)\n", __func__, nsignals, elapsed, elapsed > 0 ? nsignals / elapsed : 0.0);
+	}
+
+freereturn:
+
+	XLALDestroyREAL8Window(window);
+	XLALDestroyREAL8FFTPlan(revplan);
+	XLALDestroyREAL8FFTPlan(fwdplan);
+	XLALFree(list);
+	XLALFree(count);
+	XLALFree(last);
+	XLALFree(first);
+	XLALFree(order);
+
+	if (errnum)
+		XLAL_ERROR(errnum);
+	return 0;
+}
+
 /**
  * @brief Computes strain for a detector and injects into target time series.
  * @details This routine takes care of the time-changing time delay from
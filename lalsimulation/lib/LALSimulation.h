@@ -177,6 +177,20 @@ int XLALSimInjectDetectorStrainREAL8TimeSeries(
 	const COMPLEX16FrequencySeries *response
 );
 
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALSimInjectDetectorStrainBatchREAL8TimeSeries(
+	REAL8TimeSeries *target,
+	REAL8TimeSeries **hplus,
+	REAL8TimeSeries **hcross,
+	const double *ra,
+	const double *dec,
+	const double *psi,
+	size_t nsignals,
+	LALDetector *detector,
+	const COMPLEX16FrequencySeries *response
+);
+#endif
+
 int XLALSimInjectDetectorStrainREAL4TimeSeries(
 	REAL4TimeSeries *target,
 	const REAL4TimeSeries *hplus,
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check the frequency-domain sine-Gaussian and Gaussian banks against
+ * the Fourier transforms of XLALSimBurstSineGaussian() and
+ * XLALSimBurstGaussian().
+ *
+ * The time-domain waveforms are zero-padded to one second, transformed, and
+ * referred to t = 0, where the banks' Gaussian envelopes peak.  They differ
+ * from the banks' exact transforms only by their tapering window, which
+ * starts 5.25 widths from the peak, so the relative L2 difference must be
+ * below TOLERANCE.  The low-Q case checks the image term at -f0.  The bank
+ * inner products must agree with the sums over the expanded templates.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Date.h>
+#include <lal/Units.h>
+#include <lal/AVFactories.h>
+#include <lal/Sequence.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/TimeFreqFFT.h>
+#include <lal/LALSimBurst.h>
+
+#define SAMPLE_RATE 16384
+#define DELTA_T (1. / SAMPLE_RATE)
+#define THRESHOLD 1e-10
+/* tapering window of the time-domain waveforms */
+#define TOLERANCE 1e-7
+/* round-off of the inner products */
+#define INNER_PRODUCT_TOLERANCE 1e-12
+
+typedef struct {
+    REAL8 Q, centre_frequency;
+} sine_gaussian_case;
+
+static const sine_gaussian_case sg_cases[] = {
+    {9., 250.},
+    {3., 1000.},
+    {1.5, 60.}
+};
+
+static const REAL8 gaussian_durations[] = {1e-3, 4e-3};
+
+#define HRSS 1e-21
+#define ECCENTRICITY 0.4
+#define PHASE 0.7
+
+/* Fourier transform of a time series zero-padded to SAMPLE_RATE samples,
+ * referred to t = 0 */
+static COMPLEX16FrequencySeries *transform(REAL8TimeSeries *h, const REAL8FFTPlan *plan)
+{
+    const INT4 pad = (SAMPLE_RATE - (INT4) h->data->length) / 2;
+    COMPLEX16FrequencySeries *tilde;
+    REAL8 t0;
+
+    XLAL_CHECK_NULL(pad >= 0, XLAL_EBADLEN);
+    XLAL_CHECK_NULL(XLALResizeREAL8TimeSeries(h, -pad, SAMPLE_RATE), XLAL_EFUNC);
+    tilde = XLALCreateCOMPLEX16FrequencySeries(NULL, &h->epoch, 0., 0., &lalDimensionlessUnit, SAMPLE_RATE / 2 + 1);
+    XLAL_CHECK_NULL(tilde, XLAL_EFUNC);
+    XLAL_CHECK_NULL(XLALREAL8TimeFreqFFT(tilde, h, plan) == XLAL_SUCCESS, XLAL_EFUNC);
+    t0 = XLALGPSGetREAL8(&h->epoch);
+    for (UINT4 k = 0; k < tilde->data->length; k++)
+        tilde->data->data[k] *= cexp(-I * LAL_TWOPI * k * tilde->deltaF * t0);
+    return tilde;
+}
+
+/* relative L2 difference of template index of the bank from the transforms
+ * of the time-domain polarizations, and of its inner products with the
+ * transform of h+ from the sums over the expanded template */
+static int compare_template(const LALSimBurstFDBank *bank, UINT4 index, REAL8TimeSeries *hplus, REAL8TimeSeries *hcross, const REAL8FFTPlan *plan, const char *name)
+{
+    COMPLEX16FrequencySeries *tilde_hplus = transform(hplus, plan);
+    COMPLEX16FrequencySeries *tilde_hcross = transform(hcross, plan);
+    COMPLEX16FrequencySeries *bank_hplus = NULL, *bank_hcross = NULL;
+    COMPLEX16Vector *plus = XLALCreateCOMPLEX16Vector(bank->length);
+    COMPLEX16Vector *cross = XLALCreateCOMPLEX16Vector(bank->length);
+    COMPLEX16 dense_plus = 0., dense_cross = 0.;
+    REAL8 num = 0., den = 0.;
+
+    XLAL_CHECK(tilde_hplus && tilde_hcross && plus && cross, XLAL_EFUNC);
+    XLAL_CHECK(fabs(tilde_hplus->deltaF - bank->deltaF) < 1e-12, XLAL_EDATA);
+    XLAL_CHECK(XLALSimBurstFDBankTemplate(&bank_hplus, &bank_hcross, bank, index, tilde_hplus->data->length) == XLAL_SUCCESS, XLAL_EFUNC);
+
+    for (UINT4 k = 0; k < tilde_hplus->data->length; k++) {
+        const COMPLEX16 dp = bank_hplus->data->data[k] - tilde_hplus->data->data[k];
+        const COMPLEX16 dc = bank_hcross->data->data[k] - tilde_hcross->data->data[k];
+        num += creal(dp * conj(dp)) + creal(dc * conj(dc));
+        den += creal(tilde_hplus->data->data[k] * conj(tilde_hplus->data->data[k])) + creal(tilde_hcross->data->data[k] * conj(tilde_hcross->data->data[k]));
+        dense_plus += conj(bank_hplus->data->data[k]) * tilde_hplus->data->data[k];
+        dense_cross += conj(bank_hcross->data->data[k]) * tilde_hplus->data->data[k];
+    }
+    dense_plus *= 4. * bank->deltaF;
+    dense_cross *= 4. * bank->deltaF;
+    XLAL_CHECK(XLALSimBurstFDBankInnerProducts(plus, cross, bank, tilde_hplus, NULL) == XLAL_SUCCESS, XLAL_EFUNC);
+
+    const REAL8 diff = sqrt(num / den);
+    const REAL8 ipdiff = (cabs(plus->data[index] - dense_plus) + cabs(cross->data[index] - dense_cross)) / cabs(dense_plus);
+    printf("%s: relative difference %.3g, inner products %.3g\n", name, diff, ipdiff);
+
+    XLALDestroyCOMPLEX16FrequencySeries(tilde_hplus);
+    XLALDestroyCOMPLEX16FrequencySeries(tilde_hcross);
+    XLALDestroyCOMPLEX16FrequencySeries(bank_hplus);
+    XLALDestroyCOMPLEX16FrequencySeries(bank_hcross);
+    XLALDestroyCOMPLEX16Vector(plus);
+    XLALDestroyCOMPLEX16Vector(cross);
+
+    return diff < TOLERANCE && ipdiff < INNER_PRODUCT_TOLERANCE ? 0 : 1;
+}
+
+int main(void)
+{
+    const UINT4 nsg = XLAL_NUM_ELEM(sg_cases);
+    const UINT4 ng = XLAL_NUM_ELEM(gaussian_durations);
+    REAL8FFTPlan *plan = XLALCreateForwardREAL8FFTPlan(SAMPLE_RATE, 0);
+    REAL8Sequence *Q = XLALCreateREAL8Sequence(nsg);
+    REAL8Sequence *centre_frequency = XLALCreateREAL8Sequence(nsg);
+    REAL8Sequence *hrss = XLALCreateREAL8Sequence(nsg);
+    REAL8Sequence *eccentricity = XLALCreateREAL8Sequence(nsg);
+    REAL8Sequence *phase = XLALCreateREAL8Sequence(nsg);
+    REAL8Sequence *duration = XLALCreateREAL8Sequence(ng);
+    REAL8Sequence *ghrss = XLALCreateREAL8Sequence(ng);
+    LALSimBurstFDBank *bank;
+    REAL8TimeSeries *hplus, *hcross;
+    char name[64];
+    int failures = 0;
+    XLAL_CHECK_MAIN(plan && Q && centre_frequency && hrss && eccentricity && phase && duration && ghrss, XLAL_ENOMEM);
+
+    /* sine-Gaussians */
+    for (UINT4 k = 0; k < nsg; k++) {
+        Q->data[k] = sg_cases[k].Q;
+        centre_frequency->data[k] = sg_cases[k].centre_frequency;
+        hrss->data[k] = HRSS;
+        eccentricity->data[k] = ECCENTRICITY;
+        phase->data[k] = PHASE;
+    }
+    bank = XLALSimBurstSineGaussianFDBank(Q, centre_frequency, hrss, eccentricity, phase, 1. / (SAMPLE_RATE * DELTA_T), SAMPLE_RATE / 2., THRESHOLD);
+    XLAL_CHECK_MAIN(bank, XLAL_EFUNC);
+    for (UINT4 k = 0; k < nsg; k++) {
+        XLAL_CHECK_MAIN(XLALSimBurstSineGaussian(&hplus, &hcross, Q->data[k], centre_frequency->data[k], HRSS, ECCENTRICITY, PHASE, DELTA_T) == XLAL_SUCCESS, XLAL_EFUNC);
+        snprintf(name, sizeof(name), "sine-Gaussian Q = %g, f0 = %g Hz", Q->data[k], centre_frequency->data[k]);
+        failures += compare_template(bank, k, hplus, hcross, plan, name) != 0;
+        XLALDestroyREAL8TimeSeries(hplus);
+        XLALDestroyREAL8TimeSeries(hcross);
+    }
+    XLALSimBurstDestroyFDBank(bank);
+
+    /* Gaussians */
+    for (UINT4 k = 0; k < ng; k++) {
+        duration->data[k] = gaussian_durations[k];
+        ghrss->data[k] = HRSS;
+    }
+    bank = XLALSimBurstGaussianFDBank(duration, ghrss, 1. / (SAMPLE_RATE * DELTA_T), SAMPLE_RATE / 2., THRESHOLD);
+    XLAL_CHECK_MAIN(bank, XLAL_EFUNC);
+    for (UINT4 k = 0; k < ng; k++) {
+        XLAL_CHECK_MAIN(XLALSimBurstGaussian(&hplus, &hcross, duration->data[k], HRSS, DELTA_T) == XLAL_SUCCESS, XLAL_EFUNC);
+        snprintf(name, sizeof(name), "Gaussian duration = %g s", duration->data[k]);
+        failures += compare_template(bank, k, hplus, hcross, plan, name) != 0;
+        XLALDestroyREAL8TimeSeries(hplus);
+        XLALDestroyREAL8TimeSeries(hcross);
+    }
+    XLALSimBurstDestroyFDBank(bank);
+
+    XLALDestroyREAL8FFTPlan(plan);
+    XLALDestroyREAL8Sequence(Q);
+    XLALDestroyREAL8Sequence(centre_frequency);
+    XLALDestroyREAL8Sequence(hrss);
+    XLALDestroyREAL8Sequence(eccentricity);
+    XLALDestroyREAL8Sequence(phase);
+    XLALDestroyREAL8Sequence(duration);
+    XLALDestroyREAL8Sequence(ghrss);
+    LALCheckMemoryLeaks();
+
+    if (failures)
+        fprintf(stderr, "FAIL: %d frequency-domain templates differ from the transforms of the time-domain waveforms\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check the tabulated chirp times and starting frequencies against
+ * XLALSimInspiralChirpTimeBound() and XLALSimInspiralChirpStartFrequencyBound()
+ * across the table and at its edges, and the tables of the other duration
+ * estimators against XLALSimInspiralTaylorLength() and
+ * XLALSimIMRSEOBNRv2ChirpTimeSingleSpin().  The SEOBNRv2 table is skipped
+ * when its data file is not in $LAL_DATA_PATH.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/FileIO.h>
+#include <lal/Sequence.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimIMR.h>
+
+#define ETA_MIN 0.05
+#define CHI_MIN -0.9
+#define CHI_MAX 0.9
+#define MF_MIN 1e-4
+#define MF_MAX 0.05
+#define NETA 41
+#define NCHI 19 /* chi = 0, where the bound has a kink, is a grid point */
+#define NMF 301
+#define NPOINTS 1000
+/* interpolation error of the chirp time and of the starting frequency */
+#define TOLERANCE 2e-3
+#define FREQ_TOLERANCE 1e-3
+/* round-off only, at the grid points and for the exact inverse */
+#define NODE_TOLERANCE 1e-9
+/* below the last stable orbit M f = 0.0217 of XLALSimInspiralTaylorLength() */
+#define MF_MAX_TAYLOR_LENGTH 0.01
+/* within the SEOBNRv2 chirp-time data, 10 Hz to 1823 Hz at 12 Msun */
+#define MF_MIN_SEOBNRv2 1e-3
+#define NCHECK 200
+
+/* component masses (kg) for a total mass (Msun) and symmetric mass ratio */
+static void component_masses(REAL8 *m1, REAL8 *m2, REAL8 M, REAL8 eta)
+{
+    *m1 = 0.5 * M * (1.0 + sqrt(1.0 - 4.0 * eta)) * LAL_MSUN_SI;
+    *m2 = M * LAL_MSUN_SI - *m1;
+}
+
+/* deterministic, well-spread points in [0, 1) */
+static REAL8 sequence(UINT4 k, REAL8 alpha)
+{
+    return fmod(0.5 + k * alpha, 1.0);
+}
+
+static int outside(const LALSimInspiralDurationTable *table, REAL8 fstart, REAL8 m1, REAL8 m2, REAL8 chi)
+{
+    REAL8 t;
+    int errnum;
+    XLAL_TRY(t = XLALSimInspiralDurationTableChirpTime(table, fstart, m1, m2, chi), errnum);
+    return isnan(t) && errnum == XLAL_EDOM;
+}
+
+/* chirp time (s) of the estimator tabulated */
+static REAL8 exact_chirp_time(LALSimInspiralDurationEstimator estimator, REAL8 fstart, REAL8 m1, REAL8 m2, REAL8 chi)
+{
+    const REAL8 deltaT = 1e-3 * (m1 + m2) / LAL_MSUN_SI * LAL_MTSUN_SI;
+    switch (estimator) {
+    case LAL_SIM_INSPIRAL_DURATION_CHIRP_TIME_BOUND:
+        return XLALSimInspiralChirpTimeBound(fstart, m1, m2, chi, chi);
+    case LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH:
+        return XLALSimInspiralTaylorLength(deltaT, m1, m2, fstart, -1) + deltaT;
+    case LAL_SIM_INSPIRAL_DURATION_SEOBNRv2:
+        return XLALSimIMRSEOBNRv2ChirpTimeSingleSpin(m1, m2, chi, fstart);
+    default:
+        XLAL_ERROR_REAL8(XLAL_EINVAL);
+    }
+}
+
+/* interpolation error of a table of the estimator over [MfMin, MfMax] */
+static int check_estimator(LALSimInspiralDurationEstimator estimator, const char *name, REAL8 MfMin, REAL8 MfMax)
+{
+    LALSimInspiralDurationTable *table = XLALSimInspiralDurationTableCreate(estimator, ETA_MIN, CHI_MIN, CHI_MAX, MfMin, MfMax, NETA, NCHI, NMF);
+    REAL8 maxterr = 0.0, maxinverr = 0.0;
+    XLAL_CHECK(table, XLAL_EFUNC);
+
+    for (UINT4 k = 0; k < NCHECK; ++k) {
+        const REAL8 eta = ETA_MIN + (0.25 - ETA_MIN) * (0.001 + 0.998 * sequence(k, 0.6180339887498949));
+        const REAL8 M = 2.0 * pow(150.0, sequence(k, 0.4142135623730950));
+        const REAL8 Mf = MfMin * pow(MfMax / MfMin, 0.001 + 0.998 * sequence(k, 0.7320508075688772));
+        const REAL8 chi = CHI_MIN + (CHI_MAX - CHI_MIN) * sequence(k, 0.2360679774997897);
+        const REAL8 fstart = Mf / (M * LAL_MTSUN_SI);
+        REAL8 m1, m2;
+        component_masses(&m1, &m2, M, eta);
+
+        const REAL8 texact = exact_chirp_time(estimator, fstart, m1, m2, chi);
+        const REAL8 t = XLALSimInspiralDurationTableChirpTime(table, fstart, m1, m2, chi);
+        const REAL8 f = XLALSimInspiralDurationTableStartFrequency(table, t, m1, m2, chi);
+        XLAL_CHECK(!XLAL_IS_REAL8_FAIL_NAN(texact) && !XLAL_IS_REAL8_FAIL_NAN(t) && !XLAL_IS_REAL8_FAIL_NAN(f), XLAL_EFUNC);
+        maxterr = fmax(maxterr, fabs(t / texact - 1.0));
+        maxinverr = fmax(maxinverr, fabs(f / fstart - 1.0));
+
+        /* the spin-independent estimator fills every spin column */
+        if (estimator == LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH)
+            XLAL_CHECK(t == XLALSimInspiralDurationTableChirpTime(table, fstart, m1, m2, CHI_MIN), XLAL_EFAILED, "%s depends on spin", name);
+    }
+    printf("%s chirp time: maximum relative error = %.3g, inverse %.3g\n", name, maxterr, maxinverr);
+    XLALSimInspiralDurationTableDestroy(table);
+    XLAL_CHECK(maxterr < TOLERANCE, XLAL_ETOL, "%s chirp time", name);
+    XLAL_CHECK(maxinverr < NODE_TOLERANCE, XLAL_ETOL, "%s starting frequency", name);
+    return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+    REAL8Sequence *fstart = XLALCreateREAL8Sequence(NPOINTS);
+    REAL8Sequence *m1 = XLALCreateREAL8Sequence(NPOINTS);
+    REAL8Sequence *m2 = XLALCreateREAL8Sequence(NPOINTS);
+    REAL8Sequence *chi = XLALCreateREAL8Sequence(NPOINTS);
+    REAL8Sequence *tchirp = XLALCreateREAL8Sequence(NPOINTS);
+    REAL8Sequence *fout = XLALCreateREAL8Sequence(NPOINTS);
+    REAL8 maxterr = 0.0, maxferr = 0.0, maxinverr = 0.0;
+    int errnum;
+    XLAL_CHECK_MAIN(fstart && m1 && m2 && chi && tchirp && fout, XLAL_ENOMEM);
+
+    LALSimInspiralDurationTable *table = XLALSimInspiralDurationTableCreate(LAL_SIM_INSPIRAL_DURATION_CHIRP_TIME_BOUND, ETA_MIN, CHI_MIN, CHI_MAX, MF_MIN, MF_MAX, NETA, NCHI, NMF);
+    XLAL_CHECK_MAIN(table, XLAL_EFUNC);
+
+    /* across the table, for total masses from 2 to 300 Msun */
+    for (UINT4 k = 0; k < NPOINTS; ++k) {
+        const REAL8 eta = ETA_MIN + (0.25 - ETA_MIN) * (0.001 + 0.998 * sequence(k, 0.6180339887498949));
+        const REAL8 M = 2.0 * pow(150.0, sequence(k, 0.4142135623730950));
+        const REAL8 Mf = MF_MIN * pow(MF_MAX / MF_MIN, 0.001 + 0.998 * sequence(k, 0.7320508075688772));
+        chi->data[k] = CHI_MIN + (CHI_MAX - CHI_MIN) * sequence(k, 0.2360679774997897);
+        component_masses(&m1->data[k], &m2->data[k], M, eta);
+        fstart->data[k] = Mf / (M * LAL_MTSUN_SI);
+
+        const REAL8 texact = XLALSimInspiralChirpTimeBound(fstart->data[k], m1->data[k], m2->data[k], chi->data[k], chi->data[k]);
+        const REAL8 t = XLALSimInspiralDurationTableChirpTime(table, fstart->data[k], m1->data[k], m2->data[k], chi->data[k]);
+        XLAL_CHECK_MAIN(!XLAL_IS_REAL8_FAIL_NAN(t), XLAL_EFUNC);
+        maxterr = fmax(maxterr, fabs(t / texact - 1.0));
+
+        /* the starting frequency for the exact chirp time recovers fstart,
+         * and lies above the Newtonian lower bound */
+        const REAL8 f = XLALSimInspiralDurationTableStartFrequency(table, texact, m1->data[k], m2->data[k], chi->data[k]);
+        XLAL_CHECK_MAIN(!XLAL_IS_REAL8_FAIL_NAN(f), XLAL_EFUNC);
+        maxferr = fmax(maxferr, fabs(f / fstart->data[k] - 1.0));
+        XLAL_CHECK_MAIN(f >= (1.0 - FREQ_TOLERANCE) * XLALSimInspiralChirpStartFrequencyBound(texact, m1->data[k], m2->data[k]), XLAL_ETOL, "Starting frequency %g Hz below the lower bound", f);
+
+        /* and inverts the interpolated chirp time */
+        const REAL8 finv = XLALSimInspiralDurationTableStartFrequency(table, t, m1->data[k], m2->data[k], chi->data[k]);
+        maxinverr = fmax(maxinverr, fabs(finv / fstart->data[k] - 1.0));
+    }
+    printf("chirp time: maximum relative error = %.3g\n", maxterr);
+    printf("starting frequency: maximum relative error = %.3g, inverse %.3g\n", maxferr, maxinverr);
+    XLAL_CHECK_MAIN(maxterr < TOLERANCE, XLAL_ETOL);
+    XLAL_CHECK_MAIN(maxferr < FREQ_TOLERANCE, XLAL_ETOL);
+    XLAL_CHECK_MAIN(maxinverr < NODE_TOLERANCE, XLAL_ETOL);
+
+    /* the batch routines give the scalar results */
+    XLAL_CHECK_MAIN(XLALSimInspiralDurationTableChirpTimeBatch(tchirp, table, fstart, m1, m2, chi) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALSimInspiralDurationTableStartFrequencyBatch(fout, table, tchirp, m1, m2, chi) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 k = 0; k < NPOINTS; ++k) {
+        XLAL_CHECK_MAIN(tchirp->data[k] == XLALSimInspiralDurationTableChirpTime(table, fstart->data[k], m1->data[k], m2->data[k], chi->data[k]), XLAL_EFAILED);
+        XLAL_CHECK_MAIN(fout->data[k] == XLALSimInspiralDurationTableStartFrequency(table, tchirp->data[k], m1->data[k], m2->data[k], chi->data[k]), XLAL_EFAILED);
+    }
+
+    /* at the edges: equal masses, extreme spins and the ends in M f, where
+     * the corner is a grid point and only round-off remains */
+    {
+        const REAL8 M = 20.0;
+        const REAL8 fmin = MF_MIN * (1.0 + 1e-12) / (M * LAL_MTSUN_SI);
+        const REAL8 fmax = MF_MAX * (1.0 - 1e-12) / (M * LAL_MTSUN_SI);
+        const REAL8 chis[] = {CHI_MIN, 0.0, CHI_MAX};
+        REAL8 ma, mb;
+        component_masses(&ma, &mb, M, 0.25);
+        for (size_t j = 0; j < XLAL_NUM_ELEM(chis); ++j) {
+            const REAL8 flim[] = {fmin, fmax};
+            for (size_t i = 0; i < XLAL_NUM_ELEM(flim); ++i) {
+                const REAL8 texact = XLALSimInspiralChirpTimeBound(flim[i], ma, mb, chis[j], chis[j]);
+                const REAL8 t = XLALSimInspiralDurationTableChirpTime(table, flim[i], ma, mb, chis[j]);
+                XLAL_CHECK_MAIN(fabs(t / texact - 1.0) < NODE_TOLERANCE, XLAL_ETOL, "chi = %g, fstart = %g Hz: table %.17g, exact %.17g", chis[j], flim[i], t, texact);
+                XLAL_CHECK_MAIN(fabs(XLALSimInspiralDurationTableStartFrequency(table, t, ma, mb, chis[j]) / flim[i] - 1.0) < NODE_TOLERANCE, XLAL_ETOL);
+            }
+        }
+        /* smallest mass ratio */
+        component_masses(&ma, &mb, M, ETA_MIN * (1.0 + 1e-12));
+        XLAL_CHECK_MAIN(!XLAL_IS_REAL8_FAIL_NAN(XLALSimInspiralDurationTableChirpTime(table, 2.0 * fmin, ma, mb, 0.3)), XLAL_EFUNC);
+
+        /* just outside */
+        XLAL_CHECK_MAIN(outside(table, 0.99 * fmin, ma, mb, 0.3), XLAL_EFAILED);
+        XLAL_CHECK_MAIN(outside(table, 1.01 * fmax, ma, mb, 0.3), XLAL_EFAILED);
+        XLAL_CHECK_MAIN(outside(table, 2.0 * fmin, ma, mb, CHI_MAX + 0.01), XLAL_EFAILED);
+        XLAL_CHECK_MAIN(outside(table, 2.0 * fmin, ma, mb, CHI_MIN - 0.01), XLAL_EFAILED);
+        XLAL_CHECK_MAIN(outside(table, 2.0 * fmin, ma, mb, NAN), XLAL_EFAILED);
+        component_masses(&ma, &mb, M, 0.99 * ETA_MIN);
+        XLAL_CHECK_MAIN(outside(table, 2.0 * fmin, ma, mb, 0.3), XLAL_EFAILED);
+
+        /* a chirp time longer than the table holds */
+        component_masses(&ma, &mb, M, 0.25);
+        REAL8 f;
+        XLAL_TRY(f = XLALSimInspiralDurationTableStartFrequency(table, 1.01 * XLALSimInspiralChirpTimeBound(fmin, ma, mb, 0.3, 0.3), ma, mb, 0.3), errnum);
+        XLAL_CHECK_MAIN(isnan(f) && errnum == XLAL_EDOM, XLAL_EFAILED);
+
+        /* one point outside fails the batch and is flagged */
+        fstart->data[NPOINTS / 2] = 0.5 * fmin;
+        m1->data[NPOINTS / 2] = ma;
+        m2->data[NPOINTS / 2] = mb;
+        XLAL_TRY(XLALSimInspiralDurationTableChirpTimeBatch(tchirp, table, fstart, m1, m2, chi), errnum);
+        XLAL_CHECK_MAIN(errnum == XLAL_EDOM && isnan(tchirp->data[NPOINTS / 2]) && !isnan(tchirp->data[0]), XLAL_EFAILED);
+    }
+
+    XLALSimInspiralDurationTableDestroy(table);
+
+    /* the other estimators */
+    XLAL_CHECK_MAIN(check_estimator(LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH, "TaylorLength", MF_MIN, MF_MAX_TAYLOR_LENGTH) == XLAL_SUCCESS, XLAL_EFUNC);
+    {
+        char *path = XLAL_FILE_RESOLVE_PATH("SEOBNRv2ChirpTimeSS.dat");
+        if (path) {
+            XLALFree(path);
+            XLAL_CHECK_MAIN(check_estimator(LAL_SIM_INSPIRAL_DURATION_SEOBNRv2, "SEOBNRv2", MF_MIN_SEOBNRv2, MF_MAX) == XLAL_SUCCESS, XLAL_EFUNC);
+        } else
+            printf("SEOBNRv2: SEOBNRv2ChirpTimeSS.dat not found, skipped\n");
+    }
+
+    /* beyond the last stable orbit the TaylorLength estimate is not positive */
+    table = NULL;
+    XLAL_TRY(table = XLALSimInspiralDurationTableCreate(LAL_SIM_INSPIRAL_DURATION_TAYLOR_LENGTH, ETA_MIN, CHI_MIN, CHI_MAX, MF_MIN, 0.03, 5, 3, 11), errnum);
+    XLAL_CHECK_MAIN(table == NULL && errnum != 0, XLAL_EFAILED);
+    XLAL_TRY(table = XLALSimInspiralDurationTableCreate(LAL_SIM_INSPIRAL_NUM_DURATION_ESTIMATORS, ETA_MIN, CHI_MIN, CHI_MAX, MF_MIN, MF_MAX, 5, 3, 11), errnum);
+    XLAL_CHECK_MAIN(table == NULL && errnum == XLAL_EINVAL, XLAL_EFAILED);
+
+    XLALDestroyREAL8Sequence(fstart);
+    XLALDestroyREAL8Sequence(m1);
+    XLALDestroyREAL8Sequence(m2);
+    XLALDestroyREAL8Sequence(chi);
+    XLALDestroyREAL8Sequence(tchirp);
+    XLALDestroyREAL8Sequence(fout);
+    LALCheckMemoryLeaks();
+
+    return EXIT_SUCCESS;
+}
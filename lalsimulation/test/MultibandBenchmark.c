@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Compare the runtime and the waveform of the multibanded models
+ * with their full-resolution output for a binary neutron star.
+ *
+ * Usage: MultibandBenchmark [f_min [threshold]]
+ *
+ * The default is a 1.4 + 1.3 Msun binary from 10 Hz, which lasts about
+ * 1000 s, sampled at DELTA_F = 1/2048 Hz up to 2048 Hz.  The mismatch
+ * reported is weighted by the aLIGO zero-detuned high-power PSD.
+ * IMRPhenomHM has no tidal terms and is run on the point-particle binary.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/LogPrintf.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralWaveformParams.h>
+#include <lal/LALSimNoise.h>
+
+#define M1 1.4
+#define M2 1.3
+#define LAMBDA1 400.
+#define LAMBDA2 600.
+#define F_HIGH 2048.
+#define DELTA_F (1. / 2048.)
+#define DISTANCE (100e6 * LAL_PC_SI)
+#define INCLINATION 0.6
+
+static int generate(COMPLEX16FrequencySeries **hplus, COMPLEX16FrequencySeries **hcross, REAL8 *elapsed, Approximant approximant, REAL8 f_min, REAL8 threshold)
+{
+    LALDict *params = XLALCreateDict();
+    XLAL_CHECK(params, XLAL_EFUNC);
+    if (approximant != IMRPhenomHM) {
+        XLALSimInspiralWaveformParamsInsertTidalLambda1(params, LAMBDA1);
+        XLALSimInspiralWaveformParamsInsertTidalLambda2(params, LAMBDA2);
+    }
+    XLALSimInspiralWaveformParamsInsertMultibandThreshold(params, threshold);
+    REAL8 t0 = XLALGetTimeOfDay();
+    int ret = XLALSimInspiralChooseFDWaveform(hplus, hcross, M1 * LAL_MSUN_SI, M2 * LAL_MSUN_SI,
+            0., 0., 0.02, 0., 0., -0.01, DISTANCE, INCLINATION, 0., 0., 0., 0., DELTA_F, f_min, F_HIGH, f_min,
+            params, approximant);
+    *elapsed = XLALGetTimeOfDay() - t0;
+    XLALDestroyDict(params);
+    XLAL_CHECK(ret == XLAL_SUCCESS, XLAL_EFUNC);
+    return XLAL_SUCCESS;
+}
+
+/* 1 - <a|b> / sqrt(<a|a><b|b>) with inverse-PSD weights above f_min */
+static REAL8 mismatch(const COMPLEX16FrequencySeries *a, const COMPLEX16FrequencySeries *b, REAL8 f_min)
+{
+    COMPLEX16 ab = 0.;
+    REAL8 aa = 0., bb = 0.;
+    for (UINT4 k = (UINT4) ceil(f_min / DELTA_F); k < a->data->length && k < b->data->length; k++) {
+        const REAL8 w = 1. / XLALSimNoisePSDaLIGOZeroDetHighPower(k * DELTA_F);
+        ab += w * conj(a->data->data[k]) * b->data->data[k];
+        aa += w * creal(conj(a->data->data[k]) * a->data->data[k]);
+        bb += w * creal(conj(b->data->data[k]) * b->data->data[k]);
+    }
+    return 1. - creal(ab) / sqrt(aa * bb);
+}
+
+int main(int argc, char *argv[])
+{
+    const Approximant approximants[] = { IMRPhenomD_NRTidalv2, IMRPhenomHM, SEOBNRv4_ROM_NRTidalv2 };
+    REAL8 f_min = argc > 1 ? atof(argv[1]) : 10.;
+    REAL8 threshold = argc > 2 ? atof(argv[2]) : 1e-3;
+
+    printf("f_min = %g Hz, m1 = %g, m2 = %g, deltaF = 1/%g Hz, threshold = %g\n", f_min, M1, M2, 1. / DELTA_F, threshold);
+    for (UINT4 j = 0; j < XLAL_NUM_ELEM(approximants); j++) {
+        COMPLEX16FrequencySeries *hplusFull = NULL, *hcrossFull = NULL;
+        COMPLEX16FrequencySeries *hplusMB = NULL, *hcrossMB = NULL;
+        REAL8 elapsedFull, elapsedMB;
+
+        XLAL_CHECK_MAIN(generate(&hplusFull, &hcrossFull, &elapsedFull, approximants[j], f_min, 0.) == XLAL_SUCCESS, XLAL_EFUNC);
+        XLAL_CHECK_MAIN(generate(&hplusMB, &hcrossMB, &elapsedMB, approximants[j], f_min, threshold) == XLAL_SUCCESS, XLAL_EFUNC);
+
+        printf("%s: %u bins\n", XLALSimInspiralGetStringFromApproximant(approximants[j]), hplusFull->data->length);
+        printf("  full resolution: %8.3f s\n", elapsedFull);
+        printf("  multibanded:     %8.3f s\n", elapsedMB);
+        printf("  speed-up: %.2f\n", elapsedFull / elapsedMB);
+        printf("  mismatch: %.3g\n", mismatch(hplusFull, hplusMB, f_min));
+
+        XLALDestroyCOMPLEX16FrequencySeries(hplusFull);
+        XLALDestroyCOMPLEX16FrequencySeries(hcrossFull);
+        XLALDestroyCOMPLEX16FrequencySeries(hplusMB);
+        XLALDestroyCOMPLEX16FrequencySeries(hcrossMB);
+    }
+
+    LALCheckMemoryLeaks();
+    return 0;
+}
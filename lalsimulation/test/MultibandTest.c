@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that multibanded waveforms agree with direct evaluation on
+ * the uniform grid to within the requested threshold.
+ *
+ * The engine is checked on an analytic chirp, then each model wired to it
+ * (IMRPhenomD, the IMRPhenomHM modes and SEOBNRv4_ROM) against its own
+ * full-resolution output.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralWaveformParams.h>
+#include <lal/LALSimNoise.h>
+
+#include "LALSimIMRMultiband.h"
+
+#define F_LOW 20.
+#define F_HIGH 2048.
+#define DELTA_F (1. / 64.)
+#define THRESHOLD 1e-3
+#define MISMATCH_TOLERANCE 1e-6
+
+/* Leading-order chirp with a smooth high-frequency taper */
+static int chirp_amp_phase(REAL8 *amp, REAL8 *phase, const REAL8 *freqs, UINT4 n, void *params)
+{
+    const REAL8 Mc = *(const REAL8 *) params;
+    for (UINT4 i = 0; i < n; i++) {
+        const REAL8 f = freqs[i];
+        amp[i] = pow(f, -7. / 6.) / (1. + exp((f - 1500.) / 50.));
+        phase[i] = -3. / 128. * pow(LAL_PI * Mc * f, -5. / 3.);
+    }
+    return XLAL_SUCCESS;
+}
+
+/* relative L2 error and largest pointwise relative error of h against href */
+static void compare(REAL8 *relL2, REAL8 *maxrel, const COMPLEX16 *h, const COMPLEX16 *href, const REAL8 *weight, UINT4 n)
+{
+    REAL8 num = 0., den = 0.;
+    *maxrel = 0.;
+    for (UINT4 k = 0; k < n; k++) {
+        const REAL8 w = weight ? weight[k] : 1.;
+        const REAL8 err = cabs(h[k] - href[k]), ref = cabs(href[k]);
+        num += w * err * err;
+        den += w * ref * ref;
+        if (ref > 0. && err / ref > *maxrel)
+            *maxrel = err / ref;
+    }
+    *relL2 = sqrt(num / den);
+}
+
+/* mismatch 1 - <a|b> / sqrt(<a|a><b|b>) with inverse-PSD weights */
+static REAL8 mismatch(const COMPLEX16 *a, const COMPLEX16 *b, const REAL8 *weight, UINT4 n)
+{
+    COMPLEX16 ab = 0.;
+    REAL8 aa = 0., bb = 0.;
+    for (UINT4 k = 0; k < n; k++) {
+        ab += weight[k] * conj(a[k]) * b[k];
+        aa += weight[k] * creal(conj(a[k]) * a[k]);
+        bb += weight[k] * creal(conj(b[k]) * b[k]);
+    }
+    return 1. - creal(ab) / sqrt(aa * bb);
+}
+
+/* generate approximant with and without multibanding, for linear and cubic
+ * amplitude interpolation; nonzero if any comparison fails */
+static int check_model(Approximant approximant, REAL8 m1, REAL8 m2, REAL8 s1z, REAL8 s2z)
+{
+    const INT4 orders[] = { 1, 3 };
+    const REAL8 dist = 500.e6 * LAL_PC_SI, incl = 0.6, phiRef = 0.7;
+    const char *name = XLALSimInspiralGetStringFromApproximant(approximant);
+    COMPLEX16FrequencySeries *hpref = NULL, *hcref = NULL;
+    int failures = 0;
+
+    m1 *= LAL_MSUN_SI;
+    m2 *= LAL_MSUN_SI;
+    LALDict *params = XLALCreateDict();
+    XLAL_CHECK(params, XLAL_EFUNC);
+    XLAL_CHECK(XLALSimInspiralChooseFDWaveform(&hpref, &hcref, m1, m2, 0., 0., s1z, 0., 0., s2z, dist, incl, phiRef, 0., 0., 0., DELTA_F, F_LOW, F_HIGH, 0., params, approximant) == XLAL_SUCCESS, XLAL_EFUNC);
+    const UINT4 n = hpref->data->length;
+
+    REAL8 *weight = XLALMalloc(n * sizeof(*weight));
+    XLAL_CHECK(weight, XLAL_ENOMEM);
+    for (UINT4 k = 0; k < n; k++) {
+        const REAL8 f = k * DELTA_F;
+        weight[k] = (f >= F_LOW && f <= F_HIGH) ? 1. / XLALSimNoisePSDaLIGOZeroDetHighPower(f) : 0.;
+    }
+
+    XLAL_CHECK(XLALSimInspiralWaveformParamsInsertMultibandThreshold(params, THRESHOLD) == XLAL_SUCCESS, XLAL_EFUNC);
+    for (UINT4 j = 0; j < XLAL_NUM_ELEM(orders); j++) {
+        COMPLEX16FrequencySeries *hp = NULL, *hc = NULL;
+        REAL8 relL2, maxrel;
+        XLAL_CHECK(XLALSimInspiralWaveformParamsInsertMultibandAmpInterpol(params, orders[j]) == XLAL_SUCCESS, XLAL_EFUNC);
+        XLAL_CHECK(XLALSimInspiralChooseFDWaveform(&hp, &hc, m1, m2, 0., 0., s1z, 0., 0., s2z, dist, incl, phiRef, 0., 0., 0., DELTA_F, F_LOW, F_HIGH, 0., params, approximant) == XLAL_SUCCESS, XLAL_EFUNC);
+        XLAL_CHECK(hp->data->length == n, XLAL_EBADLEN);
+
+        compare(&relL2, &maxrel, hp->data->data, hpref->data->data, weight, n);
+        REAL8 mm = mismatch(hp->data->data, hpref->data->data, weight, n);
+        printf("%s, order %d: relative L2 error = %.3g, mismatch = %.3g\n", name, orders[j], relL2, mm);
+        failures += relL2 < THRESHOLD && mm < MISMATCH_TOLERANCE ? 0 : 1;
+
+        compare(&relL2, &maxrel, hc->data->data, hcref->data->data, weight, n);
+        failures += relL2 < THRESHOLD ? 0 : 1;
+
+        XLALDestroyCOMPLEX16FrequencySeries(hp);
+        XLALDestroyCOMPLEX16FrequencySeries(hc);
+    }
+
+    XLALFree(weight);
+    XLALDestroyCOMPLEX16FrequencySeries(hpref);
+    XLALDestroyCOMPLEX16FrequencySeries(hcref);
+    XLALDestroyDict(params);
+    return failures;
+}
+
+int main(void)
+{
+    const INT4 orders[] = { 1, 3 };
+    int failures = 0;
+
+    /* The engine alone, on an analytic model */
+    {
+        const REAL8 Mc = 1.2 * LAL_MTSUN_SI;
+        const UINT4 n = (UINT4) ((F_HIGH - F_LOW) / DELTA_F) + 1;
+        REAL8 *freqs = XLALMalloc(n * sizeof(*freqs));
+        REAL8 *amp = XLALMalloc(n * sizeof(*amp));
+        REAL8 *phase = XLALMalloc(n * sizeof(*phase));
+        COMPLEX16 *href = XLALMalloc(n * sizeof(*href));
+        COMPLEX16 *h = XLALMalloc(n * sizeof(*h));
+        XLAL_CHECK_MAIN(freqs && amp && phase && href && h, XLAL_ENOMEM);
+        for (UINT4 k = 0; k < n; k++)
+            freqs[k] = F_LOW + k * DELTA_F;
+        XLAL_CHECK_MAIN(chirp_amp_phase(amp, phase, freqs, n, (void *) &Mc) == XLAL_SUCCESS, XLAL_EFUNC);
+        for (UINT4 k = 0; k < n; k++)
+            href[k] = amp[k] * cexp(I * phase[k]);
+
+        for (UINT4 j = 0; j < XLAL_NUM_ELEM(orders); j++) {
+            REAL8 relL2, maxrel;
+            XLAL_CHECK_MAIN(XLALSimIMRMultibandEvaluate(h, F_LOW, DELTA_F, n, THRESHOLD, orders[j], chirp_amp_phase, (void *) &Mc) == XLAL_SUCCESS, XLAL_EFUNC);
+            compare(&relL2, &maxrel, h, href, NULL, n);
+            printf("analytic chirp, order %d: relative L2 error = %.3g, maximum relative error = %.3g\n", orders[j], relL2, maxrel);
+            /* refinement stops once the midpoint error is below four times the threshold */
+            failures += relL2 < THRESHOLD && maxrel < 4. * THRESHOLD ? 0 : 1;
+        }
+
+        XLALFree(freqs);
+        XLALFree(amp);
+        XLALFree(phase);
+        XLALFree(href);
+        XLALFree(h);
+    }
+
+    /* The multibanded models through the public interface */
+    failures += check_model(IMRPhenomD, 30., 25., 0.4, -0.2) != 0;
+    failures += check_model(IMRPhenomHM, 45., 15., 0.3, 0.1) != 0;
+    failures += check_model(SEOBNRv4_ROM, 30., 25., 0.4, -0.2) != 0;
+
+    LALCheckMemoryLeaks();
+
+    if (failures)
+        fprintf(stderr, "FAIL: %d multibanding checks exceeded threshold %g\n", failures, THRESHOLD);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
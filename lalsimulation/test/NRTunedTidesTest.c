@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Regression test of the NRTidal phase, amplitude and taper against
+ * values computed with the original pow()-based expressions.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Sequence.h>
+#include <lal/LALSimIMR.h>
+
+#define NFREQ 8
+#define TOLERANCE 1e-12
+
+typedef struct {
+    REAL8 m1, m2, lambda1, lambda2;
+    NRTidal_version_type version;
+    REAL8 ref[NFREQ][3];        /* phase, amplitude, taper */
+} nrtidal_case;
+
+static const REAL8 freqs[NFREQ] = {20., 100., 400., 800., 1200., 1600., 2000., 2400.};
+
+/* The last two frequencies straddle the taper, which starts at the merger
+ * frequency of 1872.7 Hz for the 1.4 + 1.3 Msun binary */
+static const nrtidal_case cases[] = {
+    {1.4, 1.3, 400., 600., NRTidal_V, {
+        {-0.0067835221808765977, 0, 1},
+        {-0.10277492666399189, 0, 1},
+        {-1.1360655338599808, 0, 1},
+        {-4.2266319995442982, 0, 1},
+        {-10.046734859781614, 0, 1},
+        {-17.352823650199948, 0, 1},
+        {-25.05533312148938, 0, 0.80646322331881948},
+        {-33.718921964535205, 0, 0}}},
+    {1.4, 1.3, 400., 600., NRTidalv2_V, {
+        {-0.0067851456143832572, -0.00018427152314304097, 1},
+        {-0.10284508249647754, -0.0067580935571766891, 1},
+        {-1.1393254879711805, -0.20822717798663004, 1},
+        {-4.1380401266655387, -1.0319019423071081, 1},
+        {-9.2823481153753864, -2.1282190807576535, 1},
+        {-16.164709079329214, -3.3229350733608709, 1},
+        {-23.782106118731527, -4.6043236385389763, 0.80646322331881948},
+        {-31.757413968093083, -5.9734885377071967, 0}}},
+    /* the lighter body first, to check that the masses are swapped */
+    {1.3, 1.4, 600., 400., NRTidalv2NoAmpCorr_V, {
+        {-0.0067851456143832572, 0, 1},
+        {-0.10284508249647754, 0, 1},
+        {-1.1393254879711805, 0, 1},
+        {-4.1380401266655387, 0, 1},
+        {-9.2823481153753864, 0, 1},
+        {-16.164709079329214, 0, 1},
+        {-23.782106118731527, 0, 0.80646322331881948},
+        {-31.757413968093083, 0, 0}}},
+    {5.0, 1.4, 0., 500., NRTidalv2NSBH_V, {
+        {-0.0011691226381437504, 0, 1},
+        {-0.018261653596061918, 0, 1},
+        {-0.23320423099365573, 0, 1},
+        {-0.8772323969297684, 0, 1},
+        {-1.6582666287002248, 0, 1},
+        {-2.5665085195175532, 0, 1},
+        {-3.6190444094237155, 0, 1},
+        {-4.805782461740705, 0, 1}}}
+};
+
+static int check(REAL8 value, REAL8 ref)
+{
+    return fabs(value - ref) <= TOLERANCE * fabs(ref) ? 0 : 1;
+}
+
+int main(void)
+{
+    REAL8Sequence *fHz = XLALCreateREAL8Sequence(NFREQ);
+    REAL8Sequence *phi = XLALCreateREAL8Sequence(NFREQ);
+    REAL8Sequence *amp = XLALCreateREAL8Sequence(NFREQ);
+    REAL8Sequence *taper = XLALCreateREAL8Sequence(NFREQ);
+    int failures = 0;
+    XLAL_CHECK_MAIN(fHz && phi && amp && taper, XLAL_ENOMEM);
+    for (UINT4 i = 0; i < NFREQ; i++)
+        fHz->data[i] = freqs[i];
+
+    for (size_t j = 0; j < XLAL_NUM_ELEM(cases); j++) {
+        const nrtidal_case *c = &cases[j];
+        for (UINT4 i = 0; i < NFREQ; i++)
+            amp->data[i] = 0.;
+        XLAL_CHECK_MAIN(XLALSimNRTunedTidesFDTidalPhaseFrequencySeries(phi, amp, taper, fHz, c->m1 * LAL_MSUN_SI, c->m2 * LAL_MSUN_SI, c->lambda1, c->lambda2, c->version) == XLAL_SUCCESS, XLAL_EFUNC);
+        for (UINT4 i = 0; i < NFREQ; i++) {
+            const int bad = check(phi->data[i], c->ref[i][0]) + check(amp->data[i], c->ref[i][1]) + check(taper->data[i], c->ref[i][2]);
+            if (bad)
+                fprintf(stderr, "case %zu, f = %g Hz: phase %.17g, amplitude %.17g, taper %.17g\n", j, freqs[i], phi->data[i], amp->data[i], taper->data[i]);
+            failures += bad;
+        }
+
+        /* the stand-alone amplitude takes masses in solar masses */
+        if (c->version == NRTidalv2_V) {
+            XLAL_CHECK_MAIN(XLALSimNRTunedTidesFDTidalAmplitudeFrequencySeries(amp, fHz, c->m1, c->m2, c->lambda1, c->lambda2) == XLAL_SUCCESS, XLAL_EFUNC);
+            for (UINT4 i = 0; i < NFREQ; i++)
+                failures += check(amp->data[i], c->ref[i][1]);
+        }
+    }
+
+    XLALDestroyREAL8Sequence(fHz);
+    XLALDestroyREAL8Sequence(phi);
+    XLALDestroyREAL8Sequence(amp);
+    XLALDestroyREAL8Sequence(taper);
+    LALCheckMemoryLeaks();
+
+    if (failures)
+        fprintf(stderr, "FAIL: %d NRTidal values differ from the reference by more than %g\n", failures, TOLERANCE);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
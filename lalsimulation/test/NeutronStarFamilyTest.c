@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check the parallel and cached neutron star family constructors
+ * and the batch evaluation against XLALCreateSimNeutronStarFamily(), and the
+ * workspace and batch spectral decomposition constructors against
+ * XLALSimNeutronStarEOSSpectralDecomposition().
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALString.h>
+#include <lal/LALSimNeutronStar.h>
+
+#define NMASS 6
+/* maximum mass found by Brent's method to a relative pressure tolerance of 1e-6 */
+#define MAXMASS_TOLERANCE 1e-6
+/* stars well below the maximum are interpolated from the same grid */
+#define STAR_TOLERANCE 1e-9
+/* the workspace constructors evaluate 1/Gamma by Horner's rule rather than pow */
+#define EOS_TOLERANCE 1e-10
+#define NH 50
+
+static int rel_close(double a, double b, double tol)
+{
+    return fabs(a - b) <= tol * fabs(b);
+}
+
+static void check_family(LALSimNeutronStarEOS *eos)
+{
+    const double mass[NMASS] = {1.0 * LAL_MSUN_SI, 1.1 * LAL_MSUN_SI, 1.2 * LAL_MSUN_SI, 1.3 * LAL_MSUN_SI, 1.4 * LAL_MSUN_SI, 1.5 * LAL_MSUN_SI};
+    double radius[NMASS], k2[NMASS], lambda[NMASS];
+    int errnum;
+
+    LALSimNeutronStarFamily *fam = XLALCreateSimNeutronStarFamily(eos);
+    LALSimNeutronStarFamily *par = XLALCreateSimNeutronStarFamilyParallel(eos);
+    XLAL_CHECK_EXIT(fam && par);
+    const double mmax = XLALSimNeutronStarMaximumMass(fam);
+    printf("%s: maximum mass serial = %.9g Msun, parallel = %.9g Msun\n", XLALSimNeutronStarEOSName(eos), mmax / LAL_MSUN_SI, XLALSimNeutronStarMaximumMass(par) / LAL_MSUN_SI);
+    XLAL_CHECK_EXIT(rel_close(XLALSimNeutronStarMaximumMass(par), mmax, MAXMASS_TOLERANCE));
+    XLAL_CHECK_EXIT(XLALSimNeutronStarFamMinimumMass(par) == XLALSimNeutronStarFamMinimumMass(fam));
+    XLAL_CHECK_EXIT(mass[0] > XLALSimNeutronStarFamMinimumMass(fam) && mass[NMASS - 1] < 0.8 * mmax);
+
+    /* parallel family and batch evaluation against the serial family */
+    XLAL_CHECK_EXIT(XLALSimNeutronStarFamilyEvaluate(radius, k2, lambda, mass, NMASS, par) == 0);
+    for (size_t i = 0; i < NMASS; ++i) {
+        const double r = XLALSimNeutronStarRadius(mass[i], fam);
+        const double k = XLALSimNeutronStarLoveNumberK2(mass[i], fam);
+        const double c = LAL_MRSUN_SI * (mass[i] / LAL_MSUN_SI) / r;
+        XLAL_CHECK_EXIT(rel_close(radius[i], r, STAR_TOLERANCE));
+        XLAL_CHECK_EXIT(rel_close(k2[i], k, STAR_TOLERANCE));
+        XLAL_CHECK_EXIT(rel_close(lambda[i], (2.0 / 3.0) * k / pow(c, 5), 5 * STAR_TOLERANCE));
+        XLAL_CHECK_EXIT(radius[i] == XLALSimNeutronStarRadius(mass[i], par));
+        XLAL_CHECK_EXIT(k2[i] == XLALSimNeutronStarLoveNumberK2(mass[i], par));
+    }
+
+    /* optional outputs, and masses outside the family */
+    XLAL_CHECK_EXIT(XLALSimNeutronStarFamilyEvaluate(NULL, k2, NULL, mass, NMASS, par) == 0);
+    const double heavy = 1.01 * XLALSimNeutronStarMaximumMass(par);
+    XLAL_TRY(XLALSimNeutronStarFamilyEvaluate(radius, k2, lambda, &heavy, 1, par), errnum);
+    XLAL_CHECK_EXIT(errnum == XLAL_EDOM);
+
+    /* the cache is written on the first call and read on the second */
+    const UINT8 hash = XLALSimNeutronStarEOSHash(eos);
+    char *path = XLALStringAppendFmt(NULL, "./LALSimNeutronStarFamily-%016llx.dat", (unsigned long long)hash);
+    XLAL_CHECK_EXIT(path);
+    remove(path);
+    LALSimNeutronStarFamily *cached1 = XLALCreateSimNeutronStarFamilyCached(eos, ".");
+    XLAL_CHECK_EXIT(cached1);
+    FILE *fp = fopen(path, "rb");
+    XLAL_CHECK_EXIT(fp);
+    fclose(fp);
+    LALSimNeutronStarFamily *cached2 = XLALCreateSimNeutronStarFamilyCached(eos, ".");
+    XLAL_CHECK_EXIT(cached2);
+    XLAL_CHECK_EXIT(XLALSimNeutronStarMaximumMass(cached1) == XLALSimNeutronStarMaximumMass(par));
+    XLAL_CHECK_EXIT(XLALSimNeutronStarMaximumMass(cached2) == XLALSimNeutronStarMaximumMass(par));
+    for (size_t i = 0; i < NMASS; ++i) {
+        XLAL_CHECK_EXIT(XLALSimNeutronStarRadius(mass[i], cached2) == radius[i]);
+        XLAL_CHECK_EXIT(XLALSimNeutronStarCentralPressure(mass[i], cached2) == XLALSimNeutronStarCentralPressure(mass[i], par));
+    }
+    remove(path);
+    XLALFree(path);
+
+    /* a thread copy describes the same EOS */
+    LALSimNeutronStarEOS *copy = XLALSimNeutronStarEOSThreadCopy(eos);
+    XLAL_CHECK_EXIT(copy);
+    XLAL_CHECK_EXIT(XLALSimNeutronStarEOSHash(copy) == hash);
+    XLALDestroySimNeutronStarEOS(copy);
+
+    XLALDestroySimNeutronStarFamily(cached2);
+    XLALDestroySimNeutronStarFamily(cached1);
+    XLALDestroySimNeutronStarFamily(par);
+    XLALDestroySimNeutronStarFamily(fam);
+}
+
+/* eos against the reference EOS at NH pseudo-enthalpies up to the maximum */
+static void check_same_eos(LALSimNeutronStarEOS *eos, LALSimNeutronStarEOS *ref)
+{
+    const double hmax = XLALSimNeutronStarEOSMaxPseudoEnthalpy(ref);
+    XLAL_CHECK_EXIT(rel_close(XLALSimNeutronStarEOSMaxPseudoEnthalpy(eos), hmax, EOS_TOLERANCE));
+    XLAL_CHECK_EXIT(rel_close(XLALSimNeutronStarEOSMaxPressure(eos), XLALSimNeutronStarEOSMaxPressure(ref), EOS_TOLERANCE));
+    for (size_t i = 1; i < NH; ++i) {
+        const double h = hmax * i / NH;
+        XLAL_CHECK_EXIT(rel_close(XLALSimNeutronStarEOSPressureOfPseudoEnthalpy(h, eos), XLALSimNeutronStarEOSPressureOfPseudoEnthalpy(h, ref), EOS_TOLERANCE));
+        XLAL_CHECK_EXIT(rel_close(XLALSimNeutronStarEOSEnergyDensityOfPseudoEnthalpy(h, eos), XLALSimNeutronStarEOSEnergyDensityOfPseudoEnthalpy(h, ref), EOS_TOLERANCE));
+        XLAL_CHECK_EXIT(rel_close(XLALSimNeutronStarEOSRestMassDensityOfPseudoEnthalpy(h, eos), XLALSimNeutronStarEOSRestMassDensityOfPseudoEnthalpy(h, ref), EOS_TOLERANCE));
+    }
+}
+
+/* one workspace reused for expansions of different orders, and the batch
+ * constructor, against XLALSimNeutronStarEOSSpectralDecomposition() */
+static void check_spectral_workspace(void)
+{
+    double gamma4[] = {0.8651, 0.1548, -0.0151, -0.0002};
+    double gamma3[] = {1.0, 0.1, -0.01};
+    double gamma2[] = {0.9, 0.12};
+    double *gammas[] = {gamma4, gamma3, gamma2, gamma4};
+    const int sizes[] = {4, 3, 2, 4};
+    const double batch[] = {0.8651, 0.1548, -0.0151, -0.0002, 1.0, 0.12, -0.01, 0.0, 0.9, 0.14, -0.012, -0.0001};
+    LALSimNeutronStarEOS *eos[3];
+
+    LALSimNeutronStarEOSSpectralWorkspace *ws = XLALCreateSimNeutronStarEOSSpectralWorkspace();
+    XLAL_CHECK_EXIT(ws);
+    for (size_t i = 0; i < XLAL_NUM_ELEM(sizes); ++i) {
+        LALSimNeutronStarEOS *ref = XLALSimNeutronStarEOSSpectralDecomposition(gammas[i], sizes[i]);
+        LALSimNeutronStarEOS *sd = XLALSimNeutronStarEOSSpectralDecompositionWithWorkspace(gammas[i], sizes[i], ws);
+        XLAL_CHECK_EXIT(ref && sd);
+        check_same_eos(sd, ref);
+        XLALDestroySimNeutronStarEOS(sd);
+        XLALDestroySimNeutronStarEOS(ref);
+    }
+    XLALDestroySimNeutronStarEOSSpectralWorkspace(ws);
+
+    XLAL_CHECK_EXIT(XLALSimNeutronStarEOSSpectralDecompositionBatch(eos, batch, 4, 3) == 0);
+    for (size_t i = 0; i < 3; ++i) {
+        double g[4];
+        memcpy(g, batch + 4 * i, sizeof(g));
+        LALSimNeutronStarEOS *ref = XLALSimNeutronStarEOSSpectralDecomposition(g, 4);
+        XLAL_CHECK_EXIT(ref && eos[i]);
+        check_same_eos(eos[i], ref);
+        XLALDestroySimNeutronStarEOS(ref);
+        XLALDestroySimNeutronStarEOS(eos[i]);
+    }
+    printf("spectral decomposition: workspace and batch constructors agree\n");
+}
+
+int main(void)
+{
+    /* SLy, as a piecewise polytrope and as a spectral decomposition */
+    LALSimNeutronStarEOS *pp = XLALSimNeutronStarEOS4ParameterPiecewisePolytrope(33.384, 3.005, 2.988, 2.851);
+    LALSimNeutronStarEOS *sd = XLALSimNeutronStarEOS4ParameterSpectralDecomposition(0.8651, 0.1548, -0.0151, -0.0002);
+    LALSimNeutronStarEOS *pp2 = XLALSimNeutronStarEOS4ParameterPiecewisePolytrope(33.384, 3.005, 2.988, 2.851);
+    LALSimNeutronStarEOS *pp3 = XLALSimNeutronStarEOS4ParameterPiecewisePolytrope(33.384, 3.005, 2.988, 2.9);
+    XLAL_CHECK_EXIT(pp && sd && pp2 && pp3);
+
+    /* the hash identifies the EOS parameters */
+    XLAL_CHECK_EXIT(XLALSimNeutronStarEOSHash(pp) == XLALSimNeutronStarEOSHash(pp2));
+    XLAL_CHECK_EXIT(XLALSimNeutronStarEOSHash(pp) != XLALSimNeutronStarEOSHash(pp3));
+    XLAL_CHECK_EXIT(XLALSimNeutronStarEOSHash(pp) != XLALSimNeutronStarEOSHash(sd));
+
+    check_family(pp);
+    check_family(sd);
+    check_spectral_workspace();
+
+    XLALDestroySimNeutronStarEOS(pp3);
+    XLALDestroySimNeutronStarEOS(pp2);
+    XLALDestroySimNeutronStarEOS(sd);
+    XLALDestroySimNeutronStarEOS(pp);
+    LALCheckMemoryLeaks();
+
+    return 0;
+}
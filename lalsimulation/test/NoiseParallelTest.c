@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that the parallel noise stream depends only on the seed,
+ * not on the number of threads or on how the stream is chunked.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <lal/LALStdlib.h>
+#include <lal/Date.h>
+#include <lal/Units.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALSimNoise.h>
+
+#define DELTA_T (1.0 / 1024.0)
+#define SEGLEN 4096
+#define LENGTH (40 * SEGLEN / 2 + 123)
+#define SEED 4321
+#define PSD_LEVEL 1e-46
+
+/* copies each chunk of the stream into consecutive parts of a buffer */
+static int collect(const REAL8TimeSeries *s, void *data)
+{
+    REAL8TimeSeries *out = data;
+    const size_t offset = floor(0.5 + XLALGPSDiff(&s->epoch, &out->epoch) / s->deltaT);
+    XLAL_CHECK(offset + s->data->length <= out->data->length, XLAL_EBADLEN);
+    memcpy(out->data->data + offset, s->data->data, s->data->length * sizeof(*s->data->data));
+    return 0;
+}
+
+int main(void)
+{
+    LIGOTimeGPS epoch = {1000000000, 0};
+    REAL8FrequencySeries *psd = XLALCreateREAL8FrequencySeries("PSD", &epoch, 0.0, 1.0 / (SEGLEN * DELTA_T), &lalSecondUnit, SEGLEN / 2 + 1);
+    REAL8TimeSeries *ref = XLALCreateREAL8TimeSeries("ref", &epoch, 0.0, DELTA_T, &lalStrainUnit, LENGTH);
+    REAL8TimeSeries *s = XLALCreateREAL8TimeSeries("noise", &epoch, 0.0, DELTA_T, &lalStrainUnit, LENGTH);
+    XLAL_CHECK_EXIT(psd && ref && s);
+    for (size_t k = 0; k < psd->data->length; ++k)
+        psd->data->data[k] = PSD_LEVEL;
+
+    /* reference stream on a single thread */
+#ifdef _OPENMP
+    const int max_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+    XLAL_CHECK_EXIT(XLALSimNoiseParallel(ref, 0, psd, SEED) == 0);
+
+    /* white noise: the variance is the one-sided PSD times the bandwidth */
+    double var = 0.0;
+    for (size_t j = 0; j < ref->data->length; ++j)
+        var += ref->data->data[j] * ref->data->data[j];
+    var /= ref->data->length;
+    XLAL_CHECK_EXIT(fabs(var / (PSD_LEVEL / (2.0 * DELTA_T)) - 1.0) < 0.02);
+
+    /* the same stream for every thread count */
+#ifdef _OPENMP
+    for (int nthreads = 2; nthreads <= 8; nthreads *= 2) {
+        omp_set_num_threads(nthreads);
+        memset(s->data->data, 0, s->data->length * sizeof(*s->data->data));
+        XLAL_CHECK_EXIT(XLALSimNoiseParallel(s, 0, psd, SEED) == 0);
+        XLAL_CHECK_EXIT(memcmp(s->data->data, ref->data->data, LENGTH * sizeof(*s->data->data)) == 0);
+    }
+    omp_set_num_threads(max_threads);
+#endif
+
+    /* the same stream when generated in pieces, starting mid-segment */
+    {
+        const size_t cuts[] = {0, 1, 777, SEGLEN / 2, SEGLEN / 2 + 5, 3 * SEGLEN + 11, LENGTH};
+        memset(s->data->data, 0, s->data->length * sizeof(*s->data->data));
+        for (size_t c = 0; c + 1 < XLAL_NUM_ELEM(cuts); ++c) {
+            REAL8TimeSeries *piece = XLALCreateREAL8TimeSeries("piece", &epoch, 0.0, DELTA_T, &lalStrainUnit, cuts[c + 1] - cuts[c]);
+            XLAL_CHECK_EXIT(piece);
+            XLAL_CHECK_EXIT(XLALSimNoiseParallel(piece, cuts[c], psd, SEED) == 0);
+            memcpy(s->data->data + cuts[c], piece->data->data, piece->data->length * sizeof(*piece->data->data));
+            XLALDestroyREAL8TimeSeries(piece);
+        }
+        XLAL_CHECK_EXIT(memcmp(s->data->data, ref->data->data, LENGTH * sizeof(*s->data->data)) == 0);
+    }
+
+    /* the same stream through the chunked driver, with a short last chunk */
+    {
+        REAL8TimeSeries *chunk = XLALCreateREAL8TimeSeries("chunk", &epoch, 0.0, DELTA_T, &lalStrainUnit, 3 * SEGLEN + 1);
+        XLAL_CHECK_EXIT(chunk);
+        memset(s->data->data, 0, s->data->length * sizeof(*s->data->data));
+        XLAL_CHECK_EXIT(XLALSimNoiseStream(chunk, LENGTH, psd, SEED, collect, s) == 0);
+        XLAL_CHECK_EXIT(memcmp(s->data->data, ref->data->data, LENGTH * sizeof(*s->data->data)) == 0);
+        XLAL_CHECK_EXIT(chunk->data->length == 3 * SEGLEN + 1);
+        XLALDestroyREAL8TimeSeries(chunk);
+    }
+
+    /* a different seed gives a different stream */
+    XLAL_CHECK_EXIT(XLALSimNoiseParallel(s, 0, psd, SEED + 1) == 0);
+    XLAL_CHECK_EXIT(memcmp(s->data->data, ref->data->data, LENGTH * sizeof(*s->data->data)) != 0);
+
+    XLALDestroyREAL8TimeSeries(s);
+    XLALDestroyREAL8TimeSeries(ref);
+    XLALDestroyREAL8FrequencySeries(psd);
+    LALCheckMemoryLeaks();
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that the packed NRSur7dq2 and NRSur7dq4 fits agree with the
+ * fits they were packed from.
+ *
+ * Every output of every dynamics node and every empirical node of every
+ * waveform data piece is evaluated at a few parameter points, packed and
+ * unpacked.  The terms are summed in the same order, so the two agree up to
+ * the contraction of multiply-adds by the compiler: the difference must be
+ * below TOLERANCE times the sum of the absolute values of the terms.
+ * Surrogates whose data files are not in $LAL_DATA_PATH are skipped.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../lib/LALSimIMRPrecessingNRSur.c"
+
+#define TOLERANCE 1e-13
+
+/* q, chiA, chiB */
+static const REAL8 points[][7] = {
+    {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+    {1.7, 0.3, -0.2, 0.5, -0.4, 0.1, -0.3},
+    {3.2, -0.6, 0.1, -0.4, 0.2, 0.5, 0.6}
+};
+
+/* sum of the absolute values of the terms of output k of packed, which sets
+ * the scale of the round-off */
+static REAL8 abs_terms(const PackedFitData *packed, int k, const REAL8 *x_powers)
+{
+    REAL8 res = 0.0;
+    for (int i=packed->out_start[k]; i < packed->out_start[k+1]; i++) {
+        const UCHAR *b = packed->bf_index + 7*i;
+        res += fabs(packed->coefs[i] * x_powers[b[0]] * x_powers[b[1]] * x_powers[b[2]]
+                * x_powers[b[3]] * x_powers[b[4]] * x_powers[b[5]] * x_powers[b[6]]);
+    }
+    return res;
+}
+
+/* NRSur7dq2 vector fit, with the terms of all components interleaved */
+static void NRSur7dq2_vector_fit(REAL8 *res, const VectorFitData *data, const REAL8 *x)
+{
+    REAL8 x_powers[22];
+    PrecessingNRSur_fit_powers(x_powers, x, 0);
+    for (int i=0; i < data->vec_dim; i++)
+        res[i] = 0.0;
+    for (int i=0; i < data->n_coefs; i++) {
+        REAL8 prod = x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, 0)];
+        for (int j=1; j<7; j++)
+            prod *= x_powers[7 * gsl_matrix_long_get(data->basisFunctionOrders, i, j) + j];
+        res[gsl_vector_long_get(data->componentIndices, i)] += gsl_vector_get(data->coefs, i) * prod;
+    }
+}
+
+static int compare(const PackedFitData *packed, int k, const REAL8 *x_powers, REAL8 expected, REAL8 *maxerr)
+{
+    const REAL8 value = PrecessingNRSur_eval_packed_fit(packed, k, x_powers);
+    const REAL8 scale = abs_terms(packed, k, x_powers);
+    const REAL8 err = scale > 0. ? fabs(value - expected) / scale : fabs(value - expected);
+    if (err > *maxerr)
+        *maxerr = err;
+    return err <= TOLERANCE ? 0 : 1;
+}
+
+/* all outputs of the packed fits of a dynamics node */
+static int check_node(PrecessingNRSurData *sur, DynamicsNodeFitData *node, REAL8 *x, REAL8 *maxerr)
+{
+    const UINT4 version = sur->PrecessingNRSurVersion;
+    VectorFitData *vfits[3] = {node->omega_copr_data, node->chiA_dot_data, node->chiB_dot_data};
+    REAL8 x_powers[22], res[3];
+    int failures, k = 1;
+
+    PrecessingNRSur_fit_powers(x_powers, x, version);
+    failures = compare(node->packed, 0, x_powers, PrecessingNRSur_eval_fit(node->omega_data, x, sur), maxerr);
+    for (int v=0; v<3; v++) {
+        if (version == 0)
+            NRSur7dq2_vector_fit(res, vfits[v], x);
+        else
+            for (int i=0; i < vfits[v]->vec_dim; i++)
+                res[i] = NRSur7dq4_eval_fit(vfits[v]->fit_data[i], x);
+        for (int i=0; i < vfits[v]->vec_dim; i++)
+            failures += compare(node->packed, k++, x_powers, res[i], maxerr);
+    }
+    return failures + (k == node->packed->n_out ? 0 : 1);
+}
+
+/* all empirical nodes of a waveform data piece */
+static int check_piece(PrecessingNRSurData *sur, WaveformDataPiece *piece, REAL8 *x, REAL8 *maxerr)
+{
+    REAL8 x_powers[22];
+    int failures = piece->packed->n_out == piece->n_nodes ? 0 : 1;
+
+    PrecessingNRSur_fit_powers(x_powers, x, sur->PrecessingNRSurVersion);
+    for (int i=0; i < piece->n_nodes; i++)
+        failures += compare(piece->packed, i, x_powers, PrecessingNRSur_eval_fit(piece->fit_data[i], x, sur), maxerr);
+    return failures;
+}
+
+static int check_surrogate(Approximant approximant, const char *datafile, int *skipped)
+{
+    char *path = XLAL_FILE_RESOLVE_PATH(datafile);
+    if (!path) {
+        printf("%s: %s not found, skipped\n", XLALSimInspiralGetStringFromApproximant(approximant), datafile);
+        (*skipped)++;
+        return 0;
+    }
+    XLALFree(path);
+
+    PrecessingNRSurData *sur = PrecessingNRSur_LoadData(approximant);
+    XLAL_CHECK(sur && sur->setup, XLAL_EFUNC, "Unable to load %s", datafile);
+
+    int failures = 0;
+    REAL8 maxerr = 0.0;
+    for (UINT4 p=0; p < XLAL_NUM_ELEM(points); p++) {
+        REAL8 x[7];
+        memcpy(x, points[p], sizeof(x));
+        for (size_t i=0; i < sur->t_ds->size; i++)
+            failures += check_node(sur, sur->ds_node_data[i], x, &maxerr);
+        for (int i=0; i<3; i++)
+            failures += check_node(sur, sur->ds_half_node_data[i], x, &maxerr);
+        for (int ell_idx=0; ell_idx < NRSUR_LMAX-1; ell_idx++) {
+            WaveformFixedEllModeData *ell_data = sur->coorbital_mode_data[ell_idx];
+            failures += check_piece(sur, ell_data->m0_real_data, x, &maxerr);
+            failures += check_piece(sur, ell_data->m0_imag_data, x, &maxerr);
+            for (int m=0; m < ell_data->ell; m++) {
+                failures += check_piece(sur, ell_data->X_real_plus_data[m], x, &maxerr);
+                failures += check_piece(sur, ell_data->X_real_minus_data[m], x, &maxerr);
+                failures += check_piece(sur, ell_data->X_imag_plus_data[m], x, &maxerr);
+                failures += check_piece(sur, ell_data->X_imag_minus_data[m], x, &maxerr);
+            }
+        }
+    }
+    printf("%s: largest relative difference of packed and unpacked fits %.3g, %d failures\n",
+            XLALSimInspiralGetStringFromApproximant(approximant), maxerr, failures);
+    return failures;
+}
+
+int main(void)
+{
+    int skipped = 0;
+    int failures = check_surrogate(NRSur7dq2, NRSUR7DQ2_DATAFILE, &skipped) != 0;
+    failures += check_surrogate(NRSur7dq4, NRSUR7DQ4_DATAFILE, &skipped) != 0;
+
+    if (skipped == 2)
+        return 77;
+    if (failures) {
+        fprintf(stderr, "FAIL: packed fits differ from the unpacked fits\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
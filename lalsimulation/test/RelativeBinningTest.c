@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that relative binning reproduces full-grid inner products
+ * and log-likelihoods of a TaylorF2 binary neutron star signal.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Sequence.h>
+#include <lal/FrequencySeries.h>
+#include <lal/Units.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralWaveformCache.h>
+#include <lal/LALSimInspiralRelativeBinning.h>
+#include <lal/LALSimNoise.h>
+
+#define F_LOW 30.
+#define F_HIGH 1024.
+#define DELTA_F (1. / 128.)
+#define NUM_BINS 256
+#define FPLUS 0.6
+#define FCROSS 0.3
+#define TOLERANCE 1e-3
+
+/* full-grid <a|b> over [F_LOW, F_HIGH] */
+static COMPLEX16 inner_product(const COMPLEX16 *a, const COMPLEX16 *b, const REAL8FrequencySeries *psd)
+{
+    COMPLEX16 s = 0.;
+    for (UINT4 k = 0; k < psd->data->length; k++)
+        if (psd->data->data[k] > 0.)
+            s += conj(a[k]) * b[k] / psd->data->data[k];
+    return 4. * DELTA_F * s;
+}
+
+static int check(const char *name, REAL8 rb, REAL8 full, REAL8 tol)
+{
+    REAL8 err = fabs(rb - full) / fabs(full);
+    printf("%-10s full = %-14.8g binned = %-14.8g relative error = %.3g\n", name, full, rb, err);
+    return err < tol ? 0 : 1;
+}
+
+int main(void)
+{
+    const Approximant approx = TaylorF2;
+    const REAL8 f_ref = 0.;
+    /* fiducial parameters */
+    const REAL8 m1 = 1.40 * LAL_MSUN_SI, m2 = 1.30 * LAL_MSUN_SI, s1z = 0.02, s2z = 0.01;
+    const REAL8 dist = 100.e6 * LAL_PC_SI, incl = 0.4, phiRef = 0.3;
+    /* nearby trial parameters */
+    const REAL8 tm1 = 1.4003 * LAL_MSUN_SI, tm2 = 1.2998 * LAL_MSUN_SI, ts1z = 0.025, ts2z = 0.01;
+    const REAL8 tdist = 110.e6 * LAL_PC_SI, tincl = 0.45, tphiRef = 0.5;
+    COMPLEX16FrequencySeries *h0p = NULL, *h0c = NULL, *hp = NULL, *hc = NULL;
+    COMPLEX16Sequence *r0p = NULL, *r1p = NULL, *r0c = NULL, *r1c = NULL;
+    int failures = 0;
+
+    LALDict *params = XLALCreateDict();
+    XLAL_CHECK_MAIN(params, XLAL_EFUNC);
+
+    /* fiducial and trial waveforms on the full grid */
+    XLAL_CHECK_MAIN(XLALSimInspiralChooseFDWaveform(&h0p, &h0c, m1, m2, 0., 0., s1z, 0., 0., s2z, dist, incl, phiRef, 0., 0., 0., DELTA_F, F_LOW, F_HIGH, f_ref, params, approx) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALSimInspiralChooseFDWaveform(&hp, &hc, tm1, tm2, 0., 0., ts1z, 0., 0., ts2z, tdist, tincl, tphiRef, 0., 0., 0., DELTA_F, F_LOW, F_HIGH, f_ref, params, approx) == XLAL_SUCCESS, XLAL_EFUNC);
+    const UINT4 n = h0p->data->length < hp->data->length ? h0p->data->length : hp->data->length;
+
+    /* PSD restricted to the analysis band */
+    REAL8FrequencySeries *psd = XLALCreateREAL8FrequencySeries("PSD", &h0p->epoch, 0., DELTA_F, &lalSecondUnit, n);
+    XLAL_CHECK_MAIN(psd, XLAL_EFUNC);
+    for (UINT4 k = 0; k < n; k++) {
+        REAL8 f = k * DELTA_F;
+        psd->data->data[k] = (f >= F_LOW && f <= F_HIGH) ? XLALSimNoisePSDaLIGOZeroDetHighPower(f) : 0.;
+    }
+
+    /* noise-free data and the detector responses */
+    COMPLEX16FrequencySeries *data = XLALCreateCOMPLEX16FrequencySeries("data", &h0p->epoch, 0., DELTA_F, &lalDimensionlessUnit, n);
+    COMPLEX16FrequencySeries *h0det = XLALCreateCOMPLEX16FrequencySeries("h0", &h0p->epoch, 0., DELTA_F, &lalDimensionlessUnit, n);
+    COMPLEX16 *hdet = XLALMalloc(n * sizeof(*hdet));
+    XLAL_CHECK_MAIN(data && h0det && hdet, XLAL_ENOMEM);
+    for (UINT4 k = 0; k < n; k++) {
+        h0det->data->data[k] = FPLUS * h0p->data->data[k] + FCROSS * h0c->data->data[k];
+        data->data->data[k] = h0det->data->data[k];
+        hdet[k] = FPLUS * hp->data->data[k] + FCROSS * hc->data->data[k];
+    }
+
+    /* bins equally spaced in f^(-5/3), i.e. roughly in leading-order phase */
+    REAL8Sequence *edges = XLALCreateREAL8Sequence(NUM_BINS + 1);
+    XLAL_CHECK_MAIN(edges, XLAL_ENOMEM);
+    for (UINT4 b = 0; b <= NUM_BINS; b++) {
+        REAL8 x = pow(F_LOW, -5. / 3.) + (pow(F_HIGH, -5. / 3.) - pow(F_LOW, -5. / 3.)) * b / NUM_BINS;
+        edges->data[b] = pow(x, -3. / 5.);
+    }
+    edges->data[0] = F_LOW;
+    edges->data[NUM_BINS] = F_HIGH;
+
+    LALSimInspiralRelativeBinningFiducial *fiducial = XLALSimInspiralRelativeBinningFiducialCreate(edges, phiRef, m1, m2, 0., 0., s1z, 0., 0., s2z, f_ref, dist, incl, params, approx);
+    XLAL_CHECK_MAIN(fiducial, XLAL_EFUNC);
+
+    /* plus polarization alone */
+    LALSimInspiralRelativeBinningSummary *summaryPlus = XLALSimInspiralRelativeBinningSummaryCreate(edges, data, h0p, psd);
+    XLAL_CHECK_MAIN(summaryPlus, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALSimInspiralRelativeBinningCoefficients(&r0p, &r1p, &r0c, &r1c, fiducial, tphiRef, tm1, tm2, 0., 0., ts1z, 0., 0., ts2z, f_ref, tdist, tincl, params, approx) == XLAL_SUCCESS, XLAL_EFUNC);
+    COMPLEX16 dh;
+    REAL8 hh;
+    XLAL_CHECK_MAIN(XLALSimInspiralRelativeBinningInnerProducts(&dh, &hh, summaryPlus, r0p, r1p) == XLAL_SUCCESS, XLAL_EFUNC);
+    printf("Plus polarization, %d bins:\n", NUM_BINS);
+    failures += check("<d|h+>", creal(dh), creal(inner_product(data->data->data, hp->data->data, psd)), TOLERANCE);
+    failures += check("<h+|h+>", hh, creal(inner_product(hp->data->data, hp->data->data, psd)), TOLERANCE);
+
+    /* detector response, binned with the ratio kernel on edge values */
+    COMPLEX16FrequencySeries *hpEdges = NULL, *hcEdges = NULL;
+    XLAL_CHECK_MAIN(XLALSimInspiralChooseFDWaveformSequence(&hpEdges, &hcEdges, tphiRef, tm1, tm2, 0., 0., ts1z, 0., 0., ts2z, f_ref, tdist, tincl, params, approx, edges) == XLAL_SUCCESS, XLAL_EFUNC);
+    LALSimInspiralRelativeBinningSummary *summaryDet = XLALSimInspiralRelativeBinningSummaryCreate(edges, data, h0det, psd);
+    COMPLEX16Sequence *h0edges = XLALCreateCOMPLEX16Sequence(NUM_BINS + 1);
+    COMPLEX16Sequence *hedges = XLALCreateCOMPLEX16Sequence(NUM_BINS + 1);
+    COMPLEX16Sequence *r0 = XLALCreateCOMPLEX16Sequence(NUM_BINS);
+    COMPLEX16Sequence *r1 = XLALCreateCOMPLEX16Sequence(NUM_BINS);
+    XLAL_CHECK_MAIN(summaryDet && h0edges && hedges && r0 && r1, XLAL_EFUNC);
+    for (UINT4 b = 0; b <= NUM_BINS; b++) {
+        h0edges->data[b] = FPLUS * fiducial->h0plus->data[b] + FCROSS * fiducial->h0cross->data[b];
+        hedges->data[b] = FPLUS * hpEdges->data->data[b] + FCROSS * hcEdges->data->data[b];
+    }
+    XLAL_CHECK_MAIN(XLALSimInspiralRelativeBinningRatio(r0, r1, hedges, h0edges, edges) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(XLALSimInspiralRelativeBinningInnerProducts(&dh, &hh, summaryDet, r0, r1) == XLAL_SUCCESS, XLAL_EFUNC);
+    REAL8 dhFull = creal(inner_product(data->data->data, hdet, psd));
+    REAL8 hhFull = creal(inner_product(hdet, hdet, psd));
+    printf("Detector response F+ = %g, Fx = %g:\n", FPLUS, FCROSS);
+    failures += check("<d|h>", creal(dh), dhFull, TOLERANCE);
+    failures += check("<h|h>", hh, hhFull, TOLERANCE);
+    /* the log-likelihood is compared in absolute terms, as it can be close to zero */
+    REAL8 logL = creal(dh) - 0.5 * hh, logLFull = dhFull - 0.5 * hhFull;
+    printf("%-10s full = %-14.8g binned = %-14.8g absolute error = %.3g\n", "log L", logLFull, logL, fabs(logL - logLFull));
+    failures += fabs(logL - logLFull) < TOLERANCE * hhFull ? 0 : 1;
+
+    XLALDestroyCOMPLEX16FrequencySeries(hpEdges);
+    XLALDestroyCOMPLEX16FrequencySeries(hcEdges);
+    XLALDestroyCOMPLEX16Sequence(h0edges);
+    XLALDestroyCOMPLEX16Sequence(hedges);
+    XLALDestroyCOMPLEX16Sequence(r0);
+    XLALDestroyCOMPLEX16Sequence(r1);
+    XLALDestroyCOMPLEX16Sequence(r0p);
+    XLALDestroyCOMPLEX16Sequence(r1p);
+    XLALDestroyCOMPLEX16Sequence(r0c);
+    XLALDestroyCOMPLEX16Sequence(r1c);
+    XLALSimInspiralRelativeBinningSummaryDestroy(summaryPlus);
+    XLALSimInspiralRelativeBinningSummaryDestroy(summaryDet);
+    XLALSimInspiralRelativeBinningFiducialDestroy(fiducial);
+    XLALDestroyREAL8Sequence(edges);
+    XLALFree(hdet);
+    XLALDestroyCOMPLEX16FrequencySeries(data);
+    XLALDestroyCOMPLEX16FrequencySeries(h0det);
+    XLALDestroyREAL8FrequencySeries(psd);
+    XLALDestroyCOMPLEX16FrequencySeries(h0p);
+    XLALDestroyCOMPLEX16FrequencySeries(h0c);
+    XLALDestroyCOMPLEX16FrequencySeries(hp);
+    XLALDestroyCOMPLEX16FrequencySeries(hc);
+    XLALDestroyDict(params);
+    LALCheckMemoryLeaks();
+
+    if (failures)
+        fprintf(stderr, "FAIL: %d relative binning checks exceeded tolerance %g\n", failures, TOLERANCE);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
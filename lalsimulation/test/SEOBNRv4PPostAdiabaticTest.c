@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that SEOBNRv4P with the post-adiabatic early inspiral agrees
+ * with the full integration of the dynamics.
+ *
+ * For a 12 + 8 Msun binary with in-plane spins the initial separation at
+ * 20 Hz is about 30 M, beyond the 20 M at which the full dynamics take over,
+ * so the post-adiabatic inspiral is used.  The two waveforms, aligned at
+ * the peak amplitude and maximised over a constant phase, must have a
+ * mismatch below MISMATCH_TOLERANCE and durations within DURATION_TOLERANCE.
+ * At 40 Hz the binary starts inside 20 M and the option must have no effect.
+ *
+ * MISMATCH_TOLERANCE is the usual 1e-3 unfaithfulness budget of a waveform
+ * model against its reference: the post-adiabatic inspiral of SEOBNRv4HM_PA
+ * stays an order of magnitude or more below it against the ODE evolution
+ * (Mihaylov et al 2021, arXiv:2105.06983), so anything above it is a
+ * defect of the implementation rather than of the approximation.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/TimeSeries.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralWaveformParams.h>
+
+#define M1 12.
+#define M2 8.
+#define DELTA_T (1. / 4096.)
+#define DISTANCE (1e6 * LAL_PC_SI)
+#define INCLINATION 0.8
+#define MISMATCH_TOLERANCE 1e-3
+#define DURATION_TOLERANCE 0.01
+
+static int generate(REAL8TimeSeries **hplus, REAL8TimeSeries **hcross, REAL8 f_min, INT4 postAdiabatic)
+{
+    LALDict *params = XLALCreateDict();
+    XLAL_CHECK(params, XLAL_EFUNC);
+    XLALSimInspiralWaveformParamsInsertEOBPrecPostAdiabatic(params, postAdiabatic);
+    int ret = XLALSimInspiralChooseTDWaveform(hplus, hcross, M1 * LAL_MSUN_SI, M2 * LAL_MSUN_SI,
+            0.5, 0., 0.3, 0., -0.4, 0.2, DISTANCE, INCLINATION, 0., 0., 0., 0., DELTA_T, f_min, f_min,
+            params, SEOBNRv4P);
+    XLALDestroyDict(params);
+    XLAL_CHECK(ret == XLAL_SUCCESS, XLAL_EFUNC);
+    return XLAL_SUCCESS;
+}
+
+static UINT4 peak_index(const REAL8TimeSeries *hplus, const REAL8TimeSeries *hcross)
+{
+    UINT4 ipeak = 0;
+    REAL8 peak = 0.;
+    for (UINT4 i = 0; i < hplus->data->length; i++) {
+        REAL8 a = hplus->data->data[i] * hplus->data->data[i] + hcross->data->data[i] * hcross->data->data[i];
+        if (a > peak) {
+            peak = a;
+            ipeak = i;
+        }
+    }
+    return ipeak;
+}
+
+/* overlap of h+ - i hx over the common part, aligned at the peak */
+static REAL8 match(const REAL8TimeSeries *hp1, const REAL8TimeSeries *hc1, const REAL8TimeSeries *hp2, const REAL8TimeSeries *hc2)
+{
+    UINT4 ipeak1 = peak_index(hp1, hc1);
+    UINT4 ipeak2 = peak_index(hp2, hc2);
+    UINT4 before = ipeak1 < ipeak2 ? ipeak1 : ipeak2;
+    UINT4 after1 = hp1->data->length - ipeak1;
+    UINT4 after2 = hp2->data->length - ipeak2;
+    UINT4 after = after1 < after2 ? after1 : after2;
+    COMPLEX16 h12 = 0.;
+    REAL8 h11 = 0., h22 = 0.;
+    for (UINT4 i = 0; i < before + after; i++) {
+        UINT4 i1 = ipeak1 - before + i;
+        UINT4 i2 = ipeak2 - before + i;
+        COMPLEX16 h1 = hp1->data->data[i1] - I * hc1->data->data[i1];
+        COMPLEX16 h2 = hp2->data->data[i2] - I * hc2->data->data[i2];
+        h12 += h1 * conj(h2);
+        h11 += creal(h1 * conj(h1));
+        h22 += creal(h2 * conj(h2));
+    }
+    return cabs(h12) / sqrt(h11 * h22);
+}
+
+int main(void)
+{
+    REAL8TimeSeries *hplusODE = NULL, *hcrossODE = NULL;
+    REAL8TimeSeries *hplusPA = NULL, *hcrossPA = NULL;
+
+    /* post-adiabatic inspiral used */
+    XLAL_CHECK_MAIN(generate(&hplusODE, &hcrossODE, 20., 0) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(generate(&hplusPA, &hcrossPA, 20., 1) == XLAL_SUCCESS, XLAL_EFUNC);
+    const REAL8 mismatch = 1. - match(hplusODE, hcrossODE, hplusPA, hcrossPA);
+    const REAL8 ratio = (REAL8) hplusPA->data->length / hplusODE->data->length;
+    printf("f_min = 20 Hz: %u samples with full dynamics, %u with post-adiabatic inspiral, mismatch %.3g\n",
+            hplusODE->data->length, hplusPA->data->length, mismatch);
+    XLAL_CHECK_MAIN(hplusPA->data->length != hplusODE->data->length
+            || memcmp(hplusPA->data->data, hplusODE->data->data, hplusPA->data->length * sizeof(REAL8)) != 0,
+            XLAL_EFAILED, "Post-adiabatic inspiral was not used");
+    XLAL_CHECK_MAIN(mismatch < MISMATCH_TOLERANCE, XLAL_ETOL, "Mismatch %g exceeds %g", mismatch, MISMATCH_TOLERANCE);
+    XLAL_CHECK_MAIN(fabs(ratio - 1.) < DURATION_TOLERANCE, XLAL_ETOL, "Durations differ by %g", ratio - 1.);
+    XLALDestroyREAL8TimeSeries(hplusODE);
+    XLALDestroyREAL8TimeSeries(hcrossODE);
+    XLALDestroyREAL8TimeSeries(hplusPA);
+    XLALDestroyREAL8TimeSeries(hcrossPA);
+    hplusODE = hcrossODE = hplusPA = hcrossPA = NULL;
+
+    /* too close for the post-adiabatic solution: the full dynamics are used */
+    XLAL_CHECK_MAIN(generate(&hplusODE, &hcrossODE, 40., 0) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(generate(&hplusPA, &hcrossPA, 40., 1) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK_MAIN(hplusPA->data->length == hplusODE->data->length, XLAL_EFAILED);
+    XLAL_CHECK_MAIN(memcmp(hplusPA->data->data, hplusODE->data->data, hplusPA->data->length * sizeof(REAL8)) == 0, XLAL_EFAILED);
+    XLAL_CHECK_MAIN(memcmp(hcrossPA->data->data, hcrossODE->data->data, hcrossPA->data->length * sizeof(REAL8)) == 0, XLAL_EFAILED);
+    XLALDestroyREAL8TimeSeries(hplusODE);
+    XLALDestroyREAL8TimeSeries(hcrossODE);
+    XLALDestroyREAL8TimeSeries(hplusPA);
+    XLALDestroyREAL8TimeSeries(hcrossPA);
+
+    LALCheckMemoryLeaks();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that the blocked and streamed stochastic background
+ * generators reproduce XLALSimSGWB() for the same random number generator.
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <gsl/gsl_rng.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDetectors.h>
+#include <lal/Date.h>
+#include <lal/Units.h>
+#include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALSimSGWB.h>
+
+#define NUM_DETECTORS 4
+#define SRATE 1024.0
+#define SEGLEN 8192
+#define STRIDE (SEGLEN / 2)
+#define NUM_STRIDES 5
+#define SEED 1234
+#define TOLERANCE 1e-10
+
+typedef struct {
+    REAL8TimeSeries **out;
+    size_t offset;
+} collect_data;
+
+/* appends each chunk of the stream to the output series */
+static int collect(REAL8TimeSeries **h, size_t numDetectors, size_t length, void *data)
+{
+    collect_data *d = data;
+    for (size_t i = 0; i < numDetectors; ++i) {
+        XLAL_CHECK(d->offset + length <= d->out[i]->data->length, XLAL_EBADLEN);
+        memcpy(d->out[i]->data->data + d->offset, h[i]->data->data, length * sizeof(*h[i]->data->data));
+    }
+    d->offset += length;
+    return 0;
+}
+
+/* largest difference between two sets of series, relative to the largest value */
+static double maxdiff(REAL8TimeSeries **a, REAL8TimeSeries **b, size_t length)
+{
+    double amax = 0.0, dmax = 0.0;
+    for (size_t i = 0; i < NUM_DETECTORS; ++i)
+        for (size_t j = 0; j < length; ++j) {
+            amax = fmax(amax, fabs(a[i]->data->data[j]));
+            dmax = fmax(dmax, fabs(a[i]->data->data[j] - b[i]->data->data[j]));
+        }
+    return amax > 0.0 ? dmax / amax : INFINITY;
+}
+
+int main(void)
+{
+    const double H0 = 0.72 * LAL_H0FAC_SI;
+    LIGOTimeGPS epoch = {1000000000, 0};
+    /* H1 and H2 are co-located and exercise the near-unity correlation */
+    LALDetector detectors[NUM_DETECTORS] = {
+        lalCachedDetectors[LAL_LHO_4K_DETECTOR],
+        lalCachedDetectors[LAL_LHO_2K_DETECTOR],
+        lalCachedDetectors[LAL_LLO_4K_DETECTOR],
+        lalCachedDetectors[LAL_VIRGO_DETECTOR]
+    };
+    REAL8TimeSeries *serial[NUM_DETECTORS], *blocked[NUM_DETECTORS];
+    REAL8TimeSeries *serialrec[NUM_DETECTORS], *streamrec[NUM_DETECTORS];
+    const size_t reclen = NUM_STRIDES * STRIDE - 321;
+    size_t i, n;
+
+    REAL8FrequencySeries *OmegaGW = XLALSimSGWBOmegaGWFlatSpectrum(1e-6, 10.0, SRATE / SEGLEN, SEGLEN / 2 + 1);
+    LALSimSGWBMixing *mix = XLALSimSGWBCreateMixing(detectors, NUM_DETECTORS, OmegaGW->deltaF, OmegaGW->data->length);
+    gsl_rng *rng1 = gsl_rng_alloc(gsl_rng_mt19937);
+    gsl_rng *rng2 = gsl_rng_alloc(gsl_rng_mt19937);
+    XLAL_CHECK_EXIT(OmegaGW && mix && rng1 && rng2);
+    for (i = 0; i < NUM_DETECTORS; ++i) {
+        serial[i] = XLALCreateREAL8TimeSeries("serial", &epoch, 0.0, 1.0 / SRATE, &lalStrainUnit, SEGLEN);
+        blocked[i] = XLALCreateREAL8TimeSeries("blocked", &epoch, 0.0, 1.0 / SRATE, &lalStrainUnit, SEGLEN);
+        serialrec[i] = XLALCreateREAL8TimeSeries("serial", &epoch, 0.0, 1.0 / SRATE, &lalStrainUnit, reclen);
+        streamrec[i] = XLALCreateREAL8TimeSeries("stream", &epoch, 0.0, 1.0 / SRATE, &lalStrainUnit, reclen);
+        XLAL_CHECK_EXIT(serial[i] && blocked[i] && serialrec[i] && streamrec[i]);
+    }
+
+    /* the DC and Nyquist bins are not mixed */
+    for (i = 0; i < NUM_DETECTORS * (NUM_DETECTORS + 1) / 2; ++i)
+        XLAL_CHECK_EXIT(mix->L[i * mix->length] == 0.0 && mix->L[i * mix->length + mix->length - 1] == 0.0);
+
+    /* one segment at a time, initial and strided */
+    gsl_rng_set(rng1, SEED);
+    gsl_rng_set(rng2, SEED);
+    XLAL_CHECK_EXIT(XLALSimSGWB(serial, detectors, NUM_DETECTORS, 0, OmegaGW, H0, rng1) == 0);
+    XLAL_CHECK_EXIT(XLALSimSGWBBlocked(blocked, mix, 0, OmegaGW, H0, rng2) == 0);
+    XLAL_CHECK_EXIT(maxdiff(serial, blocked, SEGLEN) < TOLERANCE);
+    for (n = 0; n < 3; ++n) {
+        XLAL_CHECK_EXIT(XLALSimSGWB(serial, detectors, NUM_DETECTORS, STRIDE, OmegaGW, H0, rng1) == 0);
+        XLAL_CHECK_EXIT(XLALSimSGWBBlocked(blocked, mix, STRIDE, OmegaGW, H0, rng2) == 0);
+        XLAL_CHECK_EXIT(maxdiff(serial, blocked, SEGLEN) < TOLERANCE);
+        XLAL_CHECK_EXIT(XLALGPSCmp(&serial[0]->epoch, &blocked[0]->epoch) == 0);
+    }
+
+    /* a continuous record: the valid part of each serial segment against
+     * the stream, which ends with a short chunk */
+    gsl_rng_set(rng1, SEED);
+    gsl_rng_set(rng2, SEED);
+    for (i = 0; i < NUM_DETECTORS; ++i)
+        serial[i]->epoch = blocked[i]->epoch = epoch;
+    XLAL_CHECK_EXIT(XLALSimSGWB(serial, detectors, NUM_DETECTORS, 0, OmegaGW, H0, rng1) == 0);
+    for (n = 0; n < reclen; n += STRIDE) {
+        size_t len = reclen - n < STRIDE ? reclen - n : STRIDE;
+        for (i = 0; i < NUM_DETECTORS; ++i)
+            memcpy(serialrec[i]->data->data + n, serial[i]->data->data, len * sizeof(*serial[i]->data->data));
+        XLAL_CHECK_EXIT(XLALSimSGWB(serial, detectors, NUM_DETECTORS, STRIDE, OmegaGW, H0, rng1) == 0);
+    }
+    collect_data d = { streamrec, 0 };
+    XLAL_CHECK_EXIT(XLALSimSGWBStream(blocked, mix, reclen, OmegaGW, H0, rng2, collect, &d) == 0);
+    XLAL_CHECK_EXIT(d.offset == reclen);
+    XLAL_CHECK_EXIT(maxdiff(serialrec, streamrec, reclen) < TOLERANCE);
+
+    for (i = 0; i < NUM_DETECTORS; ++i) {
+        XLALDestroyREAL8TimeSeries(serial[i]);
+        XLALDestroyREAL8TimeSeries(blocked[i]);
+        XLALDestroyREAL8TimeSeries(serialrec[i]);
+        XLALDestroyREAL8TimeSeries(streamrec[i]);
+    }
+    gsl_rng_free(rng1);
+    gsl_rng_free(rng2);
+    XLALSimSGWBDestroyMixing(mix);
+    XLALDestroyREAL8FrequencySeries(OmegaGW);
+    LALCheckMemoryLeaks();
+
+    return 0;
+}
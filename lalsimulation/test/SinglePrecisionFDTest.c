@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that XLALSimInspiralGenerateFDWaveformCOMPLEX8() agrees with
+ * XLALSimInspiralGenerateFDWaveform() to single precision.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <complex.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/Date.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALSimInspiral.h>
+#include <lal/LALSimInspiralWaveformParams.h>
+
+#define DELTA_F (1. / 32.)
+#define F_LOW 20.
+#define F_HIGH 1024.
+/* single-precision storage of a double-precision phase and amplitude */
+#define TOLERANCE 1e-6
+
+/* relative L2 difference between a single- and a double-precision series */
+static REAL8 reldiff(const COMPLEX8FrequencySeries *h8, const COMPLEX16FrequencySeries *h16)
+{
+    REAL8 num = 0., den = 0.;
+    for (UINT4 k = 0; k < h16->data->length; k++) {
+        const REAL8 err = cabs(h8->data->data[k] - h16->data->data[k]);
+        const REAL8 ref = cabs(h16->data->data[k]);
+        num += err * err;
+        den += ref * ref;
+    }
+    return den > 0. ? sqrt(num / den) : INFINITY;
+}
+
+static int compare_approximant(Approximant approximant, REAL8 m1, REAL8 m2, REAL8 s1z, REAL8 s2z, REAL8 mband)
+{
+    COMPLEX16FrequencySeries *hp16 = NULL, *hc16 = NULL;
+    COMPLEX8FrequencySeries *hp8 = NULL, *hc8 = NULL;
+
+    LALSimInspiralGenerator *generator = XLALSimInspiralChooseGenerator(approximant, NULL);
+    LALDict *params = XLALCreateDict();
+    XLAL_CHECK(generator && params, XLAL_EFUNC);
+    XLALSimInspiralWaveformParamsInsertMass1(params, m1 * LAL_MSUN_SI);
+    XLALSimInspiralWaveformParamsInsertMass2(params, m2 * LAL_MSUN_SI);
+    XLALSimInspiralWaveformParamsInsertSpin1x(params, 0.);
+    XLALSimInspiralWaveformParamsInsertSpin1y(params, 0.);
+    XLALSimInspiralWaveformParamsInsertSpin1z(params, s1z);
+    XLALSimInspiralWaveformParamsInsertSpin2x(params, 0.);
+    XLALSimInspiralWaveformParamsInsertSpin2y(params, 0.);
+    XLALSimInspiralWaveformParamsInsertSpin2z(params, s2z);
+    XLALSimInspiralWaveformParamsInsertDeltaF(params, DELTA_F);
+    XLALSimInspiralWaveformParamsInsertF22Ref(params, F_LOW);
+    XLALSimInspiralWaveformParamsInsertF22Start(params, F_LOW);
+    XLALSimInspiralWaveformParamsInsertFMax(params, F_HIGH);
+    XLALSimInspiralWaveformParamsInsertRefPhase(params, 0.7);
+    XLALSimInspiralWaveformParamsInsertDistance(params, 400.e6 * LAL_PC_SI);
+    XLALSimInspiralWaveformParamsInsertInclination(params, 0.9);
+    XLALSimInspiralWaveformParamsInsertLongAscNodes(params, 0.3);
+    XLALSimInspiralWaveformParamsInsertEccentricity(params, 0.);
+    XLALSimInspiralWaveformParamsInsertMeanPerAno(params, 0.);
+    if (approximant == IMRPhenomD)
+        XLALSimInspiralWaveformParamsInsertMultibandThreshold(params, mband);
+    else if (approximant == IMRPhenomXHM)
+        XLALSimInspiralWaveformParamsInsertPhenomXHMThresholdMband(params, mband);
+
+    XLAL_CHECK(XLALSimInspiralGenerateFDWaveform(&hp16, &hc16, params, generator) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(XLALSimInspiralGenerateFDWaveformCOMPLEX8(&hp8, &hc8, params, generator) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLAL_CHECK(hp8->data->length == hp16->data->length && hc8->data->length == hc16->data->length, XLAL_EBADLEN);
+    XLAL_CHECK(hp8->deltaF == hp16->deltaF && hp8->f0 == hp16->f0, XLAL_EDATA);
+    XLAL_CHECK(XLALGPSCmp(&hp8->epoch, &hp16->epoch) == 0, XLAL_EDATA);
+
+    const REAL8 dp = reldiff(hp8, hp16);
+    const REAL8 dc = reldiff(hc8, hc16);
+    printf("%s, multiband threshold %g: relative difference hplus = %.3g, hcross = %.3g\n", XLALSimInspiralGetStringFromApproximant(approximant), mband, dp, dc);
+
+    XLALDestroyCOMPLEX16FrequencySeries(hp16);
+    XLALDestroyCOMPLEX16FrequencySeries(hc16);
+    XLALDestroyCOMPLEX8FrequencySeries(hp8);
+    XLALDestroyCOMPLEX8FrequencySeries(hc8);
+    XLALDestroyDict(params);
+    XLALDestroySimInspiralGenerator(generator);
+
+    return dp < TOLERANCE && dc < TOLERANCE ? 0 : 1;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += compare_approximant(TaylorF2, 1.4, 1.3, 0.05, -0.02, 0.) != 0;
+    failures += compare_approximant(IMRPhenomD, 30., 25., 0.4, -0.2, 0.) != 0;
+    failures += compare_approximant(IMRPhenomD, 30., 25., 0.4, -0.2, 1e-3) != 0;
+    failures += compare_approximant(IMRPhenomXAS, 30., 25., 0.4, -0.2, 0.) != 0;
+    failures += compare_approximant(IMRPhenomXHM, 40., 12., 0.6, 0.1, 0.) != 0;
+    failures += compare_approximant(IMRPhenomXHM, 40., 12., 0.6, 0.1, 1e-3) != 0;
+
+    LALCheckMemoryLeaks();
+
+    if (failures)
+        fprintf(stderr, "FAIL: %d single-precision waveforms differ by more than %g\n", failures, TOLERANCE);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -26,9 +26,13 @@
  */
 
 
+#include <math.h>
+#include <string.h>
 #include <lal/Sequence.h>
 #include <lal/LALSimInspiral.h>
+#include <lal/LALSimSphHarmMode.h>
 #include <lal/TimeSeries.h>
+#include <lal/FrequencySeries.h>
 #include <lal/Date.h>
 #include <lal/Units.h>
 
@@ -93,6 +97,102 @@ int main(void){
 		XLAL_CHECK_EXIT( tdata_hlm == tdata );
 
 		XLALDestroySphHarmTimeSeries( ts );
+		ts = NULL;
+
+		// Check the contiguous mode array against the linked list
+		for( l=2; l<4; l++ ){
+			for( m=-l; m<=l; m++ ){
+				h_lm = XLALCreateCOMPLEX16TimeSeries( "test hlm", &(epoch), 0,
+						1.0/16384, &(lalStrainUnit), 3000 );
+				for( i=0; i<(int)h_lm->data->length; i++ )
+					h_lm->data->data[i] = crect( cos(0.01*m*i + l), sin(0.02*l*i - m) );
+				ts = XLALSphHarmTimeSeriesAddMode( ts, h_lm, l, m );
+				XLALDestroyCOMPLEX16TimeSeries(h_lm);
+			}
+		}
+		SphHarmModeArray *arr = XLALSphHarmModeArrayFromSphHarmTimeSeries( ts );
+		XLAL_CHECK_EXIT( arr && arr->nmodes == 12 && arr->lmax == 3 );
+		XLAL_CHECK_EXIT( XLALSphHarmModeArrayGetMode( arr, 4, 0 ) == NULL );
+		XLAL_CHECK_EXIT( memcmp( XLALSphHarmModeArrayGetMode( arr, 3, -2 ),
+				XLALSphHarmTimeSeriesGetMode( ts, 3, -2 )->data->data,
+				arr->length * sizeof(COMPLEX16) ) == 0 );
+
+		REAL8TimeSeries *hp = XLALCreateREAL8TimeSeries( "hp", &epoch, 0, 1.0/16384, &lalStrainUnit, arr->length );
+		REAL8TimeSeries *hc = XLALCreateREAL8TimeSeries( "hc", &epoch, 0, 1.0/16384, &lalStrainUnit, arr->length );
+		REAL8TimeSeries *hp_arr = XLALCreateREAL8TimeSeries( "hp", &epoch, 0, 1.0/16384, &lalStrainUnit, arr->length );
+		REAL8TimeSeries *hc_arr = XLALCreateREAL8TimeSeries( "hc", &epoch, 0, 1.0/16384, &lalStrainUnit, arr->length );
+		memset( hp->data->data, 0, hp->data->length * sizeof(REAL8) );
+		memset( hc->data->data, 0, hc->data->length * sizeof(REAL8) );
+		memset( hp_arr->data->data, 0, hp_arr->data->length * sizeof(REAL8) );
+		memset( hc_arr->data->data, 0, hc_arr->data->length * sizeof(REAL8) );
+		SphHarmTimeSeries *itr;
+		for( itr = ts; itr; itr = itr->next )
+			XLAL_CHECK_EXIT( XLALSimAddMode( hp, hc, itr->mode, 0.7, 0.3, itr->l, itr->m, 0 ) == 0 );
+		XLAL_CHECK_EXIT( XLALSphHarmModeArrayAddModesTD( hp_arr, hc_arr, arr, 0.7, 0.3 ) == XLAL_SUCCESS );
+		for( i=0; i<(int)arr->length; i++ ){
+			XLAL_CHECK_EXIT( fabs( hp->data->data[i] - hp_arr->data->data[i] ) < 1e-12 );
+			XLAL_CHECK_EXIT( fabs( hc->data->data[i] - hc_arr->data->data[i] ) < 1e-12 );
+		}
+		XLALDestroyREAL8TimeSeries( hp );
+		XLALDestroyREAL8TimeSeries( hc );
+		XLALDestroyREAL8TimeSeries( hp_arr );
+		XLALDestroyREAL8TimeSeries( hc_arr );
+
+		// Round trip back to a linked list
+		SphHarmTimeSeries *ts_arr = XLALSphHarmTimeSeriesFromSphHarmModeArray( arr );
+		XLAL_CHECK_EXIT( ts_arr && ts_arr->l == ts->l && ts_arr->m == ts->m );
+		XLAL_CHECK_EXIT( memcmp( XLALSphHarmTimeSeriesGetMode( ts_arr, 2, 1 )->data->data,
+				XLALSphHarmTimeSeriesGetMode( ts, 2, 1 )->data->data,
+				arr->length * sizeof(COMPLEX16) ) == 0 );
+		XLALDestroySphHarmTimeSeries( ts_arr );
+		XLALDestroySphHarmModeArray( arr );
+		XLALDestroySphHarmTimeSeries( ts );
+
+		// Same checks in the frequency domain
+		SphHarmFrequencySeries *fs = NULL;
+		for( l=2; l<5; l++ ){
+			for( m=-l; m<=l; m++ ){
+				COMPLEX16FrequencySeries *h_lm_f = XLALCreateCOMPLEX16FrequencySeries( "test hlm", &(epoch), 0,
+						1.0/8, &(lalStrainUnit), 3000 );
+				for( i=0; i<(int)h_lm_f->data->length; i++ )
+					h_lm_f->data->data[i] = crect( cos(0.03*m*i - l), sin(0.01*l*i + m) ) / (1 + 0.01*i);
+				fs = XLALSphHarmFrequencySeriesAddMode( fs, h_lm_f, l, m );
+				XLALDestroyCOMPLEX16FrequencySeries(h_lm_f);
+			}
+		}
+		arr = XLALSphHarmModeArrayFromSphHarmFrequencySeries( fs );
+		XLAL_CHECK_EXIT( arr && arr->nmodes == 21 && arr->lmax == 4 );
+		XLAL_CHECK_EXIT( arr->delta == 1.0/8 );
+
+		COMPLEX16FrequencySeries *hpf = XLALCreateCOMPLEX16FrequencySeries( "hp", &epoch, 0, 1.0/8, &lalStrainUnit, arr->length );
+		COMPLEX16FrequencySeries *hcf = XLALCreateCOMPLEX16FrequencySeries( "hc", &epoch, 0, 1.0/8, &lalStrainUnit, arr->length );
+		COMPLEX16FrequencySeries *hpf_arr = XLALCreateCOMPLEX16FrequencySeries( "hp", &epoch, 0, 1.0/8, &lalStrainUnit, arr->length );
+		COMPLEX16FrequencySeries *hcf_arr = XLALCreateCOMPLEX16FrequencySeries( "hc", &epoch, 0, 1.0/8, &lalStrainUnit, arr->length );
+		memset( hpf->data->data, 0, hpf->data->length * sizeof(COMPLEX16) );
+		memset( hcf->data->data, 0, hcf->data->length * sizeof(COMPLEX16) );
+		memset( hpf_arr->data->data, 0, hpf_arr->data->length * sizeof(COMPLEX16) );
+		memset( hcf_arr->data->data, 0, hcf_arr->data->length * sizeof(COMPLEX16) );
+		SphHarmFrequencySeries *fitr;
+		for( fitr = fs; fitr; fitr = fitr->next )
+			XLAL_CHECK_EXIT( XLALSimAddModeFD( hpf, hcf, fitr->mode, 0.7, 0.3, fitr->l, fitr->m, 0 ) == 0 );
+		XLAL_CHECK_EXIT( XLALSphHarmModeArrayAddModesFD( hpf_arr, hcf_arr, arr, 0.7, 0.3 ) == XLAL_SUCCESS );
+		for( i=0; i<(int)arr->length; i++ ){
+			XLAL_CHECK_EXIT( cabs( hpf->data->data[i] - hpf_arr->data->data[i] ) < 1e-12 );
+			XLAL_CHECK_EXIT( cabs( hcf->data->data[i] - hcf_arr->data->data[i] ) < 1e-12 );
+		}
+		XLALDestroyCOMPLEX16FrequencySeries( hpf );
+		XLALDestroyCOMPLEX16FrequencySeries( hcf );
+		XLALDestroyCOMPLEX16FrequencySeries( hpf_arr );
+		XLALDestroyCOMPLEX16FrequencySeries( hcf_arr );
+
+		SphHarmFrequencySeries *fs_arr = XLALSphHarmFrequencySeriesFromSphHarmModeArray( arr );
+		XLAL_CHECK_EXIT( fs_arr && fs_arr->l == fs->l && fs_arr->m == fs->m );
+		XLAL_CHECK_EXIT( memcmp( XLALSphHarmFrequencySeriesGetMode( fs_arr, 4, -3 )->data->data,
+				XLALSphHarmFrequencySeriesGetMode( fs, 4, -3 )->data->data,
+				arr->length * sizeof(COMPLEX16) ) == 0 );
+		XLALDestroySphHarmFrequencySeries( fs_arr );
+		XLALDestroySphHarmModeArray( arr );
+		XLALDestroySphHarmFrequencySeries( fs );
 
 		LALCheckMemoryLeaks();
 
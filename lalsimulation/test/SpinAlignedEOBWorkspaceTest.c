@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 The LALSuite developers
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+/**
+ * \file
+ *
+ * \brief Check that the spin-aligned EOB waveforms generated with a
+ * workspace are bit for bit those generated without one.
+ *
+ * One workspace is reused, in turn, for SEOBNRv4, SEOBNRv4HM and
+ * SEOBNRv4HM_PA waveforms of different lengths, longer and shorter than the
+ * previous one, so that its buffers are both grown and reused with stale
+ * contents.  The cubic spline of the workspace must also reject repeated
+ * abscissae instead of dividing by a zero pivot.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../lib/LALSimIMRSpinAlignedEOBOptimizedInterpolatorGeneral.c"
+
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LALDict.h>
+#include <lal/TimeSeries.h>
+#include <lal/LALSimIMR.h>
+
+#define DELTA_T (1. / 4096.)
+#define DISTANCE (1e6 * LAL_PC_SI)
+#define INCLINATION 0.7
+
+struct config {
+    UINT4 version;
+    REAL8 m1, m2, chi1, chi2, fMin;
+};
+
+/* SEOBNRv4, SEOBNRv4HM, SEOBNRv4HM_PA; the lengths go up and down */
+static const struct config configs[] = {
+    {4, 20., 15., 0.3, -0.2, 20.},
+    {4, 40., 10., -0.4, 0.6, 25.},
+    {41, 12., 8., 0.2, 0.1, 20.},
+    {4111, 10., 6., 0.5, -0.3, 15.},
+    {41, 30., 20., 0.0, 0.4, 30.},
+    {4111, 18., 12., -0.2, 0.2, 20.},
+    {4, 20., 15., 0.3, -0.2, 20.}
+};
+
+static int identical(const REAL8TimeSeries *a, const REAL8TimeSeries *b)
+{
+    return a->data->length == b->data->length
+        && XLALGPSCmp(&a->epoch, &b->epoch) == 0
+        && a->deltaT == b->deltaT
+        && memcmp(a->data->data, b->data->data, a->data->length * sizeof(REAL8)) == 0;
+}
+
+static int check_config(const struct config *c, LALSimIMRSpinAlignedEOBWorkspace *ws)
+{
+    REAL8TimeSeries *hplus = NULL, *hcross = NULL;
+    REAL8TimeSeries *hplusWS = NULL, *hcrossWS = NULL;
+    LALDict *params = XLALCreateDict();
+    XLAL_CHECK(params, XLAL_EFUNC);
+
+    int ret = XLALSimIMRSpinAlignedEOBWaveform(&hplus, &hcross, 0.3, DELTA_T,
+            c->m1 * LAL_MSUN_SI, c->m2 * LAL_MSUN_SI, c->fMin, DISTANCE, INCLINATION,
+            c->chi1, c->chi2, c->version, params);
+    if (ret == XLAL_SUCCESS)
+        ret = XLALSimIMRSpinAlignedEOBWaveformWithWorkspace(&hplusWS, &hcrossWS, 0.3, DELTA_T,
+                c->m1 * LAL_MSUN_SI, c->m2 * LAL_MSUN_SI, c->fMin, DISTANCE, INCLINATION,
+                c->chi1, c->chi2, c->version, params, ws);
+    XLALDestroyDict(params);
+    XLAL_CHECK(ret == XLAL_SUCCESS, XLAL_EFUNC);
+
+    const int same = identical(hplus, hplusWS) && identical(hcross, hcrossWS);
+    printf("version %u, %g + %g Msun from %g Hz: %u samples, %s\n", c->version, c->m1, c->m2, c->fMin,
+            hplus->data->length, same ? "identical" : "DIFFERENT");
+    XLALDestroyREAL8TimeSeries(hplus);
+    XLALDestroyREAL8TimeSeries(hcross);
+    XLALDestroyREAL8TimeSeries(hplusWS);
+    XLALDestroyREAL8TimeSeries(hcrossWS);
+    XLAL_CHECK(same, XLAL_EFAILED, "Waveform with workspace differs");
+    return XLAL_SUCCESS;
+}
+
+static int check_zero_pivot(void)
+{
+    const double x[] = {0., 0., 0., 1.};
+    const double y[] = {0., 1., 2., 3.};
+    double c[4], work[16];
+    int ret, errnum;
+    XLAL_TRY(ret = optimized_cspline_init(c, work, x, y, 4), errnum);
+    XLAL_CHECK(ret == XLAL_FAILURE && errnum == XLAL_EDOM, XLAL_EFAILED, "Zero pivot not detected");
+    return XLAL_SUCCESS;
+}
+
+int main(void)
+{
+    LALSimIMRSpinAlignedEOBWorkspace *ws = XLALSimIMRSpinAlignedEOBWorkspaceCreate();
+    XLAL_CHECK_MAIN(ws, XLAL_EFUNC);
+
+    for (UINT4 j = 0; j < XLAL_NUM_ELEM(configs); j++)
+        XLAL_CHECK_MAIN(check_config(&configs[j], ws) == XLAL_SUCCESS, XLAL_EFUNC);
+    XLALSimIMRSpinAlignedEOBWorkspaceDestroy(ws);
+
+    XLAL_CHECK_MAIN(check_zero_pivot() == XLAL_SUCCESS, XLAL_EFUNC);
+
+    LALCheckMemoryLeaks();
+    return EXIT_SUCCESS;
+}
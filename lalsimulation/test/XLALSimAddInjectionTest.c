@@ -98,9 +98,62 @@ static int TestXLALSimAddInjectionREAL8TimeSeries(void)
 }
 
 
+#define NBATCH		3
+#define BATCHTHRESH	1e-3
+
+
+static int TestXLALSimInjectDetectorStrainBatchREAL8TimeSeries(void)
+{
+	LIGOTimeGPS epoch = {1000000000, 0};
+	const double offsets[NBATCH] = {10.3, 30.77, 31.2};	/* seconds */
+	double ra[NBATCH] = {0.3, 2.1, 4.5};
+	double dec[NBATCH] = {-0.2, 0.7, 0.1};
+	double psi[NBATCH] = {0.5, 1.3, 2.9};
+	REAL8TimeSeries *hplus[NBATCH];
+	REAL8TimeSeries *hcross[NBATCH];
+	REAL8TimeSeries *single = XLALCreateREAL8TimeSeries(NULL, &epoch, 0.0, DELTA_T, &lalStrainUnit, 16384 * 64);
+	REAL8TimeSeries *batch = XLALCreateREAL8TimeSeries(NULL, &epoch, 0.0, DELTA_T, &lalStrainUnit, 16384 * 64);
+	LALDetector detector = *XLALDetectorPrefixToLALDetector("H1");
+	double maxref = 0.0, maxdiff = 0.0;
+	unsigned i;
+
+	XLAL_CHECK_EXIT(single && batch);
+	memset(single->data->data, 0, single->data->length * sizeof(*single->data->data));
+	memset(batch->data->data, 0, batch->data->length * sizeof(*batch->data->data));
+
+	/* inject one at a time and all at once */
+	for(i = 0; i < NBATCH; i++) {
+		hplus[i] = hcross[i] = NULL;
+		XLAL_CHECK_EXIT(XLALSimBurstSineGaussian(&hplus[i], &hcross[i], 9.0, 100.0 + 100.0 * i, 1e-21, 0.5, 0.0, DELTA_T) == 0);
+		XLALGPSAddGPS(&hplus[i]->epoch, &epoch);
+		XLALGPSAddGPS(&hcross[i]->epoch, &epoch);
+		XLALGPSAdd(&hplus[i]->epoch, offsets[i]);
+		XLALGPSAdd(&hcross[i]->epoch, offsets[i]);
+		XLAL_CHECK_EXIT(XLALSimInjectDetectorStrainREAL8TimeSeries(single, hplus[i], hcross[i], ra[i], dec[i], psi[i], &detector, NULL) == 0);
+	}
+	XLAL_CHECK_EXIT(XLALSimInjectDetectorStrainBatchREAL8TimeSeries(batch, hplus, hcross, ra, dec, psi, NBATCH, &detector, NULL) == 0);
+
+	for(i = 0; i < single->data->length; i++) {
+		maxref = fmax(maxref, fabs(single->data->data[i]));
+		maxdiff = fmax(maxdiff, fabs(single->data->data[i] - batch->data->data[i]));
+	}
+
+	for(i = 0; i < NBATCH; i++) {
+		XLALDestroyREAL8TimeSeries(hplus[i]);
+		XLALDestroyREAL8TimeSeries(hcross[i]);
+	}
+	XLALDestroyREAL8TimeSeries(single);
+	XLALDestroyREAL8TimeSeries(batch);
+
+	XLAL_CHECK_EXIT(maxref > 0.0);
+	XLAL_CHECK_EXIT(maxdiff / maxref < BATCHTHRESH);
+	return 0;
+}
+
+
 int main(int argc, char *argv[])
 {
 	(void) argc;	/* silence unused parameter warning */
 	(void) argv;	/* silence unused parameter warning */
-	return TestXLALSimAddInjectionREAL4TimeSeries() || TestXLALSimAddInjectionREAL8TimeSeries();
+	return TestXLALSimAddInjectionREAL4TimeSeries() || TestXLALSimAddInjectionREAL8TimeSeries() || TestXLALSimInjectDetectorStrainBatchREAL8TimeSeries();
 }